@@ -0,0 +1,4 @@
+MRUBY_CFLAGS = -g -std=gnu99 -O3 -Wall -Werror-implicit-function-declaration -Wdeclaration-after-statement -DMRB_DEBUG -I\"/root/repo/include\" -I\"/root/repo/mrbgems/mruby-objectspace/include\" -I\"/root/repo/mrbgems/mruby-slab/include\"
+MRUBY_LDFLAGS =  -L/root/repo/build/host/lib
+MRUBY_LDFLAGS_BEFORE_LIBS = 
+MRUBY_LIBS = -lmruby -lm -ltermcap -lreadline
@@ -0,0 +1,621 @@
+/*
+ * This file is loading the irep
+ * Ruby GEM code.
+ *
+ * IMPORTANT:
+ *   This file was generated!
+ *   All manual changes will get lost.
+ */
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/irep.h"
+#include <stdint.h>
+const uint8_t gem_mrblib_irep_mruby_array_ext[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x32,0x14,0xe3,0x00,0x00,0x24,0xd7,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x1a,0x1e,0x30,0x30,
+0x30,0x30,0x00,0x00,0x00,0x32,0x00,0x01,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x05,
+0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0x45,
+0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x41,0x72,
+0x72,0x61,0x79,0x00,0x00,0x00,0x01,0xef,0x00,0x01,0x00,0x03,0x00,0x15,0x00,0x00,
+0x00,0x44,0x00,0x80,0x00,0x48,0x01,0x00,0x00,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,
+0x04,0xc0,0x00,0x80,0x80,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x06,0xc0,0x00,0x80,
+0xc0,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x08,0xc0,0x00,0x81,0x00,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x0a,0xc0,0x00,0x81,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,
+0x0c,0xc0,0x00,0x81,0x80,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x0e,0xc0,0x00,0x81,
+0xc0,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x10,0xc0,0x00,0x82,0x00,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x12,0xc0,0x00,0x82,0x40,0x46,0x00,0x80,0x05,0x11,0x00,0x82,
+0xc0,0x20,0x00,0x80,0x06,0x12,0x00,0x80,0x00,0x48,0x01,0x00,0x14,0xc0,0x00,0x83,
+0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x16,0xc0,0x00,0x83,0x80,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x18,0xc0,0x00,0x83,0xc0,0x46,0x00,0x80,0x00,0x48,0x01,0x00,
+0x1a,0xc0,0x00,0x84,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x1c,0xc0,0x00,0x84,
+0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x1e,0xc0,0x00,0x84,0x80,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x20,0xc0,0x00,0x84,0xc0,0x46,0x00,0x80,0x00,0x48,0x01,0x00,
+0x22,0xc0,0x00,0x85,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x24,0xc0,0x00,0x84,
+0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x26,0xc0,0x00,0x85,0x40,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x28,0xc0,0x00,0x85,0x80,0x46,0x00,0x80,0x0b,0x04,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x00,0x05,0x75,0x6e,0x69,0x71,
+0x21,0x00,0x00,0x04,0x75,0x6e,0x69,0x71,0x00,0x00,0x01,0x2d,0x00,0x00,0x01,0x7c,
+0x00,0x00,0x01,0x26,0x00,0x00,0x07,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x00,0x00,
+0x08,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x21,0x00,0x00,0x07,0x63,0x6f,0x6d,0x70,
+0x61,0x63,0x74,0x00,0x00,0x08,0x63,0x6f,0x6d,0x70,0x61,0x63,0x74,0x21,0x00,0x00,
+0x0c,0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x5f,0x65,0x61,0x63,0x68,0x00,0x00,0x06,
+0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x4e,
+0x4f,0x4e,0x45,0x00,0x00,0x05,0x66,0x65,0x74,0x63,0x68,0x00,0x00,0x04,0x66,0x69,
+0x6c,0x6c,0x00,0x00,0x06,0x72,0x6f,0x74,0x61,0x74,0x65,0x00,0x00,0x07,0x72,0x6f,
+0x74,0x61,0x74,0x65,0x21,0x00,0x00,0x09,0x64,0x65,0x6c,0x65,0x74,0x65,0x5f,0x69,
+0x66,0x00,0x00,0x07,0x72,0x65,0x6a,0x65,0x63,0x74,0x21,0x00,0x00,0x06,0x69,0x6e,
+0x73,0x65,0x72,0x74,0x00,0x00,0x07,0x62,0x73,0x65,0x61,0x72,0x63,0x68,0x00,0x00,
+0x07,0x6b,0x65,0x65,0x70,0x5f,0x69,0x66,0x00,0x00,0x07,0x73,0x65,0x6c,0x65,0x63,
+0x74,0x21,0x00,0x00,0x00,0x01,0x68,0x00,0x07,0x00,0x0c,0x00,0x01,0x00,0x00,0x00,
+0x3c,0x00,0x00,0x00,0xa6,0x03,0x80,0x00,0x06,0x03,0x80,0x00,0x20,0x01,0x01,0xc0,
+0x01,0x01,0x81,0xc0,0x37,0x00,0xc0,0x0e,0x19,0x02,0x01,0xc0,0x3f,0x00,0x40,0x08,
+0x97,0x03,0x80,0x80,0x01,0x03,0x80,0x40,0x20,0x02,0x81,0xc0,0x01,0x03,0x80,0x40,
+0x01,0x04,0x01,0x40,0x01,0x03,0x80,0x80,0xa0,0x03,0x01,0xc0,0x01,0x03,0x81,0x00,
+0x01,0x04,0x01,0x80,0x01,0x03,0x80,0xc0,0xa0,0x03,0xc0,0x00,0x99,0x00,0x40,0x02,
+0x97,0x03,0x81,0x40,0x01,0x04,0x01,0x00,0x01,0x04,0x81,0x80,0x01,0x05,0x01,0xc0,
+0x01,0x04,0x01,0x01,0x20,0x03,0x80,0x80,0x01,0x03,0x81,0x40,0x20,0x04,0x3f,0xff,
+0x83,0x03,0x81,0x80,0xb5,0x03,0xbf,0xf5,0x18,0x03,0x81,0x00,0x01,0x04,0x00,0x01,
+0x40,0x03,0x81,0xc0,0x21,0x00,0x40,0x07,0x17,0x00,0x40,0x04,0x17,0x03,0x80,0xc0,
+0x01,0x04,0x00,0x80,0x01,0x04,0x00,0x40,0x20,0x03,0x82,0x00,0xa0,0x03,0x80,0x80,
+0x01,0x04,0x00,0xc0,0x01,0x04,0x02,0x80,0x20,0x03,0x82,0x40,0xa0,0x03,0x80,0x80,
+0x01,0x03,0x81,0x40,0x20,0x04,0x3f,0xff,0x83,0x03,0x81,0x80,0xb5,0x03,0xbf,0xf9,
+0x98,0x03,0x80,0xc0,0x01,0x03,0x81,0x40,0x20,0x04,0x00,0x00,0x06,0x04,0x01,0x40,
+0x20,0x03,0x82,0xc0,0xb2,0x03,0xc0,0x01,0x19,0x03,0x80,0x00,0x05,0x00,0x40,0x01,
+0x97,0x03,0x80,0x00,0x06,0x04,0x00,0xc0,0x01,0x03,0x83,0x00,0xa0,0x03,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x03,0x64,0x75,0x70,0x00,0x00,
+0x05,0x73,0x68,0x69,0x66,0x74,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x08,
+0x68,0x61,0x73,0x5f,0x6b,0x65,0x79,0x3f,0x00,0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,
+0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x01,0x3e,0x00,0x00,0x0a,0x65,0x61,0x63,0x68,
+0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x02,0x3c,0x3c,0x00,0x00,0x06,0x64,0x65,
+0x6c,0x65,0x74,0x65,0x00,0x00,0x04,0x6c,0x61,0x73,0x74,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x07,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x00,0x00,0x00,0x00,0x2f,0x00,
+0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0xc0,
+0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x54,0x00,0x03,
+0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0xa6,0x01,0x80,0x00,0x06,
+0x01,0x80,0x00,0x20,0x01,0x00,0xc0,0x01,0x00,0xc0,0x02,0x19,0x01,0x80,0x80,0x01,
+0x02,0x00,0x40,0x01,0x01,0x80,0x40,0x21,0x00,0x40,0x01,0x17,0x01,0x80,0x80,0x01,
+0x01,0x80,0x40,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x03,0x64,0x75,0x70,0x00,0x00,0x05,0x75,0x6e,0x69,0x71,0x21,0x00,0x00,0x00,
+0x00,0xc9,0x00,0x05,0x00,0x0a,0x00,0x02,0x00,0x00,0x00,0x19,0x02,0x00,0x00,0x26,
+0x02,0x80,0x40,0x01,0x02,0x80,0x00,0x20,0x03,0x00,0x01,0x11,0x02,0x80,0x40,0xb2,
+0x02,0xc0,0x00,0x99,0x00,0x40,0x04,0x97,0x02,0x80,0x00,0x06,0x03,0x00,0x02,0x11,
+0x03,0x80,0x00,0x3d,0x04,0x00,0x40,0x01,0x04,0x00,0x00,0x20,0x03,0x82,0x00,0x3e,
+0x04,0x00,0x00,0xbd,0x03,0x82,0x00,0x3e,0x02,0x80,0xc1,0x20,0x01,0x81,0x40,0x3f,
+0x02,0x01,0x40,0x37,0x02,0x80,0x40,0x01,0x03,0x00,0x01,0x40,0x02,0x81,0x40,0x21,
+0x02,0x80,0x00,0x06,0x03,0x00,0x03,0x40,0x02,0x81,0x40,0x21,0x02,0x00,0x00,0x29,
+0x00,0x00,0x00,0x02,0x00,0x00,0x0e,0x63,0x61,0x6e,0x27,0x74,0x20,0x63,0x6f,0x6e,
+0x76,0x65,0x72,0x74,0x20,0x00,0x00,0x0b,0x20,0x69,0x6e,0x74,0x6f,0x20,0x41,0x72,
+0x72,0x61,0x79,0x00,0x00,0x00,0x06,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x05,0x72,0x61,
+0x69,0x73,0x65,0x00,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,
+0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x38,0x00,0x03,0x00,0x08,0x00,
+0x00,0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x07,0x02,0x00,0xc0,
+0x15,0x02,0x80,0x40,0x01,0x03,0x00,0xc0,0x01,0x02,0x00,0x01,0x20,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,
+0x00,0x00,0x4c,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0b,0x02,0x00,0x00,
+0x26,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0xc0,0x01,
+0x19,0x01,0x80,0x00,0x05,0x00,0x40,0x01,0x97,0x01,0x81,0x00,0x15,0x02,0x00,0x40,
+0x01,0x01,0x80,0x40,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0xca,0x00,
+0x04,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x18,0x02,0x00,0x00,0x26,0x02,0x00,0x40,
+0x01,0x02,0x00,0x00,0x20,0x02,0x80,0x01,0x11,0x02,0x00,0x40,0xb2,0x02,0x40,0x00,
+0x99,0x00,0x40,0x04,0x97,0x02,0x00,0x00,0x06,0x02,0x80,0x02,0x11,0x03,0x00,0x00,
+0x3d,0x03,0x80,0x40,0x01,0x03,0x80,0x00,0x20,0x03,0x01,0xc0,0x3e,0x03,0x80,0x00,
+0xbd,0x03,0x01,0xc0,0x3e,0x02,0x00,0xc1,0x20,0x02,0x00,0x00,0x06,0x02,0x80,0x40,
+0x01,0x02,0x01,0x40,0xac,0x01,0x81,0x00,0x01,0x02,0x01,0x80,0x20,0x02,0x40,0x00,
+0x98,0x02,0x00,0xc0,0x01,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x0e,
+0x63,0x61,0x6e,0x27,0x74,0x20,0x63,0x6f,0x6e,0x76,0x65,0x72,0x74,0x20,0x00,0x00,
+0x0b,0x20,0x69,0x6e,0x74,0x6f,0x20,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x00,0x07,
+0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x41,
+0x72,0x72,0x61,0x79,0x00,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x09,0x54,
+0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x01,0x2b,0x00,0x00,0x05,0x75,
+0x6e,0x69,0x71,0x21,0x00,0x00,0x00,0x00,0xc9,0x00,0x05,0x00,0x0a,0x00,0x02,0x00,
+0x00,0x00,0x19,0x02,0x00,0x00,0x26,0x02,0x80,0x40,0x01,0x02,0x80,0x00,0x20,0x03,
+0x00,0x01,0x11,0x02,0x80,0x40,0xb2,0x02,0xc0,0x00,0x99,0x00,0x40,0x04,0x97,0x02,
+0x80,0x00,0x06,0x03,0x00,0x02,0x11,0x03,0x80,0x00,0x3d,0x04,0x00,0x40,0x01,0x04,
+0x00,0x00,0x20,0x03,0x82,0x00,0x3e,0x04,0x00,0x00,0xbd,0x03,0x82,0x00,0x3e,0x02,
+0x80,0xc1,0x20,0x01,0x81,0x40,0x3f,0x02,0x01,0x40,0x37,0x02,0x80,0x40,0x01,0x03,
+0x00,0x01,0x40,0x02,0x81,0x40,0x21,0x02,0x80,0x00,0x06,0x03,0x00,0x03,0x40,0x02,
+0x81,0x40,0x21,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x0e,0x63,0x61,
+0x6e,0x27,0x74,0x20,0x63,0x6f,0x6e,0x76,0x65,0x72,0x74,0x20,0x00,0x00,0x0b,0x20,
+0x69,0x6e,0x74,0x6f,0x20,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x00,0x06,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x41,0x72,0x72,
+0x61,0x79,0x00,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x09,0x54,0x79,0x70,
+0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,
+0x00,0x38,0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x26,
+0x01,0x80,0x00,0x07,0x02,0x00,0xc0,0x15,0x02,0x80,0x40,0x01,0x03,0x00,0xc0,0x01,
+0x02,0x00,0x01,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,0x00,0x00,0x61,0x00,0x03,0x00,0x06,0x00,0x00,
+0x00,0x00,0x00,0x0e,0x02,0x00,0x00,0x26,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,0x01,
+0x01,0x80,0x00,0xa0,0x01,0xc0,0x03,0x99,0x01,0x81,0x00,0x15,0x02,0x00,0x40,0x01,
+0x01,0x80,0x40,0xa0,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x80,0xa0,
+0x00,0x40,0x00,0x97,0x01,0x80,0x00,0x05,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3c,0x3c,0x00,0x00,0x06,
+0x64,0x65,0x6c,0x65,0x74,0x65,0x00,0x00,0x00,0x00,0x41,0x00,0x04,0x00,0x06,0x00,
+0x01,0x00,0x00,0x00,0x09,0x00,0x10,0x00,0x26,0x00,0x40,0x00,0x97,0x00,0x40,0x00,
+0x97,0x00,0x80,0x00,0x05,0x01,0x81,0x00,0x37,0x02,0x00,0x00,0x06,0x02,0x80,0x01,
+0x40,0x02,0x00,0x00,0x21,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0xbc,0x00,0x03,0x00,0x08,
+0x00,0x00,0x00,0x00,0x00,0x1d,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,
+0x00,0x91,0x01,0x80,0x00,0xa0,0x01,0xc0,0x03,0x19,0x01,0x80,0x40,0x15,0x01,0x80,
+0x80,0x20,0x01,0xc0,0x01,0x98,0x01,0x80,0x40,0x15,0x02,0x3f,0xff,0x83,0x01,0x80,
+0xc0,0xb5,0x01,0xc0,0x06,0x99,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,0x01,0x02,0x80,
+0x40,0x15,0x02,0x80,0x80,0x20,0x02,0xc0,0x01,0x19,0x02,0x80,0x00,0x05,0x00,0x40,
+0x01,0x17,0x02,0x80,0x40,0x15,0x02,0x81,0x40,0xaf,0x02,0x01,0x00,0xa0,0x01,0x81,
+0x80,0xac,0x01,0x80,0xc0,0x16,0x00,0x40,0x01,0x97,0x01,0x80,0xc0,0x15,0x02,0x00,
+0x40,0x01,0x01,0x81,0xc0,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x08,0x00,0x05,0x69,0x73,0x5f,0x61,0x3f,0x00,0x00,0x05,0x41,0x72,0x72,0x61,
+0x79,0x00,0x00,0x04,0x6e,0x69,0x6c,0x3f,0x00,0x00,0x01,0x3e,0x00,0x00,0x07,0x66,
+0x6c,0x61,0x74,0x74,0x65,0x6e,0x00,0x00,0x01,0x2d,0x00,0x00,0x01,0x2b,0x00,0x00,
+0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x67,0x00,0x05,0x00,0x08,0x00,0x01,0x00,0x00,
+0x00,0x10,0x00,0x10,0x00,0x26,0x00,0x40,0x00,0x97,0x00,0x40,0x00,0x97,0x00,0x80,
+0x00,0x05,0x01,0x80,0x00,0x08,0x02,0x01,0x40,0x37,0x02,0x80,0x00,0x06,0x03,0x00,
+0x01,0x40,0x02,0x80,0x00,0x21,0x01,0xc0,0x02,0x19,0x02,0x80,0x00,0x06,0x03,0x01,
+0x00,0x01,0x02,0x80,0x40,0xa0,0x00,0x40,0x00,0x97,0x02,0x80,0x00,0x05,0x02,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x65,0x61,0x63,0x68,
+0x00,0x00,0x07,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x00,0x00,0x00,0x00,0xc4,0x00,
+0x03,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x1f,0x02,0x00,0x00,0x26,0x01,0x80,0x40,
+0x01,0x02,0x00,0x00,0x91,0x01,0x80,0x00,0xa0,0x01,0xc0,0x03,0x19,0x01,0x80,0x40,
+0x15,0x01,0x80,0x80,0x20,0x01,0xc0,0x01,0x98,0x01,0x80,0x40,0x15,0x02,0x3f,0xff,
+0x83,0x01,0x80,0xc0,0xb5,0x01,0xc0,0x07,0x99,0x01,0x81,0x00,0x15,0x02,0x00,0x40,
+0x01,0x02,0x80,0x40,0x15,0x02,0x80,0x80,0x20,0x02,0xc0,0x01,0x19,0x02,0x80,0x00,
+0x05,0x00,0x40,0x01,0x17,0x02,0x80,0x40,0x15,0x02,0x81,0x40,0xaf,0x02,0x01,0x00,
+0xa0,0x01,0x81,0x80,0xac,0x01,0x81,0x00,0x16,0x01,0x80,0x00,0x07,0x01,0x80,0xc0,
+0x16,0x00,0x40,0x01,0x97,0x01,0x81,0x00,0x15,0x02,0x00,0x40,0x01,0x01,0x81,0xc0,
+0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x05,0x69,
+0x73,0x5f,0x61,0x3f,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x04,0x6e,
+0x69,0x6c,0x3f,0x00,0x00,0x01,0x3e,0x00,0x00,0x07,0x66,0x6c,0x61,0x74,0x74,0x65,
+0x6e,0x00,0x00,0x01,0x2d,0x00,0x00,0x01,0x2b,0x00,0x00,0x02,0x3c,0x3c,0x00,0x00,
+0x00,0x00,0x3f,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+0x26,0x01,0x80,0x00,0x06,0x01,0x80,0x00,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,
+0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x03,0x64,
+0x75,0x70,0x00,0x00,0x08,0x63,0x6f,0x6d,0x70,0x61,0x63,0x74,0x21,0x00,0x00,0x00,
+0x00,0x75,0x00,0x03,0x00,0x06,0x00,0x01,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x26,
+0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x40,0x01,0x80,0x00,0x21,0x01,0x00,0xc0,0x01,
+0x01,0x80,0x40,0x20,0x02,0x00,0x00,0x06,0x02,0x00,0x40,0x20,0x01,0x80,0x80,0xb2,
+0x01,0xc0,0x01,0x19,0x01,0x80,0x00,0x05,0x00,0x40,0x01,0x97,0x01,0x80,0x00,0x06,
+0x02,0x00,0x80,0x01,0x01,0x80,0xc0,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x06,0x73,0x65,0x6c,0x65,0x63,0x74,0x00,0x00,0x04,0x73,
+0x69,0x7a,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x07,0x72,0x65,0x70,0x6c,0x61,
+0x63,0x65,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,
+0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x05,0x01,0x80,0x00,
+0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x21,
+0x3d,0x00,0x00,0x00,0x00,0xca,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x1c,
+0x00,0x00,0x00,0xa6,0x01,0x80,0x00,0x06,0x01,0x80,0x00,0x20,0x01,0xc0,0x00,0x99,
+0x00,0x40,0x02,0x17,0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x04,0x01,0x80,0x40,0xa0,
+0x01,0x80,0x00,0x29,0x01,0x80,0x00,0x06,0x01,0x80,0xc0,0x20,0x01,0x81,0x00,0xaf,
+0x01,0x00,0xc0,0x01,0x00,0x40,0x04,0x17,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x06,
+0x02,0x80,0x80,0x01,0x02,0x01,0x80,0xa0,0x01,0x81,0x40,0xa0,0x01,0x80,0x80,0x01,
+0x01,0x81,0x00,0xaf,0x01,0x00,0xc0,0x01,0x01,0x80,0x80,0x01,0x02,0x3f,0xff,0x83,
+0x01,0x81,0xc0,0xb6,0x01,0xbf,0xfa,0x18,0x01,0x80,0x00,0x06,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0c,0x62,0x6c,0x6f,0x63,0x6b,0x5f,
+0x67,0x69,0x76,0x65,0x6e,0x3f,0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,
+0x00,0x00,0x0c,0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x5f,0x65,0x61,0x63,0x68,0x00,
+0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x01,0x2d,0x00,0x00,0x04,0x63,0x61,0x6c,
+0x6c,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3e,0x3d,0x00,0x00,0x00,0x01,0xd5,
+0x00,0x05,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x45,0x00,0x20,0x00,0xa6,0x00,0x40,
+0x01,0x17,0x00,0x40,0x01,0x17,0x00,0x40,0x01,0x17,0x00,0x80,0x00,0x05,0x01,0x00,
+0x00,0x11,0x02,0x80,0x40,0x01,0x03,0x00,0x00,0x05,0x02,0x80,0x40,0xa0,0x02,0xc0,
+0x01,0x99,0x02,0x80,0x80,0x01,0x03,0x00,0x00,0x11,0x02,0x80,0x40,0xa0,0x02,0xc0,
+0x00,0x99,0x02,0x80,0xc0,0x01,0x02,0xc0,0x01,0x99,0x02,0x80,0x00,0x06,0x03,0x00,
+0x00,0x3d,0x02,0x80,0x80,0xa0,0x02,0x00,0x40,0x01,0x02,0x81,0x00,0x01,0x03,0x3f,
+0xff,0x83,0x02,0x80,0xc0,0xb3,0x02,0xc0,0x02,0x99,0x02,0x81,0x00,0x01,0x03,0x00,
+0x00,0x06,0x03,0x01,0x00,0x20,0x02,0x81,0x40,0xac,0x02,0x01,0x40,0x01,0x02,0x81,
+0x00,0x01,0x03,0x3f,0xff,0x83,0x02,0x80,0xc0,0xb3,0x02,0xc0,0x02,0x18,0x02,0x80,
+0x00,0x06,0x02,0x81,0x00,0x20,0x03,0x01,0x00,0x01,0x02,0x81,0x80,0xb4,0x02,0xc0,
+0x0d,0x99,0x01,0xc0,0x02,0x19,0x02,0x80,0xc0,0x01,0x03,0x00,0x40,0x01,0x02,0x81,
+0xc0,0xa0,0x02,0x80,0x00,0x29,0x02,0x80,0x80,0x01,0x03,0x00,0x00,0x11,0x02,0x82,
+0x00,0xb2,0x02,0xc0,0x08,0x99,0x02,0x80,0x00,0x06,0x03,0x00,0x05,0x11,0x03,0x80,
+0x00,0xbd,0x04,0x00,0x40,0x01,0x03,0x82,0x00,0x3e,0x04,0x00,0x01,0x3d,0x03,0x82,
+0x00,0x3e,0x04,0x00,0x00,0x06,0x04,0x01,0x00,0x20,0x04,0x02,0xc0,0x20,0x03,0x82,
+0x00,0x3e,0x04,0x00,0x01,0xbd,0x03,0x82,0x00,0x3e,0x04,0x00,0x00,0x06,0x04,0x01,
+0x00,0x20,0x03,0x82,0x00,0x3e,0x02,0x82,0x41,0x20,0x01,0x00,0x00,0x29,0x02,0x80,
+0x00,0x06,0x03,0x01,0x00,0x01,0x02,0x83,0x00,0xa0,0x02,0x80,0x00,0x29,0x00,0x00,
+0x00,0x05,0x00,0x00,0x27,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x73,0x75,0x70,0x65,0x72,
+0x73,0x65,0x64,0x65,0x73,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x20,0x76,0x61,
+0x6c,0x75,0x65,0x20,0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x00,0x00,0x06,0x69,
+0x6e,0x64,0x65,0x78,0x20,0x00,0x00,0x1a,0x20,0x6f,0x75,0x74,0x73,0x69,0x64,0x65,
+0x20,0x6f,0x66,0x20,0x61,0x72,0x72,0x61,0x79,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,
+0x3a,0x20,0x00,0x00,0x03,0x2e,0x2e,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,
+0x04,0x4e,0x4f,0x4e,0x45,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,0x04,0x77,0x61,0x72,
+0x6e,0x00,0x00,0x01,0x3c,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x01,0x2b,
+0x00,0x00,0x02,0x3c,0x3d,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0a,0x49,0x6e,0x64,0x65,
+0x78,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x02,0x2d,0x40,0x00,0x00,0x02,0x5b,0x5d,
+0x00,0x00,0x00,0x04,0x61,0x00,0x09,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0xec,0x00,
+0x30,0x00,0xa6,0x00,0x40,0x01,0x97,0x00,0x40,0x01,0x97,0x00,0x40,0x01,0x97,0x00,
+0x40,0x01,0x97,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x01,0x80,0x00,0x05,0x04,
+0x80,0x40,0x01,0x05,0x00,0x00,0x05,0x04,0x80,0x00,0xb2,0x04,0xc0,0x01,0x99,0x04,
+0x80,0x80,0x01,0x05,0x00,0x00,0x05,0x04,0x80,0x00,0xb2,0x04,0xc0,0x01,0x99,0x04,
+0x80,0xc0,0x01,0x05,0x00,0x00,0x05,0x04,0x80,0x00,0xb2,0x04,0xc0,0x01,0x19,0x04,
+0x81,0x00,0x01,0x04,0x80,0x40,0x20,0x04,0xc0,0x02,0x19,0x04,0x80,0x00,0x06,0x05,
+0x00,0x01,0x91,0x05,0x80,0x00,0x3d,0x04,0x80,0x81,0x20,0x04,0xbf,0xff,0x83,0x03,
+0x02,0x40,0x01,0x02,0x82,0x40,0x01,0x03,0x82,0x40,0x37,0x02,0x40,0x29,0x19,0x04,
+0x80,0x40,0x01,0x05,0x00,0x00,0x05,0x04,0x80,0x00,0xb2,0x04,0xc0,0x01,0x99,0x04,
+0x80,0x80,0x01,0x05,0x00,0x00,0x05,0x04,0x80,0x00,0xb2,0x04,0xc0,0x01,0x99,0x04,
+0x80,0xc0,0x01,0x05,0x00,0x00,0x05,0x04,0x80,0x00,0xb2,0x04,0xc0,0x02,0x99,0x02,
+0xbf,0xff,0x83,0x04,0x80,0x00,0x06,0x04,0x81,0x00,0x20,0x03,0x02,0x40,0x01,0x00,
+0x40,0x20,0x17,0x04,0x80,0x40,0x01,0x05,0x00,0x00,0x05,0x04,0x81,0x40,0xa0,0x04,
+0xc0,0x01,0x99,0x04,0x80,0x40,0x01,0x05,0x00,0x03,0x91,0x04,0x81,0x80,0xa0,0x04,
+0xc0,0x0f,0x19,0x04,0x80,0x40,0x01,0x04,0x82,0x00,0x20,0x02,0x82,0x40,0x01,0x05,
+0x3f,0xff,0x83,0x04,0x82,0x40,0xb3,0x04,0xc0,0x02,0x99,0x04,0x81,0x40,0x01,0x05,
+0x00,0x00,0x06,0x05,0x01,0x00,0x20,0x04,0x82,0x80,0xac,0x02,0x82,0x40,0x01,0x04,
+0x80,0x40,0x01,0x04,0x82,0xc0,0x20,0x03,0x02,0x40,0x01,0x05,0x3f,0xff,0x83,0x04,
+0x82,0x40,0xb3,0x04,0xc0,0x02,0x99,0x04,0x81,0x80,0x01,0x05,0x00,0x00,0x06,0x05,
+0x01,0x00,0x20,0x04,0x82,0x80,0xac,0x03,0x02,0x40,0x01,0x04,0x80,0x40,0x01,0x04,
+0x83,0x00,0x20,0x04,0xc0,0x00,0x99,0x00,0x40,0x01,0x97,0x04,0x81,0x80,0x01,0x04,
+0x82,0x80,0xad,0x03,0x02,0x40,0x01,0x00,0x40,0x0d,0x17,0x04,0x80,0x40,0x01,0x05,
+0x00,0x00,0x05,0x04,0x81,0x40,0xa0,0x04,0xc0,0x0b,0x19,0x02,0x80,0x40,0x01,0x04,
+0x81,0x40,0x01,0x05,0x3f,0xff,0x83,0x04,0x82,0x40,0xb3,0x04,0xc0,0x02,0x99,0x04,
+0x81,0x40,0x01,0x05,0x00,0x00,0x06,0x05,0x01,0x00,0x20,0x04,0x82,0x80,0xac,0x02,
+0x82,0x40,0x01,0x04,0x80,0x80,0x01,0x05,0x00,0x00,0x05,0x04,0x80,0x00,0xb2,0x04,
+0xc0,0x02,0x19,0x04,0x80,0x00,0x06,0x04,0x81,0x00,0x20,0x03,0x02,0x40,0x01,0x00,
+0x40,0x02,0x17,0x04,0x80,0x40,0x01,0x05,0x00,0x80,0x01,0x04,0x82,0x80,0xac,0x03,
+0x02,0x40,0x01,0x00,0x40,0x2c,0x97,0x04,0x80,0x40,0x01,0x05,0x00,0x00,0x05,0x04,
+0x81,0x40,0xa0,0x04,0xc0,0x01,0x99,0x04,0x80,0x80,0x01,0x05,0x00,0x00,0x05,0x04,
+0x80,0x00,0xb2,0x04,0xc0,0x01,0x99,0x04,0x80,0xc0,0x01,0x05,0x00,0x00,0x05,0x04,
+0x80,0x00,0xb2,0x04,0xc0,0x02,0x99,0x02,0xbf,0xff,0x83,0x04,0x80,0x00,0x06,0x04,
+0x81,0x00,0x20,0x03,0x02,0x40,0x01,0x00,0x40,0x24,0x17,0x04,0x80,0x40,0x01,0x05,
+0x00,0x00,0x05,0x04,0x81,0x40,0xa0,0x04,0xc0,0x01,0x99,0x04,0x80,0x80,0x01,0x05,
+0x00,0x00,0x05,0x04,0x81,0x40,0xa0,0x04,0xc0,0x01,0x99,0x04,0x80,0x80,0x01,0x05,
+0x00,0x03,0x91,0x04,0x81,0x80,0xa0,0x04,0xc0,0x0f,0x19,0x04,0x80,0x80,0x01,0x04,
+0x82,0x00,0x20,0x02,0x82,0x40,0x01,0x05,0x3f,0xff,0x83,0x04,0x82,0x40,0xb3,0x04,
+0xc0,0x02,0x99,0x04,0x81,0x40,0x01,0x05,0x00,0x00,0x06,0x05,0x01,0x00,0x20,0x04,
+0x82,0x80,0xac,0x02,0x82,0x40,0x01,0x04,0x80,0x80,0x01,0x04,0x82,0xc0,0x20,0x03,
+0x02,0x40,0x01,0x05,0x3f,0xff,0x83,0x04,0x82,0x40,0xb3,0x04,0xc0,0x02,0x99,0x04,
+0x81,0x80,0x01,0x05,0x00,0x00,0x06,0x05,0x01,0x00,0x20,0x04,0x82,0x80,0xac,0x03,
+0x02,0x40,0x01,0x04,0x80,0x80,0x01,0x04,0x83,0x00,0x20,0x04,0xc0,0x00,0x99,0x00,
+0x40,0x01,0x97,0x04,0x81,0x80,0x01,0x04,0x82,0x80,0xad,0x03,0x02,0x40,0x01,0x00,
+0x40,0x0f,0x17,0x04,0x80,0x40,0x01,0x05,0x00,0x00,0x05,0x04,0x81,0x40,0xa0,0x04,
+0xc0,0x01,0x99,0x04,0x80,0x80,0x01,0x05,0x00,0x00,0x05,0x04,0x81,0x40,0xa0,0x04,
+0xc0,0x0b,0x19,0x02,0x80,0x80,0x01,0x04,0x81,0x40,0x01,0x05,0x3f,0xff,0x83,0x04,
+0x82,0x40,0xb3,0x04,0xc0,0x02,0x99,0x04,0x81,0x40,0x01,0x05,0x00,0x00,0x06,0x05,
+0x01,0x00,0x20,0x04,0x82,0x80,0xac,0x02,0x82,0x40,0x01,0x04,0x80,0xc0,0x01,0x05,
+0x00,0x00,0x05,0x04,0x80,0x00,0xb2,0x04,0xc0,0x02,0x19,0x04,0x80,0x00,0x06,0x04,
+0x81,0x00,0x20,0x03,0x02,0x40,0x01,0x00,0x40,0x02,0x17,0x04,0x81,0x40,0x01,0x05,
+0x00,0xc0,0x01,0x04,0x82,0x80,0xac,0x03,0x02,0x40,0x01,0x04,0x01,0x40,0x01,0x02,
+0x40,0x08,0x19,0x00,0x40,0x05,0x17,0x04,0x81,0x00,0x01,0x05,0x02,0x00,0x01,0x04,
+0x83,0x40,0xa0,0x05,0x00,0x00,0x06,0x05,0x82,0x00,0x01,0x06,0x02,0x40,0x01,0x05,
+0x03,0x81,0x20,0x04,0x82,0x00,0x01,0x04,0x82,0x80,0xad,0x04,0x02,0x40,0x01,0x04,
+0x82,0x00,0x01,0x05,0x01,0x80,0x01,0x04,0x82,0x40,0xb3,0x04,0xbf,0xf9,0x18,0x00,
+0x40,0x06,0x97,0x00,0x40,0x04,0x17,0x04,0x80,0x40,0x01,0x05,0x00,0x00,0x06,0x05,
+0x82,0x00,0x01,0x06,0x02,0x40,0x01,0x05,0x03,0x81,0x20,0x04,0x82,0x00,0x01,0x04,
+0x82,0x80,0xad,0x04,0x02,0x40,0x01,0x04,0x82,0x00,0x01,0x05,0x01,0x80,0x01,0x04,
+0x82,0x40,0xb3,0x04,0xbf,0xfa,0x18,0x04,0x80,0x00,0x06,0x04,0x80,0x00,0x29,0x00,
+0x00,0x00,0x01,0x00,0x00,0x26,0x77,0x72,0x6f,0x6e,0x67,0x20,0x6e,0x75,0x6d,0x62,
+0x65,0x72,0x20,0x6f,0x66,0x20,0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x73,0x20,
+0x28,0x30,0x20,0x66,0x6f,0x72,0x20,0x31,0x2e,0x2e,0x33,0x29,0x00,0x00,0x00,0x0f,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x01,0x21,0x00,0x00,0x05,0x72,0x61,0x69,0x73,0x65,
+0x00,0x00,0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,
+0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,0x08,0x6b,
+0x69,0x6e,0x64,0x5f,0x6f,0x66,0x3f,0x00,0x00,0x05,0x52,0x61,0x6e,0x67,0x65,0x00,
+0x00,0x05,0x62,0x65,0x67,0x69,0x6e,0x00,0x00,0x01,0x3c,0x00,0x00,0x01,0x2b,0x00,
+0x00,0x03,0x65,0x6e,0x64,0x00,0x00,0x0c,0x65,0x78,0x63,0x6c,0x75,0x64,0x65,0x5f,
+0x65,0x6e,0x64,0x3f,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x03,0x5b,0x5d,
+0x3d,0x00,0x00,0x00,0x00,0xb7,0x00,0x06,0x00,0x0a,0x00,0x01,0x00,0x00,0x00,0x1f,
+0x00,0x10,0x00,0x26,0x00,0x40,0x00,0x97,0x00,0x40,0x00,0x97,0x00,0xc0,0x00,0x03,
+0x01,0x81,0x80,0x37,0x03,0x00,0x00,0x06,0x03,0x00,0x00,0x20,0x02,0x01,0x80,0x01,
+0x03,0xbf,0xff,0x83,0x03,0x00,0x40,0xb5,0x03,0x40,0x09,0x99,0x03,0x00,0x40,0x01,
+0x03,0xbf,0xff,0x83,0x03,0x00,0x80,0xb3,0x03,0x40,0x04,0x19,0x03,0x01,0x00,0x01,
+0x03,0x80,0x40,0x01,0x03,0x81,0x00,0x20,0x04,0x01,0x00,0x01,0x03,0x81,0x40,0xa0,
+0x03,0x00,0xc0,0xae,0x03,0x00,0xc0,0xaf,0x00,0x40,0x01,0x97,0x03,0x00,0x40,0x01,
+0x03,0x81,0x00,0x01,0x03,0x01,0x40,0xa0,0x02,0x81,0x80,0x01,0x03,0x01,0x00,0x01,
+0x03,0x80,0x01,0x40,0x03,0x01,0x80,0x21,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x07,0x00,0x06,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x01,0x3e,
+0x00,0x00,0x01,0x3c,0x00,0x00,0x01,0x2d,0x00,0x00,0x01,0x7e,0x00,0x00,0x01,0x25,
+0x00,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x00,0x00,0x74,0x00,0x01,0x00,
+0x05,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x80,0xc0,0x15,0x01,0x00,0x00,0x06,0x01,
+0x81,0x40,0x15,0x01,0x00,0x40,0xa0,0x00,0x80,0x00,0xa0,0x00,0x81,0x40,0x15,0x00,
+0x80,0x80,0xad,0x00,0x81,0x40,0x16,0x00,0x81,0x40,0x15,0x01,0x01,0x00,0x15,0x01,
+0x01,0x00,0xaf,0x00,0x80,0xc0,0xb5,0x00,0xc0,0x01,0x99,0x00,0xbf,0xff,0x83,0x00,
+0x81,0x40,0x16,0x00,0x40,0x00,0x97,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x02,0x3c,0x3c,0x00,0x00,0x02,0x5b,0x5d,
+0x00,0x00,0x01,0x2b,0x00,0x00,0x01,0x3e,0x00,0x00,0x01,0x2d,0x00,0x00,0x00,0x00,
+0x51,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x10,0x00,0x26,0x00,
+0x40,0x00,0x97,0x00,0x40,0x00,0x97,0x00,0xc0,0x00,0x03,0x01,0x80,0x00,0x06,0x02,
+0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x02,0x00,0x40,0xa0,0x01,0x80,0x00,0xa0,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x72,0x65,0x70,
+0x6c,0x61,0x63,0x65,0x00,0x00,0x06,0x72,0x6f,0x74,0x61,0x74,0x65,0x00,0x00,0x00,
+0x00,0xde,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0xa6,
+0x01,0x80,0x00,0x06,0x01,0x80,0x00,0x20,0x01,0xc0,0x00,0x99,0x00,0x40,0x02,0x17,
+0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x04,0x01,0x80,0x40,0xa0,0x01,0x80,0x00,0x29,
+0x01,0x3f,0xff,0x83,0x00,0x40,0x06,0x97,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x06,
+0x02,0x80,0x80,0x01,0x02,0x01,0x00,0xa0,0x01,0x80,0xc0,0xa0,0x01,0xc0,0x02,0x19,
+0x01,0x80,0x00,0x06,0x02,0x00,0x80,0x01,0x01,0x81,0x40,0xa0,0x00,0x40,0x01,0x97,
+0x01,0x80,0x80,0x01,0x01,0x81,0x80,0xad,0x01,0x00,0xc0,0x01,0x01,0x80,0x80,0x01,
+0x02,0x00,0x00,0x06,0x02,0x02,0x00,0x20,0x01,0x81,0xc0,0xb3,0x01,0xbf,0xf7,0x18,
+0x01,0x80,0x00,0x06,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+0x00,0x0c,0x62,0x6c,0x6f,0x63,0x6b,0x5f,0x67,0x69,0x76,0x65,0x6e,0x3f,0x00,0x00,
+0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x09,0x64,0x65,0x6c,0x65,0x74,
+0x65,0x5f,0x69,0x66,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x02,0x5b,0x5d,
+0x00,0x00,0x09,0x64,0x65,0x6c,0x65,0x74,0x65,0x5f,0x61,0x74,0x00,0x00,0x01,0x2b,
+0x00,0x00,0x01,0x3c,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x00,0x01,0x09,
+0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0xa6,0x02,0x00,
+0x00,0x06,0x02,0x00,0x00,0x20,0x02,0x40,0x00,0x99,0x00,0x40,0x02,0x17,0x02,0x00,
+0x00,0x06,0x02,0x80,0x01,0x04,0x02,0x00,0x40,0xa0,0x02,0x00,0x00,0x29,0x02,0x00,
+0x00,0x06,0x02,0x00,0xc0,0x20,0x01,0x01,0x00,0x01,0x01,0xbf,0xff,0x83,0x00,0x40,
+0x06,0x97,0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x06,0x03,0x00,0xc0,0x01,0x02,0x81,
+0x40,0xa0,0x02,0x01,0x00,0xa0,0x02,0x40,0x02,0x19,0x02,0x00,0x00,0x06,0x02,0x80,
+0xc0,0x01,0x02,0x01,0x80,0xa0,0x00,0x40,0x01,0x97,0x02,0x00,0xc0,0x01,0x02,0x01,
+0xc0,0xad,0x01,0x81,0x00,0x01,0x02,0x00,0xc0,0x01,0x02,0x80,0x00,0x06,0x02,0x80,
+0xc0,0x20,0x02,0x02,0x00,0xb3,0x02,0x3f,0xf7,0x18,0x02,0x00,0x00,0x06,0x02,0x00,
+0xc0,0x20,0x02,0x80,0x80,0x01,0x02,0x02,0x40,0xb2,0x02,0x40,0x01,0x19,0x02,0x00,
+0x00,0x05,0x00,0x40,0x00,0x97,0x02,0x00,0x00,0x06,0x02,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x0c,0x62,0x6c,0x6f,0x63,0x6b,0x5f,0x67,0x69,
+0x76,0x65,0x6e,0x3f,0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,
+0x07,0x72,0x65,0x6a,0x65,0x63,0x74,0x21,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,
+0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x09,0x64,0x65,
+0x6c,0x65,0x74,0x65,0x5f,0x61,0x74,0x00,0x00,0x01,0x2b,0x00,0x00,0x01,0x3c,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x77,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,
+0x00,0x00,0x13,0x02,0x08,0x00,0x26,0x02,0x00,0x40,0x01,0x02,0xbf,0xff,0x83,0x02,
+0x00,0x00,0xb3,0x02,0x40,0x03,0x19,0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x06,0x02,
+0x80,0x40,0x20,0x02,0x80,0x80,0xad,0x02,0x00,0x80,0xac,0x00,0x81,0x00,0x01,0x02,
+0x00,0x80,0x01,0x02,0x80,0x00,0x06,0x03,0x00,0x40,0x01,0x03,0xbf,0xff,0x83,0x04,
+0x01,0x00,0x01,0x02,0x80,0xc1,0xa0,0x02,0x00,0x00,0x06,0x02,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x01,0x3c,0x00,0x00,0x04,0x73,0x69,0x7a,
+0x65,0x00,0x00,0x01,0x2b,0x00,0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,0x00,0x01,0xda,
+0x00,0x09,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x57,0x00,0x00,0x00,0xa6,0x04,0x80,
+0x00,0x06,0x04,0x80,0x00,0x20,0x04,0xc0,0x00,0x99,0x00,0x40,0x02,0x17,0x04,0x80,
+0x00,0x06,0x05,0x00,0x01,0x04,0x04,0x80,0x40,0xa0,0x04,0x80,0x00,0x29,0x01,0x3f,
+0xff,0x83,0x04,0x80,0x00,0x06,0x04,0x80,0xc0,0x20,0x01,0x82,0x40,0x01,0x02,0x00,
+0x00,0x08,0x00,0x40,0x1a,0x97,0x04,0x80,0x80,0x01,0x05,0x00,0xc0,0x01,0x05,0x80,
+0x80,0x01,0x05,0x01,0x40,0xae,0x05,0xc0,0x00,0x83,0x05,0x01,0x80,0xb1,0x05,0x01,
+0xc0,0x20,0x04,0x81,0x00,0xac,0x02,0x82,0x40,0x01,0x04,0x80,0x00,0x06,0x05,0x01,
+0x40,0x01,0x04,0x82,0x00,0xa0,0x03,0x02,0x40,0x01,0x04,0x80,0x40,0x01,0x05,0x01,
+0x80,0x01,0x04,0x82,0x40,0xa0,0x03,0x82,0x40,0x01,0x05,0x00,0x05,0x91,0x04,0x82,
+0x80,0xa0,0x04,0xc0,0x05,0x99,0x04,0x81,0xc0,0x01,0x05,0x3f,0xff,0x83,0x04,0x83,
+0x00,0xb2,0x04,0xc0,0x01,0x19,0x04,0x81,0x80,0x01,0x04,0x80,0x80,0x29,0x04,0x81,
+0xc0,0x01,0x05,0x3f,0xff,0x83,0x04,0x83,0x40,0xb3,0x04,0x02,0x40,0x01,0x00,0x40,
+0x08,0x17,0x04,0x81,0xc0,0x01,0x05,0x00,0x00,0x07,0x04,0x83,0x00,0xb2,0x04,0xc0,
+0x01,0x99,0x02,0x00,0x00,0x07,0x04,0x00,0x00,0x07,0x00,0x40,0x04,0x97,0x04,0x81,
+0xc0,0x01,0x05,0x00,0x00,0x08,0x04,0x83,0x00,0xb2,0x04,0xc0,0x01,0x98,0x04,0x81,
+0xc0,0x01,0x05,0x00,0x00,0x05,0x04,0x83,0x00,0xb2,0x04,0xc0,0x00,0x99,0x04,0x00,
+0x00,0x08,0x04,0x40,0x01,0x19,0x01,0x81,0x40,0x01,0x00,0x40,0x01,0x97,0x04,0x81,
+0x40,0x01,0x04,0x81,0x00,0xad,0x01,0x02,0x40,0x01,0x04,0x80,0x80,0x01,0x05,0x00,
+0xc0,0x01,0x04,0x83,0x40,0xb3,0x04,0xbf,0xe3,0x98,0x04,0x80,0x80,0x01,0x05,0x00,
+0x00,0x06,0x05,0x00,0xc0,0x20,0x04,0x83,0x00,0xb2,0x04,0xc0,0x01,0x19,0x04,0x80,
+0x00,0x05,0x04,0x80,0x00,0x29,0x02,0x40,0x00,0x99,0x00,0x40,0x01,0x17,0x04,0x80,
+0x00,0x05,0x04,0x80,0x00,0x29,0x04,0x80,0x00,0x06,0x05,0x00,0x80,0x01,0x04,0x82,
+0x00,0xa0,0x04,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x0c,
+0x62,0x6c,0x6f,0x63,0x6b,0x5f,0x67,0x69,0x76,0x65,0x6e,0x3f,0x00,0x00,0x07,0x74,
+0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x07,0x62,0x73,0x65,0x61,0x72,0x63,0x68,
+0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x01,0x2b,0x00,0x00,0x01,0x2d,0x00,
+0x00,0x01,0x2f,0x00,0x00,0x08,0x74,0x72,0x75,0x6e,0x63,0x61,0x74,0x65,0x00,0x00,
+0x02,0x5b,0x5d,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x05,0x69,0x73,0x5f,
+0x61,0x3f,0x00,0x00,0x07,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x01,0x3c,0x00,0x00,0x00,0x00,0xde,0x00,0x03,0x00,0x07,0x00,0x00,
+0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0xa6,0x01,0x80,0x00,0x06,0x01,0x80,0x00,0x20,
+0x01,0xc0,0x00,0x99,0x00,0x40,0x02,0x17,0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x04,
+0x01,0x80,0x40,0xa0,0x01,0x80,0x00,0x29,0x01,0x3f,0xff,0x83,0x00,0x40,0x06,0x97,
+0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x06,0x02,0x80,0x80,0x01,0x02,0x01,0x00,0xa0,
+0x01,0x80,0xc0,0xa0,0x01,0xc0,0x02,0x19,0x01,0x80,0x00,0x06,0x02,0x00,0x80,0x01,
+0x01,0x81,0x40,0xa0,0x00,0x40,0x01,0x97,0x01,0x80,0x80,0x01,0x01,0x81,0x80,0xad,
+0x01,0x00,0xc0,0x01,0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x06,0x02,0x02,0x00,0x20,
+0x01,0x81,0xc0,0xb3,0x01,0xbf,0xf7,0x18,0x01,0x80,0x00,0x06,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x0c,0x62,0x6c,0x6f,0x63,0x6b,0x5f,
+0x67,0x69,0x76,0x65,0x6e,0x3f,0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,
+0x00,0x00,0x09,0x64,0x65,0x6c,0x65,0x74,0x65,0x5f,0x69,0x66,0x00,0x00,0x04,0x63,
+0x61,0x6c,0x6c,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x09,0x64,0x65,0x6c,0x65,0x74,
+0x65,0x5f,0x61,0x74,0x00,0x00,0x01,0x2b,0x00,0x00,0x01,0x3c,0x00,0x00,0x04,0x73,
+0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0xe8,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x00,
+0x00,0x22,0x00,0x00,0x00,0xa6,0x02,0x00,0x00,0x06,0x02,0x00,0x00,0x20,0x02,0x40,
+0x00,0x99,0x00,0x40,0x02,0x17,0x02,0x00,0x00,0x06,0x02,0x80,0x01,0x04,0x02,0x00,
+0x40,0xa0,0x02,0x00,0x00,0x29,0x01,0x3f,0xff,0x83,0x02,0x00,0x00,0x06,0x02,0x00,
+0xc0,0x20,0x01,0x81,0x00,0x01,0x00,0x40,0x06,0x97,0x02,0x00,0x40,0x01,0x02,0x80,
+0x00,0x06,0x03,0x00,0x80,0x01,0x02,0x81,0x40,0xa0,0x02,0x01,0x00,0xa0,0x02,0x40,
+0x02,0x19,0x02,0x00,0x80,0x01,0x02,0x01,0x80,0xad,0x01,0x01,0x00,0x01,0x00,0x40,
+0x01,0x97,0x02,0x00,0x00,0x06,0x02,0x80,0x80,0x01,0x02,0x01,0xc0,0xa0,0x02,0x00,
+0x80,0x01,0x02,0x80,0x00,0x06,0x02,0x80,0xc0,0x20,0x02,0x02,0x00,0xb3,0x02,0x3f,
+0xf7,0x18,0x02,0x00,0x00,0x06,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x09,0x00,0x0c,0x62,0x6c,0x6f,0x63,0x6b,0x5f,0x67,0x69,0x76,0x65,0x6e,0x3f,
+0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x07,0x6b,0x65,0x65,
+0x70,0x5f,0x69,0x66,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x04,0x63,0x61,
+0x6c,0x6c,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x01,0x2b,0x00,0x00,0x09,0x64,0x65,
+0x6c,0x65,0x74,0x65,0x5f,0x61,0x74,0x00,0x00,0x01,0x3c,0x00,0x00,0x00,0x00,0xba,
+0x00,0x03,0x00,0x06,0x00,0x01,0x00,0x00,0x00,0x19,0x00,0x00,0x00,0xa6,0x01,0x80,
+0x00,0x06,0x01,0x80,0x00,0x20,0x01,0xc0,0x00,0x99,0x00,0x40,0x02,0x17,0x01,0x80,
+0x00,0x06,0x02,0x00,0x01,0x04,0x01,0x80,0x40,0xa0,0x01,0x80,0x00,0x29,0x01,0x00,
+0xc0,0x37,0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x40,0x01,0x80,0xc0,0x21,0x01,0x80,
+0x00,0x06,0x01,0x81,0x00,0x20,0x02,0x00,0x80,0x01,0x02,0x01,0x00,0x20,0x01,0x81,
+0x40,0xb2,0x01,0xc0,0x01,0x19,0x01,0x80,0x00,0x05,0x01,0x80,0x00,0x29,0x01,0x80,
+0x00,0x06,0x02,0x00,0x80,0x01,0x01,0x81,0x80,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x0c,0x62,0x6c,0x6f,0x63,0x6b,0x5f,0x67,0x69,
+0x76,0x65,0x6e,0x3f,0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,
+0x07,0x73,0x65,0x6c,0x65,0x63,0x74,0x21,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,
+0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x07,0x72,0x65,
+0x70,0x6c,0x61,0x63,0x65,0x00,0x00,0x00,0x00,0x4e,0x00,0x03,0x00,0x06,0x00,0x00,
+0x00,0x00,0x00,0x0b,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,
+0x01,0x80,0x00,0xa0,0x01,0xc0,0x02,0x19,0x01,0x80,0x80,0x15,0x02,0x00,0x40,0x01,
+0x01,0x80,0x40,0xa0,0x00,0x40,0x00,0x97,0x01,0x80,0x00,0x05,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,
+0x02,0x3c,0x3c,0x00,0x44,0x42,0x47,0x00,0x00,0x00,0x0a,0x9b,0x00,0x01,0x00,0x32,
+0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,
+0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x61,0x72,0x72,0x61,0x79,0x2d,0x65,
+0x78,0x74,0x2f,0x6d,0x72,0x62,0x6c,0x69,0x62,0x2f,0x61,0x72,0x72,0x61,0x79,0x2e,
+0x72,0x62,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x05,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,
+0x99,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x00,0x00,0x2a,
+0x00,0x2a,0x00,0x2a,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x56,0x00,0x56,0x00,0x56,
+0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x9c,0x00,0x9c,
+0x00,0x9c,0x00,0xbf,0x00,0xbf,0x00,0xbf,0x00,0xce,0x00,0xce,0x00,0xce,0x00,0xe2,
+0x00,0xe2,0x00,0xe2,0x00,0xee,0x00,0xee,0x00,0xee,0x00,0xf0,0x00,0xf0,0x00,0xf0,
+0x01,0x17,0x01,0x17,0x01,0x17,0x01,0x7c,0x01,0x7c,0x01,0x7c,0x01,0x9b,0x01,0x9b,
+0x01,0x9b,0x01,0xaf,0x01,0xaf,0x01,0xaf,0x01,0xce,0x01,0xce,0x01,0xce,0x01,0xf0,
+0x01,0xf0,0x01,0xf0,0x02,0x03,0x02,0x03,0x02,0x03,0x02,0x55,0x02,0x55,0x02,0x55,
+0x02,0x74,0x02,0x74,0x02,0x74,0x02,0x92,0x02,0x92,0x02,0x92,0x02,0xab,0x02,0xab,
+0x02,0xab,0x02,0xab,0x02,0xab,0x00,0x00,0x00,0x89,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x2a,0x00,0x13,0x00,0x13,0x00,0x13,0x00,
+0x14,0x00,0x15,0x00,0x16,0x00,0x1b,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x19,0x00,
+0x19,0x00,0x19,0x00,0x19,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,
+0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x17,0x00,0x17,0x00,0x17,0x00,
+0x17,0x00,0x17,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x23,0x00,0x21,0x00,
+0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x20,0x00,
+0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,
+0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,
+0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,
+0x00,0x1c,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x00,0x00,0x29,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x41,0x00,0x3a,0x00,
+0x3a,0x00,0x3a,0x00,0x3b,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3e,0x00,
+0x3e,0x00,0x40,0x00,0x00,0x00,0x43,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x19,0x00,0x00,0x56,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,
+0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,
+0x00,0x4f,0x00,0x4f,0x00,0x51,0x00,0x52,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x54,
+0x00,0x54,0x00,0x54,0x00,0x55,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,
+0x53,0x00,0x53,0x00,0x53,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,
+0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x00,0x00,0x41,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x67,0x00,
+0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,
+0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x65,0x00,
+0x65,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x00,0x00,
+0x43,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x00,0x7f,
+0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,
+0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x75,
+0x00,0x76,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x78,0x00,0x78,0x00,0x78,0x00,0x7e,
+0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+0x00,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x77,0x00,
+0x00,0x00,0x2d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,
+0x00,0x78,0x00,0x79,0x00,0x79,0x00,0x79,0x00,0x79,0x00,0x7a,0x00,0x7a,0x00,0x7a,
+0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x00,0x00,0x23,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x9c,0x00,
+0x9c,0x00,0x9c,0x00,0x92,0x00,0x93,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x9b,0x00,
+0x00,0x00,0x4b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0x00,
+0x00,0x94,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,
+0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,
+0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,
+0x00,0x96,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x00,0x00,0x31,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0xbf,0x00,0xbf,0x00,
+0xbf,0x00,0xaf,0x00,0xb0,0x00,0xb1,0x00,0xb2,0x00,0xb2,0x00,0xb2,0x00,0xba,0x00,
+0xbb,0x00,0xbb,0x00,0xbb,0x00,0xbb,0x00,0xbd,0x00,0xbd,0x00,0x00,0x00,0x4f,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0xb2,0x00,0xb3,
+0x00,0xb3,0x00,0xb3,0x00,0xb3,0x00,0xb3,0x00,0xb3,0x00,0xb3,0x00,0xb3,0x00,0xb3,
+0x00,0xb3,0x00,0xb3,0x00,0xb4,0x00,0xb4,0x00,0xb4,0x00,0xb4,0x00,0xb4,0x00,0xb4,
+0x00,0xb4,0x00,0xb4,0x00,0xb4,0x00,0xb4,0x00,0xb4,0x00,0xb4,0x00,0xb5,0x00,0xb5,
+0x00,0xb5,0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,0x00,0x00,0x1d,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0xce,0x00,0xcb,0x00,
+0xcb,0x00,0xcb,0x00,0xcc,0x00,0xcd,0x00,0x00,0x00,0x31,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0xe2,0x00,0xdc,0x00,0xdc,0x00,0xdc,
+0x00,0xdc,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xde,0x00,0xde,
+0x00,0xe0,0x00,0xe0,0x00,0xe0,0x00,0xe0,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0xdc,0x00,0xdc,0x00,0xdc,0x00,
+0xdc,0x00,0xdc,0x00,0x00,0x00,0x49,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x1c,0x00,0x00,0xee,0x00,0xe6,0x00,0xe6,0x00,0xe6,0x00,0xe6,0x00,0xe6,
+0x00,0xe6,0x00,0xe6,0x00,0xe6,0x00,0xe8,0x00,0xe8,0x00,0xe8,0x00,0xe8,0x00,0xec,
+0x00,0xea,0x00,0xea,0x00,0xea,0x00,0xea,0x00,0xea,0x00,0xeb,0x00,0xeb,0x00,0xeb,
+0x00,0xe9,0x00,0xe9,0x00,0xe9,0x00,0xe9,0x00,0xed,0x00,0xed,0x00,0x00,0x00,0x9b,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x00,0x01,0x17,0x01,
+0x17,0x01,0x17,0x01,0x17,0x01,0x08,0x01,0x08,0x01,0x09,0x01,0x09,0x01,0x09,0x01,
+0x09,0x01,0x09,0x01,0x09,0x01,0x09,0x01,0x09,0x01,0x09,0x01,0x09,0x01,0x09,0x01,
+0x09,0x01,0x09,0x01,0x0b,0x01,0x0c,0x01,0x0c,0x01,0x0c,0x01,0x0c,0x01,0x0d,0x01,
+0x0d,0x01,0x0d,0x01,0x0d,0x01,0x0d,0x01,0x0f,0x01,0x0f,0x01,0x0f,0x01,0x0f,0x01,
+0x0f,0x01,0x0f,0x01,0x0f,0x01,0x0f,0x01,0x0f,0x01,0x10,0x01,0x10,0x01,0x10,0x01,
+0x10,0x01,0x10,0x01,0x11,0x01,0x11,0x01,0x11,0x01,0x11,0x01,0x12,0x01,0x12,0x01,
+0x12,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x12,0x01,
+0x12,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x12,0x01,0x14,0x01,
+0x16,0x01,0x16,0x01,0x16,0x01,0x16,0x00,0x00,0x01,0xe9,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xec,0x00,0x01,0x7c,0x01,0x7c,0x01,0x7c,0x01,0x7c,
+0x01,0x7c,0x01,0x3a,0x01,0x3a,0x01,0x3a,0x01,0x3b,0x01,0x3b,0x01,0x3b,0x01,0x3b,
+0x01,0x3b,0x01,0x3b,0x01,0x3b,0x01,0x3b,0x01,0x3b,0x01,0x3b,0x01,0x3b,0x01,0x3b,
+0x01,0x3b,0x01,0x3b,0x01,0x3b,0x01,0x3c,0x01,0x3c,0x01,0x3c,0x01,0x3c,0x01,0x3f,
+0x01,0x3f,0x01,0x3f,0x01,0x40,0x01,0x41,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,
+0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,
+0x01,0x44,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x46,0x01,0x46,0x01,0x46,
+0x01,0x46,0x01,0x46,0x01,0x46,0x01,0x46,0x01,0x46,0x01,0x48,0x01,0x48,0x01,0x48,
+0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,
+0x01,0x4a,0x01,0x4a,0x01,0x4a,0x01,0x4b,0x01,0x4b,0x01,0x4b,0x01,0x4b,0x01,0x4b,
+0x01,0x4b,0x01,0x4b,0x01,0x4b,0x01,0x4c,0x01,0x4c,0x01,0x4c,0x01,0x4c,0x01,0x4c,
+0x01,0x4c,0x01,0x4c,0x01,0x4c,0x01,0x4d,0x01,0x4d,0x01,0x4d,0x01,0x4d,0x01,0x4f,
+0x01,0x50,0x01,0x50,0x01,0x50,0x01,0x50,0x01,0x50,0x01,0x50,0x01,0x50,0x01,0x50,
+0x01,0x50,0x01,0x51,0x01,0x51,0x01,0x51,0x01,0x51,0x01,0x52,0x01,0x52,0x01,0x52,
+0x01,0x52,0x01,0x54,0x01,0x54,0x01,0x54,0x01,0x54,0x01,0x54,0x01,0x58,0x01,0x58,
+0x01,0x58,0x01,0x58,0x01,0x58,0x01,0x58,0x01,0x58,0x01,0x58,0x01,0x58,0x01,0x58,
+0x01,0x58,0x01,0x58,0x01,0x5a,0x01,0x5b,0x01,0x5b,0x01,0x5b,0x01,0x5b,0x01,0x5c,
+0x01,0x5c,0x01,0x5c,0x01,0x5c,0x01,0x5c,0x01,0x5c,0x01,0x5c,0x01,0x5c,0x01,0x5c,
+0x01,0x5c,0x01,0x5c,0x01,0x5c,0x01,0x5e,0x01,0x5e,0x01,0x5e,0x01,0x5f,0x01,0x5f,
+0x01,0x5f,0x01,0x5f,0x01,0x5f,0x01,0x5f,0x01,0x5f,0x01,0x5f,0x01,0x60,0x01,0x60,
+0x01,0x60,0x01,0x61,0x01,0x61,0x01,0x61,0x01,0x61,0x01,0x61,0x01,0x61,0x01,0x61,
+0x01,0x61,0x01,0x62,0x01,0x62,0x01,0x62,0x01,0x62,0x01,0x62,0x01,0x62,0x01,0x62,
+0x01,0x62,0x01,0x63,0x01,0x63,0x01,0x63,0x01,0x63,0x01,0x63,0x01,0x63,0x01,0x63,
+0x01,0x63,0x01,0x65,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,
+0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x67,0x01,0x67,0x01,0x67,0x01,0x67,0x01,0x68,
+0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x6a,0x01,0x6a,0x01,0x6a,0x01,0x6a,0x01,0x6f,
+0x01,0x70,0x01,0x74,0x01,0x72,0x01,0x72,0x01,0x72,0x01,0x72,0x01,0x72,0x01,0x72,
+0x01,0x72,0x01,0x73,0x01,0x73,0x01,0x73,0x01,0x71,0x01,0x71,0x01,0x71,0x01,0x71,
+0x01,0x71,0x01,0x79,0x01,0x77,0x01,0x77,0x01,0x77,0x01,0x77,0x01,0x77,0x01,0x78,
+0x01,0x78,0x01,0x78,0x01,0x76,0x01,0x76,0x01,0x76,0x01,0x76,0x01,0x7b,0x01,0x7b,
+0x00,0x00,0x00,0x4f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,
+0x00,0x01,0x9b,0x01,0x9b,0x01,0x9b,0x01,0x8e,0x01,0x8f,0x01,0x90,0x01,0x90,0x01,
+0x90,0x01,0x92,0x01,0x92,0x01,0x92,0x01,0x93,0x01,0x93,0x01,0x93,0x01,0x93,0x01,
+0x93,0x01,0x93,0x01,0x93,0x01,0x93,0x01,0x93,0x01,0x93,0x01,0x93,0x01,0x93,0x01,
+0x93,0x01,0x93,0x01,0x93,0x01,0x93,0x01,0x94,0x01,0x94,0x01,0x94,0x01,0x9a,0x00,
+0x00,0x00,0x35,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,
+0x01,0x95,0x01,0x95,0x01,0x95,0x01,0x95,0x01,0x95,0x01,0x96,0x01,0x96,0x01,0x96,
+0x01,0x97,0x01,0x97,0x01,0x97,0x01,0x97,0x01,0x97,0x01,0x97,0x01,0x97,0x01,0x97,
+0x01,0x97,0x01,0x97,0x00,0x00,0x00,0x25,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x0a,0x00,0x01,0xaf,0x01,0xaf,0x01,0xaf,0x01,0xad,0x01,0xae,0x01,
+0xae,0x01,0xae,0x01,0xae,0x01,0xae,0x01,0xae,0x00,0x00,0x00,0x4f,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x01,0xce,0x01,0xc3,0x01,0xc3,
+0x01,0xc3,0x01,0xc3,0x01,0xc3,0x01,0xc3,0x01,0xc3,0x01,0xc3,0x01,0xc5,0x01,0xcc,
+0x01,0xc7,0x01,0xc7,0x01,0xc7,0x01,0xc7,0x01,0xc7,0x01,0xc7,0x01,0xc8,0x01,0xc8,
+0x01,0xc8,0x01,0xc8,0x01,0xca,0x01,0xca,0x01,0xca,0x01,0xc6,0x01,0xc6,0x01,0xc6,
+0x01,0xc6,0x01,0xc6,0x01,0xcd,0x01,0xcd,0x00,0x00,0x00,0x63,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x01,0xf0,0x01,0xe0,0x01,0xe0,0x01,
+0xe0,0x01,0xe0,0x01,0xe0,0x01,0xe0,0x01,0xe0,0x01,0xe0,0x01,0xe2,0x01,0xe2,0x01,
+0xe2,0x01,0xe3,0x01,0xea,0x01,0xe5,0x01,0xe5,0x01,0xe5,0x01,0xe5,0x01,0xe5,0x01,
+0xe5,0x01,0xe6,0x01,0xe6,0x01,0xe6,0x01,0xe6,0x01,0xe8,0x01,0xe8,0x01,0xe8,0x01,
+0xe4,0x01,0xe4,0x01,0xe4,0x01,0xe4,0x01,0xe4,0x01,0xeb,0x01,0xeb,0x01,0xeb,0x01,
+0xeb,0x01,0xeb,0x01,0xec,0x01,0xec,0x01,0xee,0x01,0xee,0x00,0x00,0x00,0x37,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x02,0x03,0x02,0x00,
+0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+0x02,0x00,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x02,
+0x02,0x02,0x00,0x00,0x00,0xbf,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x57,0x00,0x02,0x55,0x02,0x3a,0x02,0x3a,0x02,0x3a,0x02,0x3a,0x02,0x3a,0x02,
+0x3a,0x02,0x3a,0x02,0x3a,0x02,0x3c,0x02,0x3d,0x02,0x3d,0x02,0x3d,0x02,0x3e,0x02,
+0x51,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,0x40,0x02,
+0x40,0x02,0x40,0x02,0x41,0x02,0x41,0x02,0x41,0x02,0x41,0x02,0x42,0x02,0x42,0x02,
+0x42,0x02,0x42,0x02,0x43,0x02,0x43,0x02,0x43,0x02,0x44,0x02,0x44,0x02,0x44,0x02,
+0x44,0x02,0x44,0x02,0x44,0x02,0x45,0x02,0x45,0x02,0x45,0x02,0x45,0x02,0x45,0x02,
+0x46,0x02,0x46,0x02,0x46,0x02,0x46,0x02,0x47,0x02,0x48,0x02,0x48,0x02,0x49,0x02,
+0x49,0x02,0x49,0x02,0x49,0x02,0x49,0x02,0x49,0x02,0x49,0x02,0x49,0x02,0x4a,0x02,
+0x4c,0x02,0x4d,0x02,0x4d,0x02,0x4f,0x02,0x4f,0x02,0x4f,0x02,0x3f,0x02,0x3f,0x02,
+0x3f,0x02,0x3f,0x02,0x52,0x02,0x52,0x02,0x52,0x02,0x52,0x02,0x52,0x02,0x52,0x02,
+0x52,0x02,0x53,0x02,0x53,0x02,0x53,0x02,0x53,0x02,0x54,0x02,0x54,0x02,0x54,0x02,
+0x54,0x00,0x00,0x00,0x4f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x1f,0x00,0x02,0x74,0x02,0x69,0x02,0x69,0x02,0x69,0x02,0x69,0x02,0x69,0x02,0x69,
+0x02,0x69,0x02,0x69,0x02,0x6b,0x02,0x72,0x02,0x6d,0x02,0x6d,0x02,0x6d,0x02,0x6d,
+0x02,0x6d,0x02,0x6d,0x02,0x6e,0x02,0x6e,0x02,0x6e,0x02,0x6e,0x02,0x70,0x02,0x70,
+0x02,0x70,0x02,0x6c,0x02,0x6c,0x02,0x6c,0x02,0x6c,0x02,0x6c,0x02,0x73,0x02,0x73,
+0x00,0x00,0x00,0x55,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,
+0x00,0x02,0x92,0x02,0x86,0x02,0x86,0x02,0x86,0x02,0x86,0x02,0x86,0x02,0x86,0x02,
+0x86,0x02,0x86,0x02,0x88,0x02,0x89,0x02,0x89,0x02,0x89,0x02,0x90,0x02,0x8b,0x02,
+0x8b,0x02,0x8b,0x02,0x8b,0x02,0x8b,0x02,0x8b,0x02,0x8c,0x02,0x8c,0x02,0x8c,0x02,
+0x8c,0x02,0x8e,0x02,0x8e,0x02,0x8e,0x02,0x8a,0x02,0x8a,0x02,0x8a,0x02,0x8a,0x02,
+0x8a,0x02,0x91,0x02,0x91,0x00,0x00,0x00,0x43,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x19,0x00,0x02,0xab,0x02,0xa3,0x02,0xa3,0x02,0xa3,0x02,0xa3,
+0x02,0xa3,0x02,0xa3,0x02,0xa3,0x02,0xa3,0x02,0xa5,0x02,0xa6,0x02,0xa6,0x02,0xa6,
+0x02,0xa9,0x02,0xa9,0x02,0xa9,0x02,0xa9,0x02,0xa9,0x02,0xa9,0x02,0xa9,0x02,0xa9,
+0x02,0xaa,0x02,0xaa,0x02,0xaa,0x02,0xaa,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x02,0xa6,0x02,0xa7,0x02,0xa7,0x02,
+0xa7,0x02,0xa7,0x02,0xa7,0x02,0xa7,0x02,0xa7,0x02,0xa7,0x02,0xa7,0x02,0xa7,0x45,
+0x4e,0x44,0x00,0x00,0x00,0x00,0x08,
+};
+void mrb_mruby_array_ext_gem_init(mrb_state *mrb);
+void mrb_mruby_array_ext_gem_final(mrb_state *mrb);
+
+void GENERATED_TMP_mrb_mruby_array_ext_gem_init(mrb_state *mrb) {
+  int ai = mrb_gc_arena_save(mrb);
+  mrb_mruby_array_ext_gem_init(mrb);
+  mrb_load_irep(mrb, gem_mrblib_irep_mruby_array_ext);
+  if (mrb->exc) {
+    mrb_print_error(mrb);
+    exit(EXIT_FAILURE);
+  }
+  mrb_gc_arena_restore(mrb, ai);
+}
+
+void GENERATED_TMP_mrb_mruby_array_ext_gem_final(mrb_state *mrb) {
+  mrb_mruby_array_ext_gem_final(mrb);
+}
@@ -0,0 +1,185 @@
+/*
+ * This file is loading the irep
+ * Ruby GEM code.
+ *
+ * IMPORTANT:
+ *   This file was generated!
+ *   All manual changes will get lost.
+ */
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/irep.h"
+#include <stdint.h>
+const uint8_t gem_mrblib_irep_mruby_hash_ext[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x32,0x94,0xbe,0x00,0x00,0x09,0x99,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x06,0x96,0x30,0x30,
+0x30,0x30,0x00,0x00,0x00,0x31,0x00,0x01,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x05,
+0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0x45,
+0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x48,0x61,
+0x73,0x68,0x00,0x00,0x00,0x01,0x05,0x00,0x01,0x00,0x04,0x00,0x07,0x00,0x00,0x00,
+0x21,0x00,0x80,0x00,0x48,0x01,0x00,0x00,0x04,0x01,0x80,0x00,0x84,0x02,0x00,0x00,
+0x05,0x00,0x80,0x81,0x20,0x00,0x80,0x00,0x48,0x01,0x00,0x00,0xc0,0x00,0x80,0xc0,
+0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0x04,0x01,0x80,0x01,0x84,0x02,0x00,0x00,
+0x05,0x00,0x80,0x81,0x20,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x81,0x40,
+0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x04,0xc0,0x00,0x81,0x80,0x46,0x00,0x80,0x00,
+0x48,0x01,0x00,0x06,0xc0,0x00,0x81,0xc0,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x08,
+0xc0,0x00,0x82,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x0a,0xc0,0x00,0x82,0x40,
+0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x0c,0xc0,0x00,0x82,0x80,0x46,0x00,0x80,0x05,
+0x04,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x09,0x65,
+0x61,0x63,0x68,0x5f,0x70,0x61,0x69,0x72,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,
+0x00,0x0c,0x61,0x6c,0x69,0x61,0x73,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,
+0x06,0x6d,0x65,0x72,0x67,0x65,0x21,0x00,0x00,0x06,0x75,0x70,0x64,0x61,0x74,0x65,
+0x00,0x00,0x05,0x66,0x65,0x74,0x63,0x68,0x00,0x00,0x09,0x64,0x65,0x6c,0x65,0x74,
+0x65,0x5f,0x69,0x66,0x00,0x00,0x07,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x00,0x00,
+0x06,0x69,0x6e,0x76,0x65,0x72,0x74,0x00,0x00,0x07,0x6b,0x65,0x65,0x70,0x5f,0x69,
+0x66,0x00,0x00,0x03,0x6b,0x65,0x79,0x00,0x00,0x00,0x00,0xc0,0x00,0x03,0x00,0x07,
+0x00,0x02,0x00,0x00,0x00,0x14,0x02,0x00,0x00,0xa6,0x01,0x80,0x40,0x01,0x02,0x00,
+0x00,0x84,0x01,0x80,0x00,0xa0,0x01,0xc0,0x00,0x99,0x00,0x40,0x02,0x17,0x01,0x80,
+0x00,0x06,0x02,0x00,0x01,0x91,0x02,0x80,0x00,0x3d,0x01,0x80,0x81,0x20,0x01,0x40,
+0x02,0x19,0x01,0x80,0x40,0x01,0x02,0x00,0x01,0x40,0x01,0x81,0x00,0x21,0x00,0x40,
+0x01,0x97,0x01,0x80,0x40,0x01,0x02,0x00,0x03,0x40,0x01,0x81,0x00,0x21,0x01,0x80,
+0x00,0x06,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x20,0x63,0x61,0x6e,
+0x27,0x74,0x20,0x63,0x6f,0x6e,0x76,0x65,0x72,0x74,0x20,0x61,0x72,0x67,0x75,0x6d,
+0x65,0x6e,0x74,0x20,0x69,0x6e,0x74,0x6f,0x20,0x48,0x61,0x73,0x68,0x00,0x00,0x00,
+0x05,0x00,0x0b,0x72,0x65,0x73,0x70,0x6f,0x6e,0x64,0x5f,0x74,0x6f,0x3f,0x00,0x00,
+0x07,0x74,0x6f,0x5f,0x68,0x61,0x73,0x68,0x00,0x00,0x05,0x72,0x61,0x69,0x73,0x65,
+0x00,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x08,0x65,
+0x61,0x63,0x68,0x5f,0x6b,0x65,0x79,0x00,0x00,0x00,0x00,0x8f,0x00,0x03,0x00,0x09,
+0x00,0x00,0x00,0x00,0x00,0x17,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x06,0x02,0x00,
+0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0xc0,0x05,0x19,0x01,0x80,0x80,0x15,0x02,0x00,
+0x40,0x01,0x02,0x80,0x00,0x06,0x03,0x00,0x40,0x01,0x02,0x80,0x80,0xa0,0x03,0x00,
+0x40,0x15,0x03,0x80,0x40,0x01,0x03,0x00,0x80,0xa0,0x01,0x80,0x41,0xa0,0x00,0x40,
+0x01,0x97,0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x80,0xa0,0x02,0x00,
+0x00,0x06,0x02,0x80,0x40,0x01,0x03,0x00,0xc0,0x01,0x02,0x00,0xc1,0x20,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x08,0x68,0x61,0x73,0x5f,
+0x6b,0x65,0x79,0x3f,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x02,0x5b,0x5d,
+0x00,0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,0x00,0x00,0x45,0x00,0x03,0x00,0x08,0x00,
+0x00,0x00,0x00,0x00,0x09,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,
+0x01,0x01,0x80,0x00,0xa0,0x02,0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x03,0x00,0xc0,
+0x01,0x02,0x00,0x41,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x02,0x5b,0x5d,0x00,0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,0x00,0x00,0xd5,
+0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x1d,0x02,0x10,0x00,0xa6,0x00,0x40,
+0x00,0x97,0x00,0x40,0x00,0x97,0x01,0x00,0x00,0x11,0x02,0x00,0x00,0x06,0x02,0x80,
+0x40,0x01,0x02,0x00,0x40,0xa0,0x02,0x40,0x02,0x19,0x02,0x00,0x00,0x06,0x02,0x80,
+0x40,0x01,0x02,0x00,0x80,0xa0,0x00,0x40,0x08,0x17,0x01,0xc0,0x01,0x99,0x02,0x00,
+0xc0,0x01,0x02,0x00,0xc0,0x20,0x00,0x40,0x06,0x17,0x02,0x00,0x80,0x01,0x02,0x80,
+0x00,0x11,0x02,0x01,0x00,0xa0,0x02,0x40,0x01,0x19,0x02,0x00,0x80,0x01,0x00,0x40,
+0x03,0x17,0x02,0x00,0x00,0x06,0x02,0x80,0x03,0x11,0x03,0x00,0x00,0x3d,0x03,0x80,
+0x40,0x01,0x03,0x01,0xc0,0x3e,0x02,0x01,0x41,0x20,0x02,0x00,0x00,0x29,0x00,0x00,
+0x00,0x02,0x00,0x00,0x0f,0x4b,0x65,0x79,0x20,0x6e,0x6f,0x74,0x20,0x66,0x6f,0x75,
+0x6e,0x64,0x3a,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x04,0x4e,0x4f,0x4e,
+0x45,0x00,0x00,0x04,0x6b,0x65,0x79,0x3f,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x04,
+0x63,0x61,0x6c,0x6c,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,0x05,0x72,0x61,0x69,0x73,
+0x65,0x00,0x00,0x0c,0x52,0x75,0x6e,0x74,0x69,0x6d,0x65,0x45,0x72,0x72,0x6f,0x72,
+0x00,0x00,0x00,0x00,0x7a,0x00,0x02,0x00,0x05,0x00,0x01,0x00,0x00,0x00,0x0e,0x00,
+0x00,0x00,0xa6,0x01,0x00,0x00,0x06,0x01,0x00,0x00,0x20,0x01,0x40,0x00,0x99,0x00,
+0x40,0x02,0x17,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x04,0x01,0x00,0x40,0xa0,0x01,
+0x00,0x00,0x29,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x40,0x01,0x00,0xc0,0x21,0x01,
+0x00,0x00,0x06,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+0x0c,0x62,0x6c,0x6f,0x63,0x6b,0x5f,0x67,0x69,0x76,0x65,0x6e,0x3f,0x00,0x00,0x07,
+0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x09,0x64,0x65,0x6c,0x65,0x74,0x65,
+0x5f,0x69,0x66,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x56,0x00,
+0x04,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x0c,0x04,0x00,0x00,0x26,0x02,0x00,0x40,
+0x15,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x02,0x00,0x01,0x20,0x02,0x40,0x02,
+0x19,0x02,0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x02,0x00,0x40,0xa0,0x00,0x40,0x00,
+0x97,0x02,0x00,0x00,0x05,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x06,0x64,0x65,0x6c,0x65,0x74,0x65,
+0x00,0x00,0x00,0x00,0x4b,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x09,0x00,
+0x10,0x00,0x26,0x00,0x40,0x00,0x97,0x00,0x40,0x00,0x97,0x00,0xc0,0x00,0x03,0x01,
+0x80,0x00,0x06,0x01,0x80,0x00,0x20,0x02,0x00,0x40,0x01,0x01,0x80,0x40,0xa0,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x74,0x6f,0x5f,
+0x61,0x00,0x00,0x07,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x00,0x00,0x00,0x00,0x4a,
+0x00,0x03,0x00,0x05,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x26,0x01,0x80,
+0x00,0x11,0x01,0x80,0x40,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x00,
+0x01,0x40,0x01,0x80,0x80,0x21,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x03,0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x38,0x00,0x04,0x00,0x09,0x00,0x00,
+0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,0x80,0x80,0x15,
+0x03,0x00,0x80,0x01,0x03,0x81,0x00,0x01,0x02,0x80,0x01,0x20,0x02,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,0x00,
+0x00,0x7c,0x00,0x03,0x00,0x06,0x00,0x01,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0xa6,
+0x01,0x80,0x00,0x06,0x01,0x80,0x00,0x20,0x01,0xc0,0x00,0x99,0x00,0x40,0x02,0x17,
+0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x04,0x01,0x80,0x40,0xa0,0x01,0x80,0x00,0x29,
+0x01,0x00,0xc0,0x37,0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x40,0x01,0x80,0xc0,0x21,
+0x01,0x80,0x00,0x06,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x0c,0x62,0x6c,0x6f,0x63,0x6b,0x5f,0x67,0x69,0x76,0x65,0x6e,0x3f,0x00,0x00,
+0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x07,0x6b,0x65,0x65,0x70,0x5f,
+0x69,0x66,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x5a,0x00,0x04,
+0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x15,
+0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x02,0x81,0x41,0x37,0x02,0x00,0x00,0xa0,
+0x02,0x40,0x01,0x19,0x02,0x00,0x00,0x05,0x00,0x40,0x01,0x97,0x02,0x00,0x00,0x06,
+0x02,0x80,0x40,0x01,0x02,0x00,0x40,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x06,0x64,0x65,0x6c,
+0x65,0x74,0x65,0x00,0x00,0x00,0x00,0x35,0x00,0x03,0x00,0x05,0x00,0x01,0x00,0x00,
+0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x40,0x01,0x80,
+0x00,0x21,0x01,0x80,0x00,0x05,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x43,0x00,0x04,0x00,
+0x07,0x00,0x00,0x00,0x00,0x00,0x0a,0x04,0x00,0x00,0x26,0x02,0x00,0x80,0x01,0x02,
+0x80,0x40,0x15,0x02,0x00,0x00,0xb2,0x02,0x40,0x01,0x99,0x02,0x00,0x40,0x01,0x02,
+0x00,0x80,0x29,0x00,0x40,0x00,0x97,0x02,0x00,0x00,0x05,0x02,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3d,0x3d,0x00,0x44,0x42,0x47,0x00,
+0x00,0x00,0x02,0xe5,0x00,0x01,0x00,0x30,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,
+0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,
+0x2d,0x68,0x61,0x73,0x68,0x2d,0x65,0x78,0x74,0x2f,0x6d,0x72,0x62,0x6c,0x69,0x62,
+0x2f,0x68,0x61,0x73,0x68,0x2e,0x72,0x62,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x00,0x01,0x00,0x00,0x00,0x53,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x21,0x00,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x25,
+0x00,0x25,0x00,0x25,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x51,
+0x00,0x51,0x00,0x51,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x7c,0x00,0x7c,0x00,0x7c,
+0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0xa4,0x00,0xa4,0x00,0xa4,0x00,0xb8,0x00,0xb8,
+0x00,0xb8,0x00,0xb8,0x00,0xb8,0x00,0x00,0x00,0x39,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x25,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,
+0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1d,0x00,0x1e,0x00,
+0x1e,0x00,0x1e,0x00,0x1e,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x24,0x00,0x24,0x00,
+0x00,0x00,0x3f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x00,
+0x00,0x1e,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,
+0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,
+0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x00,
+0x00,0x23,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,
+0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
+0x22,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x1d,0x00,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x45,0x00,0x46,0x00,0x46,0x00,0x46,
+0x00,0x46,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x47,0x00,0x48,0x00,0x48,
+0x00,0x48,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x4a,0x00,0x4a,0x00,0x4c,
+0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x00,0x00,0x2d,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x68,0x00,
+0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
+0x64,0x00,0x64,0x00,0x64,0x00,0x67,0x00,0x67,0x00,0x00,0x00,0x29,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x64,0x00,0x65,0x00,0x65,
+0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,
+0x00,0x65,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x09,0x00,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7a,0x00,0x7b,0x00,0x7b,0x00,
+0x7b,0x00,0x7b,0x00,0x7b,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x8d,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8b,
+0x00,0x8b,0x00,0x8b,0x00,0x8c,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,
+0x8b,0x00,0x8b,0x00,0x8b,0x00,0x00,0x00,0x2f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0xa4,0x00,0x9b,0x00,0x9b,0x00,0x9b,0x00,0x9b,
+0x00,0x9b,0x00,0x9b,0x00,0x9b,0x00,0x9b,0x00,0x9d,0x00,0x9e,0x00,0x9e,0x00,0x9e,
+0x00,0xa3,0x00,0xa3,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x0d,0x00,0x00,0x9e,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,
+0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0xa0,0x00,0xa0,0x00,0xa0,0x00,0xa0,0x00,
+0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,
+0x00,0xb8,0x00,0xb4,0x00,0xb4,0x00,0xb4,0x00,0xb7,0x00,0xb7,0x00,0x00,0x00,0x25,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0xb4,0x00,
+0xb5,0x00,0xb5,0x00,0xb5,0x00,0xb5,0x00,0xb5,0x00,0xb5,0x00,0xb5,0x00,0xb5,0x00,
+0xb5,0x45,0x4e,0x44,0x00,0x00,0x00,0x00,0x08,
+};
+void mrb_mruby_hash_ext_gem_init(mrb_state *mrb);
+void mrb_mruby_hash_ext_gem_final(mrb_state *mrb);
+
+void GENERATED_TMP_mrb_mruby_hash_ext_gem_init(mrb_state *mrb) {
+  int ai = mrb_gc_arena_save(mrb);
+  mrb_mruby_hash_ext_gem_init(mrb);
+  mrb_load_irep(mrb, gem_mrblib_irep_mruby_hash_ext);
+  if (mrb->exc) {
+    mrb_print_error(mrb);
+    exit(EXIT_FAILURE);
+  }
+  mrb_gc_arena_restore(mrb, ai);
+}
+
+void GENERATED_TMP_mrb_mruby_hash_ext_gem_final(mrb_state *mrb) {
+  mrb_mruby_hash_ext_gem_final(mrb);
+}
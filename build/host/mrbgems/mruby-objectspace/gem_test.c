@@ -0,0 +1,1030 @@
+/*
+ * This file is loading the irep
+ * Ruby GEM code.
+ *
+ * IMPORTANT:
+ *   This file was generated!
+ *   All manual changes will get lost.
+ */
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/array.h"
+#include "mruby/irep.h"
+#include "mruby/string.h"
+#include "mruby/variable.h"
+/*
+ * This file contains a test code for mruby-objectspace gem.
+ *
+ * IMPORTANT:
+ *   This file was generated!
+ *   All manual changes will get lost.
+ */
+extern const uint8_t mrbtest_assert_irep[];
+#include <stdint.h>
+const uint8_t gem_test_irep_mruby_objectspace_0[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x32,0x5a,0xfb,0x00,0x00,0x10,0x2c,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x0b,0x97,0x30,0x30,
+0x30,0x30,0x00,0x00,0x01,0x13,0x00,0x01,0x00,0x04,0x00,0x05,0x00,0x00,0x00,0x15,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x01,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0xbd,0x01,0x80,0x03,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x3d,0x01,0x80,0x05,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x01,0xbd,0x01,0x80,0x07,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x02,0x3d,0x01,0x80,0x09,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x05,0x00,0x00,0x19,0x4f,0x62,0x6a,0x65,0x63,
+0x74,0x53,0x70,0x61,0x63,0x65,0x2e,0x63,0x6f,0x75,0x6e,0x74,0x5f,0x6f,0x62,0x6a,
+0x65,0x63,0x74,0x73,0x00,0x00,0x17,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,
+0x63,0x65,0x2e,0x65,0x61,0x63,0x68,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,
+0x31,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x2e,0x63,0x6f,0x75,
+0x6e,0x74,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x73,0x20,0x61,0x67,0x72,0x65,0x65,
+0x73,0x20,0x77,0x69,0x74,0x68,0x20,0x61,0x20,0x68,0x65,0x61,0x70,0x20,0x77,0x61,
+0x6c,0x6b,0x00,0x00,0x16,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,
+0x2e,0x6d,0x65,0x6d,0x73,0x69,0x7a,0x65,0x5f,0x6f,0x66,0x00,0x00,0x1a,0x4f,0x62,
+0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x2e,0x6d,0x65,0x6d,0x73,0x69,0x7a,
+0x65,0x5f,0x6f,0x66,0x5f,0x61,0x6c,0x6c,0x00,0x00,0x00,0x01,0x00,0x06,0x61,0x73,
+0x73,0x65,0x72,0x74,0x00,0x00,0x00,0x03,0x3e,0x00,0x07,0x00,0x0c,0x00,0x07,0x00,
+0x00,0x00,0x83,0x00,0x81,0xc0,0x3f,0x03,0x80,0x00,0x11,0x04,0x00,0x01,0x04,0x03,
+0x80,0x40,0xa0,0x03,0xc0,0x02,0x19,0x03,0x80,0x01,0x11,0x04,0x00,0x01,0x40,0x03,
+0x80,0xc0,0x21,0x01,0x01,0xc0,0x01,0x03,0x80,0x02,0x11,0x04,0x00,0x40,0x01,0x03,
+0x81,0x40,0xa0,0x03,0x80,0x00,0x06,0x04,0x00,0x03,0x91,0x04,0x80,0x40,0x01,0x03,
+0x81,0x81,0x20,0x03,0x80,0x00,0x06,0x04,0x00,0x40,0x01,0x04,0x02,0x40,0x20,0x04,
+0x80,0x03,0x40,0x04,0x02,0x80,0x21,0x03,0x82,0x00,0xa0,0x03,0x80,0x00,0x06,0x04,
+0x00,0x40,0x01,0x04,0x02,0xc0,0x20,0x04,0x80,0x05,0x40,0x04,0x02,0x80,0x21,0x03,
+0x82,0x00,0xa0,0x03,0x80,0x00,0x06,0x04,0x00,0x40,0x01,0x04,0x80,0x06,0x84,0x04,
+0x03,0x00,0xa0,0x03,0x82,0x00,0xa0,0x03,0x80,0x00,0x06,0x04,0x00,0x40,0x01,0x04,
+0x80,0x07,0x04,0x04,0x03,0x00,0xa0,0x03,0x82,0x00,0xa0,0x03,0x80,0x00,0x11,0x04,
+0x00,0x01,0x04,0x03,0x80,0x40,0xa0,0x03,0xc0,0x02,0x99,0x03,0x80,0x00,0x06,0x04,
+0x00,0x40,0x01,0x04,0x80,0x07,0x84,0x04,0x03,0x00,0xa0,0x03,0x82,0x00,0xa0,0x03,
+0x80,0x00,0x06,0x04,0x00,0x40,0x01,0x04,0x80,0x06,0x84,0x04,0x04,0x40,0xa0,0x04,
+0xc0,0x00,0x83,0x04,0x04,0x80,0xb0,0x04,0x80,0x40,0x01,0x04,0x82,0xc0,0x20,0x05,
+0x00,0x0a,0x04,0x04,0x84,0xc0,0xa0,0x03,0x84,0x01,0x20,0x03,0x80,0x02,0x11,0x03,
+0x81,0x40,0x20,0x00,0x81,0xc0,0x01,0x03,0x80,0x00,0x06,0x04,0x00,0x03,0x91,0x04,
+0x80,0x40,0x01,0x03,0x81,0x81,0x20,0x03,0x80,0x00,0x06,0x04,0x00,0x40,0x01,0x04,
+0x02,0x40,0x20,0x04,0x80,0x07,0x40,0x04,0x02,0x80,0x21,0x03,0x82,0x00,0xa0,0x03,
+0x80,0x00,0x06,0x04,0x00,0x40,0x01,0x04,0x02,0xc0,0x20,0x04,0x80,0x09,0x40,0x04,
+0x02,0x80,0x21,0x03,0x82,0x00,0xa0,0x03,0x80,0x00,0x06,0x04,0x00,0x0b,0x11,0x04,
+0x80,0x0b,0x40,0x03,0x85,0x40,0xa1,0x03,0x80,0x0b,0x84,0x04,0x41,0xf3,0x83,0x01,
+0x81,0xc0,0xbf,0x03,0x80,0x02,0x11,0x04,0x00,0xc0,0x01,0x03,0x81,0x40,0xa0,0x00,
+0x81,0xc0,0x01,0x03,0x80,0x00,0x06,0x04,0x00,0xc0,0x01,0x04,0x80,0x0b,0x84,0x04,
+0x03,0x00,0xa0,0x03,0x86,0x00,0xa0,0x03,0x80,0x0c,0x91,0x03,0x86,0x80,0x20,0x02,
+0x01,0xc0,0x3f,0x03,0x80,0x02,0x11,0x03,0x81,0x40,0x20,0x02,0x81,0xc0,0x01,0x03,
+0x01,0xc0,0x37,0x03,0xc1,0xf3,0x83,0x04,0x00,0x0d,0x40,0x03,0x86,0xc0,0x21,0x03,
+0x00,0x00,0x05,0x03,0x80,0x02,0x11,0x04,0x00,0x40,0x01,0x03,0x81,0x40,0xa0,0x03,
+0x80,0x0c,0x91,0x03,0x86,0x80,0x20,0x03,0x80,0x02,0x11,0x04,0x01,0x00,0x01,0x03,
+0x81,0x40,0xa0,0x03,0x80,0x00,0x06,0x04,0x00,0x40,0x01,0x04,0x80,0x0e,0x04,0x04,
+0x04,0x40,0xa0,0x04,0x81,0x40,0x01,0x05,0x00,0x0e,0x04,0x04,0x84,0x40,0xa0,0x05,
+0x41,0xf3,0x83,0x04,0x85,0x00,0xac,0x03,0x84,0x01,0x20,0x03,0x80,0x00,0x06,0x04,
+0x01,0x00,0x01,0x04,0x80,0x0e,0x04,0x04,0x04,0x40,0xa0,0x04,0x81,0x40,0x01,0x05,
+0x00,0x0e,0x04,0x04,0x84,0x40,0xa0,0x03,0x84,0x01,0x20,0x03,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,
+0x00,0x0e,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x3f,
+0x00,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x0b,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x00,0x00,0x0d,0x63,
+0x6f,0x75,0x6e,0x74,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x73,0x00,0x00,0x0e,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x6b,0x69,0x6e,0x64,0x5f,0x6f,0x66,0x00,0x00,0x04,
+0x48,0x61,0x73,0x68,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,
+0x75,0x65,0x00,0x00,0x04,0x6b,0x65,0x79,0x73,0x00,0x00,0x04,0x61,0x6c,0x6c,0x3f,
+0x00,0x00,0x06,0x76,0x61,0x6c,0x75,0x65,0x73,0x00,0x00,0x08,0x68,0x61,0x73,0x5f,
+0x6b,0x65,0x79,0x3f,0x00,0x00,0x05,0x54,0x4f,0x54,0x41,0x4c,0x00,0x00,0x04,0x46,
+0x52,0x45,0x45,0x00,0x00,0x07,0x54,0x5f,0x46,0x49,0x42,0x45,0x52,0x00,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x02,0x5b,
+0x5d,0x00,0x00,0x01,0x2a,0x00,0x00,0x06,0x72,0x65,0x64,0x75,0x63,0x65,0x00,0x00,
+0x01,0x2b,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,
+0x65,0x00,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x05,
+0x54,0x5f,0x46,0x4f,0x4f,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x66,
+0x61,0x6c,0x73,0x65,0x00,0x00,0x02,0x47,0x43,0x00,0x00,0x05,0x73,0x74,0x61,0x72,
+0x74,0x00,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x06,0x54,0x5f,0x48,0x41,
+0x53,0x48,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x55,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x09,0x02,
+0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x91,0x01,0x80,0x00,0xa0,0x01,
+0xc0,0x01,0x98,0x01,0x80,0x40,0x01,0x02,0x00,0x01,0x11,0x01,0x80,0x00,0xa0,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x05,0x69,0x73,0x5f,
+0x61,0x3f,0x00,0x00,0x06,0x53,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x07,0x49,0x6e,
+0x74,0x65,0x67,0x65,0x72,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,0x00,0x06,0x00,0x00,
+0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x91,
+0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x05,0x69,0x73,0x5f,0x61,0x3f,0x00,0x00,0x07,0x49,0x6e,0x74,0x65,0x67,0x65,
+0x72,0x00,0x00,0x00,0x00,0x55,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x09,
+0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x91,0x01,0x80,0x00,0xa0,
+0x01,0xc0,0x01,0x98,0x01,0x80,0x40,0x01,0x02,0x00,0x01,0x11,0x01,0x80,0x00,0xa0,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x05,0x69,0x73,
+0x5f,0x61,0x3f,0x00,0x00,0x06,0x53,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x07,0x49,
+0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,0x00,0x06,0x00,
+0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x00,
+0x91,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x05,0x69,0x73,0x5f,0x61,0x3f,0x00,0x00,0x07,0x49,0x6e,0x74,0x65,0x67,
+0x65,0x72,0x00,0x00,0x00,0x00,0x44,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+0x04,0x00,0x80,0x00,0x11,0x01,0x40,0x00,0x03,0x00,0x80,0x40,0xa0,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0b,0x4f,0x62,0x6a,0x65,0x63,
+0x74,0x53,0x70,0x61,0x63,0x65,0x00,0x00,0x0d,0x63,0x6f,0x75,0x6e,0x74,0x5f,0x6f,
+0x62,0x6a,0x65,0x63,0x74,0x73,0x00,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x04,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x81,0x80,0x15,0x01,0x00,0x80,0x3f,0x00,0x80,0x00,
+0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,
+0x3c,0x00,0x00,0x00,0x00,0xd8,0x00,0x05,0x00,0x09,0x00,0x02,0x00,0x00,0x00,0x1d,
+0x00,0x81,0x40,0x37,0x02,0x80,0x00,0x11,0x03,0x00,0x01,0x40,0x02,0x80,0x40,0x21,
+0x01,0x01,0x40,0x01,0x02,0x80,0x00,0x06,0x03,0x00,0x40,0x01,0x03,0x00,0xc0,0x20,
+0x03,0x80,0x80,0x01,0x02,0x80,0x81,0x20,0x01,0x81,0x40,0x37,0x02,0x80,0x00,0x11,
+0x03,0x00,0x02,0x11,0x03,0x80,0x03,0x40,0x02,0x80,0x40,0xa1,0x02,0x01,0x40,0x01,
+0x02,0x80,0x00,0x06,0x03,0x00,0xc0,0x01,0x03,0x00,0xc0,0x20,0x03,0x81,0x00,0x01,
+0x02,0x80,0x81,0x20,0x02,0x80,0x00,0x06,0x03,0x00,0xc0,0x01,0x03,0x00,0xc0,0x20,
+0x03,0x80,0x40,0x01,0x03,0x80,0xc0,0x20,0x03,0x01,0x80,0xb3,0x02,0x81,0x40,0xa0,
+0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x0b,0x4f,0x62,
+0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x00,0x00,0x0b,0x65,0x61,0x63,0x68,
+0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x06,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,
+0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x01,0x3c,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,
+0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,
+0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,
+0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0xc0,0x15,0x02,
+0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0xb9,0x00,0x03,0x00,0x08,
+0x00,0x01,0x00,0x00,0x00,0x11,0x01,0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x01,0x80,
+0x01,0x11,0x02,0x00,0x02,0x11,0x02,0x80,0x01,0x40,0x01,0x80,0xc0,0xa1,0x00,0x80,
+0xc0,0x01,0x01,0x80,0x01,0x11,0x01,0x81,0x40,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,
+0x00,0x06,0x02,0x00,0x40,0x01,0x02,0x80,0x80,0x01,0x03,0x00,0x04,0x04,0x02,0x81,
+0xc0,0xa0,0x01,0x81,0x81,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x09,0x00,0x02,0x47,0x43,0x00,0x00,0x05,0x73,0x74,0x61,0x72,0x74,0x00,0x00,
+0x0b,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x00,0x00,0x0b,0x65,
+0x61,0x63,0x68,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x05,0x41,0x72,0x72,
+0x61,0x79,0x00,0x00,0x0d,0x63,0x6f,0x75,0x6e,0x74,0x5f,0x6f,0x62,0x6a,0x65,0x63,
+0x74,0x73,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x07,0x54,0x5f,0x41,0x52,0x52,0x41,0x59,
+0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x80,0x00,0x05,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0xb4,0x00,0x05,0x00,0x0b,0x00,0x02,0x00,0x00,0x00,0x4b,0x02,0x80,0x00,
+0x06,0x03,0x3f,0xff,0x83,0x03,0x80,0x00,0x91,0x04,0x40,0x00,0x03,0x03,0x80,0x80,
+0xa0,0x02,0x80,0x01,0x20,0x02,0x80,0x00,0x06,0x03,0x3f,0xff,0x83,0x03,0x80,0x00,
+0x91,0x04,0x00,0x01,0x84,0x03,0x80,0x80,0xa0,0x02,0x80,0x01,0x20,0x02,0x80,0x00,
+0x91,0x03,0x01,0x80,0x37,0x02,0x80,0x80,0xa0,0x00,0x81,0x40,0x01,0x02,0x80,0x00,
+0x06,0x03,0x00,0x40,0x01,0x03,0xbf,0xff,0x83,0x03,0x01,0x40,0xb5,0x02,0x81,0x00,
+0xa0,0x02,0x80,0x00,0x06,0x03,0x00,0x00,0x91,0x03,0x80,0x03,0x11,0x04,0x41,0xf3,
+0x83,0x04,0xbf,0xff,0x83,0x03,0x81,0xc1,0x20,0x03,0x00,0x80,0xa0,0x03,0x80,0x40,
+0x01,0x04,0x41,0xf3,0x83,0x04,0xc0,0x01,0x83,0x04,0x02,0x80,0xb0,0x03,0x82,0x40,
+0xac,0x03,0x02,0x00,0xb6,0x02,0x81,0x00,0xa0,0x02,0x80,0x00,0x06,0x03,0x00,0x00,
+0x91,0x03,0x80,0x00,0x3d,0x04,0x53,0x87,0x83,0x03,0x82,0x80,0xb0,0x03,0x00,0x80,
+0xa0,0x03,0xd3,0x87,0x83,0x03,0x01,0x40,0xb5,0x02,0x81,0x00,0xa0,0x01,0x01,0x40,
+0x3f,0x02,0xc1,0xf3,0x83,0x03,0x00,0x01,0x40,0x02,0x82,0xc0,0x21,0x02,0x80,0x00,
+0x06,0x03,0x00,0x00,0x91,0x03,0x80,0x80,0x01,0x03,0x00,0x80,0xa0,0x03,0x80,0x00,
+0x91,0x04,0x02,0x00,0x3f,0x03,0x80,0x80,0xa0,0x03,0x01,0x40,0xb5,0x02,0x81,0x00,
+0xa0,0x02,0x80,0x06,0x11,0x02,0x81,0xc0,0x20,0x01,0x81,0x40,0x01,0x02,0x80,0x00,
+0x91,0x03,0x00,0xc0,0x01,0x02,0x80,0x80,0xa0,0x02,0x01,0x40,0x01,0x02,0xc0,0x31,
+0x83,0x03,0x00,0x03,0x40,0x02,0x82,0xc0,0x21,0x02,0x80,0x00,0x06,0x03,0x00,0x00,
+0x91,0x03,0x80,0xc0,0x01,0x03,0x00,0x80,0xa0,0x03,0x81,0x00,0x01,0x03,0x01,0x40,
+0xb5,0x02,0x81,0x00,0xa0,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x01,
+0x78,0x00,0x00,0x00,0x0d,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x0b,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,
+0x65,0x00,0x00,0x0a,0x6d,0x65,0x6d,0x73,0x69,0x7a,0x65,0x5f,0x6f,0x66,0x00,0x00,
+0x03,0x73,0x79,0x6d,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,
+0x75,0x65,0x00,0x00,0x01,0x3e,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,
+0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x3e,0x3d,0x00,0x00,0x01,0x2b,0x00,0x00,0x01,
+0x2a,0x00,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,
+0x63,0x74,0x00,0x00,0x00,0x00,0x38,0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
+0x07,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x80,0x15,0x02,0x80,0x40,
+0x01,0x03,0x00,0xc0,0x01,0x02,0x00,0x01,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,0x00,0x00,0x56,0x00,
+0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x08,0x02,0x00,0x00,0x26,0x01,0x80,0xc0,
+0x15,0x02,0x00,0x00,0x3d,0x02,0x80,0x40,0x01,0x02,0x01,0x40,0x3e,0x02,0x80,0x40,
+0x01,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x02,
+0x40,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x15,0x69,0x6e,0x73,0x74,0x61,
+0x6e,0x63,0x65,0x5f,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x5f,0x73,0x65,0x74,
+0x00,0x00,0x00,0x01,0x01,0x00,0x03,0x00,0x09,0x00,0x01,0x00,0x00,0x00,0x20,0x01,
+0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x01,0x80,0x01,0x11,0x01,0x80,0xc0,0x20,0x00,
+0x80,0xc0,0x01,0x01,0x00,0xc0,0x37,0x01,0xc0,0x63,0x83,0x02,0x00,0x01,0x40,0x01,
+0x81,0x00,0x21,0x01,0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x01,0x80,0x00,0x06,0x02,
+0x00,0x01,0x11,0x02,0x00,0xc0,0x20,0x02,0x80,0x40,0x01,0x03,0x40,0x63,0x83,0x03,
+0xc1,0xf3,0x83,0x03,0x02,0x00,0xb0,0x02,0x81,0xc0,0xac,0x02,0x01,0x80,0xb6,0x01,
+0x81,0x40,0xa0,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x11,0x02,0x02,0x40,0x20,0x02,
+0x80,0x05,0x84,0x02,0x02,0x80,0xa0,0x02,0xc0,0x63,0x83,0x03,0x41,0xf3,0x83,0x02,
+0x82,0x00,0xb0,0x02,0x01,0x80,0xb6,0x01,0x81,0x40,0xa0,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x02,0x47,0x43,0x00,0x00,0x05,0x73,0x74,
+0x61,0x72,0x74,0x00,0x00,0x0b,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,
+0x65,0x00,0x00,0x0e,0x6d,0x65,0x6d,0x73,0x69,0x7a,0x65,0x5f,0x6f,0x66,0x5f,0x61,
+0x6c,0x6c,0x00,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x0b,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x02,0x3e,0x3d,0x00,0x00,0x01,
+0x2b,0x00,0x00,0x01,0x2a,0x00,0x00,0x04,0x73,0x74,0x61,0x74,0x00,0x00,0x02,0x5b,
+0x5d,0x00,0x00,0x0d,0x70,0x61,0x79,0x6c,0x6f,0x61,0x64,0x5f,0x62,0x79,0x74,0x65,
+0x73,0x00,0x00,0x00,0x00,0x3b,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x06,
+0x00,0x80,0x80,0x15,0x01,0x00,0x00,0x3d,0x01,0xc1,0xf3,0x83,0x01,0x00,0x40,0xb0,
+0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x79,
+0x00,0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,0x01,0x2a,0x00,0x44,0x42,0x47,
+0x00,0x00,0x00,0x04,0x77,0x00,0x01,0x00,0x38,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,
+0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,
+0x79,0x2d,0x6f,0x62,0x6a,0x65,0x63,0x74,0x73,0x70,0x61,0x63,0x65,0x2f,0x74,0x65,
+0x73,0x74,0x2f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x73,0x70,0x61,0x63,0x65,0x2e,0x72,
+0x62,0x00,0x00,0x00,0x3b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x15,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x2b,0x00,0x2b,0x00,0x2b,
+0x00,0x2b,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x41,0x00,0x41,0x00,0x41,
+0x00,0x41,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x00,0x01,0x17,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x00,0x00,0x02,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+0x04,0x00,0x04,0x00,0x04,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x06,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x07,0x00,0x07,0x00,0x07,0x00,
+0x07,0x00,0x07,0x00,0x07,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,
+0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,
+0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,
+0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x12,0x00,0x12,0x00,
+0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,
+0x16,0x00,0x16,0x00,0x16,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x18,0x00,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1a,0x00,0x1a,0x00,0x1b,0x00,0x1c,0x00,
+0x1c,0x00,0x1c,0x00,0x1e,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x22,0x00,0x23,0x00,
+0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x27,0x00,
+0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,
+0x27,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,
+0x28,0x00,0x28,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x1b,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x07,0x00,0x07,
+0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,
+0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x12,0x00,0x12,0x00,0x12,
+0x00,0x12,0x00,0x12,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x00,0x00,
+0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x20,
+0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x1d,0x00,0x00,0x2c,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,
+0x2d,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x32,0x00,0x33,0x00,
+0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x36,0x00,
+0x36,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,
+0x37,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x05,0x00,0x00,0x2d,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x00,0x00,0x1b,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x33,0x00,
+0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x00,0x00,0x33,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x3b,0x00,0x3b,0x00,0x3c,0x00,0x3c,
+0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3e,0x00,0x3e,
+0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x00,0x00,0x15,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x3c,0x00,0x3c,0x00,
+0x00,0x00,0xa7,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0x00,
+0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x43,0x00,0x43,
+0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x44,
+0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x46,0x00,0x46,0x00,0x46,
+0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,
+0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,
+0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x48,0x00,0x49,0x00,0x49,0x00,0x49,
+0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x4a,
+0x00,0x4a,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,
+0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,
+0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,
+0x49,0x00,0x49,0x00,0x49,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,
+0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x00,0x00,0x51,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x52,0x00,0x52,0x00,0x53,0x00,0x53,0x00,
+0x53,0x00,0x54,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x56,0x00,0x56,0x00,0x57,0x00,
+0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,
+0x57,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,
+0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,
+0x00,0x55,0x00,0x55,0x45,0x4e,0x44,0x00,0x00,0x00,0x00,0x08,
+};
+#include <stdint.h>
+const uint8_t gem_test_irep_mruby_objectspace_1[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x32,0x02,0x3d,0x00,0x00,0x08,0xb5,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x06,0x22,0x30,0x30,
+0x30,0x30,0x00,0x00,0x00,0x72,0x00,0x01,0x00,0x04,0x00,0x02,0x00,0x00,0x00,0x09,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x01,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0xbd,0x01,0x80,0x03,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x02,0x00,0x00,0x14,0x4f,0x62,0x6a,0x65,0x63,
+0x74,0x53,0x70,0x61,0x63,0x65,0x2e,0x64,0x75,0x6d,0x70,0x5f,0x61,0x6c,0x6c,0x00,
+0x00,0x15,0x6d,0x72,0x62,0x5f,0x6f,0x62,0x6a,0x73,0x70,0x61,0x63,0x65,0x5f,0x64,
+0x75,0x6d,0x70,0x5f,0x61,0x6c,0x6c,0x00,0x00,0x00,0x01,0x00,0x06,0x61,0x73,0x73,
+0x65,0x72,0x74,0x00,0x00,0x00,0x00,0x48,0x00,0x01,0x00,0x04,0x00,0x01,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x01,0x40,0x00,0x80,
+0x00,0xa1,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0c,0x52,
+0x75,0x6e,0x74,0x69,0x6d,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x5c,
+0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x11,0x01,0x00,
+0x00,0x3d,0x00,0x80,0x40,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,
+0x1a,0x2f,0x6e,0x6f,0x6e,0x65,0x78,0x69,0x73,0x74,0x65,0x6e,0x74,0x2f,0x64,0x69,
+0x72,0x2f,0x68,0x65,0x61,0x70,0x2e,0x64,0x75,0x6d,0x70,0x00,0x00,0x00,0x02,0x00,
+0x0b,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x00,0x00,0x08,0x64,
+0x75,0x6d,0x70,0x5f,0x61,0x6c,0x6c,0x00,0x00,0x00,0x02,0x1e,0x00,0x08,0x00,0x0e,
+0x00,0x04,0x00,0x00,0x00,0x4d,0x04,0x00,0x00,0x3d,0x04,0x80,0x00,0xbd,0x05,0x40,
+0xf9,0x83,0x04,0x80,0x00,0xb0,0x04,0x02,0x01,0x37,0x04,0x00,0x00,0x8a,0x04,0x00,
+0x01,0x11,0x04,0x00,0xc0,0x20,0x04,0x80,0x01,0x3d,0x04,0x01,0x00,0xa0,0x00,0x82,
+0x00,0x01,0x04,0x00,0x00,0x06,0x04,0x80,0x01,0xbd,0x05,0x00,0x40,0x01,0x05,0xbf,
+0xff,0x83,0x05,0x01,0x80,0xa0,0x04,0x01,0x41,0x20,0x01,0x02,0x00,0x3f,0x01,0x82,
+0x00,0x37,0x02,0x02,0x00,0x3f,0x02,0x82,0x00,0x3f,0x04,0x00,0x40,0x01,0x04,0xc0,
+0x00,0x03,0x05,0x3f,0xff,0x03,0x04,0x82,0x40,0x41,0x04,0x01,0x80,0xa0,0x04,0x80,
+0x01,0x40,0x04,0x01,0xc0,0x21,0x04,0x00,0x00,0x06,0x04,0x80,0x80,0x01,0x05,0x00,
+0x02,0x3d,0x04,0x81,0x80,0xa0,0x04,0x02,0x00,0xa0,0x04,0x00,0x00,0x06,0x04,0x80,
+0x80,0x01,0x05,0x00,0x02,0xbd,0x04,0x81,0x80,0xa0,0x04,0x02,0x00,0xa0,0x04,0x00,
+0x00,0x06,0x04,0x80,0x80,0x01,0x05,0x00,0x03,0x3d,0x04,0x81,0x80,0xa0,0x04,0x02,
+0x00,0xa0,0x04,0x00,0xc0,0x01,0x04,0x80,0x03,0x40,0x04,0x01,0xc0,0x21,0x04,0x01,
+0x00,0x01,0x04,0x02,0x40,0x20,0x04,0x80,0x05,0x40,0x04,0x01,0xc0,0x21,0x04,0x01,
+0x40,0x01,0x04,0x80,0x03,0xbd,0x04,0x01,0x80,0xa0,0x03,0x02,0x00,0x01,0x03,0x80,
+0x00,0x05,0x04,0x01,0x00,0x01,0x04,0x02,0x40,0x20,0x04,0x80,0x07,0x40,0x04,0x01,
+0xc0,0x21,0x04,0x00,0x00,0x06,0x04,0x81,0xc0,0x01,0x04,0x82,0xc0,0x20,0x04,0x02,
+0x80,0xa0,0x04,0x00,0x00,0x06,0x04,0x80,0x04,0x3d,0x05,0x01,0x00,0x01,0x05,0x81,
+0x40,0x01,0x06,0x00,0x04,0xbd,0x05,0x81,0x80,0xa0,0x05,0x01,0x80,0xa0,0x05,0xc0,
+0x00,0x03,0x05,0x01,0x80,0xa0,0x04,0x01,0x41,0x20,0x04,0x00,0x00,0x05,0x04,0x00,
+0x00,0x8a,0x04,0x00,0x00,0x07,0x04,0x00,0x00,0x29,0x00,0x00,0x00,0x0a,0x00,0x00,
+0x07,0x64,0x75,0x6d,0x70,0x2d,0x6d,0x65,0x00,0x00,0x01,0x78,0x00,0x00,0x01,0x0a,
+0x00,0x00,0x13,0x23,0x20,0x6d,0x72,0x75,0x62,0x79,0x20,0x68,0x65,0x61,0x70,0x20,
+0x64,0x75,0x6d,0x70,0x20,0x31,0x00,0x00,0x07,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,
+0x00,0x00,0x02,0x76,0x6d,0x00,0x00,0x05,0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x06,
+0x53,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x07,0x54,0x5f,0x43,0x4c,0x41,0x53,0x53,
+0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x00,0x0c,0x00,0x01,0x2a,0x00,
+0x00,0x0a,0x24,0x64,0x75,0x6d,0x70,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x0f,0x4f,
+0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x54,0x65,0x73,0x74,0x00,0x00,
+0x04,0x64,0x75,0x6d,0x70,0x00,0x00,0x05,0x73,0x70,0x6c,0x69,0x74,0x00,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x02,0x5b,
+0x5d,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x06,0x76,0x61,0x6c,0x75,0x65,0x73,0x00,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,0x00,
+0x04,0x6e,0x69,0x6c,0x3f,0x00,0x00,0x00,0x01,0x01,0x00,0x04,0x00,0x09,0x00,0x00,
+0x00,0x00,0x00,0x2f,0x02,0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x3d,
+0x02,0x00,0x00,0xa0,0x01,0x81,0x00,0x01,0x02,0xbf,0xff,0x83,0x02,0x00,0x40,0xa0,
+0x02,0x80,0x00,0xbd,0x02,0x00,0x80,0xb2,0x02,0x40,0x06,0x99,0x02,0x00,0x00,0x07,
+0x02,0x80,0x80,0x15,0x03,0x00,0xc0,0x01,0x03,0xc0,0x00,0x03,0x03,0x00,0x40,0xa0,
+0x03,0x81,0x00,0x01,0x02,0x80,0xc1,0x20,0x02,0x00,0xc0,0x15,0x02,0x80,0xc0,0x01,
+0x03,0x40,0x00,0x83,0x02,0x80,0x40,0xa0,0x02,0x01,0x00,0xa0,0x00,0x40,0x0b,0x97,
+0x02,0x00,0xc0,0x01,0x02,0xbf,0xff,0x83,0x02,0x00,0x40,0xa0,0x02,0x80,0x01,0x3d,
+0x02,0x00,0x80,0xb2,0x02,0x40,0x05,0x19,0x02,0x00,0xc0,0x01,0x02,0xc0,0x00,0x03,
+0x02,0x00,0x40,0xa0,0x02,0x81,0x40,0x15,0x03,0x00,0xc0,0x01,0x03,0xc0,0x01,0x03,
+0x03,0x00,0x40,0xa0,0x03,0x81,0x00,0x01,0x02,0x80,0xc1,0x20,0x00,0x40,0x03,0x97,
+0x02,0x00,0xc0,0x01,0x02,0x81,0x00,0x15,0x03,0x00,0xc0,0x01,0x03,0xbf,0xff,0x83,
+0x03,0x00,0x40,0xa0,0x03,0x81,0x00,0x01,0x02,0x80,0xc1,0x20,0x02,0x00,0x00,0x29,
+0x00,0x00,0x00,0x03,0x00,0x00,0x01,0x20,0x00,0x00,0x04,0x52,0x4f,0x4f,0x54,0x00,
+0x00,0x04,0x4e,0x41,0x4d,0x45,0x00,0x00,0x00,0x05,0x00,0x05,0x73,0x70,0x6c,0x69,
+0x74,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x03,0x5b,0x5d,
+0x3d,0x00,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x47,0x00,0x03,0x00,0x07,0x00,
+0x00,0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x06,0x02,0x01,0x00,
+0x15,0x02,0x80,0x40,0x01,0x02,0x00,0x40,0xa0,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x04,0x6b,0x65,0x79,0x3f,0x00,0x00,0x00,
+0x00,0x8f,0x00,0x04,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x14,0x02,0x00,0x00,0x26,
+0x01,0xc0,0x01,0x83,0x00,0x40,0x05,0x17,0x02,0x00,0x00,0x06,0x02,0x81,0x00,0x15,
+0x03,0x00,0x40,0x01,0x03,0x80,0xc0,0x01,0x03,0x00,0x80,0xa0,0x02,0x80,0x40,0xa0,
+0x02,0x00,0x00,0xa0,0x02,0x00,0xc0,0x01,0x02,0x00,0xc0,0xad,0x01,0x81,0x00,0x01,
+0x02,0x00,0xc0,0x01,0x02,0x80,0x40,0x01,0x02,0x81,0x40,0x20,0x02,0x01,0x00,0xb3,
+0x02,0x3f,0xf8,0x98,0x02,0x00,0x00,0x05,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x06,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,
+0x65,0x00,0x00,0x04,0x6b,0x65,0x79,0x3f,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x01,
+0x2b,0x00,0x00,0x01,0x3c,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x00,0x01,
+0x0b,0x00,0x05,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x2f,0x02,0x00,0x00,0x26,0x02,
+0x80,0x40,0x01,0x03,0x40,0x00,0x03,0x02,0x80,0x00,0xa0,0x03,0x00,0x00,0x3d,0x02,
+0x80,0x40,0xb2,0x02,0xc0,0x00,0x99,0x00,0x40,0x01,0x17,0x02,0x80,0x00,0x05,0x02,
+0x80,0x00,0x29,0x01,0xc0,0x01,0x83,0x00,0x40,0x0e,0x17,0x02,0x81,0x00,0x15,0x03,
+0x00,0x40,0x01,0x03,0x80,0xc0,0x01,0x03,0x00,0x00,0xa0,0x02,0x80,0x00,0xa0,0x02,
+0x01,0x40,0x01,0x03,0x40,0x00,0x03,0x02,0x80,0x00,0xa0,0x03,0x00,0x00,0xbd,0x02,
+0x80,0x40,0xb2,0x02,0xc0,0x02,0x99,0x02,0x81,0x00,0x01,0x03,0x40,0x00,0x83,0x02,
+0x80,0x00,0xa0,0x03,0x01,0x80,0x15,0x02,0x80,0x40,0xb2,0x02,0xc0,0x03,0x19,0x02,
+0x81,0x00,0x01,0x03,0x40,0x01,0x03,0x02,0x80,0x00,0xa0,0x02,0x80,0x80,0x20,0x03,
+0x40,0xf9,0x83,0x02,0x80,0xc0,0xb5,0x02,0xc0,0x00,0x99,0x02,0x01,0xc0,0x16,0x02,
+0x80,0xc0,0x01,0x02,0x81,0x00,0xad,0x01,0x81,0x40,0x01,0x02,0x80,0xc0,0x01,0x03,
+0x00,0x40,0x01,0x03,0x01,0x80,0x20,0x02,0x81,0x40,0xb3,0x02,0xbf,0xef,0x98,0x02,
+0x80,0x00,0x05,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x07,0x54,0x5f,
+0x41,0x52,0x52,0x41,0x59,0x00,0x00,0x08,0x54,0x5f,0x53,0x54,0x52,0x49,0x4e,0x47,
+0x00,0x00,0x00,0x07,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x04,
+0x74,0x6f,0x5f,0x69,0x00,0x00,0x01,0x3e,0x00,0x00,0x01,0x2b,0x00,0x00,0x01,0x3c,
+0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x44,0x42,0x47,0x00,0x00,0x00,0x02,0x75,
+0x00,0x01,0x00,0x31,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,
+0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x6f,0x62,0x6a,
+0x65,0x63,0x74,0x73,0x70,0x61,0x63,0x65,0x2f,0x74,0x65,0x73,0x74,0x2f,0x64,0x75,
+0x6d,0x70,0x2e,0x72,0x62,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x05,
+0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+0x02,0x00,0x02,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0xab,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4d,0x00,0x00,0x06,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x07,0x00,0x07,0x00,0x07,0x00,
+0x07,0x00,0x07,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,
+0x0a,0x00,0x0b,0x00,0x0c,0x00,0x0d,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,
+0x0e,0x00,0x0e,0x00,0x0e,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,
+0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,
+0x1b,0x00,0x1b,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+0x1f,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x29,0x00,0x2a,0x00,0x2a,0x00,
+0x2a,0x00,0x2a,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x34,0x00,0x34,0x00,
+0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,
+0x35,0x00,0x35,0x00,0x36,0x00,0x36,0x00,0x00,0x00,0x6f,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0x00,0x00,0x0e,0x00,0x0f,0x00,0x0f,0x00,0x0f,
+0x00,0x0f,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x11,0x00,0x11,
+0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x12,0x00,0x12,0x00,0x12,
+0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,
+0x00,0x13,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,
+0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,
+0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,
+0x1e,0x00,0x1e,0x00,0x1e,0x00,0x00,0x00,0x39,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x1f,0x00,0x20,0x00,0x24,0x00,0x22,0x00,0x22,
+0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,
+0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,
+0x00,0x6f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0x00,0x00,
+0x2a,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,
+0x2b,0x00,0x2b,0x00,0x2c,0x00,0x31,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,
+0x2e,0x00,0x2e,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,
+0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,
+0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x45,0x4e,0x44,
+0x00,0x00,0x00,0x00,0x08,
+};
+#include <stdint.h>
+const uint8_t gem_test_irep_mruby_objectspace_2[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x32,0x46,0x0a,0x00,0x00,0x0e,0xa3,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x0a,0x84,0x30,0x30,
+0x30,0x30,0x00,0x00,0x01,0x3f,0x00,0x01,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x11,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x01,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0xbd,0x01,0x80,0x03,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x3d,0x01,0x80,0x05,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x01,0xbd,0x01,0x80,0x07,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x04,0x00,0x00,0x1d,0x4f,0x62,0x6a,0x65,0x63,
+0x74,0x53,0x70,0x61,0x63,0x65,0x2e,0x74,0x72,0x61,0x63,0x65,0x5f,0x61,0x6c,0x6c,
+0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x73,0x00,0x00,0x42,0x4f,0x62,0x6a,0x65,0x63,
+0x74,0x53,0x70,0x61,0x63,0x65,0x2e,0x74,0x72,0x61,0x63,0x65,0x5f,0x61,0x6c,0x6c,
+0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x73,0x20,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+0x74,0x65,0x73,0x20,0x43,0x20,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x20,0x74,0x6f,
+0x20,0x74,0x68,0x65,0x69,0x72,0x20,0x63,0x61,0x6c,0x6c,0x65,0x72,0x00,0x00,0x33,
+0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x2e,0x74,0x72,0x61,0x63,
+0x65,0x5f,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x73,0x20,0x73,0x61,
+0x6d,0x70,0x6c,0x65,0x73,0x20,0x31,0x20,0x69,0x6e,0x20,0x69,0x6e,0x74,0x65,0x72,
+0x76,0x61,0x6c,0x00,0x00,0x3e,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,
+0x65,0x2e,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x69,0x74,
+0x65,0x73,0x28,0x74,0x72,0x75,0x65,0x29,0x20,0x63,0x6f,0x75,0x6e,0x74,0x73,0x20,
+0x74,0x68,0x65,0x20,0x72,0x65,0x74,0x61,0x69,0x6e,0x65,0x64,0x20,0x6f,0x62,0x6a,
+0x65,0x63,0x74,0x73,0x00,0x00,0x00,0x01,0x00,0x06,0x61,0x73,0x73,0x65,0x72,0x74,
+0x00,0x00,0x00,0x01,0x95,0x00,0x05,0x00,0x0a,0x00,0x02,0x00,0x00,0x00,0x34,0x02,
+0x80,0x00,0x11,0x02,0x80,0x40,0x20,0x00,0x80,0x00,0x05,0x02,0x80,0x00,0x11,0x03,
+0x00,0x01,0x40,0x02,0x80,0x80,0x21,0x01,0x01,0x40,0x01,0x02,0x80,0x00,0x11,0x02,
+0x80,0xc0,0x20,0x01,0x81,0x40,0x01,0x02,0x80,0x00,0x11,0x02,0x80,0x40,0x20,0x02,
+0x00,0x00,0x05,0x02,0x80,0xc0,0x01,0x03,0x00,0x03,0x40,0x02,0x81,0x00,0x21,0x02,
+0x80,0x00,0x06,0x03,0x01,0x00,0x01,0x03,0x01,0x80,0x20,0x02,0x81,0x40,0xa0,0x02,
+0x80,0x00,0x06,0x03,0x40,0x18,0x83,0x03,0x81,0x00,0x01,0x04,0x40,0x01,0x03,0x03,
+0x82,0x00,0xa0,0x02,0x81,0xc1,0x20,0x02,0x80,0x00,0x06,0x03,0x00,0x04,0x91,0x03,
+0x81,0x00,0x01,0x04,0x3f,0xff,0x83,0x03,0x82,0x00,0xa0,0x03,0x82,0x80,0x20,0x02,
+0x81,0xc1,0x20,0x02,0x80,0x00,0x06,0x03,0x00,0x00,0x3d,0x03,0x81,0x00,0x01,0x04,
+0x3f,0xff,0x83,0x03,0x82,0x00,0xa0,0x04,0x3f,0xff,0x83,0x03,0x82,0x00,0xa0,0x02,
+0x82,0xc1,0x20,0x02,0x80,0x00,0x06,0x03,0x40,0x18,0x83,0x03,0x80,0x80,0x01,0x03,
+0x83,0x00,0x20,0x02,0x81,0xc1,0x20,0x02,0x80,0x00,0x06,0x03,0x01,0x80,0x37,0x03,
+0x80,0x00,0x11,0x03,0x80,0xc0,0x20,0x02,0x81,0xc1,0x20,0x02,0x80,0x00,0x29,0x00,
+0x00,0x00,0x01,0x00,0x00,0x01,0x22,0x00,0x00,0x00,0x0d,0x00,0x0b,0x4f,0x62,0x6a,
+0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x00,0x00,0x17,0x74,0x72,0x61,0x63,0x65,
+0x5f,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5f,0x63,0x6c,0x65,
+0x61,0x72,0x00,0x00,0x11,0x74,0x72,0x61,0x63,0x65,0x5f,0x61,0x6c,0x6c,0x6f,0x63,
+0x61,0x74,0x69,0x6f,0x6e,0x73,0x00,0x00,0x10,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,
+0x69,0x6f,0x6e,0x5f,0x73,0x69,0x74,0x65,0x73,0x00,0x00,0x04,0x65,0x61,0x63,0x68,
+0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,
+0x00,0x04,0x6e,0x69,0x6c,0x3f,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x06,0x53,0x74,0x72,
+0x69,0x6e,0x67,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x10,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x6e,0x6f,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,
+0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x3a,0x00,0x02,0x00,0x04,0x00,0x01,
+0x00,0x00,0x00,0x07,0x00,0x80,0x80,0x37,0x01,0x40,0x02,0x83,0x01,0x00,0x40,0x16,
+0x01,0x40,0x18,0x83,0x01,0x80,0x01,0x40,0x01,0x00,0x00,0x21,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,
+0x00,0x00,0x00,0x2f,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x80,
+0x40,0x15,0x01,0x00,0x00,0x3d,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x01,0x00,0x00,0x01,0x78,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,
+0x00,0x00,0x71,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x12,0x02,0x00,0x00,
+0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,0x01,0x80,0x00,0xa0,0x02,0x00,0x40,
+0x15,0x01,0x80,0x40,0xb2,0x01,0xc0,0x02,0x99,0x01,0x80,0x40,0x01,0x02,0x40,0x00,
+0x83,0x01,0x80,0x00,0xa0,0x02,0x00,0x01,0x11,0x01,0x80,0x40,0xb2,0x01,0xc0,0x01,
+0x99,0x01,0x80,0x40,0x01,0x01,0x81,0x00,0x16,0x00,0x40,0x00,0x97,0x01,0x80,0x00,
+0x05,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x02,0x5b,
+0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,
+0x00,0x00,0x00,0xfd,0x00,0x04,0x00,0x09,0x00,0x02,0x00,0x00,0x00,0x1d,0x02,0x00,
+0x00,0x11,0x02,0x00,0x40,0x20,0x00,0x80,0x00,0x05,0x02,0x00,0x00,0x11,0x02,0x80,
+0x01,0x40,0x02,0x00,0x80,0x21,0x02,0x00,0x00,0x11,0x02,0x00,0xc0,0x20,0x01,0x01,
+0x00,0x01,0x02,0x00,0x00,0x11,0x02,0x00,0x40,0x20,0x02,0x00,0x80,0x01,0x02,0x80,
+0x03,0x40,0x02,0x01,0x00,0x21,0x01,0x81,0x00,0x01,0x02,0x00,0x00,0x06,0x02,0xc0,
+0x00,0x03,0x03,0x00,0xc0,0x01,0x03,0x01,0x80,0x20,0x02,0x01,0x41,0x20,0x02,0x00,
+0x00,0x06,0x02,0xc0,0x04,0x83,0x03,0x00,0xc0,0x01,0x03,0xbf,0xff,0x83,0x03,0x01,
+0xc0,0xa0,0x03,0xc0,0x01,0x03,0x03,0x01,0xc0,0xa0,0x02,0x01,0x41,0x20,0x02,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0b,0x4f,0x62,0x6a,0x65,
+0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x00,0x00,0x17,0x74,0x72,0x61,0x63,0x65,0x5f,
+0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5f,0x63,0x6c,0x65,0x61,
+0x72,0x00,0x00,0x11,0x74,0x72,0x61,0x63,0x65,0x5f,0x61,0x6c,0x6c,0x6f,0x63,0x61,
+0x74,0x69,0x6f,0x6e,0x73,0x00,0x00,0x10,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x69,
+0x6f,0x6e,0x5f,0x73,0x69,0x74,0x65,0x73,0x00,0x00,0x06,0x73,0x65,0x6c,0x65,0x63,
+0x74,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x00,0x00,
+0x36,0x00,0x01,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0xc0,0x0c,0x83,0x00,
+0x80,0x40,0x16,0x00,0xc0,0x04,0x83,0x01,0x00,0x01,0x40,0x00,0x80,0x00,0x21,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x74,0x69,0x6d,
+0x65,0x73,0x00,0x00,0x00,0x00,0x31,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x03,
+0x6e,0x65,0x77,0x00,0x00,0x00,0x00,0x5d,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,
+0x00,0x0d,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,0x01,0x80,
+0x00,0xa0,0x02,0x00,0x40,0x15,0x01,0x80,0x40,0xb2,0x01,0xc0,0x02,0x99,0x01,0x80,
+0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x00,0xa0,0x02,0x00,0x01,0x11,0x01,0x80,
+0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x02,
+0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,
+0x00,0x00,0x00,0x00,0xfe,0x00,0x04,0x00,0x08,0x00,0x03,0x00,0x00,0x00,0x19,0x02,
+0x00,0x00,0x11,0x02,0x00,0x40,0x20,0x00,0x80,0x00,0x05,0x02,0x00,0x00,0x11,0x02,
+0xc0,0x04,0x83,0x03,0x00,0x01,0x40,0x02,0x00,0x80,0xa1,0x02,0x00,0x00,0x11,0x02,
+0x00,0xc0,0x20,0x01,0x01,0x00,0x01,0x02,0x00,0x00,0x11,0x02,0x00,0x40,0x20,0x01,
+0xbf,0xff,0x83,0x02,0x00,0x80,0x01,0x02,0x80,0x03,0x40,0x02,0x01,0x00,0x21,0x02,
+0x00,0x00,0x06,0x02,0xc0,0x31,0x83,0x03,0x00,0xc0,0x01,0x02,0x01,0x41,0x20,0x02,
+0x00,0x00,0x06,0x02,0x80,0x03,0x91,0x03,0x00,0x05,0x40,0x02,0x01,0x80,0xa1,0x02,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0b,0x4f,0x62,0x6a,
+0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x00,0x00,0x17,0x74,0x72,0x61,0x63,0x65,
+0x5f,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5f,0x63,0x6c,0x65,
+0x61,0x72,0x00,0x00,0x11,0x74,0x72,0x61,0x63,0x65,0x5f,0x61,0x6c,0x6c,0x6f,0x63,
+0x61,0x74,0x69,0x6f,0x6e,0x73,0x00,0x00,0x10,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,
+0x69,0x6f,0x6e,0x5f,0x73,0x69,0x74,0x65,0x73,0x00,0x00,0x04,0x65,0x61,0x63,0x68,
+0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,
+0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,
+0x00,0x00,0x36,0x00,0x01,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0xc0,0x13,
+0x83,0x00,0x80,0x40,0x16,0x00,0xc1,0xf3,0x83,0x01,0x00,0x01,0x40,0x00,0x80,0x00,
+0x21,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x74,
+0x69,0x6d,0x65,0x73,0x00,0x00,0x00,0x00,0x22,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x80,0x00,0x3d,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,
+0x00,0x01,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x00,0x03,0x00,0x07,0x00,
+0x00,0x00,0x00,0x00,0x16,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,
+0x03,0x01,0x80,0x00,0xa0,0x02,0x00,0x40,0x15,0x01,0x80,0x40,0xb2,0x01,0xc0,0x02,
+0x99,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x00,0xa0,0x02,0x00,0x01,
+0x11,0x01,0x80,0x40,0xb2,0x01,0xc0,0x03,0x99,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,
+0x01,0x02,0xc0,0x01,0x03,0x02,0x00,0x00,0xa0,0x01,0x80,0xc0,0xac,0x01,0x80,0xc0,
+0x16,0x00,0x40,0x00,0x97,0x01,0x80,0x00,0x05,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x06,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x4e,
+0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x11,0x01,0x3f,
+0xff,0x83,0x00,0x80,0x40,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x0b,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x00,
+0x00,0x17,0x74,0x72,0x61,0x63,0x65,0x5f,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x69,
+0x6f,0x6e,0x73,0x5f,0x73,0x74,0x61,0x72,0x74,0x00,0x00,0x00,0x01,0x31,0x00,0x07,
+0x00,0x0b,0x00,0x03,0x00,0x00,0x00,0x27,0x03,0x80,0x00,0x11,0x03,0x80,0x40,0x20,
+0x00,0x80,0x00,0x05,0x01,0x01,0xc0,0x37,0x03,0x80,0x00,0x11,0x04,0x00,0x01,0x40,
+0x03,0x80,0x80,0x21,0x03,0x80,0x00,0x11,0x03,0x80,0xc0,0x20,0x01,0x81,0xc0,0x01,
+0x03,0x80,0x00,0x11,0x04,0x00,0x00,0x07,0x03,0x80,0xc0,0xa0,0x02,0x01,0xc0,0x01,
+0x03,0x80,0x00,0x11,0x03,0x80,0x40,0x20,0x02,0xbf,0xff,0x83,0x03,0x80,0xc0,0x01,
+0x04,0x00,0x03,0x40,0x03,0x81,0x00,0x21,0x03,0x3f,0xff,0x83,0x03,0x81,0x00,0x01,
+0x04,0x00,0x05,0x40,0x03,0x81,0x00,0x21,0x03,0x80,0x00,0x06,0x04,0x01,0x40,0x01,
+0x04,0xc0,0x63,0x83,0x04,0x01,0x80,0xb6,0x03,0x81,0x40,0xa0,0x03,0x80,0x00,0x06,
+0x04,0x40,0x18,0x83,0x04,0x81,0x80,0x01,0x03,0x81,0xc1,0x20,0x03,0x80,0x00,0x06,
+0x04,0x40,0x18,0x83,0x04,0x80,0x80,0x01,0x04,0x82,0x00,0x20,0x03,0x81,0xc1,0x20,
+0x03,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x0b,0x4f,0x62,
+0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x00,0x00,0x17,0x74,0x72,0x61,0x63,
+0x65,0x5f,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5f,0x63,0x6c,
+0x65,0x61,0x72,0x00,0x00,0x11,0x74,0x72,0x61,0x63,0x65,0x5f,0x61,0x6c,0x6c,0x6f,
+0x63,0x61,0x74,0x69,0x6f,0x6e,0x73,0x00,0x00,0x10,0x61,0x6c,0x6c,0x6f,0x63,0x61,
+0x74,0x69,0x6f,0x6e,0x5f,0x73,0x69,0x74,0x65,0x73,0x00,0x00,0x04,0x65,0x61,0x63,
+0x68,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,
+0x00,0x02,0x3e,0x3d,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x36,0x00,
+0x01,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0xc0,0x1b,0x83,0x00,0x80,0x40,
+0x16,0x00,0xc0,0x63,0x83,0x01,0x00,0x01,0x40,0x00,0x80,0x00,0x21,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,
+0x00,0x00,0x00,0x00,0x6f,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x11,0x02,
+0x00,0x00,0x26,0x02,0x00,0x00,0x3d,0x02,0x80,0x40,0x01,0x02,0x01,0x40,0x3e,0x01,
+0x81,0x00,0x01,0x02,0x00,0x40,0x01,0x02,0xc0,0x01,0x83,0x02,0x00,0x00,0xa0,0x02,
+0xbf,0xff,0x83,0x02,0x00,0x40,0xb2,0x02,0x40,0x02,0x19,0x02,0x00,0x80,0x95,0x02,
+0x80,0xc0,0x01,0x02,0x00,0x80,0xa0,0x00,0x40,0x00,0x97,0x02,0x00,0x00,0x05,0x02,
+0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x01,0x78,0x00,0x00,0x00,0x00,0x00,
+0x00,0x03,0x00,0x01,0x25,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x02,0x3c,0x3c,0x00,
+0x00,0x00,0x00,0x85,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x16,0x02,0x00,
+0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,0x01,0x80,0x00,0xa0,0x02,0x00,
+0x40,0x15,0x01,0x80,0x40,0xb2,0x01,0xc0,0x02,0x99,0x01,0x80,0x40,0x01,0x02,0x40,
+0x00,0x83,0x01,0x80,0x00,0xa0,0x02,0x00,0x01,0x11,0x01,0x80,0x40,0xb2,0x01,0xc0,
+0x03,0x99,0x01,0x81,0x40,0x15,0x02,0x00,0x40,0x01,0x02,0xc0,0x01,0x03,0x02,0x00,
+0x00,0xa0,0x01,0x80,0xc0,0xac,0x01,0x81,0x40,0x16,0x00,0x40,0x00,0x97,0x01,0x80,
+0x00,0x05,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x02,
+0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x53,0x74,0x72,0x69,0x6e,0x67,
+0x00,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x85,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
+0x00,0x00,0x16,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,0x01,
+0x80,0x00,0xa0,0x02,0x00,0x40,0x15,0x01,0x80,0x40,0xb2,0x01,0xc0,0x02,0x99,0x01,
+0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x00,0xa0,0x02,0x00,0x01,0x11,0x01,
+0x80,0x40,0xb2,0x01,0xc0,0x03,0x99,0x01,0x81,0x80,0x15,0x02,0x00,0x40,0x01,0x02,
+0xc0,0x01,0x03,0x02,0x00,0x00,0xa0,0x01,0x80,0xc0,0xac,0x01,0x81,0x80,0x16,0x00,
+0x40,0x00,0x97,0x01,0x80,0x00,0x05,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x53,
+0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x01,0x2b,0x00,0x44,0x42,0x47,0x00,0x00,0x00,
+0x04,0x01,0x00,0x01,0x00,0x3e,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,
+0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x6f,
+0x62,0x6a,0x65,0x63,0x74,0x73,0x70,0x61,0x63,0x65,0x2f,0x74,0x65,0x73,0x74,0x2f,
+0x74,0x72,0x61,0x63,0x65,0x5f,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+0x73,0x2e,0x72,0x62,0x00,0x00,0x00,0x33,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x11,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x16,0x00,
+0x16,0x00,0x16,0x00,0x16,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x33,0x00,
+0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x00,0x00,0x79,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x00,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x04,
+0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x0a,0x00,0x0a,
+0x00,0x0c,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,
+0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x10,0x00,0x10,
+0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x11,0x00,0x11,0x00,0x11,
+0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x12,0x00,0x12,0x00,0x12,
+0x00,0x12,0x00,0x12,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,
+0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+0x00,0x00,0x05,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x07,0x00,
+0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x35,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,
+0x4b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0x00,0x00,0x17,
+0x00,0x17,0x00,0x18,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x1c,0x00,0x1c,0x00,0x1c,
+0x00,0x1d,0x00,0x1d,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x20,0x00,0x20,
+0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,
+0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,
+0x1a,0x00,0x1a,0x00,0x1a,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x00,0x00,0x2b,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x1f,0x00,
+0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x00,0x00,0x43,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,
+0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2b,0x00,0x2b,
+0x00,0x2d,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,
+0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x1d,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x28,0x00,0x28,0x00,
+0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x28,0x00,0x28,0x00,0x00,0x00,0x3d,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x00,0x00,0x2e,0x00,
+0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,
+0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,
+0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x00,0x00,0x19,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x30,0x00,0x30,0x00,0x30,
+0x00,0x30,0x00,0x00,0x00,0x5f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x27,0x00,0x00,0x34,0x00,0x34,0x00,0x35,0x00,0x36,0x00,0x37,0x00,0x37,0x00,
+0x37,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,
+0x3c,0x00,0x3c,0x00,0x3e,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x40,0x00,0x41,0x00,
+0x41,0x00,0x41,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x43,0x00,
+0x43,0x00,0x43,0x00,0x43,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,
+0x44,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x06,0x00,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x00,
+0x00,0x33,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,
+0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,
+0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,
+0x38,0x00,0x00,0x00,0x3d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x16,0x00,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,
+0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,
+0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x00,
+0x00,0x3d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x00,0x00,
+0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,
+0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,
+0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x45,0x4e,0x44,0x00,0x00,
+0x00,0x00,0x08,
+};
+#include <stdint.h>
+const uint8_t gem_test_irep_mruby_objectspace_3[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x32,0x5f,0xa0,0x00,0x00,0x0a,0xb5,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x07,0x9c,0x30,0x30,
+0x30,0x30,0x00,0x00,0x00,0xe3,0x00,0x01,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x10,
+0x00,0x80,0x00,0x48,0x01,0x00,0x00,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x06,
+0x01,0x00,0x00,0x3d,0x01,0x80,0x03,0x40,0x00,0x80,0x40,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x00,0xbd,0x01,0x80,0x05,0x40,0x00,0x80,0x40,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x01,0x3d,0x01,0x80,0x07,0x40,0x00,0x80,0x40,0xa1,0x00,0x00,0x00,0x4a,
+0x00,0x00,0x00,0x03,0x00,0x00,0x14,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,
+0x63,0x65,0x3a,0x3a,0x57,0x65,0x61,0x6b,0x4d,0x61,0x70,0x00,0x00,0x2c,0x4f,0x62,
+0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x3a,0x3a,0x57,0x65,0x61,0x6b,0x4d,
+0x61,0x70,0x20,0x64,0x72,0x6f,0x70,0x73,0x20,0x63,0x6f,0x6c,0x6c,0x65,0x63,0x74,
+0x65,0x64,0x20,0x65,0x6e,0x74,0x72,0x69,0x65,0x73,0x00,0x00,0x25,0x4f,0x62,0x6a,
+0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x3a,0x3a,0x57,0x65,0x61,0x6b,0x4d,0x61,
+0x70,0x20,0x61,0x66,0x74,0x65,0x72,0x20,0x47,0x43,0x2e,0x63,0x6f,0x6d,0x70,0x61,
+0x63,0x74,0x00,0x00,0x00,0x02,0x00,0x13,0x77,0x65,0x61,0x6b,0x6d,0x61,0x70,0x5f,
+0x61,0x64,0x64,0x5f,0x67,0x61,0x72,0x62,0x61,0x67,0x65,0x00,0x00,0x06,0x61,0x73,
+0x73,0x65,0x72,0x74,0x00,0x00,0x00,0x00,0x32,0x00,0x04,0x00,0x06,0x00,0x01,0x00,
+0x00,0x00,0x05,0x04,0x00,0x00,0x26,0x02,0x00,0x80,0x01,0x02,0x80,0x01,0x40,0x02,
+0x00,0x00,0x21,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x00,0x00,0x53,0x00,0x03,0x00,0x08,0x00,
+0x00,0x00,0x00,0x00,0x0b,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x3d,0x02,0x00,0x40,
+0x01,0x01,0x81,0x00,0x3e,0x02,0x00,0x40,0x15,0x02,0x80,0x01,0x3d,0x03,0x00,0x40,
+0x01,0x02,0x81,0x80,0x3e,0x03,0x00,0xc0,0x01,0x02,0x00,0x01,0x20,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x03,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x00,0x00,0x01,0x6b,
+0x00,0x00,0x00,0x01,0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,0x00,0x02,0x44,0x00,0x04,
+0x00,0x0b,0x00,0x02,0x00,0x00,0x00,0x5b,0x02,0x00,0x00,0x91,0x02,0x00,0x00,0x13,
+0x02,0x00,0x80,0x20,0x00,0x81,0x00,0x01,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,
+0x02,0x00,0x00,0x06,0x02,0x80,0xc0,0x01,0x03,0x00,0xc0,0x01,0x03,0x80,0x40,0x01,
+0x04,0x00,0x80,0x01,0x04,0x81,0x80,0x01,0x03,0x81,0x01,0x20,0x02,0x00,0xc1,0x20,
+0x02,0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x02,0x81,0x80,0xa0,
+0x03,0x00,0xc0,0x01,0x02,0x81,0xc0,0xa0,0x02,0x01,0x40,0xa0,0x02,0x00,0x00,0x06,
+0x02,0x80,0x40,0x01,0x03,0x00,0x00,0x3d,0x02,0x81,0x80,0xa0,0x02,0x02,0x00,0xa0,
+0x02,0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x02,0x82,0x40,0xa0,
+0x02,0x01,0x40,0xa0,0x02,0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x03,0x00,0x00,0x3d,
+0x02,0x82,0xc0,0xa0,0x02,0x02,0x80,0xa0,0x02,0x00,0x06,0x04,0x02,0x80,0x40,0x01,
+0x03,0x40,0x00,0x03,0x03,0x81,0x00,0x01,0x02,0x81,0x01,0x20,0x02,0x00,0x00,0x06,
+0x02,0x80,0x06,0x04,0x03,0x00,0x40,0x01,0x03,0xc0,0x00,0x03,0x03,0x01,0x80,0xa0,
+0x02,0x00,0xc1,0x20,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x83,0x03,0x00,0x40,0x01,
+0x03,0x03,0x40,0x20,0x02,0x00,0xc1,0x20,0x02,0x00,0x00,0x06,0x02,0x80,0x80,0x01,
+0x03,0x00,0xc0,0x01,0x02,0x81,0x41,0x37,0x03,0x40,0x00,0x03,0x03,0x80,0x06,0x04,
+0x03,0x01,0x81,0x37,0x02,0x81,0x41,0x37,0x03,0x00,0x01,0x40,0x02,0x83,0x80,0x21,
+0x03,0x00,0x40,0x01,0x03,0x03,0xc0,0x20,0x03,0x80,0x03,0x40,0x03,0x03,0x80,0x21,
+0x02,0x00,0xc1,0x20,0x02,0x00,0x00,0x06,0x02,0x80,0xc0,0x01,0x03,0x00,0x40,0x01,
+0x03,0x80,0x80,0x01,0x03,0x04,0x00,0xa0,0x02,0x00,0xc1,0x20,0x02,0x00,0x00,0x06,
+0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x02,0x84,0x00,0xa0,0x02,0x02,0x00,0xa0,
+0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x03,0x02,0x81,0x40,0xb7,0x03,0x00,0x40,0x01,
+0x03,0x04,0x40,0x20,0x02,0x00,0xc1,0x20,0x02,0x00,0x00,0x06,0x02,0x80,0x06,0x04,
+0x02,0x81,0x40,0xb7,0x03,0x00,0x40,0x01,0x03,0x04,0x80,0x20,0x02,0x00,0xc1,0x20,
+0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x03,0x6b,0x65,0x79,0x00,0x00,
+0x05,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x00,0x13,0x00,0x07,0x57,0x65,0x61,0x6b,
+0x4d,0x61,0x70,0x00,0x00,0x0b,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,
+0x65,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,0x0b,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x02,0x5b,0x5d,0x00,
+0x00,0x06,0x65,0x71,0x75,0x61,0x6c,0x3f,0x00,0x00,0x0a,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x6e,0x69,0x6c,0x00,0x00,0x04,0x6b,0x65,0x79,0x3f,0x00,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,0x00,0x08,0x69,0x6e,
+0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x03,0x6f,0x6e,0x65,0x00,0x00,0x04,0x73,
+0x69,0x7a,0x65,0x00,0x00,0x07,0x73,0x6f,0x72,0x74,0x5f,0x62,0x79,0x00,0x00,0x04,
+0x74,0x6f,0x5f,0x61,0x00,0x00,0x06,0x64,0x65,0x6c,0x65,0x74,0x65,0x00,0x00,0x04,
+0x6b,0x65,0x79,0x73,0x00,0x00,0x06,0x76,0x61,0x6c,0x75,0x65,0x73,0x00,0x00,0x00,
+0x00,0x2d,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,
+0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x00,0x00,0x2d,0x00,
+0x03,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,
+0x01,0x01,0x80,0x00,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x00,0x01,0xad,0x00,0x04,0x00,0x09,
+0x00,0x00,0x00,0x00,0x00,0x44,0x02,0x00,0x00,0x91,0x02,0x00,0x00,0x13,0x02,0x00,
+0x80,0x20,0x00,0x81,0x00,0x01,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,
+0xc0,0x01,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x03,0x81,0x00,0x01,0x02,0x80,
+0xc1,0x20,0x02,0x00,0xc0,0x01,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x03,0x01,
+0x00,0x20,0x03,0x81,0x00,0x01,0x02,0x80,0xc1,0x20,0x02,0x00,0xc0,0x01,0x02,0x01,
+0x00,0x20,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x03,0x81,0x00,0x01,0x02,0x80,
+0xc1,0x20,0x02,0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x03,0x40,0x31,0x83,0x02,0x01,
+0x41,0x20,0x02,0x00,0x00,0x06,0x02,0xc0,0x32,0x83,0x03,0x00,0x40,0x01,0x03,0x01,
+0xc0,0x20,0x02,0x01,0x81,0x20,0x02,0x00,0x04,0x11,0x02,0x02,0x40,0x20,0x02,0x00,
+0x00,0x06,0x02,0xbf,0xff,0x83,0x03,0x00,0x40,0x01,0x03,0x01,0xc0,0x20,0x02,0x01,
+0x81,0x20,0x02,0x00,0xc0,0x01,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x03,0x81,
+0x00,0x01,0x02,0x80,0xc1,0x20,0x02,0x00,0xc0,0x01,0x02,0x80,0x40,0x01,0x03,0x40,
+0x00,0x03,0x03,0x81,0x00,0x01,0x02,0x80,0xc1,0x20,0x02,0x00,0x00,0x06,0x02,0x80,
+0x40,0x01,0x03,0x40,0x31,0x83,0x02,0x01,0x41,0x20,0x02,0x00,0x04,0x11,0x02,0x02,
+0x40,0x20,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x83,0x03,0x00,0x40,0x01,0x03,0x01,
+0xc0,0x20,0x02,0x01,0x81,0x20,0x02,0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x03,0x00,
+0x80,0x01,0x02,0x82,0xc0,0xa0,0x03,0x00,0xc0,0x01,0x02,0x83,0x00,0xa0,0x02,0x02,
+0x80,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x01,0x6b,0x00,0x00,
+0x01,0x76,0x00,0x00,0x00,0x0d,0x00,0x07,0x57,0x65,0x61,0x6b,0x4d,0x61,0x70,0x00,
+0x00,0x0b,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,0x63,0x65,0x00,0x00,0x03,
+0x6e,0x65,0x77,0x00,0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,0x03,0x64,0x75,0x70,0x00,
+0x00,0x13,0x77,0x65,0x61,0x6b,0x6d,0x61,0x70,0x5f,0x61,0x64,0x64,0x5f,0x67,0x61,
+0x72,0x62,0x61,0x67,0x65,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x02,0x47,0x43,
+0x00,0x00,0x05,0x73,0x74,0x61,0x72,0x74,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x06,0x65,0x71,
+0x75,0x61,0x6c,0x3f,0x00,0x00,0x00,0x00,0xe8,0x00,0x03,0x00,0x07,0x00,0x03,0x00,
+0x00,0x00,0x18,0x01,0x80,0x00,0x91,0x01,0x80,0x00,0x13,0x01,0x80,0x80,0x20,0x00,
+0x80,0xc0,0x01,0x01,0x00,0xc0,0x37,0x01,0xfa,0x97,0x83,0x02,0x00,0x01,0x40,0x01,
+0x80,0xc0,0x21,0x01,0x80,0x80,0x01,0x02,0x00,0x03,0x40,0x01,0x81,0x00,0x21,0x01,
+0x80,0x02,0x91,0x01,0x81,0x80,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x95,0x83,0x02,
+0x80,0x40,0x01,0x02,0x82,0x00,0x20,0x01,0x81,0xc1,0x20,0x01,0x80,0x00,0x06,0x02,
+0x00,0x80,0x01,0x02,0x80,0x05,0x40,0x02,0x02,0x80,0x21,0x01,0x82,0x40,0xa0,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x07,0x57,0x65,0x61,
+0x6b,0x4d,0x61,0x70,0x00,0x00,0x0b,0x4f,0x62,0x6a,0x65,0x63,0x74,0x53,0x70,0x61,
+0x63,0x65,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,
+0x00,0x00,0x0f,0x65,0x61,0x63,0x68,0x5f,0x77,0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,
+0x65,0x78,0x00,0x00,0x02,0x47,0x43,0x00,0x00,0x07,0x63,0x6f,0x6d,0x70,0x61,0x63,
+0x74,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x04,0x61,0x6c,0x6c,0x3f,0x00,0x00,0x00,0x00,
+0x71,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x11,0x02,0x00,0x00,0x26,0x02,
+0x00,0x00,0x3d,0x02,0x80,0x40,0x01,0x02,0x01,0x40,0x3e,0x01,0x81,0x00,0x01,0x02,
+0x00,0x40,0x01,0x02,0xc0,0x31,0x83,0x02,0x00,0x00,0xa0,0x02,0xbf,0xff,0x83,0x02,
+0x00,0x40,0xb2,0x02,0x40,0x02,0x19,0x02,0x00,0x80,0x15,0x02,0x80,0xc0,0x01,0x02,
+0x00,0x80,0xa0,0x00,0x40,0x00,0x97,0x02,0x00,0x00,0x05,0x02,0x00,0x00,0x29,0x00,
+0x00,0x00,0x02,0x00,0x00,0x03,0x6b,0x65,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x01,0x25,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,
+0x00,0x38,0x00,0x04,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,
+0x02,0x00,0x80,0x01,0x02,0x80,0x40,0x15,0x03,0x00,0x40,0x01,0x03,0x81,0x00,0x01,
+0x02,0x80,0x01,0x20,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,0x00,0x00,0x4c,0x00,0x03,0x00,0x07,0x00,0x00,
+0x00,0x00,0x00,0x09,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,
+0x01,0x80,0x00,0xa0,0x02,0x00,0x80,0x15,0x02,0x80,0x40,0x01,0x02,0x00,0x80,0xa0,
+0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x69,0x6e,0x64,0x65,
+0x78,0x00,0x44,0x42,0x47,0x00,0x00,0x00,0x02,0xfb,0x00,0x01,0x00,0x34,0x2f,0x72,
+0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,
+0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x6f,0x62,0x6a,0x65,0x63,0x74,0x73,0x70,0x61,
+0x63,0x65,0x2f,0x74,0x65,0x73,0x74,0x2f,0x77,0x65,0x61,0x6b,0x6d,0x61,0x70,0x2e,
+0x72,0x62,0x00,0x00,0x00,0x31,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x10,0x00,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+0x05,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,
+0x2b,0x00,0x2b,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x05,0x00,0x00,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,
+0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,
+0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+0x02,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0xc7,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x5b,0x00,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x07,
+0x00,0x08,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,
+0x00,0x09,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,
+0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0e,
+0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,
+0x00,0x0f,0x00,0x0f,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x11,
+0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,
+0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x12,0x00,0x12,
+0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,
+0x00,0x13,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x15,
+0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x00,0x00,0x19,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x11,0x00,
+0x11,0x00,0x11,0x00,0x11,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x00,
+0x00,0x99,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x00,0x00,
+0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x1a,0x00,0x1b,0x00,0x1c,0x00,0x1c,0x00,
+0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,
+0x1d,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1f,0x00,
+0x1f,0x00,0x1f,0x00,0x1f,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
+0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,
+0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
+0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x00,
+0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,
+0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x00,0x00,0x41,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,
+0x00,0x2d,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x30,
+0x00,0x30,0x00,0x31,0x00,0x31,0x00,0x31,0x00,0x31,0x00,0x31,0x00,0x32,0x00,0x32,
+0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x00,0x00,0x33,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,
+0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,
+0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x00,0x00,0x1f,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x2f,0x00,0x2f,
+0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x00,0x00,0x23,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x32,0x00,0x32,0x00,
+0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x45,0x4e,0x44,
+0x00,0x00,0x00,0x00,0x08,
+};
+void mrb_mruby_objectspace_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_objectspace_gem_test(mrb_state *mrb) {
+  mrb_state *mrb2;
+  mrb_value val1, val2, val3, ary1, ary2;
+  int ai;
+  ai = mrb_gc_arena_save(mrb);
+  mrb2 = mrb_open();
+  val3 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$mrbtest_verbose"));
+  if (mrb_test(val3)) {
+    mrb_gv_set(mrb2, mrb_intern_lit(mrb2, "$mrbtest_verbose"), val3);
+  }
+  mrb_load_irep(mrb2, mrbtest_assert_irep);
+  if (mrb2->exc) {
+    mrb_p(mrb2, mrb_obj_value(mrb2->exc));
+    exit(EXIT_FAILURE);
+  }
+  mrb_const_set(mrb2, mrb_obj_value(mrb2->object_class), mrb_intern_lit(mrb2, "GEMNAME"), mrb_str_new(mrb2, "mruby-objectspace", 17));
+  mrb_mruby_objectspace_gem_test(mrb2);
+  mrb_load_irep(mrb2, gem_test_irep_mruby_objectspace_0);
+  if (mrb2->exc) {
+    mrb_p(mrb2, mrb_obj_value(mrb2->exc));
+    exit(EXIT_FAILURE);
+  }
+  
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$ok_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$ok_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$ok_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$ko_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$ko_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$ko_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$kill_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$kill_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$kill_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  ary2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$asserts"));
+  if (mrb_test(ary2)) {
+    ary1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$asserts"));
+    val2 = mrb_ary_shift(mrb2, ary2);
+    
+    while (mrb_test(val2)) {
+      mrb_ary_push(mrb, ary1, mrb_str_new(mrb, RSTRING_PTR(val2), RSTRING_LEN(val2)));
+      val2 = mrb_ary_shift(mrb2, ary2);
+    }
+  }
+  mrb_close(mrb2);
+  mrb_gc_arena_restore(mrb, ai);
+  ai = mrb_gc_arena_save(mrb);
+  mrb2 = mrb_open();
+  val3 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$mrbtest_verbose"));
+  if (mrb_test(val3)) {
+    mrb_gv_set(mrb2, mrb_intern_lit(mrb2, "$mrbtest_verbose"), val3);
+  }
+  mrb_load_irep(mrb2, mrbtest_assert_irep);
+  if (mrb2->exc) {
+    mrb_p(mrb2, mrb_obj_value(mrb2->exc));
+    exit(EXIT_FAILURE);
+  }
+  mrb_const_set(mrb2, mrb_obj_value(mrb2->object_class), mrb_intern_lit(mrb2, "GEMNAME"), mrb_str_new(mrb2, "mruby-objectspace", 17));
+  mrb_mruby_objectspace_gem_test(mrb2);
+  mrb_load_irep(mrb2, gem_test_irep_mruby_objectspace_1);
+  if (mrb2->exc) {
+    mrb_p(mrb2, mrb_obj_value(mrb2->exc));
+    exit(EXIT_FAILURE);
+  }
+  
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$ok_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$ok_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$ok_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$ko_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$ko_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$ko_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$kill_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$kill_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$kill_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  ary2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$asserts"));
+  if (mrb_test(ary2)) {
+    ary1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$asserts"));
+    val2 = mrb_ary_shift(mrb2, ary2);
+    
+    while (mrb_test(val2)) {
+      mrb_ary_push(mrb, ary1, mrb_str_new(mrb, RSTRING_PTR(val2), RSTRING_LEN(val2)));
+      val2 = mrb_ary_shift(mrb2, ary2);
+    }
+  }
+  mrb_close(mrb2);
+  mrb_gc_arena_restore(mrb, ai);
+  ai = mrb_gc_arena_save(mrb);
+  mrb2 = mrb_open();
+  val3 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$mrbtest_verbose"));
+  if (mrb_test(val3)) {
+    mrb_gv_set(mrb2, mrb_intern_lit(mrb2, "$mrbtest_verbose"), val3);
+  }
+  mrb_load_irep(mrb2, mrbtest_assert_irep);
+  if (mrb2->exc) {
+    mrb_p(mrb2, mrb_obj_value(mrb2->exc));
+    exit(EXIT_FAILURE);
+  }
+  mrb_const_set(mrb2, mrb_obj_value(mrb2->object_class), mrb_intern_lit(mrb2, "GEMNAME"), mrb_str_new(mrb2, "mruby-objectspace", 17));
+  mrb_mruby_objectspace_gem_test(mrb2);
+  mrb_load_irep(mrb2, gem_test_irep_mruby_objectspace_2);
+  if (mrb2->exc) {
+    mrb_p(mrb2, mrb_obj_value(mrb2->exc));
+    exit(EXIT_FAILURE);
+  }
+  
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$ok_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$ok_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$ok_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$ko_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$ko_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$ko_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$kill_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$kill_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$kill_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  ary2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$asserts"));
+  if (mrb_test(ary2)) {
+    ary1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$asserts"));
+    val2 = mrb_ary_shift(mrb2, ary2);
+    
+    while (mrb_test(val2)) {
+      mrb_ary_push(mrb, ary1, mrb_str_new(mrb, RSTRING_PTR(val2), RSTRING_LEN(val2)));
+      val2 = mrb_ary_shift(mrb2, ary2);
+    }
+  }
+  mrb_close(mrb2);
+  mrb_gc_arena_restore(mrb, ai);
+  ai = mrb_gc_arena_save(mrb);
+  mrb2 = mrb_open();
+  val3 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$mrbtest_verbose"));
+  if (mrb_test(val3)) {
+    mrb_gv_set(mrb2, mrb_intern_lit(mrb2, "$mrbtest_verbose"), val3);
+  }
+  mrb_load_irep(mrb2, mrbtest_assert_irep);
+  if (mrb2->exc) {
+    mrb_p(mrb2, mrb_obj_value(mrb2->exc));
+    exit(EXIT_FAILURE);
+  }
+  mrb_const_set(mrb2, mrb_obj_value(mrb2->object_class), mrb_intern_lit(mrb2, "GEMNAME"), mrb_str_new(mrb2, "mruby-objectspace", 17));
+  mrb_mruby_objectspace_gem_test(mrb2);
+  mrb_load_irep(mrb2, gem_test_irep_mruby_objectspace_3);
+  if (mrb2->exc) {
+    mrb_p(mrb2, mrb_obj_value(mrb2->exc));
+    exit(EXIT_FAILURE);
+  }
+  
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$ok_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$ok_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$ok_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$ko_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$ko_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$ko_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$kill_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$kill_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$kill_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  ary2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$asserts"));
+  if (mrb_test(ary2)) {
+    ary1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$asserts"));
+    val2 = mrb_ary_shift(mrb2, ary2);
+    
+    while (mrb_test(val2)) {
+      mrb_ary_push(mrb, ary1, mrb_str_new(mrb, RSTRING_PTR(val2), RSTRING_LEN(val2)));
+      val2 = mrb_ary_shift(mrb2, ary2);
+    }
+  }
+  mrb_close(mrb2);
+  mrb_gc_arena_restore(mrb, ai);
+}
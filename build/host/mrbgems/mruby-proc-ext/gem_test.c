@@ -0,0 +1,333 @@
+/*
+ * This file is loading the irep
+ * Ruby GEM code.
+ *
+ * IMPORTANT:
+ *   This file was generated!
+ *   All manual changes will get lost.
+ */
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/array.h"
+#include "mruby/irep.h"
+#include "mruby/string.h"
+#include "mruby/variable.h"
+/*
+ * This file contains a test code for mruby-proc-ext gem.
+ *
+ * IMPORTANT:
+ *   This file was generated!
+ *   All manual changes will get lost.
+ */
+extern const uint8_t mrbtest_assert_irep[];
+#include <stdint.h>
+const uint8_t gem_test_irep_mruby_proc_ext_0[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x32,0xc7,0x9f,0x00,0x00,0x0f,0xf8,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x0b,0x1b,0x30,0x30,
+0x30,0x30,0x00,0x00,0x01,0x6c,0x00,0x01,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x29,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x01,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0xbd,0x01,0x80,0x03,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x3d,0x01,0x80,0x05,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x01,0xbd,0x01,0x80,0x07,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x02,0x3d,0x01,0x80,0x09,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x02,0xbd,0x01,0x80,0x0b,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x03,0x3d,0x01,0x80,0x0d,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x03,0xbd,0x01,0x80,0x0f,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x04,0x3d,0x01,0x80,0x11,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x04,0xbd,0x01,0x80,0x13,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x0a,0x00,0x00,0x14,0x50,0x72,0x6f,0x63,0x23,
+0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x00,
+0x00,0x0c,0x50,0x72,0x6f,0x63,0x23,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,0x00,0x00,
+0x0c,0x50,0x72,0x6f,0x63,0x23,0x6c,0x61,0x6d,0x62,0x64,0x61,0x3f,0x00,0x00,0x08,
+0x50,0x72,0x6f,0x63,0x23,0x3d,0x3d,0x3d,0x00,0x00,0x0a,0x50,0x72,0x6f,0x63,0x23,
+0x79,0x69,0x65,0x6c,0x64,0x00,0x00,0x0a,0x50,0x72,0x6f,0x63,0x23,0x63,0x75,0x72,
+0x72,0x79,0x00,0x00,0x0c,0x50,0x72,0x6f,0x63,0x23,0x74,0x6f,0x5f,0x70,0x72,0x6f,
+0x63,0x00,0x00,0x0b,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x70,0x72,0x6f,0x63,0x00,
+0x00,0x1b,0x6d,0x72,0x62,0x5f,0x70,0x72,0x6f,0x63,0x5f,0x6e,0x65,0x77,0x5f,0x63,
+0x66,0x75,0x6e,0x63,0x5f,0x77,0x69,0x74,0x68,0x5f,0x65,0x6e,0x76,0x00,0x00,0x11,
+0x6d,0x72,0x62,0x5f,0x63,0x66,0x75,0x6e,0x63,0x5f,0x65,0x6e,0x76,0x5f,0x67,0x65,
+0x74,0x00,0x00,0x00,0x01,0x00,0x06,0x61,0x73,0x73,0x65,0x72,0x74,0x00,0x00,0x00,
+0x00,0xbe,0x00,0x02,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x19,0x01,0x00,0x00,0x11,
+0x01,0x80,0x01,0x40,0x01,0x00,0x40,0x21,0x01,0x00,0x80,0x20,0x00,0x80,0x80,0x01,
+0x01,0x00,0xc0,0x20,0x01,0x40,0x01,0x19,0x01,0x00,0x00,0x07,0x01,0x00,0x00,0x29,
+0x01,0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,0x3f,0xff,0x83,0x01,0x81,0x40,0xa0,
+0x02,0x3f,0xfc,0x03,0x02,0xc0,0x03,0x03,0x01,0x81,0x41,0x20,0x02,0x00,0x00,0x3d,
+0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,
+0x01,0x81,0x40,0xa0,0x02,0x40,0x02,0x03,0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x01,0x00,0x00,0x07,0x70,0x72,0x6f,0x63,0x2e,0x72,0x62,0x00,0x00,
+0x00,0x06,0x00,0x04,0x50,0x72,0x6f,0x63,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x0f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+0x00,0x00,0x04,0x6e,0x69,0x6c,0x3f,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x00,0x00,0x1e,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x05,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7b,0x00,0x02,
+0x00,0x06,0x00,0x01,0x00,0x00,0x00,0x0b,0x01,0x00,0x00,0x11,0x01,0x80,0x01,0x40,
+0x01,0x00,0x40,0x21,0x01,0x00,0x80,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,
+0x01,0x80,0x40,0x01,0x02,0x00,0x02,0x91,0x01,0x81,0x00,0xa0,0x01,0x00,0xc0,0xa0,
+0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x04,0x50,0x72,
+0x6f,0x63,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,
+0x63,0x74,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,
+0x00,0x00,0x08,0x6b,0x69,0x6e,0x64,0x5f,0x6f,0x66,0x3f,0x00,0x00,0x06,0x53,0x74,
+0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x01,0x00,0x04,0x00,0x02,0x00,0x00,0x00,
+0x0e,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x40,0x01,0x00,0x40,
+0x21,0x01,0x00,0x80,0x20,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x01,
+0x91,0x01,0x80,0x03,0x40,0x01,0x01,0x00,0x21,0x01,0x00,0x80,0x20,0x01,0x01,0x40,
+0x20,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x06,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,
+0x06,0x6c,0x61,0x6d,0x62,0x64,0x61,0x00,0x00,0x07,0x6c,0x61,0x6d,0x62,0x64,0x61,
+0x3f,0x00,0x00,0x04,0x50,0x72,0x6f,0x63,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x01,0x21,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x80,0x00,0x05,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x64,0x00,0x02,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x0b,0x01,0x00,0x00,
+0x11,0x01,0x80,0x01,0x40,0x01,0x00,0x40,0x21,0x00,0x80,0x80,0x01,0x01,0x00,0x00,
+0x06,0x01,0xc0,0x09,0x83,0x02,0x00,0x40,0x01,0x02,0xc0,0x04,0x83,0x02,0x00,0xc0,
+0xa0,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x04,0x00,0x04,0x50,0x72,0x6f,0x63,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x03,0x3d,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x2e,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,
+0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x00,
+0xb0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2a,
+0x00,0x00,0x00,0x00,0x66,0x00,0x02,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x0b,0x01,
+0x00,0x00,0x11,0x01,0x80,0x01,0x40,0x01,0x00,0x40,0x21,0x00,0x80,0x80,0x01,0x01,
+0x00,0x00,0x06,0x01,0xc0,0x09,0x83,0x02,0x00,0x40,0x01,0x02,0xc0,0x04,0x83,0x02,
+0x00,0xc0,0xa0,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x04,0x50,0x72,0x6f,0x63,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,
+0x05,0x79,0x69,0x65,0x6c,0x64,0x00,0x00,0x00,0x00,0x2e,0x00,0x03,0x00,0x06,0x00,
+0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,
+0x83,0x01,0x80,0x00,0xb0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x01,0x2a,0x00,0x00,0x00,0x01,0xd1,0x00,0x02,0x00,0x08,0x00,0x05,0x00,
+0x00,0x00,0x5c,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x40,0x01,0x00,0x00,0x21,0x00,
+0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,0xc0,0x02,0x83,0x02,0x00,0x40,0x01,0x02,
+0x00,0x80,0x20,0x02,0xc0,0x00,0x03,0x02,0x00,0xc0,0xa0,0x02,0xc0,0x00,0x83,0x02,
+0x00,0xc0,0xa0,0x02,0xc0,0x01,0x03,0x02,0x00,0xc0,0xa0,0x01,0x00,0x41,0x20,0x01,
+0x00,0x00,0x06,0x01,0xc0,0x02,0x83,0x02,0x00,0x40,0x01,0x02,0x00,0x80,0x20,0x02,
+0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x02,0x00,0xc1,0x20,0x02,0xc0,0x01,0x03,0x03,
+0x40,0x01,0x83,0x02,0x00,0xc1,0x20,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x06,0x01,
+0xc0,0x02,0x83,0x02,0x00,0x40,0x01,0x02,0xc0,0x02,0x03,0x02,0x00,0x80,0xa0,0x02,
+0xc0,0x00,0x03,0x02,0x00,0xc0,0xa0,0x02,0xc0,0x00,0x83,0x02,0x00,0xc0,0xa0,0x02,
+0xc0,0x01,0x03,0x02,0x00,0xc0,0xa0,0x02,0xc0,0x01,0x83,0x02,0x00,0xc0,0xa0,0x02,
+0xc0,0x02,0x03,0x02,0x00,0xc0,0xa0,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x06,0x01,
+0xc0,0x02,0x83,0x02,0x00,0x40,0x01,0x02,0xc0,0x02,0x03,0x02,0x00,0x80,0xa0,0x02,
+0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x02,0x00,0xc1,0x20,0x02,0xc0,0x01,0x03,0x03,
+0x40,0x01,0x83,0x02,0x00,0xc1,0x20,0x02,0xc0,0x02,0x03,0x02,0x00,0xc0,0xa0,0x01,
+0x00,0x41,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x40,0x01,0x02,
+0xc0,0x00,0x03,0x02,0x00,0x80,0xa0,0x02,0xc0,0x00,0x03,0x02,0x00,0xc0,0xa0,0x01,
+0x00,0x41,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x03,0x40,0x01,0x01,0x00,0x21,0x00,
+0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,0xc0,0x02,0x83,0x02,0x00,0x40,0x01,0x02,
+0x00,0x80,0x20,0x02,0xc0,0x00,0x03,0x02,0x00,0xc0,0xa0,0x02,0xc0,0x00,0x83,0x02,
+0x00,0xc0,0xa0,0x02,0xc0,0x01,0x03,0x02,0x00,0xc0,0xa0,0x01,0x00,0x41,0x20,0x01,
+0x00,0x00,0x06,0x01,0x80,0x03,0x11,0x02,0x00,0x05,0x40,0x01,0x01,0x40,0xa1,0x01,
+0x00,0x00,0x06,0x01,0x80,0x03,0x11,0x02,0x00,0x07,0x40,0x01,0x01,0x40,0xa1,0x01,
+0x00,0x00,0x06,0x01,0x80,0x03,0x11,0x02,0x00,0x09,0x40,0x01,0x01,0x40,0xa1,0x01,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x04,0x70,0x72,0x6f,
+0x63,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x05,0x63,0x75,0x72,0x72,0x79,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x06,
+0x6c,0x61,0x6d,0x62,0x64,0x61,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,
+0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x4e,0x00,0x05,0x00,0x08,0x00,0x00,
+0x00,0x00,0x00,0x0d,0x06,0x00,0x00,0x26,0x02,0x80,0x40,0x01,0x02,0xc0,0x00,0x98,
+0x02,0xbf,0xff,0x83,0x03,0x00,0x80,0x01,0x03,0x40,0x00,0x98,0x03,0x3f,0xff,0x83,
+0x02,0x80,0x00,0xac,0x03,0x00,0xc0,0x01,0x03,0x40,0x00,0x98,0x03,0x3f,0xff,0x83,
+0x02,0x80,0x00,0xac,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x4e,0x00,0x05,0x00,0x08,0x00,0x00,0x00,0x00,
+0x00,0x0d,0x06,0x00,0x00,0x26,0x02,0x80,0x40,0x01,0x02,0xc0,0x00,0x98,0x02,0xbf,
+0xff,0x83,0x03,0x00,0x80,0x01,0x03,0x40,0x00,0x98,0x03,0x3f,0xff,0x83,0x02,0x80,
+0x00,0xac,0x03,0x00,0xc0,0x01,0x03,0x40,0x00,0x98,0x03,0x3f,0xff,0x83,0x02,0x80,
+0x00,0xac,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,
+0x2b,0x00,0x00,0x00,0x00,0x47,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x09,
+0x00,0x80,0x40,0x15,0x00,0x80,0x00,0x20,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,
+0x00,0x80,0x41,0x20,0x01,0x40,0x01,0x03,0x01,0xc0,0x01,0x83,0x00,0x80,0x41,0x20,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x63,0x75,
+0x72,0x72,0x79,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x00,0x00,0x2e,0x00,0x01,0x00,
+0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x80,0x40,0x15,0x01,0x40,0x02,0x03,0x00,
+0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x05,0x63,0x75,0x72,0x72,0x79,0x00,0x00,0x00,0x00,0x2e,0x00,0x01,0x00,0x04,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x80,0x40,0x15,0x01,0x40,0x00,0x03,0x00,0x80,0x00,
+0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x63,
+0x75,0x72,0x72,0x79,0x00,0x00,0x00,0x00,0x64,0x00,0x02,0x00,0x06,0x00,0x01,0x00,
+0x00,0x00,0x0a,0x01,0x00,0x00,0x11,0x01,0x80,0x01,0x40,0x01,0x00,0x40,0x21,0x00,
+0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,0x00,0x40,0x01,0x02,
+0x00,0xc0,0x20,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x04,0x50,0x72,0x6f,0x63,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,
+0x07,0x74,0x6f,0x5f,0x70,0x72,0x6f,0x63,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,
+0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x00,0x01,0x00,0x04,0x00,
+0x01,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x06,0x01,0x80,0x01,
+0x40,0x01,0x00,0x40,0x21,0x01,0x00,0x80,0x20,0x01,0x00,0xc0,0x20,0x00,0x80,0x00,
+0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0b,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x04,0x70,0x72,0x6f,
+0x63,0x00,0x00,0x07,0x6c,0x61,0x6d,0x62,0x64,0x61,0x3f,0x00,0x00,0x01,0x21,0x00,
+0x00,0x00,0x00,0x22,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x03,0x02,0x00,
+0x00,0x26,0x01,0x80,0x00,0x05,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0xb6,0x00,0x02,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x14,
+0x01,0x00,0x00,0x11,0x01,0x80,0x01,0x04,0x01,0x00,0x40,0xa0,0x01,0x00,0x00,0x11,
+0x01,0x80,0x01,0x84,0x01,0x00,0x40,0xa0,0x01,0x00,0x00,0x11,0x01,0x01,0x00,0x20,
+0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x04,0x02,0x00,0x40,0x01,
+0x02,0x00,0x80,0x20,0x01,0x01,0x41,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x84,
+0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,0x01,0x01,0x41,0x20,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x0b,0x50,0x72,0x6f,0x63,0x45,0x78,
+0x74,0x54,0x65,0x73,0x74,0x00,0x00,0x1b,0x6d,0x72,0x62,0x5f,0x70,0x72,0x6f,0x63,
+0x5f,0x6e,0x65,0x77,0x5f,0x63,0x66,0x75,0x6e,0x63,0x5f,0x77,0x69,0x74,0x68,0x5f,
+0x65,0x6e,0x76,0x00,0x00,0x04,0x74,0x65,0x73,0x74,0x00,0x00,0x05,0x6d,0x72,0x75,
+0x62,0x79,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0xf3,0x00,0x02,0x00,0x07,
+0x00,0x03,0x00,0x00,0x00,0x1d,0x01,0x00,0x00,0x11,0x01,0x80,0x01,0x04,0x02,0x3f,
+0xff,0x83,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x02,0x01,0x01,0xb7,0x01,0x00,
+0x41,0x20,0x01,0x00,0x00,0x11,0x01,0x00,0xc0,0x20,0x00,0x80,0x80,0x01,0x01,0x00,
+0x00,0x06,0x01,0x80,0x02,0x91,0x02,0x00,0x01,0x40,0x01,0x01,0x00,0xa1,0x01,0x00,
+0x00,0x06,0x01,0x80,0x03,0x11,0x02,0x00,0x03,0x40,0x01,0x01,0x00,0xa1,0x01,0x00,
+0x00,0x06,0x01,0x80,0x03,0x11,0x02,0x00,0x05,0x40,0x01,0x01,0x00,0xa1,0x01,0x00,
+0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x40,0x01,0x02,0xc0,0x00,0x03,0x02,0x00,
+0x80,0xa0,0x01,0x01,0xc1,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x08,0x00,0x0b,0x50,0x72,0x6f,0x63,0x45,0x78,0x74,0x54,0x65,0x73,0x74,0x00,
+0x00,0x11,0x6d,0x72,0x62,0x5f,0x63,0x66,0x75,0x6e,0x63,0x5f,0x65,0x6e,0x76,0x5f,
+0x67,0x65,0x74,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x69,0x6e,0x74,0x00,0x00,0x03,
+0x6e,0x65,0x77,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,
+0x73,0x65,0x00,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,
+0x0a,0x49,0x6e,0x64,0x65,0x78,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x36,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x40,0x15,0x00,0x80,0x00,
+0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x11,0x63,
+0x66,0x75,0x6e,0x63,0x5f,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x5f,0x65,0x6e,0x76,
+0x00,0x00,0x00,0x00,0x30,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+0x80,0x40,0x15,0x01,0x3f,0xff,0x03,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x07,0x67,0x65,0x74,0x5f,0x69,0x6e,0x74,
+0x00,0x00,0x00,0x00,0x30,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+0x80,0x40,0x15,0x01,0x40,0x01,0x03,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x07,0x67,0x65,0x74,0x5f,0x69,0x6e,0x74,
+0x00,0x44,0x42,0x47,0x00,0x00,0x00,0x04,0xbf,0x00,0x01,0x00,0x2e,0x2f,0x72,0x6f,
+0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,
+0x6d,0x72,0x75,0x62,0x79,0x2d,0x70,0x72,0x6f,0x63,0x2d,0x65,0x78,0x74,0x2f,0x74,
+0x65,0x73,0x74,0x2f,0x70,0x72,0x6f,0x63,0x2e,0x72,0x62,0x00,0x00,0x00,0x63,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0x04,0x00,0x04,
+0x00,0x04,0x00,0x04,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x10,0x00,0x10,
+0x00,0x10,0x00,0x10,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x1a,0x00,0x1a,
+0x00,0x1a,0x00,0x1a,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x2e,0x00,0x2e,
+0x00,0x2e,0x00,0x2e,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x37,0x00,0x37,
+0x00,0x37,0x00,0x37,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x00,
+0x00,0x43,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x00,
+0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
+0x06,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,
+0x07,0x00,0x07,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,
+0x08,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x00,0x05,0x00,0x05,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,
+0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x0c,
+0x00,0x0c,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x0e,0x00,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,
+0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,
+0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x00,0x11,0x00,0x11,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x00,0x12,0x00,0x12,0x00,0x00,0x00,0x27,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x16,0x00,0x16,0x00,0x16,
+0x00,0x16,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,
+0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,
+0x00,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x00,0x00,0x27,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x1b,0x00,0x1b,
+0x00,0x1b,0x00,0x1b,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,
+0x00,0x1c,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x05,0x00,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x00,0x00,
+0xc9,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x20,
+0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,
+0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,
+0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,
+0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,
+0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,
+0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,
+0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,
+0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x27,
+0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,
+0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x29,0x00,0x29,
+0x00,0x29,0x00,0x29,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2b,0x00,0x2b,
+0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
+0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
+0x20,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,
+0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x00,0x00,0x23,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x29,0x00,
+0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,
+0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,
+0x2b,0x00,0x00,0x00,0x25,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0a,0x00,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x30,0x00,0x30,0x00,0x30,
+0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x2f,0x00,0x2f,0x00,0x00,0x00,0x21,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x34,0x00,0x34,
+0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x00,0x00,0x17,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x34,0x00,
+0x34,0x00,0x34,0x00,0x00,0x00,0x39,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x14,0x00,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x39,0x00,0x39,0x00,0x39,
+0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,
+0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x00,0x00,0x4b,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0x00,0x00,0x42,0x00,
+0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x44,0x00,0x44,0x00,
+0x44,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x48,0x00,0x48,0x00,0x48,0x00,
+0x48,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,
+0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x00,
+0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,
+0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,
+0x45,0x4e,0x44,0x00,0x00,0x00,0x00,0x08,
+};
+void mrb_mruby_proc_ext_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_proc_ext_gem_test(mrb_state *mrb) {
+  mrb_state *mrb2;
+  mrb_value val1, val2, val3, ary1, ary2;
+  int ai;
+  ai = mrb_gc_arena_save(mrb);
+  mrb2 = mrb_open();
+  val3 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$mrbtest_verbose"));
+  if (mrb_test(val3)) {
+    mrb_gv_set(mrb2, mrb_intern_lit(mrb2, "$mrbtest_verbose"), val3);
+  }
+  mrb_load_irep(mrb2, mrbtest_assert_irep);
+  if (mrb2->exc) {
+    mrb_p(mrb2, mrb_obj_value(mrb2->exc));
+    exit(EXIT_FAILURE);
+  }
+  mrb_const_set(mrb2, mrb_obj_value(mrb2->object_class), mrb_intern_lit(mrb2, "GEMNAME"), mrb_str_new(mrb2, "mruby-proc-ext", 14));
+  mrb_mruby_proc_ext_gem_test(mrb2);
+  mrb_load_irep(mrb2, gem_test_irep_mruby_proc_ext_0);
+  if (mrb2->exc) {
+    mrb_p(mrb2, mrb_obj_value(mrb2->exc));
+    exit(EXIT_FAILURE);
+  }
+  
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$ok_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$ok_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$ok_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$ko_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$ko_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$ko_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$kill_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$kill_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$kill_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  ary2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$asserts"));
+  if (mrb_test(ary2)) {
+    ary1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$asserts"));
+    val2 = mrb_ary_shift(mrb2, ary2);
+    
+    while (mrb_test(val2)) {
+      mrb_ary_push(mrb, ary1, mrb_str_new(mrb, RSTRING_PTR(val2), RSTRING_LEN(val2)));
+      val2 = mrb_ary_shift(mrb2, ary2);
+    }
+  }
+  mrb_close(mrb2);
+  mrb_gc_arena_restore(mrb, ai);
+}
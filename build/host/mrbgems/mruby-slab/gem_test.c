@@ -0,0 +1,179 @@
+/*
+ * This file is loading the irep
+ * Ruby GEM code.
+ *
+ * IMPORTANT:
+ *   This file was generated!
+ *   All manual changes will get lost.
+ */
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/array.h"
+#include "mruby/irep.h"
+#include "mruby/string.h"
+#include "mruby/variable.h"
+/*
+ * This file contains a test code for mruby-slab gem.
+ *
+ * IMPORTANT:
+ *   This file was generated!
+ *   All manual changes will get lost.
+ */
+extern const uint8_t mrbtest_assert_irep[];
+#include <stdint.h>
+const uint8_t gem_test_irep_mruby_slab_0[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x32,0x1a,0x04,0x00,0x00,0x06,0x53,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x04,0xe9,0x30,0x30,
+0x30,0x30,0x00,0x00,0x00,0xa0,0x00,0x01,0x00,0x04,0x00,0x03,0x00,0x00,0x00,0x0d,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x01,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0xbd,0x01,0x80,0x03,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x3d,0x01,0x80,0x05,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x03,0x00,0x00,0x13,0x53,0x6c,0x61,0x62,0x41,
+0x6c,0x6c,0x6f,0x63,0x61,0x74,0x6f,0x72,0x2e,0x73,0x74,0x61,0x74,0x73,0x00,0x00,
+0x0f,0x6d,0x72,0x62,0x5f,0x73,0x6c,0x61,0x62,0x5f,0x61,0x6c,0x6c,0x6f,0x63,0x66,
+0x00,0x00,0x22,0x6d,0x72,0x62,0x5f,0x73,0x6c,0x61,0x62,0x5f,0x61,0x6c,0x6c,0x6f,
+0x63,0x66,0x20,0x72,0x65,0x70,0x6f,0x72,0x74,0x73,0x20,0x65,0x78,0x63,0x65,0x70,
+0x74,0x69,0x6f,0x6e,0x73,0x00,0x00,0x00,0x01,0x00,0x06,0x61,0x73,0x73,0x65,0x72,
+0x74,0x00,0x00,0x00,0x00,0x4f,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x05,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x00,0x80,0x20,0x00,0x80,0x00,0xa0,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0a,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x6e,0x69,0x6c,0x00,0x00,0x0d,0x53,0x6c,0x61,0x62,0x41,
+0x6c,0x6c,0x6f,0x63,0x61,0x74,0x6f,0x72,0x00,0x00,0x05,0x73,0x74,0x61,0x74,0x73,
+0x00,0x00,0x00,0x03,0x22,0x00,0x02,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x46,0x01,
+0x00,0x00,0x11,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x01,0x81,0x00,0x3e,0x02,
+0x00,0x01,0x3d,0x01,0x81,0x00,0x3e,0x02,0x00,0x01,0xbd,0x01,0x81,0x00,0x3e,0x02,
+0x00,0x02,0x3d,0x01,0x81,0x00,0x3e,0x02,0x00,0x02,0xbd,0x01,0x81,0x00,0x3e,0x02,
+0x00,0x03,0x3d,0x01,0x81,0x00,0x3e,0x02,0x00,0x03,0xbd,0x01,0x81,0x00,0x3e,0x02,
+0x00,0x04,0x3d,0x01,0x81,0x00,0x3e,0x02,0x00,0x04,0xbd,0x01,0x81,0x00,0x3e,0x01,
+0x00,0x40,0xa0,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,0x80,0x05,0x3d,0x02,
+0x00,0x40,0x01,0x02,0x80,0x02,0x04,0x02,0x00,0xc0,0xa0,0x01,0x00,0x81,0x20,0x01,
+0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,0x00,0x03,0x04,0x01,0x80,0xc0,0xa0,0x02,
+0x3f,0xff,0x83,0x01,0x81,0xc0,0xb5,0x01,0x01,0x40,0xa0,0x01,0x00,0x00,0x06,0x01,
+0x80,0x40,0x01,0x02,0x00,0x04,0x04,0x01,0x80,0xc0,0xa0,0x02,0x3f,0xff,0x83,0x01,
+0x81,0xc0,0xb5,0x01,0x01,0x40,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,
+0x00,0x04,0x84,0x01,0x80,0xc0,0xa0,0x02,0x00,0x40,0x01,0x02,0x80,0x05,0x04,0x02,
+0x00,0xc0,0xa0,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,0x02,
+0x00,0x40,0x01,0x02,0x80,0x05,0x84,0x02,0x00,0xc0,0xa0,0x01,0x00,0x81,0x20,0x01,
+0x00,0x00,0x06,0x01,0xbf,0xff,0x83,0x02,0x00,0x40,0x01,0x02,0x80,0x06,0x04,0x02,
+0x00,0xc0,0xa0,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,
+0x00,0x06,0x84,0x01,0x80,0xc0,0xa0,0x02,0x40,0x0c,0x83,0x01,0x83,0x80,0xb4,0x01,
+0x01,0x40,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x0b,0x00,0x00,0x0b,0x20,0x20,
+0x20,0x20,0x73,0x20,0x3d,0x20,0x22,0x22,0x0a,0x00,0x00,0x23,0x20,0x20,0x20,0x20,
+0x31,0x30,0x30,0x30,0x2e,0x74,0x69,0x6d,0x65,0x73,0x20,0x7b,0x20,0x7c,0x69,0x7c,
+0x20,0x73,0x20,0x3c,0x3c,0x20,0x69,0x2e,0x74,0x6f,0x5f,0x73,0x20,0x7d,0x0a,0x00,
+0x00,0x0b,0x20,0x20,0x20,0x20,0x61,0x20,0x3d,0x20,0x5b,0x5d,0x0a,0x00,0x00,0x2b,
+0x20,0x20,0x20,0x20,0x32,0x30,0x5f,0x30,0x30,0x30,0x2e,0x74,0x69,0x6d,0x65,0x73,
+0x20,0x7b,0x20,0x7c,0x69,0x7c,0x20,0x61,0x20,0x3c,0x3c,0x20,0x5b,0x69,0x2c,0x20,
+0x22,0x76,0x23,0x7b,0x69,0x7d,0x22,0x5d,0x20,0x7d,0x0a,0x00,0x00,0x0b,0x20,0x20,
+0x20,0x20,0x68,0x20,0x3d,0x20,0x7b,0x7d,0x0a,0x00,0x00,0x29,0x20,0x20,0x20,0x20,
+0x35,0x30,0x30,0x30,0x2e,0x74,0x69,0x6d,0x65,0x73,0x20,0x7b,0x20,0x7c,0x69,0x7c,
+0x20,0x68,0x5b,0x69,0x5d,0x20,0x3d,0x20,0x69,0x2e,0x74,0x6f,0x5f,0x73,0x20,0x2a,
+0x20,0x33,0x20,0x7d,0x0a,0x00,0x00,0x0c,0x20,0x20,0x20,0x20,0x61,0x20,0x3d,0x20,
+0x6e,0x69,0x6c,0x0a,0x00,0x00,0x0d,0x20,0x20,0x20,0x20,0x47,0x43,0x2e,0x73,0x74,
+0x61,0x72,0x74,0x0a,0x00,0x00,0x1d,0x20,0x20,0x20,0x20,0x73,0x74,0x20,0x3d,0x20,
+0x53,0x6c,0x61,0x62,0x41,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x6f,0x72,0x2e,0x73,0x74,
+0x61,0x74,0x73,0x0a,0x00,0x00,0x45,0x20,0x20,0x20,0x20,0x5b,0x73,0x2e,0x73,0x69,
+0x7a,0x65,0x2c,0x20,0x68,0x2e,0x73,0x69,0x7a,0x65,0x2c,0x20,0x68,0x5b,0x34,0x39,
+0x39,0x39,0x5d,0x2c,0x20,0x73,0x74,0x5b,0x3a,0x73,0x6d,0x61,0x6c,0x6c,0x5f,0x62,
+0x6c,0x6f,0x63,0x6b,0x73,0x5d,0x20,0x3e,0x20,0x30,0x2c,0x20,0x73,0x74,0x5b,0x3a,
+0x73,0x6c,0x61,0x62,0x73,0x5d,0x20,0x3e,0x20,0x30,0x5d,0x0a,0x00,0x00,0x28,0x5b,
+0x32,0x38,0x39,0x30,0x2c,0x20,0x35,0x30,0x30,0x30,0x2c,0x20,0x22,0x34,0x39,0x39,
+0x39,0x34,0x39,0x39,0x39,0x34,0x39,0x39,0x39,0x22,0x2c,0x20,0x74,0x72,0x75,0x65,
+0x2c,0x20,0x74,0x72,0x75,0x65,0x5d,0x00,0x00,0x00,0x0f,0x00,0x08,0x53,0x6c,0x61,
+0x62,0x54,0x65,0x73,0x74,0x00,0x00,0x03,0x72,0x75,0x6e,0x00,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x02,0x5b,0x5d,0x00,
+0x00,0x06,0x72,0x65,0x73,0x75,0x6c,0x74,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x06,0x62,0x6c,0x6f,0x63,0x6b,0x73,0x00,
+0x00,0x01,0x3e,0x00,0x00,0x08,0x69,0x6e,0x5f,0x70,0x6c,0x61,0x63,0x65,0x00,0x00,
+0x06,0x61,0x6c,0x6c,0x6f,0x63,0x73,0x00,0x00,0x05,0x66,0x72,0x65,0x65,0x73,0x00,
+0x00,0x0d,0x63,0x6c,0x6f,0x73,0x65,0x64,0x5f,0x62,0x6c,0x6f,0x63,0x6b,0x73,0x00,
+0x00,0x0c,0x63,0x6c,0x6f,0x73,0x65,0x64,0x5f,0x62,0x79,0x74,0x65,0x73,0x00,0x00,
+0x0c,0x63,0x6c,0x6f,0x73,0x65,0x64,0x5f,0x73,0x6c,0x61,0x62,0x73,0x00,0x00,0x02,
+0x3c,0x3d,0x00,0x00,0x00,0x00,0xcc,0x00,0x02,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
+0x11,0x01,0x00,0x00,0x11,0x01,0x80,0x00,0x3d,0x01,0x00,0x40,0xa0,0x00,0x80,0x80,
+0x01,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0xbd,0x02,0x00,0x40,0x01,0x02,0x80,0x02,
+0x04,0x02,0x00,0xc0,0xa0,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,
+0x83,0x02,0x00,0x40,0x01,0x02,0x80,0x02,0x84,0x02,0x00,0xc0,0xa0,0x01,0x00,0x81,
+0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x1b,0x72,0x61,0x69,0x73,
+0x65,0x20,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x2c,
+0x20,0x22,0x62,0x6f,0x6f,0x6d,0x22,0x00,0x00,0x13,0x41,0x72,0x67,0x75,0x6d,0x65,
+0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x3a,0x20,0x62,0x6f,0x6f,0x6d,0x00,0x00,0x00,
+0x06,0x00,0x08,0x53,0x6c,0x61,0x62,0x54,0x65,0x73,0x74,0x00,0x00,0x03,0x72,0x75,
+0x6e,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x06,0x72,0x65,0x73,0x75,0x6c,0x74,0x00,0x00,
+0x0d,0x63,0x6c,0x6f,0x73,0x65,0x64,0x5f,0x62,0x6c,0x6f,0x63,0x6b,0x73,0x00,0x44,
+0x42,0x47,0x00,0x00,0x00,0x01,0x4c,0x00,0x01,0x00,0x2a,0x2f,0x72,0x6f,0x6f,0x74,
+0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,
+0x75,0x62,0x79,0x2d,0x73,0x6c,0x61,0x62,0x2f,0x74,0x65,0x73,0x74,0x2f,0x73,0x6c,
+0x61,0x62,0x2e,0x72,0x62,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x06,
+0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,
+0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,
+0x00,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x9d,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x00,0x00,0x07,0x00,0x09,
+0x00,0x0a,0x00,0x0a,0x00,0x0b,0x00,0x0b,0x00,0x0c,0x00,0x0c,0x00,0x0d,0x00,0x0d,
+0x00,0x0e,0x00,0x0e,0x00,0x0f,0x00,0x0f,0x00,0x10,0x00,0x10,0x00,0x11,0x00,0x11,
+0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,
+0x00,0x13,0x00,0x13,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,
+0x00,0x14,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,
+0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,
+0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x18,0x00,0x18,
+0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,
+0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x00,0x00,0x33,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,
+0x1d,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1f,0x00,
+0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x45,0x4e,0x44,0x00,0x00,
+0x00,0x00,0x08,
+};
+void mrb_mruby_slab_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_slab_gem_test(mrb_state *mrb) {
+  mrb_state *mrb2;
+  mrb_value val1, val2, val3, ary1, ary2;
+  int ai;
+  ai = mrb_gc_arena_save(mrb);
+  mrb2 = mrb_open();
+  val3 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$mrbtest_verbose"));
+  if (mrb_test(val3)) {
+    mrb_gv_set(mrb2, mrb_intern_lit(mrb2, "$mrbtest_verbose"), val3);
+  }
+  mrb_load_irep(mrb2, mrbtest_assert_irep);
+  if (mrb2->exc) {
+    mrb_p(mrb2, mrb_obj_value(mrb2->exc));
+    exit(EXIT_FAILURE);
+  }
+  mrb_const_set(mrb2, mrb_obj_value(mrb2->object_class), mrb_intern_lit(mrb2, "GEMNAME"), mrb_str_new(mrb2, "mruby-slab", 10));
+  mrb_mruby_slab_gem_test(mrb2);
+  mrb_load_irep(mrb2, gem_test_irep_mruby_slab_0);
+  if (mrb2->exc) {
+    mrb_p(mrb2, mrb_obj_value(mrb2->exc));
+    exit(EXIT_FAILURE);
+  }
+  
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$ok_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$ok_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$ok_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$ko_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$ko_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$ko_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  val2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$kill_test"));
+  if (mrb_fixnum_p(val2)) {
+    val1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$kill_test"));
+    mrb_gv_set(mrb, mrb_intern_lit(mrb, "$kill_test"), mrb_fixnum_value(mrb_fixnum(val1) + mrb_fixnum(val2)));
+  }
+  ary2 = mrb_gv_get(mrb2, mrb_intern_lit(mrb2, "$asserts"));
+  if (mrb_test(ary2)) {
+    ary1 = mrb_gv_get(mrb, mrb_intern_lit(mrb, "$asserts"));
+    val2 = mrb_ary_shift(mrb2, ary2);
+    
+    while (mrb_test(val2)) {
+      mrb_ary_push(mrb, ary1, mrb_str_new(mrb, RSTRING_PTR(val2), RSTRING_LEN(val2)));
+      val2 = mrb_ary_shift(mrb2, ary2);
+    }
+  }
+  mrb_close(mrb2);
+  mrb_gc_arena_restore(mrb, ai);
+}
@@ -0,0 +1,220 @@
+/*
+ * This file is loading the irep
+ * Ruby GEM code.
+ *
+ * IMPORTANT:
+ *   This file was generated!
+ *   All manual changes will get lost.
+ */
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/irep.h"
+#include <stdint.h>
+const uint8_t gem_mrblib_irep_mruby_string_ext[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x32,0xe6,0xdb,0x00,0x00,0x0b,0xd0,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x08,0x5d,0x30,0x30,
+0x30,0x30,0x00,0x00,0x00,0x33,0x00,0x01,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x05,
+0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0x45,
+0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x53,0x74,
+0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x00,0xe4,0x00,0x01,0x00,0x03,0x00,0x09,0x00,
+0x00,0x00,0x1d,0x00,0x80,0x00,0x48,0x01,0x00,0x00,0xc0,0x00,0x80,0x00,0x46,0x00,
+0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x40,0x46,0x00,0x80,0x00,0x48,0x01,
+0x00,0x04,0xc0,0x00,0x80,0x80,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x06,0xc0,0x00,
+0x80,0xc0,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x08,0xc0,0x00,0x81,0x00,0x46,0x00,
+0x80,0x00,0x48,0x01,0x00,0x0a,0xc0,0x00,0x81,0x40,0x46,0x00,0x80,0x00,0x48,0x01,
+0x00,0x0c,0xc0,0x00,0x81,0x80,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x0e,0xc0,0x00,
+0x81,0xc0,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x10,0xc0,0x00,0x82,0x00,0x46,0x00,
+0x80,0x04,0x04,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,
+0x06,0x6c,0x73,0x74,0x72,0x69,0x70,0x00,0x00,0x06,0x72,0x73,0x74,0x72,0x69,0x70,
+0x00,0x00,0x05,0x73,0x74,0x72,0x69,0x70,0x00,0x00,0x07,0x6c,0x73,0x74,0x72,0x69,
+0x70,0x21,0x00,0x00,0x07,0x72,0x73,0x74,0x72,0x69,0x70,0x21,0x00,0x00,0x06,0x73,
+0x74,0x72,0x69,0x70,0x21,0x00,0x00,0x07,0x63,0x61,0x73,0x65,0x63,0x6d,0x70,0x00,
+0x00,0x09,0x70,0x61,0x72,0x74,0x69,0x74,0x69,0x6f,0x6e,0x00,0x00,0x0a,0x72,0x70,
+0x61,0x72,0x74,0x69,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,0x00,0xcb,0x00,0x04,0x00,
+0x08,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x26,0x01,0x3f,0xff,0x83,0x02,
+0x00,0x00,0x06,0x02,0x00,0x00,0x20,0x02,0x00,0x40,0xaf,0x01,0x81,0x00,0x01,0x00,
+0x40,0x01,0x97,0x02,0x00,0x80,0x01,0x02,0x00,0x80,0xad,0x01,0x01,0x00,0x01,0x02,
+0x00,0x00,0x3d,0x02,0x80,0x00,0x06,0x03,0x00,0x80,0x01,0x02,0x81,0x00,0xa0,0x02,
+0x00,0xc0,0xa0,0x02,0x40,0x01,0x99,0x02,0x00,0x80,0x01,0x02,0x80,0xc0,0x01,0x02,
+0x01,0x40,0xb4,0x02,0x3f,0xf9,0x98,0x02,0x00,0xc0,0x01,0x02,0xbf,0xff,0x83,0x02,
+0x01,0x80,0xb6,0x02,0x40,0x03,0x19,0x02,0x00,0x00,0x06,0x02,0x80,0x80,0x01,0x03,
+0x00,0xc0,0x01,0x02,0x81,0x40,0x41,0x02,0x01,0x00,0xa0,0x00,0x40,0x00,0x97,0x02,
+0x00,0x00,0xbd,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x06,0x20,0x0c,
+0x0a,0x0d,0x09,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x04,0x73,0x69,0x7a,
+0x65,0x00,0x00,0x01,0x2d,0x00,0x00,0x01,0x2b,0x00,0x00,0x08,0x69,0x6e,0x63,0x6c,
+0x75,0x64,0x65,0x3f,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3c,0x3d,0x00,0x00,
+0x02,0x3e,0x3d,0x00,0x00,0x00,0x00,0xc8,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x00,
+0x00,0x20,0x00,0x00,0x00,0x26,0x01,0x3f,0xff,0x83,0x02,0x00,0x00,0x06,0x02,0x00,
+0x00,0x20,0x02,0x00,0x40,0xaf,0x01,0x81,0x00,0x01,0x00,0x40,0x01,0x97,0x02,0x00,
+0xc0,0x01,0x02,0x00,0x40,0xaf,0x01,0x81,0x00,0x01,0x02,0x00,0x00,0x3d,0x02,0x80,
+0x00,0x06,0x03,0x00,0xc0,0x01,0x02,0x80,0xc0,0xa0,0x02,0x00,0x80,0xa0,0x02,0x40,
+0x01,0x99,0x02,0x00,0x80,0x01,0x02,0x80,0xc0,0x01,0x02,0x01,0x00,0xb4,0x02,0x3f,
+0xf9,0x98,0x02,0x00,0xc0,0x01,0x02,0xbf,0xff,0x83,0x02,0x01,0x40,0xb6,0x02,0x40,
+0x03,0x19,0x02,0x00,0x00,0x06,0x02,0x80,0x80,0x01,0x03,0x00,0xc0,0x01,0x02,0x81,
+0x40,0x41,0x02,0x00,0xc0,0xa0,0x00,0x40,0x00,0x97,0x02,0x00,0x00,0xbd,0x02,0x00,
+0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x07,0x20,0x0c,0x0a,0x0d,0x09,0x0b,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x01,
+0x2d,0x00,0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x02,0x5b,
+0x5d,0x00,0x00,0x02,0x3c,0x3d,0x00,0x00,0x02,0x3e,0x3d,0x00,0x00,0x00,0x01,0x0d,
+0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x2e,0x00,0x00,0x00,0x26,0x01,0x3f,
+0xff,0x83,0x02,0x00,0x00,0x06,0x02,0x00,0x00,0x20,0x02,0x00,0x40,0xaf,0x01,0x81,
+0x00,0x01,0x00,0x40,0x01,0x97,0x02,0x00,0x80,0x01,0x02,0x00,0x80,0xad,0x01,0x01,
+0x00,0x01,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,0x06,0x03,0x00,0x80,0x01,0x02,0x81,
+0x00,0xa0,0x02,0x00,0xc0,0xa0,0x02,0x40,0x01,0x99,0x02,0x00,0x80,0x01,0x02,0x80,
+0xc0,0x01,0x02,0x01,0x40,0xb4,0x02,0x3f,0xf9,0x98,0x00,0x40,0x01,0x97,0x02,0x00,
+0xc0,0x01,0x02,0x00,0x40,0xaf,0x01,0x81,0x00,0x01,0x02,0x00,0x00,0xbd,0x02,0x80,
+0x00,0x06,0x03,0x00,0xc0,0x01,0x02,0x81,0x00,0xa0,0x02,0x00,0xc0,0xa0,0x02,0x40,
+0x01,0x99,0x02,0x00,0x80,0x01,0x02,0x80,0xc0,0x01,0x02,0x01,0x40,0xb4,0x02,0x3f,
+0xf9,0x98,0x02,0x00,0xc0,0x01,0x02,0xbf,0xff,0x83,0x02,0x01,0x80,0xb6,0x02,0x40,
+0x03,0x19,0x02,0x00,0x00,0x06,0x02,0x80,0x80,0x01,0x03,0x00,0xc0,0x01,0x02,0x81,
+0x40,0x41,0x02,0x01,0x00,0xa0,0x00,0x40,0x00,0x97,0x02,0x00,0x01,0x3d,0x02,0x00,
+0x00,0x29,0x00,0x00,0x00,0x03,0x00,0x00,0x06,0x20,0x0c,0x0a,0x0d,0x09,0x0b,0x00,
+0x00,0x07,0x20,0x0c,0x0a,0x0d,0x09,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x01,0x2d,0x00,0x00,0x01,0x2b,0x00,0x00,
+0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,
+0x02,0x3c,0x3d,0x00,0x00,0x02,0x3e,0x3d,0x00,0x00,0x00,0x00,0x62,0x00,0x03,0x00,
+0x06,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x26,0x01,0x80,0x00,0x06,0x01,
+0x80,0x00,0x20,0x01,0x00,0xc0,0x01,0x02,0x00,0x00,0x06,0x01,0x80,0x40,0xb2,0x01,
+0xc0,0x01,0x19,0x01,0x80,0x00,0x05,0x00,0x40,0x01,0x97,0x01,0x80,0x00,0x06,0x02,
+0x00,0x80,0x01,0x01,0x80,0x80,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x06,0x6c,0x73,0x74,0x72,0x69,0x70,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x07,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x00,0x00,0x00,0x00,0x62,0x00,
+0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x26,0x01,0x80,0x00,
+0x06,0x01,0x80,0x00,0x20,0x01,0x00,0xc0,0x01,0x02,0x00,0x00,0x06,0x01,0x80,0x40,
+0xb2,0x01,0xc0,0x01,0x19,0x01,0x80,0x00,0x05,0x00,0x40,0x01,0x97,0x01,0x80,0x00,
+0x06,0x02,0x00,0x80,0x01,0x01,0x80,0x80,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x03,0x00,0x06,0x72,0x73,0x74,0x72,0x69,0x70,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x07,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x00,0x00,0x00,0x00,
+0x61,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x26,0x01,
+0x80,0x00,0x06,0x01,0x80,0x00,0x20,0x01,0x00,0xc0,0x01,0x02,0x00,0x00,0x06,0x01,
+0x80,0x40,0xb2,0x01,0xc0,0x01,0x19,0x01,0x80,0x00,0x05,0x00,0x40,0x01,0x97,0x01,
+0x80,0x00,0x06,0x02,0x00,0x80,0x01,0x01,0x80,0x80,0xa0,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x05,0x73,0x74,0x72,0x69,0x70,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x07,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x00,0x00,0x00,
+0x00,0xfe,0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x1c,0x02,0x00,0x00,0x26,
+0x00,0x40,0x03,0x9a,0x01,0x80,0x00,0x06,0x01,0x80,0x00,0x20,0x02,0x00,0x40,0x01,
+0x02,0x00,0x80,0x20,0x02,0x00,0x00,0x20,0x01,0x80,0x40,0xa0,0x00,0x40,0x08,0x97,
+0x01,0x80,0x00,0x1b,0x02,0x00,0x01,0x91,0x02,0x80,0xc0,0x01,0x02,0x01,0x00,0xa0,
+0x02,0x40,0x00,0x98,0x00,0x40,0x05,0x17,0x01,0x80,0x00,0x06,0x02,0x00,0x03,0x11,
+0x02,0x80,0x00,0x3d,0x03,0x00,0x40,0x01,0x03,0x01,0xc0,0x20,0x02,0x81,0x80,0x3e,
+0x03,0x00,0x00,0xbd,0x02,0x81,0x80,0x3e,0x01,0x81,0x41,0x20,0x00,0x40,0x01,0x17,
+0x01,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,
+0x00,0x00,0x1a,0x6e,0x6f,0x20,0x69,0x6d,0x70,0x6c,0x69,0x63,0x69,0x74,0x20,0x63,
+0x6f,0x6e,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x6f,0x66,0x20,0x00,0x00,0x0c,
+0x20,0x69,0x6e,0x74,0x6f,0x20,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x08,
+0x00,0x08,0x64,0x6f,0x77,0x6e,0x63,0x61,0x73,0x65,0x00,0x00,0x03,0x3c,0x3d,0x3e,
+0x00,0x00,0x06,0x74,0x6f,0x5f,0x73,0x74,0x72,0x00,0x00,0x0d,0x4e,0x6f,0x4d,0x65,
+0x74,0x68,0x6f,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,
+0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,
+0x72,0x6f,0x72,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x01,0x3b,
+0x00,0x05,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x2d,0x02,0x00,0x00,0x26,0x02,0x80,
+0x40,0x01,0x03,0x00,0x00,0x91,0x02,0x80,0x00,0xa0,0x02,0xc0,0x00,0x99,0x00,0x40,
+0x04,0x97,0x02,0x80,0x00,0x06,0x03,0x00,0x01,0x91,0x03,0x80,0x00,0x3d,0x04,0x00,
+0x40,0x01,0x04,0x01,0x00,0x20,0x03,0x82,0x00,0x3e,0x04,0x00,0x00,0xbd,0x03,0x82,
+0x00,0x3e,0x02,0x80,0x81,0x20,0x02,0x80,0x00,0x06,0x03,0x00,0x40,0x01,0x02,0x81,
+0x40,0xa0,0x01,0x81,0x40,0x01,0x02,0x81,0x80,0x20,0x02,0xc0,0x02,0x99,0x02,0x80,
+0x00,0x06,0x03,0x00,0x01,0x3d,0x03,0x80,0x01,0x3d,0x02,0x81,0x41,0xb7,0x00,0x40,
+0x09,0x17,0x02,0x80,0xc0,0x01,0x03,0x00,0x40,0x01,0x03,0x02,0x00,0x20,0x02,0x81,
+0xc0,0xac,0x02,0x01,0x40,0x01,0x02,0x80,0x00,0x06,0x03,0x3f,0xff,0x83,0x03,0x80,
+0xc0,0x01,0x02,0x82,0x41,0x20,0x03,0x00,0x40,0x01,0x03,0x80,0x00,0x06,0x04,0x01,
+0x00,0x01,0x04,0x80,0x00,0x06,0x04,0x82,0x00,0x20,0x05,0x01,0x00,0x01,0x04,0x82,
+0x80,0xae,0x03,0x82,0x41,0x20,0x02,0x81,0x41,0xb7,0x02,0x80,0x00,0x29,0x00,0x00,
+0x00,0x03,0x00,0x00,0x0f,0x74,0x79,0x70,0x65,0x20,0x6d,0x69,0x73,0x6d,0x61,0x74,
+0x63,0x68,0x3a,0x20,0x00,0x00,0x06,0x20,0x67,0x69,0x76,0x65,0x6e,0x00,0x00,0x00,
+0x00,0x00,0x00,0x0b,0x00,0x05,0x69,0x73,0x5f,0x61,0x3f,0x00,0x00,0x06,0x53,0x74,
+0x72,0x69,0x6e,0x67,0x00,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x09,0x54,
+0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,
+0x00,0x00,0x05,0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x04,0x6e,0x69,0x6c,0x3f,0x00,
+0x00,0x01,0x2b,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x05,0x73,0x6c,0x69,
+0x63,0x65,0x00,0x00,0x01,0x2d,0x00,0x00,0x00,0x01,0x3c,0x00,0x05,0x00,0x0c,0x00,
+0x00,0x00,0x00,0x00,0x2d,0x02,0x00,0x00,0x26,0x02,0x80,0x40,0x01,0x03,0x00,0x00,
+0x91,0x02,0x80,0x00,0xa0,0x02,0xc0,0x00,0x99,0x00,0x40,0x04,0x97,0x02,0x80,0x00,
+0x06,0x03,0x00,0x01,0x91,0x03,0x80,0x00,0x3d,0x04,0x00,0x40,0x01,0x04,0x01,0x00,
+0x20,0x03,0x82,0x00,0x3e,0x04,0x00,0x00,0xbd,0x03,0x82,0x00,0x3e,0x02,0x80,0x81,
+0x20,0x02,0x80,0x00,0x06,0x03,0x00,0x40,0x01,0x02,0x81,0x40,0xa0,0x01,0x81,0x40,
+0x01,0x02,0x81,0x80,0x20,0x02,0xc0,0x02,0x99,0x02,0x80,0x01,0x3d,0x03,0x00,0x01,
+0x3d,0x03,0x80,0x00,0x06,0x02,0x81,0x41,0xb7,0x00,0x40,0x09,0x17,0x02,0x80,0xc0,
+0x01,0x03,0x00,0x40,0x01,0x03,0x02,0x00,0x20,0x02,0x81,0xc0,0xac,0x02,0x01,0x40,
+0x01,0x02,0x80,0x00,0x06,0x03,0x3f,0xff,0x83,0x03,0x80,0xc0,0x01,0x02,0x82,0x41,
+0x20,0x03,0x00,0x40,0x01,0x03,0x80,0x00,0x06,0x04,0x01,0x00,0x01,0x04,0x80,0x00,
+0x06,0x04,0x82,0x00,0x20,0x05,0x01,0x00,0x01,0x04,0x82,0x80,0xae,0x03,0x82,0x41,
+0x20,0x02,0x81,0x41,0xb7,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x00,0x00,0x0f,
+0x74,0x79,0x70,0x65,0x20,0x6d,0x69,0x73,0x6d,0x61,0x74,0x63,0x68,0x3a,0x20,0x00,
+0x00,0x06,0x20,0x67,0x69,0x76,0x65,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,
+0x05,0x69,0x73,0x5f,0x61,0x3f,0x00,0x00,0x06,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,
+0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,
+0x72,0x6f,0x72,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x06,0x72,0x69,
+0x6e,0x64,0x65,0x78,0x00,0x00,0x04,0x6e,0x69,0x6c,0x3f,0x00,0x00,0x01,0x2b,0x00,
+0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x05,0x73,0x6c,0x69,0x63,0x65,0x00,0x00,
+0x01,0x2d,0x00,0x44,0x42,0x47,0x00,0x00,0x00,0x03,0x55,0x00,0x01,0x00,0x34,0x2f,
+0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,
+0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x73,0x74,0x72,0x69,0x6e,0x67,0x2d,0x65,
+0x78,0x74,0x2f,0x6d,0x72,0x62,0x6c,0x69,0x62,0x2f,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x2e,0x72,0x62,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x05,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,
+0x00,0x4b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0x00,0x00,
+0x07,0x00,0x07,0x00,0x07,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x16,0x00,0x16,0x00,
+0x16,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x25,0x00,
+0x25,0x00,0x25,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x40,0x00,0x40,0x00,0x40,0x00,
+0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x00,0x00,0x51,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x07,0x00,0x03,0x00,0x04,
+0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+0x00,0x05,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,
+0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x51,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x0e,0x00,0x0a,0x00,
+0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,0x6d,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0x00,0x00,0x16,0x00,0x11,
+0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,
+0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,
+0x00,0x13,0x00,0x13,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,
+0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,
+0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,
+0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x1b,0x00,0x19,0x00,0x19,0x00,
+0x19,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,
+0x1a,0x00,0x1a,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x0d,0x00,0x00,0x20,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1f,0x00,0x1f,
+0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x00,
+0x00,0x2b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,
+0x25,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
+0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x00,0x00,0x49,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x35,0x00,0x35,0x00,0x32,
+0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x33,
+0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,
+0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,
+0x00,0x34,0x00,0x00,0x00,0x6b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x2d,0x00,0x00,0x40,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,
+0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,
+0x38,0x00,0x39,0x00,0x39,0x00,0x39,0x00,0x39,0x00,0x3a,0x00,0x3a,0x00,0x3e,0x00,
+0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,
+0x3b,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,
+0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x00,0x00,
+0x6b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x00,0x00,0x4b,
+0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,
+0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x44,0x00,0x44,
+0x00,0x44,0x00,0x44,0x00,0x45,0x00,0x45,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,
+0x00,0x49,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x47,0x00,0x47,
+0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,
+0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x45,0x4e,0x44,0x00,0x00,0x00,0x00,0x08,
+};
+void mrb_mruby_string_ext_gem_init(mrb_state *mrb);
+void mrb_mruby_string_ext_gem_final(mrb_state *mrb);
+
+void GENERATED_TMP_mrb_mruby_string_ext_gem_init(mrb_state *mrb) {
+  int ai = mrb_gc_arena_save(mrb);
+  mrb_mruby_string_ext_gem_init(mrb);
+  mrb_load_irep(mrb, gem_mrblib_irep_mruby_string_ext);
+  if (mrb->exc) {
+    mrb_print_error(mrb);
+    exit(EXIT_FAILURE);
+  }
+  mrb_gc_arena_restore(mrb, ai);
+}
+
+void GENERATED_TMP_mrb_mruby_string_ext_gem_final(mrb_state *mrb) {
+  mrb_mruby_string_ext_gem_final(mrb);
+}
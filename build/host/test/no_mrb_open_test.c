@@ -0,0 +1,7290 @@
+/*
+ * This file contains a test code for following gems:
+ *   mruby-sprintf
+ *   mruby-print
+ *   mruby-math
+ *   mruby-time
+ *   mruby-struct
+ *   mruby-enum-ext
+ *   mruby-string-ext
+ *   mruby-numeric-ext
+ *   mruby-bignum
+ *   mruby-array-ext
+ *   mruby-hash-ext
+ *   mruby-range-ext
+ *   mruby-symbol-ext
+ *   mruby-random
+ *   mruby-object-ext
+ *   mruby-weakref
+ *   mruby-fiber
+ *   mruby-enumerator
+ *   mruby-enum-lazy
+ *   mruby-toplevel-ext
+ *   mruby-bin-mirb
+ *   mruby-bin-mruby
+ *   mruby-kernel-ext
+ *
+ * IMPORTANT:
+ *   This file was generated!
+ *   All manual changes will get lost.
+ */
+
+#include "mruby.h"
+#include "mruby/irep.h"
+
+#include <stdint.h>
+const uint8_t no_mrb_open_gem_test_irep[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x32,0xc0,0x04,0x00,0x01,0xc5,0x02,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x01,0x45,0x80,0x30,0x30,
+0x30,0x30,0x00,0x00,0x2a,0x7f,0x00,0x01,0x00,0x05,0x01,0x1e,0x00,0x00,0x04,0xa8,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x01,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0xbd,0x01,0x80,0x03,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x3d,0x01,0x80,0x05,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x01,0xbd,0x01,0x80,0x07,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x48,0x01,0x00,0x08,0xc0,0x00,0x80,0x40,0x46,0x00,0x80,0x00,0x06,
+0x01,0x00,0x02,0x3d,0x01,0x80,0x0b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x02,0xbd,0x01,0x80,0x0d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x03,0x3d,0x01,0x80,0x0f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x03,0xbd,0x01,0x80,0x11,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x04,0x3d,0x01,0x80,0x13,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x04,0xbd,0x01,0x80,0x15,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x05,0x3d,0x01,0x80,0x17,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x05,0xbd,0x01,0x80,0x19,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x06,0x3d,0x01,0x80,0x1b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x06,0xbd,0x01,0x80,0x1d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x07,0x3d,0x01,0x80,0x1f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x07,0xbd,0x01,0x80,0x21,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x08,0x3d,0x01,0x80,0x23,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x08,0xbd,0x01,0x80,0x25,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x09,0x3d,0x01,0x80,0x27,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x09,0xbd,0x01,0x80,0x29,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x0a,0x3d,0x01,0x80,0x2b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x0a,0xbd,0x01,0x80,0x2d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x0b,0x3d,0x01,0x80,0x2f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x0b,0xbd,0x01,0x80,0x31,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x0c,0x3d,0x01,0x80,0x33,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x0c,0xbd,0x01,0x80,0x35,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x0d,0x3d,0x01,0x80,0x37,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x0d,0xbd,0x01,0x80,0x0e,0x3d,0x02,0x00,0x39,0x40,0x00,0x80,0x01,0x21,
+0x00,0x80,0x00,0x06,0x01,0x00,0x0e,0xbd,0x01,0x80,0x0f,0x3d,0x02,0x00,0x3b,0x40,
+0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x0f,0xbd,0x01,0x80,0x10,0x3d,
+0x02,0x00,0x3d,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x10,0xbd,
+0x01,0x80,0x11,0x3d,0x02,0x00,0x3f,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,
+0x01,0x00,0x11,0xbd,0x01,0x80,0x12,0x3d,0x02,0x00,0x41,0x40,0x00,0x80,0x01,0x21,
+0x00,0x80,0x00,0x06,0x01,0x00,0x12,0xbd,0x01,0x80,0x13,0x3d,0x02,0x00,0x43,0x40,
+0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x13,0xbd,0x01,0x80,0x14,0x3d,
+0x02,0x00,0x45,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x14,0xbd,
+0x01,0x80,0x15,0x3d,0x02,0x00,0x47,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,
+0x01,0x00,0x15,0xbd,0x01,0x80,0x16,0x3d,0x02,0x00,0x49,0x40,0x00,0x80,0x01,0x21,
+0x00,0x80,0x00,0x06,0x01,0x00,0x16,0xbd,0x01,0x80,0x17,0x3d,0x02,0x00,0x4b,0x40,
+0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x17,0xbd,0x01,0x80,0x18,0x3d,
+0x02,0x00,0x4d,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x18,0xbd,
+0x01,0x80,0x19,0x3d,0x02,0x00,0x4f,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,
+0x01,0x00,0x19,0xbd,0x01,0x80,0x1a,0x3d,0x02,0x00,0x51,0x40,0x00,0x80,0x01,0x21,
+0x00,0x80,0x00,0x06,0x01,0x00,0x1a,0xbd,0x01,0x80,0x1b,0x3d,0x02,0x00,0x53,0x40,
+0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x1b,0xbd,0x01,0x80,0x1c,0x3d,
+0x02,0x00,0x55,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x1c,0xbd,
+0x01,0x80,0x1d,0x3d,0x02,0x00,0x57,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,
+0x01,0x00,0x1d,0xbd,0x01,0x80,0x1e,0x3d,0x02,0x00,0x59,0x40,0x00,0x80,0x01,0x21,
+0x00,0x80,0x00,0x06,0x01,0x00,0x1e,0xbd,0x01,0x80,0x1f,0x3d,0x02,0x00,0x5b,0x40,
+0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x1f,0xbd,0x01,0x80,0x20,0x3d,
+0x02,0x00,0x5d,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x20,0xbd,
+0x01,0x80,0x21,0x3d,0x02,0x00,0x5f,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,
+0x01,0x00,0x21,0xbd,0x01,0x80,0x22,0x3d,0x02,0x00,0x61,0x40,0x00,0x80,0x01,0x21,
+0x00,0x80,0x00,0x06,0x01,0x00,0x22,0xbd,0x01,0x80,0x23,0x3d,0x02,0x00,0x63,0x40,
+0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x23,0xbd,0x01,0x80,0x24,0x3d,
+0x02,0x00,0x65,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x24,0xbd,
+0x01,0x80,0x25,0x3d,0x02,0x00,0x67,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,
+0x01,0x00,0x25,0xbd,0x01,0x80,0x26,0x3d,0x02,0x00,0x69,0x40,0x00,0x80,0x01,0x21,
+0x00,0x80,0x00,0x06,0x01,0x00,0x26,0xbd,0x01,0x80,0x27,0x3d,0x02,0x00,0x6b,0x40,
+0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x27,0xbd,0x01,0x80,0x28,0x3d,
+0x02,0x00,0x6d,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x28,0xbd,
+0x01,0x80,0x29,0x3d,0x02,0x00,0x6f,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,
+0x01,0x00,0x29,0xbd,0x01,0x80,0x2a,0x3d,0x02,0x00,0x71,0x40,0x00,0x80,0x01,0x21,
+0x00,0x80,0x00,0x06,0x01,0x00,0x2a,0xbd,0x01,0x80,0x2b,0x3d,0x02,0x00,0x73,0x40,
+0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x2b,0xbd,0x01,0x80,0x2c,0x3d,
+0x02,0x00,0x75,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x2c,0xbd,
+0x01,0x80,0x2d,0x3d,0x02,0x00,0x77,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,
+0x01,0x00,0x2d,0xbd,0x01,0x80,0x2e,0x3d,0x02,0x00,0x79,0x40,0x00,0x80,0x01,0x21,
+0x00,0x80,0x00,0x06,0x01,0x00,0x2e,0xbd,0x01,0x80,0x2f,0x3d,0x02,0x00,0x7b,0x40,
+0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x2f,0xbd,0x01,0x80,0x30,0x3d,
+0x02,0x00,0x7d,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x30,0xbd,
+0x01,0x80,0x31,0x3d,0x02,0x00,0x7f,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,
+0x01,0x00,0x31,0xbd,0x01,0x80,0x32,0x3d,0x02,0x00,0x81,0x40,0x00,0x80,0x01,0x21,
+0x00,0x80,0x00,0x06,0x01,0x00,0x32,0xbd,0x01,0x80,0x33,0x3d,0x02,0x00,0x83,0x40,
+0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x33,0xbd,0x01,0x80,0x85,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x34,0x3d,0x01,0x80,0x87,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x34,0xbd,0x01,0x80,0x89,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x35,0x3d,0x01,0x80,0x8b,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x35,0xbd,0x01,0x80,0x36,0x3d,
+0x02,0x00,0x8d,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x36,0xbd,
+0x01,0x80,0x37,0x3d,0x02,0x00,0x8f,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,
+0x01,0x00,0x37,0xbd,0x01,0x80,0x38,0x3d,0x02,0x00,0x91,0x40,0x00,0x80,0x01,0x21,
+0x00,0x80,0x00,0x06,0x01,0x00,0x37,0xbd,0x01,0x80,0x38,0x3d,0x02,0x00,0x93,0x40,
+0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x38,0xbd,0x01,0x80,0x39,0x3d,
+0x02,0x00,0x95,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x39,0xbd,
+0x01,0x80,0x3a,0x3d,0x02,0x00,0x97,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,
+0x01,0x00,0x3a,0xbd,0x01,0x80,0x3b,0x3d,0x02,0x00,0x99,0x40,0x00,0x80,0x01,0x21,
+0x00,0x80,0x00,0x06,0x01,0x00,0x3b,0xbd,0x01,0x80,0x3c,0x3d,0x02,0x00,0x9b,0x40,
+0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x3c,0xbd,0x01,0x80,0x3d,0x3d,
+0x02,0x00,0x9d,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x3d,0xbd,
+0x01,0x80,0x3e,0x3d,0x02,0x00,0x9f,0x40,0x00,0x80,0x01,0x21,0x00,0x80,0x00,0x06,
+0x01,0x00,0x3e,0xbd,0x01,0x80,0x3f,0x3d,0x02,0x00,0xa1,0x40,0x00,0x80,0x01,0x21,
+0x00,0x80,0x00,0x06,0x01,0x00,0x3f,0xbd,0x01,0x80,0xa3,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x40,0x3d,0x01,0x80,0xa5,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x40,0xbd,0x01,0x80,0xa7,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x41,0x3d,0x01,0x80,0xa9,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x41,0xbd,0x01,0x80,0xab,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x42,0x3d,0x01,0x80,0xad,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x42,0xbd,0x01,0x80,0xaf,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x43,0x3d,0x01,0x80,0xb1,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x43,0xbd,0x01,0x80,0xb3,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x44,0x3d,0x01,0x80,0xb5,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x44,0xbd,0x01,0x80,0xb7,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x45,0x3d,0x01,0x80,0xb9,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x45,0xbd,0x01,0x80,0xbb,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x46,0x3d,0x01,0x80,0xbd,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x46,0xbd,0x01,0x80,0xbf,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x47,0x3d,0x01,0x80,0xc1,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x47,0xbd,0x01,0x80,0xc3,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x48,0x3d,0x01,0x80,0xc5,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x48,0xbd,0x01,0x80,0xc7,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x49,0x3d,0x01,0x80,0xc9,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x49,0xbd,0x01,0x80,0xcb,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x4a,0x3d,0x01,0x80,0xcd,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x4a,0xbd,0x01,0x80,0xcf,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x4b,0x3d,0x01,0x80,0xd1,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x4b,0xbd,0x01,0x80,0xd3,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x4c,0x3d,0x01,0x80,0xd5,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x4c,0xbd,0x01,0x80,0xd7,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x4d,0x3d,0x01,0x80,0xd9,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x4d,0xbd,0x01,0x80,0xdb,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x4e,0x3d,0x01,0x80,0xdd,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x4e,0xbd,0x01,0x80,0xdf,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x4f,0x3d,0x01,0x80,0xe1,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x4f,0xbd,0x01,0x80,0xe3,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x50,0x3d,0x01,0x80,0xe5,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x50,0xbd,0x01,0x80,0xe7,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x51,0x3d,0x01,0x80,0xe9,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x51,0xbd,0x01,0x80,0xeb,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x52,0x3d,0x01,0x80,0xed,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x52,0xbd,0x01,0x80,0xef,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x53,0x3d,0x01,0x80,0xf1,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x53,0xbd,0x01,0x80,0xf3,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x54,0x3d,0x01,0x80,0xf5,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x54,0xbd,0x01,0x80,0xf7,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x55,0x3d,0x01,0x80,0xf9,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x55,0xbd,0x01,0x80,0xfb,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x56,0x3d,0x01,0x80,0xfd,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x56,0xbd,0x01,0x80,0xff,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x57,0x3d,0x01,0x81,0x01,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x57,0xbd,0x01,0x81,0x03,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x58,0x3d,0x01,0x81,0x05,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x58,0xbd,0x01,0x81,0x07,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x59,0x3d,0x01,0x81,0x09,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x06,0x01,0x00,0x59,0xbd,0x01,0x81,0x0b,0x40,0x00,0x80,0x00,0xa1,
+0x00,0x80,0x00,0x48,0x01,0x01,0x0c,0xc0,0x00,0x80,0x80,0x46,0x00,0x80,0x00,0x06,
+0x01,0x00,0x5a,0x3d,0x01,0x81,0x0f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x5a,0xbd,0x01,0x81,0x11,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x5b,0x3d,0x01,0x81,0x13,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x5b,0xbd,0x01,0x81,0x15,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x5c,0x3d,0x01,0x81,0x17,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x5c,0xbd,0x01,0x81,0x19,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x5d,0x3d,0x01,0x81,0x1b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x5d,0xbd,0x01,0x81,0x1d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x5e,0x3d,0x01,0x81,0x1f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x5e,0xbd,0x01,0x81,0x21,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x5f,0x3d,0x01,0x81,0x23,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x5f,0xbd,0x01,0x81,0x25,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x60,0x3d,0x01,0x81,0x27,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x60,0xbd,0x01,0x81,0x29,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x61,0x3d,0x01,0x81,0x2b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x61,0xbd,0x01,0x81,0x2d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x62,0x3d,0x01,0x81,0x2f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x62,0xbd,0x01,0x81,0x31,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x63,0x3d,0x01,0x81,0x33,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x63,0xbd,0x01,0x81,0x35,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x64,0x3d,0x01,0x81,0x37,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x64,0xbd,0x01,0x81,0x39,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x65,0x3d,0x01,0x81,0x3b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x65,0xbd,0x01,0x81,0x3d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x66,0x3d,0x01,0x81,0x3f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x66,0xbd,0x01,0x81,0x41,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x67,0x3d,0x01,0x81,0x43,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x67,0xbd,0x01,0x81,0x45,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x68,0x3d,0x01,0x81,0x47,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x68,0xbd,0x01,0x81,0x49,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x69,0x3d,0x01,0x81,0x4b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x69,0xbd,0x01,0x81,0x4d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x68,0x3d,0x01,0x81,0x4f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x6a,0x3d,0x01,0x81,0x51,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x6a,0xbd,0x01,0x81,0x53,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x6b,0x3d,0x01,0x81,0x55,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x6b,0xbd,0x01,0x81,0x57,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x6c,0x3d,0x01,0x81,0x59,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x6c,0xbd,0x01,0x81,0x5b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x6d,0x3d,0x01,0x81,0x5d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x6d,0xbd,0x01,0x81,0x5f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x6e,0x3d,0x01,0x81,0x61,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x6e,0xbd,0x01,0x81,0x63,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x6f,0x3d,0x01,0x81,0x65,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x6f,0xbd,0x01,0x81,0x67,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x70,0x3d,0x01,0x81,0x69,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x70,0xbd,0x01,0x81,0x6b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x71,0x3d,0x01,0x81,0x6d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x71,0xbd,0x01,0x81,0x6f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x72,0x3d,0x01,0x81,0x71,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x72,0xbd,0x01,0x81,0x73,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x73,0x3d,0x01,0x81,0x75,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x73,0xbd,0x01,0x81,0x77,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x74,0x3d,0x01,0x81,0x79,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x74,0xbd,0x01,0x81,0x7b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x75,0x3d,0x01,0x81,0x7d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x75,0xbd,0x01,0x81,0x7f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x76,0x3d,0x01,0x81,0x81,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x76,0xbd,0x01,0x81,0x83,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x77,0x3d,0x01,0x81,0x85,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x77,0xbd,0x01,0x81,0x87,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x78,0x3d,0x01,0x81,0x89,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x78,0xbd,0x01,0x81,0x8b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x79,0x3d,0x01,0x81,0x8d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x79,0xbd,0x01,0x81,0x8f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x7a,0x3d,0x01,0x81,0x91,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x7a,0xbd,0x01,0x81,0x93,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x7b,0x3d,0x01,0x81,0x95,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x7b,0xbd,0x01,0x81,0x97,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x48,
+0x01,0x01,0x98,0xc0,0x00,0x80,0xc0,0x46,0x00,0x80,0x00,0x48,0x01,0x01,0x9a,0xc0,
+0x00,0x81,0x00,0x46,0x00,0x80,0x00,0x06,0x01,0x00,0x7c,0x3d,0x01,0x81,0x9d,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7c,0xbd,0x01,0x81,0x9f,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7d,0x3d,0x01,0x81,0xa1,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7d,0xbd,0x01,0x81,0xa3,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7e,0x3d,0x01,0x81,0xa5,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7e,0xbd,0x01,0x81,0xa7,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7f,0x3d,0x01,0x81,0xa9,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7f,0xbd,0x01,0x81,0xab,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x80,0x3d,0x01,0x81,0xad,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x80,0xbd,0x01,0x81,0xaf,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x81,0x3d,0x01,0x81,0xb1,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x81,0xbd,0x01,0x81,0xb3,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x82,0x3d,0x01,0x81,0xb5,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x82,0xbd,0x01,0x81,0xb7,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x83,0x3d,0x01,0x81,0xb9,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x83,0xbd,0x01,0x81,0xbb,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x84,0x3d,0x01,0x81,0xbd,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x84,0xbd,0x01,0x81,0xbf,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x85,0x3d,0x01,0x81,0xc1,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x85,0xbd,0x01,0x81,0xc3,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x86,0x3d,0x01,0x81,0xc5,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x86,0xbd,0x01,0x81,0xc7,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x87,0x3d,0x01,0x81,0xc9,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x87,0xbd,0x01,0x81,0xcb,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x88,0x3d,0x01,0x81,0xcd,0x40,
+0x00,0x80,0x00,0xa1,0x00,0x80,0x02,0x91,0x00,0x81,0x80,0x20,0x00,0x80,0x03,0x8e,
+0x00,0x80,0x03,0x8d,0x00,0x80,0x40,0x47,0x00,0x80,0x73,0xc5,0x00,0x80,0x00,0x06,
+0x01,0x00,0x88,0xbd,0x01,0x81,0xd1,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x88,0xbd,0x01,0x81,0xd3,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x89,0x3d,0x01,0x81,0xd5,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x89,0xbd,0x01,0x81,0xd7,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x8a,0x3d,0x01,0x81,0xd9,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x8a,0xbd,0x01,0x81,0xdb,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x8b,0x3d,0x01,0x81,0xdd,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x8b,0xbd,0x01,0x81,0xdf,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x8c,0x3d,0x01,0x81,0xe1,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x8c,0xbd,0x01,0x81,0xe3,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x8d,0x3d,0x01,0x81,0xe5,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x8d,0xbd,0x01,0x81,0xe7,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x8e,0x3d,0x01,0x81,0xe9,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x8e,0xbd,0x01,0x81,0xeb,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x8f,0x3d,0x01,0x81,0xed,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x8f,0xbd,0x01,0x81,0xef,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x90,0x3d,0x01,0x81,0xf1,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x90,0xbd,0x01,0x81,0xf3,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x91,0x3d,0x01,0x81,0xf5,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x91,0xbd,0x01,0x81,0xf7,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x92,0x3d,0x01,0x81,0xf9,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x92,0xbd,0x01,0x81,0xfb,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x93,0x3d,0x01,0x81,0xfd,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x93,0xbd,0x01,0x81,0xff,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x94,0x3d,0x01,0x82,0x01,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x94,0xbd,0x01,0x82,0x03,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x95,0x3d,0x01,0x82,0x05,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x95,0xbd,0x01,0x82,0x07,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x96,0x3d,0x01,0x82,0x09,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x96,0xbd,0x01,0x82,0x0b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x97,0x3d,0x01,0x82,0x0d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x97,0xbd,0x01,0x82,0x0f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x98,0x3d,0x01,0x82,0x11,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x98,0xbd,0x01,0x82,0x13,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x99,0x3d,0x01,0x82,0x15,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x99,0xbd,0x01,0x82,0x17,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x9a,0x3d,0x01,0x82,0x19,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x9a,0xbd,0x01,0x82,0x1b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x9b,0x3d,0x01,0x82,0x1d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x9b,0xbd,0x01,0x82,0x1f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x9c,0x3d,0x01,0x82,0x21,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x9c,0xbd,0x01,0x82,0x23,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x9d,0x3d,0x01,0x82,0x25,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x9d,0xbd,0x01,0x82,0x27,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x9e,0x3d,0x01,0x82,0x29,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x9e,0xbd,0x01,0x82,0x2b,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x9f,0x3d,0x01,0x82,0x2d,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0x9f,0xbd,0x01,0x82,0x2f,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0xa0,0x3d,0x01,0x82,0x31,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0xa0,0xbd,0x01,0x82,0x33,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0xa1,0x3d,0x01,0x82,0x35,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0xa1,0xbd,0x01,0x82,0x37,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0xa2,0x3d,0x01,0x82,0x39,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x06,
+0x01,0x00,0xa2,0xbd,0x01,0x82,0x3b,0x40,0x00,0x80,0x00,0xa1,0x00,0x00,0x00,0x4a,
+0x00,0x00,0x01,0x46,0x00,0x00,0x20,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x73,0x70,
+0x72,0x69,0x6e,0x74,0x66,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,0x6f,0x6e,0x76,
+0x65,0x72,0x73,0x69,0x6f,0x6e,0x73,0x00,0x00,0x2b,0x4b,0x65,0x72,0x6e,0x65,0x6c,
+0x23,0x73,0x70,0x72,0x69,0x6e,0x74,0x66,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x63,
+0x6f,0x6e,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x64,0x6f,
+0x75,0x62,0x6c,0x65,0x73,0x00,0x00,0x2c,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x73,
+0x70,0x72,0x69,0x6e,0x74,0x66,0x20,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x20,0x63,
+0x6f,0x6e,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x73,0x20,0x6f,0x66,0x20,0x42,0x69,
+0x67,0x6e,0x75,0x6d,0x00,0x00,0x21,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x73,0x70,
+0x72,0x69,0x6e,0x74,0x66,0x20,0x62,0x69,0x6e,0x61,0x72,0x79,0x20,0x63,0x6f,0x6e,
+0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x73,0x00,0x00,0x0a,0x4d,0x61,0x74,0x68,0x2e,
+0x73,0x69,0x6e,0x20,0x30,0x00,0x00,0x0d,0x4d,0x61,0x74,0x68,0x2e,0x73,0x69,0x6e,
+0x20,0x50,0x49,0x2f,0x32,0x00,0x00,0x1b,0x46,0x75,0x6e,0x64,0x61,0x6d,0x65,0x6e,
+0x74,0x61,0x6c,0x20,0x74,0x72,0x69,0x67,0x20,0x69,0x64,0x65,0x6e,0x74,0x69,0x74,
+0x69,0x65,0x73,0x00,0x00,0x0a,0x4d,0x61,0x74,0x68,0x2e,0x65,0x72,0x66,0x20,0x30,
+0x00,0x00,0x0a,0x4d,0x61,0x74,0x68,0x2e,0x65,0x78,0x70,0x20,0x30,0x00,0x00,0x0a,
+0x4d,0x61,0x74,0x68,0x2e,0x65,0x78,0x70,0x20,0x31,0x00,0x00,0x0c,0x4d,0x61,0x74,
+0x68,0x2e,0x65,0x78,0x70,0x20,0x31,0x2e,0x35,0x00,0x00,0x0a,0x4d,0x61,0x74,0x68,
+0x2e,0x6c,0x6f,0x67,0x20,0x31,0x00,0x00,0x0a,0x4d,0x61,0x74,0x68,0x2e,0x6c,0x6f,
+0x67,0x20,0x45,0x00,0x00,0x0d,0x4d,0x61,0x74,0x68,0x2e,0x6c,0x6f,0x67,0x20,0x45,
+0x2a,0x2a,0x33,0x00,0x00,0x0b,0x4d,0x61,0x74,0x68,0x2e,0x6c,0x6f,0x67,0x32,0x20,
+0x31,0x00,0x00,0x0b,0x4d,0x61,0x74,0x68,0x2e,0x6c,0x6f,0x67,0x32,0x20,0x32,0x00,
+0x00,0x0c,0x4d,0x61,0x74,0x68,0x2e,0x6c,0x6f,0x67,0x31,0x30,0x20,0x31,0x00,0x00,
+0x0d,0x4d,0x61,0x74,0x68,0x2e,0x6c,0x6f,0x67,0x31,0x30,0x20,0x31,0x30,0x00,0x00,
+0x12,0x4d,0x61,0x74,0x68,0x2e,0x6c,0x6f,0x67,0x31,0x30,0x20,0x31,0x30,0x2a,0x2a,
+0x31,0x30,0x30,0x00,0x00,0x09,0x4d,0x61,0x74,0x68,0x2e,0x73,0x71,0x72,0x74,0x00,
+0x00,0x09,0x4d,0x61,0x74,0x68,0x2e,0x63,0x62,0x72,0x74,0x00,0x00,0x0a,0x4d,0x61,
+0x74,0x68,0x2e,0x68,0x79,0x70,0x6f,0x74,0x00,0x00,0x0f,0x4d,0x61,0x74,0x68,0x2e,
+0x66,0x72,0x65,0x78,0x70,0x20,0x31,0x32,0x33,0x34,0x00,0x00,0x0a,0x4d,0x61,0x74,
+0x68,0x2e,0x65,0x72,0x66,0x20,0x31,0x00,0x00,0x0b,0x4d,0x61,0x74,0x68,0x2e,0x65,
+0x72,0x66,0x63,0x20,0x31,0x00,0x00,0x0b,0x4d,0x61,0x74,0x68,0x2e,0x65,0x72,0x66,
+0x20,0x2d,0x31,0x00,0x00,0x0c,0x4d,0x61,0x74,0x68,0x2e,0x65,0x72,0x66,0x63,0x20,
+0x2d,0x31,0x00,0x00,0x08,0x54,0x69,0x6d,0x65,0x2e,0x6e,0x65,0x77,0x00,0x00,0x0a,
+0x31,0x35,0x2e,0x32,0x2e,0x33,0x2e,0x33,0x2e,0x33,0x00,0x00,0x04,0x54,0x69,0x6d,
+0x65,0x00,0x00,0x07,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x00,0x00,0x0f,0x54,0x69,
+0x6d,0x65,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x09,
+0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x32,0x00,0x00,0x07,0x54,0x69,0x6d,0x65,
+0x2e,0x61,0x74,0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x36,0x2e,
+0x31,0x00,0x00,0x07,0x54,0x69,0x6d,0x65,0x2e,0x67,0x6d,0x00,0x00,0x0b,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x39,0x2e,0x36,0x2e,0x32,0x00,0x00,0x0a,0x54,0x69,0x6d,0x65,
+0x2e,0x6c,0x6f,0x63,0x61,0x6c,0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,
+0x2e,0x36,0x2e,0x33,0x00,0x00,0x0b,0x54,0x69,0x6d,0x65,0x2e,0x6d,0x6b,0x74,0x69,
+0x6d,0x65,0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x36,0x2e,0x34,
+0x00,0x00,0x08,0x54,0x69,0x6d,0x65,0x2e,0x6e,0x6f,0x77,0x00,0x00,0x0b,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x39,0x2e,0x36,0x2e,0x35,0x00,0x00,0x08,0x54,0x69,0x6d,0x65,
+0x2e,0x75,0x74,0x63,0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x36,
+0x2e,0x36,0x00,0x00,0x06,0x54,0x69,0x6d,0x65,0x23,0x2b,0x00,0x00,0x0b,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x31,0x00,0x00,0x06,0x54,0x69,0x6d,0x65,
+0x23,0x2d,0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x32,
+0x00,0x00,0x08,0x54,0x69,0x6d,0x65,0x23,0x3c,0x3d,0x3e,0x00,0x00,0x0b,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x33,0x00,0x00,0x0c,0x54,0x69,0x6d,0x65,
+0x23,0x61,0x73,0x63,0x74,0x69,0x6d,0x65,0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,
+0x31,0x39,0x2e,0x37,0x2e,0x34,0x00,0x00,0x0a,0x54,0x69,0x6d,0x65,0x23,0x63,0x74,
+0x69,0x6d,0x65,0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,
+0x35,0x00,0x00,0x08,0x54,0x69,0x6d,0x65,0x23,0x64,0x61,0x79,0x00,0x00,0x0b,0x31,
+0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x36,0x00,0x00,0x09,0x54,0x69,0x6d,
+0x65,0x23,0x64,0x73,0x74,0x3f,0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,
+0x2e,0x37,0x2e,0x37,0x00,0x00,0x0a,0x54,0x69,0x6d,0x65,0x23,0x67,0x65,0x74,0x67,
+0x6d,0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x38,0x00,
+0x00,0x0d,0x54,0x69,0x6d,0x65,0x23,0x67,0x65,0x74,0x6c,0x6f,0x63,0x61,0x6c,0x00,
+0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x39,0x00,0x00,0x0b,
+0x54,0x69,0x6d,0x65,0x23,0x67,0x65,0x74,0x75,0x74,0x63,0x00,0x00,0x0c,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x31,0x30,0x00,0x00,0x09,0x54,0x69,0x6d,
+0x65,0x23,0x67,0x6d,0x74,0x3f,0x00,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,
+0x2e,0x37,0x2e,0x31,0x31,0x00,0x00,0x0b,0x54,0x69,0x6d,0x65,0x23,0x67,0x6d,0x74,
+0x69,0x6d,0x65,0x00,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,
+0x31,0x33,0x00,0x00,0x09,0x54,0x69,0x6d,0x65,0x23,0x68,0x6f,0x75,0x72,0x00,0x00,
+0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x31,0x35,0x00,0x00,0x14,
+0x54,0x69,0x6d,0x65,0x23,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x5f,
+0x63,0x6f,0x70,0x79,0x00,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,
+0x2e,0x31,0x37,0x00,0x00,0x0e,0x54,0x69,0x6d,0x65,0x23,0x6c,0x6f,0x63,0x61,0x6c,
+0x74,0x69,0x6d,0x65,0x00,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,
+0x2e,0x31,0x38,0x00,0x00,0x09,0x54,0x69,0x6d,0x65,0x23,0x6d,0x64,0x61,0x79,0x00,
+0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x31,0x39,0x00,0x00,
+0x08,0x54,0x69,0x6d,0x65,0x23,0x6d,0x69,0x6e,0x00,0x00,0x0c,0x31,0x35,0x2e,0x32,
+0x2e,0x31,0x39,0x2e,0x37,0x2e,0x32,0x30,0x00,0x00,0x08,0x54,0x69,0x6d,0x65,0x23,
+0x6d,0x6f,0x6e,0x00,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,
+0x32,0x31,0x00,0x00,0x0a,0x54,0x69,0x6d,0x65,0x23,0x6d,0x6f,0x6e,0x74,0x68,0x00,
+0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x32,0x32,0x00,0x00,
+0x09,0x54,0x69,0x6d,0x65,0x73,0x23,0x73,0x65,0x63,0x00,0x00,0x0c,0x31,0x35,0x2e,
+0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x32,0x33,0x00,0x00,0x09,0x54,0x69,0x6d,0x65,
+0x23,0x74,0x6f,0x5f,0x66,0x00,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,
+0x37,0x2e,0x32,0x34,0x00,0x00,0x09,0x54,0x69,0x6d,0x65,0x23,0x74,0x6f,0x5f,0x69,
+0x00,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x32,0x35,0x00,
+0x00,0x09,0x54,0x69,0x6d,0x65,0x23,0x75,0x73,0x65,0x63,0x00,0x00,0x0c,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x32,0x36,0x00,0x00,0x08,0x54,0x69,0x6d,
+0x65,0x23,0x75,0x74,0x63,0x00,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,
+0x37,0x2e,0x32,0x37,0x00,0x00,0x09,0x54,0x69,0x6d,0x65,0x23,0x75,0x74,0x63,0x3f,
+0x00,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x32,0x38,0x00,
+0x00,0x09,0x54,0x69,0x6d,0x65,0x23,0x77,0x64,0x61,0x79,0x00,0x00,0x0c,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x33,0x30,0x00,0x00,0x09,0x54,0x69,0x6d,
+0x65,0x23,0x79,0x64,0x61,0x79,0x00,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,
+0x2e,0x37,0x2e,0x33,0x31,0x00,0x00,0x09,0x54,0x69,0x6d,0x65,0x23,0x79,0x65,0x61,
+0x72,0x00,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x33,0x32,
+0x00,0x00,0x09,0x54,0x69,0x6d,0x65,0x23,0x7a,0x6f,0x6e,0x65,0x00,0x00,0x0c,0x31,
+0x35,0x2e,0x32,0x2e,0x31,0x39,0x2e,0x37,0x2e,0x33,0x33,0x00,0x00,0x09,0x54,0x69,
+0x6d,0x65,0x23,0x74,0x6f,0x5f,0x73,0x00,0x00,0x0c,0x54,0x69,0x6d,0x65,0x23,0x69,
+0x6e,0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x13,0x64,0x61,0x79,0x20,0x6f,0x66,0x20,
+0x77,0x65,0x65,0x6b,0x20,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x00,0x00,0x26,0x54,
+0x69,0x6d,0x65,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,0x73,0x20,0x73,0x75,0x72,0x76,
+0x69,0x76,0x65,0x20,0x47,0x43,0x20,0x61,0x6e,0x64,0x20,0x63,0x6f,0x6d,0x70,0x61,
+0x63,0x74,0x69,0x6f,0x6e,0x00,0x00,0x06,0x53,0x74,0x72,0x75,0x63,0x74,0x00,0x00,
+0x07,0x31,0x35,0x2e,0x32,0x2e,0x31,0x38,0x00,0x00,0x11,0x53,0x74,0x72,0x75,0x63,
+0x74,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x09,0x31,
+0x35,0x2e,0x32,0x2e,0x31,0x38,0x2e,0x32,0x00,0x00,0x0a,0x53,0x74,0x72,0x75,0x63,
+0x74,0x2e,0x6e,0x65,0x77,0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x38,0x2e,
+0x33,0x2e,0x31,0x00,0x00,0x09,0x53,0x74,0x72,0x75,0x63,0x74,0x23,0x3d,0x3d,0x00,
+0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x38,0x2e,0x34,0x2e,0x31,0x00,0x00,0x09,
+0x53,0x74,0x72,0x75,0x63,0x74,0x23,0x5b,0x5d,0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,
+0x2e,0x31,0x38,0x2e,0x34,0x2e,0x32,0x00,0x00,0x0a,0x53,0x74,0x72,0x75,0x63,0x74,
+0x23,0x5b,0x5d,0x3d,0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x38,0x2e,0x34,
+0x2e,0x33,0x00,0x00,0x0b,0x53,0x74,0x72,0x75,0x63,0x74,0x23,0x65,0x61,0x63,0x68,
+0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x38,0x2e,0x34,0x2e,0x34,0x00,0x00,
+0x10,0x53,0x74,0x72,0x75,0x63,0x74,0x23,0x65,0x61,0x63,0x68,0x5f,0x70,0x61,0x69,
+0x72,0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x38,0x2e,0x34,0x2e,0x35,0x00,
+0x00,0x0e,0x53,0x74,0x72,0x75,0x63,0x74,0x23,0x6d,0x65,0x6d,0x62,0x65,0x72,0x73,
+0x00,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x38,0x2e,0x34,0x2e,0x36,0x00,0x00,
+0x0d,0x53,0x74,0x72,0x75,0x63,0x74,0x23,0x73,0x65,0x6c,0x65,0x63,0x74,0x00,0x00,
+0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x38,0x2e,0x34,0x2e,0x37,0x00,0x00,0x0c,0x6c,
+0x61,0x72,0x67,0x65,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x16,0x77,0x72,
+0x6f,0x6e,0x67,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x61,0x72,0x67,0x20,0x63,
+0x6f,0x75,0x6e,0x74,0x00,0x00,0x0e,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x69,0x6e,
+0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x1a,0x53,0x74,0x72,0x75,0x63,0x74,0x23,0x6c,
+0x65,0x6e,0x67,0x74,0x68,0x2c,0x20,0x53,0x74,0x72,0x75,0x63,0x74,0x23,0x73,0x69,
+0x7a,0x65,0x00,0x00,0x1a,0x53,0x74,0x72,0x75,0x63,0x74,0x23,0x74,0x6f,0x5f,0x61,
+0x2c,0x20,0x53,0x74,0x72,0x75,0x63,0x74,0x23,0x76,0x61,0x6c,0x75,0x65,0x73,0x00,
+0x00,0x0b,0x53,0x74,0x72,0x75,0x63,0x74,0x23,0x74,0x6f,0x5f,0x68,0x00,0x00,0x10,
+0x53,0x74,0x72,0x75,0x63,0x74,0x23,0x76,0x61,0x6c,0x75,0x65,0x73,0x5f,0x61,0x74,
+0x00,0x00,0x0f,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x64,0x72,
+0x6f,0x70,0x00,0x00,0x15,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,
+0x64,0x72,0x6f,0x70,0x5f,0x77,0x68,0x69,0x6c,0x65,0x00,0x00,0x0f,0x45,0x6e,0x75,
+0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x74,0x61,0x6b,0x65,0x00,0x00,0x15,0x45,
+0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x74,0x61,0x6b,0x65,0x5f,0x77,
+0x68,0x69,0x6c,0x65,0x00,0x00,0x14,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,
+0x65,0x23,0x65,0x61,0x63,0x68,0x5f,0x63,0x6f,0x6e,0x73,0x00,0x00,0x15,0x45,0x6e,
+0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x65,0x61,0x63,0x68,0x5f,0x73,0x6c,
+0x69,0x63,0x65,0x00,0x00,0x13,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,
+0x23,0x67,0x72,0x6f,0x75,0x70,0x5f,0x62,0x79,0x00,0x00,0x12,0x45,0x6e,0x75,0x6d,
+0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x73,0x6f,0x72,0x74,0x5f,0x62,0x79,0x00,0x00,
+0x10,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x66,0x69,0x72,0x73,
+0x74,0x00,0x00,0x10,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x63,
+0x6f,0x75,0x6e,0x74,0x00,0x00,0x13,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,
+0x65,0x23,0x66,0x6c,0x61,0x74,0x5f,0x6d,0x61,0x70,0x00,0x00,0x11,0x45,0x6e,0x75,
+0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x6d,0x61,0x78,0x5f,0x62,0x79,0x00,0x00,
+0x11,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x6d,0x69,0x6e,0x5f,
+0x62,0x79,0x00,0x00,0x11,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,
+0x6d,0x69,0x6e,0x6d,0x61,0x78,0x00,0x00,0x14,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,
+0x62,0x6c,0x65,0x23,0x6d,0x69,0x6e,0x6d,0x61,0x78,0x5f,0x62,0x79,0x00,0x00,0x10,
+0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x6e,0x6f,0x6e,0x65,0x3f,
+0x00,0x00,0x0f,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x6f,0x6e,
+0x65,0x3f,0x00,0x00,0x1b,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,
+0x65,0x61,0x63,0x68,0x5f,0x77,0x69,0x74,0x68,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,
+0x00,0x00,0x17,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x72,0x65,
+0x76,0x65,0x72,0x73,0x65,0x5f,0x65,0x61,0x63,0x68,0x00,0x00,0x10,0x45,0x6e,0x75,
+0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x63,0x79,0x63,0x6c,0x65,0x00,0x00,0x15,
+0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x66,0x69,0x6e,0x64,0x5f,
+0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x0e,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,
+0x6c,0x65,0x23,0x7a,0x69,0x70,0x00,0x00,0x0e,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,
+0x67,0x65,0x74,0x62,0x79,0x74,0x65,0x00,0x00,0x0b,0x53,0x74,0x72,0x69,0x6e,0x67,
+0x23,0x64,0x75,0x6d,0x70,0x00,0x00,0x0c,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x73,
+0x74,0x72,0x69,0x70,0x00,0x00,0x0d,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x6c,0x73,
+0x74,0x72,0x69,0x70,0x00,0x00,0x0d,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x72,0x73,
+0x74,0x72,0x69,0x70,0x00,0x00,0x0d,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x73,0x74,
+0x72,0x69,0x70,0x21,0x00,0x00,0x0e,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x6c,0x73,
+0x74,0x72,0x69,0x70,0x21,0x00,0x00,0x0e,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x72,
+0x73,0x74,0x72,0x69,0x70,0x21,0x00,0x00,0x0f,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,
+0x73,0x77,0x61,0x70,0x63,0x61,0x73,0x65,0x00,0x00,0x10,0x53,0x74,0x72,0x69,0x6e,
+0x67,0x23,0x73,0x77,0x61,0x70,0x63,0x61,0x73,0x65,0x21,0x00,0x00,0x0d,0x53,0x74,
+0x72,0x69,0x6e,0x67,0x23,0x63,0x6f,0x6e,0x63,0x61,0x74,0x00,0x00,0x0e,0x53,0x74,
+0x72,0x69,0x6e,0x67,0x23,0x63,0x61,0x73,0x65,0x63,0x6d,0x70,0x00,0x00,0x12,0x53,
+0x74,0x72,0x69,0x6e,0x67,0x23,0x73,0x74,0x61,0x72,0x74,0x5f,0x77,0x69,0x74,0x68,
+0x3f,0x00,0x00,0x10,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x65,0x6e,0x64,0x5f,0x77,
+0x69,0x74,0x68,0x3f,0x00,0x00,0x10,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x70,0x61,
+0x72,0x74,0x69,0x74,0x69,0x6f,0x6e,0x00,0x00,0x11,0x53,0x74,0x72,0x69,0x6e,0x67,
+0x23,0x72,0x70,0x61,0x72,0x74,0x69,0x74,0x69,0x6f,0x6e,0x00,0x00,0x0a,0x53,0x74,
+0x72,0x69,0x6e,0x67,0x23,0x68,0x65,0x78,0x00,0x00,0x0a,0x53,0x74,0x72,0x69,0x6e,
+0x67,0x23,0x6f,0x63,0x74,0x00,0x00,0x0b,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,
+0x63,0x68,0x72,0x00,0x00,0x0b,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x64,0x69,
+0x76,0x00,0x00,0x09,0x46,0x6c,0x6f,0x61,0x74,0x23,0x64,0x69,0x76,0x00,0x00,0x06,
+0x42,0x69,0x67,0x6e,0x75,0x6d,0x00,0x00,0x22,0x46,0x69,0x78,0x6e,0x75,0x6d,0x20,
+0x6f,0x76,0x65,0x72,0x66,0x6c,0x6f,0x77,0x20,0x70,0x72,0x6f,0x6d,0x6f,0x74,0x65,
+0x73,0x20,0x74,0x6f,0x20,0x42,0x69,0x67,0x6e,0x75,0x6d,0x00,0x00,0x2a,0x49,0x6e,
+0x74,0x65,0x67,0x65,0x72,0x20,0x6c,0x69,0x74,0x65,0x72,0x61,0x6c,0x73,0x20,0x62,
+0x65,0x79,0x6f,0x6e,0x64,0x20,0x46,0x69,0x78,0x6e,0x75,0x6d,0x20,0x61,0x72,0x65,
+0x20,0x42,0x69,0x67,0x6e,0x75,0x6d,0x73,0x00,0x00,0x3a,0x49,0x6e,0x74,0x65,0x67,
+0x65,0x72,0x20,0x6c,0x69,0x74,0x65,0x72,0x61,0x6c,0x73,0x20,0x62,0x65,0x79,0x6f,
+0x6e,0x64,0x20,0x46,0x69,0x78,0x6e,0x75,0x6d,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,
+0x20,0x72,0x65,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x20,0x61,0x72,0x69,0x74,0x68,
+0x6d,0x65,0x74,0x69,0x63,0x00,0x00,0x28,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x74,
+0x6f,0x5f,0x69,0x20,0x62,0x65,0x79,0x6f,0x6e,0x64,0x20,0x46,0x69,0x78,0x6e,0x75,
+0x6d,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x73,0x20,0x42,0x69,0x67,0x6e,0x75,0x6d,
+0x00,0x00,0x10,0x42,0x69,0x67,0x6e,0x75,0x6d,0x23,0x2b,0x2c,0x20,0x23,0x2d,0x2c,
+0x20,0x23,0x2a,0x00,0x00,0x27,0x42,0x69,0x67,0x6e,0x75,0x6d,0x20,0x6d,0x75,0x6c,
+0x74,0x69,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x66,0x20,0x6c,
+0x61,0x72,0x67,0x65,0x20,0x6f,0x70,0x65,0x72,0x61,0x6e,0x64,0x73,0x00,0x00,0x17,
+0x42,0x69,0x67,0x6e,0x75,0x6d,0x23,0x64,0x69,0x76,0x2c,0x20,0x23,0x25,0x2c,0x20,
+0x23,0x64,0x69,0x76,0x6d,0x6f,0x64,0x00,0x00,0x0f,0x42,0x69,0x67,0x6e,0x75,0x6d,
+0x23,0x2a,0x2a,0x2c,0x20,0x23,0x70,0x6f,0x77,0x00,0x00,0x0b,0x42,0x69,0x67,0x6e,
+0x75,0x6d,0x23,0x74,0x6f,0x5f,0x73,0x00,0x00,0x15,0x42,0x69,0x67,0x6e,0x75,0x6d,
+0x20,0x62,0x69,0x74,0x20,0x6f,0x70,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,0x00,
+0x00,0x11,0x42,0x69,0x67,0x6e,0x75,0x6d,0x20,0x63,0x6f,0x6d,0x70,0x61,0x72,0x69,
+0x73,0x6f,0x6e,0x00,0x00,0x19,0x46,0x6c,0x6f,0x61,0x74,0x23,0x74,0x6f,0x5f,0x69,
+0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x73,0x20,0x42,0x69,0x67,0x6e,0x75,0x6d,0x00,
+0x00,0x12,0x41,0x72,0x72,0x61,0x79,0x3a,0x3a,0x74,0x72,0x79,0x5f,0x63,0x6f,0x6e,
+0x76,0x65,0x72,0x74,0x00,0x00,0x0b,0x41,0x72,0x72,0x61,0x79,0x23,0x61,0x73,0x73,
+0x6f,0x63,0x00,0x00,0x08,0x41,0x72,0x72,0x61,0x79,0x23,0x61,0x74,0x00,0x00,0x0c,
+0x41,0x72,0x72,0x61,0x79,0x23,0x72,0x61,0x73,0x73,0x6f,0x63,0x00,0x00,0x0b,0x41,
+0x72,0x72,0x61,0x79,0x23,0x75,0x6e,0x69,0x71,0x21,0x00,0x00,0x0a,0x41,0x72,0x72,
+0x61,0x79,0x23,0x75,0x6e,0x69,0x71,0x00,0x00,0x07,0x41,0x72,0x72,0x61,0x79,0x23,
+0x2d,0x00,0x00,0x07,0x41,0x72,0x72,0x61,0x79,0x23,0x7c,0x00,0x00,0x07,0x41,0x72,
+0x72,0x61,0x79,0x23,0x26,0x00,0x00,0x0d,0x41,0x72,0x72,0x61,0x79,0x23,0x66,0x6c,
+0x61,0x74,0x74,0x65,0x6e,0x00,0x00,0x0e,0x41,0x72,0x72,0x61,0x79,0x23,0x66,0x6c,
+0x61,0x74,0x74,0x65,0x6e,0x21,0x00,0x00,0x0d,0x41,0x72,0x72,0x61,0x79,0x23,0x63,
+0x6f,0x6d,0x70,0x61,0x63,0x74,0x00,0x00,0x0e,0x41,0x72,0x72,0x61,0x79,0x23,0x63,
+0x6f,0x6d,0x70,0x61,0x63,0x74,0x21,0x00,0x00,0x0b,0x41,0x72,0x72,0x61,0x79,0x23,
+0x66,0x65,0x74,0x63,0x68,0x00,0x00,0x0a,0x41,0x72,0x72,0x61,0x79,0x23,0x66,0x69,
+0x6c,0x6c,0x00,0x00,0x12,0x41,0x72,0x72,0x61,0x79,0x23,0x72,0x65,0x76,0x65,0x72,
+0x73,0x65,0x5f,0x65,0x61,0x63,0x68,0x00,0x00,0x0c,0x41,0x72,0x72,0x61,0x79,0x23,
+0x72,0x6f,0x74,0x61,0x74,0x65,0x00,0x00,0x0d,0x41,0x72,0x72,0x61,0x79,0x23,0x72,
+0x6f,0x74,0x61,0x74,0x65,0x21,0x00,0x00,0x0f,0x41,0x72,0x72,0x61,0x79,0x23,0x64,
+0x65,0x6c,0x65,0x74,0x65,0x5f,0x69,0x66,0x00,0x00,0x0d,0x41,0x72,0x72,0x61,0x79,
+0x23,0x72,0x65,0x6a,0x65,0x63,0x74,0x21,0x00,0x00,0x0c,0x41,0x72,0x72,0x61,0x79,
+0x23,0x69,0x6e,0x73,0x65,0x72,0x74,0x00,0x00,0x0d,0x41,0x72,0x72,0x61,0x79,0x23,
+0x62,0x73,0x65,0x61,0x72,0x63,0x68,0x00,0x00,0x0d,0x41,0x72,0x72,0x61,0x79,0x23,
+0x6b,0x65,0x65,0x70,0x5f,0x69,0x66,0x00,0x00,0x0d,0x41,0x72,0x72,0x61,0x79,0x23,
+0x73,0x65,0x6c,0x65,0x63,0x74,0x21,0x00,0x00,0x0f,0x41,0x72,0x72,0x61,0x79,0x23,
+0x76,0x61,0x6c,0x75,0x65,0x73,0x5f,0x61,0x74,0x00,0x00,0x0b,0x48,0x61,0x73,0x68,
+0x23,0x6d,0x65,0x72,0x67,0x65,0x21,0x00,0x00,0x0e,0x48,0x61,0x73,0x68,0x23,0x76,
+0x61,0x6c,0x75,0x65,0x73,0x5f,0x61,0x74,0x00,0x00,0x0a,0x48,0x61,0x73,0x68,0x23,
+0x66,0x65,0x74,0x63,0x68,0x00,0x00,0x0e,0x48,0x61,0x73,0x68,0x23,0x64,0x65,0x6c,
+0x65,0x74,0x65,0x5f,0x69,0x66,0x00,0x00,0x0c,0x48,0x61,0x73,0x68,0x23,0x66,0x6c,
+0x61,0x74,0x74,0x65,0x6e,0x00,0x00,0x0b,0x48,0x61,0x73,0x68,0x23,0x69,0x6e,0x76,
+0x65,0x72,0x74,0x00,0x00,0x0c,0x48,0x61,0x73,0x68,0x23,0x6b,0x65,0x65,0x70,0x5f,
+0x69,0x66,0x00,0x00,0x08,0x48,0x61,0x73,0x68,0x23,0x6b,0x65,0x79,0x00,0x00,0x0c,
+0x52,0x61,0x6e,0x67,0x65,0x23,0x63,0x6f,0x76,0x65,0x72,0x3f,0x00,0x00,0x0b,0x52,
+0x61,0x6e,0x67,0x65,0x23,0x66,0x69,0x72,0x73,0x74,0x00,0x00,0x0a,0x52,0x61,0x6e,
+0x67,0x65,0x23,0x6c,0x61,0x73,0x74,0x00,0x00,0x0e,0x53,0x79,0x6d,0x62,0x6f,0x6c,
+0x23,0x74,0x6f,0x5f,0x70,0x72,0x6f,0x63,0x00,0x00,0x12,0x53,0x79,0x6d,0x62,0x6f,
+0x6c,0x2e,0x61,0x6c,0x6c,0x5f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x73,0x00,0x00,0x0d,
+0x53,0x79,0x6d,0x62,0x6f,0x6c,0x23,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x11,
+0x53,0x79,0x6d,0x62,0x6f,0x6c,0x23,0x63,0x61,0x70,0x69,0x74,0x61,0x6c,0x69,0x7a,
+0x65,0x00,0x00,0x0f,0x53,0x79,0x6d,0x62,0x6f,0x6c,0x23,0x64,0x6f,0x77,0x6e,0x63,
+0x61,0x73,0x65,0x00,0x00,0x0d,0x53,0x79,0x6d,0x62,0x6f,0x6c,0x23,0x75,0x70,0x63,
+0x61,0x73,0x65,0x00,0x00,0x0e,0x53,0x79,0x6d,0x62,0x6f,0x6c,0x23,0x63,0x61,0x73,
+0x65,0x63,0x6d,0x70,0x00,0x00,0x0d,0x53,0x79,0x6d,0x62,0x6f,0x6c,0x23,0x65,0x6d,
+0x70,0x74,0x79,0x3f,0x00,0x00,0x0c,0x52,0x61,0x6e,0x64,0x6f,0x6d,0x23,0x73,0x72,
+0x61,0x6e,0x64,0x00,0x00,0x0d,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x3a,0x3a,0x73,0x72,
+0x61,0x6e,0x64,0x00,0x00,0x0d,0x52,0x61,0x6e,0x64,0x6f,0x6d,0x3a,0x3a,0x73,0x72,
+0x61,0x6e,0x64,0x00,0x00,0x06,0x66,0x69,0x78,0x6e,0x75,0x6d,0x00,0x00,0x05,0x66,
+0x6c,0x6f,0x61,0x74,0x00,0x00,0x0d,0x41,0x72,0x72,0x61,0x79,0x23,0x73,0x68,0x75,
+0x66,0x66,0x6c,0x65,0x00,0x00,0x0e,0x41,0x72,0x72,0x61,0x79,0x23,0x73,0x68,0x75,
+0x66,0x66,0x6c,0x65,0x21,0x00,0x00,0x15,0x41,0x72,0x72,0x61,0x79,0x23,0x73,0x68,
+0x75,0x66,0x66,0x6c,0x65,0x28,0x72,0x61,0x6e,0x64,0x6f,0x6d,0x29,0x00,0x00,0x16,
+0x41,0x72,0x72,0x61,0x79,0x23,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x21,0x28,0x72,
+0x61,0x6e,0x64,0x6f,0x6d,0x29,0x00,0x00,0x14,0x4f,0x62,0x6a,0x65,0x63,0x74,0x23,
+0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x65,0x78,0x65,0x63,0x00,0x00,0x0a,
+0x4f,0x62,0x6a,0x65,0x63,0x74,0x23,0x74,0x61,0x70,0x00,0x00,0x0d,0x4e,0x69,0x6c,
+0x43,0x6c,0x61,0x73,0x73,0x23,0x74,0x6f,0x5f,0x61,0x00,0x00,0x0d,0x4e,0x69,0x6c,
+0x43,0x6c,0x61,0x73,0x73,0x23,0x74,0x6f,0x5f,0x66,0x00,0x00,0x0d,0x4e,0x69,0x6c,
+0x43,0x6c,0x61,0x73,0x73,0x23,0x74,0x6f,0x5f,0x69,0x00,0x00,0x07,0x57,0x65,0x61,
+0x6b,0x52,0x65,0x66,0x00,0x00,0x1e,0x57,0x65,0x61,0x6b,0x52,0x65,0x66,0x20,0x69,
+0x73,0x20,0x63,0x6c,0x65,0x61,0x72,0x65,0x64,0x20,0x62,0x79,0x20,0x47,0x43,0x2e,
+0x73,0x74,0x61,0x72,0x74,0x00,0x00,0x35,0x57,0x65,0x61,0x6b,0x52,0x65,0x66,0x20,
+0x69,0x73,0x20,0x63,0x6c,0x65,0x61,0x72,0x65,0x64,0x20,0x62,0x79,0x20,0x69,0x6e,
+0x63,0x72,0x65,0x6d,0x65,0x6e,0x74,0x61,0x6c,0x20,0x61,0x6e,0x64,0x20,0x67,0x65,
+0x6e,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x20,0x47,0x43,0x00,0x00,0x0b,
+0x57,0x65,0x61,0x6b,0x52,0x65,0x66,0x23,0x64,0x75,0x70,0x00,0x00,0x09,0x46,0x69,
+0x62,0x65,0x72,0x2e,0x6e,0x65,0x77,0x00,0x00,0x0c,0x46,0x69,0x62,0x65,0x72,0x23,
+0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x0e,0x46,0x69,0x62,0x65,0x72,0x23,0x74,
+0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x00,0x00,0x0c,0x46,0x69,0x62,0x65,0x72,0x23,
+0x61,0x6c,0x69,0x76,0x65,0x3f,0x00,0x00,0x08,0x46,0x69,0x62,0x65,0x72,0x23,0x3d,
+0x3d,0x00,0x00,0x0b,0x46,0x69,0x62,0x65,0x72,0x2e,0x79,0x69,0x65,0x6c,0x64,0x00,
+0x00,0x0a,0x46,0x69,0x62,0x65,0x72,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0f,0x46,
+0x69,0x62,0x65,0x72,0x20,0x69,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x00,0x00,
+0x2b,0x46,0x69,0x62,0x65,0x72,0x20,0x77,0x69,0x74,0x68,0x20,0x73,0x70,0x6c,0x61,
+0x74,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x61,
+0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x20,0x6c,0x69,0x73,0x74,0x00,0x00,0x20,0x46,
+0x69,0x62,0x65,0x72,0x20,0x72,0x61,0x69,0x73,0x65,0x73,0x20,0x6f,0x6e,0x20,0x72,
+0x65,0x73,0x75,0x6d,0x65,0x20,0x77,0x68,0x65,0x6e,0x20,0x64,0x65,0x61,0x64,0x00,
+0x00,0x26,0x59,0x69,0x65,0x6c,0x64,0x20,0x72,0x61,0x69,0x73,0x65,0x73,0x20,0x77,
+0x68,0x65,0x6e,0x20,0x63,0x61,0x6c,0x6c,0x65,0x64,0x20,0x6f,0x6e,0x20,0x72,0x6f,
+0x6f,0x74,0x20,0x66,0x69,0x62,0x65,0x72,0x00,0x00,0x16,0x44,0x6f,0x75,0x62,0x6c,
+0x65,0x20,0x72,0x65,0x73,0x75,0x6d,0x65,0x20,0x6f,0x66,0x20,0x46,0x69,0x62,0x65,
+0x72,0x00,0x00,0x19,0x52,0x65,0x63,0x75,0x72,0x73,0x69,0x76,0x65,0x20,0x72,0x65,
+0x73,0x75,0x6d,0x65,0x20,0x6f,0x66,0x20,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x11,
+0x52,0x6f,0x6f,0x74,0x20,0x66,0x69,0x62,0x65,0x72,0x20,0x72,0x65,0x73,0x75,0x6d,
+0x65,0x00,0x00,0x13,0x46,0x69,0x62,0x65,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,
+0x74,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x11,0x54,0x72,0x61,0x6e,0x73,0x66,
+0x65,0x72,0x20,0x74,0x6f,0x20,0x73,0x65,0x6c,0x66,0x2e,0x00,0x00,0x18,0x52,0x65,
+0x73,0x75,0x6d,0x65,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x72,0x65,0x64,
+0x20,0x66,0x69,0x62,0x65,0x72,0x00,0x00,0x14,0x52,0x6f,0x6f,0x74,0x20,0x66,0x69,
+0x62,0x65,0x72,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x2e,0x00,0x00,0x2b,
+0x42,0x72,0x65,0x61,0x6b,0x20,0x6e,0x65,0x73,0x74,0x65,0x64,0x20,0x66,0x69,0x62,
+0x65,0x72,0x20,0x77,0x69,0x74,0x68,0x20,0x72,0x6f,0x6f,0x74,0x20,0x66,0x69,0x62,
+0x65,0x72,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x00,0x00,0x1a,0x43,0x52,
+0x75,0x62,0x79,0x20,0x46,0x69,0x62,0x65,0x72,0x23,0x74,0x72,0x61,0x6e,0x73,0x66,
+0x65,0x72,0x20,0x74,0x65,0x73,0x74,0x2e,0x00,0x00,0x3a,0x46,0x69,0x62,0x65,0x72,
+0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x69,0x6e,0x67,0x20,0x69,0x6e,0x73,0x69,0x64,
+0x65,0x20,0x47,0x43,0x2e,0x72,0x65,0x67,0x69,0x6f,0x6e,0x20,0x6b,0x65,0x65,0x70,
+0x73,0x20,0x69,0x74,0x73,0x20,0x63,0x61,0x70,0x74,0x75,0x72,0x65,0x64,0x20,0x6c,
+0x6f,0x63,0x61,0x6c,0x73,0x00,0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,
+0x6f,0x72,0x00,0x00,0x0e,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x2e,
+0x6e,0x65,0x77,0x00,0x00,0x1a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,
+0x23,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x5f,0x63,0x6f,0x70,0x79,
+0x00,0x00,0x15,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x23,0x77,0x69,
+0x74,0x68,0x5f,0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x23,0x45,0x6e,0x75,0x6d,0x65,
+0x72,0x61,0x74,0x6f,0x72,0x23,0x77,0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,0x65,0x78,
+0x20,0x6e,0x6f,0x6e,0x6e,0x75,0x6d,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x00,0x00,
+0x23,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x23,0x77,0x69,0x74,0x68,
+0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x20,0x6f,0x66,
+0x66,0x73,0x65,0x74,0x00,0x00,0x16,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,
+0x72,0x23,0x77,0x69,0x74,0x68,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x20,
+0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x23,0x77,0x69,0x74,0x68,0x5f,
+0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x73,
+0x00,0x00,0x12,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x23,0x69,0x6e,
+0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x0f,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,
+0x6f,0x72,0x23,0x65,0x61,0x63,0x68,0x00,0x00,0x19,0x45,0x6e,0x75,0x6d,0x65,0x72,
+0x61,0x74,0x6f,0x72,0x23,0x65,0x61,0x63,0x68,0x20,0x61,0x72,0x67,0x75,0x6d,0x65,
+0x6e,0x74,0x73,0x00,0x00,0x0f,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,
+0x23,0x6e,0x65,0x78,0x74,0x00,0x00,0x16,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,
+0x6f,0x72,0x23,0x6e,0x65,0x78,0x74,0x5f,0x76,0x61,0x6c,0x75,0x65,0x73,0x00,0x00,
+0x0f,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x23,0x70,0x65,0x65,0x6b,
+0x00,0x00,0x16,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x23,0x70,0x65,
+0x65,0x6b,0x20,0x6d,0x6f,0x64,0x69,0x66,0x79,0x00,0x00,0x16,0x45,0x6e,0x75,0x6d,
+0x65,0x72,0x61,0x74,0x6f,0x72,0x23,0x70,0x65,0x65,0x6b,0x5f,0x76,0x61,0x6c,0x75,
+0x65,0x73,0x00,0x00,0x1d,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x23,
+0x70,0x65,0x65,0x6b,0x5f,0x76,0x61,0x6c,0x75,0x65,0x73,0x20,0x6d,0x6f,0x64,0x69,
+0x66,0x79,0x00,0x00,0x0f,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x23,
+0x66,0x65,0x65,0x64,0x00,0x00,0x15,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,
+0x72,0x23,0x66,0x65,0x65,0x64,0x20,0x6d,0x69,0x78,0x65,0x64,0x00,0x00,0x15,0x45,
+0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x23,0x66,0x65,0x65,0x64,0x20,0x74,
+0x77,0x69,0x63,0x65,0x00,0x00,0x21,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,
+0x72,0x23,0x66,0x65,0x65,0x64,0x20,0x62,0x65,0x66,0x6f,0x72,0x65,0x20,0x66,0x69,
+0x72,0x73,0x74,0x20,0x6e,0x65,0x78,0x74,0x00,0x00,0x17,0x45,0x6e,0x75,0x6d,0x65,
+0x72,0x61,0x74,0x6f,0x72,0x23,0x66,0x65,0x65,0x64,0x20,0x79,0x69,0x65,0x6c,0x64,
+0x65,0x72,0x00,0x00,0x11,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x23,
+0x72,0x65,0x77,0x69,0x6e,0x64,0x00,0x00,0x1c,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,
+0x74,0x6f,0x72,0x23,0x72,0x65,0x77,0x69,0x6e,0x64,0x20,0x63,0x6c,0x65,0x61,0x72,
+0x20,0x66,0x65,0x65,0x64,0x00,0x00,0x17,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,
+0x6f,0x72,0x23,0x72,0x65,0x77,0x69,0x6e,0x64,0x20,0x63,0x6c,0x65,0x61,0x72,0x00,
+0x00,0x15,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x3a,0x3a,0x47,0x65,
+0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x1a,0x45,0x6e,0x75,0x6d,0x65,0x72,
+0x61,0x74,0x6f,0x72,0x3a,0x3a,0x47,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x20,
+0x61,0x72,0x67,0x73,0x00,0x00,0x13,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,
+0x72,0x3a,0x3a,0x59,0x69,0x65,0x6c,0x64,0x65,0x72,0x00,0x00,0x18,0x6e,0x65,0x78,
+0x74,0x20,0x61,0x66,0x74,0x65,0x72,0x20,0x53,0x74,0x6f,0x70,0x49,0x74,0x65,0x72,
+0x61,0x74,0x69,0x6f,0x6e,0x00,0x00,0x02,0x67,0x63,0x00,0x00,0x10,0x6e,0x65,0x73,
+0x74,0x65,0x64,0x20,0x69,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x00,0x00,0x0e,
+0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,
+0x1a,0x6d,0x6f,0x64,0x69,0x66,0x79,0x69,0x6e,0x67,0x20,0x65,0x78,0x69,0x73,0x74,
+0x69,0x6e,0x67,0x20,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x00,0x00,0x0e,0x49,0x6e,
+0x74,0x65,0x67,0x72,0x61,0x6c,0x23,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x1a,0x45,
+0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x65,0x61,0x63,0x68,0x5f,0x77,
+0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x0e,0x45,0x6e,0x75,0x6d,
+0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x6d,0x61,0x70,0x00,0x00,0x13,0x45,0x6e,0x75,
+0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x66,0x69,0x6e,0x64,0x5f,0x61,0x6c,0x6c,
+0x00,0x00,0x10,0x41,0x72,0x72,0x61,0x79,0x23,0x65,0x61,0x63,0x68,0x5f,0x69,0x6e,
+0x64,0x65,0x78,0x00,0x00,0x0a,0x41,0x72,0x72,0x61,0x79,0x23,0x6d,0x61,0x70,0x21,
+0x00,0x00,0x09,0x48,0x61,0x73,0x68,0x23,0x65,0x61,0x63,0x68,0x00,0x00,0x0d,0x48,
+0x61,0x73,0x68,0x23,0x65,0x61,0x63,0x68,0x5f,0x6b,0x65,0x79,0x00,0x00,0x0f,0x48,
+0x61,0x73,0x68,0x23,0x65,0x61,0x63,0x68,0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,
+0x0b,0x48,0x61,0x73,0x68,0x23,0x73,0x65,0x6c,0x65,0x63,0x74,0x00,0x00,0x0c,0x48,
+0x61,0x73,0x68,0x23,0x73,0x65,0x6c,0x65,0x63,0x74,0x21,0x00,0x00,0x0b,0x48,0x61,
+0x73,0x68,0x23,0x72,0x65,0x6a,0x65,0x63,0x74,0x00,0x00,0x0c,0x48,0x61,0x73,0x68,
+0x23,0x72,0x65,0x6a,0x65,0x63,0x74,0x21,0x00,0x00,0x0a,0x52,0x61,0x6e,0x67,0x65,
+0x23,0x65,0x61,0x63,0x68,0x00,0x00,0x10,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,
+0x6c,0x65,0x3a,0x3a,0x4c,0x61,0x7a,0x79,0x00,0x00,0x19,0x45,0x6e,0x75,0x6d,0x65,
+0x72,0x61,0x62,0x6c,0x65,0x3a,0x3a,0x4c,0x61,0x7a,0x79,0x20,0x6c,0x61,0x7a,0x69,
+0x6e,0x65,0x73,0x73,0x00,0x00,0x1f,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,
+0x65,0x3a,0x3a,0x4c,0x61,0x7a,0x79,0x23,0x7a,0x69,0x70,0x20,0x77,0x69,0x74,0x68,
+0x20,0x63,0x79,0x63,0x6c,0x65,0x00,0x00,0x10,0x54,0x6f,0x70,0x6c,0x65,0x76,0x65,
+0x6c,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x18,0x4b,0x65,0x72,0x6e,
+0x65,0x6c,0x2e,0x66,0x61,0x69,0x6c,0x2c,0x20,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,
+0x66,0x61,0x69,0x6c,0x00,0x00,0x11,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x5f,0x5f,
+0x6d,0x65,0x74,0x68,0x6f,0x64,0x5f,0x5f,0x00,0x00,0x00,0x08,0x00,0x06,0x61,0x73,
+0x73,0x65,0x72,0x74,0x00,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,
+0x61,0x74,0x00,0x00,0x0e,0x62,0x69,0x67,0x6e,0x75,0x6d,0x5f,0x6c,0x69,0x74,0x65,
+0x72,0x61,0x6c,0x00,0x00,0x12,0x77,0x65,0x61,0x6b,0x72,0x65,0x66,0x5f,0x74,0x6f,
+0x5f,0x67,0x61,0x72,0x62,0x61,0x67,0x65,0x00,0x00,0x0f,0x77,0x65,0x61,0x6b,0x72,
+0x65,0x66,0x5f,0x63,0x6f,0x6c,0x6c,0x65,0x63,0x74,0x00,0x00,0x06,0x4f,0x62,0x6a,
+0x65,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x40,0x6f,0x62,0x6a,
+0x00,0x00,0x00,0x03,0x1b,0x00,0x01,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x44,0x00,
+0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0xbd,0x02,
+0x80,0x01,0x02,0x01,0x80,0x41,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,
+0x00,0x01,0xbd,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x3d,0x02,0x80,0x02,0x82,0x01,
+0x80,0x41,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x03,0x3d,0x01,
+0x80,0x00,0x06,0x02,0x00,0x03,0xbd,0x02,0x80,0x04,0x02,0x01,0x80,0x41,0x20,0x00,
+0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x04,0xbd,0x01,0x80,0x00,0x06,0x02,
+0x00,0x05,0x3d,0x02,0x80,0x05,0x82,0x01,0x80,0x41,0x20,0x00,0x80,0x01,0x20,0x00,
+0x80,0x00,0x06,0x01,0x00,0x06,0x3d,0x01,0x80,0x00,0x06,0x02,0x00,0x06,0xbd,0x02,
+0x80,0x07,0x02,0x03,0x00,0x07,0x82,0x01,0x80,0x41,0xa0,0x00,0x80,0x01,0x20,0x00,
+0x80,0x00,0x06,0x01,0x00,0x08,0x3d,0x01,0x80,0x00,0x06,0x02,0x00,0x08,0xbd,0x02,
+0x80,0x09,0x02,0x01,0x80,0x41,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,
+0x00,0x09,0xbd,0x01,0x80,0x00,0x06,0x02,0x00,0x0a,0x3d,0x02,0x80,0x0a,0x82,0x01,
+0x80,0x41,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x0b,0x3d,0x01,
+0x80,0x00,0x06,0x02,0x00,0x0b,0xbd,0x02,0x80,0x0c,0x02,0x03,0x00,0x09,0x02,0x01,
+0x80,0x41,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x0c,0xbd,0x01,
+0x80,0x00,0x06,0x02,0x00,0x0d,0x3d,0x02,0x80,0x0d,0x82,0x03,0x00,0x0e,0x02,0x03,
+0x80,0x07,0x02,0x01,0x80,0x42,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x1d,0x00,0x00,0x08,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x30,0x00,0x00,
+0x02,0x25,0x66,0x02,0x00,0x16,0x33,0x2e,0x31,0x34,0x31,0x35,0x38,0x39,0x39,0x39,
+0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x65,0x2b,0x30,0x30,0x00,0x00,0x0a,0x2d,
+0x31,0x2e,0x32,0x33,0x35,0x65,0x2b,0x30,0x34,0x00,0x00,0x04,0x25,0x2e,0x33,0x65,
+0x02,0x00,0x17,0x2d,0x31,0x2e,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x34,0x00,0x00,0x06,0x30,0x2e,0x30,
+0x30,0x30,0x31,0x00,0x00,0x02,0x25,0x67,0x02,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,
+0x34,0x00,0x00,0x05,0x31,0x45,0x2d,0x31,0x30,0x00,0x00,0x02,0x25,0x47,0x02,0x00,
+0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x65,0x2d,0x31,0x30,0x00,0x00,0x15,0x20,0x20,0x20,0x20,0x20,0x20,
+0x32,0x2e,0x35,0x30,0x7c,0x2d,0x32,0x2e,0x35,0x30,0x20,0x20,0x20,0x20,0x20,0x00,
+0x00,0x0e,0x25,0x31,0x30,0x2e,0x32,0x66,0x7c,0x25,0x2d,0x31,0x30,0x2e,0x32,0x66,
+0x02,0x00,0x16,0x32,0x2e,0x35,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x02,0x00,0x17,0x2d,0x32,0x2e,0x35,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,
+0x2b,0x30,0x30,0x00,0x00,0x0a,0x2b,0x30,0x30,0x30,0x30,0x31,0x2e,0x35,0x30,0x30,
+0x00,0x00,0x08,0x25,0x2b,0x30,0x31,0x30,0x2e,0x33,0x66,0x02,0x00,0x16,0x31,0x2e,
+0x35,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x65,0x2b,0x30,0x30,0x00,0x00,0x07,0x20,0x31,0x30,0x30,0x30,0x30,0x30,0x00,0x00,
+0x03,0x25,0x20,0x67,0x02,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x35,0x00,0x00,0x0a,
+0x32,0x2e,0x7c,0x31,0x2e,0x35,0x30,0x30,0x30,0x30,0x00,0x00,0x09,0x25,0x23,0x2e,
+0x30,0x66,0x7c,0x25,0x23,0x67,0x02,0x00,0x16,0x32,0x2e,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,
+0x00,0x0a,0x30,0x2e,0x31,0x32,0x7c,0x30,0x2e,0x32,0x7c,0x32,0x00,0x00,0x0e,0x25,
+0x2e,0x32,0x66,0x7c,0x25,0x2e,0x31,0x66,0x7c,0x25,0x2e,0x30,0x66,0x02,0x00,0x16,
+0x31,0x2e,0x32,0x35,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x65,0x2d,0x30,0x31,0x02,0x00,0x16,0x32,0x2e,0x35,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x31,0x00,
+0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x07,0x73,0x70,0x72,0x69,0x6e,0x74,0x66,0x00,0x00,0x00,0x01,0x14,
+0x00,0x01,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x80,0x00,0x02,0x01,0x00,
+0x00,0x82,0x00,0x80,0x00,0xac,0x01,0x00,0x00,0x02,0x00,0x80,0x40,0xb5,0x00,0xc0,
+0x00,0x99,0x00,0x40,0x01,0x97,0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x3d,0x00,0x80,
+0x80,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x01,0xbd,0x01,0x80,0x00,0x06,0x02,0x00,
+0x02,0x3d,0x02,0x80,0x02,0x82,0x01,0x81,0x01,0x20,0x00,0x80,0xc1,0x20,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x06,0x02,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x02,
+0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x31,0x65,0x2d,0x31,0x35,0x00,0x00,0x19,0x46,0x6c,0x6f,0x61,0x74,
+0x20,0x69,0x73,0x20,0x73,0x69,0x6e,0x67,0x6c,0x65,0x20,0x70,0x72,0x65,0x63,0x69,
+0x73,0x69,0x6f,0x6e,0x00,0x00,0x1b,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x35,0x32,0x35,0x30,0x65,0x2b,0x33,
+0x30,0x30,0x00,0x00,0x05,0x25,0x2e,0x32,0x30,0x65,0x02,0x00,0x17,0x31,0x2e,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x31,0x65,
+0x2b,0x33,0x30,0x30,0x00,0x00,0x00,0x05,0x00,0x01,0x2b,0x00,0x00,0x01,0x3e,0x00,
+0x00,0x04,0x73,0x6b,0x69,0x70,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x07,0x73,0x70,0x72,0x69,0x6e,0x74,0x66,0x00,
+0x00,0x00,0x03,0xb6,0x00,0x02,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x6b,0x01,0x00,
+0x00,0x11,0x01,0x80,0x01,0x04,0x01,0x00,0x40,0xa0,0x01,0x40,0x32,0x99,0x01,0x40,
+0x00,0x83,0x01,0xc0,0x22,0x83,0x01,0x00,0xc0,0xa0,0x00,0x80,0x80,0x01,0x01,0x00,
+0x00,0x06,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0x06,0x02,0x80,0x00,0xbd,0x03,0x00,
+0x40,0x01,0x02,0x01,0x41,0x20,0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,
+0x01,0x3d,0x02,0x00,0x00,0x06,0x02,0x80,0x01,0xbd,0x03,0x00,0x40,0x01,0x03,0x01,
+0x80,0x20,0x02,0x01,0x41,0x20,0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,
+0x02,0x3d,0x02,0x00,0x00,0x06,0x02,0x80,0x02,0xbd,0x03,0x00,0x40,0x01,0x02,0x01,
+0x41,0x20,0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x03,0x3d,0x02,0x00,
+0x00,0x06,0x02,0x80,0x02,0xbd,0x03,0x00,0x40,0x01,0x03,0x01,0x80,0x20,0x02,0x01,
+0x41,0x20,0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x03,0xbd,0x02,0x00,
+0x00,0x06,0x02,0x80,0x04,0x3d,0x03,0x00,0x40,0x01,0x02,0x01,0x41,0x20,0x01,0x01,
+0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x04,0xbd,0x02,0x00,0x00,0x06,0x02,0x80,
+0x05,0x3d,0x03,0x00,0x40,0x01,0x03,0x01,0x80,0x20,0x02,0x01,0x41,0x20,0x01,0x01,
+0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x05,0xbd,0x02,0x00,0x06,0x3d,0x02,0xc0,
+0x22,0x83,0x02,0x02,0x00,0xb0,0x01,0x81,0xc0,0xac,0x02,0x00,0x00,0x06,0x02,0x80,
+0x06,0xbd,0x03,0x00,0x40,0x01,0x02,0x01,0x41,0x20,0x01,0x01,0x01,0x20,0x01,0x00,
+0x00,0x06,0x01,0x80,0x07,0x3d,0x02,0x00,0x00,0x06,0x02,0x80,0x07,0xbd,0x03,0x00,
+0x40,0x01,0x02,0x01,0x41,0x20,0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,
+0x08,0x3d,0x02,0x00,0x00,0x06,0x02,0x80,0x08,0xbd,0x03,0x00,0x40,0x01,0x02,0x01,
+0x41,0x20,0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x09,0x3d,0x02,0x00,
+0x00,0x06,0x02,0x80,0x09,0xbd,0x03,0x00,0x40,0x01,0x03,0x01,0x80,0x20,0x02,0x01,
+0x41,0x20,0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x0a,0x3d,0x02,0x00,
+0x00,0x06,0x02,0x80,0x0a,0xbd,0x03,0x00,0x40,0x01,0x03,0x01,0x80,0x20,0x02,0x01,
+0x41,0x20,0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x0b,0x3d,0x02,0x00,
+0x00,0x06,0x02,0x80,0x00,0xbd,0x03,0x00,0x0b,0x82,0x03,0x80,0x0c,0x02,0x04,0x40,
+0x20,0x83,0x03,0x80,0xc0,0xa0,0x03,0x02,0x00,0xb0,0x02,0x01,0x41,0x20,0x01,0x01,
+0x01,0x20,0x01,0x00,0x00,0x07,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x19,0x00,0x00,
+0x16,0x31,0x31,0x38,0x30,0x35,0x39,0x31,0x36,0x32,0x30,0x37,0x31,0x37,0x34,0x31,
+0x31,0x33,0x30,0x33,0x34,0x32,0x34,0x00,0x00,0x02,0x25,0x64,0x00,0x00,0x17,0x2d,
+0x31,0x31,0x38,0x30,0x35,0x39,0x31,0x36,0x32,0x30,0x37,0x31,0x37,0x34,0x31,0x31,
+0x33,0x30,0x33,0x34,0x32,0x34,0x00,0x00,0x02,0x25,0x69,0x00,0x00,0x18,0x32,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x00,0x00,0x02,0x25,0x6f,0x00,0x00,0x1b,0x2e,0x2e,
+0x37,0x36,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x00,0x00,0x14,0x30,0x78,0x34,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x00,0x00,0x03,0x25,0x23,0x78,0x00,0x00,0x15,0x2e,0x2e,0x46,0x43,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x00,0x00,
+0x02,0x25,0x58,0x00,0x00,0x01,0x31,0x00,0x00,0x01,0x30,0x00,0x00,0x02,0x25,0x62,
+0x00,0x00,0x17,0x2b,0x31,0x31,0x38,0x30,0x35,0x39,0x31,0x36,0x32,0x30,0x37,0x31,
+0x37,0x34,0x31,0x31,0x33,0x30,0x33,0x34,0x32,0x34,0x00,0x00,0x03,0x25,0x2b,0x64,
+0x00,0x00,0x1f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x31,0x31,0x38,0x30,0x35,
+0x39,0x31,0x36,0x32,0x30,0x37,0x31,0x37,0x34,0x31,0x31,0x33,0x30,0x33,0x34,0x32,
+0x34,0x7c,0x00,0x00,0x05,0x25,0x33,0x30,0x64,0x7c,0x00,0x00,0x1a,0x2d,0x30,0x30,
+0x30,0x31,0x31,0x38,0x30,0x35,0x39,0x31,0x36,0x32,0x30,0x37,0x31,0x37,0x34,0x31,
+0x31,0x33,0x30,0x33,0x34,0x32,0x34,0x00,0x00,0x05,0x25,0x2e,0x32,0x35,0x64,0x00,
+0x00,0x1e,0x20,0x20,0x20,0x20,0x20,0x2e,0x2e,0x66,0x66,0x66,0x66,0x66,0x63,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x00,0x00,0x07,0x25,0x33,0x30,0x2e,0x32,0x35,0x78,0x00,0x00,0x15,0x32,0x32,0x31,
+0x33,0x36,0x30,0x39,0x32,0x38,0x38,0x38,0x34,0x35,0x31,0x34,0x36,0x31,0x39,0x33,
+0x39,0x32,0x02,0x00,0x16,0x33,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x02,0x00,0x16,0x32,0x2e,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x09,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,
+0x00,0x00,0x0e,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,
+0x3f,0x00,0x00,0x06,0x42,0x69,0x67,0x6e,0x75,0x6d,0x00,0x00,0x02,0x2a,0x2a,0x00,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,
+0x07,0x73,0x70,0x72,0x69,0x6e,0x74,0x66,0x00,0x00,0x02,0x2d,0x40,0x00,0x00,0x01,
+0x2b,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x01,0xe4,0x00,0x01,0x00,0x08,0x00,0x00,
+0x00,0x00,0x00,0x3d,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0x06,
+0x02,0x00,0x00,0xbd,0x02,0xc0,0x00,0x83,0x03,0x40,0x09,0x83,0x02,0x80,0x80,0xa0,
+0x01,0x80,0x41,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x3d,
+0x01,0x80,0x00,0x06,0x02,0x00,0x00,0xbd,0x02,0xc0,0x00,0x83,0x03,0x40,0x09,0x83,
+0x02,0x80,0x80,0xa0,0x02,0x80,0xc0,0x20,0x01,0x80,0x41,0x20,0x00,0x80,0x01,0x20,
+0x00,0x80,0x00,0x06,0x01,0x00,0x01,0xbd,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x3d,
+0x02,0xc0,0x00,0x83,0x03,0x40,0x09,0x83,0x02,0x80,0x80,0xa0,0x02,0x80,0xc0,0x20,
+0x01,0x80,0x41,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x02,0xbd,
+0x01,0x80,0x00,0x06,0x02,0x00,0x00,0xbd,0x02,0xc0,0x00,0x83,0x03,0x40,0x0f,0x03,
+0x02,0x80,0x80,0xa0,0x02,0x81,0x00,0xaf,0x01,0x80,0x41,0x20,0x00,0x80,0x01,0x20,
+0x00,0x80,0x00,0x06,0x01,0x00,0x03,0x3d,0x01,0x80,0x00,0x06,0x02,0x00,0x03,0xbd,
+0x02,0xbf,0xfd,0x03,0x01,0x80,0x41,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,
+0x01,0x00,0x04,0x3d,0x01,0x80,0x00,0x06,0x02,0x00,0x04,0xbd,0x02,0xbf,0xfd,0x03,
+0x01,0x80,0x41,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x05,0x3d,
+0x01,0x80,0x00,0x06,0x02,0x00,0x05,0xbd,0x02,0xc0,0x02,0x03,0x01,0x80,0x41,0x20,
+0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x0c,0x00,0x00,0x15,0x31,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x00,0x00,0x02,0x25,0x62,0x00,0x00,0x17,0x2e,0x2e,0x31,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x00,0x00,0x16,0x2d,0x31,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x00,0x00,0x03,0x25,
+0x2b,0x62,0x00,0x00,0x1f,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,
+0x31,0x31,0x31,0x31,0x00,0x00,0x09,0x2d,0x30,0x30,0x30,0x30,0x30,0x31,0x30,0x31,
+0x00,0x00,0x05,0x25,0x2b,0x2e,0x38,0x62,0x00,0x00,0x08,0x2e,0x2e,0x31,0x31,0x31,
+0x30,0x31,0x31,0x00,0x00,0x04,0x25,0x2e,0x38,0x62,0x00,0x00,0x0a,0x30,0x62,0x30,
+0x30,0x30,0x30,0x30,0x31,0x30,0x31,0x00,0x00,0x05,0x25,0x23,0x2e,0x38,0x62,0x00,
+0x00,0x00,0x05,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x07,0x73,0x70,0x72,0x69,0x6e,0x74,0x66,0x00,0x00,0x02,0x2a,0x2a,
+0x00,0x00,0x02,0x2d,0x40,0x00,0x00,0x01,0x2d,0x00,0x00,0x00,0x00,0xac,0x00,0x05,
+0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x19,0x04,0x00,0x00,0x26,0x02,0x80,0x00,0x91,
+0x02,0x80,0x00,0x13,0x02,0x01,0x40,0x01,0x02,0x80,0x40,0x01,0x02,0x80,0x80,0x20,
+0x00,0x81,0x40,0x01,0x02,0x80,0x80,0x01,0x02,0x80,0x80,0x20,0x01,0x01,0x40,0x01,
+0x02,0x80,0x40,0x01,0x02,0x80,0xc0,0x20,0x02,0xc0,0x01,0x19,0x02,0x80,0x80,0x01,
+0x02,0x80,0xc0,0x20,0x02,0xc0,0x03,0x99,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,
+0x02,0x81,0x00,0xae,0x02,0x81,0x40,0x20,0x03,0x01,0x00,0x01,0x02,0x81,0x80,0xb3,
+0x00,0x40,0x00,0x97,0x02,0x80,0x00,0x07,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x07,0x00,0x09,0x54,0x4f,0x4c,0x45,0x52,0x41,0x4e,0x43,0x45,0x00,
+0x00,0x04,0x4d,0x61,0x74,0x68,0x00,0x00,0x04,0x74,0x6f,0x5f,0x66,0x00,0x00,0x07,
+0x66,0x69,0x6e,0x69,0x74,0x65,0x3f,0x00,0x00,0x01,0x2d,0x00,0x00,0x03,0x61,0x62,
+0x73,0x00,0x00,0x01,0x3c,0x00,0x00,0x00,0x00,0x4d,0x00,0x01,0x00,0x05,0x00,0x00,
+0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0xbf,0xff,0x83,
+0x01,0x00,0x80,0xa0,0x01,0xbf,0xff,0x83,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,
+0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,0x61,0x74,0x68,0x00,0x00,0x03,0x73,
+0x69,0x6e,0x00,0x00,0x00,0x00,0x62,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,
+0x0a,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x00,0x91,0x01,0x80,0x01,
+0x93,0x02,0x40,0x00,0x83,0x01,0x81,0x00,0xb1,0x01,0x00,0x80,0xa0,0x01,0xc0,0x00,
+0x03,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x05,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,
+0x04,0x4d,0x61,0x74,0x68,0x00,0x00,0x03,0x73,0x69,0x6e,0x00,0x00,0x02,0x50,0x49,
+0x00,0x00,0x01,0x2f,0x00,0x00,0x00,0x00,0x3e,0x00,0x02,0x00,0x04,0x00,0x01,0x00,
+0x00,0x00,0x07,0x00,0x80,0x00,0x07,0x01,0x40,0x06,0x03,0x01,0x00,0x00,0x12,0x01,
+0x00,0x00,0x11,0x01,0x80,0x01,0x40,0x01,0x00,0x40,0x21,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x4e,0x00,0x00,0x05,0x74,0x69,0x6d,
+0x65,0x73,0x00,0x00,0x00,0x01,0xcb,0x00,0x08,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,
+0x5b,0x02,0x00,0x00,0x26,0x04,0x00,0x00,0x91,0x04,0x00,0x00,0x13,0x04,0x80,0x01,
+0x91,0x04,0x00,0x80,0xb1,0x04,0x80,0x40,0x01,0x04,0x01,0x00,0xb0,0x01,0x82,0x00,
+0x01,0x04,0x00,0x00,0x91,0x04,0x00,0x00,0x13,0x04,0xc0,0x00,0x83,0x04,0x00,0x80,
+0xb1,0x04,0x80,0xc0,0x01,0x04,0x01,0x40,0xae,0x02,0x02,0x00,0x01,0x04,0x00,0x00,
+0x91,0x04,0x80,0xc0,0x01,0x04,0x01,0x80,0xa0,0x02,0x82,0x00,0x01,0x04,0x00,0x00,
+0x91,0x04,0x80,0xc0,0x01,0x04,0x01,0xc0,0xa0,0x03,0x02,0x00,0x01,0x04,0x00,0x00,
+0x91,0x04,0x80,0xc0,0x01,0x04,0x02,0x00,0xa0,0x03,0x82,0x00,0x01,0x04,0x00,0x40,
+0x15,0x04,0x80,0x00,0x06,0x05,0x01,0x40,0x01,0x05,0x80,0x00,0x91,0x06,0x01,0x00,
+0x01,0x05,0x81,0xc0,0xa0,0x04,0x82,0x41,0x20,0x04,0x02,0x80,0xa0,0x04,0x00,0x40,
+0x16,0x04,0x00,0x40,0x15,0x04,0x80,0x00,0x06,0x05,0x01,0xc0,0x01,0x05,0xc0,0x00,
+0x03,0x06,0x00,0x00,0x91,0x06,0x81,0x00,0x01,0x06,0x02,0x00,0xa0,0x05,0x80,0x80,
+0xb1,0x04,0x82,0x41,0x20,0x04,0x02,0x80,0xa0,0x04,0x00,0x40,0x16,0x04,0x00,0x40,
+0x15,0x04,0x80,0x00,0x06,0x05,0x01,0x40,0x01,0x05,0xc0,0x00,0x83,0x05,0x02,0xc0,
+0xa0,0x05,0x81,0x80,0x01,0x06,0x40,0x00,0x83,0x05,0x82,0xc0,0xa0,0x05,0x03,0x00,
+0xac,0x05,0xc0,0x00,0x03,0x04,0x82,0x41,0x20,0x04,0x02,0x80,0xa0,0x04,0x00,0x40,
+0x16,0x04,0x00,0x40,0x15,0x04,0x80,0x00,0x06,0x05,0x01,0xc0,0x01,0x05,0xc0,0x00,
+0x83,0x05,0x02,0xc0,0xa0,0x05,0x03,0x00,0xad,0x05,0xc0,0x00,0x03,0x06,0x01,0x80,
+0x01,0x05,0x80,0x80,0xb1,0x06,0x40,0x00,0x83,0x05,0x82,0xc0,0xa0,0x04,0x82,0x41,
+0x20,0x04,0x02,0x80,0xa0,0x04,0x00,0x40,0x16,0x04,0x00,0x40,0x15,0x04,0x80,0x00,
+0x06,0x05,0x40,0x00,0x03,0x05,0x81,0xc0,0x01,0x05,0x00,0x80,0xb1,0x05,0xc0,0x00,
+0x83,0x05,0x02,0xc0,0xa0,0x05,0x03,0x00,0xad,0x05,0xc0,0x00,0x03,0x06,0x01,0x40,
+0x01,0x05,0x80,0x80,0xb1,0x06,0x40,0x00,0x83,0x05,0x82,0xc0,0xa0,0x04,0x82,0x41,
+0x20,0x04,0x02,0x80,0xa0,0x04,0x00,0x40,0x16,0x04,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x00,0x02,0x50,0x49,0x00,0x00,0x04,0x4d,0x61,0x74,0x68,
+0x00,0x00,0x01,0x2f,0x00,0x00,0x01,0x4e,0x00,0x00,0x01,0x2a,0x00,0x00,0x01,0x2d,
+0x00,0x00,0x03,0x73,0x69,0x6e,0x00,0x00,0x03,0x63,0x6f,0x73,0x00,0x00,0x03,0x74,
+0x61,0x6e,0x00,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,
+0x00,0x00,0x01,0x26,0x00,0x00,0x02,0x2a,0x2a,0x00,0x00,0x01,0x2b,0x00,0x00,0x00,
+0x00,0x4d,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x06,
+0x01,0x00,0x00,0x91,0x01,0xbf,0xff,0x83,0x01,0x00,0x80,0xa0,0x01,0xbf,0xff,0x83,
+0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,
+0x4d,0x61,0x74,0x68,0x00,0x00,0x03,0x65,0x72,0x66,0x00,0x00,0x00,0x00,0x66,0x00,
+0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x06,0x01,0x00,0x00,
+0x91,0x01,0xbf,0xff,0x83,0x01,0x00,0x80,0xa0,0x01,0x80,0x00,0x02,0x00,0x80,0x01,
+0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x31,0x2e,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,
+0x30,0x30,0x00,0x00,0x00,0x03,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,
+0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,0x61,0x74,0x68,0x00,0x00,0x03,0x65,0x78,0x70,
+0x00,0x00,0x00,0x00,0x66,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x07,0x00,
+0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0xc0,0x00,0x03,0x01,0x00,0x80,0xa0,0x01,
+0x80,0x00,0x02,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x02,
+0x00,0x16,0x32,0x2e,0x37,0x31,0x38,0x32,0x38,0x31,0x38,0x32,0x38,0x34,0x35,0x39,
+0x30,0x34,0x35,0x31,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x03,0x00,0x0b,0x63,0x68,
+0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,0x61,0x74,0x68,
+0x00,0x00,0x03,0x65,0x78,0x70,0x00,0x00,0x00,0x00,0x7f,0x00,0x01,0x00,0x05,0x00,
+0x00,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x00,
+0x02,0x01,0x00,0x80,0xa0,0x01,0x80,0x00,0x82,0x00,0x80,0x01,0x20,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x02,0x02,0x00,0x16,0x31,0x2e,0x35,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x02,0x00,
+0x16,0x34,0x2e,0x34,0x38,0x31,0x36,0x38,0x39,0x30,0x37,0x30,0x33,0x33,0x38,0x30,
+0x36,0x34,0x35,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x03,0x00,0x0b,0x63,0x68,0x65,
+0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,0x61,0x74,0x68,0x00,
+0x00,0x03,0x65,0x78,0x70,0x00,0x00,0x00,0x00,0x4d,0x00,0x01,0x00,0x05,0x00,0x00,
+0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0xc0,0x00,0x03,
+0x01,0x00,0x80,0xa0,0x01,0xbf,0xff,0x83,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,
+0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,0x61,0x74,0x68,0x00,0x00,0x03,0x6c,
+0x6f,0x67,0x00,0x00,0x00,0x00,0x6e,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,
+0x08,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x00,0x91,0x01,0x80,0x01,
+0x93,0x01,0x00,0x80,0xa0,0x01,0x80,0x00,0x02,0x00,0x80,0x01,0x20,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,
+0x00,0x04,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,
+0x00,0x04,0x4d,0x61,0x74,0x68,0x00,0x00,0x03,0x6c,0x6f,0x67,0x00,0x00,0x01,0x45,
+0x00,0x00,0x00,0x00,0x7b,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,
+0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x00,0x91,0x01,0x80,0x01,0x93,0x02,
+0x40,0x01,0x03,0x01,0x81,0x00,0xa0,0x01,0x00,0x80,0xa0,0x01,0x80,0x00,0x02,0x00,
+0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x33,0x2e,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x05,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,
+0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,0x61,0x74,0x68,0x00,0x00,0x03,0x6c,
+0x6f,0x67,0x00,0x00,0x01,0x45,0x00,0x00,0x02,0x2a,0x2a,0x00,0x00,0x00,0x00,0x67,
+0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x06,0x01,0x00,
+0x00,0x91,0x01,0xc0,0x00,0x03,0x01,0x00,0x80,0xa0,0x01,0x80,0x00,0x02,0x00,0x80,
+0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x30,0x2e,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,
+0x2b,0x30,0x30,0x00,0x00,0x00,0x03,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,
+0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,0x61,0x74,0x68,0x00,0x00,0x04,0x6c,0x6f,
+0x67,0x32,0x00,0x00,0x00,0x00,0x67,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,
+0x07,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0xc0,0x00,0x83,0x01,0x00,0x80,
+0xa0,0x01,0x80,0x00,0x02,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x01,0x02,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x03,0x00,0x0b,
+0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,0x61,
+0x74,0x68,0x00,0x00,0x04,0x6c,0x6f,0x67,0x32,0x00,0x00,0x00,0x00,0x68,0x00,0x01,
+0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,
+0x01,0xc0,0x00,0x03,0x01,0x00,0x80,0xa0,0x01,0x80,0x00,0x02,0x00,0x80,0x01,0x20,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x30,0x2e,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,
+0x30,0x00,0x00,0x00,0x03,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,
+0x61,0x74,0x00,0x00,0x04,0x4d,0x61,0x74,0x68,0x00,0x00,0x05,0x6c,0x6f,0x67,0x31,
+0x30,0x00,0x00,0x00,0x00,0x68,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x07,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0xc0,0x04,0x83,0x01,0x00,0x80,0xa0,
+0x01,0x80,0x00,0x02,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,
+0x02,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x03,0x00,0x0b,0x63,
+0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,0x61,0x74,
+0x68,0x00,0x00,0x05,0x6c,0x6f,0x67,0x31,0x30,0x00,0x00,0x00,0x00,0x75,0x00,0x01,
+0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,
+0x01,0xc0,0x04,0x83,0x02,0x40,0x31,0x83,0x01,0x80,0xc0,0xa0,0x01,0x00,0x80,0xa0,
+0x01,0x80,0x00,0x02,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,
+0x02,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x32,0x00,0x00,0x00,0x04,0x00,0x0b,0x63,
+0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,0x61,0x74,
+0x68,0x00,0x00,0x05,0x6c,0x6f,0x67,0x31,0x30,0x00,0x00,0x02,0x2a,0x2a,0x00,0x00,
+0x00,0x00,0xe9,0x00,0x04,0x00,0x09,0x00,0x01,0x00,0x00,0x00,0x11,0x02,0x00,0x00,
+0x02,0x02,0x80,0x00,0x82,0x03,0x00,0x01,0x02,0x03,0x80,0x01,0x82,0x04,0x00,0x02,
+0x02,0x00,0x81,0x02,0xb7,0x02,0x3f,0xff,0x83,0x02,0xc0,0x00,0x03,0x03,0x40,0x01,
+0x83,0x03,0xc0,0x04,0x03,0x04,0x40,0x07,0x83,0x01,0x01,0x02,0xb7,0x01,0x80,0x00,
+0x07,0x02,0x00,0x80,0x01,0x02,0x80,0x01,0x40,0x02,0x00,0x00,0x21,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x05,0x02,0x00,0x16,0x30,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x02,0x00,
+0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x02,0x00,0x16,0x32,0x2e,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,
+0x02,0x00,0x16,0x33,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x02,0x00,0x16,0x34,0x2e,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,
+0x30,0x30,0x00,0x00,0x00,0x01,0x00,0x0f,0x65,0x61,0x63,0x68,0x5f,0x77,0x69,0x74,
+0x68,0x5f,0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x00,0x00,0x6f,0x00,0x04,0x00,0x0a,
+0x00,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x00,0x26,0x02,0x00,0xc0,0x15,0x02,0x80,
+0x00,0x06,0x03,0x00,0x00,0x91,0x03,0x80,0x40,0x01,0x03,0x00,0x80,0xa0,0x03,0x80,
+0x40,0x15,0x04,0x00,0x80,0x01,0x03,0x80,0xc0,0xa0,0x02,0x80,0x01,0x20,0x02,0x01,
+0x00,0xa0,0x02,0x00,0xc0,0x16,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x05,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,
+0x00,0x04,0x4d,0x61,0x74,0x68,0x00,0x00,0x04,0x73,0x71,0x72,0x74,0x00,0x00,0x02,
+0x5b,0x5d,0x00,0x00,0x01,0x26,0x00,0x00,0x00,0x00,0xeb,0x00,0x04,0x00,0x09,0x00,
+0x01,0x00,0x00,0x00,0x11,0x02,0x00,0x00,0x02,0x02,0x80,0x00,0x82,0x03,0x00,0x01,
+0x02,0x03,0x80,0x01,0x82,0x04,0x00,0x02,0x02,0x00,0x81,0x02,0xb7,0x02,0x3f,0xfb,
+0x83,0x02,0xbf,0xff,0x03,0x03,0x3f,0xff,0x83,0x03,0xc0,0x00,0x03,0x04,0x40,0x03,
+0x83,0x01,0x01,0x02,0xb7,0x01,0x80,0x00,0x07,0x02,0x00,0x80,0x01,0x02,0x80,0x01,
+0x40,0x02,0x00,0x00,0x21,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x05,0x02,0x00,0x17,
+0x2d,0x32,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x02,0x00,0x17,0x2d,0x31,0x2e,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,
+0x30,0x02,0x00,0x16,0x30,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x02,0x00,0x16,0x31,0x2e,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,
+0x2b,0x30,0x30,0x02,0x00,0x16,0x32,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x01,
+0x00,0x0f,0x65,0x61,0x63,0x68,0x5f,0x77,0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,0x65,
+0x78,0x00,0x00,0x00,0x00,0x6f,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,0x0d,
+0x04,0x00,0x00,0x26,0x02,0x00,0xc0,0x15,0x02,0x80,0x00,0x06,0x03,0x00,0x00,0x91,
+0x03,0x80,0x40,0x01,0x03,0x00,0x80,0xa0,0x03,0x80,0x40,0x15,0x04,0x00,0x80,0x01,
+0x03,0x80,0xc0,0xa0,0x02,0x80,0x01,0x20,0x02,0x01,0x00,0xa0,0x02,0x00,0xc0,0x16,
+0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x0b,0x63,0x68,
+0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,0x61,0x74,0x68,
+0x00,0x00,0x04,0x63,0x62,0x72,0x74,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x01,0x26,
+0x00,0x00,0x00,0x00,0x6c,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x08,0x00,
+0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0xc0,0x01,0x03,0x02,0x40,0x01,0x83,0x01,
+0x00,0x81,0x20,0x01,0x80,0x00,0x02,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x01,0x02,0x00,0x16,0x35,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x03,
+0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,
+0x4d,0x61,0x74,0x68,0x00,0x00,0x05,0x68,0x79,0x70,0x6f,0x74,0x00,0x00,0x00,0x00,
+0x73,0x00,0x04,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0xc2,0x68,0x83,0x02,
+0x00,0x00,0x11,0x02,0x80,0x40,0x01,0x02,0x00,0x40,0xa0,0x01,0x01,0x00,0x3a,0x01,
+0x81,0x00,0xba,0x02,0x00,0x00,0x06,0x02,0x80,0x00,0x11,0x03,0x00,0x80,0x01,0x03,
+0x80,0xc0,0x01,0x02,0x80,0xc1,0x20,0x03,0x00,0x40,0x01,0x02,0x00,0x81,0x20,0x02,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x4d,0x61,0x74,
+0x68,0x00,0x00,0x05,0x66,0x72,0x65,0x78,0x70,0x00,0x00,0x0b,0x63,0x68,0x65,0x63,
+0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x05,0x6c,0x64,0x65,0x78,0x70,0x00,
+0x00,0x00,0x00,0x66,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x80,
+0x00,0x06,0x01,0x00,0x00,0x91,0x01,0xc0,0x00,0x03,0x01,0x00,0x80,0xa0,0x01,0x80,
+0x00,0x02,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,
+0x16,0x38,0x2e,0x34,0x32,0x37,0x30,0x30,0x37,0x39,0x32,0x39,0x34,0x39,0x37,0x31,
+0x35,0x30,0x31,0x65,0x2d,0x30,0x31,0x00,0x00,0x00,0x03,0x00,0x0b,0x63,0x68,0x65,
+0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,0x61,0x74,0x68,0x00,
+0x00,0x03,0x65,0x72,0x66,0x00,0x00,0x00,0x00,0x67,0x00,0x01,0x00,0x05,0x00,0x00,
+0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0xc0,0x00,0x03,
+0x01,0x00,0x80,0xa0,0x01,0x80,0x00,0x02,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x31,0x2e,0x35,0x37,0x32,0x39,0x39,0x32,0x30,
+0x37,0x30,0x35,0x30,0x32,0x38,0x34,0x39,0x39,0x65,0x2d,0x30,0x31,0x00,0x00,0x00,
+0x03,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,
+0x04,0x4d,0x61,0x74,0x68,0x00,0x00,0x04,0x65,0x72,0x66,0x63,0x00,0x00,0x00,0x00,
+0x67,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x06,0x01,
+0x00,0x00,0x91,0x01,0xbf,0xff,0x03,0x01,0x00,0x80,0xa0,0x01,0x80,0x00,0x02,0x00,
+0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x17,0x2d,0x38,
+0x2e,0x34,0x32,0x37,0x30,0x30,0x37,0x39,0x32,0x39,0x34,0x39,0x37,0x31,0x34,0x37,
+0x38,0x65,0x2d,0x30,0x31,0x00,0x00,0x00,0x03,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,
+0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,0x61,0x74,0x68,0x00,0x00,0x03,
+0x65,0x72,0x66,0x00,0x00,0x00,0x00,0x67,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,
+0x00,0x07,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0xbf,0xff,0x03,0x01,0x00,
+0x80,0xa0,0x01,0x80,0x00,0x02,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x01,0x02,0x00,0x16,0x31,0x2e,0x38,0x34,0x32,0x37,0x30,0x30,0x37,0x39,0x32,
+0x39,0x34,0x39,0x37,0x31,0x34,0x38,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x03,0x00,
+0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x4d,
+0x61,0x74,0x68,0x00,0x00,0x04,0x65,0x72,0x66,0x63,0x00,0x00,0x00,0x00,0x48,0x00,
+0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x11,0x00,0x80,0x40,
+0x20,0x00,0x80,0x80,0x20,0x01,0x00,0x00,0x11,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,
+0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x46,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x54,
+0x69,0x6d,0x65,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x4c,0x00,0x01,0x00,
+0x04,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,
+0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,
+0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4f,0x62,
+0x6a,0x65,0x63,0x74,0x00,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x04,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x02,0x00,0x80,0x40,0xa0,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x31,0x2e,0x33,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x39,
+0x00,0x00,0x00,0x02,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,
+0x00,0x00,0x00,0x3a,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,
+0x00,0x11,0x01,0x43,0xed,0x83,0x01,0xc0,0x05,0x83,0x02,0x40,0x0b,0x03,0x00,0x80,
+0x41,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,
+0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x67,0x6d,0x00,0x00,0x00,0x00,0x3d,0x00,0x01,
+0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x11,0x01,0x43,0xed,0x83,
+0x01,0xc0,0x05,0x83,0x02,0x40,0x0b,0x03,0x00,0x80,0x41,0xa0,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,
+0x05,0x6c,0x6f,0x63,0x61,0x6c,0x00,0x00,0x00,0x00,0x3e,0x00,0x01,0x00,0x06,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x11,0x01,0x43,0xed,0x83,0x01,0xc0,0x05,
+0x83,0x02,0x40,0x0b,0x03,0x00,0x80,0x41,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x06,0x6d,0x6b,
+0x74,0x69,0x6d,0x65,0x00,0x00,0x00,0x00,0x48,0x00,0x01,0x00,0x04,0x00,0x00,0x00,
+0x00,0x00,0x06,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x00,0x80,0x80,0x20,0x01,
+0x00,0x00,0x11,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x03,0x6e,0x6f,0x77,0x00,
+0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,
+0x3b,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x11,0x01,
+0x43,0xed,0x83,0x01,0xc0,0x05,0x83,0x02,0x40,0x0b,0x03,0x00,0x80,0x41,0xa0,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x54,0x69,0x6d,
+0x65,0x00,0x00,0x03,0x75,0x74,0x63,0x00,0x00,0x00,0x00,0x9f,0x00,0x03,0x00,0x06,
+0x00,0x00,0x00,0x00,0x00,0x0b,0x01,0x80,0x00,0x11,0x02,0x00,0x00,0x02,0x01,0x80,
+0x40,0xa0,0x00,0x80,0xc0,0x01,0x01,0x80,0x9e,0x2d,0x01,0x00,0xc0,0x01,0x01,0x80,
+0xc0,0x20,0x01,0x81,0x00,0x20,0x02,0x00,0x00,0xbd,0x01,0x81,0x40,0xb2,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x02,0x02,0x00,0x16,0x31,0x2e,0x33,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x39,0x00,
+0x00,0x1c,0x53,0x75,0x6e,0x20,0x4d,0x61,0x72,0x20,0x31,0x33,0x20,0x30,0x37,0x3a,
+0x30,0x37,0x3a,0x34,0x30,0x20,0x55,0x54,0x43,0x20,0x32,0x30,0x31,0x31,0x00,0x00,
+0x00,0x06,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x01,
+0x2b,0x00,0x00,0x03,0x75,0x74,0x63,0x00,0x00,0x07,0x61,0x73,0x63,0x74,0x69,0x6d,
+0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x9f,0x00,0x03,0x00,0x06,0x00,
+0x00,0x00,0x00,0x00,0x0b,0x01,0x80,0x00,0x11,0x02,0x00,0x00,0x02,0x01,0x80,0x40,
+0xa0,0x00,0x80,0xc0,0x01,0x01,0x80,0x9e,0x2f,0x01,0x00,0xc0,0x01,0x01,0x80,0xc0,
+0x20,0x01,0x81,0x00,0x20,0x02,0x00,0x00,0xbd,0x01,0x81,0x40,0xb2,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x02,0x02,0x00,0x16,0x31,0x2e,0x33,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x39,0x00,0x00,
+0x1c,0x53,0x75,0x6e,0x20,0x4d,0x61,0x72,0x20,0x31,0x33,0x20,0x30,0x37,0x3a,0x30,
+0x35,0x3a,0x34,0x30,0x20,0x55,0x54,0x43,0x20,0x32,0x30,0x31,0x31,0x00,0x00,0x00,
+0x06,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x01,0x2d,
+0x00,0x00,0x03,0x75,0x74,0x63,0x00,0x00,0x07,0x61,0x73,0x63,0x74,0x69,0x6d,0x65,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x01,0x08,0x00,0x04,0x00,0x07,0x00,0x00,
+0x00,0x00,0x00,0x24,0x02,0x00,0x00,0x11,0x02,0x80,0x00,0x02,0x02,0x00,0x40,0xa0,
+0x00,0x81,0x00,0x01,0x02,0x00,0x00,0x11,0x02,0x80,0x00,0x82,0x02,0x00,0x40,0xa0,
+0x01,0x01,0x00,0x01,0x02,0x00,0x00,0x11,0x02,0x80,0x01,0x02,0x02,0x00,0x40,0xa0,
+0x01,0x81,0x00,0x01,0x02,0x00,0x80,0x01,0x02,0x80,0x40,0x01,0x02,0x00,0x80,0xa0,
+0x02,0xc0,0x00,0x03,0x02,0x00,0xc0,0xb2,0x02,0x40,0x02,0x99,0x02,0x00,0x80,0x01,
+0x02,0x80,0x80,0x01,0x02,0x00,0x80,0xa0,0x02,0xbf,0xff,0x83,0x02,0x00,0xc0,0xb2,
+0x02,0x40,0x02,0x99,0x02,0x00,0x80,0x01,0x02,0x80,0xc0,0x01,0x02,0x00,0x80,0xa0,
+0x02,0xbf,0xff,0x03,0x02,0x00,0xc0,0xb2,0x02,0x40,0x02,0x99,0x02,0x00,0x80,0x01,
+0x02,0x80,0x00,0x05,0x02,0x00,0x80,0xa0,0x02,0x80,0x00,0x05,0x02,0x00,0xc0,0xb2,
+0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x03,0x02,0x00,0x16,0x31,0x2e,0x33,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,
+0x39,0x02,0x00,0x16,0x31,0x2e,0x34,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x39,0x02,0x00,0x16,0x31,0x2e,0x35,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,
+0x2b,0x30,0x39,0x00,0x00,0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,
+0x61,0x74,0x00,0x00,0x03,0x3c,0x3d,0x3e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x8f,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x11,
+0x01,0x00,0x00,0x02,0x00,0x80,0x40,0xa0,0x00,0x80,0x80,0x20,0x00,0x80,0xc0,0x20,
+0x01,0x00,0x00,0xbd,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,
+0x02,0x00,0x16,0x31,0x2e,0x33,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x39,0x00,0x00,0x1c,0x53,0x75,0x6e,0x20,
+0x4d,0x61,0x72,0x20,0x31,0x33,0x20,0x30,0x37,0x3a,0x30,0x36,0x3a,0x34,0x30,0x20,
+0x55,0x54,0x43,0x20,0x32,0x30,0x31,0x31,0x00,0x00,0x00,0x05,0x00,0x04,0x54,0x69,
+0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x03,0x75,0x74,0x63,0x00,0x00,0x07,
+0x61,0x73,0x63,0x74,0x69,0x6d,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,
+0x8d,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x11,0x01,
+0x00,0x00,0x02,0x00,0x80,0x40,0xa0,0x00,0x80,0x80,0x20,0x00,0x80,0xc0,0x20,0x01,
+0x00,0x00,0xbd,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x02,
+0x00,0x16,0x31,0x2e,0x33,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x39,0x00,0x00,0x1c,0x53,0x75,0x6e,0x20,0x4d,
+0x61,0x72,0x20,0x31,0x33,0x20,0x30,0x37,0x3a,0x30,0x36,0x3a,0x34,0x30,0x20,0x55,
+0x54,0x43,0x20,0x32,0x30,0x31,0x31,0x00,0x00,0x00,0x05,0x00,0x04,0x54,0x69,0x6d,
+0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x03,0x75,0x74,0x63,0x00,0x00,0x05,0x63,
+0x74,0x69,0x6d,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x51,0x00,0x01,
+0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x11,0x01,0x43,0xed,0x83,
+0x01,0xc0,0x05,0x83,0x02,0x40,0x0b,0x03,0x00,0x80,0x41,0xa0,0x00,0x80,0x80,0x20,
+0x01,0x40,0x0b,0x03,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x67,0x6d,0x00,
+0x00,0x03,0x64,0x61,0x79,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x57,0x00,
+0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x11,0x01,0x43,0xed,
+0x83,0x01,0xc0,0x05,0x83,0x02,0x40,0x0b,0x03,0x00,0x80,0x41,0xa0,0x00,0x80,0x80,
+0x20,0x00,0x80,0xc0,0x20,0x00,0x81,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x67,0x6d,
+0x00,0x00,0x03,0x75,0x74,0x63,0x00,0x00,0x04,0x64,0x73,0x74,0x3f,0x00,0x00,0x01,
+0x21,0x00,0x00,0x00,0x00,0x91,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x08,
+0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x02,0x00,0x80,0x40,0xa0,0x00,0x80,0x80,0x20,
+0x00,0x80,0xc0,0x20,0x01,0x00,0x00,0xbd,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x02,0x02,0x00,0x16,0x31,0x2e,0x33,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x39,0x00,0x00,0x1c,
+0x53,0x75,0x6e,0x20,0x4d,0x61,0x72,0x20,0x31,0x33,0x20,0x30,0x37,0x3a,0x30,0x36,
+0x3a,0x34,0x30,0x20,0x55,0x54,0x43,0x20,0x32,0x30,0x31,0x31,0x00,0x00,0x00,0x05,
+0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x05,0x67,0x65,
+0x74,0x67,0x6d,0x00,0x00,0x07,0x61,0x73,0x63,0x74,0x69,0x6d,0x65,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x9b,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
+0x14,0x02,0x00,0x00,0x11,0x02,0x80,0x00,0x02,0x02,0x00,0x40,0xa0,0x00,0x81,0x00,
+0x01,0x02,0x00,0x00,0x11,0x02,0x80,0x00,0x02,0x02,0x00,0x40,0xa0,0x01,0x01,0x00,
+0x01,0x02,0x00,0x40,0x01,0x02,0x00,0x80,0x20,0x01,0x81,0x00,0x01,0x02,0x00,0x40,
+0x01,0x02,0x80,0xc0,0x01,0x02,0x00,0xc0,0xb2,0x02,0x40,0x02,0x19,0x02,0x00,0xc0,
+0x01,0x02,0x80,0x80,0x01,0x02,0x80,0x80,0x20,0x02,0x00,0xc0,0xb2,0x02,0x00,0x00,
+0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x31,0x2e,0x33,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x39,0x00,0x00,
+0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x08,
+0x67,0x65,0x74,0x6c,0x6f,0x63,0x61,0x6c,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x92,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x11,
+0x01,0x00,0x00,0x02,0x00,0x80,0x40,0xa0,0x00,0x80,0x80,0x20,0x00,0x80,0xc0,0x20,
+0x01,0x00,0x00,0xbd,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,
+0x02,0x00,0x16,0x31,0x2e,0x33,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x39,0x00,0x00,0x1c,0x53,0x75,0x6e,0x20,
+0x4d,0x61,0x72,0x20,0x31,0x33,0x20,0x30,0x37,0x3a,0x30,0x36,0x3a,0x34,0x30,0x20,
+0x55,0x54,0x43,0x20,0x32,0x30,0x31,0x31,0x00,0x00,0x00,0x05,0x00,0x04,0x54,0x69,
+0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x06,0x67,0x65,0x74,0x75,0x74,0x63,
+0x00,0x00,0x07,0x61,0x73,0x63,0x74,0x69,0x6d,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x60,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,
+0x00,0x11,0x01,0x00,0x00,0x02,0x00,0x80,0x40,0xa0,0x00,0x80,0x80,0x20,0x00,0x80,
+0xc0,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x31,0x2e,0x33,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,
+0x2b,0x30,0x39,0x00,0x00,0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,
+0x61,0x74,0x00,0x00,0x03,0x75,0x74,0x63,0x00,0x00,0x04,0x67,0x6d,0x74,0x3f,0x00,
+0x00,0x00,0x00,0x58,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x80,
+0x00,0x11,0x01,0x00,0x00,0x02,0x00,0x80,0x40,0xa0,0x00,0x80,0x80,0x20,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x31,0x2e,0x33,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x39,0x00,
+0x00,0x00,0x03,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,
+0x06,0x67,0x6d,0x74,0x69,0x6d,0x65,0x00,0x00,0x00,0x00,0x5a,0x00,0x01,0x00,0x08,
+0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x80,0x00,0x11,0x01,0x43,0xed,0x83,0x01,0xc0,
+0x05,0x83,0x02,0x40,0x0b,0x03,0x02,0xc0,0x03,0x03,0x03,0x40,0x02,0x83,0x00,0x80,
+0x42,0xa0,0x00,0x80,0x80,0x20,0x01,0x40,0x03,0x03,0x00,0x80,0xc0,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,
+0x00,0x00,0x02,0x67,0x6d,0x00,0x00,0x04,0x68,0x6f,0x75,0x72,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x68,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x08,
+0x01,0x00,0x00,0x11,0x01,0x80,0x00,0x02,0x01,0x00,0x40,0xa0,0x00,0x80,0x80,0x01,
+0x01,0x00,0x80,0x20,0x01,0x80,0x40,0x01,0x01,0x00,0xc0,0xb2,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x37,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x36,0x00,0x00,0x00,
+0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x05,0x63,
+0x6c,0x6f,0x6e,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x93,0x00,0x03,
+0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0f,0x01,0x80,0x00,0x11,0x02,0x00,0x00,0x02,
+0x01,0x80,0x40,0xa0,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x11,0x02,0x00,0x00,0x02,
+0x01,0x80,0x40,0xa0,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x01,0x80,0x80,0x20,
+0x01,0x80,0x40,0x01,0x02,0x00,0x80,0x01,0x02,0x01,0x00,0x20,0x01,0x80,0xc0,0xb2,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x31,0x2e,0x33,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,
+0x39,0x00,0x00,0x00,0x05,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,
+0x00,0x00,0x09,0x6c,0x6f,0x63,0x61,0x6c,0x74,0x69,0x6d,0x65,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x08,0x67,0x65,0x74,0x6c,0x6f,0x63,0x61,0x6c,0x00,0x00,0x00,0x00,
+0x52,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x11,0x01,
+0x43,0xed,0x83,0x01,0xc0,0x05,0x83,0x02,0x40,0x0b,0x03,0x00,0x80,0x41,0xa0,0x00,
+0x80,0x80,0x20,0x01,0x40,0x0b,0x03,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,
+0x67,0x6d,0x00,0x00,0x04,0x6d,0x64,0x61,0x79,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x59,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x80,0x00,
+0x11,0x01,0x43,0xed,0x83,0x01,0xc0,0x05,0x83,0x02,0x40,0x0b,0x03,0x02,0xc0,0x03,
+0x03,0x03,0x40,0x02,0x83,0x00,0x80,0x42,0xa0,0x00,0x80,0x80,0x20,0x01,0x40,0x02,
+0x83,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x67,0x6d,0x00,0x00,0x03,0x6d,
+0x69,0x6e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x51,0x00,0x01,0x00,0x06,
+0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x11,0x01,0x43,0xed,0x83,0x01,0xc0,
+0x05,0x83,0x02,0x40,0x0b,0x03,0x00,0x80,0x41,0xa0,0x00,0x80,0x80,0x20,0x01,0x40,
+0x05,0x83,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x67,0x6d,0x00,0x00,0x03,
+0x6d,0x6f,0x6e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x53,0x00,0x01,0x00,
+0x06,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x11,0x01,0x43,0xed,0x83,0x01,
+0xc0,0x05,0x83,0x02,0x40,0x0b,0x03,0x00,0x80,0x41,0xa0,0x00,0x80,0x80,0x20,0x01,
+0x40,0x05,0x83,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x67,0x6d,0x00,0x00,
+0x05,0x6d,0x6f,0x6e,0x74,0x68,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x5d,
+0x00,0x01,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x11,0x01,0x43,
+0xed,0x83,0x01,0xc0,0x05,0x83,0x02,0x40,0x0b,0x03,0x02,0xc0,0x03,0x03,0x03,0x40,
+0x02,0x83,0x03,0xc0,0x13,0x83,0x00,0x80,0x43,0x20,0x00,0x80,0x80,0x20,0x01,0x40,
+0x13,0x83,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x67,0x6d,0x00,0x00,0x03,
+0x73,0x65,0x63,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x63,0x00,0x01,0x00,
+0x04,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x02,0x00,
+0x80,0x40,0xa0,0x00,0x80,0x80,0x20,0x01,0x00,0x00,0x02,0x00,0x80,0xc0,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x31,0x2e,0x33,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x39,
+0x00,0x00,0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,
+0x00,0x04,0x74,0x6f,0x5f,0x66,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x70,
+0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x11,0x01,0x00,
+0x00,0x02,0x00,0x80,0x40,0xa0,0x00,0x80,0x80,0x20,0x01,0x00,0x00,0x82,0x00,0x80,
+0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x02,0x00,0x16,0x31,0x2e,0x33,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,
+0x2b,0x30,0x39,0x01,0x00,0x0a,0x31,0x33,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x00,0x00,0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,
+0x00,0x04,0x74,0x6f,0x5f,0x69,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x63,
+0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x11,0x01,0x00,
+0x00,0x02,0x00,0x80,0x40,0xa0,0x00,0x80,0x80,0x20,0x01,0x3f,0xff,0x83,0x00,0x80,
+0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x31,0x2e,0x33,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,
+0x2b,0x30,0x39,0x00,0x00,0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,
+0x61,0x74,0x00,0x00,0x04,0x75,0x73,0x65,0x63,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x55,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x80,0x00,
+0x11,0x01,0x00,0x00,0x02,0x00,0x80,0x40,0xa0,0x00,0x80,0x80,0x20,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x31,0x2e,0x33,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x39,0x00,0x00,
+0x00,0x03,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x03,
+0x75,0x74,0x63,0x00,0x00,0x00,0x00,0x60,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,
+0x00,0x06,0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x02,0x00,0x80,0x40,0xa0,0x00,0x80,
+0x80,0x20,0x00,0x80,0xc0,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,
+0x16,0x31,0x2e,0x33,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x65,0x2b,0x30,0x39,0x00,0x00,0x00,0x04,0x00,0x04,0x54,0x69,0x6d,
+0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x03,0x75,0x74,0x63,0x00,0x00,0x04,0x75,
+0x74,0x63,0x3f,0x00,0x00,0x00,0x00,0x52,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,
+0x00,0x09,0x00,0x80,0x00,0x11,0x01,0x43,0xed,0x83,0x01,0xc0,0x05,0x83,0x02,0x40,
+0x0b,0x03,0x00,0x80,0x41,0xa0,0x00,0x80,0x80,0x20,0x01,0x3f,0xff,0x83,0x00,0x80,
+0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,
+0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x67,0x6d,0x00,0x00,0x04,0x77,0x64,0x61,0x79,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x52,0x00,0x01,0x00,0x06,0x00,0x00,
+0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x11,0x01,0x43,0xed,0x83,0x01,0xc0,0x05,0x83,
+0x02,0x40,0x0b,0x03,0x00,0x80,0x41,0xa0,0x00,0x80,0x80,0x20,0x01,0x40,0xb2,0x83,
+0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x67,0x6d,0x00,0x00,0x04,0x79,0x64,
+0x61,0x79,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x52,0x00,0x01,0x00,0x06,
+0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x11,0x01,0x43,0xed,0x83,0x01,0xc0,
+0x05,0x83,0x02,0x40,0x0b,0x03,0x00,0x80,0x41,0xa0,0x00,0x80,0x80,0x20,0x01,0x43,
+0xed,0x83,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x67,0x6d,0x00,0x00,0x04,
+0x79,0x65,0x61,0x72,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x73,0x00,0x01,
+0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x02,
+0x00,0x80,0x40,0xa0,0x00,0x80,0x80,0x20,0x00,0x80,0xc0,0x20,0x01,0x00,0x00,0xbd,
+0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x02,0x00,0x16,0x31,
+0x2e,0x33,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x65,0x2b,0x30,0x39,0x00,0x00,0x03,0x55,0x54,0x43,0x00,0x00,0x00,0x05,0x00,
+0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x03,0x75,0x74,0x63,
+0x00,0x00,0x04,0x7a,0x6f,0x6e,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,
+0x8c,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x11,0x01,
+0x00,0x00,0x02,0x00,0x80,0x40,0xa0,0x00,0x80,0x80,0x20,0x00,0x80,0xc0,0x20,0x01,
+0x00,0x00,0xbd,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x02,
+0x00,0x16,0x31,0x2e,0x33,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x39,0x00,0x00,0x1c,0x53,0x75,0x6e,0x20,0x4d,
+0x61,0x72,0x20,0x31,0x33,0x20,0x30,0x37,0x3a,0x30,0x36,0x3a,0x34,0x30,0x20,0x55,
+0x54,0x43,0x20,0x32,0x30,0x31,0x31,0x00,0x00,0x00,0x05,0x00,0x04,0x54,0x69,0x6d,
+0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x03,0x75,0x74,0x63,0x00,0x00,0x04,0x74,
+0x6f,0x5f,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x8f,0x00,0x01,0x00,
+0x04,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x02,0x00,
+0x80,0x40,0xa0,0x00,0x80,0x80,0x20,0x00,0x80,0xc0,0x20,0x01,0x00,0x00,0xbd,0x00,
+0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x02,0x00,0x16,0x31,0x2e,
+0x33,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x65,0x2b,0x30,0x39,0x00,0x00,0x1c,0x53,0x75,0x6e,0x20,0x4d,0x61,0x72,0x20,0x31,
+0x33,0x20,0x30,0x37,0x3a,0x30,0x36,0x3a,0x34,0x30,0x20,0x55,0x54,0x43,0x20,0x32,
+0x30,0x31,0x31,0x00,0x00,0x00,0x05,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,
+0x61,0x74,0x00,0x00,0x03,0x75,0x74,0x63,0x00,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,
+0x63,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x01,0x19,0x00,0x02,0x00,0x07,
+0x00,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x11,0x01,0xc3,0xed,0x83,0x02,0x40,
+0x05,0x83,0x02,0xc0,0x0b,0x83,0x01,0x00,0x41,0xa0,0x00,0x80,0x80,0x01,0x01,0x00,
+0x00,0x06,0x01,0x80,0x40,0x01,0x01,0x80,0xc0,0x20,0x01,0x00,0x80,0xa0,0x01,0x00,
+0x00,0x06,0x01,0x80,0x40,0x01,0x01,0x81,0x40,0x20,0x01,0x01,0x00,0xa0,0x01,0x00,
+0x00,0x06,0x01,0x80,0x40,0x01,0x01,0x81,0x80,0x20,0x01,0x00,0x80,0xa0,0x01,0x00,
+0x00,0x06,0x01,0x80,0x40,0x01,0x01,0x81,0xc0,0x20,0x01,0x00,0x80,0xa0,0x01,0x00,
+0x00,0x06,0x01,0x80,0x40,0x01,0x01,0x82,0x00,0x20,0x01,0x00,0x80,0xa0,0x01,0x00,
+0x00,0x06,0x01,0x80,0x40,0x01,0x01,0x82,0x40,0x20,0x01,0x00,0x80,0xa0,0x01,0x00,
+0x00,0x06,0x01,0x80,0x40,0x01,0x01,0x82,0x80,0x20,0x01,0x00,0x80,0xa0,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x04,0x54,0x69,0x6d,0x65,
+0x00,0x00,0x02,0x67,0x6d,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x66,
+0x61,0x6c,0x73,0x65,0x00,0x00,0x07,0x73,0x75,0x6e,0x64,0x61,0x79,0x3f,0x00,0x00,
+0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x07,0x6d,
+0x6f,0x6e,0x64,0x61,0x79,0x3f,0x00,0x00,0x08,0x74,0x75,0x65,0x73,0x64,0x61,0x79,
+0x3f,0x00,0x00,0x0a,0x77,0x65,0x64,0x6e,0x65,0x73,0x64,0x61,0x79,0x3f,0x00,0x00,
+0x09,0x74,0x68,0x75,0x72,0x73,0x64,0x61,0x79,0x3f,0x00,0x00,0x07,0x66,0x72,0x69,
+0x64,0x61,0x79,0x3f,0x00,0x00,0x09,0x73,0x61,0x74,0x75,0x72,0x64,0x61,0x79,0x3f,
+0x00,0x00,0x00,0x01,0x7f,0x00,0x04,0x00,0x0a,0x00,0x03,0x00,0x00,0x00,0x35,0x00,
+0x81,0x00,0x37,0x02,0x40,0xf9,0x83,0x02,0x80,0x01,0x40,0x02,0x00,0x00,0x21,0x02,
+0x00,0x40,0x01,0x02,0xc0,0x03,0x03,0x02,0x00,0x40,0xa0,0x02,0x00,0x80,0x20,0x01,
+0x01,0x00,0x01,0x02,0x00,0x01,0x91,0x02,0xbf,0xff,0x83,0x02,0x01,0x00,0xa0,0x01,
+0x81,0x00,0x01,0x02,0x80,0x03,0x04,0x03,0x43,0xe8,0x03,0x03,0xc0,0x00,0x83,0x04,
+0x40,0x01,0x03,0x02,0x01,0x42,0x20,0x02,0x00,0x03,0x91,0x02,0x02,0x00,0x20,0x02,
+0x00,0x03,0x91,0x02,0x80,0x05,0x04,0x02,0x02,0x40,0xa0,0x02,0x40,0x01,0x19,0x02,
+0x00,0x03,0x91,0x02,0x02,0x80,0x20,0x02,0x67,0x0f,0x83,0x02,0x80,0x03,0x40,0x02,
+0x00,0x00,0x21,0x02,0x00,0x03,0x91,0x02,0x02,0x00,0x20,0x02,0x00,0x40,0x01,0x02,
+0x80,0x05,0x40,0x02,0x02,0xc0,0x21,0x02,0x00,0x00,0x06,0x02,0xc1,0xf7,0x03,0x03,
+0x00,0x80,0x01,0x03,0x03,0x40,0x20,0x02,0x03,0x01,0x20,0x02,0x00,0x00,0x06,0x02,
+0xc3,0xe8,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x02,0x81,0x41,0xb7,0x03,
+0x00,0xc0,0x01,0x03,0x03,0x80,0x20,0x03,0x80,0xc0,0x01,0x03,0x83,0xc0,0x20,0x04,
+0x00,0xc0,0x01,0x04,0x04,0x00,0x20,0x03,0x01,0x81,0xb7,0x02,0x03,0x01,0x20,0x02,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x05,0x74,0x69,0x6d,
+0x65,0x73,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x03,0x64,0x75,0x70,0x00,0x00,0x04,
+0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x04,0x73,0x65,0x6e,0x64,
+0x00,0x00,0x0a,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,0x02,
+0x47,0x43,0x00,0x00,0x05,0x73,0x74,0x61,0x72,0x74,0x00,0x00,0x0b,0x72,0x65,0x73,
+0x70,0x6f,0x6e,0x64,0x5f,0x74,0x6f,0x3f,0x00,0x00,0x07,0x63,0x6f,0x6d,0x70,0x61,
+0x63,0x74,0x00,0x00,0x0f,0x65,0x61,0x63,0x68,0x5f,0x77,0x69,0x74,0x68,0x5f,0x69,
+0x6e,0x64,0x65,0x78,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x04,0x74,0x6f,0x5f,0x69,0x00,0x00,0x04,0x79,0x65,0x61,
+0x72,0x00,0x00,0x05,0x6d,0x6f,0x6e,0x74,0x68,0x00,0x00,0x03,0x64,0x61,0x79,0x00,
+0x00,0x00,0x00,0x59,0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x0a,0x02,0x00,
+0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x00,0x91,0x02,0xc1,0xf3,0x83,0x03,0x00,
+0x40,0x01,0x02,0x80,0xc0,0xac,0x02,0x00,0x80,0xa0,0x02,0x01,0x00,0x20,0x01,0x80,
+0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x02,
+0x3c,0x3c,0x00,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,
+0x01,0x2b,0x00,0x00,0x03,0x75,0x74,0x63,0x00,0x00,0x00,0x00,0x36,0x00,0x03,0x00,
+0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x11,0x02,
+0x00,0x40,0x01,0x01,0x80,0x40,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x02,0x61,0x74,0x00,0x00,
+0x00,0x00,0x75,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x00,
+0x26,0x02,0x00,0x00,0x06,0x02,0xc1,0xf3,0x83,0x03,0x00,0x80,0x01,0x02,0x80,0x40,
+0xac,0x03,0x00,0x40,0x01,0x03,0x00,0x80,0x20,0x02,0x00,0x01,0x20,0x02,0x00,0x00,
+0x06,0x02,0x80,0x00,0x3d,0x03,0x00,0x40,0x01,0x03,0x00,0xc0,0x20,0x02,0x00,0x01,
+0x20,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x03,0x55,0x54,0x43,0x00,
+0x00,0x00,0x04,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x01,0x2b,0x00,0x00,0x04,0x74,0x6f,0x5f,0x69,0x00,0x00,0x04,0x7a,
+0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,0x48,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,
+0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x06,
+0x53,0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x4e,
+0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,
+0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x06,0x53,0x74,0x72,0x75,0x63,0x74,0x00,0x00,
+0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x00,0x00,0x8b,0x00,0x02,
+0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x10,0x01,0x00,0x00,0x11,0x01,0x80,0x01,0x04,
+0x02,0x00,0x01,0x84,0x01,0x00,0x41,0x20,0x00,0x80,0x80,0x01,0x01,0x01,0x00,0x20,
+0x01,0x80,0x00,0x11,0x01,0x01,0x40,0xb2,0x01,0x40,0x03,0x19,0x01,0x00,0x40,0x01,
+0x01,0x01,0x80,0x20,0x01,0x80,0x01,0x04,0x02,0x00,0x01,0x84,0x01,0x80,0xc1,0x37,
+0x01,0x01,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+0x00,0x06,0x53,0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x02,0x6d,0x31,0x00,0x00,0x02,0x6d,0x32,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x07,0x6d,0x65,0x6d,
+0x62,0x65,0x72,0x73,0x00,0x00,0x00,0x00,0x71,0x00,0x02,0x00,0x05,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x01,0x00,0x00,0x11,0x01,0x00,0x40,0x20,0x00,0x80,0x80,0x01,0x01,
+0x00,0x80,0x20,0x01,0x80,0x00,0x11,0x01,0x00,0xc0,0xb2,0x01,0x40,0x02,0x19,0x01,
+0x00,0x40,0x01,0x01,0x01,0x00,0x20,0x01,0x80,0xc0,0x37,0x01,0x00,0xc0,0xb2,0x01,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x53,0x74,0x72,
+0x75,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,
+0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x07,0x6d,0x65,
+0x6d,0x62,0x65,0x72,0x73,0x00,0x00,0x00,0x00,0x7c,0x00,0x04,0x00,0x08,0x00,0x00,
+0x00,0x00,0x00,0x12,0x02,0x00,0x00,0x11,0x02,0x80,0x01,0x04,0x03,0x00,0x01,0x84,
+0x02,0x00,0x41,0x20,0x00,0x81,0x00,0x01,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,
+0x02,0x00,0x41,0x20,0x01,0x01,0x00,0x01,0x02,0x00,0x40,0x01,0x02,0xc0,0x00,0x03,
+0x03,0x40,0x00,0x83,0x02,0x00,0x41,0x20,0x01,0x81,0x00,0x01,0x02,0x00,0x80,0x01,
+0x02,0x80,0xc0,0x01,0x02,0x01,0x00,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x05,0x00,0x06,0x53,0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x03,0x6e,
+0x65,0x77,0x00,0x00,0x02,0x6d,0x31,0x00,0x00,0x02,0x6d,0x32,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x8e,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x14,
+0x01,0x80,0x00,0x11,0x02,0x00,0x01,0x04,0x02,0x80,0x01,0x84,0x01,0x80,0x41,0x20,
+0x00,0x80,0xc0,0x01,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x01,0x80,0x41,0x20,
+0x01,0x00,0xc0,0x01,0x02,0x00,0x01,0x04,0x01,0x81,0x00,0xa0,0x02,0x40,0x00,0x03,
+0x01,0x81,0x40,0xb2,0x01,0xc0,0x02,0x99,0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x3d,
+0x01,0x81,0x00,0xa0,0x02,0x40,0x00,0x83,0x01,0x81,0x40,0xb2,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x01,0x00,0x00,0x02,0x6d,0x32,0x00,0x00,0x00,0x06,0x00,0x06,0x53,
+0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x6d,0x31,
+0x00,0x00,0x02,0x6d,0x32,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x8f,0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x80,
+0x00,0x11,0x02,0x00,0x01,0x04,0x02,0x80,0x01,0x84,0x01,0x80,0x41,0x20,0x00,0x80,
+0xc0,0x01,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x01,0x80,0x41,0x20,0x01,0x00,
+0xc0,0x01,0x01,0xc0,0x01,0x03,0x02,0x00,0x80,0x01,0x02,0x80,0x01,0x04,0x03,0x00,
+0xc0,0x01,0x02,0x01,0x01,0x20,0x01,0x80,0x80,0x01,0x02,0x00,0x01,0x04,0x01,0x81,
+0x40,0xa0,0x02,0x40,0x01,0x03,0x01,0x81,0x80,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x06,0x53,0x74,0x72,0x75,0x63,0x74,0x00,0x00,
+0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x6d,0x31,0x00,0x00,0x02,0x6d,0x32,0x00,0x00,
+0x03,0x5b,0x5d,0x3d,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0xa4,0x00,0x04,0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x19,0x02,0x00,0x00,
+0x11,0x02,0x80,0x01,0x04,0x03,0x00,0x01,0x84,0x02,0x00,0x41,0x20,0x00,0x81,0x00,
+0x01,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x02,0x00,0x41,0x20,0x01,0x01,0x00,
+0x01,0x01,0x81,0x00,0x37,0x02,0x00,0x80,0x01,0x02,0x80,0x01,0x40,0x02,0x01,0x00,
+0x21,0x02,0x00,0xc0,0x01,0x02,0xbf,0xff,0x83,0x02,0x01,0x40,0xa0,0x02,0xc0,0x00,
+0x03,0x02,0x01,0x80,0xb2,0x02,0x40,0x02,0x99,0x02,0x00,0xc0,0x01,0x02,0xc0,0x00,
+0x03,0x02,0x01,0x40,0xa0,0x02,0xc0,0x00,0x83,0x02,0x01,0x80,0xb2,0x02,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x06,0x53,0x74,0x72,0x75,0x63,
+0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x6d,0x31,0x00,0x00,0x02,0x6d,
+0x32,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,
+0x05,0x02,0x00,0x00,0x26,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,
+0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,
+0x3c,0x00,0x00,0x00,0x00,0xb9,0x00,0x04,0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x1d,
+0x02,0x00,0x00,0x11,0x02,0x80,0x01,0x04,0x03,0x00,0x01,0x84,0x02,0x00,0x41,0x20,
+0x00,0x81,0x00,0x01,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x02,0x00,0x41,0x20,
+0x01,0x01,0x00,0x01,0x01,0x81,0x00,0x37,0x02,0x00,0x80,0x01,0x02,0x80,0x01,0x40,
+0x02,0x01,0x00,0x21,0x02,0x00,0xc0,0x01,0x02,0xbf,0xff,0x83,0x02,0x01,0x40,0xa0,
+0x02,0x80,0x01,0x04,0x03,0x40,0x00,0x03,0x02,0x81,0x41,0x37,0x02,0x01,0x80,0xb2,
+0x02,0x40,0x03,0x99,0x02,0x00,0xc0,0x01,0x02,0xc0,0x00,0x03,0x02,0x01,0x40,0xa0,
+0x02,0x80,0x01,0x84,0x03,0x40,0x00,0x83,0x02,0x81,0x41,0x37,0x02,0x01,0x80,0xb2,
+0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x06,0x53,0x74,
+0x72,0x75,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x6d,0x31,0x00,
+0x00,0x02,0x6d,0x32,0x00,0x00,0x09,0x65,0x61,0x63,0x68,0x5f,0x70,0x61,0x69,0x72,
+0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x37,0x00,
+0x04,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,0x02,0x00,0xc0,
+0x15,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x02,0x81,0x41,0x37,0x02,0x00,0x00,
+0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,
+0x3c,0x00,0x00,0x00,0x00,0x7a,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x0f,
+0x01,0x80,0x00,0x11,0x02,0x00,0x01,0x04,0x02,0x80,0x01,0x84,0x01,0x80,0x41,0x20,
+0x00,0x80,0xc0,0x01,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x01,0x80,0x41,0x20,
+0x01,0x00,0xc0,0x01,0x01,0x81,0x00,0x20,0x02,0x00,0x01,0x04,0x02,0x80,0x01,0x84,
+0x02,0x01,0x01,0x37,0x01,0x81,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x06,0x00,0x06,0x53,0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x03,0x6e,
+0x65,0x77,0x00,0x00,0x02,0x6d,0x31,0x00,0x00,0x02,0x6d,0x32,0x00,0x00,0x07,0x6d,
+0x65,0x6d,0x62,0x65,0x72,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x79,
+0x00,0x03,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x0f,0x01,0x80,0x00,0x11,0x02,0x00,
+0x01,0x04,0x02,0x80,0x01,0x84,0x01,0x80,0x41,0x20,0x00,0x80,0xc0,0x01,0x02,0x40,
+0x00,0x03,0x02,0xc0,0x00,0x83,0x01,0x80,0x41,0x20,0x01,0x00,0xc0,0x01,0x02,0x00,
+0x01,0x40,0x01,0x81,0x00,0x21,0x02,0x40,0x00,0x83,0x02,0x01,0x00,0xb7,0x01,0x81,
+0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,
+0x53,0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x6d,
+0x31,0x00,0x00,0x02,0x6d,0x32,0x00,0x00,0x06,0x73,0x65,0x6c,0x65,0x63,0x74,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x3b,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
+0x00,0x00,0x07,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,
+0x80,0x00,0xa0,0x02,0x3f,0xff,0x83,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x25,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x02,0x36,0x00,0x03,0x00,0x12,0x00,0x01,0x00,0x00,0x00,0x64,0x01,0x80,
+0x00,0x11,0x02,0x00,0x01,0x04,0x02,0x80,0x01,0x84,0x03,0x00,0x02,0x04,0x03,0x80,
+0x02,0x84,0x04,0x00,0x03,0x04,0x04,0x80,0x03,0x84,0x05,0x00,0x04,0x04,0x05,0x80,
+0x04,0x84,0x06,0x00,0x05,0x04,0x06,0x80,0x05,0x84,0x07,0x00,0x06,0x04,0x07,0x80,
+0x06,0x84,0x08,0x00,0x07,0x04,0x01,0x80,0x46,0xa0,0x00,0x80,0xc0,0x01,0x02,0x40,
+0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x03,0xc0,0x01,0x83,0x04,0x40,
+0x02,0x03,0x04,0xc0,0x02,0x83,0x05,0x40,0x03,0x03,0x05,0xc0,0x03,0x83,0x06,0x40,
+0x04,0x03,0x06,0xc0,0x04,0x83,0x07,0x40,0x05,0x03,0x07,0xc0,0x05,0x83,0x08,0x40,
+0x06,0x03,0x01,0x80,0x46,0xa0,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x40,
+0x00,0x03,0x02,0x80,0x80,0x01,0x02,0x80,0x80,0x20,0x01,0x83,0xc1,0x20,0x01,0x80,
+0x00,0x06,0x02,0x40,0x00,0x83,0x02,0x80,0x80,0x01,0x02,0x80,0xc0,0x20,0x01,0x83,
+0xc1,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x01,0x03,0x02,0x80,0x80,0x01,0x02,0x81,
+0x00,0x20,0x01,0x83,0xc1,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x01,0x83,0x02,0x80,
+0x80,0x01,0x02,0x81,0x40,0x20,0x01,0x83,0xc1,0x20,0x01,0x80,0x00,0x06,0x02,0x40,
+0x02,0x03,0x02,0x80,0x80,0x01,0x02,0x81,0x80,0x20,0x01,0x83,0xc1,0x20,0x01,0x80,
+0x00,0x06,0x02,0x40,0x02,0x83,0x02,0x80,0x80,0x01,0x02,0x81,0xc0,0x20,0x01,0x83,
+0xc1,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x03,0x03,0x02,0x80,0x80,0x01,0x02,0x82,
+0x00,0x20,0x01,0x83,0xc1,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x03,0x83,0x02,0x80,
+0x80,0x01,0x02,0x82,0x40,0x20,0x01,0x83,0xc1,0x20,0x01,0x80,0x00,0x06,0x02,0x40,
+0x04,0x03,0x02,0x80,0x80,0x01,0x02,0x82,0x80,0x20,0x01,0x83,0xc1,0x20,0x01,0x80,
+0x00,0x06,0x02,0x40,0x04,0x83,0x02,0x80,0x80,0x01,0x02,0x82,0xc0,0x20,0x01,0x83,
+0xc1,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x06,0x03,0x02,0x80,0x80,0x01,0x02,0x83,
+0x80,0x20,0x01,0x83,0xc1,0x20,0x01,0x80,0x00,0x3d,0x02,0x00,0x80,0x01,0x02,0x80,
+0xc0,0x01,0x02,0x04,0x00,0xa0,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x3d,0x02,0x80,
+0x80,0x01,0x02,0x83,0x80,0x20,0x01,0x83,0xc1,0x20,0x01,0x80,0x00,0x06,0x02,0x00,
+0x09,0x11,0x02,0x80,0x01,0x40,0x01,0x84,0x40,0xa1,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x01,0x00,0x00,0x04,0x74,0x65,0x73,0x74,0x00,0x00,0x00,0x13,0x00,0x06,0x53,
+0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x6d,0x31,
+0x00,0x00,0x02,0x6d,0x32,0x00,0x00,0x02,0x6d,0x33,0x00,0x00,0x02,0x6d,0x34,0x00,
+0x00,0x02,0x6d,0x35,0x00,0x00,0x02,0x6d,0x36,0x00,0x00,0x02,0x6d,0x37,0x00,0x00,
+0x02,0x6d,0x38,0x00,0x00,0x02,0x6d,0x39,0x00,0x00,0x03,0x6d,0x31,0x30,0x00,0x00,
+0x03,0x6d,0x31,0x31,0x00,0x00,0x03,0x6d,0x31,0x32,0x00,0x00,0x03,0x6d,0x31,0x33,
+0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,
+0x00,0x04,0x6d,0x31,0x33,0x3d,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,0x4e,0x6f,0x4d,0x65,0x74,0x68,0x6f,0x64,
+0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x28,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x80,0x80,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x03,0x6d,0x31,0x34,0x00,0x00,0x00,
+0x00,0x6d,0x00,0x02,0x00,0x05,0x00,0x01,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x11,
+0x01,0x80,0x01,0x04,0x01,0x00,0x40,0xa0,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,
+0x01,0x80,0x02,0x11,0x02,0x00,0x01,0x40,0x01,0x00,0xc0,0xa1,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x53,0x74,0x72,0x75,0x63,0x74,
+0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x6d,0x31,0x00,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,0x41,0x72,0x67,
+0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x38,0x00,
+0x02,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x01,0x00,0x40,0x15,0x01,0xc0,0x00,
+0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x01,0x00,0x01,0xa0,0x00,0x80,0x80,
+0x01,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x03,0x6e,
+0x65,0x77,0x00,0x00,0x00,0x00,0xec,0x00,0x03,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,
+0x1a,0x01,0x80,0x00,0x11,0x02,0x00,0x01,0x04,0x02,0x80,0x01,0x84,0x03,0x00,0x02,
+0x04,0x03,0x80,0x02,0x84,0x04,0x00,0x03,0x04,0x01,0x80,0x42,0xa0,0x00,0x80,0xc0,
+0x01,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x03,0xc0,0x01,
+0x83,0x04,0x40,0x02,0x03,0x01,0x80,0x42,0xa0,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,
+0x06,0x02,0x00,0x00,0x3d,0x02,0x80,0x40,0x01,0x02,0x82,0x00,0x20,0x02,0x01,0x40,
+0x3e,0x02,0x80,0x00,0xbd,0x02,0x01,0x40,0x3e,0x02,0x80,0x80,0x01,0x02,0x82,0x00,
+0x20,0x01,0x81,0xc1,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x09,
+0x23,0x3c,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x00,0x00,0x1e,0x20,0x6d,0x31,0x3d,
+0x31,0x2c,0x20,0x6d,0x32,0x3d,0x32,0x2c,0x20,0x6d,0x33,0x3d,0x33,0x2c,0x20,0x6d,
+0x34,0x3d,0x34,0x2c,0x20,0x6d,0x35,0x3d,0x35,0x3e,0x00,0x00,0x00,0x09,0x00,0x06,
+0x53,0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x6d,
+0x31,0x00,0x00,0x02,0x6d,0x32,0x00,0x00,0x02,0x6d,0x33,0x00,0x00,0x02,0x6d,0x34,
+0x00,0x00,0x02,0x6d,0x35,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,0x00,0x00,
+0x00,0x00,0x9a,0x00,0x02,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x13,0x01,0x00,0x00,
+0x11,0x01,0x80,0x01,0x04,0x02,0x00,0x01,0x84,0x01,0x00,0x41,0x20,0x01,0xbf,0xff,
+0x83,0x02,0x40,0x00,0x03,0x01,0x00,0x41,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x00,
+0x06,0x01,0xc0,0x00,0x83,0x02,0x00,0x40,0x01,0x02,0x01,0x40,0x20,0x01,0x01,0x01,
+0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x83,0x02,0x00,0x40,0x01,0x02,0x01,0x80,
+0x20,0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x07,0x00,0x06,0x53,0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,
+0x00,0x02,0x66,0x31,0x00,0x00,0x02,0x66,0x32,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,
+0x00,0x06,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x00,0x00,0xb6,0x00,0x02,0x00,
+0x06,0x00,0x00,0x00,0x00,0x00,0x17,0x01,0x00,0x00,0x11,0x01,0x80,0x01,0x04,0x02,
+0x00,0x01,0x84,0x01,0x00,0x41,0x20,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x01,
+0x00,0x41,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x3d,0x02,
+0x00,0x00,0xbd,0x01,0x80,0xc1,0x37,0x02,0x00,0x40,0x01,0x02,0x01,0x40,0x20,0x01,
+0x01,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x01,
+0x80,0xc1,0x37,0x02,0x00,0x40,0x01,0x02,0x01,0x80,0x20,0x01,0x01,0x01,0x20,0x01,
+0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x01,0x61,0x00,0x00,0x01,0x62,0x00,
+0x00,0x00,0x07,0x00,0x06,0x53,0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,
+0x77,0x00,0x00,0x04,0x6d,0x65,0x6d,0x31,0x00,0x00,0x04,0x6d,0x65,0x6d,0x32,0x00,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,
+0x04,0x74,0x6f,0x5f,0x61,0x00,0x00,0x06,0x76,0x61,0x6c,0x75,0x65,0x73,0x00,0x00,
+0x00,0x00,0xb7,0x00,0x02,0x00,0x09,0x00,0x01,0x00,0x00,0x00,0x15,0x01,0x00,0x00,
+0x11,0x01,0x80,0x01,0x04,0x02,0x00,0x01,0x84,0x02,0x80,0x02,0x04,0x01,0x00,0x41,
+0xa0,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x02,0x80,0x01,0x3d,0x01,0x00,0x41,
+0xa0,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x04,0x02,0x00,0x00,
+0x3d,0x02,0x80,0x01,0x84,0x03,0x00,0x00,0xbd,0x03,0x80,0x02,0x04,0x04,0x00,0x01,
+0x3d,0x01,0x80,0xc1,0xbf,0x02,0x00,0x01,0x40,0x01,0x01,0x40,0xa1,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x03,0x00,0x00,0x05,0x72,0x75,0x75,0x6b,0x6f,0x00,0x00,0x06,
+0x79,0x75,0x7a,0x75,0x6b,0x69,0x00,0x00,0x05,0x68,0x69,0x74,0x6f,0x65,0x00,0x00,
+0x00,0x06,0x00,0x06,0x53,0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,
+0x00,0x00,0x05,0x77,0x68,0x69,0x74,0x65,0x00,0x00,0x03,0x72,0x65,0x64,0x00,0x00,
+0x05,0x67,0x72,0x65,0x65,0x6e,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x80,0x40,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x74,0x6f,0x5f,0x68,0x00,0x00,
+0x00,0x00,0xeb,0x00,0x02,0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x1d,0x01,0x00,0x00,
+0x11,0x01,0x80,0x01,0x04,0x02,0x00,0x01,0x84,0x01,0x00,0x41,0x20,0x01,0x80,0x00,
+0x3d,0x02,0x00,0x00,0xbd,0x01,0x00,0x41,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x00,
+0x06,0x01,0x80,0x00,0x3d,0x01,0x80,0xc0,0xb7,0x02,0x00,0x40,0x01,0x02,0xbf,0xff,
+0x83,0x02,0x01,0x40,0xa0,0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x00,
+0xbd,0x02,0x00,0x00,0x3d,0x01,0x80,0xc1,0x37,0x02,0x00,0x40,0x01,0x02,0xc0,0x00,
+0x03,0x03,0x3f,0xff,0x83,0x02,0x01,0x41,0x20,0x01,0x01,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0x80,0x03,0x91,0x02,0x00,0x01,0x40,0x01,0x01,0x80,0xa1,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x03,0x61,0x6b,0x69,0x00,0x00,0x02,0x69,0x6f,
+0x00,0x00,0x00,0x08,0x00,0x06,0x53,0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x03,0x6e,
+0x65,0x77,0x00,0x00,0x04,0x62,0x6c,0x75,0x65,0x00,0x00,0x06,0x70,0x75,0x72,0x70,
+0x6c,0x65,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x09,0x76,0x61,0x6c,0x75,0x65,0x73,0x5f,0x61,0x74,0x00,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0a,0x49,
+0x6e,0x64,0x65,0x78,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x32,0x00,0x01,
+0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x80,0x40,0x15,0x01,0x40,0x00,0x83,
+0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x09,0x76,0x61,0x6c,0x75,0x65,0x73,0x5f,0x61,0x74,0x00,0x00,0x00,0x00,0x88,
+0x00,0x02,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x17,0x01,0x40,0x00,0x03,0x01,0xc0,
+0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x03,0xbf,
+0xff,0x83,0x00,0x80,0x83,0x37,0x01,0x00,0x00,0x06,0x01,0xc0,0x01,0x83,0x02,0x40,
+0x02,0x03,0x02,0xbf,0xff,0x83,0x01,0x80,0xc1,0xb7,0x02,0x00,0x40,0x01,0x02,0xc0,
+0x01,0x03,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,
+0xc0,0x37,0x02,0x00,0x40,0x01,0x02,0xc0,0x02,0x83,0x02,0x00,0x40,0xa0,0x01,0x00,
+0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x64,
+0x72,0x6f,0x70,0x00,0x00,0x00,0x00,0x7a,0x00,0x02,0x00,0x08,0x00,0x01,0x00,0x00,
+0x00,0x12,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,
+0x01,0x83,0x03,0x40,0x02,0x03,0x03,0xbf,0xff,0x83,0x00,0x80,0x83,0x37,0x01,0x00,
+0x00,0x06,0x01,0xc0,0x01,0x03,0x02,0x40,0x01,0x83,0x02,0xc0,0x02,0x03,0x03,0x3f,
+0xff,0x83,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,0x02,0x80,0x01,0x40,0x02,0x00,
+0x40,0x21,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x0a,0x64,0x72,0x6f,0x70,0x5f,0x77,0x68,0x69,0x6c,0x65,0x00,0x00,0x00,
+0x00,0x2e,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,
+0x01,0x80,0x40,0x01,0x02,0x40,0x01,0x03,0x01,0x80,0x00,0xb3,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x3c,0x00,0x00,0x00,0x00,0x70,
+0x00,0x02,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x11,0x01,0x40,0x00,0x03,0x01,0xc0,
+0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x03,0xbf,
+0xff,0x83,0x00,0x80,0x83,0x37,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,
+0x00,0x83,0x02,0xc0,0x01,0x03,0x01,0x80,0xc1,0xb7,0x02,0x00,0x40,0x01,0x02,0xc0,
+0x01,0x03,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x74,0x61,0x6b,0x65,0x00,0x00,0x00,0x00,0x72,
+0x00,0x02,0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x10,0x01,0x40,0x00,0x03,0x01,0xc0,
+0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x03,0xbf,
+0xff,0x83,0x00,0x80,0x83,0x37,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,
+0x00,0x83,0x01,0x80,0xc1,0x37,0x02,0x00,0x40,0x01,0x02,0x80,0x01,0x40,0x02,0x00,
+0x40,0x21,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x0a,0x74,0x61,0x6b,0x65,0x5f,0x77,0x68,0x69,0x6c,0x65,0x00,0x00,0x00,
+0x00,0x2e,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,
+0x01,0x80,0x40,0x01,0x02,0x40,0x01,0x03,0x01,0x80,0x00,0xb3,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x3c,0x00,0x00,0x00,0x00,0x91,
+0x00,0x02,0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x18,0x00,0x80,0x80,0x37,0x01,0x40,
+0x00,0x03,0x01,0xc0,0x02,0x03,0x01,0x00,0x80,0x41,0x01,0xc0,0x01,0x03,0x02,0x00,
+0x01,0x40,0x01,0x00,0x00,0xa1,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,
+0x00,0x83,0x02,0xc0,0x01,0x03,0x01,0x80,0xc1,0xb7,0x02,0x40,0x00,0x83,0x02,0xc0,
+0x01,0x03,0x03,0x40,0x01,0x83,0x02,0x01,0x01,0xb7,0x02,0xc0,0x01,0x03,0x03,0x40,
+0x01,0x83,0x03,0xc0,0x02,0x03,0x02,0x81,0x41,0xb7,0x01,0x80,0xc1,0xb7,0x02,0x00,
+0x40,0x01,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x09,0x65,0x61,0x63,0x68,0x5f,0x63,0x6f,0x6e,0x73,0x00,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,
+0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,
+0x80,0x40,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x9a,
+0x00,0x02,0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x1a,0x00,0x80,0x80,0x37,0x01,0x40,
+0x00,0x03,0x01,0xc0,0x04,0x83,0x01,0x00,0x80,0x41,0x01,0xc0,0x01,0x03,0x02,0x00,
+0x01,0x40,0x01,0x00,0x00,0xa1,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,
+0x00,0x83,0x02,0xc0,0x01,0x03,0x01,0x80,0xc1,0xb7,0x02,0x40,0x01,0x83,0x02,0xc0,
+0x02,0x03,0x03,0x40,0x02,0x83,0x02,0x01,0x01,0xb7,0x02,0xc0,0x03,0x03,0x03,0x40,
+0x03,0x83,0x03,0xc0,0x04,0x03,0x02,0x81,0x41,0xb7,0x03,0x40,0x04,0x83,0x03,0x01,
+0x80,0xb7,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,0x01,0x00,0x41,0x20,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0a,0x65,0x61,0x63,0x68,
+0x5f,0x73,0x6c,0x69,0x63,0x65,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x06,0x00,0x00,
+0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,
+0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0xb1,0x00,0x02,0x00,0x07,0x00,0x01,0x00,
+0x00,0x00,0x1f,0x01,0x40,0x00,0x03,0x01,0xc0,0x02,0x83,0x01,0x00,0x80,0x41,0x01,
+0x80,0x01,0x40,0x01,0x00,0x00,0x21,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,
+0xc0,0x01,0x03,0x02,0x40,0x02,0x83,0x01,0x80,0xc1,0x37,0x02,0x00,0x40,0x01,0x02,
+0xbf,0xff,0x83,0x02,0x00,0x80,0xa0,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x06,0x01,
+0xc0,0x00,0x03,0x02,0x40,0x01,0x83,0x01,0x80,0xc1,0x37,0x02,0x00,0x40,0x01,0x02,
+0xc0,0x00,0x03,0x02,0x00,0x80,0xa0,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x06,0x01,
+0xc0,0x00,0x83,0x02,0x40,0x02,0x03,0x01,0x80,0xc1,0x37,0x02,0x00,0x40,0x01,0x02,
+0xc0,0x00,0x83,0x02,0x00,0x80,0xa0,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x08,0x67,0x72,0x6f,0x75,0x70,0x5f,0x62,
+0x79,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x00,0x00,0x2e,0x00,0x03,0x00,0x06,0x00,0x00,
+0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x01,0x03,
+0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x01,0x25,0x00,0x00,0x00,0x00,0x7b,0x00,0x01,0x00,0x06,0x00,0x01,0x00,0x00,
+0x00,0x0d,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,
+0x01,0x3d,0x01,0x00,0x81,0xb7,0x01,0x80,0x00,0x3d,0x02,0x00,0x01,0x3d,0x02,0x80,
+0x00,0xbd,0x01,0x80,0xc1,0xb7,0x02,0x00,0x01,0x40,0x01,0x80,0x40,0x21,0x00,0x80,
+0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x00,0x00,0x03,0x63,0x61,0x72,
+0x00,0x00,0x05,0x74,0x72,0x61,0x69,0x6e,0x00,0x00,0x07,0x62,0x69,0x63,0x79,0x63,
+0x6c,0x65,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x07,0x73,0x6f,0x72,0x74,0x5f,0x62,0x79,0x00,0x00,
+0x00,0x00,0x2f,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x04,0x02,0x00,0x00,
+0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x00,
+0x01,0x1a,0x00,0x02,0x00,0x07,0x00,0x02,0x00,0x00,0x00,0x2d,0x01,0x00,0x00,0x11,
+0x01,0x00,0x40,0x20,0x00,0x80,0x80,0x01,0x01,0x80,0x01,0x91,0x01,0x00,0x80,0xa0,
+0x01,0x00,0x40,0x01,0x01,0x00,0x80,0x47,0x01,0x80,0x00,0xc0,0x01,0x01,0x00,0x46,
+0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x40,0x01,0x02,0x01,0x80,0x20,
+0x01,0x01,0x41,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,
+0x01,0x80,0xc1,0x37,0x02,0x00,0x40,0x01,0x02,0xc0,0x00,0x83,0x02,0x01,0x80,0xa0,
+0x01,0x01,0x41,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,
+0x02,0xc0,0x01,0x03,0x01,0x80,0xc1,0xb7,0x02,0x00,0x40,0x01,0x02,0xc0,0x04,0x83,
+0x02,0x01,0x80,0xa0,0x01,0x01,0x41,0x20,0x01,0x00,0x00,0x11,0x01,0x00,0x40,0x20,
+0x00,0x80,0x80,0x01,0x01,0x80,0x01,0x91,0x01,0x00,0x80,0xa0,0x01,0x00,0x40,0x01,
+0x01,0x00,0x80,0x47,0x01,0x80,0x02,0xc0,0x01,0x01,0x00,0x46,0x01,0x00,0x00,0x06,
+0x01,0x80,0x40,0x01,0x01,0x81,0x80,0x20,0x01,0x01,0xc0,0xa0,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,
+0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x06,0x65,0x78,0x74,0x65,0x6e,0x64,0x00,
+0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x00,0x00,0x04,0x65,
+0x61,0x63,0x68,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,
+0x61,0x6c,0x00,0x00,0x05,0x66,0x69,0x72,0x73,0x74,0x00,0x00,0x0a,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x6e,0x69,0x6c,0x00,0x00,0x00,0x00,0x49,0x00,0x02,0x00,0x04,
+0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0xc0,
+0x00,0x03,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x2b,0x01,0xc0,0x00,0x83,0x01,0x00,
+0x00,0xa0,0x01,0x00,0x00,0x2b,0x01,0xc0,0x01,0x03,0x01,0x00,0x00,0xa0,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,
+0x00,0x00,0x00,0x00,0x22,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x00,0x00,0x26,0x01,0x00,0x00,0x05,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x00,0x02,0x00,0x07,0x00,0x01,0x00,0x00,0x00,
+0x17,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x83,0x02,0xc0,0x00,
+0x83,0x00,0x80,0x82,0x37,0x01,0x00,0x00,0x06,0x01,0xc0,0x01,0x83,0x02,0x00,0x40,
+0x01,0x02,0x00,0x40,0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,
+0x83,0x02,0x00,0x40,0x01,0x02,0xc0,0x00,0x83,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,
+0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x01,0x03,0x02,0x00,0x40,0x01,0x02,0x80,0x01,
+0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x05,0x63,0x6f,0x75,0x6e,0x74,0x00,0x00,0x00,0x00,0x3b,
+0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x26,0x01,0x80,
+0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x00,0xa0,0x02,0x3f,0xff,0x83,0x01,0x80,
+0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,
+0x25,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xfc,0x00,0x01,0x00,0x0a,0x00,
+0x03,0x00,0x00,0x00,0x33,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,
+0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x01,0x00,0x82,0x37,0x01,0xc0,0x00,
+0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x01,0x80,0xc2,
+0x37,0x02,0x00,0x01,0x40,0x01,0x80,0x40,0x21,0x00,0x80,0x01,0x20,0x00,0x80,0x00,
+0x06,0x01,0x40,0x00,0x03,0x01,0xbf,0xff,0x03,0x02,0x40,0x00,0x83,0x02,0xbf,0xfe,
+0x83,0x03,0x40,0x01,0x03,0x03,0xbf,0xfe,0x03,0x04,0x40,0x01,0x83,0x04,0xbf,0xfd,
+0x83,0x01,0x00,0x84,0x37,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,
+0x03,0x03,0x40,0x01,0x83,0x01,0x80,0xc2,0x37,0x02,0x00,0x03,0x40,0x01,0x80,0x40,
+0x21,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,
+0x83,0x02,0x40,0x31,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x31,
+0x83,0x01,0x00,0x83,0x37,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x01,0x80,0xc1,
+0x37,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x02,0x01,0x01,0x37,0x01,0x80,0xc1,
+0x37,0x02,0x00,0x05,0x40,0x01,0x80,0x40,0x21,0x00,0x80,0x01,0x20,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x08,0x66,0x6c,0x61,0x74,0x5f,0x6d,
+0x61,0x70,0x00,0x00,0x00,0x00,0x1e,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+0x02,0x02,0x00,0x00,0x26,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x33,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x06,0x02,
+0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x40,0x01,0x02,0x00,0x00,0x20,0x01,
+0x80,0xc1,0x37,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x02,0x2d,0x40,0x00,0x00,0x00,0x00,0x32,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,
+0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x31,0x83,0x02,0x01,
+0x00,0xb7,0x01,0x80,0x00,0xac,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x70,0x00,0x01,0x00,0x06,0x00,0x01,
+0x00,0x00,0x00,0x0a,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0x3d,
+0x02,0x00,0x00,0xbd,0x02,0x80,0x01,0x3d,0x01,0x80,0xc1,0xb7,0x02,0x00,0x01,0x40,
+0x01,0x80,0x40,0x21,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x03,
+0x00,0x00,0x09,0x61,0x6c,0x62,0x61,0x74,0x72,0x6f,0x73,0x73,0x00,0x00,0x03,0x64,
+0x6f,0x67,0x00,0x00,0x05,0x68,0x6f,0x72,0x73,0x65,0x00,0x00,0x00,0x02,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x06,0x6d,
+0x61,0x78,0x5f,0x62,0x79,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x05,0x00,0x00,
+0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x6c,0x65,
+0x6e,0x67,0x74,0x68,0x00,0x00,0x00,0x00,0x70,0x00,0x01,0x00,0x06,0x00,0x01,0x00,
+0x00,0x00,0x0a,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,
+0x00,0x00,0x3d,0x02,0x80,0x01,0x3d,0x01,0x80,0xc1,0xb7,0x02,0x00,0x01,0x40,0x01,
+0x80,0x40,0x21,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x00,
+0x00,0x03,0x64,0x6f,0x67,0x00,0x00,0x09,0x61,0x6c,0x62,0x61,0x74,0x72,0x6f,0x73,
+0x73,0x00,0x00,0x05,0x68,0x6f,0x72,0x73,0x65,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x06,0x6d,0x69,
+0x6e,0x5f,0x62,0x79,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x05,0x00,0x00,0x00,
+0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x6c,0x65,0x6e,
+0x67,0x74,0x68,0x00,0x00,0x00,0x00,0x98,0x00,0x02,0x00,0x06,0x00,0x01,0x00,0x00,
+0x00,0x14,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x00,0x80,
+0x81,0xb7,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x3d,0x02,0x00,0x01,0x3d,0x01,0x80,
+0xc1,0x37,0x02,0x00,0x40,0x01,0x02,0x00,0x40,0x20,0x01,0x00,0x01,0x20,0x01,0x00,
+0x00,0x06,0x01,0x80,0x00,0xbd,0x02,0x00,0x00,0x3d,0x01,0x80,0xc1,0x37,0x02,0x00,
+0x40,0x01,0x02,0x80,0x01,0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x01,0x20,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x03,0x00,0x00,0x09,0x61,0x6c,0x62,0x61,0x74,0x72,0x6f,
+0x73,0x73,0x00,0x00,0x03,0x64,0x6f,0x67,0x00,0x00,0x05,0x68,0x6f,0x72,0x73,0x65,
+0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,
+0x61,0x6c,0x00,0x00,0x06,0x6d,0x69,0x6e,0x6d,0x61,0x78,0x00,0x00,0x00,0x00,0x41,
+0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,0x02,0x00,
+0x40,0x01,0x02,0x00,0x00,0x20,0x02,0x80,0x80,0x01,0x02,0x80,0x00,0x20,0x02,0x00,
+0x40,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x03,0x3c,0x3d,0x3e,0x00,0x00,0x00,0x00,
+0x7b,0x00,0x01,0x00,0x06,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x06,0x01,
+0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x01,0x00,0x81,0x37,0x01,0x80,0x00,0xbd,0x02,
+0x00,0x00,0x3d,0x02,0x80,0x01,0x3d,0x01,0x80,0xc1,0xb7,0x02,0x00,0x01,0x40,0x01,
+0x80,0x40,0x21,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x00,
+0x00,0x03,0x64,0x6f,0x67,0x00,0x00,0x09,0x61,0x6c,0x62,0x61,0x74,0x72,0x6f,0x73,
+0x73,0x00,0x00,0x05,0x68,0x6f,0x72,0x73,0x65,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x09,0x6d,0x69,
+0x6e,0x6d,0x61,0x78,0x5f,0x62,0x79,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x05,
+0x00,0x00,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,
+0x00,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x00,0x00,0xd2,0x00,0x01,0x00,0x05,0x00,
+0x02,0x00,0x00,0x00,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,
+0xbd,0x02,0x00,0x01,0x3d,0x01,0x00,0x81,0xb7,0x01,0x80,0x01,0x40,0x01,0x00,0x40,
+0x21,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,
+0xbd,0x02,0x00,0x01,0x3d,0x01,0x00,0x81,0xb7,0x01,0x80,0x03,0x40,0x01,0x00,0x40,
+0x21,0x00,0x80,0x80,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x80,0x37,0x01,0x00,0x40,
+0x20,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x05,0x01,0x80,0x00,
+0x08,0x01,0x00,0x81,0x37,0x01,0x00,0x40,0x20,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,
+0x06,0x01,0x00,0x00,0x05,0x01,0x80,0x00,0x07,0x01,0x00,0x81,0x37,0x01,0x00,0x40,
+0x20,0x00,0x80,0x80,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x00,0x00,0x03,
+0x61,0x6e,0x74,0x00,0x00,0x04,0x62,0x65,0x61,0x72,0x00,0x00,0x03,0x63,0x61,0x74,
+0x00,0x00,0x00,0x03,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,
+0x65,0x00,0x00,0x05,0x6e,0x6f,0x6e,0x65,0x3f,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,0x00,
+0x06,0x00,0x00,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,
+0x80,0x00,0x20,0x02,0x40,0x02,0x03,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
+0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x02,
+0x40,0x01,0x83,0x01,0x80,0x40,0xb6,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x06,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x02,0x3e,0x3d,
+0x00,0x00,0x00,0x00,0xe9,0x00,0x01,0x00,0x05,0x00,0x03,0x00,0x00,0x00,0x27,0x00,
+0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x01,
+0x00,0x81,0xb7,0x01,0x80,0x01,0x40,0x01,0x00,0x40,0x21,0x00,0x80,0x00,0xa0,0x00,
+0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x01,
+0x00,0x81,0xb7,0x01,0x80,0x03,0x40,0x01,0x00,0x40,0x21,0x00,0x80,0x80,0xa0,0x00,
+0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x01,
+0x00,0x81,0xb7,0x01,0x80,0x05,0x40,0x01,0x00,0x40,0x21,0x00,0x80,0x80,0xa0,0x00,
+0x80,0x00,0x06,0x01,0x00,0x00,0x05,0x01,0x80,0x00,0x07,0x02,0x40,0x31,0x03,0x01,
+0x00,0x81,0xb7,0x01,0x00,0x40,0x20,0x00,0x80,0x80,0xa0,0x00,0x80,0x00,0x06,0x01,
+0x00,0x00,0x05,0x01,0x80,0x00,0x07,0x02,0x00,0x00,0x08,0x01,0x00,0x81,0xb7,0x01,
+0x00,0x40,0x20,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x00,
+0x00,0x03,0x61,0x6e,0x74,0x00,0x00,0x04,0x62,0x65,0x61,0x72,0x00,0x00,0x03,0x63,
+0x61,0x74,0x00,0x00,0x00,0x03,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,
+0x72,0x75,0x65,0x00,0x00,0x04,0x6f,0x6e,0x65,0x3f,0x00,0x00,0x0c,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,
+0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,
+0x01,0x80,0x00,0x20,0x02,0x40,0x01,0x83,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x6c,0x65,0x6e,0x67,0x74,0x68,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x3b,0x00,0x03,0x00,0x06,0x00,0x00,
+0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,
+0x02,0x40,0x01,0x83,0x01,0x80,0x40,0xb5,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x06,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x01,0x3e,
+0x00,0x00,0x00,0x00,0x3b,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x06,0x02,
+0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x02,0x40,0x01,0x83,0x01,
+0x80,0x40,0xb3,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x06,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x01,0x3c,0x00,0x00,0x00,0x00,0xb6,
+0x00,0x01,0x00,0x0c,0x00,0x02,0x00,0x00,0x00,0x18,0x00,0x80,0x00,0x06,0x01,0x40,
+0x00,0x83,0x01,0xc0,0x01,0x83,0x02,0x40,0x02,0x83,0x02,0xc0,0x03,0x83,0x03,0x40,
+0x04,0x83,0x03,0xc0,0x05,0x83,0x04,0x40,0x06,0x83,0x04,0xc0,0x07,0x83,0x05,0x40,
+0x08,0x83,0x05,0xc0,0x09,0x83,0x01,0x00,0x85,0x37,0x01,0xc0,0x00,0x03,0x02,0x40,
+0x04,0x83,0x01,0x80,0xc0,0x41,0x02,0x01,0x00,0x37,0x02,0x80,0x01,0x40,0x01,0x80,
+0x40,0xa1,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x91,0x01,0x80,
+0x03,0x40,0x00,0x80,0x80,0xa1,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,
+0x00,0x10,0x65,0x61,0x63,0x68,0x5f,0x77,0x69,0x74,0x68,0x5f,0x6f,0x62,0x6a,0x65,
+0x63,0x74,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,
+0x65,0x00,0x00,0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,
+0x72,0x00,0x00,0x00,0x00,0x3b,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x07,
+0x04,0x00,0x00,0x26,0x02,0x00,0x80,0x01,0x02,0x80,0x40,0x01,0x03,0x40,0x00,0x83,
+0x02,0x80,0x40,0xb0,0x02,0x00,0x00,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x00,
+0x41,0x00,0x01,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0xc0,0x00,0x03,0x01,
+0x40,0x04,0x83,0x00,0x80,0x40,0x41,0x01,0x00,0x01,0x40,0x00,0x80,0x00,0x21,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x10,0x65,0x61,0x63,
+0x68,0x5f,0x77,0x69,0x74,0x68,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x00,
+0x00,0x3b,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,
+0x02,0x00,0x80,0x01,0x02,0x80,0x40,0x01,0x03,0x40,0x00,0x83,0x02,0x80,0x40,0xb0,
+0x02,0x00,0x00,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x02,0x3c,0x3c,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x00,0x84,0x00,0x03,0x00,
+0x07,0x00,0x01,0x00,0x00,0x00,0x14,0x01,0xc0,0x00,0x03,0x02,0x40,0x01,0x03,0x00,
+0x80,0xc0,0x41,0x01,0x00,0xc0,0x37,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,
+0xc0,0x01,0x03,0x02,0x01,0x00,0x41,0x02,0x80,0x40,0x01,0x03,0x00,0x01,0x40,0x02,
+0x80,0x40,0x21,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x01,0x03,0x02,
+0xc0,0x00,0x83,0x03,0x40,0x00,0x03,0x02,0x01,0x01,0xb7,0x02,0x80,0x80,0x01,0x01,
+0x80,0x01,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x0c,
+0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x5f,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,
+0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,
+0x80,0x80,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0xb0,
+0x00,0x02,0x00,0x09,0x00,0x02,0x00,0x00,0x00,0x17,0x00,0x80,0x80,0x37,0x01,0x00,
+0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x01,0x00,0x81,0xb7,0x01,0xc0,
+0x00,0x83,0x02,0x00,0x01,0x40,0x01,0x00,0x00,0xa1,0x01,0x00,0x00,0x06,0x01,0x80,
+0x00,0x3d,0x02,0x00,0x00,0xbd,0x02,0x80,0x01,0x3d,0x03,0x00,0x00,0x3d,0x03,0x80,
+0x00,0xbd,0x04,0x00,0x01,0x3d,0x01,0x80,0xc3,0x37,0x02,0x00,0x40,0x01,0x01,0x00,
+0x41,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x91,0x02,0x00,0x03,0x40,0x01,0x00,
+0x80,0xa1,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x03,0x00,0x00,0x01,0x61,0x00,0x00,
+0x01,0x62,0x00,0x00,0x01,0x63,0x00,0x00,0x00,0x04,0x00,0x05,0x63,0x79,0x63,0x6c,
+0x65,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,
+0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x2f,
+0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,
+0x40,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x4a,0x00,
+0x01,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,
+0xbd,0x01,0x80,0x01,0x3d,0x00,0x80,0x41,0xb7,0x01,0x00,0x00,0x3d,0x01,0x80,0x01,
+0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x00,0x00,0x01,
+0x61,0x00,0x00,0x01,0x62,0x00,0x00,0x01,0x63,0x00,0x00,0x00,0x01,0x00,0x05,0x63,
+0x79,0x63,0x6c,0x65,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
+0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x95,0x02,0x00,0x40,0x01,0x01,
+0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x9f,0x00,0x01,0x00,0x06,0x00,0x02,0x00,0x00,
+0x00,0x18,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,0x01,0xc0,0x04,0x83,0x01,0x00,
+0x80,0x41,0x01,0x80,0x01,0x40,0x01,0x00,0x40,0x21,0x00,0x80,0x00,0xa0,0x00,0x80,
+0x00,0x06,0x01,0x40,0x10,0x83,0x01,0xc0,0x00,0x03,0x02,0x40,0x31,0x83,0x01,0x80,
+0xc0,0x41,0x02,0x00,0x03,0x40,0x01,0x80,0x40,0x21,0x00,0x80,0x81,0x20,0x00,0x80,
+0x00,0x06,0x01,0x40,0x18,0x03,0x01,0xc0,0x00,0x03,0x02,0x40,0x31,0x83,0x01,0x80,
+0xc0,0x41,0x02,0x40,0x18,0x83,0x01,0x80,0x40,0xa0,0x00,0x80,0x81,0x20,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0a,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x6e,0x69,0x6c,0x00,0x00,0x0a,0x66,0x69,0x6e,0x64,0x5f,0x69,0x6e,
+0x64,0x65,0x78,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,
+0x61,0x6c,0x00,0x00,0x00,0x00,0x53,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x02,0x03,0x01,0x80,0x00,
+0xa0,0x02,0x3f,0xff,0x83,0x01,0x80,0x40,0xb2,0x01,0xc0,0x02,0x99,0x01,0x80,0x40,
+0x01,0x02,0x40,0x03,0x03,0x01,0x80,0x00,0xa0,0x02,0x3f,0xff,0x83,0x01,0x80,0x40,
+0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x25,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x53,0x00,0x03,0x00,0x06,0x00,0x00,
+0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x02,0x03,
+0x01,0x80,0x00,0xa0,0x02,0x3f,0xff,0x83,0x01,0x80,0x40,0xb2,0x01,0xc0,0x02,0x99,
+0x01,0x80,0x40,0x01,0x02,0x40,0x03,0x03,0x01,0x80,0x00,0xa0,0x02,0x3f,0xff,0x83,
+0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x01,0x25,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x01,0x7f,0x00,0x03,0x00,
+0x09,0x00,0x00,0x00,0x00,0x00,0x55,0x01,0xc0,0x01,0x83,0x02,0x40,0x02,0x03,0x02,
+0xc0,0x02,0x83,0x00,0x80,0xc1,0xb7,0x01,0xc0,0x03,0x03,0x02,0x40,0x03,0x83,0x02,
+0xc0,0x04,0x03,0x01,0x00,0xc1,0xb7,0x01,0x80,0x00,0x06,0x02,0x40,0x01,0x83,0x02,
+0xc0,0x03,0x03,0x02,0x01,0x01,0x37,0x02,0xc0,0x02,0x03,0x03,0x40,0x03,0x83,0x02,
+0x81,0x41,0x37,0x03,0x40,0x02,0x83,0x03,0xc0,0x04,0x03,0x03,0x01,0x81,0x37,0x02,
+0x01,0x01,0xb7,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x02,0x80,0x40,0xa0,0x01,
+0x80,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x01,0x83,0x03,
+0x40,0x03,0x03,0x02,0x01,0x01,0xb7,0x02,0xc0,0x00,0x83,0x03,0x40,0x02,0x03,0x03,
+0xc0,0x03,0x83,0x02,0x81,0x41,0xb7,0x03,0x40,0x01,0x03,0x03,0xc0,0x02,0x83,0x04,
+0x40,0x04,0x03,0x03,0x01,0x81,0xb7,0x02,0x01,0x01,0xb7,0x02,0xc0,0x00,0x03,0x03,
+0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x02,0x81,0x41,0xb7,0x03,0x00,0x40,0x01,0x03,
+0x80,0x80,0x01,0x02,0x80,0x41,0x20,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x06,0x02,
+0x40,0x00,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x03,0x03,0x02,0x01,0x01,0xb7,0x02,
+0xc0,0x00,0x83,0x03,0x40,0x02,0x03,0x03,0xc0,0x03,0x83,0x02,0x81,0x41,0xb7,0x02,
+0x01,0x01,0x37,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x02,0x81,0x41,0x37,0x03,
+0x00,0x40,0x01,0x03,0x80,0x80,0x01,0x02,0x80,0x41,0x20,0x01,0x80,0x01,0x20,0x01,
+0x80,0x00,0x06,0x02,0x40,0x01,0x83,0x02,0xc0,0x00,0x03,0x03,0x40,0x03,0x83,0x02,
+0x01,0x01,0xb7,0x02,0xc0,0x02,0x03,0x03,0x40,0x00,0x83,0x03,0x80,0x00,0x05,0x02,
+0x81,0x41,0xb7,0x03,0x40,0x02,0x83,0x03,0x80,0x00,0x05,0x04,0x00,0x00,0x05,0x03,
+0x01,0x81,0xb7,0x02,0x01,0x01,0xb7,0x02,0x80,0x40,0x01,0x03,0x40,0x00,0x03,0x03,
+0xc0,0x00,0x83,0x03,0x01,0x81,0x37,0x03,0xc0,0x03,0x83,0x03,0x81,0xc0,0xb7,0x02,
+0x80,0x41,0x20,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x03,0x7a,0x69,0x70,0x00,0x00,0x00,0x00,0xec,0x00,0x05,0x00,0x0a,
+0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x80,0x00,0x3d,0x02,0xc0,0x33,0x83,0x03,0x40,
+0x32,0x03,0x03,0xc0,0x35,0x83,0x04,0x40,0x35,0x83,0x04,0xc0,0x37,0x03,0x01,0x01,
+0x42,0xb7,0x02,0x80,0x00,0x06,0x03,0x00,0x80,0x01,0x03,0xbf,0xff,0x83,0x03,0x00,
+0x40,0xa0,0x03,0x80,0x40,0x01,0x04,0x3f,0xff,0x83,0x03,0x80,0x80,0xa0,0x02,0x80,
+0x01,0x20,0x02,0x80,0x00,0x06,0x03,0x00,0x80,0x01,0x03,0xbf,0xff,0x03,0x03,0x00,
+0x40,0xa0,0x03,0x80,0x40,0x01,0x04,0x3f,0xff,0x03,0x03,0x80,0x80,0xa0,0x02,0x80,
+0x01,0x20,0x02,0x80,0x00,0x06,0x03,0x00,0x80,0x01,0x03,0xc0,0x02,0x83,0x03,0x00,
+0x40,0xa0,0x03,0x80,0x40,0x01,0x04,0x40,0x02,0x83,0x03,0x80,0x80,0xa0,0x02,0x80,
+0x01,0x20,0x01,0x80,0x00,0xbd,0x02,0xc0,0x7f,0x03,0x02,0x01,0x40,0xb7,0x02,0x80,
+0x00,0x06,0x03,0x01,0x00,0x01,0x03,0xbf,0xff,0x83,0x03,0x00,0x40,0xa0,0x03,0x80,
+0xc0,0x01,0x04,0x3f,0xff,0x83,0x03,0x80,0x80,0xa0,0x02,0x80,0x01,0x20,0x02,0x80,
+0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x05,0x68,0x65,0x6c,0x6c,0x6f,0x00,0x00,
+0x01,0xff,0x00,0x00,0x00,0x03,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x07,0x67,0x65,0x74,0x62,
+0x79,0x74,0x65,0x00,0x00,0x00,0x00,0x87,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,
+0x00,0x0e,0x00,0x80,0x00,0x3d,0x01,0x40,0x31,0x83,0x00,0x80,0x00,0xb0,0x00,0x80,
+0x40,0x20,0x00,0x80,0x00,0xbd,0x00,0x80,0x80,0x20,0x01,0x00,0x01,0x3d,0x00,0x80,
+0xc0,0xb2,0x00,0xc0,0x02,0x19,0x00,0x80,0x01,0xbd,0x00,0x80,0x40,0x20,0x01,0x00,
+0x02,0x3d,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x05,0x00,0x00,
+0x01,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x06,0x22,0x5c,0x30,0x30,0x30,0x22,0x00,
+0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x05,0x22,0x66,0x6f,0x6f,0x22,0x00,0x00,0x00,
+0x04,0x00,0x01,0x2a,0x00,0x00,0x04,0x64,0x75,0x6d,0x70,0x00,0x00,0x07,0x69,0x6e,
+0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xfa,0x00,
+0x02,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,
+0xbd,0x01,0x00,0x00,0x20,0x01,0x80,0x00,0xbd,0x01,0x00,0x40,0xb2,0x01,0x40,0x02,
+0x19,0x01,0x00,0x01,0x3d,0x01,0x00,0x00,0x20,0x01,0x80,0x00,0xbd,0x01,0x00,0x40,
+0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x01,0xbd,0x01,0x00,0x00,0x20,0x01,0x80,0x02,
+0x3d,0x01,0x00,0x40,0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x02,0xbd,0x01,0x00,0x00,
+0x20,0x01,0x80,0x02,0xbd,0x01,0x00,0x40,0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x03,
+0x3d,0x01,0x00,0x00,0x20,0x01,0x80,0x02,0xbd,0x01,0x00,0x40,0xb2,0x01,0x40,0x02,
+0x19,0x01,0x00,0x03,0xbd,0x01,0x00,0x00,0x20,0x01,0x80,0x02,0xbd,0x01,0x00,0x40,
+0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x00,0x3d,0x01,0x00,0x00,0x20,0x01,0x80,0x02,
+0xbd,0x01,0x00,0x40,0xb2,0x01,0x40,0x01,0x99,0x01,0x00,0x40,0x01,0x01,0x80,0x00,
+0x3d,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x08,0x00,0x00,0x07,
+0x20,0x20,0x61,0x62,0x63,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x06,0x20,0x09,0x0d,
+0x0a,0x0c,0x0b,0x00,0x00,0x03,0x00,0x61,0x00,0x00,0x00,0x02,0x00,0x61,0x00,0x00,
+0x03,0x61,0x62,0x63,0x00,0x00,0x05,0x20,0x20,0x61,0x62,0x63,0x00,0x00,0x05,0x61,
+0x62,0x63,0x20,0x20,0x00,0x00,0x00,0x02,0x00,0x05,0x73,0x74,0x72,0x69,0x70,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xfe,0x00,0x02,0x00,0x05,0x00,0x00,0x00,
+0x00,0x00,0x2a,0x00,0x80,0x00,0x3d,0x01,0x00,0x40,0x01,0x01,0x00,0x00,0x20,0x01,
+0x00,0x00,0xbd,0x01,0x00,0x00,0x20,0x01,0x80,0x00,0xbd,0x01,0x00,0x40,0xb2,0x01,
+0x40,0x02,0x19,0x01,0x00,0x01,0x3d,0x01,0x00,0x00,0x20,0x01,0x80,0x00,0xbd,0x01,
+0x00,0x40,0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x01,0xbd,0x01,0x00,0x00,0x20,0x01,
+0x80,0x01,0xbd,0x01,0x00,0x40,0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x02,0x3d,0x01,
+0x00,0x00,0x20,0x01,0x80,0x02,0x3d,0x01,0x00,0x40,0xb2,0x01,0x40,0x02,0x19,0x01,
+0x00,0x02,0xbd,0x01,0x00,0x00,0x20,0x01,0x80,0x02,0x3d,0x01,0x00,0x40,0xb2,0x01,
+0x40,0x02,0x19,0x01,0x00,0x03,0x3d,0x01,0x00,0x00,0x20,0x01,0x80,0x03,0x3d,0x01,
+0x00,0x40,0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x00,0x3d,0x01,0x00,0x00,0x20,0x01,
+0x80,0x03,0x3d,0x01,0x00,0x40,0xb2,0x01,0x40,0x01,0x99,0x01,0x00,0x40,0x01,0x01,
+0x80,0x00,0x3d,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x07,0x00,
+0x00,0x07,0x20,0x20,0x61,0x62,0x63,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x06,0x20,
+0x09,0x0d,0x0a,0x0c,0x0b,0x00,0x00,0x03,0x00,0x61,0x00,0x00,0x00,0x03,0x61,0x62,
+0x63,0x00,0x00,0x05,0x20,0x20,0x61,0x62,0x63,0x00,0x00,0x05,0x61,0x62,0x63,0x20,
+0x20,0x00,0x00,0x00,0x02,0x00,0x06,0x6c,0x73,0x74,0x72,0x69,0x70,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x01,0x03,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x00,0x00,
+0x2a,0x00,0x80,0x00,0x3d,0x01,0x00,0x40,0x01,0x01,0x00,0x00,0x20,0x01,0x00,0x00,
+0xbd,0x01,0x00,0x00,0x20,0x01,0x80,0x00,0xbd,0x01,0x00,0x40,0xb2,0x01,0x40,0x02,
+0x19,0x01,0x00,0x01,0x3d,0x01,0x00,0x00,0x20,0x01,0x80,0x00,0xbd,0x01,0x00,0x40,
+0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x01,0xbd,0x01,0x00,0x00,0x20,0x01,0x80,0x02,
+0x3d,0x01,0x00,0x40,0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x02,0xbd,0x01,0x00,0x00,
+0x20,0x01,0x80,0x02,0xbd,0x01,0x00,0x40,0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x03,
+0x3d,0x01,0x00,0x00,0x20,0x01,0x80,0x03,0x3d,0x01,0x00,0x40,0xb2,0x01,0x40,0x02,
+0x19,0x01,0x00,0x03,0xbd,0x01,0x00,0x00,0x20,0x01,0x80,0x02,0xbd,0x01,0x00,0x40,
+0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x00,0x3d,0x01,0x00,0x00,0x20,0x01,0x80,0x03,
+0x3d,0x01,0x00,0x40,0xb2,0x01,0x40,0x01,0x99,0x01,0x00,0x40,0x01,0x01,0x80,0x00,
+0x3d,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x08,0x00,0x00,0x07,
+0x20,0x20,0x61,0x62,0x63,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x06,0x20,0x09,0x0d,
+0x0a,0x0c,0x0b,0x00,0x00,0x03,0x00,0x61,0x00,0x00,0x00,0x02,0x00,0x61,0x00,0x00,
+0x03,0x61,0x62,0x63,0x00,0x00,0x05,0x20,0x20,0x61,0x62,0x63,0x00,0x00,0x05,0x61,
+0x62,0x63,0x20,0x20,0x00,0x00,0x00,0x02,0x00,0x06,0x72,0x73,0x74,0x72,0x69,0x70,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x74,0x00,0x03,0x00,0x06,0x00,0x00,
+0x00,0x00,0x00,0x10,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0xbd,0x01,0x80,0x40,0x01,
+0x01,0x80,0x00,0x20,0x02,0x00,0x00,0xbd,0x01,0x80,0x40,0xb2,0x01,0xc0,0x01,0x99,
+0x01,0x80,0x40,0x01,0x02,0x00,0x00,0xbd,0x01,0x80,0x40,0xb2,0x01,0xc0,0x02,0x19,
+0x01,0x80,0x80,0x01,0x01,0x80,0x00,0x20,0x02,0x00,0x00,0x05,0x01,0x80,0x40,0xb2,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x07,0x20,0x20,0x61,0x62,0x63,
+0x20,0x20,0x00,0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x00,0x02,0x00,0x06,0x73,0x74,
+0x72,0x69,0x70,0x21,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x77,0x00,0x03,
+0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0xbd,
+0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x02,0x00,0x00,0xbd,0x01,0x80,0x40,0xb2,
+0x01,0xc0,0x01,0x99,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0xbd,0x01,0x80,0x40,0xb2,
+0x01,0xc0,0x02,0x19,0x01,0x80,0x80,0x01,0x01,0x80,0x00,0x20,0x02,0x00,0x00,0x05,
+0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x07,0x20,
+0x20,0x61,0x62,0x63,0x20,0x20,0x00,0x00,0x05,0x61,0x62,0x63,0x20,0x20,0x00,0x00,
+0x00,0x02,0x00,0x07,0x6c,0x73,0x74,0x72,0x69,0x70,0x21,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x77,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x10,0x00,
+0x80,0x00,0x3d,0x01,0x00,0x00,0xbd,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x02,
+0x00,0x00,0xbd,0x01,0x80,0x40,0xb2,0x01,0xc0,0x01,0x99,0x01,0x80,0x40,0x01,0x02,
+0x00,0x00,0xbd,0x01,0x80,0x40,0xb2,0x01,0xc0,0x02,0x19,0x01,0x80,0x80,0x01,0x01,
+0x80,0x00,0x20,0x02,0x00,0x00,0x05,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x02,0x00,0x00,0x07,0x20,0x20,0x61,0x62,0x63,0x20,0x20,0x00,0x00,0x05,
+0x20,0x20,0x61,0x62,0x63,0x00,0x00,0x00,0x02,0x00,0x07,0x72,0x73,0x74,0x72,0x69,
+0x70,0x21,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x8a,0x00,0x01,0x00,0x05,
+0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,
+0x00,0xbd,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,
+0x01,0x3d,0x01,0x80,0x01,0xbd,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x04,0x00,0x00,0x05,0x68,0x45,0x4c,0x4c,0x4f,0x00,0x00,
+0x05,0x48,0x65,0x6c,0x6c,0x6f,0x00,0x00,0x0c,0x43,0x79,0x42,0x65,0x52,0x5f,0x70,
+0x55,0x6e,0x4b,0x31,0x31,0x00,0x00,0x0c,0x63,0x59,0x62,0x45,0x72,0x5f,0x50,0x75,
+0x4e,0x6b,0x31,0x31,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x08,0x73,0x77,0x61,0x70,0x63,0x61,0x73,
+0x65,0x00,0x00,0x00,0x00,0x78,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x0b,
+0x00,0x80,0x00,0x3d,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x00,0xc0,0x01,
+0x01,0x80,0x40,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,
+0x02,0x80,0x80,0x01,0x01,0x80,0x81,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x01,
+0x00,0x00,0x05,0x48,0x65,0x6c,0x6c,0x6f,0x00,0x00,0x00,0x04,0x00,0x05,0x63,0x6c,
+0x6f,0x6e,0x65,0x00,0x00,0x09,0x73,0x77,0x61,0x70,0x63,0x61,0x73,0x65,0x21,0x00,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,
+0x08,0x73,0x77,0x61,0x70,0x63,0x61,0x73,0x65,0x00,0x00,0x00,0x00,0x98,0x00,0x03,
+0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x80,0x00,0x3d,0x01,0x80,0x40,0x01,
+0x02,0x00,0x00,0xbd,0x01,0x80,0x00,0xa0,0x01,0x00,0x00,0x3d,0x01,0x80,0x80,0x01,
+0x02,0x00,0x00,0xbd,0x01,0x80,0x40,0xa0,0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x3d,
+0x02,0x80,0x80,0x01,0x01,0x80,0x81,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x3d,
+0x02,0x80,0x40,0x01,0x01,0x80,0x81,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x03,
+0x00,0x00,0x06,0x48,0x65,0x6c,0x6c,0x6f,0x20,0x00,0x00,0x06,0x57,0x6f,0x72,0x6c,
+0x64,0x21,0x00,0x00,0x0c,0x48,0x65,0x6c,0x6c,0x6f,0x20,0x57,0x6f,0x72,0x6c,0x64,
+0x21,0x00,0x00,0x00,0x03,0x00,0x06,0x63,0x6f,0x6e,0x63,0x61,0x74,0x00,0x00,0x02,
+0x3c,0x3c,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x00,0x01,0x08,0x00,0x02,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x25,
+0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,0xbd,
+0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,
+0x02,0x00,0x01,0x3d,0x02,0x80,0x00,0x3d,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,
+0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x03,0x02,0x00,0x00,0x3d,0x02,0x80,0x01,0xbd,
+0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,
+0x02,0x00,0x00,0x3d,0x02,0x80,0x02,0x3d,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,
+0x01,0x00,0x01,0x11,0x01,0x00,0xc0,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x80,0x47,
+0x01,0x80,0x00,0xc0,0x01,0x01,0x00,0x46,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,
+0x02,0x00,0x00,0x3d,0x02,0x80,0x40,0x01,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,
+0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x05,0x00,0x00,0x06,0x61,0x62,0x63,0x64,0x65,
+0x66,0x00,0x00,0x05,0x61,0x62,0x63,0x64,0x65,0x00,0x00,0x06,0x61,0x42,0x63,0x44,
+0x65,0x46,0x00,0x00,0x07,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x00,0x00,0x06,0x41,
+0x42,0x43,0x44,0x45,0x46,0x00,0x00,0x00,0x05,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x07,0x63,0x61,0x73,0x65,0x63,0x6d,
+0x70,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,
+0x00,0x00,0x06,0x74,0x6f,0x5f,0x73,0x74,0x72,0x00,0x00,0x00,0x00,0x2b,0x00,0x02,
+0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x3d,
+0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x06,0x41,0x42,0x43,0x44,0x45,
+0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdc,0x00,0x01,0x00,0x06,0x00,0x01,0x00,
+0x00,0x00,0x19,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,
+0x00,0x01,0x3d,0x01,0x00,0x41,0x20,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,
+0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0xbd,0x01,0x00,0x41,0x20,0x01,
+0x00,0x80,0x20,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x02,0x3d,0x01,
+0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x01,0x00,0x41,0x20,0x01,0x00,0x80,0x20,0x00,
+0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x02,0x11,0x01,0x80,0x01,0x40,0x00,
+0x80,0xc0,0xa1,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x05,0x00,0x00,0x05,0x68,0x65,
+0x6c,0x6c,0x6f,0x00,0x00,0x06,0x68,0x65,0x61,0x76,0x65,0x6e,0x00,0x00,0x04,0x68,
+0x65,0x6c,0x6c,0x00,0x00,0x08,0x70,0x61,0x72,0x61,0x64,0x69,0x73,0x65,0x00,0x00,
+0x01,0x68,0x00,0x00,0x00,0x05,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,
+0x72,0x75,0x65,0x00,0x00,0x0b,0x73,0x74,0x61,0x72,0x74,0x5f,0x77,0x69,0x74,0x68,
+0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,
+0x61,0x69,0x73,0x65,0x00,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,
+0x00,0x00,0x00,0x00,0x3c,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+0x80,0x00,0x3d,0x01,0x00,0x00,0x07,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x01,0x00,0x00,0x05,0x68,0x65,0x6c,0x6c,0x6f,0x00,0x00,0x00,0x01,0x00,
+0x0b,0x73,0x74,0x61,0x72,0x74,0x5f,0x77,0x69,0x74,0x68,0x3f,0x00,0x00,0x00,0x00,
+0xd9,0x00,0x01,0x00,0x06,0x00,0x01,0x00,0x00,0x00,0x19,0x00,0x80,0x00,0x06,0x01,
+0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x01,0x00,0x41,0x20,0x00,
+0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x01,0xbd,0x02,
+0x00,0x02,0x3d,0x01,0x00,0x41,0x20,0x01,0x00,0x80,0x20,0x00,0x80,0x00,0xa0,0x00,
+0x80,0x00,0x06,0x01,0x00,0x02,0xbd,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x01,
+0x00,0x41,0x20,0x01,0x00,0x80,0x20,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,
+0x00,0x02,0x11,0x01,0x80,0x01,0x40,0x00,0x80,0xc0,0xa1,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x06,0x00,0x00,0x06,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x03,0x69,
+0x6e,0x67,0x00,0x00,0x03,0x6d,0x6e,0x67,0x00,0x00,0x03,0x73,0x74,0x72,0x00,0x00,
+0x03,0x74,0x72,0x69,0x00,0x00,0x02,0x6e,0x67,0x00,0x00,0x00,0x05,0x00,0x0b,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x09,0x65,0x6e,0x64,
+0x5f,0x77,0x69,0x74,0x68,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x0c,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x09,0x54,0x79,0x70,0x65,
+0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x3a,0x00,0x01,0x00,0x04,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0x07,0x00,0x80,0x00,0xa0,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x05,0x68,0x65,0x6c,0x6c,0x6f,
+0x00,0x00,0x00,0x01,0x00,0x09,0x65,0x6e,0x64,0x5f,0x77,0x69,0x74,0x68,0x3f,0x00,
+0x00,0x00,0x01,0x6d,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x80,
+0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x01,0x00,
+0x81,0xb7,0x01,0x80,0x01,0xbd,0x02,0x00,0x00,0xbd,0x01,0x80,0x40,0xa0,0x00,0x80,
+0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x02,0x3d,0x01,0x80,0x02,0xbd,0x02,0x00,
+0x02,0xbd,0x01,0x00,0x81,0xb7,0x01,0x80,0x02,0x3d,0x02,0x00,0x00,0xbd,0x01,0x80,
+0x40,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x02,0xbd,0x01,0x80,
+0x02,0xbd,0x02,0x00,0x02,0x3d,0x01,0x00,0x81,0xb7,0x01,0x80,0x02,0x3d,0x02,0x00,
+0x02,0xbd,0x01,0x80,0x40,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,
+0x02,0xbd,0x01,0x80,0x00,0x3d,0x02,0x00,0x03,0x3d,0x01,0x00,0x81,0xb7,0x01,0x80,
+0x02,0x3d,0x02,0x00,0x00,0x3d,0x01,0x80,0x40,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,
+0x00,0x06,0x01,0x00,0x03,0x3d,0x01,0x80,0x03,0xbd,0x02,0x00,0x02,0xbd,0x01,0x00,
+0x81,0xb7,0x01,0x80,0x04,0x3d,0x02,0x00,0x03,0xbd,0x01,0x80,0x40,0xa0,0x00,0x80,
+0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x02,0xbd,0x01,0x80,0x03,0xbd,0x02,0x00,
+0x03,0x3d,0x01,0x00,0x81,0xb7,0x01,0x80,0x04,0xbd,0x02,0x00,0x03,0xbd,0x01,0x80,
+0x40,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x02,0xbd,0x01,0x80,
+0x02,0xbd,0x02,0x00,0x02,0xbd,0x01,0x00,0x81,0xb7,0x01,0x80,0x02,0xbd,0x02,0x00,
+0x00,0x3d,0x01,0x80,0x40,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x0a,0x00,0x00,0x01,0x61,0x00,0x00,0x01,0x78,0x00,0x00,0x03,0x61,0x78,0x61,
+0x00,0x00,0x05,0x61,0x78,0x61,0x78,0x61,0x00,0x00,0x05,0x61,0x61,0x61,0x61,0x61,
+0x00,0x00,0x00,0x00,0x00,0x04,0x61,0x61,0x61,0x61,0x00,0x00,0x01,0x62,0x00,0x00,
+0x05,0x61,0x61,0x61,0x61,0x62,0x00,0x00,0x05,0x62,0x61,0x61,0x61,0x61,0x00,0x00,
+0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x09,0x70,0x61,0x72,0x74,0x69,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,0x01,
+0x6e,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x80,0x00,0x06,0x01,
+0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x01,0x00,0x81,0xb7,0x01,
+0x80,0x01,0xbd,0x02,0x00,0x00,0xbd,0x01,0x80,0x40,0xa0,0x00,0x80,0x01,0x20,0x00,
+0x80,0x00,0x06,0x01,0x00,0x02,0x3d,0x01,0x80,0x02,0x3d,0x02,0x00,0x02,0xbd,0x01,
+0x00,0x81,0xb7,0x01,0x80,0x02,0xbd,0x02,0x00,0x00,0xbd,0x01,0x80,0x40,0xa0,0x00,
+0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x02,0xbd,0x01,0x80,0x02,0x3d,0x02,
+0x00,0x02,0x3d,0x01,0x00,0x81,0xb7,0x01,0x80,0x02,0xbd,0x02,0x00,0x02,0x3d,0x01,
+0x80,0x40,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x03,0x3d,0x01,
+0x80,0x01,0x3d,0x02,0x00,0x02,0x3d,0x01,0x00,0x81,0xb7,0x01,0x80,0x02,0xbd,0x02,
+0x00,0x01,0x3d,0x01,0x80,0x40,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,
+0x00,0x03,0x3d,0x01,0x80,0x03,0xbd,0x02,0x00,0x02,0x3d,0x01,0x00,0x81,0xb7,0x01,
+0x80,0x04,0x3d,0x02,0x00,0x03,0xbd,0x01,0x80,0x40,0xa0,0x00,0x80,0x01,0x20,0x00,
+0x80,0x00,0x06,0x01,0x00,0x02,0x3d,0x01,0x80,0x03,0xbd,0x02,0x00,0x03,0x3d,0x01,
+0x00,0x81,0xb7,0x01,0x80,0x04,0xbd,0x02,0x00,0x03,0xbd,0x01,0x80,0x40,0xa0,0x00,
+0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x02,0x3d,0x01,0x80,0x02,0x3d,0x02,
+0x00,0x02,0x3d,0x01,0x00,0x81,0xb7,0x01,0x80,0x02,0x3d,0x02,0x00,0x01,0x3d,0x01,
+0x80,0x40,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x0a,0x00,
+0x00,0x03,0x61,0x78,0x61,0x00,0x00,0x01,0x78,0x00,0x00,0x01,0x61,0x00,0x00,0x05,
+0x61,0x78,0x61,0x78,0x61,0x00,0x00,0x00,0x00,0x00,0x05,0x61,0x61,0x61,0x61,0x61,
+0x00,0x00,0x04,0x61,0x61,0x61,0x61,0x00,0x00,0x01,0x62,0x00,0x00,0x05,0x61,0x61,
+0x61,0x61,0x62,0x00,0x00,0x05,0x62,0x61,0x61,0x61,0x61,0x00,0x00,0x00,0x02,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x0a,
+0x72,0x70,0x61,0x72,0x74,0x69,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,0x00,0xfd,0x00,
+0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x80,0x00,0x06,0x01,0x40,0x07,
+0x83,0x01,0x80,0x00,0x3d,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,
+0x06,0x01,0x40,0x7f,0x03,0x01,0x80,0x00,0xbd,0x01,0x80,0x40,0x20,0x00,0x80,0x01,
+0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x07,0x83,0x01,0x80,0x01,0x3d,0x01,0x80,0x40,
+0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x3f,0xf7,0x83,0x01,0x80,0x01,
+0xbd,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x3f,0xff,
+0x83,0x01,0x80,0x02,0x3d,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,
+0x06,0x01,0x40,0x07,0x83,0x01,0x80,0x02,0xbd,0x01,0x80,0x40,0x20,0x00,0x80,0x01,
+0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x07,0x83,0x01,0x80,0x03,0x3d,0x01,0x80,0x40,
+0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x3f,0xff,0x83,0x01,0x80,0x03,
+0xbd,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x08,0x00,0x00,0x02,0x31,0x30,0x00,0x00,0x02,0x66,0x66,0x00,0x00,0x04,0x30,0x78,
+0x31,0x30,0x00,0x00,0x05,0x2d,0x30,0x78,0x31,0x30,0x00,0x00,0x03,0x78,0x79,0x7a,
+0x00,0x00,0x03,0x31,0x30,0x7a,0x00,0x00,0x03,0x31,0x5f,0x30,0x00,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x03,0x68,0x65,0x78,0x00,0x00,0x00,0x01,0x12,0x00,0x01,0x00,0x05,
+0x00,0x00,0x00,0x00,0x00,0x2e,0x00,0x80,0x00,0x06,0x01,0x40,0x03,0x83,0x01,0x80,
+0x00,0x3d,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,
+0x03,0x03,0x01,0x80,0x00,0xbd,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,
+0x00,0x06,0x01,0x3f,0xff,0x83,0x01,0x80,0x01,0x3d,0x01,0x80,0x40,0x20,0x00,0x80,
+0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x3f,0xff,0x83,0x01,0x80,0x01,0xbd,0x01,0x80,
+0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x3f,0xff,0x83,0x01,0x80,
+0x02,0x3d,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,
+0x03,0x83,0x01,0x80,0x02,0xbd,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,
+0x00,0x06,0x01,0x40,0x03,0x83,0x01,0x80,0x03,0x3d,0x01,0x80,0x40,0x20,0x00,0x80,
+0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x03,0x83,0x01,0x80,0x03,0xbd,0x01,0x80,
+0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x3f,0xfb,0x83,0x01,0x80,
+0x04,0x3d,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x09,0x00,0x00,0x02,0x31,0x30,0x00,0x00,0x01,0x37,0x00,0x00,0x01,0x38,0x00,
+0x00,0x01,0x39,0x00,0x00,0x03,0x78,0x79,0x7a,0x00,0x00,0x03,0x31,0x30,0x7a,0x00,
+0x00,0x03,0x31,0x5f,0x30,0x00,0x00,0x03,0x30,0x31,0x30,0x00,0x00,0x03,0x2d,0x31,
+0x30,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x03,0x6f,0x63,0x74,0x00,0x00,0x00,0x00,0xd7,0x00,0x01,
+0x00,0x05,0x00,0x02,0x00,0x00,0x00,0x19,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,
+0x01,0xc0,0x20,0x03,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,
+0x01,0x00,0x00,0xbd,0x01,0xc0,0x20,0x83,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,
+0x00,0x80,0x01,0x3d,0x00,0x80,0x80,0x20,0x01,0x40,0x03,0x03,0x00,0x80,0xc0,0xb2,
+0x00,0xc0,0x02,0x99,0x00,0x80,0x00,0x06,0x01,0x00,0x02,0x91,0x01,0x80,0x01,0x40,
+0x00,0x81,0x00,0xa1,0x00,0x40,0x02,0x17,0x00,0x80,0x00,0x06,0x01,0x00,0x02,0x91,
+0x01,0x80,0x03,0x40,0x00,0x81,0x00,0xa1,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x03,
+0x00,0x00,0x01,0x41,0x00,0x00,0x01,0x42,0x00,0x00,0x15,0xe3,0x81,0x93,0xe3,0x82,
+0x93,0xe3,0x81,0xab,0xe3,0x81,0xa1,0xe3,0x82,0x8f,0xe4,0xb8,0x96,0xe7,0x95,0x8c,
+0x00,0x00,0x00,0x06,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,
+0x61,0x6c,0x00,0x00,0x03,0x63,0x68,0x72,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,
+0x69,0x73,0x65,0x00,0x00,0x0a,0x52,0x61,0x6e,0x67,0x65,0x45,0x72,0x72,0x6f,0x72,
+0x00,0x00,0x00,0x00,0x32,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x80,0x00,0x02,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x01,
+0x00,0x07,0x31,0x31,0x31,0x34,0x31,0x31,0x32,0x00,0x00,0x00,0x01,0x00,0x03,0x63,
+0x68,0x72,0x00,0x00,0x00,0x00,0x28,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0xc0,0x7f,0x83,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x03,0x63,0x68,0x72,0x00,0x00,0x00,0x00,0x47,0x00,
+0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x06,0x01,0x40,0x19,
+0x83,0x01,0xc0,0xb6,0x03,0x02,0x40,0x03,0x03,0x01,0x80,0x40,0xa0,0x00,0x80,0x01,
+0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x03,0x64,0x69,
+0x76,0x00,0x00,0x00,0x00,0x60,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x07,
+0x00,0x80,0x00,0x06,0x01,0x40,0x19,0x83,0x01,0x80,0x00,0x02,0x02,0x40,0x03,0x03,
+0x01,0x80,0x40,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,
+0x02,0x00,0x16,0x33,0x2e,0x36,0x35,0x32,0x34,0x32,0x35,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x31,0x65,0x2b,0x30,0x32,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x03,0x64,0x69,
+0x76,0x00,0x00,0x00,0x00,0x81,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x0b,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x01,0x11,0x01,0x80,0xc0,0x20,
+0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x02,0x11,0x01,0x80,0x01,0x11,
+0x01,0x81,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x06,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,
+0x61,0x6c,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x06,0x42,0x69,0x67,
+0x6e,0x75,0x6d,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x07,0x49,0x6e,
+0x74,0x65,0x67,0x65,0x72,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x00,0x01,0xa8,0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
+0x4e,0x00,0xc0,0x00,0x03,0x00,0x40,0x02,0x97,0x01,0x80,0x40,0x01,0x02,0x40,0x00,
+0x83,0x01,0x80,0x00,0xb0,0x01,0x80,0x40,0xad,0x00,0x80,0xc0,0x01,0x01,0x80,0x40,
+0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x00,0xb0,0x01,0x80,0x40,0xad,0x01,0x80,0x80,
+0x20,0x02,0x00,0x02,0x11,0x01,0x80,0xc0,0xb2,0x01,0xbf,0xf9,0x98,0x01,0x80,0x00,
+0x06,0x02,0x00,0x03,0x11,0x02,0x80,0x40,0x01,0x02,0x80,0x40,0xad,0x02,0x80,0x80,
+0x20,0x01,0x81,0x41,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x03,0x11,0x02,0x80,0x40,
+0x01,0x02,0x81,0xc0,0x20,0x02,0x82,0x01,0x2f,0x02,0x80,0x80,0x20,0x01,0x81,0x41,
+0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x03,0x11,0x02,0x80,0x40,0x01,0x03,0x00,0x40,
+0x01,0x02,0x80,0x00,0xb0,0x02,0x80,0x80,0x20,0x01,0x81,0x41,0x20,0x01,0x80,0x00,
+0x06,0x02,0x00,0x02,0x11,0x02,0x80,0x40,0x01,0x02,0x80,0x40,0xad,0x02,0x82,0x00,
+0xaf,0x02,0x80,0x80,0x20,0x01,0x81,0x41,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x40,
+0x01,0x02,0x80,0x40,0x01,0x03,0x00,0x40,0x01,0x02,0x80,0x00,0xb0,0x03,0x00,0x40,
+0x01,0x02,0x82,0x40,0xa0,0x01,0x81,0x41,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x40,
+0x01,0x02,0x00,0x40,0xad,0x02,0x02,0x80,0x20,0x02,0x80,0x40,0x01,0x02,0x82,0xc0,
+0x20,0x02,0x80,0x40,0xad,0x02,0x83,0x00,0x20,0x02,0x82,0x80,0x20,0x01,0x81,0x41,
+0x20,0x01,0x00,0x40,0x01,0x01,0x80,0x80,0x01,0x01,0x80,0x40,0xad,0x01,0x00,0xc0,
+0x01,0x01,0x80,0x00,0x06,0x02,0x00,0x03,0x11,0x02,0x80,0x80,0x01,0x02,0x80,0x80,
+0x20,0x01,0x81,0x41,0x20,0x01,0x80,0x80,0x01,0x01,0x82,0x00,0xaf,0x01,0x00,0xc0,
+0x01,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x11,0x02,0x80,0x80,0x01,0x02,0x80,0x80,
+0x20,0x01,0x81,0x41,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x00,0x01,0x2a,0x00,0x00,0x01,0x2b,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x46,0x69,0x78,0x6e,0x75,0x6d,0x00,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x06,
+0x42,0x69,0x67,0x6e,0x75,0x6d,0x00,0x00,0x02,0x2d,0x40,0x00,0x00,0x01,0x2d,0x00,
+0x00,0x03,0x64,0x69,0x76,0x00,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x04,0x74,
+0x6f,0x5f,0x66,0x00,0x00,0x04,0x74,0x6f,0x5f,0x69,0x00,0x00,0x00,0x01,0x7d,0x00,
+0x02,0x00,0x06,0x00,0x01,0x00,0x00,0x00,0x32,0x01,0x00,0x00,0x06,0x01,0x80,0x00,
+0x91,0x02,0x00,0x00,0x02,0x02,0x00,0x80,0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0x80,0x00,0xbd,0x02,0x00,0x00,0x02,0x02,0x00,0xc0,0x20,0x01,0x00,0x01,
+0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x83,0x02,0x40,0x1f,0x83,0x01,0x81,0x00,
+0xa0,0x01,0x81,0x40,0xaf,0x02,0x00,0x01,0x02,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0xc0,0x00,0x83,0x02,0x40,0x22,0x83,0x01,0x81,0x00,0xa0,0x02,0x00,0x01,
+0x82,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x03,0x83,0x02,0x40,0x0e,
+0x83,0x01,0x81,0x00,0xa0,0x02,0x00,0x02,0x02,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0xc0,0x00,0x83,0x02,0x40,0x1f,0x83,0x01,0x81,0x00,0xa0,0x01,0x81,0x80,
+0x20,0x02,0x00,0x02,0x82,0x01,0x00,0x01,0x20,0x00,0x80,0x80,0x37,0x01,0x40,0x01,
+0x03,0x01,0x80,0x01,0x40,0x01,0x01,0xc0,0x21,0x01,0x00,0x00,0x06,0x01,0xc0,0x04,
+0x83,0x02,0x40,0x09,0x83,0x01,0x81,0x00,0xa0,0x01,0x80,0xc0,0xb7,0x02,0x40,0x01,
+0x03,0x01,0x82,0x00,0xb0,0x02,0x00,0x40,0x01,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x06,0x00,0x00,0x0a,0x00,0x2b,0xd2,0x0a,0x1f,0xeb,0x8c,0xa9,
+0x54,0xab,0x00,0x00,0x14,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x31,
+0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x00,0x00,0x0a,0x00,0x2b,0xff,0xff,
+0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x0b,0x00,0x2b,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x40,0x00,0x00,0x0e,0x00,0x2b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x0b,0x00,0x2d,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x06,0x42,0x69,0x67,0x6e,0x75,0x6d,0x00,0x00,
+0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x02,
+0x2a,0x2a,0x00,0x00,0x01,0x2d,0x00,0x00,0x02,0x2d,0x40,0x00,0x00,0x05,0x74,0x69,
+0x6d,0x65,0x73,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x00,0x39,0x00,0x01,0x00,0x04,
+0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x80,0x40,0x15,0x01,0x00,0x00,0x02,0x00,0x80,
+0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x0b,0x00,0x2b,0x00,
+0x00,0x10,0x63,0x2d,0x5e,0xc7,0x6b,0x05,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,
+0x00,0x00,0x00,0x00,0x34,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x00,0x00,0x26,0x01,0x00,0x00,0x02,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x00,
+0x00,0x0f,0x00,0x2d,0xd2,0x0a,0x3f,0x4e,0xee,0xe0,0x73,0xc3,0xf6,0x0f,0xe9,0x8e,
+0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x15,0x00,0x03,0x00,0x07,0x00,0x04,0x00,
+0x00,0x00,0x1f,0x01,0x80,0x00,0x11,0x02,0x00,0x00,0x91,0x01,0x80,0xc1,0x37,0x02,
+0x00,0x01,0x40,0x01,0x80,0x80,0x21,0x00,0x00,0x01,0x1e,0x01,0xc0,0x00,0x03,0x02,
+0x40,0x01,0x03,0x01,0x80,0xc0,0x41,0x02,0x00,0x03,0x40,0x01,0x80,0xc0,0x21,0x00,
+0x80,0xc0,0x01,0x01,0x80,0x00,0x3d,0x01,0x81,0x00,0x20,0x01,0x00,0xc0,0x01,0x00,
+0x80,0x00,0x1f,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0xbd,0x02,0x01,0x00,0xb7,0x02,
+0xc0,0x01,0x03,0x02,0x01,0x80,0xb0,0x02,0x80,0x40,0x01,0x03,0x00,0x07,0x40,0x02,
+0x80,0xc0,0x21,0x01,0x81,0x41,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x3d,0x02,
+0x80,0x80,0x01,0x02,0x81,0xc0,0x20,0x01,0x81,0x41,0x20,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x02,0x00,0x00,0x1e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,
+0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x31,0x32,0x33,0x34,0x35,0x36,
+0x37,0x38,0x39,0x30,0x00,0x00,0x1f,0x2d,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,
+0x39,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x31,0x32,0x33,0x34,
+0x35,0x36,0x37,0x38,0x39,0x30,0x00,0x00,0x00,0x08,0x00,0x06,0x46,0x69,0x78,0x6e,
+0x75,0x6d,0x00,0x00,0x06,0x42,0x69,0x67,0x6e,0x75,0x6d,0x00,0x00,0x04,0x65,0x61,
+0x63,0x68,0x00,0x00,0x03,0x6d,0x61,0x70,0x00,0x00,0x04,0x74,0x6f,0x5f,0x69,0x00,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,
+0x01,0x2a,0x00,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x00,0x00,0x37,0x00,0x03,
+0x00,0x05,0x00,0x01,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,
+0x02,0x00,0x01,0x40,0x01,0x80,0x00,0x21,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x0a,0x63,0x6c,0x61,0x73,0x73,0x5f,0x65,0x76,0x61,0x6c,
+0x00,0x00,0x00,0x00,0x96,0x00,0x01,0x00,0x05,0x00,0x02,0x00,0x00,0x00,0x11,0x00,
+0x80,0x00,0x06,0x01,0x00,0x00,0x84,0x01,0x80,0x01,0x04,0x00,0x80,0x01,0x20,0x00,
+0x80,0x00,0x06,0x01,0x00,0x01,0x84,0x01,0x80,0x02,0x04,0x00,0x80,0x01,0x20,0x00,
+0x80,0x00,0x06,0x01,0x00,0x01,0x04,0x01,0x80,0x01,0x40,0x00,0x81,0x40,0xa1,0x00,
+0x80,0x00,0x06,0x01,0x00,0x02,0x04,0x01,0x80,0x03,0x40,0x00,0x81,0x40,0xa1,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x0c,0x61,0x6c,0x69,
+0x61,0x73,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x07,0x5f,0x5f,0x6d,0x75,
+0x6c,0x5f,0x5f,0x00,0x00,0x01,0x2a,0x00,0x00,0x08,0x5f,0x5f,0x70,0x6c,0x75,0x73,
+0x5f,0x5f,0x00,0x00,0x01,0x2b,0x00,0x00,0x0d,0x64,0x65,0x66,0x69,0x6e,0x65,0x5f,
+0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x00,0x00,0x22,0x00,0x03,0x00,0x04,0x00,
+0x00,0x00,0x00,0x00,0x03,0x02,0x00,0x00,0x26,0x01,0xbf,0xff,0x83,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x03,0x00,
+0x04,0x00,0x00,0x00,0x00,0x00,0x03,0x02,0x00,0x00,0x26,0x01,0xbf,0xff,0x83,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x00,0x06,0x00,0x80,0x00,
+0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0e,0x62,
+0x69,0x67,0x6e,0x75,0x6d,0x5f,0x6c,0x69,0x74,0x65,0x72,0x61,0x6c,0x00,0x00,0x00,
+0x00,0x47,0x00,0x01,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x11,
+0x01,0x00,0x00,0x91,0x00,0x80,0x41,0x37,0x01,0x00,0x01,0x40,0x00,0x80,0x80,0x21,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x06,0x46,0x69,
+0x78,0x6e,0x75,0x6d,0x00,0x00,0x06,0x42,0x69,0x67,0x6e,0x75,0x6d,0x00,0x00,0x04,
+0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x37,0x00,0x03,0x00,0x05,0x00,0x01,0x00,
+0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x01,0x40,0x01,
+0x80,0x00,0x21,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x0a,0x63,0x6c,0x61,0x73,0x73,0x5f,0x65,0x76,0x61,0x6c,0x00,0x00,0x00,0x00,0x86,
+0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x80,0x00,0x06,0x01,0x00,
+0x00,0x84,0x01,0x80,0x01,0x04,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,
+0x01,0x84,0x01,0x80,0x02,0x04,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,
+0x01,0x04,0x01,0x80,0x02,0x04,0x00,0x81,0x41,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x0c,0x61,0x6c,0x69,0x61,0x73,0x5f,0x6d,0x65,
+0x74,0x68,0x6f,0x64,0x00,0x00,0x01,0x2a,0x00,0x00,0x07,0x5f,0x5f,0x6d,0x75,0x6c,
+0x5f,0x5f,0x00,0x00,0x01,0x2b,0x00,0x00,0x08,0x5f,0x5f,0x70,0x6c,0x75,0x73,0x5f,
+0x5f,0x00,0x00,0x0d,0x72,0x65,0x6d,0x6f,0x76,0x65,0x5f,0x6d,0x65,0x74,0x68,0x6f,
+0x64,0x00,0x00,0x00,0x00,0x2d,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x04,
+0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,
+0x00,0x01,0x6b,0x00,0x01,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x80,0x00,
+0x06,0x01,0x00,0x00,0x02,0x01,0x80,0x00,0xbd,0x01,0x80,0x40,0x20,0x00,0x80,0x01,
+0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x07,0x83,0x01,0xc0,0x09,0x83,0x01,0x00,0x80,
+0xa0,0x01,0x00,0xc0,0x20,0x01,0x80,0x01,0x3d,0x02,0x40,0x07,0x83,0x01,0x80,0x40,
+0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x83,0x01,0xc0,0x1f,
+0x83,0x01,0x00,0x80,0xa0,0x01,0x01,0x00,0xaf,0x01,0x80,0x01,0xbd,0x02,0x3f,0xff,
+0x83,0x01,0x80,0x40,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x11,
+0x83,0x01,0xc0,0x09,0x83,0x01,0x00,0x80,0xa0,0x01,0x01,0x00,0xaf,0x01,0x80,0x02,
+0x3d,0x02,0x40,0x09,0x83,0x01,0x81,0x40,0xb0,0x02,0x40,0x11,0x83,0x01,0x80,0x40,
+0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x04,0x83,0x01,0xc0,0x0e,
+0x83,0x01,0x00,0x80,0xa0,0x01,0x80,0x02,0xbd,0x02,0x00,0x03,0x3d,0x02,0xc0,0x0e,
+0x83,0x02,0x01,0x40,0xb0,0x01,0x81,0x00,0x3e,0x02,0x00,0x03,0xbd,0x01,0x81,0x00,
+0x3e,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x08,0x00,0x00,0x0a,0x00,0x2b,0xd2,0x0a,0x1f,0xeb,0x8c,0xa9,0x54,0xab,0x00,0x00,
+0x14,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x31,0x32,0x33,0x34,0x35,
+0x36,0x37,0x38,0x39,0x30,0x00,0x00,0x1b,0x2d,0x31,0x5f,0x30,0x30,0x30,0x30,0x5f,
+0x30,0x30,0x30,0x30,0x5f,0x30,0x30,0x30,0x30,0x5f,0x30,0x30,0x30,0x30,0x5f,0x30,
+0x30,0x30,0x30,0x00,0x00,0x12,0x30,0x78,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x00,0x00,0x01,0x7a,0x00,0x00,0x01,0x31,
+0x00,0x00,0x01,0x30,0x00,0x00,0x07,0x20,0x61,0x70,0x70,0x6c,0x65,0x73,0x00,0x00,
+0x00,0x06,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x04,0x74,0x6f,0x5f,0x69,0x00,0x00,0x02,0x2a,0x2a,0x00,0x00,0x02,0x2d,
+0x40,0x00,0x00,0x01,0x2d,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x01,0x83,0x00,0x02,
+0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x39,0x01,0x40,0x00,0x83,0x01,0xc0,0x31,0x83,
+0x01,0x00,0x00,0xa0,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x3d,
+0x02,0x00,0x40,0x01,0x02,0x00,0x80,0x20,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x06,
+0x01,0x80,0x00,0xbd,0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0xad,0x02,0x00,0x80,0x20,
+0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0xbd,0x02,0x40,0x00,0x03,
+0x02,0x80,0x40,0x01,0x02,0x00,0xc0,0xac,0x02,0x00,0x80,0x20,0x01,0x00,0x41,0x20,
+0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,0x02,0x00,0x40,0x01,0x02,0x80,0x40,0x01,
+0x02,0x01,0x00,0xae,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x83,
+0x02,0x40,0x63,0x83,0x01,0x80,0x00,0xa0,0x02,0x00,0x40,0x01,0x02,0x80,0x40,0x01,
+0x02,0x01,0x40,0xb0,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x83,
+0x02,0x40,0x63,0x83,0x01,0x80,0x00,0xa0,0x01,0x81,0x80,0x20,0x02,0x00,0x40,0x01,
+0x02,0x80,0x40,0x01,0x02,0x81,0x80,0x20,0x02,0x01,0x40,0xb0,0x01,0x00,0x41,0x20,
+0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x83,0x02,0x40,0x31,0x83,0x01,0x80,0x00,0xa0,
+0x02,0x00,0x01,0x02,0x01,0x80,0xc0,0xac,0x02,0x00,0x40,0x01,0x02,0x80,0x01,0x02,
+0x02,0x00,0xc0,0xac,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x03,
+0x00,0x00,0x1f,0x31,0x32,0x36,0x37,0x36,0x35,0x30,0x36,0x30,0x30,0x32,0x32,0x38,
+0x32,0x32,0x39,0x34,0x30,0x31,0x34,0x39,0x36,0x37,0x30,0x33,0x32,0x30,0x35,0x33,
+0x37,0x36,0x00,0x00,0x1f,0x31,0x32,0x36,0x37,0x36,0x35,0x30,0x36,0x30,0x30,0x32,
+0x32,0x38,0x32,0x32,0x39,0x34,0x30,0x31,0x34,0x39,0x36,0x37,0x30,0x33,0x32,0x30,
+0x35,0x33,0x37,0x37,0x02,0x00,0x16,0x35,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x31,0x00,0x00,0x00,
+0x07,0x00,0x02,0x2a,0x2a,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x01,0x2b,0x00,
+0x00,0x01,0x2d,0x00,0x00,0x01,0x2a,0x00,0x00,0x02,0x2d,0x40,0x00,0x00,0x00,0x00,
+0xca,0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x25,0x01,0xc0,0x01,0x03,0x02,
+0x47,0xcf,0x83,0x01,0x80,0x00,0xa0,0x00,0x80,0xc0,0x01,0x01,0xc0,0x03,0x03,0x02,
+0x45,0xdb,0x83,0x01,0x80,0x00,0xa0,0x01,0x80,0x40,0xad,0x01,0x00,0xc0,0x01,0x01,
+0x80,0x00,0x06,0x02,0x00,0x40,0x01,0x02,0x80,0x80,0x01,0x02,0x00,0xc0,0xb0,0x02,
+0x80,0x80,0x01,0x03,0x00,0x40,0x01,0x02,0x80,0xc0,0xb0,0x01,0x80,0x81,0x20,0x01,
+0x80,0x00,0x06,0x02,0x00,0x40,0x01,0x02,0x80,0x80,0x01,0x02,0x80,0x40,0xad,0x02,
+0x00,0xc0,0xb0,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x02,0x80,0xc0,0xb0,0x03,
+0x00,0x40,0x01,0x02,0x80,0x40,0xac,0x01,0x80,0x81,0x20,0x01,0x80,0x00,0x06,0x02,
+0x3f,0xff,0x83,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x02,0x80,0xc0,0xb0,0x03,
+0x00,0x40,0x01,0x02,0x81,0x00,0xa0,0x01,0x80,0x81,0x20,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x02,0x2a,0x2a,0x00,0x00,0x01,0x2b,0x00,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,
+0x01,0x2a,0x00,0x00,0x01,0x25,0x00,0x00,0x00,0x01,0xfe,0x00,0x05,0x00,0x0b,0x00,
+0x00,0x00,0x00,0x00,0x6c,0x02,0xc0,0x00,0x83,0x03,0x40,0x31,0x83,0x02,0x80,0x00,
+0xa0,0x02,0x80,0x42,0xad,0x00,0x81,0x40,0x01,0x02,0x80,0x00,0x06,0x03,0x40,0x00,
+0x83,0x03,0xc0,0x2c,0x83,0x03,0x00,0x00,0xa0,0x03,0x80,0x40,0x01,0x04,0x40,0x00,
+0x83,0x04,0xc0,0x04,0x83,0x04,0x00,0x00,0xa0,0x03,0x80,0xc0,0xa0,0x02,0x80,0x81,
+0x20,0x02,0x80,0x00,0x06,0x03,0x40,0x02,0x03,0x03,0x80,0x40,0x01,0x04,0x40,0x00,
+0x83,0x04,0xc0,0x04,0x83,0x04,0x00,0x00,0xa0,0x03,0x81,0x00,0xa0,0x02,0x80,0x81,
+0x20,0x02,0x80,0x00,0x06,0x03,0x40,0x00,0x83,0x03,0xc0,0x2c,0x83,0x03,0x00,0x00,
+0xa0,0x03,0xc0,0x02,0x03,0x03,0x01,0x81,0x37,0x03,0x80,0x40,0x01,0x04,0x40,0x00,
+0x83,0x04,0xc0,0x04,0x83,0x04,0x00,0x00,0xa0,0x03,0x81,0x40,0xa0,0x02,0x80,0x81,
+0x20,0x02,0x80,0x00,0x06,0x03,0x40,0x00,0x83,0x03,0xc0,0x2c,0x83,0x03,0x00,0x00,
+0xa0,0x03,0x01,0x80,0x20,0x03,0x01,0xc0,0xaf,0x03,0xc0,0x00,0x83,0x04,0x40,0x04,
+0x83,0x03,0x80,0x00,0xa0,0x03,0x81,0xc2,0xaf,0x03,0x01,0x81,0x37,0x03,0x80,0x40,
+0x01,0x03,0x81,0x80,0x20,0x04,0x40,0x00,0x83,0x04,0xc0,0x04,0x83,0x04,0x00,0x00,
+0xa0,0x03,0x81,0x40,0xa0,0x02,0x80,0x81,0x20,0x02,0x80,0x00,0x06,0x03,0x40,0x00,
+0x83,0x03,0xc0,0x2c,0x83,0x03,0x00,0x00,0xa0,0x03,0x01,0x80,0x20,0x03,0x01,0xc0,
+0xaf,0x03,0xc0,0x02,0x03,0x04,0x40,0x00,0x83,0x04,0xc0,0x04,0x83,0x04,0x00,0x00,
+0xa0,0x03,0x81,0xc0,0xae,0x03,0x01,0x81,0x37,0x03,0x80,0x40,0x01,0x04,0x40,0x00,
+0x83,0x04,0xc0,0x04,0x83,0x04,0x00,0x00,0xa0,0x04,0x01,0x80,0x20,0x03,0x81,0x40,
+0xa0,0x02,0x80,0x81,0x20,0x02,0x80,0x00,0x06,0x03,0x3f,0xff,0x83,0x03,0xc0,0x03,
+0x03,0x04,0x40,0x00,0x83,0x04,0xc0,0x31,0x83,0x04,0x00,0x00,0xa0,0x03,0x80,0xc0,
+0xa0,0x02,0x80,0x81,0x20,0x02,0x80,0x00,0x06,0x03,0x3f,0xff,0x03,0x03,0xbf,0xfc,
+0x03,0x04,0x40,0x00,0x83,0x04,0xc0,0x31,0x83,0x04,0x00,0x00,0xa0,0x03,0x80,0xc0,
+0xa0,0x02,0x80,0x81,0x20,0x02,0xc0,0x01,0x03,0x03,0x40,0xf9,0x83,0x02,0x80,0x00,
+0xa0,0x01,0x01,0x40,0x01,0x03,0x00,0x80,0x01,0x02,0x82,0x00,0xb0,0x02,0x80,0x48,
+0xad,0x03,0x00,0x80,0x01,0x02,0x81,0x40,0xa0,0x01,0x81,0x40,0x3a,0x02,0x01,0x40,
+0xba,0x02,0x80,0x00,0x06,0x03,0x00,0x80,0x01,0x03,0x80,0xc0,0x01,0x02,0x80,0x81,
+0x20,0x02,0x80,0x00,0x06,0x03,0x40,0x08,0x03,0x03,0x81,0x00,0x01,0x02,0x80,0x81,
+0x20,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x02,0x2a,
+0x2a,0x00,0x00,0x01,0x2b,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x03,0x64,0x69,0x76,0x00,0x00,0x01,0x25,0x00,0x00,
+0x06,0x64,0x69,0x76,0x6d,0x6f,0x64,0x00,0x00,0x02,0x2d,0x40,0x00,0x00,0x01,0x2d,
+0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x01,0xa5,0x00,0x01,0x00,0x08,0x00,0x00,0x00,
+0x00,0x00,0x48,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,
+0x40,0x18,0x83,0x01,0x80,0x80,0xb0,0x01,0x00,0x40,0xac,0x01,0xc0,0x04,0x83,0x02,
+0x40,0x18,0x83,0x01,0x80,0xc0,0xa0,0x01,0x81,0x00,0x20,0x00,0x80,0x01,0x20,0x00,
+0x80,0x00,0x06,0x01,0x40,0x00,0x83,0x01,0xc0,0x3f,0x83,0x01,0x00,0xc0,0xa0,0x01,
+0xc0,0x00,0x83,0x02,0x40,0x1f,0x83,0x01,0x80,0xc0,0xa0,0x02,0x40,0x00,0x83,0x01,
+0x80,0xc0,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x83,0x01,
+0xc0,0x31,0x03,0x01,0x00,0xc0,0xa0,0x01,0x01,0x40,0x20,0x01,0xbf,0xfe,0x83,0x02,
+0x40,0x31,0x03,0x01,0x80,0xc0,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,
+0x00,0x01,0x02,0x01,0xc0,0x01,0x03,0x02,0x41,0xf3,0x83,0x02,0x80,0x01,0x82,0x01,
+0x81,0x81,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x02,0x3d,0x01,
+0xc0,0x00,0x83,0x02,0x40,0x63,0x83,0x01,0x80,0xc0,0xa0,0x02,0x40,0x01,0x03,0x02,
+0xc0,0x18,0x83,0x02,0x00,0xc0,0xa0,0x02,0xc0,0x04,0x83,0x03,0x40,0x0e,0x83,0x02,
+0x80,0xc0,0xa0,0x01,0x81,0x81,0x20,0x01,0x81,0x00,0x20,0x00,0x80,0x01,0x20,0x00,
+0x80,0x00,0x06,0x01,0x40,0x03,0x03,0x01,0xbf,0xfc,0x03,0x02,0x40,0x01,0x03,0x02,
+0xc0,0x04,0x83,0x01,0x81,0x81,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,
+0x3f,0xfc,0x03,0x01,0xc0,0x03,0x03,0x02,0x40,0x01,0x03,0x02,0xbf,0xfa,0x83,0x01,
+0x81,0x81,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x41,0xff,0x83,0x01,
+0xc0,0x00,0x83,0x02,0x40,0x04,0x83,0x01,0x80,0xc0,0xa0,0x00,0x80,0x01,0x20,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x05,0x00,0x00,0x01,0x31,0x00,0x00,0x01,0x30,0x01,
+0x00,0x08,0x35,0x36,0x38,0x38,0x38,0x31,0x39,0x33,0x01,0x00,0x0a,0x31,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x37,0x00,0x00,0x1e,0x31,0x37,0x30,0x35,0x33,0x33,
+0x36,0x35,0x37,0x36,0x35,0x38,0x37,0x34,0x36,0x35,0x30,0x33,0x39,0x37,0x33,0x34,
+0x39,0x30,0x39,0x31,0x37,0x33,0x37,0x36,0x00,0x00,0x00,0x07,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x01,0x2b,0x00,0x00,
+0x01,0x2a,0x00,0x00,0x02,0x2a,0x2a,0x00,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,
+0x02,0x2d,0x40,0x00,0x00,0x03,0x70,0x6f,0x77,0x00,0x00,0x00,0x01,0xab,0x00,0x03,
+0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x3e,0x01,0xc0,0x00,0x83,0x02,0x40,0x31,0x83,
+0x01,0x80,0x00,0xa0,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x3d,
+0x02,0x80,0x40,0x01,0x03,0x40,0x07,0x83,0x02,0x80,0x80,0xa0,0x01,0x80,0x41,0x20,
+0x01,0x80,0x00,0x06,0x02,0x00,0x00,0xbd,0x02,0x80,0x01,0x3d,0x03,0x40,0x31,0x83,
+0x02,0x81,0x00,0xb0,0x02,0x00,0xc0,0xac,0x02,0x80,0x40,0x01,0x03,0x40,0x00,0x83,
+0x02,0x80,0x80,0xa0,0x01,0x80,0x41,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x01,0xbd,
+0x02,0x80,0x40,0x01,0x02,0x81,0x40,0x20,0x03,0x40,0x07,0x83,0x02,0x80,0x80,0xa0,
+0x01,0x80,0x41,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x3d,0x02,0xc0,0x01,0x03,
+0x03,0x40,0x2c,0x83,0x02,0x80,0x00,0xa0,0x03,0x40,0x11,0x83,0x02,0x80,0x80,0xa0,
+0x01,0x80,0x41,0x20,0x01,0xc0,0x01,0x03,0x02,0x67,0x0f,0x83,0x01,0x80,0x00,0xa0,
+0x01,0x80,0x80,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x52,0xa3,0x03,
+0x02,0x80,0x80,0x01,0x02,0x81,0x80,0x20,0x01,0x80,0x41,0x20,0x01,0x80,0x00,0x06,
+0x02,0x00,0x02,0xbd,0x02,0x80,0x80,0x01,0x03,0x3f,0xfd,0x83,0x03,0xc0,0x01,0x83,
+0x02,0x81,0xc1,0x20,0x01,0x80,0x41,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x3d,
+0x02,0xc0,0x04,0x83,0x03,0x41,0xf3,0x83,0x02,0x80,0x00,0xa0,0x02,0x80,0x80,0x20,
+0x03,0x3f,0xff,0x03,0x02,0x81,0xc0,0xa0,0x01,0x80,0x41,0x20,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x06,0x00,0x00,0x1a,0x31,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x00,0x00,0x01,0x31,0x00,0x00,0x01,0x30,0x00,0x00,0x1b,0x2d,0x31,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x00,0x00,0x1c,0x38,0x62,0x79,0x36,0x63,0x37,
+0x76,0x66,0x36,0x71,0x32,0x39,0x6d,0x61,0x6d,0x64,0x67,0x65,0x69,0x68,0x6f,0x35,
+0x31,0x32,0x61,0x39,0x6b,0x39,0x00,0x00,0x04,0x30,0x30,0x30,0x31,0x00,0x00,0x00,
+0x08,0x00,0x02,0x2a,0x2a,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x01,0x2b,0x00,
+0x00,0x01,0x2a,0x00,0x00,0x02,0x2d,0x40,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,
+0x00,0x02,0x5b,0x5d,0x00,0x00,0x00,0x01,0xe6,0x00,0x02,0x00,0x07,0x00,0x00,0x00,
+0x00,0x00,0x60,0x01,0x40,0x00,0x83,0x01,0xc0,0x31,0x83,0x01,0x00,0x00,0xa0,0x01,
+0x80,0x00,0x02,0x01,0x00,0x40,0xac,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,
+0x80,0x00,0x02,0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x02,0x02,0x00,0xc0,0xa0,0x01,
+0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x40,0x01,0x02,
+0x01,0x00,0x20,0x02,0x80,0x00,0x02,0x02,0x00,0xc0,0xa0,0x01,0x00,0x81,0x20,0x01,
+0x00,0x00,0x06,0x01,0xbf,0xff,0x03,0x02,0x00,0x40,0x01,0x02,0xbf,0xff,0x03,0x02,
+0x01,0x40,0xa0,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,0x02,
+0x00,0x40,0x01,0x02,0x80,0x40,0x01,0x02,0x01,0x80,0xa0,0x01,0x00,0x81,0x20,0x01,
+0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x01,0x81,0x00,0x20,0x01,0x81,0xc0,0xaf,0x02,
+0x00,0x40,0x01,0x02,0x02,0x00,0x20,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,
+0xc0,0x00,0x83,0x02,0x40,0x31,0x83,0x01,0x80,0x00,0xa0,0x02,0x40,0x00,0x03,0x02,
+0xc0,0x31,0x83,0x02,0x02,0x40,0xa0,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,
+0xc0,0x00,0x83,0x02,0x40,0x31,0x83,0x01,0x80,0x00,0xa0,0x01,0x81,0x00,0x20,0x02,
+0x3f,0xff,0x03,0x02,0xc0,0x31,0x83,0x02,0x02,0x40,0xa0,0x01,0x00,0x81,0x20,0x01,
+0x00,0x00,0x06,0x01,0xc0,0x00,0x83,0x02,0x40,0x13,0x83,0x01,0x80,0x00,0xa0,0x02,
+0x40,0x00,0x83,0x02,0xc0,0x31,0x83,0x02,0x00,0x00,0xa0,0x02,0xc0,0x1d,0x83,0x02,
+0x02,0x80,0xa0,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x03,0x02,
+0x40,0x00,0x83,0x02,0xc0,0x31,0x83,0x02,0x00,0x00,0xa0,0x02,0x01,0x00,0x20,0x02,
+0xc0,0x63,0x83,0x02,0x02,0x80,0xa0,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,
+0xc0,0x00,0x83,0x02,0x40,0x13,0x83,0x01,0x80,0x00,0xa0,0x01,0x81,0x00,0x20,0x01,
+0x81,0xc0,0xaf,0x02,0x40,0x00,0x83,0x02,0xc0,0x31,0x83,0x02,0x00,0x00,0xa0,0x02,
+0x00,0x40,0xad,0x02,0x01,0x00,0x20,0x02,0xc0,0x1d,0x83,0x02,0x02,0x80,0xa0,0x01,
+0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x32,0x03,0x02,0x40,0x00,0x83,0x02,
+0xc0,0x31,0x83,0x02,0x00,0x00,0xa0,0x02,0x02,0xc0,0x20,0x01,0x00,0x81,0x20,0x01,
+0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x01,0x00,0x05,0x36,0x35,0x35,0x33,0x35,0x00,
+0x00,0x00,0x0c,0x00,0x02,0x2a,0x2a,0x00,0x00,0x01,0x2b,0x00,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x01,0x26,0x00,0x00,
+0x02,0x2d,0x40,0x00,0x00,0x01,0x7c,0x00,0x00,0x01,0x5e,0x00,0x00,0x01,0x2d,0x00,
+0x00,0x01,0x7e,0x00,0x00,0x02,0x3c,0x3c,0x00,0x00,0x02,0x3e,0x3e,0x00,0x00,0x0a,
+0x62,0x69,0x74,0x5f,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x00,0x01,0x88,0x00,
+0x02,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0x40,0x00,0x83,0x01,0xc0,0x1f,
+0x83,0x01,0x00,0x00,0xa0,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,0x80,0x40,
+0x01,0x02,0x40,0x00,0x83,0x02,0xc0,0x1f,0x83,0x02,0x00,0x00,0xa0,0x01,0x80,0x80,
+0xb2,0x01,0x00,0x40,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,0x40,0x00,
+0x83,0x02,0xc0,0x1f,0x83,0x02,0x00,0x00,0xa0,0x01,0x80,0xc0,0xa0,0x01,0x00,0x40,
+0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x02,0xc0,0x1f,
+0x83,0x02,0x00,0x00,0xa0,0x02,0x01,0x40,0xad,0x01,0x80,0x80,0xb2,0x01,0x01,0x00,
+0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,0x01,0x81,0x80,
+0xb5,0x01,0x00,0x40,0xa0,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x40,
+0x01,0x01,0x81,0xc0,0xb3,0x01,0x00,0x40,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x40,
+0x01,0x01,0x82,0x00,0x20,0x02,0x40,0x00,0x03,0x01,0x81,0xc0,0xb3,0x01,0x00,0x40,
+0xa0,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x40,0x01,0x02,0x80,0x00,
+0x02,0x02,0x02,0x80,0xa0,0x01,0x02,0x41,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x00,
+0x02,0x02,0x00,0x40,0x01,0x01,0x81,0xc0,0xb3,0x01,0x00,0x40,0xa0,0x01,0x00,0x00,
+0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x1f,0x83,0x02,0x00,0x00,
+0xa0,0x02,0xc0,0x00,0x03,0x02,0x01,0x00,0xbf,0x02,0x80,0x40,0x01,0x02,0x02,0xc0,
+0xa0,0x01,0x02,0x41,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,
+0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x0c,0x00,0x02,0x2a,0x2a,0x00,0x00,
+0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x04,0x65,0x71,0x6c,0x3f,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,0x00,0x01,0x2b,0x00,0x00,0x01,0x3e,0x00,
+0x00,0x01,0x3c,0x00,0x00,0x02,0x2d,0x40,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x03,0x3c,0x3d,0x3e,0x00,0x00,0x02,
+0x5b,0x5d,0x00,0x00,0x00,0x00,0xfc,0x00,0x01,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
+0x22,0x00,0x80,0x00,0x06,0x01,0x40,0x01,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x20,
+0x83,0x01,0x80,0x80,0xa0,0x01,0x00,0x40,0xb0,0x01,0x80,0x00,0x02,0x02,0x00,0x00,
+0x82,0x02,0xc0,0x20,0x83,0x02,0x00,0x80,0xa0,0x01,0x80,0x40,0xb0,0x01,0x80,0xc0,
+0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x83,0x01,0xc0,0x22,
+0x83,0x01,0x00,0x80,0xa0,0x01,0x01,0x00,0x20,0x01,0x80,0x00,0x82,0x02,0x40,0x22,
+0x83,0x01,0x80,0x80,0xa0,0x01,0x81,0x00,0x20,0x01,0x80,0xc0,0x20,0x00,0x80,0x01,
+0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x83,0x01,0xc0,0x27,0x83,0x01,0x00,0x80,
+0xa0,0x01,0x80,0x00,0x82,0x02,0x40,0x27,0x83,0x01,0x80,0x80,0xa0,0x01,0x81,0x40,
+0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x02,0x00,0x16,
+0x33,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x65,0x2b,0x30,0x30,0x02,0x00,0x16,0x32,0x2e,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,
+0x00,0x00,0x06,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x01,0x2a,0x00,0x00,0x02,0x2a,0x2a,0x00,0x00,0x04,0x74,0x6f,0x5f,
+0x69,0x00,0x00,0x02,0x2d,0x40,0x00,0x00,0x05,0x66,0x6c,0x6f,0x6f,0x72,0x00,0x00,
+0x00,0x00,0x84,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x80,0x00,
+0x06,0x01,0x40,0x00,0x03,0x01,0x00,0x80,0xb7,0x01,0x80,0x00,0x91,0x02,0x40,0x00,
+0x03,0x02,0x01,0x00,0xb7,0x01,0x80,0x80,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,
+0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x00,0x3d,0x01,0x00,0x80,0xa0,0x00,0x80,0xc0,
+0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x31,0x00,0x00,0x00,
+0x04,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,
+0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x0b,0x74,0x72,0x79,0x5f,0x63,0x6f,
+0x6e,0x76,0x65,0x72,0x74,0x00,0x00,0x0a,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x6e,
+0x69,0x6c,0x00,0x00,0x00,0x00,0xf0,0x00,0x05,0x00,0x0a,0x00,0x00,0x00,0x00,0x00,
+0x1f,0x02,0x80,0x00,0x3d,0x03,0x00,0x00,0xbd,0x03,0x80,0x01,0x3d,0x04,0x00,0x01,
+0xbd,0x00,0x81,0x42,0x37,0x02,0x80,0x02,0x3d,0x03,0x00,0x02,0xbd,0x03,0x80,0x03,
+0x3d,0x04,0x00,0x03,0xbd,0x01,0x01,0x42,0x37,0x01,0x80,0x04,0x3d,0x02,0x80,0x40,
+0x01,0x03,0x00,0x80,0x01,0x03,0x80,0xc0,0x01,0x02,0x01,0x41,0xb7,0x02,0x80,0x00,
+0x06,0x03,0x00,0x02,0x3d,0x03,0x80,0x02,0xbd,0x04,0x00,0x03,0x3d,0x04,0x80,0x03,
+0xbd,0x03,0x01,0x82,0x37,0x03,0x81,0x00,0x01,0x04,0x00,0x02,0x3d,0x03,0x80,0x40,
+0xa0,0x02,0x80,0x01,0x20,0x02,0x80,0x00,0x06,0x03,0x01,0x00,0x01,0x03,0x80,0x04,
+0x3d,0x03,0x00,0x40,0xa0,0x02,0x80,0x80,0xa0,0x02,0x80,0x00,0x29,0x00,0x00,0x00,
+0x09,0x00,0x00,0x06,0x63,0x6f,0x6c,0x6f,0x72,0x73,0x00,0x00,0x03,0x72,0x65,0x64,
+0x00,0x00,0x04,0x62,0x6c,0x75,0x65,0x00,0x00,0x05,0x67,0x72,0x65,0x65,0x6e,0x00,
+0x00,0x07,0x6c,0x65,0x74,0x74,0x65,0x72,0x73,0x00,0x00,0x01,0x61,0x00,0x00,0x01,
+0x62,0x00,0x00,0x01,0x63,0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x00,0x03,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x05,
+0x61,0x73,0x73,0x6f,0x63,0x00,0x00,0x0a,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x6e,
+0x69,0x6c,0x00,0x00,0x00,0x00,0x8a,0x00,0x02,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
+0x13,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x02,0x80,0x01,
+0xbd,0x03,0x00,0x02,0x3d,0x00,0x80,0x82,0xb7,0x01,0x00,0x00,0x06,0x01,0x80,0x00,
+0x3d,0x02,0x00,0x40,0x01,0x02,0xbf,0xff,0x83,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,
+0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x02,0x3d,0x02,0x00,0x40,0x01,0x02,0xbf,0xff,
+0x03,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x05,0x00,0x00,0x01,0x61,0x00,0x00,0x01,0x62,0x00,0x00,0x01,0x63,0x00,0x00,0x01,
+0x64,0x00,0x00,0x01,0x65,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x02,0x61,0x74,0x00,0x00,0x00,0x00,
+0xc7,0x00,0x02,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x1b,0x01,0x40,0x00,0x03,0x01,
+0x80,0x00,0x3d,0x01,0x00,0x81,0x37,0x01,0xc0,0x00,0x83,0x02,0x00,0x00,0xbd,0x01,
+0x80,0xc1,0x37,0x02,0x40,0x01,0x03,0x02,0x80,0x01,0x3d,0x02,0x01,0x01,0x37,0x02,
+0x80,0x01,0xbd,0x03,0x00,0x00,0xbd,0x02,0x81,0x41,0x37,0x00,0x80,0x82,0x37,0x01,
+0x00,0x00,0x06,0x01,0xc0,0x00,0x83,0x02,0x00,0x00,0xbd,0x01,0x80,0xc1,0x37,0x02,
+0x00,0x40,0x01,0x02,0x80,0x00,0xbd,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,0x01,
+0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,0x00,0x02,0x3d,0x01,0x80,0x40,0xa0,0x01,
+0x00,0x80,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x05,0x00,0x00,0x03,0x6f,0x6e,
+0x65,0x00,0x00,0x03,0x74,0x77,0x6f,0x00,0x00,0x05,0x74,0x68,0x72,0x65,0x65,0x00,
+0x00,0x02,0x69,0x69,0x00,0x00,0x04,0x66,0x6f,0x75,0x72,0x00,0x00,0x00,0x03,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x06,
+0x72,0x61,0x73,0x73,0x6f,0x63,0x00,0x00,0x0a,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x6e,0x69,0x6c,0x00,0x00,0x00,0x01,0x54,0x00,0x05,0x00,0x09,0x00,0x02,0x00,0x00,
+0x00,0x39,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x04,0x40,
+0x00,0x03,0x00,0x81,0x42,0x37,0x02,0x80,0x40,0x01,0x02,0x80,0x00,0x20,0x02,0x80,
+0x00,0x06,0x03,0x40,0x00,0x03,0x03,0xc0,0x00,0x83,0x04,0x40,0x01,0x03,0x03,0x01,
+0x81,0xb7,0x03,0x80,0x40,0x01,0x02,0x80,0x41,0x20,0x02,0x80,0x00,0x3d,0x03,0x00,
+0x00,0xbd,0x03,0x80,0x01,0x3d,0x01,0x01,0x41,0xb7,0x02,0x80,0x00,0x06,0x03,0x00,
+0x80,0x01,0x03,0x00,0x00,0x20,0x02,0x80,0x80,0xa0,0x02,0x80,0x01,0xbd,0x03,0x00,
+0x02,0x3d,0x02,0x81,0x41,0x37,0x03,0x00,0x01,0xbd,0x03,0x80,0x02,0xbd,0x03,0x01,
+0x81,0x37,0x03,0x80,0x03,0x3d,0x04,0x00,0x03,0xbd,0x03,0x81,0xc1,0x37,0x01,0x81,
+0x41,0xb7,0x02,0x80,0x00,0x06,0x03,0x00,0x01,0xbd,0x03,0x80,0x02,0x3d,0x03,0x01,
+0x81,0x37,0x03,0x80,0x03,0x3d,0x04,0x00,0x03,0xbd,0x03,0x81,0xc1,0x37,0x03,0x01,
+0x81,0x37,0x03,0x80,0xc0,0x01,0x04,0x00,0x01,0x40,0x03,0x80,0x00,0x21,0x02,0x80,
+0x41,0x20,0x02,0x80,0x01,0xbd,0x03,0x00,0x02,0x3d,0x02,0x81,0x41,0x37,0x03,0x00,
+0x03,0x3d,0x03,0x80,0x03,0xbd,0x03,0x01,0x81,0x37,0x02,0x01,0x41,0x37,0x02,0x80,
+0x00,0x06,0x03,0x01,0x00,0x01,0x03,0x80,0x03,0x40,0x03,0x00,0x00,0x21,0x02,0x80,
+0x80,0xa0,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x08,0x00,0x00,0x01,0x61,0x00,0x00,
+0x01,0x62,0x00,0x00,0x01,0x63,0x00,0x00,0x07,0x73,0x74,0x75,0x64,0x65,0x6e,0x74,
+0x00,0x00,0x03,0x73,0x61,0x6d,0x00,0x00,0x06,0x67,0x65,0x6f,0x72,0x67,0x65,0x00,
+0x00,0x07,0x74,0x65,0x61,0x63,0x68,0x65,0x72,0x00,0x00,0x04,0x6d,0x61,0x74,0x7a,
+0x00,0x00,0x00,0x03,0x00,0x05,0x75,0x6e,0x69,0x71,0x21,0x00,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x0a,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x6e,0x69,0x6c,0x00,0x00,0x00,0x00,0x2e,0x00,0x03,0x00,0x05,
+0x00,0x00,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,
+0x00,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,
+0x66,0x69,0x72,0x73,0x74,0x00,0x00,0x00,0x00,0x2e,0x00,0x03,0x00,0x05,0x00,0x00,
+0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x66,0x69,
+0x72,0x73,0x74,0x00,0x00,0x00,0x01,0x06,0x00,0x03,0x00,0x08,0x00,0x01,0x00,0x00,
+0x00,0x2c,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,
+0x00,0x03,0x00,0x80,0xc2,0x37,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,
+0x00,0x83,0x03,0x40,0x01,0x03,0x02,0x01,0x01,0xb7,0x02,0x80,0x40,0x01,0x02,0x80,
+0x40,0x20,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,
+0x00,0x83,0x03,0x40,0x01,0x03,0x03,0xc0,0x00,0x03,0x02,0x01,0x02,0x37,0x02,0x80,
+0x40,0x01,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x01,0x80,
+0xc1,0x37,0x02,0x00,0x00,0x3d,0x02,0x80,0x01,0x3d,0x02,0x01,0x01,0x37,0x02,0x80,
+0x01,0xbd,0x03,0x00,0x02,0x3d,0x02,0x81,0x41,0x37,0x01,0x00,0xc1,0xb7,0x01,0x80,
+0x00,0x06,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,0xbd,0x02,0x01,0x01,0x37,0x02,0x80,
+0x01,0xbd,0x03,0x00,0x02,0x3d,0x02,0x81,0x41,0x37,0x02,0x01,0x01,0x37,0x02,0x80,
+0x80,0x01,0x03,0x00,0x01,0x40,0x02,0x80,0x40,0x21,0x01,0x80,0x01,0x20,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x05,0x00,0x00,0x07,0x73,0x74,0x75,0x64,0x65,0x6e,0x74,
+0x00,0x00,0x03,0x73,0x61,0x6d,0x00,0x00,0x06,0x67,0x65,0x6f,0x72,0x67,0x65,0x00,
+0x00,0x07,0x74,0x65,0x61,0x63,0x68,0x65,0x72,0x00,0x00,0x04,0x6d,0x61,0x74,0x7a,
+0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,
+0x61,0x6c,0x00,0x00,0x04,0x75,0x6e,0x69,0x71,0x00,0x00,0x00,0x00,0x2e,0x00,0x03,
+0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,
+0x01,0x80,0x00,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x05,0x66,0x69,0x72,0x73,0x74,0x00,0x00,0x00,0x00,0xb8,0x00,0x04,0x00,0x09,
+0x00,0x01,0x00,0x00,0x00,0x1d,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,
+0x01,0x03,0x03,0xc0,0x00,0x03,0x00,0x81,0x02,0x37,0x02,0x40,0x00,0x03,0x01,0x01,
+0x00,0xb7,0x01,0xc0,0x00,0x03,0x02,0x00,0x00,0x06,0x02,0x80,0x00,0x91,0x03,0x00,
+0x01,0x40,0x02,0x00,0x00,0xa1,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x83,0x03,0x40,
+0x01,0x03,0x02,0x81,0x41,0x37,0x03,0x00,0x40,0x01,0x03,0x80,0x80,0x01,0x03,0x00,
+0xc0,0xae,0x02,0x00,0x81,0x20,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x03,0x03,0x40,
+0x00,0x83,0x03,0xc0,0x01,0x03,0x04,0x40,0x00,0x03,0x02,0x81,0x42,0x37,0x03,0x00,
+0x40,0x01,0x02,0x00,0x81,0x20,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,
+0x00,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x01,0x2d,0x00,
+0x00,0x00,0x00,0x2a,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x80,
+0x40,0x15,0x01,0x00,0xc0,0x15,0x00,0x80,0x00,0xae,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2d,0x00,0x00,0x00,0x00,0xc4,0x00,0x04,
+0x00,0x09,0x00,0x01,0x00,0x00,0x00,0x20,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,
+0x03,0x40,0x01,0x03,0x03,0xc0,0x00,0x03,0x00,0x81,0x02,0x37,0x02,0x40,0x00,0x03,
+0x02,0xc0,0x01,0x83,0x01,0x01,0x01,0x37,0x01,0xc0,0x00,0x03,0x02,0x00,0x00,0x06,
+0x02,0x80,0x00,0x91,0x03,0x00,0x01,0x40,0x02,0x00,0x00,0xa1,0x02,0x00,0x00,0x06,
+0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x04,0x40,0x01,0x83,
+0x02,0x81,0x42,0x37,0x03,0x00,0x40,0x01,0x03,0x80,0x80,0x01,0x03,0x00,0xc0,0xa0,
+0x02,0x00,0x81,0x20,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,
+0x03,0xc0,0x01,0x03,0x04,0x40,0x00,0x03,0x02,0x81,0x42,0x37,0x03,0x00,0x40,0x01,
+0x02,0x00,0x81,0x20,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,
+0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0c,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x01,0x7c,0x00,0x00,0x00,
+0x00,0x2a,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x80,0x40,0x15,
+0x01,0x00,0xc0,0x15,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x01,0x7c,0x00,0x00,0x00,0x00,0xb8,0x00,0x04,0x00,0x09,
+0x00,0x01,0x00,0x00,0x00,0x1d,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,
+0x01,0x03,0x03,0xc0,0x00,0x03,0x00,0x81,0x02,0x37,0x02,0x40,0x00,0x03,0x02,0xc0,
+0x01,0x83,0x01,0x01,0x01,0x37,0x01,0xc0,0x00,0x03,0x02,0x00,0x00,0x06,0x02,0x80,
+0x00,0x91,0x03,0x00,0x01,0x40,0x02,0x00,0x00,0xa1,0x02,0x00,0x00,0x06,0x02,0xc0,
+0x00,0x03,0x02,0x81,0x40,0xb7,0x03,0x00,0x40,0x01,0x03,0x80,0x80,0x01,0x03,0x00,
+0xc0,0xa0,0x02,0x00,0x81,0x20,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x03,0x03,0x40,
+0x00,0x83,0x03,0xc0,0x01,0x03,0x04,0x40,0x00,0x03,0x02,0x81,0x42,0x37,0x03,0x00,
+0x40,0x01,0x02,0x00,0x81,0x20,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,
+0x00,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x01,0x26,0x00,
+0x00,0x00,0x00,0x2a,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x80,
+0x40,0x15,0x01,0x00,0xc0,0x15,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x26,0x00,0x00,0x00,0x03,0x7f,0x00,0x01,
+0x00,0x09,0x00,0x00,0x00,0x00,0x00,0xd2,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,
+0x01,0xc0,0x00,0x83,0x02,0x00,0x00,0x3d,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,
+0x02,0x81,0x40,0xbf,0x03,0x00,0x00,0x84,0x01,0x00,0x82,0xb7,0x01,0xc0,0x00,0x03,
+0x02,0x40,0x00,0x83,0x02,0x80,0x00,0x3d,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,
+0x03,0x01,0x80,0xbf,0x03,0x80,0x00,0x84,0x01,0x80,0xc2,0xb7,0x01,0x80,0x80,0x20,
+0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,
+0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x03,0xc0,0x02,0x83,
+0x01,0x00,0x83,0x37,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,
+0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x02,0x81,0x41,0xb7,0x03,0x40,0x02,0x83,
+0x01,0x80,0xc2,0x37,0x01,0x80,0x80,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,
+0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,
+0x03,0x40,0x02,0x03,0x03,0xc0,0x02,0x83,0x01,0x00,0x83,0x37,0x01,0xc0,0x00,0x03,
+0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,
+0x03,0x01,0x81,0x37,0x03,0xc0,0x02,0x83,0x02,0x81,0x41,0xb7,0x01,0x80,0xc1,0xb7,
+0x01,0x80,0x80,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,
+0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,
+0x03,0xc0,0x02,0x83,0x03,0x81,0xc0,0xb7,0x03,0x01,0x81,0x37,0x02,0x81,0x41,0x37,
+0x02,0x01,0x01,0x37,0x01,0x80,0xc1,0x37,0x01,0x00,0x81,0x37,0x01,0xc0,0x00,0x03,
+0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,
+0x04,0x40,0x02,0x83,0x04,0x02,0x00,0xb7,0x03,0x81,0xc1,0x37,0x03,0x01,0x81,0x37,
+0x02,0x81,0x41,0x37,0x02,0x01,0x01,0x37,0x01,0x80,0xc1,0x37,0x02,0x3f,0xff,0x83,
+0x01,0x80,0x80,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,
+0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,
+0x03,0xc0,0x02,0x83,0x03,0x81,0xc0,0xb7,0x03,0x01,0x81,0x37,0x02,0x81,0x41,0x37,
+0x02,0x01,0x01,0x37,0x01,0x00,0x81,0xb7,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,
+0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x04,0x40,0x02,0x83,
+0x04,0x02,0x00,0xb7,0x03,0x81,0xc1,0x37,0x03,0x01,0x81,0x37,0x02,0x81,0x41,0x37,
+0x02,0x01,0x01,0x37,0x01,0x80,0xc1,0x37,0x02,0x40,0x00,0x03,0x01,0x80,0x80,0xa0,
+0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,
+0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x03,0xc0,0x02,0x83,
+0x03,0x81,0xc0,0xb7,0x03,0x01,0x81,0x37,0x02,0x81,0x41,0x37,0x01,0x00,0x82,0x37,
+0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,
+0x03,0xc0,0x02,0x03,0x04,0x40,0x02,0x83,0x04,0x02,0x00,0xb7,0x03,0x81,0xc1,0x37,
+0x03,0x01,0x81,0x37,0x02,0x81,0x41,0x37,0x02,0x01,0x01,0x37,0x01,0x80,0xc1,0x37,
+0x02,0x40,0x00,0x83,0x01,0x80,0x80,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,
+0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,
+0x03,0x40,0x02,0x03,0x03,0xc0,0x02,0x83,0x03,0x81,0xc0,0xb7,0x03,0x01,0x81,0x37,
+0x01,0x00,0x82,0xb7,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,
+0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x04,0x40,0x02,0x83,0x04,0x02,0x00,0xb7,
+0x03,0x81,0xc1,0x37,0x03,0x01,0x81,0x37,0x02,0x81,0x41,0x37,0x02,0x01,0x01,0x37,
+0x01,0x80,0xc1,0x37,0x02,0x40,0x01,0x03,0x01,0x80,0x80,0xa0,0x00,0x80,0x01,0x20,
+0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,
+0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x03,0xc0,0x02,0x83,0x03,0x81,0xc0,0xb7,
+0x01,0x00,0x83,0x37,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,
+0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x04,0x40,0x02,0x83,0x04,0x02,0x00,0xb7,
+0x03,0x81,0xc1,0x37,0x03,0x01,0x81,0x37,0x02,0x81,0x41,0x37,0x02,0x01,0x01,0x37,
+0x01,0x80,0xc1,0x37,0x02,0x40,0x01,0x83,0x01,0x80,0x80,0xa0,0x00,0x80,0x01,0x20,
+0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,
+0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x03,0xc0,0x02,0x83,0x01,0x00,0x83,0x37,
+0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,
+0x03,0xc0,0x02,0x03,0x04,0x40,0x02,0x83,0x04,0x02,0x00,0xb7,0x03,0x81,0xc1,0x37,
+0x03,0x01,0x81,0x37,0x02,0x81,0x41,0x37,0x02,0x01,0x01,0x37,0x01,0x80,0xc1,0x37,
+0x02,0x40,0x02,0x03,0x01,0x80,0x80,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x33,0x00,0x00,0x00,0x03,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x01,0x36,0x00,0x00,
+0x07,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x00,0x00,0x00,0x00,0x80,0x00,0x01,0x00,
+0x08,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,0x01,
+0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x03,
+0xc0,0x02,0x83,0x01,0x00,0x83,0x37,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,
+0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x03,0x01,0x81,0x37,0x03,
+0xc0,0x02,0x83,0x02,0x81,0x41,0xb7,0x01,0x80,0xc1,0xb7,0x01,0x80,0x40,0x20,0x00,
+0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x08,
+0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x21,0x00,0x00,0x00,0x00,0xab,0x00,0x02,0x00,
+0x0a,0x00,0x00,0x00,0x00,0x00,0x1d,0x01,0x40,0x00,0x03,0x01,0x80,0x00,0x05,0x02,
+0x00,0x00,0x3d,0x02,0x80,0x00,0x05,0x03,0x00,0x00,0x04,0x03,0x80,0x00,0x08,0x04,
+0x00,0x00,0x05,0x00,0x80,0x83,0xb7,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,
+0x00,0x00,0x3d,0x02,0x80,0x00,0x04,0x03,0x00,0x00,0x08,0x01,0x80,0xc2,0x37,0x02,
+0x00,0x40,0x01,0x02,0x00,0x80,0x20,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x06,0x01,
+0xc0,0x00,0x03,0x02,0x00,0x00,0x05,0x02,0x80,0x00,0x3d,0x03,0x00,0x00,0x05,0x03,
+0x80,0x00,0x04,0x04,0x00,0x00,0x08,0x04,0x80,0x00,0x05,0x01,0x80,0xc3,0xb7,0x02,
+0x00,0x40,0x01,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x00,
+0x00,0x01,0x32,0x00,0x00,0x00,0x03,0x00,0x01,0x74,0x00,0x00,0x0c,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x07,0x63,0x6f,0x6d,0x70,
+0x61,0x63,0x74,0x00,0x00,0x00,0x00,0x84,0x00,0x02,0x00,0x09,0x00,0x00,0x00,0x00,
+0x00,0x13,0x01,0x40,0x00,0x03,0x01,0x80,0x00,0x05,0x02,0x00,0x00,0x3d,0x02,0x80,
+0x00,0x05,0x03,0x00,0x00,0x04,0x03,0x80,0x00,0x08,0x04,0x00,0x00,0x05,0x00,0x80,
+0x83,0xb7,0x01,0x00,0x40,0x01,0x01,0x00,0x40,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,
+0x00,0x03,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,0x04,0x03,0x00,0x00,0x08,0x01,0x80,
+0xc2,0x37,0x02,0x00,0x40,0x01,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x01,0x00,0x00,0x01,0x32,0x00,0x00,0x00,0x03,0x00,0x01,0x74,0x00,0x00,0x08,
+0x63,0x6f,0x6d,0x70,0x61,0x63,0x74,0x21,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0xe7,0x00,0x03,0x00,0x09,
+0x00,0x02,0x00,0x00,0x00,0x26,0x01,0xc0,0x05,0x03,0x02,0x40,0x0a,0x83,0x02,0xc0,
+0x10,0x03,0x03,0x40,0x15,0x83,0x00,0x80,0xc2,0x37,0x01,0x80,0x00,0x06,0x02,0x40,
+0x0a,0x83,0x02,0x80,0x40,0x01,0x03,0x40,0x00,0x03,0x02,0x80,0x40,0xa0,0x01,0x80,
+0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x15,0x83,0x02,0x80,0x40,0x01,0x03,0x3f,
+0xff,0x03,0x02,0x80,0x40,0xa0,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x00,
+0x00,0x3d,0x02,0x80,0x40,0x01,0x03,0x40,0x01,0x83,0x03,0x80,0x00,0x3d,0x02,0x80,
+0x41,0x20,0x01,0x80,0x01,0x20,0x01,0x3f,0xff,0x83,0x01,0x80,0x40,0x01,0x02,0x40,
+0x31,0x83,0x02,0x80,0x01,0x40,0x01,0x80,0x40,0xa1,0x01,0x80,0x00,0x06,0x02,0x40,
+0x31,0x83,0x02,0x80,0x80,0x01,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x00,
+0x01,0x91,0x02,0x80,0x03,0x40,0x01,0x80,0x80,0xa1,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x01,0x00,0x00,0x03,0x63,0x61,0x74,0x00,0x00,0x00,0x04,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x05,0x66,0x65,0x74,
+0x63,0x68,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,
+0x65,0x00,0x00,0x0a,0x49,0x6e,0x64,0x65,0x78,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,
+0x00,0x00,0x22,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x03,0x02,0x00,0x00,
+0x26,0x00,0x80,0x80,0x16,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x2e,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+0x80,0x40,0x15,0x01,0x40,0x31,0x83,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x66,0x65,0x74,0x63,0x68,0x00,0x00,
+0x00,0x06,0xeb,0x00,0x02,0x00,0x0a,0x00,0x09,0x00,0x00,0x01,0xa0,0x01,0x00,0x00,
+0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x02,0x80,0x01,0xbd,0x00,0x80,0x82,
+0x37,0x01,0x00,0x00,0x06,0x01,0x80,0x02,0x3d,0x02,0x00,0x02,0x3d,0x02,0x80,0x02,
+0x3d,0x03,0x00,0x02,0x3d,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,0x02,0x80,0x02,
+0x3d,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x02,
+0x3d,0x02,0x00,0x02,0x3d,0x02,0x80,0x02,0x3d,0x03,0x00,0x02,0xbd,0x01,0x80,0xc2,
+0x37,0x02,0x00,0x40,0x01,0x02,0x80,0x02,0xbd,0x03,0x3f,0xff,0x03,0x02,0x00,0x41,
+0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x02,0x3d,0x02,0x00,0x02,
+0x3d,0x02,0x80,0x03,0x3d,0x03,0x00,0x03,0x3d,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,
+0x01,0x02,0x80,0x03,0x3d,0x03,0x40,0x00,0x83,0x03,0xc0,0x00,0x83,0x02,0x00,0x41,
+0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x03,0xbd,0x02,0x00,0x03,
+0xbd,0x02,0x80,0x03,0x3d,0x03,0x00,0x03,0x3d,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,
+0x01,0x02,0x80,0x03,0xbd,0x03,0x3f,0xff,0x83,0x03,0xc0,0x00,0x03,0x03,0x01,0x80,
+0x41,0x02,0x00,0x41,0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,
+0x83,0x02,0x40,0x00,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x04,0x03,0x01,0x80,0xc2,
+0x37,0x02,0x00,0x40,0x01,0x02,0x80,0x01,0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x01,
+0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,0x02,0x40,0x00,0x03,0x02,0xc0,0x03,
+0x83,0x03,0x40,0x0d,0x03,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,0x02,0xbf,0xfe,
+0x83,0x03,0x00,0x03,0x40,0x02,0x00,0x40,0xa1,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0xbf,0xff,0x83,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x0d,
+0x03,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,
+0x83,0x03,0x80,0x05,0x40,0x02,0x00,0x41,0x21,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x0d,
+0x03,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,0x02,0xbf,0xff,0x83,0x03,0x40,0x00,
+0x03,0x02,0x81,0x40,0x41,0x03,0x00,0x07,0x40,0x02,0x00,0x40,0xa1,0x01,0x00,0x01,
+0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x91,0x02,0x00,0x09,0x40,0x01,0x00,0x80,
+0xa1,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,
+0x83,0x03,0x40,0x01,0x03,0x03,0xbf,0xff,0x03,0x04,0x40,0x02,0x03,0x01,0x80,0xc3,
+0x37,0x02,0x3f,0xff,0x83,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,
+0x03,0x04,0x40,0x01,0x83,0x04,0xc0,0x02,0x03,0x02,0x01,0x03,0x37,0x02,0xbf,0xff,
+0x03,0x03,0x3f,0xfe,0x83,0x03,0xc0,0x00,0x03,0x02,0x00,0x41,0xa0,0x01,0x00,0x01,
+0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,
+0x83,0x03,0x40,0x01,0x03,0x03,0xbf,0xff,0x03,0x04,0x3f,0xff,0x03,0x04,0xbf,0xff,
+0x03,0x01,0x80,0xc3,0xb7,0x02,0x3f,0xff,0x83,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,
+0x83,0x03,0xc0,0x01,0x03,0x04,0x40,0x01,0x83,0x04,0xc0,0x02,0x03,0x02,0x01,0x03,
+0x37,0x02,0xbf,0xff,0x03,0x03,0x3f,0xfe,0x83,0x03,0xc0,0x01,0x03,0x02,0x00,0x41,
+0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,0x02,0x40,0x00,
+0x03,0x02,0xc0,0x00,0x83,0x03,0x3f,0xff,0x03,0x03,0xbf,0xff,0x03,0x04,0x40,0x02,
+0x03,0x01,0x80,0xc3,0x37,0x02,0x3f,0xff,0x83,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,
+0x83,0x03,0xc0,0x01,0x03,0x04,0x40,0x01,0x83,0x04,0xc0,0x02,0x03,0x02,0x01,0x03,
+0x37,0x02,0xbf,0xff,0x03,0x03,0x40,0x01,0x03,0x03,0xc0,0x01,0x83,0x03,0x01,0x80,
+0x41,0x02,0x00,0x41,0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,
+0x83,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x3f,0xff,0x03,0x03,0xc0,0x01,
+0x83,0x04,0x40,0x02,0x03,0x01,0x80,0xc3,0x37,0x02,0x3f,0xff,0x83,0x02,0xc0,0x00,
+0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x04,0x40,0x01,0x83,0x04,0xc0,0x02,
+0x03,0x02,0x01,0x03,0x37,0x02,0xbf,0xff,0x03,0x03,0x40,0x01,0x03,0x03,0xc0,0x01,
+0x83,0x03,0x01,0x80,0xc1,0x02,0x00,0x41,0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0xbf,0xff,0x83,0x02,0x40,0x00,0x03,0x02,0xbf,0xff,0x03,0x03,0x3f,0xff,
+0x03,0x03,0xbf,0xff,0x03,0x04,0x40,0x02,0x03,0x01,0x80,0xc3,0x37,0x02,0x3f,0xff,
+0x83,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x04,0x40,0x01,
+0x83,0x04,0xc0,0x02,0x03,0x02,0x01,0x03,0x37,0x02,0xbf,0xff,0x03,0x03,0x40,0x00,
+0x83,0x03,0xbf,0xfe,0x83,0x03,0x01,0x80,0x41,0x02,0x00,0x41,0x20,0x01,0x00,0x01,
+0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,0x02,0x40,0x00,0x03,0x02,0xbf,0xff,
+0x03,0x03,0x3f,0xff,0x03,0x03,0xc0,0x01,0x83,0x04,0x40,0x02,0x03,0x01,0x80,0xc3,
+0x37,0x02,0x3f,0xff,0x83,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,
+0x03,0x04,0x40,0x01,0x83,0x04,0xc0,0x02,0x03,0x02,0x01,0x03,0x37,0x02,0xbf,0xff,
+0x03,0x03,0x40,0x00,0x83,0x03,0xbf,0xfe,0x83,0x03,0x01,0x80,0xc1,0x02,0x00,0x41,
+0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,0x02,0x40,0x00,
+0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x06,0x03,0x03,0xc0,0x06,0x83,0x04,0x40,0x02,
+0x03,0x01,0x80,0xc3,0x37,0x02,0x3f,0xff,0x83,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,
+0x83,0x03,0xc0,0x01,0x03,0x04,0x40,0x01,0x83,0x04,0xc0,0x02,0x03,0x02,0x01,0x03,
+0x37,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x02,0x81,0x40,0x41,0x03,0x00,0x0b,
+0x40,0x02,0x00,0x40,0xa1,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,
+0x83,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x06,0x03,0x03,0xc0,0x01,
+0x83,0x04,0x40,0x02,0x03,0x01,0x80,0xc3,0x37,0x02,0x3f,0xff,0x83,0x02,0xc0,0x00,
+0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x04,0x40,0x01,0x83,0x04,0xc0,0x02,
+0x03,0x02,0x01,0x03,0x37,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x02,0x81,0x40,
+0xc1,0x03,0x00,0x0d,0x40,0x02,0x00,0x40,0xa1,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0xbf,0xff,0x83,0x02,0x40,0x00,0x03,0x02,0xc0,0x05,0x83,0x03,0x40,0x06,
+0x03,0x03,0xc0,0x06,0x83,0x04,0x40,0x02,0x03,0x01,0x80,0xc3,0x37,0x02,0x3f,0xff,
+0x83,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x04,0x40,0x01,
+0x83,0x04,0xc0,0x02,0x03,0x02,0x01,0x03,0x37,0x02,0xc0,0x00,0x83,0x03,0x3f,0xfe,
+0x83,0x02,0x81,0x40,0x41,0x03,0x00,0x0f,0x40,0x02,0x00,0x40,0xa1,0x01,0x00,0x01,
+0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,0x02,0x40,0x00,0x03,0x02,0xc0,0x05,
+0x83,0x03,0x40,0x06,0x03,0x03,0xc0,0x01,0x83,0x04,0x40,0x02,0x03,0x01,0x80,0xc3,
+0x37,0x02,0x3f,0xff,0x83,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,
+0x03,0x04,0x40,0x01,0x83,0x04,0xc0,0x02,0x03,0x02,0x01,0x03,0x37,0x02,0xc0,0x00,
+0x83,0x03,0x3f,0xfe,0x83,0x02,0x81,0x40,0xc1,0x03,0x00,0x11,0x40,0x02,0x00,0x40,
+0xa1,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,
+0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0x80,0x02,0x3d,0x04,0x00,0x02,
+0x3d,0x01,0x80,0xc3,0x37,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,
+0x03,0x03,0xc0,0x01,0x83,0x04,0x40,0x02,0x03,0x04,0xc0,0x02,0x83,0x02,0x01,0x03,
+0x37,0x02,0x80,0x02,0x3d,0x03,0x3f,0xfe,0x83,0x03,0xbf,0xff,0x03,0x03,0x01,0x80,
+0x41,0x02,0x00,0x41,0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,
+0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0x80,0x02,
+0x3d,0x04,0x40,0x02,0x83,0x01,0x80,0xc3,0x37,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,
+0x83,0x03,0x40,0x01,0x03,0x03,0xc0,0x01,0x83,0x04,0x40,0x02,0x03,0x04,0xc0,0x02,
+0x83,0x02,0x01,0x03,0x37,0x02,0x80,0x02,0x3d,0x03,0x3f,0xfe,0x83,0x03,0xbf,0xff,
+0x03,0x03,0x01,0x80,0xc1,0x02,0x00,0x41,0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,
+0x83,0x03,0xc0,0x02,0x03,0x04,0x40,0x02,0x83,0x01,0x80,0xc3,0x37,0x02,0x40,0x00,
+0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x03,0xc0,0x01,0x83,0x04,0x40,0x02,
+0x03,0x04,0xc0,0x02,0x83,0x02,0x01,0x03,0x37,0x02,0x80,0x02,0x3d,0x03,0x3f,0xfe,
+0x83,0x03,0xbf,0xfe,0x83,0x03,0x01,0x80,0xc1,0x02,0x00,0x41,0x20,0x01,0x00,0x01,
+0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,
+0x03,0x03,0x40,0x01,0x83,0x03,0x80,0x02,0x3d,0x04,0x40,0x02,0x83,0x01,0x80,0xc3,
+0x37,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x03,0xc0,0x01,
+0x83,0x04,0x40,0x02,0x03,0x04,0xc0,0x02,0x83,0x02,0x01,0x03,0x37,0x02,0x80,0x02,
+0x3d,0x03,0x3f,0xfe,0x83,0x03,0xbf,0xfe,0x83,0x03,0x01,0x80,0x41,0x02,0x00,0x41,
+0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,
+0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x04,0x40,0x02,
+0x83,0x01,0x80,0xc3,0x37,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,
+0x03,0x03,0xc0,0x01,0x83,0x04,0x40,0x02,0x03,0x04,0xc0,0x02,0x83,0x02,0x01,0x03,
+0x37,0x02,0x80,0x02,0x3d,0x03,0x3f,0xfe,0x83,0x03,0xbf,0xff,0x83,0x03,0x01,0x80,
+0x41,0x02,0x00,0x41,0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x08,0x00,0x00,0x01,0x61,0x00,0x00,0x01,0x62,0x00,0x00,0x01,0x63,0x00,0x00,0x01,
+0x64,0x00,0x00,0x01,0x78,0x00,0x00,0x01,0x77,0x00,0x00,0x01,0x7a,0x00,0x00,0x01,
+0x79,0x00,0x00,0x00,0x04,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x04,0x66,0x69,0x6c,0x6c,0x00,0x00,0x0c,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,0x41,0x72,0x67,0x75,
+0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x2e,0x00,0x03,
+0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,
+0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xb0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x01,0x2a,0x00,0x00,0x00,0x00,0x36,0x00,0x03,0x00,0x06,
+0x00,0x00,0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,
+0x40,0x01,0x01,0x80,0x00,0xb0,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xb0,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2a,0x00,0x00,0x00,
+0x00,0x2a,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,
+0x01,0x80,0x40,0x01,0x01,0x80,0x00,0xad,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x2a,0x00,0x03,0x00,0x06,
+0x00,0x00,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,
+0x00,0xad,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,
+0x2b,0x00,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x80,0x40,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x04,0x66,0x69,0x6c,0x6c,0x00,0x00,0x00,0x00,0x2a,0x00,
+0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,
+0x01,0x01,0x80,0x05,0x2d,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x2a,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
+0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x05,0x2d,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,
+0x00,0x00,0x2a,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x02,0x00,0x00,
+0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x05,0x2d,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x2a,0x00,0x03,0x00,
+0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,
+0x80,0x05,0x2d,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x01,0x2b,0x00,0x00,0x00,0x00,0xfa,0x00,0x03,0x00,0x08,0x00,0x01,0x00,0x00,0x00,
+0x22,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x02,0x80,0x01,0x3d,0x03,0x00,0x01,
+0xbd,0x00,0x80,0xc2,0x37,0x01,0x00,0xc0,0x37,0x01,0x80,0x40,0x01,0x02,0x00,0x01,
+0x40,0x01,0x80,0x00,0x21,0x01,0x80,0x00,0x06,0x02,0x00,0x01,0xbd,0x02,0x80,0x01,
+0x3d,0x03,0x00,0x00,0xbd,0x03,0x80,0x00,0x3d,0x02,0x01,0x02,0x37,0x02,0x80,0x80,
+0x01,0x01,0x80,0x41,0x20,0x01,0x80,0x01,0x11,0x02,0x00,0x02,0x04,0x01,0x80,0xc0,
+0xa0,0x01,0xc0,0x05,0x99,0x01,0x80,0x00,0x06,0x02,0x00,0x01,0xbd,0x02,0x80,0x01,
+0x3d,0x03,0x00,0x00,0xbd,0x03,0x80,0x00,0x3d,0x02,0x01,0x02,0x37,0x02,0x80,0x40,
+0x01,0x02,0x80,0x00,0x20,0x02,0x81,0x40,0x20,0x01,0x80,0x41,0x20,0x00,0x40,0x00,
+0x97,0x01,0x80,0x00,0x07,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x04,0x00,0x00,0x01,
+0x61,0x00,0x00,0x01,0x62,0x00,0x00,0x01,0x63,0x00,0x00,0x01,0x64,0x00,0x00,0x00,
+0x06,0x00,0x0c,0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x5f,0x65,0x61,0x63,0x68,0x00,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,
+0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x0e,0x63,0x6f,0x6e,0x73,0x74,0x5f,
+0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x3f,0x00,0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,
+0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x04,0x74,0x6f,0x5f,0x61,0x00,0x00,0x00,0x00,
+0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,
+0x80,0x80,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x01,0x26,
+0x00,0x02,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x3a,0x01,0x00,0x00,0x3d,0x01,0x80,
+0x00,0xbd,0x02,0x00,0x01,0x3d,0x02,0x80,0x01,0xbd,0x00,0x80,0x82,0x37,0x01,0x00,
+0x00,0x06,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x02,0x80,0x01,0xbd,0x03,0x00,
+0x00,0x3d,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,0x02,0x00,0x40,0x20,0x01,0x00,
+0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x02,0x80,
+0x01,0x3d,0x03,0x00,0x01,0xbd,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,0x01,0x00,
+0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x3d,0x02,0x00,0x01,0xbd,0x02,0x80,
+0x00,0x3d,0x03,0x00,0x00,0xbd,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,0x02,0xc0,
+0x00,0x83,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,
+0x00,0xbd,0x02,0x00,0x01,0x3d,0x02,0x80,0x01,0xbd,0x03,0x00,0x00,0x3d,0x01,0x80,
+0xc2,0x37,0x02,0x00,0x40,0x01,0x02,0xbf,0xfe,0x03,0x02,0x00,0x40,0xa0,0x01,0x00,
+0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x3d,0x02,0x00,0x01,0xbd,0x02,0x80,
+0x00,0x3d,0x03,0x00,0x00,0xbd,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,0x02,0xc0,
+0x04,0x83,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,
+0xc0,0x37,0x02,0x01,0x00,0x37,0x02,0x00,0x40,0x20,0x01,0x00,0x01,0x20,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x04,0x00,0x00,0x01,0x61,0x00,0x00,0x01,0x62,0x00,0x00,
+0x01,0x63,0x00,0x00,0x01,0x64,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x06,0x72,0x6f,0x74,0x61,0x74,
+0x65,0x00,0x00,0x00,0x01,0x30,0x00,0x02,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x3a,
+0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x02,0x80,0x01,0xbd,
+0x00,0x80,0x82,0x37,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,
+0x02,0x80,0x01,0xbd,0x03,0x00,0x00,0x3d,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,
+0x02,0x00,0x40,0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0xbd,
+0x02,0x00,0x01,0x3d,0x02,0x80,0x01,0xbd,0x03,0x00,0x00,0x3d,0x01,0x80,0xc2,0x37,
+0x02,0x00,0x40,0x01,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0xbd,
+0x02,0x00,0x00,0x3d,0x02,0x80,0x00,0xbd,0x03,0x00,0x01,0x3d,0x01,0x80,0xc2,0x37,
+0x02,0x00,0x40,0x01,0x02,0xc0,0x00,0x83,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,
+0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x02,0x80,0x01,0x3d,
+0x03,0x00,0x01,0xbd,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,0x02,0xbf,0xfe,0x03,
+0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x3d,
+0x02,0x00,0x01,0xbd,0x02,0x80,0x00,0x3d,0x03,0x00,0x00,0xbd,0x01,0x80,0xc2,0x37,
+0x02,0x00,0x40,0x01,0x02,0xc0,0x04,0x83,0x02,0x00,0x80,0xa0,0x01,0x00,0x01,0x20,
+0x01,0x00,0x00,0x06,0x01,0x80,0xc0,0x37,0x02,0x01,0x00,0x37,0x02,0x00,0x40,0x20,
+0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x04,0x00,0x00,0x01,0x61,
+0x00,0x00,0x01,0x62,0x00,0x00,0x01,0x63,0x00,0x00,0x01,0x64,0x00,0x00,0x00,0x03,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,
+0x07,0x72,0x6f,0x74,0x61,0x74,0x65,0x21,0x00,0x00,0x06,0x72,0x6f,0x74,0x61,0x74,
+0x65,0x00,0x00,0x00,0x01,0x35,0x00,0x02,0x00,0x08,0x00,0x03,0x00,0x00,0x00,0x41,
+0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,
+0x03,0x40,0x02,0x03,0x00,0x80,0x82,0xb7,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,
+0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,
+0x01,0x80,0xc2,0xb7,0x02,0x00,0x40,0x01,0x02,0x80,0x01,0x40,0x02,0x00,0x40,0x21,
+0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,
+0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x01,0x80,0xc2,0xb7,
+0x02,0x00,0x40,0x01,0x01,0x00,0x01,0x20,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,
+0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x00,0x80,0x82,0xb7,
+0x01,0x00,0x00,0x06,0x01,0x80,0xc0,0x37,0x02,0x00,0x40,0x01,0x02,0x80,0x03,0x40,
+0x02,0x00,0x40,0x21,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0xc0,0x37,
+0x02,0x00,0x40,0x01,0x01,0x00,0x01,0x20,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,
+0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x00,0x80,0x82,0xb7,
+0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,
+0x01,0x80,0xc1,0xb7,0x02,0x00,0x40,0x01,0x02,0x80,0x05,0x40,0x02,0x00,0x40,0x21,
+0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,
+0x02,0xc0,0x01,0x03,0x01,0x80,0xc1,0xb7,0x02,0x00,0x40,0x01,0x01,0x00,0x01,0x20,
+0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x09,0x64,0x65,0x6c,
+0x65,0x74,0x65,0x5f,0x69,0x66,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x08,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x80,0x00,0x07,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,
+0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x01,0x03,0x01,0x80,0x00,
+0xb5,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x3e,
+0x00,0x00,0x00,0x01,0x28,0x00,0x02,0x00,0x08,0x00,0x03,0x00,0x00,0x00,0x3b,0x01,
+0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,
+0x40,0x02,0x03,0x00,0x80,0x82,0xb7,0x01,0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,
+0x00,0x01,0x40,0x01,0x80,0x40,0x21,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,
+0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,
+0xc0,0x02,0x03,0x01,0x80,0xc2,0xb7,0x02,0x00,0x40,0x01,0x01,0x00,0x81,0x20,0x01,
+0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,
+0x40,0x02,0x03,0x00,0x80,0x82,0xb7,0x01,0x00,0x00,0x06,0x01,0x80,0xc0,0x37,0x02,
+0x00,0x40,0x01,0x02,0x80,0x03,0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x81,0x20,0x01,
+0x00,0x00,0x06,0x01,0x80,0xc0,0x37,0x02,0x00,0x40,0x01,0x01,0x00,0x81,0x20,0x01,
+0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,
+0x40,0x02,0x03,0x00,0x80,0x82,0xb7,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,
+0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x01,0x80,0xc1,0xb7,0x02,0x00,0x40,0x01,0x02,
+0x80,0x05,0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,
+0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x01,0x80,0xc1,0xb7,0x02,
+0x00,0x40,0x01,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x0a,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x6e,0x69,0x6c,0x00,
+0x00,0x07,0x72,0x65,0x6a,0x65,0x63,0x74,0x21,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,
+0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x08,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x07,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
+0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x01,0x03,0x01,
+0x80,0x00,0xb5,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x01,0x3e,0x00,0x00,0x00,0x01,0x16,0x00,0x03,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,
+0x36,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x02,0x80,0x01,0x3d,0x03,0x00,0x01,
+0xbd,0x00,0x80,0xc2,0x37,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,
+0xbd,0x03,0x40,0x31,0x03,0x03,0x80,0x01,0x3d,0x04,0x00,0x01,0xbd,0x02,0x01,0x02,
+0xb7,0x02,0x80,0x40,0x01,0x03,0x40,0x00,0x83,0x03,0xc0,0x31,0x03,0x02,0x80,0x41,
+0x20,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,
+0xbd,0x03,0x40,0x31,0x03,0x03,0x80,0x01,0x3d,0x04,0x40,0x00,0x03,0x04,0xc0,0x00,
+0x83,0x05,0x40,0x01,0x03,0x05,0x80,0x01,0xbd,0x02,0x01,0x04,0x37,0x02,0x80,0x40,
+0x01,0x03,0x3f,0xfe,0x83,0x03,0xc0,0x00,0x03,0x04,0x40,0x00,0x83,0x04,0xc0,0x01,
+0x03,0x02,0x80,0x42,0x20,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,
+0xbd,0x02,0x80,0x01,0x3d,0x03,0x00,0x01,0xbd,0x01,0x00,0xc2,0x37,0x01,0x80,0x00,
+0x06,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,0xbd,0x03,0x00,0x01,0x3d,0x03,0x80,0x01,
+0xbd,0x04,0x00,0x00,0x05,0x04,0x80,0x00,0x05,0x05,0x40,0x31,0x03,0x02,0x01,0x03,
+0xb7,0x02,0x80,0x80,0x01,0x03,0x40,0x02,0x83,0x03,0xc0,0x31,0x03,0x02,0x80,0x41,
+0x20,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x04,0x00,0x00,0x01,
+0x61,0x00,0x00,0x01,0x62,0x00,0x00,0x01,0x63,0x00,0x00,0x01,0x64,0x00,0x00,0x00,
+0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,
+0x00,0x06,0x69,0x6e,0x73,0x65,0x72,0x74,0x00,0x00,0x00,0x01,0x49,0x00,0x02,0x00,
+0x07,0x00,0x08,0x00,0x00,0x00,0x3f,0x01,0x3f,0xff,0x83,0x01,0xc0,0x01,0x83,0x02,
+0x40,0x03,0x03,0x02,0xc0,0x04,0x83,0x03,0x40,0x05,0x83,0x00,0x80,0x82,0xb7,0x01,
+0x00,0x00,0x06,0x01,0xc0,0x01,0x83,0x02,0x40,0x03,0x03,0x01,0x80,0xc1,0x37,0x02,
+0x00,0x40,0x01,0x02,0x80,0x01,0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x01,0x20,0x01,
+0x00,0x00,0x06,0x01,0xc0,0x03,0x03,0x02,0x00,0x40,0x01,0x02,0x80,0x03,0x40,0x02,
+0x00,0x40,0x21,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,0xbf,0xff,0x83,0x02,
+0x00,0x40,0x01,0x02,0x80,0x05,0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x81,0x20,0x01,
+0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,0x00,0x07,0x40,0x01,0x80,0x40,0x21,0x01,
+0x00,0xc0,0xa0,0x01,0x3f,0xff,0x83,0x01,0xc0,0x01,0x83,0x02,0x40,0x03,0x03,0x02,
+0xc0,0x04,0x83,0x03,0x40,0x05,0x83,0x00,0x80,0x82,0xb7,0x01,0x00,0x00,0x06,0x01,
+0xc0,0x01,0x83,0x02,0x40,0x03,0x03,0x01,0x80,0xc1,0x37,0x02,0x00,0x40,0x01,0x02,
+0x80,0x09,0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,
+0x80,0x40,0x01,0x02,0x00,0x0b,0x40,0x01,0x80,0x40,0x21,0x01,0x00,0xc0,0xa0,0x01,
+0x00,0x00,0x06,0x01,0x80,0x00,0x05,0x02,0x00,0x40,0x01,0x02,0x80,0x0d,0x40,0x02,
+0x00,0x40,0x21,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x05,0x02,
+0x00,0x40,0x01,0x02,0x80,0x0f,0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x81,0x20,0x01,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0e,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x07,0x62,0x73,
+0x65,0x61,0x72,0x63,0x68,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x0a,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x6e,0x69,
+0x6c,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,
+0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x01,0x83,0x01,0x80,0x00,0xb6,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3e,0x3d,
+0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,
+0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x02,0x83,0x01,0x80,0x00,0xb6,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3e,0x3d,0x00,
+0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,
+0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x3f,0xff,0x03,0x01,0x80,0x00,0xb6,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3e,0x3d,0x00,0x00,
+0x00,0x00,0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,
+0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x31,0x83,0x01,0x80,0x00,0xb6,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3e,0x3d,0x00,0x00,0x00,
+0x00,0x49,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x08,0x02,0x00,0x00,0x26,
+0x01,0xc0,0x00,0x03,0x02,0x00,0x40,0x01,0x02,0xc0,0x01,0x83,0x02,0x00,0x40,0xb1,
+0x02,0x00,0x80,0x20,0x01,0x80,0x00,0xae,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x01,0x2d,0x00,0x00,0x01,0x2f,0x00,0x00,0x08,0x74,0x72,
+0x75,0x6e,0x63,0x61,0x74,0x65,0x00,0x00,0x00,0x00,0x49,0x00,0x03,0x00,0x07,0x00,
+0x00,0x00,0x00,0x00,0x08,0x02,0x00,0x00,0x26,0x01,0xc0,0x01,0x83,0x02,0x00,0x40,
+0x01,0x02,0xc0,0x00,0x83,0x02,0x00,0x40,0xb1,0x02,0x00,0x80,0x20,0x01,0x80,0x00,
+0xae,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x01,0x2d,
+0x00,0x00,0x01,0x2f,0x00,0x00,0x08,0x74,0x72,0x75,0x6e,0x63,0x61,0x74,0x65,0x00,
+0x00,0x00,0x00,0x22,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x03,0x02,0x00,
+0x00,0x26,0x01,0xc0,0x00,0x03,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x03,
+0x02,0x00,0x00,0x26,0x01,0xbf,0xff,0x03,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x19,0x00,0x02,0x00,0x08,0x00,0x03,0x00,0x00,
+0x00,0x3a,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,
+0x01,0x83,0x03,0x40,0x02,0x03,0x00,0x80,0x82,0xb7,0x01,0x00,0x00,0x06,0x01,0xc0,
+0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,
+0x02,0x03,0x01,0x80,0xc2,0xb7,0x02,0x00,0x40,0x01,0x02,0x80,0x01,0x40,0x02,0x00,
+0x40,0x21,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,
+0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x01,0x80,
+0xc2,0xb7,0x02,0x00,0x40,0x01,0x01,0x00,0x01,0x20,0x01,0x40,0x00,0x03,0x01,0xc0,
+0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x00,0x80,
+0x82,0xb7,0x01,0x00,0x00,0x06,0x01,0x80,0xc0,0x37,0x02,0x00,0x40,0x01,0x02,0x80,
+0x03,0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,
+0xc0,0x37,0x02,0x00,0x40,0x01,0x01,0x00,0x01,0x20,0x01,0x40,0x00,0x03,0x01,0xc0,
+0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x00,0x80,
+0x82,0xb7,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,
+0x01,0x03,0x01,0x80,0xc1,0xb7,0x02,0x00,0x40,0x01,0x02,0x80,0x05,0x40,0x02,0x00,
+0x40,0x21,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x09,0x64,0x65,0x6c,0x65,0x74,0x65,0x5f,0x69,0x66,0x00,0x00,0x00,0x00,
+0x1e,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x08,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,
+0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x07,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0x00,0x03,0x00,
+0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,
+0x40,0x01,0x03,0x01,0x80,0x00,0xb5,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x01,0x3e,0x00,0x00,0x00,0x01,0x2b,0x00,0x02,0x00,0x08,0x00,
+0x03,0x00,0x00,0x00,0x3f,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,
+0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x00,0x80,0x82,0xb7,0x01,0x00,0x00,
+0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,
+0x83,0x03,0xc0,0x02,0x03,0x01,0x80,0xc2,0xb7,0x02,0x00,0x40,0x01,0x02,0x80,0x01,
+0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,
+0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,
+0x03,0x01,0x80,0xc2,0xb7,0x02,0x00,0x40,0x01,0x01,0x00,0x01,0x20,0x01,0x40,0x00,
+0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,
+0x03,0x00,0x80,0x82,0xb7,0x01,0x00,0x00,0x06,0x01,0x80,0xc0,0x37,0x02,0x00,0x40,
+0x01,0x02,0x80,0x03,0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0x80,0xc0,0x37,0x02,0x00,0x40,0x01,0x01,0x00,0x01,0x20,0x01,0x40,0x00,
+0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,
+0x03,0x00,0x80,0x82,0xb7,0x01,0x00,0x00,0x06,0x01,0xc0,0x01,0x83,0x02,0x40,0x02,
+0x03,0x01,0x80,0xc1,0x37,0x02,0x00,0x40,0x01,0x02,0x80,0x05,0x40,0x02,0x00,0x40,
+0x21,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x01,0x83,0x02,0x40,0x02,
+0x03,0x01,0x80,0xc1,0x37,0x02,0x00,0x40,0x01,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x07,0x6b,0x65,0x65,0x70,0x5f,0x69,
+0x66,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x80,0x00,0x07,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x80,
+0x00,0x08,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x2e,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,
+0x01,0x80,0x40,0x01,0x02,0x40,0x01,0x03,0x01,0x80,0x00,0xb5,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x3e,0x00,0x00,0x00,0x01,0x20,
+0x00,0x02,0x00,0x08,0x00,0x03,0x00,0x00,0x00,0x39,0x01,0x40,0x00,0x03,0x01,0xc0,
+0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x00,0x80,
+0x82,0xb7,0x01,0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,0x00,0x01,0x40,0x01,0x80,
+0x40,0x21,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,
+0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x01,0x80,
+0xc2,0xb7,0x02,0x00,0x40,0x01,0x01,0x00,0x81,0x20,0x01,0x40,0x00,0x03,0x01,0xc0,
+0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x00,0x80,
+0x82,0xb7,0x01,0x00,0x00,0x06,0x01,0x80,0xc0,0x37,0x02,0x00,0x40,0x01,0x02,0x80,
+0x03,0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x06,0x01,0x80,
+0xc0,0x37,0x02,0x00,0x40,0x01,0x01,0x00,0x81,0x20,0x01,0x40,0x00,0x03,0x01,0xc0,
+0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x00,0x80,
+0x82,0xb7,0x01,0x00,0x00,0x06,0x01,0xc0,0x01,0x83,0x02,0x40,0x02,0x03,0x01,0x80,
+0xc1,0x37,0x02,0x00,0x40,0x01,0x02,0x80,0x05,0x40,0x02,0x00,0x40,0x21,0x01,0x00,
+0x81,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x01,0x83,0x02,0x40,0x02,0x03,0x01,0x80,
+0xc1,0x37,0x02,0x00,0x40,0x01,0x01,0x00,0x81,0x20,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0a,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x6e,
+0x69,0x6c,0x00,0x00,0x07,0x73,0x65,0x6c,0x65,0x63,0x74,0x21,0x00,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x1e,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x07,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,
+0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x08,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0x00,0x03,0x00,0x06,
+0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,
+0x01,0x03,0x01,0x80,0x00,0xb5,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x01,0x3e,0x00,0x00,0x00,0x01,0x76,0x00,0x02,0x00,0x0a,0x00,0x01,
+0x00,0x00,0x00,0x41,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,
+0x02,0x80,0x01,0xbd,0x03,0x00,0x02,0x3d,0x00,0x80,0x82,0xb7,0x01,0x00,0x00,0x06,
+0x01,0x80,0x00,0x3d,0x02,0x00,0x01,0x3d,0x02,0x80,0x02,0x3d,0x01,0x80,0xc1,0xb7,
+0x02,0x00,0x40,0x01,0x02,0xbf,0xff,0x83,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,0x83,
+0x02,0x00,0x41,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0xbd,
+0x02,0x00,0x01,0xbd,0x02,0x80,0x00,0x05,0x03,0x00,0x00,0x05,0x01,0x80,0xc2,0x37,
+0x02,0x00,0x40,0x01,0x02,0xc0,0x00,0x03,0x03,0x40,0x01,0x03,0x03,0xc0,0x02,0x03,
+0x04,0x40,0x03,0x03,0x02,0x00,0x42,0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,
+0x01,0x80,0x02,0x3d,0x02,0x00,0x01,0xbd,0x02,0x80,0x01,0xbd,0x03,0x00,0x00,0x05,
+0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,0x02,0xbf,0xff,0x03,0x03,0x3f,0xfe,0x83,
+0x03,0xbf,0xfe,0x83,0x04,0x3f,0xfc,0x03,0x02,0x00,0x42,0x20,0x01,0x00,0x01,0x20,
+0x01,0x00,0x00,0x06,0x01,0x80,0x02,0x3d,0x02,0x00,0x00,0x05,0x02,0x80,0x00,0x05,
+0x03,0x00,0x00,0x3d,0x03,0x80,0x00,0xbd,0x04,0x00,0x01,0x3d,0x01,0x80,0xc3,0x37,
+0x02,0x00,0x40,0x01,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x83,0x02,0x81,0x40,0x41,
+0x03,0x3f,0xff,0x83,0x03,0xc0,0x01,0x03,0x03,0x01,0x80,0xc1,0x02,0x00,0x41,0x20,
+0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x91,0x02,0x00,0x01,0x40,
+0x01,0x00,0x80,0xa1,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x05,0x00,0x00,0x03,0x72,
+0x65,0x64,0x00,0x00,0x05,0x67,0x72,0x65,0x65,0x6e,0x00,0x00,0x06,0x70,0x75,0x72,
+0x70,0x6c,0x65,0x00,0x00,0x05,0x77,0x68,0x69,0x74,0x65,0x00,0x00,0x04,0x6e,0x6f,
+0x6e,0x65,0x00,0x00,0x00,0x04,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x09,0x76,0x61,0x6c,0x75,0x65,0x73,0x5f,0x61,0x74,
+0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,
+0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x37,
+0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x80,0x40,0x15,0x01,0x00,
+0x00,0x3d,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,
+0x02,0x74,0x74,0x00,0x00,0x00,0x01,0x00,0x09,0x76,0x61,0x6c,0x75,0x65,0x73,0x5f,
+0x61,0x74,0x00,0x00,0x00,0x01,0x55,0x00,0x05,0x00,0x0c,0x00,0x02,0x00,0x00,0x00,
+0x31,0x02,0x80,0x00,0x3d,0x03,0x00,0x00,0xbd,0x03,0x80,0x01,0x3d,0x04,0x00,0x01,
+0xbd,0x00,0x81,0x41,0x3f,0x02,0x80,0x01,0x3d,0x03,0x00,0x02,0x3d,0x03,0x80,0x02,
+0xbd,0x04,0x00,0x03,0x3d,0x01,0x01,0x41,0x3f,0x02,0x80,0x40,0x01,0x03,0x00,0x80,
+0x01,0x02,0x80,0x00,0xa0,0x01,0x81,0x40,0x01,0x02,0x80,0x00,0x3d,0x03,0x00,0x00,
+0xbd,0x03,0x80,0x01,0x3d,0x04,0x00,0x01,0xbd,0x00,0x81,0x41,0x3f,0x02,0x80,0x40,
+0x01,0x03,0x00,0x80,0x01,0x03,0x80,0x01,0x40,0x02,0x80,0x00,0xa1,0x02,0x01,0x40,
+0x01,0x02,0x80,0x00,0x06,0x03,0x00,0x00,0x3d,0x03,0x80,0x00,0xbd,0x04,0x00,0x01,
+0x3d,0x04,0x80,0x02,0x3d,0x05,0x00,0x02,0xbd,0x05,0x80,0x03,0x3d,0x03,0x01,0x81,
+0xbf,0x03,0x80,0xc0,0x01,0x02,0x80,0x41,0x20,0x02,0x80,0x00,0x06,0x03,0x00,0x00,
+0x3d,0x03,0x80,0x00,0xbd,0x04,0x00,0x01,0x3d,0x04,0x80,0x01,0xbd,0x05,0x00,0x02,
+0xbd,0x05,0x80,0x03,0x3d,0x03,0x01,0x81,0xbf,0x03,0x81,0x00,0x01,0x02,0x80,0x41,
+0x20,0x02,0x80,0x00,0x06,0x03,0x00,0x01,0x91,0x03,0x80,0x03,0x40,0x02,0x80,0x80,
+0xa1,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x07,0x00,0x00,0x07,0x61,0x62,0x63,0x5f,
+0x6b,0x65,0x79,0x00,0x00,0x09,0x61,0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,
+0x00,0x07,0x63,0x62,0x61,0x5f,0x6b,0x65,0x79,0x00,0x00,0x09,0x63,0x62,0x61,0x5f,
+0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x03,0x58,0x58,0x58,0x00,0x00,0x07,0x78,0x79,
+0x7a,0x5f,0x6b,0x65,0x79,0x00,0x00,0x09,0x78,0x79,0x7a,0x5f,0x76,0x61,0x6c,0x75,
+0x65,0x00,0x00,0x00,0x04,0x00,0x06,0x6d,0x65,0x72,0x67,0x65,0x21,0x00,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x09,0x54,0x79,
+0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x1e,0x00,0x05,0x00,0x06,
+0x00,0x00,0x00,0x00,0x00,0x02,0x06,0x00,0x00,0x26,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,0x01,0x00,0x04,0x00,0x00,
+0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0xbd,0x00,0x80,0x40,0xbf,
+0x01,0x00,0x01,0x3d,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x03,
+0x00,0x00,0x07,0x61,0x62,0x63,0x5f,0x6b,0x65,0x79,0x00,0x00,0x09,0x61,0x62,0x63,
+0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x01,0x61,0x00,0x00,0x00,0x01,0x00,0x06,
+0x6d,0x65,0x72,0x67,0x65,0x21,0x00,0x00,0x00,0x00,0xfe,0x00,0x03,0x00,0x09,0x00,
+0x02,0x00,0x00,0x00,0x23,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x02,0x80,0x01,
+0x3d,0x03,0x00,0x01,0xbd,0x03,0x80,0x02,0x3d,0x04,0x00,0x02,0xbd,0x00,0x80,0xc1,
+0xbf,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0xbd,0x02,0x80,0x00,0xbd,0x02,0x01,0x01,
+0x37,0x02,0x80,0x40,0x01,0x03,0x00,0x02,0x3d,0x03,0x80,0x00,0x3d,0x02,0x80,0x41,
+0x20,0x01,0x80,0x01,0x20,0x01,0x00,0xc0,0x37,0x01,0xbf,0xff,0x83,0x02,0x41,0xf3,
+0x83,0x01,0x80,0xc0,0xc1,0x02,0x00,0x01,0x40,0x01,0x80,0x80,0x21,0x01,0x80,0x01,
+0x91,0x02,0x00,0x03,0x40,0x01,0x81,0x00,0x21,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,
+0x06,0x02,0x00,0x80,0x01,0x02,0x80,0x40,0x01,0x03,0x01,0x80,0x37,0x03,0x80,0x80,
+0x01,0x03,0x01,0xc0,0x38,0x02,0x80,0x7f,0xa0,0x01,0x80,0x01,0x20,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x06,0x00,0x00,0x03,0x63,0x61,0x74,0x00,0x00,0x06,0x66,0x65,
+0x6c,0x69,0x6e,0x65,0x00,0x00,0x03,0x64,0x6f,0x67,0x00,0x00,0x06,0x63,0x61,0x6e,
+0x69,0x6e,0x65,0x00,0x00,0x03,0x63,0x6f,0x77,0x00,0x00,0x06,0x62,0x6f,0x76,0x69,
+0x6e,0x65,0x00,0x00,0x00,0x05,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x09,0x76,0x61,0x6c,0x75,0x65,0x73,0x5f,0x61,0x74,
+0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,
+0x03,0x6e,0x65,0x77,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
+0x00,0x00,0x07,0x02,0x00,0x00,0x26,0x01,0x80,0x80,0x15,0x02,0x00,0x00,0x3d,0x02,
+0x80,0x40,0x01,0x02,0x01,0x40,0x3e,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x70,0x75,0x73,0x68,
+0x00,0x00,0x00,0x00,0x38,0x00,0x04,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x07,0x04,
+0x00,0x00,0x26,0x02,0x00,0x80,0x01,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x03,
+0x81,0x00,0x01,0x02,0x80,0x01,0x20,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,0x00,0x01,0x5c,0x00,0x03,0x00,
+0x09,0x00,0x01,0x00,0x00,0x00,0x2f,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x02,
+0x80,0x01,0x3d,0x03,0x00,0x01,0xbd,0x03,0x80,0x02,0x3d,0x04,0x00,0x02,0xbd,0x00,
+0x80,0xc1,0xbf,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0xbd,0x02,0x80,0x40,0x01,0x03,
+0x00,0x00,0x3d,0x02,0x80,0x40,0xa0,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x06,0x02,
+0x00,0x03,0x3d,0x02,0x80,0x40,0x01,0x03,0x00,0x03,0xbd,0x03,0x80,0x03,0x3d,0x02,
+0x80,0x41,0x20,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x04,0x3d,0x02,
+0x80,0x40,0x01,0x03,0x00,0x03,0xbd,0x03,0x80,0x01,0x40,0x02,0x80,0x40,0xa1,0x01,
+0x80,0x01,0x20,0x00,0x40,0x02,0x1a,0x01,0x80,0x40,0x01,0x02,0x00,0x04,0xbd,0x01,
+0x80,0x40,0xa0,0x00,0x40,0x06,0x97,0x01,0x80,0x00,0x1b,0x02,0x00,0x01,0x11,0x02,
+0x80,0xc0,0x01,0x02,0x00,0xc0,0xa0,0x02,0x40,0x00,0x98,0x00,0x40,0x03,0x17,0x01,
+0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x11,0x02,0x80,0x80,0x01,0x01,
+0x81,0x01,0x20,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x0a,0x00,0x00,0x03,0x63,0x61,0x74,0x00,0x00,0x06,
+0x66,0x65,0x6c,0x69,0x6e,0x65,0x00,0x00,0x03,0x64,0x6f,0x67,0x00,0x00,0x06,0x63,
+0x61,0x6e,0x69,0x6e,0x65,0x00,0x00,0x03,0x63,0x6f,0x77,0x00,0x00,0x06,0x62,0x6f,
+0x76,0x69,0x6e,0x65,0x00,0x00,0x06,0x6d,0x69,0x63,0x6b,0x65,0x79,0x00,0x00,0x05,
+0x6d,0x6f,0x75,0x73,0x65,0x00,0x00,0x05,0x6d,0x69,0x6e,0x6e,0x79,0x00,0x00,0x03,
+0x67,0x6e,0x75,0x00,0x00,0x00,0x05,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x05,0x66,0x65,0x74,0x63,0x68,0x00,0x00,0x0d,
+0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,
+0x3d,0x3d,0x3d,0x00,0x00,0x0e,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x6b,0x69,0x6e,
+0x64,0x5f,0x6f,0x66,0x00,0x00,0x00,0x00,0x26,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x80,0x00,0x3d,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,
+0x00,0x05,0x6d,0x69,0x6e,0x6e,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xbd,0x00,
+0x07,0x00,0x0f,0x00,0x06,0x00,0x00,0x00,0x5b,0x03,0xc0,0x00,0x03,0x04,0x00,0x00,
+0x3d,0x04,0xc0,0x00,0x83,0x05,0x00,0x00,0x08,0x05,0x80,0x00,0x07,0x06,0x00,0x00,
+0xbd,0x06,0x80,0x01,0x3d,0x07,0x40,0x31,0x03,0x00,0x81,0xc2,0x3f,0x03,0xc0,0x00,
+0x03,0x04,0x00,0x00,0x3d,0x04,0xc0,0x00,0x83,0x05,0x00,0x00,0x08,0x05,0x80,0x00,
+0x07,0x06,0x00,0x00,0xbd,0x01,0x01,0xc1,0xbf,0x03,0xc0,0x00,0x83,0x04,0x00,0x00,
+0x08,0x04,0x80,0x01,0x3d,0x05,0x40,0x31,0x03,0x01,0x81,0xc1,0x3f,0x03,0xc0,0x00,
+0x83,0x04,0x00,0x00,0x08,0x02,0x01,0xc0,0xbf,0x03,0x80,0x40,0x01,0x03,0x80,0x00,
+0x20,0x02,0x81,0xc0,0x01,0x03,0x80,0x00,0x06,0x04,0x01,0x40,0x01,0x04,0x81,0x40,
+0x01,0x05,0x00,0x01,0x40,0x04,0x80,0x80,0x21,0x03,0x80,0x41,0x20,0x03,0x80,0x00,
+0x06,0x04,0x02,0x00,0x3f,0x04,0x81,0x40,0x01,0x05,0x00,0x03,0x40,0x04,0x80,0x80,
+0x21,0x03,0x80,0x41,0x20,0x03,0x80,0x40,0x01,0x03,0x80,0x00,0x20,0x02,0x81,0xc0,
+0x01,0x03,0x80,0x00,0x06,0x04,0x00,0x80,0x01,0x04,0x81,0x40,0x01,0x05,0x00,0x05,
+0x40,0x04,0x80,0x80,0x21,0x03,0x80,0x41,0x20,0x03,0x80,0x00,0x06,0x04,0x00,0x80,
+0x01,0x04,0x81,0x40,0x01,0x03,0x80,0x41,0x20,0x03,0x80,0x40,0x01,0x03,0x80,0x00,
+0x20,0x02,0x81,0xc0,0x01,0x03,0x80,0x00,0x06,0x04,0x00,0xc0,0x01,0x04,0x81,0x40,
+0x01,0x05,0x00,0x07,0x40,0x04,0x80,0x80,0x21,0x03,0x80,0x41,0x20,0x03,0x80,0x00,
+0x06,0x04,0x00,0xc0,0x01,0x04,0x81,0x40,0x01,0x03,0x80,0x41,0x20,0x03,0x80,0x40,
+0x01,0x03,0x80,0x00,0x20,0x02,0x81,0xc0,0x01,0x03,0x80,0x00,0x06,0x04,0x01,0x00,
+0x01,0x04,0x81,0x40,0x01,0x05,0x00,0x09,0x40,0x04,0x80,0x80,0x21,0x03,0x80,0x41,
+0x20,0x03,0x80,0x00,0x06,0x04,0x01,0x00,0x01,0x04,0x81,0x40,0x01,0x03,0x80,0x41,
+0x20,0x03,0x80,0x40,0x01,0x03,0x80,0x00,0x20,0x02,0x81,0xc0,0x01,0x03,0x3f,0xff,
+0x83,0x03,0x81,0x40,0x01,0x04,0x00,0x0b,0x40,0x03,0x80,0x80,0x21,0x03,0x80,0x00,
+0x06,0x04,0x00,0x40,0x01,0x04,0x00,0xc0,0x20,0x04,0x81,0x80,0x01,0x03,0x80,0x41,
+0x20,0x03,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x00,0x00,0x03,0x6f,0x6e,0x65,0x00,
+0x00,0x04,0x74,0x72,0x75,0x65,0x00,0x00,0x03,0x63,0x61,0x74,0x00,0x00,0x00,0x04,
+0x00,0x03,0x64,0x75,0x70,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x09,0x64,0x65,0x6c,0x65,0x74,0x65,0x5f,0x69,0x66,
+0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x08,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x07,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x00,
+0x00,0x05,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x91,0x02,0x00,
+0x00,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,
+0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x6f,0x66,0x3f,0x00,0x00,0x06,0x53,
+0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x00,0x42,0x00,0x04,0x00,0x07,0x00,0x00,
+0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x26,0x02,0x00,0x80,0x01,0x02,0x80,0x00,0x91,
+0x02,0x00,0x00,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x0c,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x6f,0x66,0x3f,0x00,0x00,
+0x06,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x00,0x1e,0x00,0x04,0x00,0x05,
+0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x00,0x00,0x26,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x00,0x03,0x00,0x08,0x00,0x00,
+0x00,0x00,0x00,0x17,0x00,0x08,0x00,0x26,0x01,0x81,0x80,0x15,0x01,0x80,0x00,0xad,
+0x01,0x81,0x80,0x16,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x83,0x02,0x80,0x40,0x01,
+0x02,0x80,0x80,0x20,0x01,0x80,0x41,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x40,0x15,
+0x02,0x80,0x40,0x01,0x03,0x3f,0xff,0x83,0x02,0x80,0xc0,0xa0,0x02,0x00,0xc0,0xa0,
+0x02,0x80,0x40,0x01,0x03,0x40,0x00,0x03,0x02,0x80,0xc0,0xa0,0x01,0x80,0x41,0x20,
+0x01,0x81,0x40,0x15,0x01,0x81,0x00,0x20,0x01,0x80,0x00,0x07,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x01,0x2b,0x00,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x73,0x69,0x7a,
+0x65,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x05,0x73,0x68,0x69,0x66,0x74,0x00,0x00,
+0x00,0x01,0xbf,0x00,0x02,0x00,0x0b,0x00,0x00,0x00,0x00,0x00,0x5f,0x01,0x40,0x00,
+0x03,0x01,0x80,0x00,0x3d,0x02,0x40,0x00,0x83,0x02,0xc0,0x00,0x83,0x03,0x00,0x00,
+0xbd,0x02,0x81,0x41,0x37,0x03,0x40,0x01,0x03,0x03,0xc0,0x01,0x03,0x04,0x00,0x01,
+0x3d,0x04,0x02,0x00,0xb7,0x03,0x81,0xc1,0x37,0x00,0x80,0x81,0xbf,0x01,0x00,0x00,
+0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x00,0x3d,0x02,0xc0,0x00,0x83,0x03,0x40,0x00,
+0x83,0x03,0x80,0x00,0xbd,0x03,0x01,0x81,0x37,0x03,0xc0,0x01,0x03,0x04,0x40,0x01,
+0x03,0x04,0x80,0x01,0x3d,0x04,0x82,0x40,0xb7,0x04,0x02,0x01,0x37,0x01,0x80,0xc3,
+0x37,0x02,0x00,0x40,0x01,0x02,0x00,0x40,0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x00,0x3d,0x01,0x80,0xc1,0x37,0x02,0x40,0x00,
+0x83,0x02,0xc0,0x00,0x83,0x03,0x00,0x00,0xbd,0x02,0x81,0x41,0x37,0x02,0x01,0x01,
+0x37,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x03,0x03,0x80,0x01,0x3d,0x03,0x81,0xc0,
+0xb7,0x03,0x01,0x81,0x37,0x02,0x81,0x41,0x37,0x01,0x80,0xc1,0xb7,0x02,0x00,0x40,
+0x01,0x02,0xbf,0xff,0x83,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x00,0x3d,0x02,0xc0,0x00,0x83,0x03,0x40,0x00,
+0x83,0x03,0x80,0x00,0xbd,0x03,0x01,0x81,0x37,0x03,0xc0,0x01,0x03,0x04,0x40,0x01,
+0x03,0x04,0x80,0x01,0x3d,0x04,0x82,0x40,0xb7,0x04,0x02,0x01,0x37,0x01,0x80,0xc3,
+0x37,0x02,0x00,0x40,0x01,0x02,0xc0,0x00,0x03,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,
+0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x00,0x3d,0x02,0xc0,0x00,
+0x83,0x03,0x40,0x00,0x83,0x03,0x80,0x00,0xbd,0x04,0x40,0x01,0x03,0x04,0xc0,0x01,
+0x03,0x05,0x00,0x01,0x3d,0x05,0x02,0x80,0xb7,0x01,0x80,0xc4,0x37,0x02,0x00,0x40,
+0x01,0x02,0xc0,0x00,0x83,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x00,0x3d,0x02,0xc0,0x00,0x83,0x03,0x40,0x00,
+0x83,0x03,0x80,0x00,0xbd,0x04,0x40,0x01,0x03,0x04,0xc0,0x01,0x03,0x05,0x00,0x01,
+0x3d,0x01,0x80,0xc4,0x37,0x02,0x00,0x40,0x01,0x02,0xc0,0x01,0x03,0x02,0x00,0x40,
+0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x03,0x00,0x00,0x03,
+0x6f,0x6e,0x65,0x00,0x00,0x03,0x74,0x77,0x6f,0x00,0x00,0x05,0x74,0x68,0x72,0x65,
+0x65,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x07,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x00,0x00,0x00,
+0x01,0x6a,0x00,0x02,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x3c,0x01,0x40,0x00,0x03,
+0x01,0x80,0x00,0x3d,0x02,0x40,0x00,0x83,0x02,0x80,0x00,0xbd,0x03,0x40,0x01,0x03,
+0x03,0x80,0x01,0x3d,0x04,0x00,0x00,0x07,0x04,0x80,0x01,0xbd,0x05,0x00,0x00,0x05,
+0x05,0x80,0x02,0x3d,0x01,0x00,0x82,0xbf,0x01,0x00,0x00,0x20,0x00,0x80,0x80,0x01,
+0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x3d,
+0x02,0x00,0x80,0xa0,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x07,
+0x02,0x00,0x40,0x01,0x02,0x80,0x01,0xbd,0x02,0x00,0x80,0xa0,0x01,0x00,0x41,0x20,
+0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x05,0x02,0x00,0x40,0x01,0x02,0x80,0x02,0x3d,
+0x02,0x00,0x80,0xa0,0x01,0x00,0x41,0x20,0x01,0x00,0x02,0xbd,0x01,0xc0,0x00,0x03,
+0x02,0x00,0x03,0x3d,0x02,0xc0,0x00,0x83,0x03,0x00,0x03,0xbd,0x03,0xc0,0x00,0x03,
+0x01,0x00,0x81,0xbf,0x01,0x00,0x00,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,
+0x01,0xc0,0x00,0x83,0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,0x01,0x00,0x41,0x20,
+0x01,0x00,0x00,0x06,0x01,0x80,0x02,0xbd,0x02,0x00,0x03,0xbd,0x01,0x80,0xc1,0x37,
+0x02,0x00,0x40,0x01,0x02,0xc0,0x00,0x03,0x02,0x00,0x80,0xa0,0x01,0x01,0x01,0x20,
+0x01,0x00,0x00,0x06,0x01,0x80,0x03,0x3d,0x02,0x00,0x40,0x01,0x02,0xc0,0x00,0x83,
+0x02,0x00,0x80,0xa0,0x01,0x00,0x41,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x08,
+0x00,0x00,0x03,0x6f,0x6e,0x65,0x00,0x00,0x03,0x74,0x77,0x6f,0x00,0x00,0x05,0x74,
+0x68,0x72,0x65,0x65,0x00,0x00,0x04,0x74,0x72,0x75,0x65,0x00,0x00,0x03,0x6e,0x69,
+0x6c,0x00,0x00,0x01,0x61,0x00,0x00,0x01,0x62,0x00,0x00,0x01,0x63,0x00,0x00,0x00,
+0x05,0x00,0x06,0x69,0x6e,0x76,0x65,0x72,0x74,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x06,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x0e,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x00,0x00,0xc3,0x00,0x02,0x00,0x09,
+0x00,0x02,0x00,0x00,0x00,0x25,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,
+0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x03,0xc0,0x02,0x83,0x00,0x80,
+0x81,0xbf,0x01,0x00,0x00,0x06,0x01,0xc0,0x01,0x03,0x02,0x40,0x01,0x83,0x02,0xc0,
+0x02,0x03,0x03,0x40,0x02,0x83,0x01,0x80,0xc1,0x3f,0x02,0x00,0x40,0x01,0x02,0x80,
+0x01,0x40,0x02,0x00,0x40,0x21,0x01,0x00,0x01,0x20,0x01,0x40,0x00,0x03,0x01,0xc0,
+0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x03,0xc0,
+0x02,0x83,0x00,0x80,0x81,0xbf,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,
+0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x04,0x40,
+0x02,0x83,0x01,0x80,0xc1,0xbf,0x02,0x00,0x40,0x01,0x02,0x80,0x03,0x40,0x02,0x00,
+0x40,0x21,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x07,0x6b,0x65,0x65,0x70,0x5f,0x69,0x66,0x00,0x00,0x00,0x00,0x3b,0x00,
+0x04,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,0x02,0x00,0x40,
+0x01,0x02,0x80,0x80,0x01,0x02,0x00,0x00,0xac,0x02,0xc0,0x03,0x03,0x02,0x00,0x40,
+0xb6,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x2b,
+0x00,0x00,0x02,0x3e,0x3d,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x07,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf6,0x00,0x02,0x00,0x0e,0x00,0x00,0x00,0x00,
+0x00,0x2a,0x01,0x00,0x00,0x3d,0x01,0xc0,0x31,0x83,0x02,0x00,0x00,0xbd,0x02,0xc0,
+0x63,0x83,0x03,0x00,0x01,0x3d,0x03,0xc0,0x95,0x83,0x04,0x00,0x01,0xbd,0x04,0xc0,
+0x95,0x83,0x05,0x00,0x00,0x05,0x05,0x80,0x02,0x3d,0x06,0x00,0x02,0x3d,0x06,0x80,
+0x00,0x05,0x00,0x80,0x83,0x3f,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0xbd,0x02,0x00,
+0x40,0x01,0x02,0xc0,0x63,0x83,0x02,0x00,0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,
+0x00,0x06,0x01,0x80,0x01,0x3d,0x02,0x00,0x40,0x01,0x02,0xc0,0x95,0x83,0x02,0x00,
+0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x02,0x41,
+0xf3,0x03,0x01,0x80,0x40,0xa0,0x01,0x00,0x80,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,
+0x40,0x01,0x02,0x00,0x02,0x3d,0x01,0x80,0x40,0xa0,0x01,0x00,0x80,0xa0,0x01,0x00,
+0x00,0x06,0x01,0x80,0x02,0x3d,0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x05,0x02,0x00,
+0x40,0xa0,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x05,0x00,0x00,
+0x01,0x61,0x00,0x00,0x01,0x62,0x00,0x00,0x01,0x63,0x00,0x00,0x01,0x64,0x00,0x00,
+0x03,0x6e,0x69,0x6c,0x00,0x00,0x00,0x03,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x03,0x6b,0x65,0x79,0x00,0x00,0x0a,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x6e,0x69,0x6c,0x00,0x00,0x00,0x00,0xa2,0x00,0x01,
+0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x17,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,
+0x01,0x80,0x00,0xbd,0x01,0x00,0x80,0x41,0x01,0x80,0x01,0x3d,0x01,0x00,0x40,0xa0,
+0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,
+0x01,0x00,0x80,0x41,0x01,0x80,0x01,0xbd,0x01,0x00,0x40,0xa0,0x01,0x00,0x80,0x20,
+0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,
+0x01,0x00,0x80,0x41,0x01,0x80,0x02,0x3d,0x01,0x00,0x40,0xa0,0x00,0x80,0x00,0xa0,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x05,0x00,0x00,0x01,0x61,0x00,0x00,0x01,0x7a,
+0x00,0x00,0x01,0x63,0x00,0x00,0x01,0x35,0x00,0x00,0x02,0x63,0x63,0x00,0x00,0x00,
+0x03,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,
+0x06,0x63,0x6f,0x76,0x65,0x72,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x79,
+0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x80,0x00,0x06,0x01,0x40,
+0x04,0x83,0x01,0xc0,0x04,0x83,0x02,0x40,0x09,0x83,0x01,0x80,0xc0,0x41,0x01,0x80,
+0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x04,0x83,0x01,0xc0,
+0x05,0x03,0x02,0x40,0x05,0x83,0x01,0x00,0x81,0xb7,0x01,0xc0,0x04,0x83,0x02,0x40,
+0x09,0x83,0x01,0x80,0xc0,0x41,0x02,0x40,0x01,0x03,0x01,0x80,0x40,0xa0,0x00,0x80,
+0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x05,0x66,
+0x69,0x72,0x73,0x74,0x00,0x00,0x00,0x00,0xc0,0x00,0x01,0x00,0x06,0x00,0x00,0x00,
+0x00,0x00,0x25,0x00,0x80,0x00,0x06,0x01,0x40,0x09,0x83,0x01,0xc0,0x04,0x83,0x02,
+0x40,0x09,0x83,0x01,0x80,0xc0,0x41,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,
+0x80,0x00,0x06,0x01,0x40,0x09,0x83,0x01,0xc0,0x04,0x83,0x02,0x40,0x09,0x83,0x01,
+0x80,0xc0,0xc1,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,
+0x40,0x08,0x83,0x01,0xc0,0x09,0x03,0x02,0x40,0x09,0x83,0x01,0x00,0x81,0xb7,0x01,
+0xc0,0x04,0x83,0x02,0x40,0x09,0x83,0x01,0x80,0xc0,0x41,0x02,0x40,0x01,0x03,0x01,
+0x80,0x40,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x08,0x03,0x01,
+0xc0,0x08,0x83,0x02,0x40,0x09,0x03,0x01,0x00,0x81,0xb7,0x01,0xc0,0x04,0x83,0x02,
+0x40,0x09,0x83,0x01,0x80,0xc0,0xc1,0x02,0x40,0x01,0x03,0x01,0x80,0x40,0xa0,0x00,
+0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x04,
+0x6c,0x61,0x73,0x74,0x00,0x00,0x00,0x00,0x5a,0x00,0x01,0x00,0x06,0x00,0x00,0x00,
+0x00,0x00,0x08,0x00,0x80,0x00,0x06,0x01,0x40,0x02,0x03,0x01,0x80,0x00,0x84,0x01,
+0x80,0x80,0x20,0x02,0x3f,0xfd,0x03,0x01,0x80,0xc0,0xa0,0x00,0x80,0x01,0x20,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0c,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x03,0x61,0x62,0x73,0x00,
+0x00,0x07,0x74,0x6f,0x5f,0x70,0x72,0x6f,0x63,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,
+0x00,0x00,0xc6,0x00,0x03,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x11,0x01,0x80,0x00,
+0x04,0x02,0x00,0x00,0x84,0x02,0x80,0x01,0x04,0x01,0x80,0xc1,0xb7,0x01,0x80,0xc0,
+0x20,0x00,0x80,0xc0,0x01,0x01,0x80,0x02,0x11,0x01,0x81,0x40,0x20,0x02,0x00,0x01,
+0x40,0x01,0x81,0x80,0x21,0x01,0x80,0xc0,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,
+0x06,0x02,0x00,0x40,0x01,0x02,0x80,0x80,0x01,0x01,0x81,0xc1,0x20,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0f,0x5f,0x5f,0x73,0x79,0x6d,
+0x62,0x6f,0x6c,0x5f,0x74,0x65,0x73,0x74,0x5f,0x31,0x00,0x00,0x0f,0x5f,0x5f,0x73,
+0x79,0x6d,0x62,0x6f,0x6c,0x5f,0x74,0x65,0x73,0x74,0x5f,0x32,0x00,0x00,0x0f,0x5f,
+0x5f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x5f,0x74,0x65,0x73,0x74,0x5f,0x33,0x00,0x00,
+0x04,0x73,0x6f,0x72,0x74,0x00,0x00,0x06,0x53,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,
+0x0b,0x61,0x6c,0x6c,0x5f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x73,0x00,0x00,0x06,0x73,
+0x65,0x6c,0x65,0x63,0x74,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x50,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
+0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x02,
+0x00,0x00,0x3d,0x01,0x80,0x40,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,
+0x00,0x0d,0x5f,0x5f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x5f,0x74,0x65,0x73,0x74,0x00,
+0x00,0x00,0x02,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x08,0x69,0x6e,0x63,0x6c,
+0x75,0x64,0x65,0x3f,0x00,0x00,0x00,0x00,0x71,0x00,0x01,0x00,0x05,0x00,0x00,0x00,
+0x00,0x00,0x0b,0x00,0x80,0x00,0x06,0x01,0x40,0x02,0x03,0x01,0x80,0x00,0x84,0x01,
+0x80,0x80,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x02,0x03,0x01,
+0x80,0x01,0x84,0x01,0x81,0x00,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x05,0x68,0x65,0x6c,0x6c,0x6f,0x00,0x00,0x04,
+0x73,0x69,0x7a,0x65,0x00,0x00,0x05,0x6d,0x72,0x75,0x62,0x79,0x00,0x00,0x06,0x6c,
+0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x00,0x00,0x76,0x00,0x01,0x00,0x05,0x00,0x00,
+0x00,0x00,0x00,0x0b,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x84,0x01,0x80,0x01,0x04,
+0x01,0x80,0xc0,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x84,
+0x01,0x80,0x02,0x04,0x01,0x80,0xc0,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x05,0x48,0x65,0x6c,0x6c,0x6f,0x00,0x00,
+0x05,0x68,0x65,0x6c,0x6c,0x6f,0x00,0x00,0x0a,0x63,0x61,0x70,0x69,0x74,0x61,0x6c,
+0x69,0x7a,0x65,0x00,0x00,0x05,0x48,0x45,0x4c,0x4c,0x4f,0x00,0x00,0x00,0x00,0x58,
+0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x01,0x00,
+0x00,0x84,0x01,0x80,0x01,0x04,0x01,0x80,0xc0,0x20,0x00,0x80,0x01,0x20,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0c,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x05,0x68,0x65,0x6c,0x6c,0x6f,
+0x00,0x00,0x05,0x68,0x45,0x6c,0x6c,0x4f,0x00,0x00,0x08,0x64,0x6f,0x77,0x6e,0x63,
+0x61,0x73,0x65,0x00,0x00,0x00,0x00,0x56,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,
+0x00,0x06,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x84,0x01,0x80,0x01,0x04,0x01,0x80,
+0xc0,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x05,0x48,0x45,0x4c,0x4c,0x4f,0x00,0x00,0x05,0x68,0x45,0x6c,0x6c,0x4f,
+0x00,0x00,0x06,0x75,0x70,0x63,0x61,0x73,0x65,0x00,0x00,0x00,0x00,0xc4,0x00,0x01,
+0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x80,0x00,0x06,0x01,0x3f,0xff,0x83,
+0x01,0x80,0x00,0x84,0x02,0x00,0x01,0x84,0x01,0x80,0x80,0xa0,0x00,0x80,0x01,0x20,
+0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,0x01,0x80,0x00,0x84,0x02,0x00,0x02,0x04,
+0x01,0x80,0x80,0xa0,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x3f,0xff,0x03,
+0x01,0x80,0x00,0x84,0x02,0x00,0x02,0x84,0x01,0x80,0x80,0xa0,0x00,0x80,0x01,0x20,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x84,0x01,0x80,0x00,0x3d,0x01,0x00,0x80,0xa0,
+0x00,0x81,0x80,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x05,0x68,
+0x45,0x6c,0x6c,0x4f,0x00,0x00,0x00,0x07,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x05,0x48,0x45,0x4c,0x4c,0x4f,0x00,0x00,
+0x07,0x63,0x61,0x73,0x65,0x63,0x6d,0x70,0x00,0x00,0x05,0x68,0x45,0x6c,0x6c,0x4f,
+0x00,0x00,0x05,0x68,0x45,0x6c,0x6c,0x4e,0x00,0x00,0x05,0x68,0x45,0x6c,0x6c,0x50,
+0x00,0x00,0x0a,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x6e,0x69,0x6c,0x00,0x00,0x00,
+0x00,0x44,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x06,
+0x01,0x00,0x00,0x84,0x01,0x00,0x80,0x20,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x00,0x00,0x00,0x06,0x65,0x6d,0x70,0x74,0x79,
+0x3f,0x00,0x00,0x00,0x00,0x69,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0e,
+0x01,0x80,0x00,0x11,0x02,0x40,0x3d,0x03,0x01,0x80,0x40,0xa0,0x00,0x80,0xc0,0x01,
+0x01,0x80,0x00,0x11,0x02,0x40,0x3d,0x03,0x01,0x80,0x40,0xa0,0x01,0x00,0xc0,0x01,
+0x01,0x80,0x40,0x01,0x01,0x80,0x80,0x20,0x02,0x00,0x80,0x01,0x02,0x00,0x80,0x20,
+0x01,0x80,0xc0,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x06,0x52,0x61,0x6e,0x64,0x6f,0x6d,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x04,0x72,0x61,0x6e,0x64,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x6a,0x00,
+0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x10,0x01,0x80,0x00,0x06,0x02,0x40,0x74,
+0x83,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x06,0x01,0x80,0x40,0x20,0x00,0x80,0xc0,
+0x01,0x01,0x80,0x00,0x06,0x02,0x40,0x74,0x83,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,
+0x06,0x01,0x80,0x40,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x00,0x80,
+0x01,0x01,0x80,0x80,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x05,0x73,0x72,0x61,0x6e,0x64,0x00,0x00,0x04,0x72,0x61,0x6e,0x64,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x73,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
+0x00,0x00,0x10,0x01,0x80,0x00,0x11,0x02,0x40,0xac,0x03,0x01,0x80,0x40,0xa0,0x01,
+0x80,0x00,0x06,0x01,0x80,0x80,0x20,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,
+0x40,0xac,0x03,0x01,0x80,0x40,0xa0,0x01,0x80,0x00,0x11,0x01,0x80,0x80,0x20,0x01,
+0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x00,0x80,0x01,0x01,0x80,0xc0,0xb2,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x06,0x52,0x61,0x6e,
+0x64,0x6f,0x6d,0x00,0x00,0x05,0x73,0x72,0x61,0x6e,0x64,0x00,0x00,0x04,0x72,0x61,
+0x6e,0x64,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4f,0x00,0x01,0x00,0x04,
+0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x06,0x01,0x40,0x01,0x03,0x00,0x80,
+0x00,0xa0,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x72,0x61,0x6e,0x64,
+0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,
+0x46,0x69,0x78,0x6e,0x75,0x6d,0x00,0x00,0x00,0x00,0x4a,0x00,0x01,0x00,0x04,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x00,0x80,0x40,
+0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x72,0x61,0x6e,0x64,0x00,0x00,0x05,0x63,0x6c,
+0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x46,0x6c,0x6f,0x61,0x74,
+0x00,0x00,0x00,0x00,0xc2,0x00,0x03,0x00,0x0e,0x00,0x01,0x00,0x00,0x00,0x24,0x01,
+0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,
+0xc0,0x02,0x03,0x04,0x40,0x02,0x83,0x04,0xc0,0x03,0x03,0x05,0x40,0x03,0x83,0x05,
+0xc0,0x04,0x03,0x06,0x40,0x04,0x83,0x00,0x80,0xc5,0x37,0x01,0x80,0x40,0x01,0x01,
+0x80,0x00,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,0x02,
+0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x03,0xc0,0x01,0x83,0x04,0x40,0x02,0x03,0x04,
+0xc0,0x02,0x83,0x05,0x40,0x03,0x03,0x05,0xc0,0x03,0x83,0x06,0x40,0x04,0x03,0x06,
+0xc0,0x04,0x83,0x02,0x01,0x05,0x37,0x01,0x80,0x40,0xb2,0x01,0xc0,0x01,0x99,0x01,
+0x80,0x80,0x01,0x02,0x00,0x40,0x01,0x01,0x80,0x80,0xa0,0x01,0xc0,0x01,0x99,0x01,
+0xc0,0x04,0x83,0x02,0x00,0x01,0x40,0x01,0x80,0xc0,0x21,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x07,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,0x05,0x74,0x69,0x6d,
+0x65,0x73,0x00,0x00,0x00,0x00,0x35,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,
+0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,
+0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x08,0x69,
+0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x00,0x00,0xaa,0x00,0x02,0x00,0x0d,
+0x00,0x01,0x00,0x00,0x00,0x1f,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,
+0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x03,0xc0,0x02,0x83,0x04,0x40,
+0x03,0x03,0x04,0xc0,0x03,0x83,0x05,0x40,0x04,0x03,0x05,0xc0,0x04,0x83,0x00,0x80,
+0x85,0x37,0x01,0x00,0x40,0x01,0x01,0x00,0x00,0x20,0x01,0x00,0x40,0x01,0x01,0xc0,
+0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,
+0x02,0x03,0x04,0x40,0x02,0x83,0x04,0xc0,0x03,0x03,0x05,0x40,0x03,0x83,0x05,0xc0,
+0x04,0x03,0x06,0x40,0x04,0x83,0x01,0x80,0xc5,0x37,0x01,0x00,0x40,0xa0,0x01,0x40,
+0x01,0x99,0x01,0x40,0x04,0x83,0x01,0x80,0x01,0x40,0x01,0x00,0x80,0x21,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x08,0x73,0x68,0x75,0x66,
+0x66,0x6c,0x65,0x21,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,0x05,0x74,0x69,0x6d,0x65,
+0x73,0x00,0x00,0x00,0x00,0x35,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,
+0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x08,0x69,0x6e,
+0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x00,0x01,0x24,0x00,0x05,0x00,0x0f,0x00,
+0x02,0x00,0x00,0x00,0x32,0x02,0x80,0x00,0x06,0x03,0x00,0x00,0x91,0x03,0x80,0x01,
+0x40,0x02,0x80,0x00,0xa1,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,
+0x03,0x04,0x40,0x01,0x83,0x04,0xc0,0x02,0x03,0x05,0x40,0x02,0x83,0x05,0xc0,0x03,
+0x03,0x06,0x40,0x03,0x83,0x06,0xc0,0x04,0x03,0x07,0x40,0x04,0x83,0x00,0x81,0x45,
+0x37,0x02,0x80,0x40,0x01,0x03,0x00,0x01,0x91,0x03,0xc0,0xac,0x03,0x03,0x01,0x00,
+0xa0,0x02,0x80,0x80,0xa0,0x01,0x01,0x40,0x01,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,
+0x83,0x03,0xc0,0x01,0x03,0x04,0x40,0x01,0x83,0x04,0xc0,0x02,0x03,0x05,0x40,0x02,
+0x83,0x05,0xc0,0x03,0x03,0x06,0x40,0x03,0x83,0x06,0xc0,0x04,0x03,0x07,0x40,0x04,
+0x83,0x01,0x81,0x45,0x37,0x02,0x80,0xc0,0x01,0x03,0x00,0x01,0x91,0x03,0xc0,0xac,
+0x03,0x03,0x01,0x00,0xa0,0x02,0x80,0x80,0xa0,0x02,0x01,0x40,0x01,0x02,0x80,0x40,
+0x01,0x03,0x00,0x80,0x01,0x02,0x81,0x40,0xa0,0x02,0xc0,0x01,0x99,0x02,0xc0,0x04,
+0x83,0x03,0x00,0x03,0x40,0x02,0x81,0x80,0x21,0x02,0xc0,0x01,0x99,0x02,0x80,0x80,
+0x01,0x03,0x01,0x00,0x01,0x02,0x81,0xc0,0xb2,0x02,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x08,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,
+0x69,0x73,0x65,0x00,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,
+0x00,0x07,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x00,0x00,0x06,0x52,0x61,0x6e,0x64,
+0x6f,0x6d,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,0x05,
+0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x50,0x00,
+0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0xc0,0x00,0x03,0x01,0x40,0x00,
+0x83,0x00,0x80,0x41,0x37,0x01,0x00,0x00,0x3d,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x15,0x4e,0x6f,0x74,0x20,0x61,0x20,0x52,0x61,
+0x6e,0x64,0x6f,0x6d,0x20,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,0x00,0x00,
+0x01,0x00,0x07,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x00,0x00,0x00,0x00,0x35,0x00,
+0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x80,
+0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,
+0x00,0x00,0x01,0x45,0x00,0x03,0x00,0x0e,0x00,0x02,0x00,0x00,0x00,0x3a,0x01,0x80,
+0x00,0x06,0x02,0x00,0x00,0x91,0x02,0x80,0x01,0x40,0x01,0x80,0x00,0xa1,0x01,0xc0,
+0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,
+0x02,0x03,0x04,0x40,0x02,0x83,0x04,0xc0,0x03,0x03,0x05,0x40,0x03,0x83,0x05,0xc0,
+0x04,0x03,0x06,0x40,0x04,0x83,0x00,0x80,0xc5,0x37,0x01,0x80,0x40,0x01,0x02,0x00,
+0x01,0x91,0x02,0xc0,0xac,0x03,0x02,0x01,0x00,0xa0,0x01,0x80,0x80,0xa0,0x01,0xc0,
+0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,
+0x02,0x03,0x04,0x40,0x02,0x83,0x04,0xc0,0x03,0x03,0x05,0x40,0x03,0x83,0x05,0xc0,
+0x04,0x03,0x06,0x40,0x04,0x83,0x01,0x00,0xc5,0x37,0x01,0x80,0x80,0x01,0x02,0x00,
+0x01,0x91,0x02,0xc0,0xac,0x03,0x02,0x01,0x00,0xa0,0x01,0x80,0x80,0xa0,0x01,0x80,
+0x40,0x01,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x03,0xc0,
+0x01,0x83,0x04,0x40,0x02,0x03,0x04,0xc0,0x02,0x83,0x05,0x40,0x03,0x03,0x05,0xc0,
+0x03,0x83,0x06,0x40,0x04,0x03,0x06,0xc0,0x04,0x83,0x02,0x01,0x05,0x37,0x01,0x81,
+0x40,0xa0,0x01,0xc0,0x01,0x99,0x01,0xc0,0x04,0x83,0x02,0x00,0x03,0x40,0x01,0x81,
+0x80,0x21,0x01,0xc0,0x01,0x99,0x01,0x80,0x40,0x01,0x02,0x00,0x80,0x01,0x01,0x81,
+0xc0,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x09,0x54,
+0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x08,0x73,0x68,0x75,0x66,0x66,
+0x6c,0x65,0x21,0x00,0x00,0x06,0x52,0x61,0x6e,0x64,0x6f,0x6d,0x00,0x00,0x03,0x6e,
+0x65,0x77,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x51,0x00,0x01,0x00,0x04,0x00,0x00,0x00,
+0x00,0x00,0x06,0x00,0xc0,0x00,0x03,0x01,0x40,0x00,0x83,0x00,0x80,0x41,0x37,0x01,
+0x00,0x00,0x3d,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,
+0x00,0x15,0x4e,0x6f,0x74,0x20,0x61,0x20,0x52,0x61,0x6e,0x64,0x6f,0x6d,0x20,0x69,
+0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,0x00,0x00,0x01,0x00,0x08,0x73,0x68,0x75,
+0x66,0x66,0x6c,0x65,0x21,0x00,0x00,0x00,0x00,0x35,0x00,0x03,0x00,0x06,0x00,0x00,
+0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,
+0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x00,0x00,0x89,0x00,
+0x02,0x00,0x07,0x00,0x02,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,0x05,0x01,0x80,0x00,
+0x05,0x01,0x00,0x00,0x43,0x01,0x00,0x00,0x45,0x01,0x00,0x00,0x11,0x01,0x00,0x40,
+0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,0xc0,0x33,0x83,0x02,0x00,0x40,
+0x01,0x02,0xc0,0x02,0x03,0x03,0x00,0x03,0x40,0x02,0x00,0xc0,0xa1,0x01,0x00,0x81,
+0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0f,0x4b,
+0x6c,0x61,0x73,0x73,0x57,0x69,0x74,0x68,0x53,0x65,0x63,0x72,0x65,0x74,0x00,0x00,
+0x03,0x6e,0x65,0x77,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x0d,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x65,
+0x78,0x65,0x63,0x00,0x00,0x00,0x00,0x37,0x00,0x01,0x00,0x03,0x00,0x01,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x00,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,
+0x00,0x04,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0a,
+0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x30,0x00,
+0x02,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x26,0x01,0x40,0x31,
+0x03,0x01,0x00,0x00,0x0e,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x07,0x40,0x73,0x65,0x63,0x72,0x65,0x74,0x00,0x00,0x00,0x00,0x38,0x00,
+0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x00,
+0x0d,0x02,0x00,0x40,0x01,0x01,0x80,0x40,0xac,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x40,0x73,0x65,0x63,0x72,0x65,0x74,0x00,0x00,
+0x01,0x2b,0x00,0x00,0x00,0x01,0x59,0x00,0x02,0x00,0x07,0x00,0x07,0x00,0x00,0x00,
+0x22,0x00,0x80,0x80,0x37,0x01,0x40,0x00,0x03,0x01,0xc0,0x04,0x83,0x01,0x00,0x80,
+0x41,0x01,0x80,0x01,0x40,0x01,0x00,0x00,0x21,0x01,0x00,0x40,0x20,0x01,0x80,0x03,
+0x40,0x01,0x00,0x00,0x21,0x01,0x80,0x05,0x40,0x01,0x00,0x80,0x21,0x01,0x80,0x07,
+0x40,0x01,0x00,0x00,0x21,0x01,0x80,0x09,0x40,0x01,0x00,0xc0,0x21,0x01,0x80,0x0b,
+0x40,0x01,0x00,0x00,0x21,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,
+0xbd,0x02,0x80,0x01,0x3d,0x03,0x00,0x01,0xbd,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,
+0x01,0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x02,0x84,0x02,0x00,0x03,
+0x11,0x02,0x80,0x0d,0x40,0x02,0x01,0xc0,0x21,0x02,0x01,0xc0,0x20,0x02,0x02,0x00,
+0x20,0x01,0x01,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x04,0x00,0x00,0x0f,
+0x6f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x3a,0x20,0x31,0x2e,0x2e,0x31,0x30,0x00,
+0x00,0x26,0x61,0x72,0x72,0x61,0x79,0x3a,0x20,0x5b,0x31,0x2c,0x20,0x32,0x2c,0x20,
+0x33,0x2c,0x20,0x34,0x2c,0x20,0x35,0x2c,0x20,0x36,0x2c,0x20,0x37,0x2c,0x20,0x38,
+0x2c,0x20,0x39,0x2c,0x20,0x31,0x30,0x5d,0x00,0x00,0x17,0x65,0x76,0x65,0x6e,0x73,
+0x3a,0x20,0x5b,0x32,0x2c,0x20,0x34,0x2c,0x20,0x36,0x2c,0x20,0x38,0x2c,0x20,0x31,
+0x30,0x5d,0x00,0x00,0x1d,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x3a,0x20,0x5b,0x34,
+0x2c,0x20,0x31,0x36,0x2c,0x20,0x33,0x36,0x2c,0x20,0x36,0x34,0x2c,0x20,0x31,0x30,
+0x30,0x5d,0x00,0x00,0x00,0x09,0x00,0x03,0x74,0x61,0x70,0x00,0x00,0x04,0x74,0x6f,
+0x5f,0x61,0x00,0x00,0x06,0x73,0x65,0x6c,0x65,0x63,0x74,0x00,0x00,0x03,0x6d,0x61,
+0x70,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x06,0x74,0x61,0x70,0x5f,0x6f,0x6b,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x01,0x6d,0x00,0x00,0x00,0x00,0x55,
+0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x08,0x02,0x00,0x00,0x26,0x01,0x80,
+0x40,0x15,0x02,0x00,0x00,0x3d,0x02,0x80,0x40,0x01,0x02,0x80,0x40,0x20,0x02,0x01,
+0x40,0x3e,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,
+0x0a,0x6f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x3a,0x20,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,
+0x00,0x00,0x00,0x00,0x52,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x08,0x02,
+0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x00,0x3d,0x02,0x80,0x40,0x01,0x02,
+0x80,0x40,0x20,0x02,0x01,0x40,0x3e,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x02,0x00,0x00,0x07,0x61,0x72,0x72,0x61,0x79,0x3a,0x20,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,
+0x63,0x74,0x00,0x00,0x00,0x00,0x3b,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,
+0x07,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x00,
+0xa0,0x02,0x3f,0xff,0x83,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x25,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x52,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x08,0x02,0x00,0x00,0x26,
+0x01,0x80,0x40,0x15,0x02,0x00,0x00,0x3d,0x02,0x80,0x40,0x01,0x02,0x80,0x40,0x20,
+0x02,0x01,0x40,0x3e,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,
+0x00,0x00,0x07,0x65,0x76,0x65,0x6e,0x73,0x3a,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,0x00,
+0x00,0x00,0x00,0x2e,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,
+0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xb0,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2a,0x00,0x00,0x00,
+0x00,0x54,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x08,0x02,0x00,0x00,0x26,
+0x01,0x80,0x40,0x15,0x02,0x00,0x00,0x3d,0x02,0x80,0x40,0x01,0x02,0x80,0x40,0x20,
+0x02,0x01,0x40,0x3e,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,
+0x00,0x00,0x09,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x3a,0x20,0x00,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,
+0x74,0x00,0x00,0x00,0x00,0x2e,0x00,0x01,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x05,
+0x00,0x80,0x00,0x48,0x01,0x00,0x00,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x04,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x6d,0x00,
+0x00,0x00,0x00,0x30,0x00,0x02,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x26,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x40,0x01,0x00,0x00,0x21,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x03,0x74,0x61,0x70,0x00,
+0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x80,
+0x00,0x04,0x00,0x80,0x80,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,
+0x74,0x61,0x70,0x5f,0x6f,0x6b,0x00,0x00,0x00,0x00,0x44,0x00,0x01,0x00,0x05,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x01,0x00,0x80,0x37,0x01,0x80,0x00,
+0x05,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x04,0x74,0x6f,0x5f,0x61,0x00,0x00,0x00,0x00,0x5d,0x00,
+0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x01,0x00,0x00,
+0x02,0x01,0x80,0x00,0x05,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x01,0x02,0x00,0x16,0x30,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,
+0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x04,0x74,0x6f,0x5f,0x66,0x00,0x00,0x00,0x00,0x44,0x00,0x01,0x00,0x05,
+0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x01,0x3f,0xff,0x83,0x01,0x80,
+0x00,0x05,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x74,0x6f,0x5f,0x69,0x00,0x00,0x00,0x00,0x50,
+0x00,0x02,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x26,0x01,0x00,
+0x00,0x11,0x01,0x80,0x00,0x3d,0x02,0x40,0x00,0x83,0x01,0x80,0x80,0xb0,0x01,0x00,
+0x40,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x07,0x67,0x61,0x72,
+0x62,0x61,0x67,0x65,0x00,0x00,0x00,0x03,0x00,0x07,0x57,0x65,0x61,0x6b,0x52,0x65,
+0x66,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x00,0xec,
+0x00,0x07,0x00,0x0b,0x00,0x01,0x00,0x00,0x00,0x1f,0x02,0x00,0x00,0x26,0x00,0x00,
+0x00,0x1e,0x03,0x80,0x00,0x11,0x03,0x80,0x40,0x20,0x01,0x81,0xc0,0x01,0x03,0x80,
+0x40,0x01,0x04,0x00,0x00,0x11,0x04,0x81,0xc0,0x01,0x04,0x00,0x80,0xa0,0x03,0x80,
+0x00,0x06,0x03,0x80,0xc0,0x20,0x02,0x01,0xc0,0x01,0x03,0x80,0x00,0x11,0x04,0x00,
+0x02,0x84,0x03,0x81,0x00,0xa0,0x02,0x81,0xc0,0x01,0x03,0x3f,0xff,0x83,0x00,0x40,
+0x01,0x97,0x03,0x81,0x80,0x01,0x03,0x81,0x80,0xad,0x03,0x01,0xc0,0x01,0x03,0x80,
+0x00,0x11,0x04,0x00,0x02,0x84,0x03,0x81,0x00,0xa0,0x04,0x01,0x40,0x01,0x04,0x01,
+0x81,0x2d,0x03,0x81,0xc0,0xb3,0x03,0xbf,0xfb,0x18,0x03,0x81,0x00,0x01,0x00,0x80,
+0x00,0x1f,0x03,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x02,
+0x47,0x43,0x00,0x00,0x11,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x61,
+0x6c,0x5f,0x6d,0x6f,0x64,0x65,0x00,0x00,0x12,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,
+0x69,0x6f,0x6e,0x61,0x6c,0x5f,0x6d,0x6f,0x64,0x65,0x3d,0x00,0x00,0x12,0x77,0x65,
+0x61,0x6b,0x72,0x65,0x66,0x5f,0x74,0x6f,0x5f,0x67,0x61,0x72,0x62,0x61,0x67,0x65,
+0x00,0x00,0x04,0x73,0x74,0x61,0x74,0x00,0x00,0x05,0x63,0x6f,0x75,0x6e,0x74,0x00,
+0x00,0x01,0x2b,0x00,0x00,0x01,0x3c,0x00,0x00,0x00,0x00,0x44,0x00,0x01,0x00,0x05,
+0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x80,0xc0,0x15,0x01,0x00,0x00,0x11,0x01,0x80,
+0x40,0x01,0x01,0x00,0x40,0xa0,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x02,0x47,0x43,0x00,0x00,0x12,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,
+0x69,0x6f,0x6e,0x61,0x6c,0x5f,0x6d,0x6f,0x64,0x65,0x3d,0x00,0x00,0x00,0x01,0x3d,
+0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x2b,0x00,0x80,0x00,0x3d,0x01,0x80,
+0x00,0x11,0x02,0x00,0x40,0x01,0x01,0x80,0x40,0xa0,0x01,0x00,0xc0,0x01,0x01,0x80,
+0x00,0x06,0x02,0x00,0x80,0x01,0x02,0x00,0xc0,0x20,0x01,0x80,0x80,0xa0,0x01,0x80,
+0x00,0x06,0x02,0x00,0x80,0x01,0x02,0x01,0x00,0x20,0x02,0x80,0x40,0x01,0x02,0x01,
+0x40,0xa0,0x01,0x80,0x80,0xa0,0x01,0x80,0x00,0x06,0x02,0x40,0x02,0x03,0x02,0x80,
+0x80,0x01,0x02,0x81,0xc0,0x20,0x01,0x81,0x81,0x20,0x01,0x80,0x00,0x06,0x02,0x00,
+0x00,0xbd,0x02,0x80,0x80,0x01,0x02,0x82,0x00,0x20,0x01,0x81,0x81,0x20,0x01,0x80,
+0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x02,0x01,0x01,0x37,0x02,0x80,
+0x00,0x11,0x03,0x40,0x00,0x83,0x03,0xc0,0x00,0x03,0x03,0x01,0x81,0x37,0x02,0x80,
+0x40,0xa0,0x02,0x82,0x40,0x20,0x01,0x81,0x81,0x20,0x01,0x80,0x00,0x06,0x02,0x00,
+0x00,0x11,0x02,0xc0,0x00,0x03,0x02,0x00,0x40,0xa0,0x02,0x00,0xc0,0x20,0x01,0x80,
+0x80,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x05,0x61,0x6c,0x69,
+0x76,0x65,0x00,0x00,0x05,0x41,0x4c,0x49,0x56,0x45,0x00,0x00,0x00,0x0a,0x00,0x07,
+0x57,0x65,0x61,0x6b,0x52,0x65,0x66,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0b,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x0e,0x77,0x65,
+0x61,0x6b,0x72,0x65,0x66,0x5f,0x61,0x6c,0x69,0x76,0x65,0x3f,0x00,0x00,0x0a,0x5f,
+0x5f,0x67,0x65,0x74,0x6f,0x62,0x6a,0x5f,0x5f,0x00,0x00,0x06,0x65,0x71,0x75,0x61,
+0x6c,0x3f,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x06,0x75,0x70,0x63,0x61,0x73,
+0x65,0x00,0x00,0x04,0x73,0x6f,0x72,0x74,0x00,0x00,0x00,0x01,0x29,0x00,0x04,0x00,
+0x08,0x00,0x02,0x00,0x00,0x00,0x1f,0x00,0x80,0x00,0x3d,0x02,0x00,0x00,0x11,0x02,
+0x80,0x40,0x01,0x02,0x00,0x40,0xa0,0x01,0x01,0x00,0x01,0x02,0x00,0x00,0x06,0x02,
+0x00,0x80,0x20,0x01,0x81,0x00,0x01,0x02,0x00,0x01,0x91,0x02,0x01,0x00,0x20,0x02,
+0x00,0x00,0x06,0x02,0x80,0xc0,0x01,0x02,0x81,0x80,0x20,0x02,0x01,0x40,0xa0,0x02,
+0x00,0x00,0x06,0x02,0x80,0x00,0x11,0x02,0x80,0x04,0x13,0x03,0x00,0x01,0x40,0x02,
+0x01,0xc0,0xa1,0x02,0x00,0x00,0x06,0x02,0x80,0x00,0x11,0x02,0x80,0x04,0x13,0x03,
+0x00,0x03,0x40,0x02,0x01,0xc0,0xa1,0x02,0x00,0x00,0x06,0x02,0x80,0x80,0x01,0x02,
+0x82,0x80,0x20,0x03,0x00,0x40,0x01,0x02,0x82,0xc0,0xa0,0x02,0x02,0x40,0xa0,0x02,
+0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x04,0x6b,0x65,0x70,0x74,0x00,0x00,
+0x00,0x0c,0x00,0x07,0x57,0x65,0x61,0x6b,0x52,0x65,0x66,0x00,0x00,0x03,0x6e,0x65,
+0x77,0x00,0x00,0x12,0x77,0x65,0x61,0x6b,0x72,0x65,0x66,0x5f,0x74,0x6f,0x5f,0x67,
+0x61,0x72,0x62,0x61,0x67,0x65,0x00,0x00,0x02,0x47,0x43,0x00,0x00,0x05,0x73,0x74,
+0x61,0x72,0x74,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x66,0x61,0x6c,
+0x73,0x65,0x00,0x00,0x0e,0x77,0x65,0x61,0x6b,0x72,0x65,0x66,0x5f,0x61,0x6c,0x69,
+0x76,0x65,0x3f,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,
+0x73,0x65,0x00,0x00,0x08,0x52,0x65,0x66,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0b,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x0a,0x5f,0x5f,
+0x67,0x65,0x74,0x6f,0x62,0x6a,0x5f,0x5f,0x00,0x00,0x06,0x65,0x71,0x75,0x61,0x6c,
+0x3f,0x00,0x00,0x00,0x00,0x2f,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x80,0xc0,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x0a,0x5f,0x5f,0x67,0x65,0x74,0x6f,0x62,0x6a,0x5f,0x5f,
+0x00,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x80,0xc0,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x7c,0x00,0x01,
+0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x06,
+0x01,0x80,0x00,0x08,0x01,0x00,0x40,0xa0,0x01,0x00,0x80,0x20,0x00,0x80,0x00,0xa0,
+0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x07,0x01,0x00,0x40,0xa0,
+0x01,0x00,0x80,0x20,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x66,0x61,0x6c,
+0x73,0x65,0x00,0x00,0x0f,0x77,0x65,0x61,0x6b,0x72,0x65,0x66,0x5f,0x63,0x6f,0x6c,
+0x6c,0x65,0x63,0x74,0x00,0x00,0x0e,0x77,0x65,0x61,0x6b,0x72,0x65,0x66,0x5f,0x61,
+0x6c,0x69,0x76,0x65,0x3f,0x00,0x00,0x00,0x00,0x8a,0x00,0x03,0x00,0x07,0x00,0x00,
+0x00,0x00,0x00,0x0d,0x00,0x80,0x00,0x3d,0x01,0x80,0x00,0x11,0x02,0x00,0x40,0x01,
+0x01,0x80,0x40,0xa0,0x01,0x80,0x80,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,
+0x02,0x00,0x80,0x01,0x02,0x01,0x00,0x20,0x02,0x80,0x40,0x01,0x02,0x01,0x40,0xa0,
+0x01,0x80,0xc0,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x03,0x64,
+0x75,0x70,0x00,0x00,0x00,0x06,0x00,0x07,0x57,0x65,0x61,0x6b,0x52,0x65,0x66,0x00,
+0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x03,0x64,0x75,0x70,0x00,0x00,0x0b,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x0a,0x5f,0x5f,0x67,0x65,
+0x74,0x6f,0x62,0x6a,0x5f,0x5f,0x00,0x00,0x06,0x65,0x71,0x75,0x61,0x6c,0x3f,0x00,
+0x00,0x00,0x00,0x51,0x00,0x02,0x00,0x05,0x00,0x01,0x00,0x00,0x00,0x08,0x01,0x00,
+0x00,0x11,0x01,0x80,0x01,0x40,0x01,0x00,0x40,0x21,0x00,0x80,0x80,0x01,0x01,0x00,
+0x80,0x20,0x01,0x80,0x00,0x11,0x01,0x00,0xc0,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x03,
+0x6e,0x65,0x77,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x80,0x00,0x05,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x49,0x00,0x02,0x00,0x05,0x00,0x01,0x00,0x00,0x00,0x07,0x01,0x00,0x00,
+0x11,0x01,0x80,0x01,0x40,0x01,0x00,0x40,0x21,0x00,0x80,0x80,0x01,0x01,0xc0,0x00,
+0x83,0x01,0x00,0x80,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x06,
+0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,
+0x00,0x83,0x01,0x80,0x00,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x01,0x1b,0x00,0x03,0x00,0x07,0x00,
+0x04,0x00,0x00,0x00,0x28,0x00,0x80,0x00,0x05,0x01,0x80,0x00,0x11,0x02,0x00,0x01,
+0x40,0x01,0x80,0x40,0x21,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x11,0x02,0x00,0x03,
+0x40,0x01,0x80,0x40,0x21,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x40,0x00,
+0x03,0x02,0x80,0x40,0x01,0x02,0x80,0xc0,0x20,0x01,0x80,0x81,0x20,0x01,0x80,0x00,
+0x06,0x02,0x00,0x02,0x91,0x02,0x80,0x05,0x40,0x01,0x81,0x00,0xa1,0x01,0x80,0x00,
+0x06,0x02,0x40,0x00,0x83,0x02,0x80,0x40,0x01,0x02,0x81,0x80,0x20,0x01,0x80,0x81,
+0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x91,0x02,0x80,0x07,0x40,0x01,0x81,0x00,
+0xa1,0x01,0x80,0x80,0x01,0x01,0x81,0x80,0x20,0x01,0x80,0x40,0x01,0x01,0x80,0xc0,
+0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x80,0x01,0x02,0x02,0x00,0x20,0x01,0x81,0xc0,
+0xa0,0x01,0x80,0x00,0x06,0x02,0x00,0x40,0x01,0x02,0x02,0x00,0x20,0x01,0x81,0xc0,
+0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x05,0x46,
+0x69,0x62,0x65,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0c,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x06,0x72,0x65,0x73,0x75,
+0x6d,0x65,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,
+0x65,0x00,0x00,0x0a,0x46,0x69,0x62,0x65,0x72,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,
+0x08,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,0x00,0x06,0x61,0x6c,0x69,0x76,0x65,
+0x3f,0x00,0x00,0x00,0x00,0x4d,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x07,
+0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x11,0x02,0x00,0x40,0x01,0x01,0x80,0x40,0xa0,
+0x01,0x80,0x40,0x15,0x01,0x80,0x80,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x05,0x79,0x69,
+0x65,0x6c,0x64,0x00,0x00,0x08,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x00,0x00,
+0x00,0x00,0x59,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x80,0x80,
+0x15,0x01,0x40,0x00,0x03,0x00,0x80,0x00,0xa0,0x00,0x80,0x80,0x15,0x01,0x40,0x00,
+0x03,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x91,0x01,0x40,0x00,0x83,0x00,0x80,0x80,
+0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x08,0x74,
+0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x00,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,
+0x00,0x05,0x79,0x69,0x65,0x6c,0x64,0x00,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x40,0x15,0x00,0x80,0x00,0x20,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x72,0x65,0x73,0x75,
+0x6d,0x65,0x00,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x80,0x80,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x00,
+0x00,0x8f,0x00,0x04,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x15,0x02,0x00,0x00,0x11,
+0x02,0x80,0x01,0x40,0x02,0x00,0x40,0x21,0x00,0x81,0x00,0x01,0x02,0x00,0x80,0x20,
+0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,0x01,0x01,0x00,0x01,0x02,0x00,0x40,0x01,
+0x02,0x00,0x80,0x20,0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,0x01,0x81,0x00,0x01,
+0x02,0x00,0x80,0x01,0x02,0x80,0x00,0x07,0x02,0x01,0x00,0xb2,0x02,0x40,0x01,0x99,
+0x02,0x00,0xc0,0x01,0x02,0x80,0x00,0x08,0x02,0x01,0x00,0xb2,0x02,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,
+0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,
+0x06,0x61,0x6c,0x69,0x76,0x65,0x3f,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,
+0x32,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x00,0x11,0x00,
+0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x05,0x79,0x69,0x65,0x6c,0x64,0x00,0x00,
+0x00,0x00,0xf5,0x00,0x03,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x22,0x01,0x80,0x00,
+0x11,0x01,0x80,0x40,0x20,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x00,0x40,
+0x01,0x02,0x80,0x40,0x01,0x01,0x80,0x81,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x40,
+0x01,0x02,0x80,0x00,0x11,0x02,0x80,0x40,0x20,0x01,0x80,0x81,0x20,0x01,0x80,0x00,
+0x06,0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x11,0x02,0x80,0x40,0x20,0x02,0x01,0x00,
+0xa0,0x01,0x80,0xc0,0xa0,0x01,0x80,0x00,0x11,0x02,0x00,0x01,0x40,0x01,0x81,0x40,
+0x21,0x01,0x00,0xc0,0x01,0x01,0x81,0x80,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x80,
+0x01,0x02,0x80,0x40,0x01,0x02,0x01,0xc0,0xb2,0x01,0x80,0xc0,0xa0,0x01,0x80,0x00,
+0x06,0x02,0x00,0x80,0x01,0x02,0x80,0x40,0x01,0x02,0x01,0x00,0xa0,0x01,0x82,0x00,
+0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x05,0x46,
+0x69,0x62,0x65,0x72,0x00,0x00,0x07,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x00,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,0x00,0x02,0x21,
+0x3d,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,
+0x72,0x75,0x65,0x00,0x00,0x00,0x00,0x58,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,
+0x00,0x07,0x00,0x80,0x00,0x06,0x01,0x00,0x40,0x15,0x01,0x80,0x01,0x11,0x01,0x80,
+0xc0,0x20,0x01,0x00,0x40,0xb2,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x66,
+0x61,0x6c,0x73,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x46,0x69,0x62,0x65,
+0x72,0x00,0x00,0x07,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x00,0x00,0x00,0x00,0x49,
+0x00,0x02,0x00,0x05,0x00,0x01,0x00,0x00,0x00,0x07,0x01,0x00,0x00,0x11,0x01,0x80,
+0x01,0x40,0x01,0x00,0x40,0x21,0x00,0x80,0x80,0x01,0x01,0xc0,0x01,0x03,0x01,0x00,
+0x80,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x05,
+0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x06,0x72,0x65,
+0x73,0x75,0x6d,0x65,0x00,0x00,0x00,0x00,0x47,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
+0x00,0x00,0x07,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x11,0x02,0x00,0x40,0x01,0x02,
+0xc0,0x01,0x03,0x02,0x00,0x80,0xb2,0x01,0x80,0x40,0xa0,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,
+0x05,0x79,0x69,0x65,0x6c,0x64,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x67,
+0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x01,0x00,
+0x00,0x91,0x01,0x80,0x01,0x11,0x01,0x80,0xc0,0x20,0x00,0x80,0x01,0x20,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0c,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,
+0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0a,0x46,0x69,0x62,0x65,0x72,
+0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x00,0x00,0x89,0x00,0x04,0x00,0x0b,0x00,0x03,0x00,0x00,0x00,
+0x16,0x02,0x00,0x00,0x11,0x02,0x80,0x01,0x40,0x02,0x00,0x40,0x21,0x00,0x81,0x00,
+0x01,0x02,0x00,0x00,0x11,0x02,0x80,0x03,0x40,0x02,0x00,0x40,0x21,0x01,0x01,0x00,
+0x01,0x01,0x81,0x00,0x37,0x02,0x40,0x01,0x03,0x02,0x80,0x05,0x40,0x02,0x00,0x80,
+0x21,0x02,0x00,0xc0,0x01,0x02,0xc0,0x00,0x03,0x03,0x40,0x04,0x03,0x03,0xc0,0x00,
+0x83,0x04,0x40,0x03,0x83,0x04,0xc0,0x01,0x03,0x05,0x40,0x03,0x03,0x02,0x81,0x43,
+0x37,0x02,0x00,0xc0,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x04,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x39,
+0x00,0x01,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0xc0,0x00,0x03,0x01,0x40,
+0x00,0x83,0x01,0xc0,0x01,0x03,0x00,0x80,0x41,0xb7,0x01,0x00,0x01,0x40,0x00,0x80,
+0x00,0x21,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,
+0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x3a,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
+0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x11,0x02,0x00,0x40,0x01,0x01,
+0x80,0x40,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x05,0x79,0x69,0x65,0x6c,0x64,0x00,0x00,
+0x00,0x00,0x39,0x00,0x01,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x07,0x00,0xc0,0x04,
+0x03,0x01,0x40,0x03,0x83,0x01,0xc0,0x03,0x03,0x00,0x80,0x41,0xb7,0x01,0x00,0x01,
+0x40,0x00,0x80,0x00,0x21,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x3a,0x00,0x03,0x00,0x06,
+0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x11,0x02,0x00,
+0x40,0x01,0x01,0x80,0x40,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x05,0x79,0x69,0x65,0x6c,
+0x64,0x00,0x00,0x00,0x00,0x48,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x09,
+0x00,0x80,0xc0,0x15,0x01,0x00,0x40,0x15,0x01,0x00,0x40,0x20,0x00,0x80,0x00,0xa0,
+0x00,0x80,0xc0,0x15,0x01,0x00,0x80,0x15,0x01,0x00,0x40,0x20,0x00,0x80,0x00,0xa0,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,
+0x00,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x00,0x00,0x56,0x00,0x01,
+0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x11,0x01,0x00,0x01,0x40,
+0x00,0x80,0x40,0x21,0x01,0x40,0x00,0x03,0x00,0x80,0x80,0xa0,0x01,0x40,0x00,0x03,
+0x01,0x00,0x80,0xb7,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x03,0x6e,0x65,
+0x77,0x00,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x1e,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x08,
+0x00,0x26,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x46,0x00,0x01,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x06,
+0x01,0x00,0x00,0x91,0x01,0x80,0x01,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0a,0x46,0x69,0x62,0x65,0x72,0x45,0x72,
+0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x75,0x00,0x02,0x00,0x05,0x00,0x01,0x00,0x00,
+0x00,0x0c,0x01,0x00,0x00,0x11,0x01,0x80,0x01,0x40,0x01,0x00,0x40,0x21,0x00,0x80,
+0x80,0x01,0x01,0x00,0x80,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x01,0x81,
+0x00,0x20,0x01,0x00,0xc0,0xa0,0x01,0x00,0x40,0x01,0x01,0x00,0x80,0x20,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x46,0x69,0x62,0x65,
+0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,
+0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,
+0x00,0x06,0x61,0x6c,0x69,0x76,0x65,0x3f,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,
+0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x00,0x01,0x00,0x04,0x00,
+0x01,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x01,
+0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,
+0x00,0x0a,0x46,0x69,0x62,0x65,0x72,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,
+0x32,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x00,0x11,0x00,
+0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x05,0x79,0x69,0x65,0x6c,0x64,0x00,0x00,
+0x00,0x00,0xb4,0x00,0x03,0x00,0x07,0x00,0x02,0x00,0x00,0x00,0x18,0x01,0x80,0x00,
+0x11,0x02,0x00,0x01,0x40,0x01,0x80,0x40,0x21,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,
+0x11,0x02,0x00,0x03,0x40,0x01,0x80,0x40,0x21,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,
+0x06,0x02,0x3f,0xff,0x83,0x02,0x80,0x80,0x01,0x02,0x80,0xc0,0x20,0x01,0x80,0x81,
+0x20,0x01,0x80,0x80,0x01,0x01,0x80,0xc0,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x40,
+0x01,0x02,0x01,0x40,0x20,0x01,0x81,0x00,0xa0,0x01,0x80,0x00,0x06,0x02,0x00,0x80,
+0x01,0x02,0x01,0x40,0x20,0x01,0x81,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x03,0x6e,
+0x65,0x77,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x0c,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,0x00,0x06,0x61,0x6c,0x69,0x76,
+0x65,0x3f,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x73,0x00,0x01,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,
+0x80,0x40,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x11,0x01,
+0x80,0x01,0x40,0x00,0x80,0x40,0xa1,0x00,0x80,0x01,0x91,0x01,0x3f,0xff,0x83,0x00,
+0x81,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,
+0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0a,0x46,0x69,0x62,0x65,0x72,0x45,0x72,
+0x72,0x6f,0x72,0x00,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x05,0x79,0x69,
+0x65,0x6c,0x64,0x00,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,
+0x00,0x03,0x00,0x80,0x80,0x95,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,
+0x00,0x00,0xe4,0x00,0x04,0x00,0x08,0x00,0x03,0x00,0x00,0x00,0x24,0x02,0x00,0x00,
+0x05,0x02,0x80,0x00,0x05,0x00,0x81,0x00,0x01,0x01,0x01,0x40,0x01,0x02,0x00,0x00,
+0x11,0x02,0x80,0x01,0x40,0x02,0x00,0x40,0x21,0x00,0x81,0x00,0x01,0x02,0x00,0x00,
+0x11,0x02,0x80,0x03,0x40,0x02,0x00,0x40,0x21,0x01,0x01,0x00,0x01,0x02,0x00,0x00,
+0x11,0x02,0x80,0x05,0x40,0x02,0x00,0x40,0x21,0x01,0x81,0x00,0x01,0x02,0x00,0x00,
+0x06,0x02,0xbf,0xff,0x83,0x03,0x00,0xc0,0x01,0x03,0x00,0xc0,0x20,0x02,0x00,0x81,
+0x20,0x02,0x00,0x80,0x01,0x02,0x00,0xc0,0x20,0x02,0x00,0x00,0x06,0x02,0x80,0x40,
+0x01,0x02,0x81,0x40,0x20,0x02,0x01,0x00,0xa0,0x02,0x00,0x00,0x06,0x02,0x80,0x80,
+0x01,0x02,0x81,0x40,0x20,0x02,0x01,0x00,0xa0,0x02,0x00,0x00,0x06,0x02,0x80,0xc0,
+0x01,0x02,0x81,0x40,0x20,0x02,0x01,0x00,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x03,0x6e,
+0x65,0x77,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x0c,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,0x00,0x06,0x61,0x6c,0x69,0x76,
+0x65,0x3f,0x00,0x00,0x00,0x00,0x46,0x00,0x01,0x00,0x04,0x00,0x01,0x00,0x00,0x00,
+0x05,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x01,0x40,0x00,0x80,0x00,
+0xa1,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0a,0x46,0x69,
+0x62,0x65,0x72,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x80,0x95,0x00,0x80,0x00,0x20,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x72,0x65,0x73,
+0x75,0x6d,0x65,0x00,0x00,0x00,0x00,0x47,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,
+0x00,0x06,0x00,0x80,0x40,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x91,0x01,0x3f,
+0xff,0x83,0x00,0x80,0x80,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x03,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x05,0x46,0x69,0x62,
+0x65,0x72,0x00,0x00,0x05,0x79,0x69,0x65,0x6c,0x64,0x00,0x00,0x00,0x00,0x2b,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x80,0x15,0x00,0x80,0x00,
+0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x72,
+0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x00,0x00,0xaf,0x00,0x03,0x00,0x06,0x00,0x02,
+0x00,0x00,0x00,0x11,0x01,0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x00,0x80,0xc0,0x01,
+0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x91,0x02,0x80,0x01,0x40,0x01,0x80,0x80,0xa1,
+0x01,0x80,0x00,0x11,0x02,0x00,0x03,0x40,0x01,0x81,0x00,0x21,0x01,0x00,0xc0,0x01,
+0x01,0x81,0x40,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x80,0x01,0x02,0x01,0xc0,0x20,
+0x01,0x81,0x80,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,
+0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x07,0x63,0x75,0x72,0x72,0x65,0x6e,
+0x74,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,
+0x00,0x00,0x0a,0x46,0x69,0x62,0x65,0x72,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,
+0x6e,0x65,0x77,0x00,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,0x00,0x06,0x61,0x6c,
+0x69,0x76,0x65,0x3f,0x00,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x80,0x40,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,
+0x00,0x00,0x00,0x46,0x00,0x01,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x80,
+0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x01,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0a,0x46,0x69,0x62,0x65,0x72,
+0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x80,0x40,0x95,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,
+0x00,0x00,0x00,0x00,0x49,0x00,0x01,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x05,0x00,
+0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x01,0x40,0x00,0x80,0x00,0xa1,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,0x41,0x72,0x67,0x75,
+0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x30,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x46,0x69,
+0x62,0x65,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x00,0x00,0xb9,0x00,0x03,
+0x00,0x07,0x00,0x02,0x00,0x00,0x00,0x19,0x00,0x80,0xc0,0x37,0x01,0x80,0x00,0x11,
+0x02,0x00,0x01,0x40,0x01,0x80,0x40,0x21,0x01,0x00,0xc0,0x01,0x01,0x80,0x80,0x20,
+0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x04,0x02,0x80,0x02,0x84,0x02,0x01,0x01,0x37,
+0x02,0x80,0x40,0x01,0x01,0x80,0xc1,0x20,0x00,0x80,0xc0,0x37,0x01,0x80,0x00,0x11,
+0x02,0x00,0x03,0x40,0x01,0x80,0x40,0x21,0x01,0x00,0xc0,0x01,0x01,0x81,0x80,0x20,
+0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x04,0x02,0x80,0x02,0x84,0x02,0x01,0x01,0x37,
+0x02,0x80,0x40,0x01,0x01,0x80,0xc1,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x07,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x03,0x6e,0x65,
+0x77,0x00,0x00,0x08,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x00,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x05,0x73,0x74,
+0x61,0x72,0x74,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x00,0x06,0x72,0x65,0x73,0x75,
+0x6d,0x65,0x00,0x00,0x00,0x00,0x58,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+0x09,0x00,0x80,0x40,0x15,0x01,0x00,0x00,0x84,0x00,0x80,0x00,0xa0,0x00,0x80,0x80,
+0x15,0x00,0x80,0x80,0x20,0x00,0x80,0x40,0x15,0x01,0x00,0x01,0x84,0x00,0x80,0x00,
+0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x02,0x3c,
+0x3c,0x00,0x00,0x05,0x73,0x74,0x61,0x72,0x74,0x00,0x00,0x08,0x74,0x72,0x61,0x6e,
+0x73,0x66,0x65,0x72,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x00,0x00,0x00,0x58,0x00,
+0x01,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x80,0x40,0x15,0x01,0x00,0x00,
+0x84,0x00,0x80,0x00,0xa0,0x00,0x80,0x80,0x15,0x00,0x80,0x80,0x20,0x00,0x80,0x40,
+0x15,0x01,0x00,0x01,0x84,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x02,0x3c,0x3c,0x00,0x00,0x05,0x73,0x74,0x61,0x72,
+0x74,0x00,0x00,0x08,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x00,0x00,0x03,0x65,
+0x6e,0x64,0x00,0x00,0x00,0x00,0x47,0x00,0x02,0x00,0x04,0x00,0x01,0x00,0x00,0x00,
+0x06,0x01,0x00,0x00,0x11,0x01,0x80,0x01,0x40,0x01,0x00,0x40,0x21,0x00,0x80,0x80,
+0x01,0x01,0x00,0x80,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x08,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x00,0x00,0x00,0x00,0x46,0x00,0x01,
+0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,
+0x01,0x80,0x01,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,
+0x73,0x65,0x00,0x00,0x0a,0x46,0x69,0x62,0x65,0x72,0x45,0x72,0x72,0x6f,0x72,0x00,
+0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,
+0x40,0x95,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x00,0x00,0xaa,0x00,
+0x04,0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x80,0x00,0x05,0x02,0x00,0x00,
+0x11,0x02,0x00,0x40,0x20,0x01,0x01,0x00,0x01,0x02,0x00,0x00,0x11,0x02,0x80,0x01,
+0x40,0x02,0x00,0x80,0x21,0x01,0x81,0x00,0x01,0x02,0x00,0xc0,0x20,0x02,0x00,0x00,
+0x06,0x02,0x80,0xc0,0x01,0x02,0x81,0x40,0x20,0x02,0x01,0x00,0xa0,0x02,0x00,0x00,
+0x06,0x02,0x80,0x03,0x84,0x03,0x00,0x40,0x01,0x02,0x01,0x81,0x20,0x02,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x05,0x46,0x69,0x62,0x65,0x72,
+0x00,0x00,0x07,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,
+0x00,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x06,0x61,0x6c,0x69,0x76,0x65,0x3f,
+0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,
+0x00,0x02,0x6f,0x6b,0x00,0x00,0x00,0x00,0x3a,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x00,0x00,0x05,0x00,0x80,0x00,0x04,0x00,0x80,0x40,0x16,0x00,0x80,0x80,0x15,0x00,
+0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x02,0x6f,0x6b,0x00,0x00,0x08,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x00,0x00,
+0x00,0x01,0x4b,0x00,0x05,0x00,0x09,0x00,0x02,0x00,0x00,0x00,0x31,0x02,0x80,0x00,
+0x11,0x02,0x80,0x40,0x20,0x00,0x81,0x40,0x01,0x01,0x00,0x00,0x05,0x01,0x80,0x00,
+0x05,0x02,0x80,0x00,0x11,0x03,0x00,0x01,0x40,0x02,0x80,0x80,0x21,0x02,0x01,0x40,
+0x01,0x02,0x80,0x00,0x11,0x03,0x00,0x03,0x40,0x02,0x80,0x80,0x21,0x01,0x81,0x40,
+0x01,0x02,0x80,0x00,0x06,0x03,0x00,0x02,0x04,0x03,0x81,0x00,0x01,0x03,0x81,0x40,
+0x20,0x02,0x80,0xc1,0x20,0x02,0x80,0x00,0x06,0x03,0x00,0x03,0x04,0x03,0x80,0x80,
+0x01,0x02,0x80,0xc1,0x20,0x02,0x80,0x00,0x06,0x03,0x00,0x03,0x84,0x03,0x80,0xc0,
+0x01,0x03,0x82,0x00,0x20,0x02,0x80,0xc1,0x20,0x02,0x80,0x00,0x06,0x03,0x00,0x03,
+0x84,0x03,0x80,0x80,0x01,0x02,0x80,0xc1,0x20,0x02,0x80,0x00,0x06,0x03,0x00,0xc0,
+0x01,0x03,0x02,0x80,0x20,0x02,0x82,0x40,0xa0,0x02,0x80,0x00,0x06,0x03,0x00,0x05,
+0x84,0x03,0x81,0x00,0x01,0x03,0x81,0x40,0x20,0x02,0x80,0xc1,0x20,0x02,0x80,0x00,
+0x06,0x03,0x00,0x05,0x84,0x03,0x80,0x80,0x01,0x02,0x80,0xc1,0x20,0x02,0x80,0x00,
+0x06,0x03,0x01,0x00,0x01,0x03,0x02,0x80,0x20,0x02,0x82,0x40,0xa0,0x02,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x05,0x46,0x69,0x62,0x65,0x72,
+0x00,0x00,0x07,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,
+0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,
+0x00,0x07,0x66,0x72,0x6f,0x6d,0x5f,0x66,0x32,0x00,0x00,0x06,0x72,0x65,0x73,0x75,
+0x6d,0x65,0x00,0x00,0x07,0x74,0x6f,0x5f,0x72,0x6f,0x6f,0x74,0x00,0x00,0x02,0x66,
+0x32,0x00,0x00,0x08,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x00,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,0x00,0x06,0x61,0x6c,
+0x69,0x76,0x65,0x3f,0x00,0x00,0x02,0x66,0x31,0x00,0x00,0x00,0x00,0x50,0x00,0x01,
+0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x11,0x01,0x00,0xc0,0x15,
+0x01,0x00,0x80,0x20,0x00,0x80,0x40,0xa0,0x00,0x80,0x01,0x84,0x00,0x80,0x80,0x16,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x05,0x46,0x69,
+0x62,0x65,0x72,0x00,0x00,0x05,0x79,0x69,0x65,0x6c,0x64,0x00,0x00,0x06,0x72,0x65,
+0x73,0x75,0x6d,0x65,0x00,0x00,0x02,0x66,0x31,0x00,0x00,0x00,0x00,0x5a,0x00,0x01,
+0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x04,0x00,0x80,0x80,0x16,
+0x00,0x80,0x40,0x15,0x01,0x00,0x01,0x04,0x00,0x80,0x40,0xa0,0x00,0x80,0x01,0x84,
+0x00,0x80,0x80,0x16,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x07,0x74,0x6f,0x5f,0x72,0x6f,0x6f,0x74,0x00,0x00,0x08,0x74,0x72,0x61,0x6e,
+0x73,0x66,0x65,0x72,0x00,0x00,0x07,0x66,0x72,0x6f,0x6d,0x5f,0x66,0x32,0x00,0x00,
+0x02,0x66,0x32,0x00,0x00,0x00,0x00,0x9d,0x00,0x04,0x00,0x08,0x00,0x02,0x00,0x00,
+0x00,0x15,0x00,0x81,0x00,0x37,0x01,0x00,0x00,0x05,0x02,0x00,0x00,0x11,0x02,0x80,
+0x01,0x40,0x02,0x00,0x40,0x21,0x01,0x81,0x00,0x01,0x02,0x00,0x00,0x11,0x02,0x80,
+0x03,0x40,0x02,0x00,0x40,0x21,0x01,0x01,0x00,0x01,0x02,0x00,0x00,0x06,0x02,0x80,
+0x01,0x84,0x03,0x00,0xc0,0x01,0x03,0x01,0x00,0x20,0x02,0x00,0x81,0x20,0x02,0x00,
+0x00,0x06,0x02,0x80,0x02,0x84,0x02,0x81,0x40,0xb7,0x03,0x00,0x40,0x01,0x02,0x00,
+0x81,0x20,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x05,
+0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x02,0x6f,0x6b,0x00,
+0x00,0x08,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x00,0x00,0x03,0x62,0x61,0x7a,
+0x00,0x00,0x00,0x00,0x4d,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x07,0x00,
+0x80,0x40,0x15,0x01,0x00,0x80,0x15,0x01,0x80,0x01,0x04,0x01,0x00,0x40,0xa0,0x00,
+0x80,0x00,0xa0,0x00,0x80,0x01,0x84,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x02,0x3c,0x3c,0x00,0x00,0x08,0x74,0x72,0x61,0x6e,0x73,0x66,
+0x65,0x72,0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x02,0x6f,0x6b,0x00,0x00,0x00,
+0x00,0x4d,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x80,0x40,0x15,
+0x01,0x00,0xc0,0x15,0x01,0x80,0x01,0x04,0x01,0x00,0x40,0xa0,0x00,0x80,0x00,0xa0,
+0x00,0x80,0x01,0x84,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x02,0x3c,0x3c,0x00,0x00,0x08,0x74,0x72,0x61,0x6e,0x73,0x66,0x65,0x72,0x00,
+0x00,0x03,0x62,0x61,0x7a,0x00,0x00,0x02,0x6e,0x67,0x00,0x00,0x00,0x00,0xda,0x00,
+0x03,0x00,0x07,0x00,0x04,0x00,0x00,0x00,0x17,0x01,0x80,0x00,0x48,0x02,0x00,0x00,
+0xc0,0x01,0x80,0x00,0x46,0x01,0x80,0x00,0x91,0x02,0x00,0x03,0x40,0x01,0x80,0x80,
+0x21,0x00,0x80,0xc0,0x01,0x01,0x80,0xc0,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x02,
+0x11,0x02,0x00,0x05,0x40,0x01,0x81,0x40,0x21,0x01,0xc0,0x31,0x83,0x02,0x00,0x07,
+0x40,0x01,0x81,0x80,0x21,0x01,0x80,0x02,0x11,0x01,0x81,0xc0,0x20,0x01,0x80,0x00,
+0x06,0x02,0x00,0x00,0x3d,0x02,0x80,0x80,0x01,0x02,0x82,0x40,0x20,0x01,0x82,0x01,
+0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x03,0x73,0x73,0x73,0x00,
+0x00,0x00,0x0a,0x00,0x14,0x66,0x69,0x62,0x65,0x72,0x5f,0x72,0x65,0x67,0x69,0x6f,
+0x6e,0x5f,0x63,0x61,0x70,0x74,0x75,0x72,0x65,0x00,0x00,0x05,0x46,0x69,0x62,0x65,
+0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,
+0x00,0x00,0x02,0x47,0x43,0x00,0x00,0x06,0x72,0x65,0x67,0x69,0x6f,0x6e,0x00,0x00,
+0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x05,0x73,0x74,0x61,0x72,0x74,0x00,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x04,
+0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x5e,0x00,0x04,0x00,0x07,0x00,0x01,0x00,
+0x00,0x00,0x0c,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x05,0x02,0x00,0x01,0xc0,0x01,
+0x81,0x00,0x01,0x02,0x00,0x00,0x11,0x02,0x80,0xc0,0x01,0x02,0x00,0x40,0xa0,0x02,
+0x00,0x00,0x3d,0x02,0xc0,0x01,0x03,0x02,0x00,0x80,0xb0,0x01,0x01,0x00,0x01,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x03,0x00,
+0x05,0x46,0x69,0x62,0x65,0x72,0x00,0x00,0x05,0x79,0x69,0x65,0x6c,0x64,0x00,0x00,
+0x01,0x2a,0x00,0x00,0x00,0x00,0x22,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x00,0x00,0x26,0x01,0x00,0x80,0x15,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x14,0x66,0x69,0x62,0x65,0x72,0x5f,0x72,
+0x65,0x67,0x69,0x6f,0x6e,0x5f,0x63,0x61,0x70,0x74,0x75,0x72,0x65,0x00,0x00,0x00,
+0x00,0x2b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x40,0x15,
+0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x06,0x72,0x65,0x73,0x75,0x6d,0x65,0x00,0x00,0x00,0x00,0x2e,0x00,0x01,0x00,
+0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x3d,0x01,0x40,0x04,0x83,0x00,
+0x80,0x00,0xb0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x78,0x00,
+0x00,0x00,0x01,0x00,0x01,0x2a,0x00,0x00,0x00,0x00,0x53,0x00,0x01,0x00,0x04,0x00,
+0x01,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,0x00,
+0xa0,0x00,0x80,0x00,0x48,0x01,0x00,0x00,0xc0,0x00,0x80,0x80,0x46,0x00,0x80,0x01,
+0x04,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x07,0x69,
+0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,
+0x62,0x6c,0x65,0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x00,0x00,0x31,0x00,0x03,
+0x00,0x05,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x08,0x00,0x26,0x01,0x80,0x40,0x01,
+0x02,0x00,0x01,0x40,0x01,0x80,0x00,0x21,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x31,0x00,
+0x03,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x81,0x00,
+0xab,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x5a,
+0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x01,0x00,
+0x00,0x91,0x01,0x80,0x01,0x11,0x01,0x80,0xc0,0x20,0x00,0x80,0x01,0x20,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0c,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,
+0x00,0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x60,0x00,0x01,0x00,0x05,0x00,0x00,
+0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x01,0x11,
+0x01,0x80,0xc0,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,
+0x61,0x6c,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x0a,0x45,0x6e,
+0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x02,0x78,0x00,0x03,0x00,0x0f,0x00,0x07,
+0x00,0x00,0x00,0x71,0x01,0x80,0x00,0x06,0x02,0x3f,0xff,0x83,0x02,0xc0,0x00,0x03,
+0x03,0x40,0x00,0x83,0x02,0x01,0x01,0xb7,0x02,0xc0,0x01,0x03,0x02,0x80,0x40,0x20,
+0x03,0x00,0x01,0x40,0x02,0x80,0x80,0x21,0x02,0x80,0xc0,0x20,0x01,0x80,0x01,0x20,
+0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x04,0x02,0x80,0x02,0x84,0x03,0x00,0x03,0x04,
+0x02,0x01,0x01,0xb7,0x02,0x80,0x02,0x04,0x03,0x00,0x02,0x84,0x03,0x80,0x03,0x04,
+0x02,0x81,0x41,0xb7,0x02,0x81,0xc0,0x20,0x03,0x00,0x03,0x40,0x02,0x80,0x80,0x21,
+0x02,0x80,0xc0,0x20,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x04,
+0x02,0xc0,0x00,0x03,0x02,0x01,0x01,0x37,0x02,0x80,0x02,0x84,0x03,0x40,0x00,0x83,
+0x02,0x81,0x41,0x37,0x02,0x01,0x01,0x37,0x02,0x80,0x02,0x04,0x03,0x40,0x00,0x03,
+0x03,0x80,0x02,0x84,0x04,0x40,0x00,0x83,0x02,0x81,0x41,0x3f,0x02,0x81,0xc0,0x20,
+0x03,0x00,0x05,0x40,0x02,0x80,0x80,0x21,0x02,0x80,0xc0,0x20,0x01,0x80,0x01,0x20,
+0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,
+0x02,0x01,0x01,0xb7,0x02,0x80,0x04,0x0d,0x03,0x00,0x05,0x04,0x03,0xc0,0x00,0x03,
+0x04,0x40,0x00,0x83,0x04,0xc0,0x01,0x03,0x02,0x82,0x42,0x20,0x02,0x82,0xc0,0x20,
+0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,
+0x03,0x40,0x01,0x03,0x02,0x01,0x01,0xb7,0x02,0x80,0x06,0x11,0x03,0x00,0x04,0x0d,
+0x03,0x80,0x05,0x04,0x04,0x40,0x00,0x03,0x04,0xc0,0x00,0x83,0x05,0x40,0x01,0x03,
+0x02,0x83,0x42,0xa0,0x02,0x82,0xc0,0x20,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x06,
+0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x02,0x01,0x01,0xb7,
+0x02,0x80,0x06,0x11,0x03,0x00,0x07,0x40,0x02,0x83,0x40,0x21,0x03,0x40,0x01,0x03,
+0x02,0x83,0x80,0xa0,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x08,0x11,
+0x02,0x80,0x09,0x40,0x01,0x83,0xc0,0xa1,0x01,0x80,0x04,0x0d,0x01,0x82,0x40,0x20,
+0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x00,0x08,0x91,0x02,0x80,0x0b,0x40,
+0x01,0x83,0xc0,0xa1,0x01,0x80,0x06,0x11,0x02,0x00,0x0d,0x40,0x01,0x83,0x40,0x21,
+0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x00,0x80,0x01,0x02,0xc0,0x04,0x83,
+0x02,0x03,0x80,0xa0,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x03,0x03,0xc0,0x00,0x83,
+0x04,0x40,0x01,0x03,0x04,0xc0,0x02,0x03,0x05,0x40,0x03,0x83,0x05,0xc0,0x06,0x03,
+0x06,0x40,0x0a,0x03,0x06,0xc0,0x10,0x83,0x07,0x40,0x1b,0x03,0x02,0x81,0x45,0x37,
+0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,
+0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x03,0x6d,0x61,0x70,0x00,0x00,0x04,0x73,
+0x6f,0x72,0x74,0x00,0x00,0x01,0x78,0x00,0x00,0x01,0x79,0x00,0x00,0x01,0x7a,0x00,
+0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x04,0x40,0x6f,0x62,0x6a,0x00,0x00,0x07,
+0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x04,
+0x74,0x6f,0x5f,0x61,0x00,0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,
+0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x74,0x61,0x6b,0x65,0x00,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,
+0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0d,
+0x4e,0x6f,0x4d,0x65,0x74,0x68,0x6f,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,
+0x00,0x1e,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,
+0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x03,
+0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x00,0x04,0x00,0x06,
+0x00,0x01,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0xbf,0xff,0x83,0x02,0x00,
+0x00,0x06,0x02,0x80,0x01,0x40,0x02,0x00,0x00,0x21,0x02,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x6c,0x6f,0x6f,0x70,0x00,0x00,0x00,0x00,
+0x37,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x40,0x15,0x01,
+0x00,0xc0,0x15,0x01,0x00,0x40,0xad,0x01,0x00,0xc0,0x16,0x00,0x80,0x00,0xa0,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,
+0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x35,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,
+0x00,0x03,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,
+0x6f,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,
+0x03,0x00,0x01,0x00,0x00,0x00,0x04,0x00,0x80,0x40,0x15,0x01,0x00,0x01,0x40,0x00,
+0x80,0x00,0x21,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0x05,0x00,0x07,0x00,0x01,0x00,0x00,
+0x00,0x08,0x02,0x00,0x00,0x26,0x02,0xc0,0x00,0x03,0x02,0x01,0x40,0x01,0x01,0x81,
+0x40,0x01,0x02,0x80,0x00,0x06,0x03,0x00,0x01,0x40,0x02,0x80,0x00,0x21,0x02,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x6c,0x6f,0x6f,0x70,
+0x00,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,
+0x80,0x40,0x15,0x01,0x00,0xc0,0x15,0x00,0x80,0x00,0xa0,0x00,0x81,0x00,0x15,0x01,
+0x00,0xc0,0x15,0x01,0x81,0x00,0x15,0x01,0x00,0x40,0xac,0x00,0x80,0xc0,0x16,0x01,
+0x01,0x00,0x16,0x00,0x80,0x41,0x37,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,0x01,0x2b,0x00,0x00,0x00,0x01,0x33,
+0x00,0x02,0x00,0x0a,0x00,0x05,0x00,0x00,0x00,0x29,0x01,0x00,0x00,0x06,0x01,0xc0,
+0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x01,0x80,0xc1,0xb7,0x02,0x00,
+0x00,0x8d,0x02,0x80,0x01,0x84,0x03,0x40,0x00,0x03,0x03,0xc0,0x00,0x83,0x04,0x40,
+0x01,0x03,0x02,0x00,0x82,0x20,0x02,0x01,0x00,0x20,0x02,0x01,0x40,0x20,0x01,0x00,
+0x01,0x20,0x01,0x00,0x00,0x8d,0x01,0x80,0x01,0x84,0x02,0x40,0x00,0x03,0x02,0xc0,
+0x00,0x83,0x03,0x40,0x01,0x03,0x01,0x00,0x82,0x20,0x00,0x80,0x80,0x01,0x01,0x00,
+0x00,0x06,0x01,0x80,0x01,0x40,0x01,0x01,0x80,0x21,0x01,0x00,0x00,0x06,0x01,0x80,
+0x04,0x11,0x02,0x00,0x03,0x40,0x01,0x01,0xc0,0xa1,0x01,0x00,0x04,0x91,0x01,0x80,
+0x05,0x40,0x01,0x02,0x80,0x21,0x01,0x01,0x00,0x20,0x00,0x80,0x80,0x01,0x01,0x00,
+0x00,0x06,0x01,0x80,0x07,0x40,0x01,0x01,0x80,0x21,0x01,0x00,0x00,0x06,0x01,0x80,
+0x04,0x11,0x02,0x00,0x09,0x40,0x01,0x01,0xc0,0xa1,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x40,0x6f,0x62,0x6a,0x00,0x00,0x07,0x74,0x6f,
+0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x03,0x64,0x75,
+0x70,0x00,0x00,0x04,0x74,0x6f,0x5f,0x61,0x00,0x00,0x15,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x6e,0x6f,0x74,0x68,0x69,0x6e,0x67,0x5f,0x72,0x61,0x69,0x73,0x65,0x64,
+0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,
+0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0a,0x45,0x6e,
+0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x00,0x00,0x44,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x00,
+0x06,0x01,0x40,0x00,0x03,0x01,0x80,0x40,0x15,0x01,0x80,0x40,0x20,0x00,0x80,0x01,
+0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x6e,0x65,
+0x78,0x74,0x00,0x00,0x00,0x00,0x28,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x80,0x40,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x03,0x64,0x75,0x70,0x00,0x00,0x00,0x00,0x35,0x00,
+0x04,0x00,0x06,0x00,0x01,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0xbf,0xff,
+0x83,0x02,0x00,0x00,0x06,0x02,0x80,0x01,0x40,0x02,0x00,0x00,0x21,0x02,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x6c,0x6f,0x6f,0x70,0x00,
+0x00,0x00,0x00,0x37,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x80,
+0x40,0x15,0x01,0x00,0xc0,0x15,0x01,0x00,0x40,0xad,0x01,0x00,0xc0,0x16,0x00,0x80,
+0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,
+0x3c,0x3c,0x00,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x44,0x00,0x01,0x00,0x05,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,0x01,0x80,0x40,
+0x15,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x00,0x00,0x28,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x40,0x15,0x00,0x80,0x00,
+0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x03,0x64,
+0x75,0x70,0x00,0x00,0x00,0x00,0xf8,0x00,0x01,0x00,0x09,0x00,0x00,0x00,0x00,0x00,
+0x2a,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,0x01,0xbf,0xff,0x83,0x01,0x00,0x81,
+0x37,0x01,0xc0,0x00,0x83,0x02,0x40,0x00,0x03,0x01,0x80,0xc1,0x37,0x02,0x40,0x01,
+0x03,0x02,0xc0,0x00,0x83,0x02,0x01,0x01,0x37,0x01,0x00,0x81,0xb7,0x01,0x80,0x00,
+0x8d,0x02,0x00,0x01,0x84,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,
+0x03,0x01,0x80,0x82,0x20,0x01,0x81,0x00,0x20,0x01,0x81,0x40,0x20,0x00,0x80,0x01,
+0x20,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,0x01,0xc0,0x02,0x03,0x01,0x00,0x81,
+0x37,0x01,0xc0,0x00,0x83,0x02,0x40,0x02,0x83,0x01,0x80,0xc1,0x37,0x02,0x40,0x01,
+0x03,0x02,0xc0,0x03,0x03,0x02,0x01,0x01,0x37,0x01,0x00,0x81,0xb7,0x01,0x80,0x00,
+0x8d,0x02,0x00,0x01,0x84,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,
+0x03,0x01,0x80,0x82,0x20,0x02,0x40,0x02,0x03,0x01,0x81,0x00,0xa0,0x01,0x81,0x40,
+0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x06,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,
+0x00,0x04,0x40,0x6f,0x62,0x6a,0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,
+0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x0a,0x77,0x69,0x74,0x68,0x5f,0x69,0x6e,
+0x64,0x65,0x78,0x00,0x00,0x04,0x74,0x6f,0x5f,0x61,0x00,0x00,0x00,0x00,0xd8,0x00,
+0x02,0x00,0x0a,0x00,0x01,0x00,0x00,0x00,0x1c,0x01,0x00,0x00,0x11,0x01,0x00,0x40,
+0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x80,0x47,0x01,0x80,0x00,0xc0,0x01,0x00,0x80,
+0x46,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x03,0x01,0x80,0xc1,
+0x37,0x02,0x40,0x00,0x83,0x02,0xc0,0x00,0x83,0x02,0x01,0x01,0x37,0x02,0xc0,0x01,
+0x03,0x03,0x40,0x01,0x03,0x02,0x81,0x41,0x37,0x01,0x80,0xc1,0xb7,0x02,0x00,0x02,
+0x0d,0x02,0x80,0x03,0x04,0x03,0x40,0x00,0x03,0x03,0xc0,0x00,0x83,0x04,0x40,0x01,
+0x03,0x02,0x01,0x42,0x20,0x02,0x80,0x40,0x01,0x02,0x01,0xc0,0xa0,0x02,0x02,0x00,
+0x20,0x01,0x00,0xc1,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x09,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,
+0x00,0x06,0x74,0x6f,0x5f,0x69,0x6e,0x74,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x40,0x6f,0x62,0x6a,0x00,0x00,
+0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,
+0x0a,0x77,0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x04,0x74,0x6f,
+0x5f,0x61,0x00,0x00,0x00,0x00,0x22,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x00,0x00,0x26,0x01,0x40,0x00,0x03,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x00,0x01,0x00,0x04,0x00,0x01,0x00,
+0x00,0x00,0x05,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x01,0x40,0x00,
+0x80,0x00,0xa1,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x09,
+0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x6d,0x00,0x01,
+0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x80,0x00,0x0d,0x01,0x00,0x01,0x04,
+0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x00,0x80,0x42,0x20,
+0x01,0x00,0x00,0x3d,0x00,0x80,0xc0,0xa0,0x00,0x81,0x00,0x20,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x31,0x00,0x00,0x00,0x05,0x00,0x04,0x40,0x6f,
+0x62,0x6a,0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x03,0x66,
+0x6f,0x6f,0x00,0x00,0x0a,0x77,0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,0x65,0x78,0x00,
+0x00,0x04,0x74,0x6f,0x5f,0x61,0x00,0x00,0x00,0x00,0xb7,0x00,0x03,0x00,0x07,0x00,
+0x01,0x00,0x00,0x00,0x17,0x01,0xbf,0xff,0x83,0x02,0x40,0x00,0x03,0x00,0x80,0xc1,
+0x37,0x01,0xc0,0x00,0x03,0x02,0x40,0x04,0x83,0x01,0x80,0xc0,0x41,0x01,0x80,0x00,
+0x20,0x02,0x00,0x40,0x01,0x02,0x80,0x01,0x40,0x01,0x80,0x40,0xa1,0x01,0x00,0xc0,
+0x01,0x01,0x80,0x00,0x06,0x02,0x00,0x40,0x01,0x02,0x80,0x80,0x01,0x02,0x00,0xc0,
+0xa0,0x01,0x80,0x80,0xa0,0x01,0x80,0x00,0x06,0x02,0x40,0x1b,0x03,0x02,0x80,0x00,
+0x02,0x02,0x01,0x01,0x37,0x02,0x80,0x80,0x01,0x01,0x81,0x01,0x20,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x01,0x01,0x00,0x07,0x33,0x36,0x32,0x38,0x38,0x30,0x30,0x00,
+0x00,0x00,0x05,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x0b,0x77,0x69,0x74,0x68,
+0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x06,0x65,0x71,0x75,0x61,0x6c,0x3f,0x00,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,
+0x00,0x79,0x00,0x04,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x14,0x04,0x00,0x00,0x26,
+0x02,0x00,0x80,0x01,0x02,0xbf,0xff,0x83,0x02,0x00,0x00,0xa0,0x02,0x80,0x40,0x01,
+0x02,0x00,0x40,0xac,0x02,0x80,0x80,0x01,0x03,0x3f,0xff,0x83,0x03,0x81,0x00,0x01,
+0x02,0x80,0x81,0x20,0x02,0x00,0x80,0x01,0x02,0xc0,0x00,0x03,0x02,0x00,0x00,0xa0,
+0x02,0x80,0x40,0x01,0x02,0x00,0xc0,0xb0,0x02,0x80,0x80,0x01,0x03,0x40,0x00,0x03,
+0x03,0x81,0x00,0x01,0x02,0x80,0x81,0x20,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x02,0x5b,0x5d,0x00,0x00,0x01,0x2b,0x00,0x00,0x03,0x5b,
+0x5d,0x3d,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x00,0xb7,0x00,0x04,0x00,0x08,0x00,
+0x02,0x00,0x00,0x00,0x13,0x02,0x00,0x00,0x11,0x02,0x80,0x01,0x40,0x02,0x00,0x40,
+0x21,0x00,0x81,0x00,0x01,0x01,0x01,0x00,0x37,0x02,0x00,0x40,0x01,0x02,0x80,0x00,
+0x3d,0x02,0x00,0x80,0xa0,0x01,0x81,0x00,0x01,0x02,0x80,0x03,0x40,0x02,0x00,0xc0,
+0x21,0x02,0x00,0x00,0x06,0x02,0x80,0x00,0xbd,0x03,0x00,0x01,0x3d,0x03,0x80,0x01,
+0xbd,0x02,0x81,0x41,0xb7,0x03,0x00,0x80,0x01,0x02,0x01,0x01,0x20,0x02,0x00,0x00,
+0x29,0x00,0x00,0x00,0x04,0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x05,0x66,0x6f,
+0x6f,0x3a,0x30,0x00,0x00,0x05,0x66,0x6f,0x6f,0x3a,0x31,0x00,0x00,0x05,0x66,0x6f,
+0x6f,0x3a,0x32,0x00,0x00,0x00,0x05,0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,
+0x74,0x6f,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0b,0x77,0x69,0x74,0x68,
+0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,
+0x00,0x32,0x00,0x03,0x00,0x05,0x00,0x01,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,
+0x01,0xc0,0x01,0x03,0x02,0x00,0x01,0x40,0x01,0x80,0x00,0x21,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,
+0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,
+0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,
+0x00,0x00,0x4e,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x0b,0x04,0x00,0x00,
+0x26,0x02,0x00,0x80,0x15,0x02,0x80,0x00,0x3d,0x03,0x00,0x80,0x01,0x02,0x81,0x80,
+0x3e,0x03,0x00,0x00,0xbd,0x02,0x81,0x80,0x3e,0x03,0x00,0x40,0x01,0x02,0x81,0x80,
+0x3e,0x02,0x00,0x00,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+0x00,0x00,0x01,0x3a,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x01,
+0x4d,0x00,0x02,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x23,0x01,0x3f,0xff,0x83,0x01,
+0xc0,0x04,0x83,0x01,0x00,0x80,0x41,0x01,0x00,0x00,0x20,0x00,0x80,0x80,0x01,0x01,
+0x00,0x00,0x06,0x01,0x80,0x00,0x3d,0x02,0x00,0x40,0x01,0x02,0x00,0x80,0x20,0x01,
+0x00,0x41,0x20,0x01,0x00,0x01,0x91,0x01,0x80,0x00,0xbd,0x02,0x00,0x02,0x84,0x02,
+0xc0,0x00,0x03,0x01,0x01,0x01,0xa0,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,
+0x80,0x01,0x3d,0x02,0x00,0x40,0x01,0x02,0x00,0x80,0x20,0x01,0x00,0x41,0x20,0x01,
+0x00,0x01,0x91,0x01,0x80,0x00,0xbd,0x02,0x00,0x02,0x84,0x02,0xc0,0x00,0x03,0x03,
+0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x01,0x01,0x02,0xa0,0x00,0x80,0x80,0x01,0x01,
+0x00,0x00,0x06,0x01,0x80,0x01,0xbd,0x02,0x00,0x40,0x01,0x02,0x00,0x80,0x20,0x01,
+0x00,0x41,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x04,0x00,0x00,0x19,0x23,0x3c,
+0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x3a,0x20,0x30,0x2e,0x2e,0x31,
+0x30,0x3a,0x65,0x61,0x63,0x68,0x3e,0x00,0x00,0x09,0x46,0x6f,0x6f,0x4f,0x62,0x6a,
+0x65,0x63,0x74,0x00,0x00,0x1f,0x23,0x3c,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,
+0x6f,0x72,0x3a,0x20,0x46,0x6f,0x6f,0x4f,0x62,0x6a,0x65,0x63,0x74,0x3a,0x66,0x6f,
+0x6f,0x28,0x31,0x29,0x3e,0x00,0x00,0x25,0x23,0x3c,0x45,0x6e,0x75,0x6d,0x65,0x72,
+0x61,0x74,0x6f,0x72,0x3a,0x20,0x46,0x6f,0x6f,0x4f,0x62,0x6a,0x65,0x63,0x74,0x3a,
+0x66,0x6f,0x6f,0x28,0x31,0x2c,0x20,0x32,0x2c,0x20,0x33,0x29,0x3e,0x00,0x00,0x00,
+0x06,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,
+0x00,0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x03,
+0x6e,0x65,0x77,0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x00,0x00,0x98,0x00,0x04,
+0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x13,0x02,0x00,0x00,0x11,0x02,0x00,0x40,0x20,
+0x00,0x81,0x00,0x01,0x02,0x01,0x00,0x47,0x02,0x80,0x00,0xc0,0x02,0x00,0x80,0x46,
+0x01,0x01,0x00,0x37,0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,0x02,0x80,0x80,0x01,
+0x02,0x00,0x80,0xa0,0x01,0x81,0x00,0x01,0x02,0x01,0x00,0x20,0x02,0x00,0x00,0x06,
+0x02,0xc0,0x00,0x03,0x02,0x81,0x40,0xb7,0x03,0x00,0x80,0x01,0x02,0x01,0x41,0x20,
+0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x4f,0x62,
+0x6a,0x65,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x65,0x61,0x63,
+0x68,0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x04,0x6e,0x65,
+0x78,0x74,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x07,
+0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,0x01,0x80,0x00,0xa0,
+0x01,0x82,0x00,0x2b,0x01,0x80,0x40,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,
+0x00,0x00,0x01,0x9b,0x00,0x03,0x00,0x09,0x00,0x03,0x00,0x00,0x00,0x3f,0x01,0x80,
+0x00,0x11,0x01,0x80,0x40,0x20,0x00,0x80,0xc0,0x01,0x01,0x80,0xc0,0x47,0x02,0x00,
+0x00,0xc0,0x01,0x80,0x80,0x46,0x01,0x80,0x40,0x01,0x02,0x00,0x01,0x04,0x02,0x80,
+0x02,0x04,0x03,0x00,0x02,0x84,0x01,0x80,0xc1,0xa0,0x01,0x00,0xc0,0x01,0x01,0x80,
+0x00,0x06,0x02,0x00,0x02,0x04,0x02,0x80,0x02,0x84,0x03,0x01,0x80,0x37,0x02,0x01,
+0x01,0xb7,0x02,0x80,0x80,0x01,0x02,0x81,0xc0,0x20,0x02,0x82,0x00,0x20,0x01,0x81,
+0x81,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x80,0x01,0x02,0x01,0xc0,0x20,0x02,0x80,
+0x80,0x01,0x02,0x02,0x80,0xa0,0x01,0x82,0x40,0xa0,0x01,0x80,0x00,0x06,0x02,0x00,
+0x05,0x84,0x02,0x80,0x80,0x01,0x03,0x00,0x03,0x40,0x02,0x81,0xc0,0x21,0x01,0x81,
+0x81,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x04,0x02,0x80,0x02,0x84,0x03,0x00,
+0x06,0x04,0x03,0x80,0x06,0x84,0x03,0x01,0x81,0x37,0x02,0x01,0x01,0xb7,0x02,0x80,
+0x80,0x01,0x03,0x00,0x06,0x04,0x03,0x80,0x06,0x84,0x02,0x81,0xc1,0x20,0x02,0x82,
+0x00,0x20,0x01,0x81,0x81,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x80,0x01,0x02,0x80,
+0x06,0x04,0x03,0x00,0x06,0x84,0x02,0x01,0xc1,0x20,0x02,0x80,0x80,0x01,0x02,0x02,
+0x80,0xa0,0x01,0x83,0x80,0xa0,0x01,0x80,0x00,0x06,0x02,0x00,0x05,0x84,0x02,0x80,
+0x80,0x01,0x03,0x00,0x06,0x04,0x03,0x80,0x06,0x84,0x04,0x00,0x05,0x40,0x02,0x81,
+0xc1,0x21,0x01,0x81,0x81,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x0f,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,
+0x00,0x00,0x08,0x65,0x61,0x63,0x68,0x5f,0x61,0x72,0x67,0x00,0x00,0x07,0x74,0x6f,
+0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x01,0x61,0x00,0x00,0x01,0x78,0x00,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x65,
+0x61,0x63,0x68,0x00,0x00,0x04,0x74,0x6f,0x5f,0x61,0x00,0x00,0x0b,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x06,0x65,0x71,0x75,0x61,0x6c,
+0x3f,0x00,0x00,0x0f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x5f,0x72,0x65,0x74,0x75,0x72,
+0x6e,0x65,0x64,0x00,0x00,0x01,0x79,0x00,0x00,0x01,0x7a,0x00,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x66,0x61,0x6c,0x73,0x65,0x00,0x00,0x00,0x00,0x6f,0x00,
+0x05,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x0f,0x02,0x18,0x00,0x26,0x00,0x40,0x00,
+0x97,0x00,0x40,0x00,0x97,0x01,0x00,0x00,0x04,0x02,0x85,0x00,0x2b,0x03,0x00,0x40,
+0x01,0x02,0x80,0x40,0xa0,0x02,0x85,0x00,0x2b,0x03,0x00,0x80,0x01,0x02,0x80,0x40,
+0xa0,0x02,0x85,0x00,0x2b,0x03,0x00,0xc0,0x01,0x02,0x80,0x40,0xa0,0x02,0x80,0x01,
+0x04,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x01,0x62,
+0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x0f,0x6d,0x65,0x74,0x68,0x6f,0x64,
+0x5f,0x72,0x65,0x74,0x75,0x72,0x6e,0x65,0x64,0x00,0x00,0x00,0x00,0x1e,0x00,0x03,
+0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x03,0x00,0x04,
+0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x00,0x02,0x00,0x05,0x00,0x02,
+0x00,0x00,0x00,0x0b,0x01,0x40,0x01,0x03,0x01,0x00,0x00,0x20,0x00,0x80,0x80,0x01,
+0x01,0x40,0x01,0x03,0x01,0x80,0x01,0x40,0x01,0x00,0x00,0x21,0x01,0x00,0x00,0x06,
+0x01,0x80,0x01,0x11,0x02,0x00,0x03,0x40,0x01,0x00,0x40,0xa1,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,
+0x0d,0x53,0x74,0x6f,0x70,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x00,0x00,
+0x00,0x00,0x48,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x02,0x00,0x00,
+0x26,0x01,0x80,0x00,0x06,0x02,0x00,0x40,0x01,0x02,0x80,0x40,0x15,0x02,0x80,0x40,
+0x20,0x01,0x80,0x01,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,
+0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x03,0x00,
+0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x40,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,
+0x00,0x00,0x01,0x1a,0x00,0x03,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x30,0x01,0x80,
+0x00,0x11,0x01,0x80,0x40,0x20,0x00,0x80,0xc0,0x01,0x01,0x80,0xc0,0x47,0x02,0x00,
+0x00,0xc0,0x01,0x80,0x80,0x46,0x01,0x80,0x40,0x01,0x01,0x80,0xc0,0x20,0x01,0x00,
+0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x05,0x02,0x80,0x80,0x01,0x02,0x81,
+0x40,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0x80,
+0x80,0x01,0x02,0x81,0x40,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,
+0x00,0x03,0x02,0xc0,0x00,0x83,0x02,0x01,0x01,0x37,0x02,0x80,0x80,0x01,0x02,0x81,
+0x40,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x40,0x01,0x01,0x80,0xc0,0x20,0x01,0x00,
+0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x01,0x00,0x37,0x02,0x80,0x80,0x01,0x02,0x81,
+0x80,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0x01,
+0x00,0xb7,0x02,0x80,0x80,0x01,0x02,0x81,0x80,0x20,0x01,0x81,0x01,0x20,0x01,0x80,
+0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x02,0x01,0x01,0x37,0x02,0x80,
+0x80,0x01,0x02,0x81,0x80,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,
+0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x07,0x74,0x6f,
+0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x0b,0x6e,0x65,
+0x78,0x74,0x5f,0x76,0x61,0x6c,0x75,0x65,0x73,0x00,0x00,0x00,0x00,0x49,0x00,0x02,
+0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,
+0x01,0x00,0x00,0x20,0x01,0x00,0x00,0x2b,0x01,0xc0,0x00,0x03,0x01,0x00,0x00,0xa0,
+0x01,0x00,0x00,0x2b,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x01,0x00,0x01,0x20,
+0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,
+0x6c,0x6c,0x00,0x00,0x00,0x00,0xcd,0x00,0x03,0x00,0x07,0x00,0x02,0x00,0x00,0x00,
+0x1d,0x01,0xc0,0x00,0x03,0x00,0x80,0xc0,0xb7,0x01,0x80,0x40,0x01,0x01,0x80,0x00,
+0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0x80,0x80,
+0x01,0x02,0x80,0x80,0x20,0x01,0x80,0x41,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,
+0x03,0x02,0x80,0x80,0x01,0x02,0x80,0x80,0x20,0x01,0x80,0x41,0x20,0x01,0x80,0x00,
+0x06,0x02,0x40,0x00,0x03,0x02,0x80,0x80,0x01,0x02,0x80,0xc0,0x20,0x01,0x80,0x41,
+0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x91,0x02,0x80,0x01,0x40,0x01,0x81,0x00,
+0xa1,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x91,0x02,0x80,0x03,0x40,0x01,0x81,0x00,
+0xa1,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x04,0x65,
+0x61,0x63,0x68,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,
+0x61,0x6c,0x00,0x00,0x04,0x70,0x65,0x65,0x6b,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,
+0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,
+0x00,0x0d,0x53,0x74,0x6f,0x70,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x00,
+0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,
+0x80,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x04,0x70,0x65,0x65,0x6b,0x00,0x00,0x00,0x00,0x29,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x80,0x15,0x00,0x80,0x00,0x20,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x70,0x65,0x65,
+0x6b,0x00,0x00,0x00,0x00,0xa5,0x00,0x04,0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x15,
+0x02,0x00,0x00,0x11,0x02,0x00,0x40,0x20,0x00,0x81,0x00,0x01,0x02,0x01,0x00,0x47,
+0x02,0x80,0x00,0xc0,0x02,0x00,0x80,0x46,0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,
+0x01,0x01,0x00,0x01,0x02,0x01,0x00,0x20,0x01,0x81,0x00,0x01,0x02,0xc0,0x01,0x03,
+0x02,0x01,0x40,0xa0,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,
+0x02,0x81,0x41,0x37,0x03,0x00,0x80,0x01,0x03,0x01,0x00,0x20,0x02,0x01,0x81,0x20,
+0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x06,0x4f,0x62,
+0x6a,0x65,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x65,0x61,0x63,
+0x68,0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x04,0x70,0x65,
+0x65,0x6b,0x00,0x00,0x02,0x3c,0x3c,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x35,0x00,0x02,0x00,0x05,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0xc0,0x00,
+0x03,0x02,0x40,0x00,0x83,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x02,0xeb,
+0x00,0x03,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x9f,0x01,0x80,0x00,0x11,0x01,0x80,
+0x40,0x20,0x00,0x80,0xc0,0x01,0x01,0x80,0xc0,0x47,0x02,0x00,0x00,0xc0,0x01,0x80,
+0x80,0x46,0x01,0x80,0x40,0x01,0x01,0x80,0xc0,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,
+0x00,0x06,0x02,0x00,0x00,0x05,0x02,0x80,0x80,0x01,0x02,0x81,0x40,0x20,0x01,0x81,
+0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x05,0x02,0x80,0x80,0x01,0x02,0x81,
+0x80,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0x80,
+0x80,0x01,0x02,0x81,0x40,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,
+0x00,0x03,0x02,0x80,0x80,0x01,0x02,0x81,0x80,0x20,0x01,0x81,0x01,0x20,0x01,0x80,
+0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x02,0x01,0x01,0x37,0x02,0x80,
+0x80,0x01,0x02,0x81,0x40,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,
+0x00,0x03,0x02,0xc0,0x00,0x83,0x02,0x01,0x01,0x37,0x02,0x80,0x80,0x01,0x02,0x81,
+0x80,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x40,0x01,0x01,0x80,0xc0,0x20,0x01,0x00,
+0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x01,0x00,0x37,0x02,0x80,0x80,0x01,0x02,0x81,
+0xc0,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x01,0x00,0x37,0x02,0x80,
+0x80,0x01,0x02,0x82,0x00,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,
+0x00,0x03,0x02,0x01,0x00,0xb7,0x02,0x80,0x80,0x01,0x02,0x81,0xc0,0x20,0x01,0x81,
+0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0x01,0x00,0xb7,0x02,0x80,
+0x80,0x01,0x02,0x82,0x00,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,
+0x00,0x03,0x02,0xc0,0x00,0x83,0x02,0x01,0x01,0x37,0x02,0x80,0x80,0x01,0x02,0x81,
+0xc0,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,
+0x00,0x83,0x02,0x01,0x01,0x37,0x02,0x80,0x80,0x01,0x02,0x82,0x00,0x20,0x01,0x81,
+0x01,0x20,0x01,0x80,0x40,0x01,0x01,0x80,0xc0,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,
+0x00,0x06,0x02,0x01,0x00,0x37,0x02,0x80,0x80,0x01,0x02,0x81,0xc0,0x20,0x01,0x81,
+0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x05,0x02,0x80,0x80,0x01,0x02,0x81,
+0x80,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0x01,
+0x00,0xb7,0x02,0x80,0x80,0x01,0x02,0x81,0xc0,0x20,0x01,0x81,0x01,0x20,0x01,0x80,
+0x00,0x06,0x02,0x40,0x00,0x03,0x02,0x80,0x80,0x01,0x02,0x81,0x80,0x20,0x01,0x81,
+0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x02,0x01,
+0x01,0x37,0x02,0x80,0x80,0x01,0x02,0x81,0xc0,0x20,0x01,0x81,0x01,0x20,0x01,0x80,
+0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x02,0x01,0x01,0x37,0x02,0x80,
+0x80,0x01,0x02,0x81,0x80,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x40,0x01,0x01,0x80,
+0xc0,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x05,0x02,0x80,
+0x80,0x01,0x02,0x81,0x40,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x01,
+0x00,0x37,0x02,0x80,0x80,0x01,0x02,0x82,0x00,0x20,0x01,0x81,0x01,0x20,0x01,0x80,
+0x00,0x06,0x02,0x40,0x00,0x03,0x02,0x80,0x80,0x01,0x02,0x81,0x40,0x20,0x01,0x81,
+0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0x01,0x00,0xb7,0x02,0x80,
+0x80,0x01,0x02,0x82,0x00,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,
+0x00,0x03,0x02,0xc0,0x00,0x83,0x02,0x01,0x01,0x37,0x02,0x80,0x80,0x01,0x02,0x81,
+0x40,0x20,0x01,0x81,0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,
+0x00,0x83,0x02,0x01,0x01,0x37,0x02,0x80,0x80,0x01,0x02,0x82,0x00,0x20,0x01,0x81,
+0x01,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x06,
+0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x65,
+0x61,0x63,0x68,0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x70,
+0x65,0x65,0x6b,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x0b,0x70,0x65,0x65,
+0x6b,0x5f,0x76,0x61,0x6c,0x75,0x65,0x73,0x00,0x00,0x0b,0x6e,0x65,0x78,0x74,0x5f,
+0x76,0x61,0x6c,0x75,0x65,0x73,0x00,0x00,0x00,0x00,0x49,0x00,0x02,0x00,0x05,0x00,
+0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0x00,0x00,
+0x20,0x01,0x00,0x00,0x2b,0x01,0xc0,0x00,0x03,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,
+0x2b,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,
+0x00,0x00,0x00,0xb3,0x00,0x04,0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x15,0x02,0x00,
+0x00,0x11,0x02,0x00,0x40,0x20,0x00,0x81,0x00,0x01,0x02,0x01,0x00,0x47,0x02,0x80,
+0x00,0xc0,0x02,0x00,0x80,0x46,0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,0x01,0x01,
+0x00,0x01,0x02,0x01,0x00,0x20,0x01,0x81,0x00,0x01,0x02,0xc0,0x01,0x03,0x02,0x01,
+0x40,0xa0,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x02,0x81,
+0x41,0x37,0x03,0x00,0x80,0x01,0x03,0x01,0xc0,0x20,0x02,0x01,0x81,0x20,0x02,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x06,0x4f,0x62,0x6a,0x65,
+0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,
+0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x0b,0x70,0x65,0x65,0x6b,
+0x5f,0x76,0x61,0x6c,0x75,0x65,0x73,0x00,0x00,0x02,0x3c,0x3c,0x00,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x70,0x65,
+0x65,0x6b,0x00,0x00,0x00,0x00,0x35,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x00,0x00,
+0x06,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,
+0x83,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x01,0x0a,0x00,0x04,0x00,0x08,
+0x00,0x02,0x00,0x00,0x00,0x26,0x02,0x00,0x00,0x11,0x02,0x00,0x40,0x20,0x00,0x81,
+0x00,0x01,0x02,0x01,0x00,0x47,0x02,0x80,0x00,0xc0,0x02,0x00,0x80,0x46,0x01,0x01,
+0x00,0x37,0x02,0x00,0x40,0x01,0x02,0x80,0x01,0x04,0x03,0x00,0x80,0x01,0x02,0x00,
+0xc1,0x20,0x01,0x81,0x00,0x01,0x02,0x01,0x00,0x20,0x02,0x00,0xc0,0x01,0x02,0xc0,
+0x00,0x03,0x02,0x01,0x40,0xa0,0x02,0x00,0xc0,0x01,0x02,0x01,0x00,0x20,0x02,0x00,
+0xc0,0x01,0x02,0xc0,0x00,0x83,0x02,0x01,0x40,0xa0,0x02,0x00,0xc0,0x01,0x02,0x01,
+0x00,0x20,0x02,0x00,0xc0,0x01,0x02,0xc0,0x01,0x03,0x02,0x01,0x40,0xa0,0x02,0x00,
+0x00,0x06,0x02,0x80,0x03,0x91,0x03,0x00,0x03,0x40,0x02,0x01,0x80,0xa1,0x02,0x00,
+0x00,0x06,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x02,0x81,
+0x41,0xb7,0x03,0x00,0x80,0x01,0x02,0x02,0x01,0x20,0x02,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,
+0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x07,0x74,0x6f,
+0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x04,0x66,
+0x65,0x65,0x64,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,
+0x73,0x65,0x00,0x00,0x0d,0x53,0x74,0x6f,0x70,0x49,0x74,0x65,0x72,0x61,0x74,0x69,
+0x6f,0x6e,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x00,0x00,0x5a,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0e,
+0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,0x40,0x20,
+0x01,0x80,0x00,0xa0,0x01,0x80,0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,0x40,0x20,
+0x01,0x80,0x00,0xa0,0x01,0x80,0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,0x40,0x20,
+0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x02,0x3c,0x3c,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x29,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0xc0,0x15,0x00,0x80,
+0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,
+0x6e,0x65,0x78,0x74,0x00,0x00,0x00,0x00,0xfe,0x00,0x04,0x00,0x08,0x00,0x02,0x00,
+0x00,0x00,0x23,0x02,0x00,0x00,0x11,0x02,0x00,0x40,0x20,0x00,0x81,0x00,0x01,0x02,
+0x01,0x00,0x47,0x02,0x80,0x00,0xc0,0x02,0x00,0x80,0x46,0x01,0x01,0x00,0x37,0x02,
+0x00,0x40,0x01,0x02,0x80,0x01,0x04,0x03,0x00,0x80,0x01,0x02,0x00,0xc1,0x20,0x01,
+0x81,0x00,0x01,0x02,0x01,0x00,0x20,0x02,0x00,0xc0,0x01,0x02,0xc0,0x00,0x03,0x02,
+0x01,0x40,0xa0,0x02,0x00,0xc0,0x01,0x02,0x01,0x00,0x20,0x02,0x00,0xc0,0x01,0x02,
+0x01,0x00,0x20,0x02,0x00,0xc0,0x01,0x02,0xc0,0x01,0x03,0x02,0x01,0x40,0xa0,0x02,
+0x00,0x00,0x06,0x02,0x80,0x03,0x91,0x03,0x00,0x03,0x40,0x02,0x01,0x80,0xa1,0x02,
+0x00,0x00,0x06,0x02,0xc0,0x00,0x03,0x03,0x00,0x00,0x05,0x03,0xc0,0x01,0x03,0x02,
+0x81,0x41,0xb7,0x03,0x00,0x80,0x01,0x02,0x02,0x01,0x20,0x02,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,
+0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x07,0x74,
+0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x04,
+0x66,0x65,0x65,0x64,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,
+0x69,0x73,0x65,0x00,0x00,0x0d,0x53,0x74,0x6f,0x70,0x49,0x74,0x65,0x72,0x61,0x74,
+0x69,0x6f,0x6e,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,
+0x61,0x6c,0x00,0x00,0x00,0x00,0x5a,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,0x40,
+0x20,0x01,0x80,0x00,0xa0,0x01,0x80,0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,0x40,
+0x20,0x01,0x80,0x00,0xa0,0x01,0x80,0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,0x40,
+0x20,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,
+0x29,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0xc0,0x15,0x00,
+0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x00,0x00,0xa4,0x00,0x04,0x00,0x08,0x00,0x02,
+0x00,0x00,0x00,0x13,0x02,0x00,0x00,0x11,0x02,0x00,0x40,0x20,0x00,0x81,0x00,0x01,
+0x02,0x01,0x00,0x47,0x02,0x80,0x00,0xc0,0x02,0x00,0x80,0x46,0x01,0x01,0x00,0x37,
+0x02,0x00,0x40,0x01,0x02,0x80,0x01,0x04,0x03,0x00,0x80,0x01,0x02,0x00,0xc1,0x20,
+0x01,0x81,0x00,0x01,0x02,0xc0,0x00,0x03,0x02,0x01,0x00,0xa0,0x02,0x00,0x00,0x06,
+0x02,0x80,0x03,0x11,0x03,0x00,0x03,0x40,0x02,0x01,0x40,0xa1,0x02,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,
+0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x07,
+0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x04,0x66,0x65,0x65,0x64,0x00,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x09,
+0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x5a,0x00,0x03,
+0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,
+0x02,0x02,0x00,0x2b,0x02,0x00,0x40,0x20,0x01,0x80,0x00,0xa0,0x01,0x80,0x40,0x01,
+0x02,0x02,0x00,0x2b,0x02,0x00,0x40,0x20,0x01,0x80,0x00,0xa0,0x01,0x80,0x40,0x01,
+0x02,0x02,0x00,0x2b,0x02,0x00,0x40,0x20,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,0x04,0x63,
+0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x80,0xc0,0x15,0x01,0x40,0x00,0x83,0x00,0x80,0x00,0xa0,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x66,0x65,0x65,0x64,
+0x00,0x00,0x00,0x00,0xb3,0x00,0x04,0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x18,0x02,
+0x00,0x00,0x11,0x02,0x00,0x40,0x20,0x00,0x81,0x00,0x01,0x02,0x01,0x00,0x47,0x02,
+0x80,0x00,0xc0,0x02,0x00,0x80,0x46,0x01,0x01,0x00,0x37,0x02,0x00,0x40,0x01,0x02,
+0x80,0x01,0x04,0x03,0x00,0x80,0x01,0x02,0x00,0xc1,0x20,0x01,0x81,0x00,0x01,0x02,
+0xc0,0x00,0x03,0x02,0x01,0x00,0xa0,0x02,0x00,0xc0,0x01,0x02,0x01,0x40,0x20,0x02,
+0x00,0xc0,0x01,0x02,0x01,0x40,0x20,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x03,0x02,
+0x81,0x40,0xb7,0x03,0x00,0x80,0x01,0x02,0x01,0x81,0x20,0x02,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,
+0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x07,0x74,
+0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x04,0x66,0x65,0x65,0x64,0x00,0x00,0x04,
+0x6e,0x65,0x78,0x74,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x5a,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,
+0x00,0x0e,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,
+0x40,0x20,0x01,0x80,0x00,0xa0,0x01,0x80,0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,
+0x40,0x20,0x01,0x80,0x00,0xa0,0x01,0x80,0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,
+0x40,0x20,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,
+0x00,0xad,0x00,0x03,0x00,0x07,0x00,0x02,0x00,0x00,0x00,0x12,0x00,0x80,0x00,0x05,
+0x01,0x80,0x00,0x11,0x02,0x00,0x01,0x40,0x01,0x80,0x40,0x21,0x01,0x00,0xc0,0x01,
+0x01,0x80,0x80,0x20,0x01,0x80,0x80,0x01,0x02,0x40,0x31,0x83,0x01,0x80,0xc0,0xa0,
+0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x91,0x02,0x80,0x03,0x40,0x01,0x81,0x00,0xa1,
+0x01,0x80,0x00,0x06,0x02,0x40,0x31,0x83,0x02,0x80,0x40,0x01,0x01,0x81,0x81,0x20,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x0a,0x45,0x6e,
+0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x04,0x66,0x65,0x65,0x64,0x00,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,0x53,0x74,
+0x6f,0x70,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x00,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x36,0x00,
+0x03,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x40,
+0x01,0x01,0x80,0x00,0x20,0x01,0x80,0x40,0x16,0x01,0xc0,0x04,0x83,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x79,0x69,0x65,0x6c,0x64,
+0x00,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x80,0x80,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x00,0x01,0x07,0x00,0x02,
+0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x27,0x01,0x00,0x00,0x0d,0x01,0x80,0x01,0x04,
+0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x01,0x00,0x42,0x20,
+0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x40,0x01,
+0x02,0x01,0x00,0x20,0x01,0x00,0xc1,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x83,
+0x02,0x00,0x40,0x01,0x02,0x01,0x00,0x20,0x01,0x00,0xc1,0x20,0x01,0x00,0x40,0x01,
+0x01,0x01,0x40,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x00,0x40,0x01,
+0x02,0x01,0x00,0x20,0x01,0x00,0xc1,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x83,
+0x02,0x00,0x40,0x01,0x02,0x01,0x00,0x20,0x01,0x00,0xc1,0x20,0x01,0x00,0x00,0x06,
+0x01,0xc0,0x01,0x03,0x02,0x00,0x40,0x01,0x02,0x01,0x00,0x20,0x01,0x00,0xc1,0x20,
+0x01,0x00,0x00,0x06,0x01,0x80,0x03,0x91,0x02,0x00,0x01,0x40,0x01,0x01,0x80,0xa1,
+0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x04,0x40,0x6f,
+0x62,0x6a,0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x03,0x66,
+0x6f,0x6f,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,
+0x6c,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x06,0x72,0x65,0x77,0x69,0x6e,
+0x64,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,
+0x00,0x00,0x0d,0x53,0x74,0x6f,0x70,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,
+0x00,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x80,0x40,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x00,0x00,0xe4,0x00,0x04,
+0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x11,0x02,0x00,0x40,0x20,
+0x00,0x81,0x00,0x01,0x02,0x01,0x00,0x47,0x02,0x80,0x00,0xc0,0x02,0x00,0x80,0x46,
+0x01,0x01,0x00,0x37,0x02,0x00,0x40,0x01,0x02,0x80,0x01,0x04,0x03,0x00,0x80,0x01,
+0x02,0x00,0xc1,0x20,0x01,0x81,0x00,0x01,0x02,0x01,0x00,0x20,0x02,0x00,0xc0,0x01,
+0x02,0xc0,0x00,0x03,0x02,0x01,0x40,0xa0,0x02,0x00,0xc0,0x01,0x02,0x01,0x00,0x20,
+0x02,0x00,0xc0,0x01,0x02,0xc0,0x00,0x83,0x02,0x01,0x40,0xa0,0x02,0x00,0xc0,0x01,
+0x02,0x01,0x80,0x20,0x02,0x00,0xc0,0x01,0x02,0x01,0x00,0x20,0x02,0x00,0xc0,0x01,
+0x02,0x01,0x00,0x20,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x03,0x03,0x00,0x00,0x05,
+0x02,0x81,0x41,0x37,0x03,0x00,0x80,0x01,0x02,0x01,0xc1,0x20,0x02,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,
+0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x07,
+0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,
+0x04,0x66,0x65,0x65,0x64,0x00,0x00,0x06,0x72,0x65,0x77,0x69,0x6e,0x64,0x00,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,
+0x00,0x5a,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x00,0x26,
+0x01,0x80,0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,0x40,0x20,0x01,0x80,0x00,0xa0,
+0x01,0x80,0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,0x40,0x20,0x01,0x80,0x00,0xa0,
+0x01,0x80,0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,0x40,0x20,0x01,0x80,0x00,0xa0,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,
+0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0xe4,0x00,0x04,0x00,0x08,
+0x00,0x01,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x11,0x02,0x00,0x40,0x20,0x00,0x81,
+0x00,0x01,0x02,0x01,0x00,0x47,0x02,0x80,0x00,0xc0,0x02,0x00,0x80,0x46,0x01,0x01,
+0x00,0x37,0x02,0x00,0x40,0x01,0x02,0x80,0x01,0x04,0x03,0x00,0x80,0x01,0x02,0x00,
+0xc1,0x20,0x01,0x81,0x00,0x01,0x02,0x01,0x00,0x20,0x02,0x00,0xc0,0x01,0x02,0xc0,
+0x00,0x03,0x02,0x01,0x40,0xa0,0x02,0x00,0xc0,0x01,0x02,0x01,0x00,0x20,0x02,0x00,
+0xc0,0x01,0x02,0xc0,0x00,0x83,0x02,0x01,0x40,0xa0,0x02,0x00,0xc0,0x01,0x02,0x01,
+0x80,0x20,0x02,0x00,0xc0,0x01,0x02,0x01,0x00,0x20,0x02,0x00,0xc0,0x01,0x02,0x01,
+0x00,0x20,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x03,0x03,0x00,0x00,0x05,0x02,0x81,
+0x41,0x37,0x03,0x00,0x80,0x01,0x02,0x01,0xc1,0x20,0x02,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,
+0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x07,0x74,0x6f,
+0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x04,0x66,
+0x65,0x65,0x64,0x00,0x00,0x06,0x72,0x65,0x77,0x69,0x6e,0x64,0x00,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x5a,
+0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x00,0x26,0x01,0x80,
+0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,0x40,0x20,0x01,0x80,0x00,0xa0,0x01,0x80,
+0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,0x40,0x20,0x01,0x80,0x00,0xa0,0x01,0x80,
+0x40,0x01,0x02,0x02,0x00,0x2b,0x02,0x00,0x40,0x20,0x01,0x80,0x00,0xa0,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,
+0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0xe7,0x00,0x04,0x00,0x08,0x00,0x03,
+0x00,0x00,0x00,0x24,0x02,0x00,0x00,0x91,0x02,0x00,0x00,0x13,0x02,0x80,0x01,0x40,
+0x02,0x00,0x80,0x21,0x00,0x81,0x00,0x01,0x02,0x00,0xc0,0x20,0x01,0x01,0x00,0x01,
+0x01,0x81,0x00,0x37,0x02,0x00,0x00,0x06,0x02,0x80,0x02,0x84,0x03,0x00,0x40,0x01,
+0x03,0x80,0x03,0x40,0x03,0x01,0x80,0x21,0x02,0x01,0x01,0x20,0x02,0x00,0x00,0x06,
+0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x02,0x81,0x41,0xb7,
+0x03,0x00,0xc0,0x01,0x02,0x01,0x01,0x20,0x01,0x81,0x00,0x37,0x02,0x00,0x00,0x06,
+0x02,0x80,0x02,0x84,0x03,0x00,0x80,0x01,0x03,0x80,0x05,0x40,0x03,0x01,0x80,0x21,
+0x02,0x01,0x01,0x20,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,
+0x03,0xc0,0x01,0x03,0x02,0x81,0x41,0xb7,0x03,0x00,0xc0,0x01,0x02,0x01,0x01,0x20,
+0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x09,0x47,0x65,
+0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,
+0x61,0x74,0x6f,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x03,0x64,0x75,0x70,
+0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,
+0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,
+0x49,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0a,0x02,0x00,0x00,0x26,0x01,
+0x80,0x40,0x01,0x02,0x40,0x00,0x03,0x01,0x80,0x00,0xa0,0x02,0x40,0x00,0x83,0x01,
+0x80,0x00,0xa0,0x02,0x40,0x01,0x03,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x84,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,
+0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x06,0x00,0x00,
+0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,0x01,
+0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
+0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,0x01,0x01,
+0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0xa5,0x00,0x03,0x00,0x08,0x00,0x02,0x00,0x00,
+0x00,0x15,0x01,0x80,0x00,0x91,0x01,0x80,0x00,0x13,0x02,0x00,0x01,0x40,0x01,0x80,
+0x80,0x21,0x00,0x80,0xc0,0x01,0x01,0x00,0xc0,0x37,0x01,0x80,0x00,0x06,0x02,0x00,
+0x02,0x04,0x02,0x80,0x40,0x01,0x03,0x00,0x02,0x04,0x03,0x80,0x03,0x40,0x02,0x81,
+0x40,0xa1,0x01,0x80,0xc1,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,
+0x00,0x83,0x03,0x40,0x01,0x03,0x02,0x01,0x01,0xb7,0x02,0x80,0x80,0x01,0x01,0x80,
+0xc1,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x09,
+0x47,0x65,0x6e,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x0a,0x45,0x6e,0x75,0x6d,
+0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x03,0x62,0x61,
+0x72,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x3f,0x00,0x04,0x00,
+0x07,0x00,0x00,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,
+0xc0,0x00,0x03,0x02,0x00,0x00,0xa0,0x02,0xc0,0x00,0x83,0x02,0x00,0x00,0xa0,0x02,
+0xc0,0x01,0x03,0x02,0x00,0x00,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x06,
+0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x80,0x15,0x02,0x00,
+0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x01,0x57,0x00,0x03,0x00,0x08,0x00,
+0x03,0x00,0x00,0x00,0x3a,0x00,0x80,0xc0,0x37,0x01,0x80,0x00,0x91,0x01,0x80,0x00,
+0x13,0x02,0x00,0x01,0x40,0x01,0x80,0x80,0x21,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,
+0x06,0x02,0x00,0x80,0x01,0x02,0x80,0x80,0x01,0x03,0x40,0x00,0x03,0x02,0x81,0x00,
+0xa0,0x03,0x40,0x00,0x83,0x02,0x81,0x00,0xa0,0x03,0x40,0x01,0x03,0x02,0x81,0x00,
+0xa0,0x01,0x80,0xc1,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,
+0x83,0x03,0x40,0x01,0x03,0x02,0x01,0x01,0xb7,0x02,0x80,0x40,0x01,0x01,0x80,0xc1,
+0x20,0x00,0x80,0xc0,0x37,0x01,0x80,0x00,0x91,0x01,0x80,0x00,0x13,0x02,0x00,0x03,
+0x40,0x01,0x80,0x80,0x21,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x40,0x00,
+0x03,0x02,0x01,0x00,0xb7,0x02,0x80,0x80,0x01,0x03,0x40,0x00,0x03,0x02,0x81,0x40,
+0xa0,0x01,0x80,0xc1,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,
+0x83,0x02,0x01,0x01,0x37,0x02,0x80,0x80,0x01,0x03,0x40,0x00,0x83,0x02,0x81,0x40,
+0xa0,0x01,0x80,0xc1,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,
+0x83,0x03,0x40,0x01,0x03,0x02,0x01,0x01,0xb7,0x02,0x80,0x80,0x01,0x03,0x40,0x01,
+0x03,0x02,0x81,0x40,0xa0,0x01,0x80,0xc1,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x03,
+0x91,0x02,0x80,0x05,0x40,0x01,0x81,0x80,0xa1,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x08,0x00,0x07,0x59,0x69,0x65,0x6c,0x64,0x65,0x72,0x00,0x00,
+0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x03,0x6e,0x65,
+0x77,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x02,0x3c,0x3c,0x00,0x00,0x05,0x79,0x69,0x65,0x6c,0x64,0x00,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0e,0x4c,
+0x6f,0x63,0x61,0x6c,0x4a,0x75,0x6d,0x70,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,
+0x00,0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,
+0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,
+0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,
+0x80,0x40,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x43,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x91,0x00,0x80,
+0x00,0x13,0x00,0x80,0x80,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x03,0x00,0x07,0x59,0x69,0x65,0x6c,0x64,0x65,0x72,0x00,0x00,0x0a,0x45,0x6e,
+0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x00,0x00,0xe3,0x00,0x03,0x00,0x07,0x00,0x04,0x00,0x00,0x00,0x22,0x01,0xc0,0x00,
+0x03,0x00,0x80,0xc0,0xb7,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x00,0xc0,
+0x01,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0x80,0x80,0x01,0x02,0x80,0x80,
+0x20,0x01,0x80,0x41,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x11,0x02,0x80,0x01,
+0x40,0x01,0x80,0xc0,0xa1,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x11,0x02,0x80,0x03,
+0x40,0x01,0x80,0xc0,0xa1,0x01,0x80,0x80,0x01,0x01,0x81,0x40,0x20,0x01,0x80,0x00,
+0x06,0x02,0x40,0x00,0x03,0x02,0x80,0x80,0x01,0x02,0x80,0x80,0x20,0x01,0x80,0x41,
+0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x11,0x02,0x80,0x05,0x40,0x01,0x80,0xc0,
+0xa1,0x01,0x80,0x00,0x06,0x02,0x00,0x02,0x11,0x02,0x80,0x07,0x40,0x01,0x80,0xc0,
+0xa1,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x04,0x65,
+0x61,0x63,0x68,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,
+0x61,0x6c,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,0x53,0x74,0x6f,0x70,0x49,
+0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x00,0x00,0x06,0x72,0x65,0x77,0x69,0x6e,
+0x64,0x00,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x80,0x80,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x00,0x00,0x29,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x80,0x15,0x00,0x80,0x00,
+0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x6e,
+0x65,0x78,0x74,0x00,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,
+0x00,0x03,0x00,0x80,0x80,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x00,0x00,
+0x29,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x80,0x15,0x00,
+0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x00,0x00,0x3e,0x00,0x01,0x00,0x03,0x00,0x01,
+0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x40,0x00,0x80,0x00,0x21,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x15,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x6e,0x6f,0x74,0x68,0x69,0x6e,0x67,0x5f,0x72,0x61,0x69,
+0x73,0x65,0x64,0x00,0x00,0x00,0x00,0x43,0x00,0x01,0x00,0x03,0x00,0x01,0x00,0x00,
+0x00,0x06,0x00,0xc0,0x00,0x03,0x01,0x00,0x01,0x40,0x00,0x80,0x00,0x21,0x00,0x80,
+0x00,0x91,0x00,0x80,0x80,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x03,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x02,0x47,0x43,0x00,0x00,
+0x05,0x73,0x74,0x61,0x72,0x74,0x00,0x00,0x00,0x00,0x51,0x00,0x02,0x00,0x05,0x00,
+0x00,0x00,0x00,0x00,0x09,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,
+0x03,0x01,0x00,0x81,0xb7,0x01,0x00,0x00,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x00,
+0x91,0x01,0x00,0x80,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x02,0x47,0x43,0x00,
+0x00,0x05,0x73,0x74,0x61,0x72,0x74,0x00,0x00,0x00,0x00,0xd7,0x00,0x03,0x00,0x07,
+0x00,0x02,0x00,0x00,0x00,0x18,0x01,0x80,0x00,0x91,0x01,0x80,0x80,0x20,0x00,0x80,
+0xc0,0x01,0x01,0x80,0xc0,0x47,0x02,0x00,0x00,0xc0,0x01,0x80,0x00,0x46,0x01,0x80,
+0x40,0x01,0x01,0x80,0xc0,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x00,
+0x02,0x84,0x02,0x80,0x80,0x01,0x02,0x81,0x80,0x20,0x01,0x81,0x01,0x20,0x01,0x80,
+0x00,0x06,0x02,0x00,0x03,0x84,0x02,0x80,0x80,0x01,0x02,0x81,0x80,0x20,0x01,0x81,
+0x01,0x20,0x01,0x80,0x00,0x06,0x02,0x00,0x04,0x91,0x02,0x80,0x03,0x40,0x01,0x82,
+0x00,0xa1,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x04,
+0x65,0x61,0x63,0x68,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x03,
+0x6e,0x65,0x77,0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x03,0x6f,
+0x6b,0x31,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x03,0x6f,0x6b,0x32,0x00,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,
+0x0d,0x53,0x74,0x6f,0x70,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x00,0x00,
+0x00,0x00,0x6b,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+0x26,0x01,0x00,0x00,0x2b,0x01,0x80,0x00,0x04,0x01,0x00,0x40,0xa0,0x01,0x00,0x00,
+0x2b,0x01,0x80,0x01,0x04,0x02,0x00,0x01,0x84,0x01,0x80,0xc1,0x37,0x01,0x81,0x00,
+0x20,0x01,0x81,0x40,0x20,0x01,0x00,0x40,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x03,0x6f,0x6b,0x31,0x00,0x00,0x04,0x63,0x61,0x6c,
+0x6c,0x00,0x00,0x03,0x6f,0x6b,0x32,0x00,0x00,0x01,0x78,0x00,0x00,0x04,0x65,0x61,
+0x63,0x68,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x00,0x00,0x29,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x80,0x15,0x00,0x80,0x00,0x20,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x6e,0x65,
+0x78,0x74,0x00,0x00,0x00,0x00,0x8f,0x00,0x01,0x00,0x05,0x00,0x01,0x00,0x00,0x00,
+0x0b,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0xc0,0x37,0x01,0x80,0x80,
+0x20,0x01,0x80,0xc0,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x02,
+0x91,0x01,0x80,0x01,0x40,0x00,0x81,0x00,0xa1,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,
+0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x05,0x63,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,
+0x65,0x00,0x00,0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,
+0x72,0x00,0x00,0x00,0x00,0x2c,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,0x6d,0x00,0x00,0x00,
+0x00,0x9e,0x00,0x04,0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x12,0x02,0x00,0x00,0x06,
+0x02,0x80,0x00,0x91,0x03,0x00,0x00,0x06,0x03,0x00,0x80,0x20,0x03,0x00,0xc0,0x20,
+0x02,0x00,0x01,0x20,0x02,0x40,0x01,0x03,0x02,0x01,0x00,0x20,0x00,0x81,0x00,0x01,
+0x01,0x3f,0xff,0x83,0x02,0x00,0x00,0x06,0x02,0x80,0x01,0x40,0x02,0x00,0x80,0x21,
+0x01,0x81,0x00,0x01,0x02,0x00,0x00,0x06,0x02,0x80,0xc0,0x01,0x02,0x01,0x40,0xa0,
+0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x0a,0x45,0x6e,0x75,
+0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,0x00,0x04,0x6c,0x6f,0x6f,0x70,0x00,0x00,
+0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,
+0x0a,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x6e,0x69,0x6c,0x00,0x00,0x00,0x00,0x54,
+0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x06,0x01,0x00,
+0x80,0x15,0x01,0x80,0x40,0x15,0x01,0x80,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,
+0x80,0x15,0x00,0x80,0x80,0xad,0x00,0x80,0x80,0x16,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,
+0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,0x00,0x01,0x2b,0x00,
+0x00,0x00,0x00,0xb8,0x00,0x04,0x00,0x08,0x00,0x01,0x00,0x00,0x00,0x1a,0x00,0xc0,
+0x01,0x03,0x02,0x00,0x40,0x01,0x02,0x00,0x00,0x20,0x01,0x01,0x00,0x01,0x01,0x81,
+0x00,0x37,0x02,0x00,0x80,0x01,0x02,0x80,0xc0,0x01,0x03,0x00,0x01,0x40,0x02,0x00,
+0x40,0xa1,0x02,0x00,0x00,0x06,0x02,0xc0,0x01,0x03,0x03,0x00,0x40,0x01,0x02,0x00,
+0x81,0x20,0x02,0x00,0x00,0x06,0x02,0x80,0x01,0x91,0x03,0x00,0x80,0x01,0x03,0x01,
+0x00,0x20,0x02,0x00,0x81,0x20,0x02,0x00,0x00,0x06,0x02,0xbf,0xff,0x83,0x03,0x40,
+0x00,0x03,0x03,0xc0,0x00,0x83,0x02,0x81,0x41,0xb7,0x03,0x00,0xc0,0x01,0x02,0x00,
+0x81,0x20,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x05,
+0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x0b,0x77,0x69,0x74,0x68,0x5f,0x6f,0x62,0x6a,
+0x65,0x63,0x74,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,
+0x61,0x6c,0x00,0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x00,
+0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x2f,0x00,0x04,0x00,0x07,
+0x00,0x00,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x26,0x02,0x00,0x80,0x01,0x02,0x80,
+0x40,0x01,0x02,0x00,0x00,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x96,0x00,0x01,0x00,0x06,0x00,
+0x00,0x00,0x00,0x00,0x13,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0xbf,0xff,
+0x83,0x01,0x00,0x81,0x37,0x01,0x80,0x00,0xbd,0x02,0x40,0x00,0x03,0x01,0x80,0xc1,
+0x37,0x02,0x00,0x01,0x3d,0x02,0xc0,0x00,0x83,0x02,0x01,0x01,0x37,0x01,0x00,0x81,
+0xb7,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x02,0x80,0x01,0x3d,0x01,0x80,0xc1,
+0xb7,0x01,0x80,0x40,0x20,0x01,0x80,0x80,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x03,0x00,0x00,0x01,0x61,0x00,0x00,0x01,0x62,0x00,0x00,0x01,
+0x63,0x00,0x00,0x00,0x03,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x0f,0x65,0x61,0x63,0x68,0x5f,0x77,0x69,0x74,0x68,0x5f,
+0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x04,0x74,0x6f,0x5f,0x61,0x00,0x00,0x00,0x00,
+0xb4,0x00,0x04,0x00,0x09,0x00,0x01,0x00,0x00,0x00,0x1f,0x02,0x40,0x00,0x03,0x02,
+0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x00,0x81,0x01,0xb7,0x02,0x00,0x40,0x01,0x02,
+0x00,0x00,0x20,0x01,0x01,0x00,0x01,0x02,0x80,0x01,0x40,0x02,0x00,0x40,0x21,0x01,
+0x81,0x00,0x01,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,
+0xc0,0x01,0x03,0x02,0x81,0x41,0xb7,0x03,0x00,0x40,0x01,0x02,0x00,0x81,0x20,0x02,
+0x00,0x00,0x06,0x02,0xc0,0x00,0x03,0x03,0x3f,0xff,0x83,0x02,0x81,0x41,0x37,0x03,
+0x40,0x01,0x83,0x03,0xc0,0x00,0x03,0x03,0x01,0x81,0x37,0x03,0xc0,0x04,0x03,0x04,
+0x40,0x01,0x83,0x03,0x81,0xc1,0x37,0x02,0x81,0x41,0xb7,0x03,0x00,0xc0,0x01,0x02,
+0x00,0x81,0x20,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x03,0x6d,0x61,0x70,0x00,0x00,0x0a,0x77,0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,0x65,
+0x78,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x00,0x00,0x3e,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x09,0x04,
+0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,0x80,0x40,0x01,0x02,0x00,0x00,0xb0,0x02,
+0x80,0x80,0x01,0x03,0x00,0x80,0x01,0x02,0x80,0x00,0xb0,0x02,0x01,0x01,0x37,0x02,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2a,0x00,0x00,
+0x00,0x00,0x87,0x00,0x01,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x14,0x00,0x80,0x00,
+0x06,0x01,0x40,0x01,0x03,0x01,0xc0,0x01,0x83,0x01,0x00,0x81,0x37,0x01,0x00,0x80,
+0xb7,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x01,0x80,0xc1,0x37,0x02,0x40,0x01,
+0x03,0x02,0xc0,0x01,0x83,0x02,0x01,0x01,0x37,0x02,0xc0,0x02,0x03,0x03,0x40,0x02,
+0x83,0x02,0x81,0x41,0x37,0x01,0x80,0xc1,0xb7,0x01,0x80,0x40,0x20,0x02,0x00,0x01,
+0x40,0x01,0x80,0x80,0x21,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x03,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x08,0x66,0x69,0x6e,0x64,0x5f,0x61,0x6c,0x6c,0x00,0x00,
+0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,0x00,0x06,0x00,0x00,
+0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,
+0x01,0x80,0x00,0xa0,0x02,0x40,0x01,0x83,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0xbf,0x00,0x04,0x00,0x09,0x00,0x01,0x00,0x00,0x00,0x20,
+0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x00,0x81,0x01,0xb7,
+0x02,0x00,0x40,0x01,0x02,0x00,0x00,0x20,0x01,0x01,0x00,0x01,0x01,0x81,0x00,0x37,
+0x02,0x00,0x80,0x01,0x02,0x80,0x01,0x40,0x02,0x00,0x40,0x21,0x02,0x00,0x00,0x06,
+0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x02,0x81,0x41,0xb7,
+0x03,0x00,0x40,0x01,0x02,0x00,0x81,0x20,0x02,0x00,0x00,0x06,0x02,0xc0,0x00,0x83,
+0x03,0x40,0x02,0x03,0x02,0x81,0x41,0x37,0x03,0x40,0x01,0x03,0x03,0xc0,0x02,0x83,
+0x03,0x01,0x81,0x37,0x03,0xc0,0x01,0x83,0x04,0x40,0x03,0x03,0x03,0x81,0xc1,0x37,
+0x02,0x81,0x41,0xb7,0x03,0x00,0xc0,0x01,0x02,0x00,0x81,0x20,0x02,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0a,0x65,0x61,0x63,0x68,0x5f,0x69,
+0x6e,0x64,0x65,0x78,0x00,0x00,0x0a,0x77,0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,0x65,
+0x78,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x00,0x00,0x43,0x00,0x04,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x09,0x04,
+0x00,0x00,0x26,0x02,0x00,0xc0,0x15,0x02,0x80,0x40,0x01,0x02,0x80,0x41,0x2d,0x03,
+0x00,0x80,0x01,0x03,0x00,0x42,0xad,0x02,0x81,0x41,0x37,0x02,0x00,0x00,0xa0,0x02,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,
+0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x95,0x00,0x03,0x00,0x08,0x00,0x01,0x00,0x00,
+0x00,0x17,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x00,0x80,
+0xc1,0xb7,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x00,0xc0,0x01,0x02,0x00,
+0x01,0x40,0x01,0x80,0x40,0x21,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xbf,
+0xff,0x83,0x02,0x01,0x01,0x37,0x02,0xc0,0x01,0x83,0x03,0x40,0x00,0x03,0x02,0x81,
+0x41,0x37,0x03,0x40,0x04,0x03,0x03,0xc0,0x01,0x83,0x03,0x01,0x81,0x37,0x02,0x01,
+0x01,0xb7,0x02,0x80,0x40,0x01,0x01,0x80,0x81,0x20,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x6d,0x61,0x70,0x21,0x00,0x00,0x0a,0x77,
+0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x3e,0x00,0x04,0x00,
+0x08,0x00,0x00,0x00,0x00,0x00,0x09,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,
+0x80,0x40,0x01,0x02,0x00,0x00,0xb0,0x02,0x80,0x80,0x01,0x03,0x00,0x80,0x01,0x02,
+0x80,0x00,0xb0,0x02,0x01,0x01,0x37,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x01,0x2a,0x00,0x00,0x00,0x00,0x9b,0x00,0x04,0x00,0x08,0x00,
+0x01,0x00,0x00,0x00,0x18,0x02,0x00,0x00,0x04,0x02,0xc0,0x00,0x03,0x03,0x00,0x00,
+0x84,0x03,0xc0,0x00,0x83,0x00,0x81,0x01,0x3f,0x02,0x00,0x40,0x01,0x02,0x00,0x80,
+0x20,0x01,0x01,0x00,0x01,0x01,0x81,0x00,0x37,0x02,0x00,0x80,0x01,0x02,0x80,0x01,
+0x40,0x02,0x00,0x80,0x21,0x02,0x00,0x00,0x06,0x02,0x80,0x00,0x04,0x03,0x40,0x00,
+0x03,0x02,0x81,0x41,0x37,0x03,0x00,0x00,0x84,0x03,0xc0,0x00,0x83,0x03,0x01,0x81,
+0x37,0x02,0x81,0x41,0x37,0x03,0x00,0xc0,0x01,0x03,0x01,0x00,0x20,0x02,0x00,0xc1,
+0x20,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x01,0x61,
+0x00,0x00,0x01,0x62,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x0c,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x73,0x6f,0x72,
+0x74,0x00,0x00,0x00,0x00,0x37,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,
+0x04,0x00,0x00,0x26,0x02,0x00,0xc0,0x15,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,
+0x02,0x81,0x41,0x37,0x02,0x00,0x00,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x7e,0x00,0x01,0x00,
+0x07,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x84,0x01,
+0x80,0x01,0x04,0x01,0x00,0x81,0x37,0x01,0x80,0x00,0x84,0x02,0x40,0x00,0x03,0x02,
+0x80,0x01,0x04,0x03,0x40,0x00,0x83,0x01,0x80,0xc1,0x3f,0x01,0x80,0xc0,0x20,0x01,
+0x81,0x00,0x20,0x01,0x81,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x01,0x61,0x00,0x00,0x01,0x62,0x00,0x00,0x08,
+0x65,0x61,0x63,0x68,0x5f,0x6b,0x65,0x79,0x00,0x00,0x04,0x74,0x6f,0x5f,0x61,0x00,
+0x00,0x04,0x73,0x6f,0x72,0x74,0x00,0x00,0x00,0x00,0x80,0x00,0x01,0x00,0x07,0x00,
+0x00,0x00,0x00,0x00,0x0e,0x00,0x80,0x00,0x06,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,
+0x83,0x01,0x00,0x81,0x37,0x01,0x80,0x00,0x84,0x02,0x40,0x00,0x03,0x02,0x80,0x01,
+0x04,0x03,0x40,0x00,0x83,0x01,0x80,0xc1,0x3f,0x01,0x80,0xc0,0x20,0x01,0x81,0x00,
+0x20,0x01,0x81,0x40,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x01,0x61,0x00,0x00,0x01,0x62,0x00,0x00,0x0a,0x65,0x61,
+0x63,0x68,0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x04,0x74,0x6f,0x5f,0x61,0x00,
+0x00,0x04,0x73,0x6f,0x72,0x74,0x00,0x00,0x00,0x00,0xaf,0x00,0x03,0x00,0x0a,0x00,
+0x01,0x00,0x00,0x00,0x1d,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,
+0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x04,0x40,0x02,0x83,0x00,0x80,0xc1,
+0xbf,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x02,0x00,0x01,0x40,0x01,0x80,0x40,
+0x21,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,
+0x83,0x02,0x01,0x00,0xbf,0x02,0x80,0x80,0x01,0x01,0x80,0x81,0x20,0x01,0x80,0x00,
+0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x03,0xc0,0x01,
+0x83,0x04,0x40,0x02,0x03,0x04,0xc0,0x02,0x83,0x02,0x01,0x01,0xbf,0x02,0x80,0x40,
+0x01,0x01,0x80,0x81,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x06,0x73,0x65,0x6c,0x65,0x63,0x74,0x00,0x00,0x0a,0x77,0x69,0x74,0x68,
+0x5f,0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x3c,0x00,0x04,0x00,0x07,0x00,0x00,
+0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,0xc0,0x00,0x03,
+0x02,0x00,0x00,0xa0,0x02,0xc0,0x01,0x83,0x02,0x00,0x40,0xb2,0x02,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x98,0x00,0x03,0x00,0x09,0x00,0x01,0x00,0x00,0x00,0x17,
+0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,
+0x03,0xc0,0x02,0x03,0x04,0x40,0x02,0x83,0x00,0x80,0xc1,0xbf,0x01,0x80,0x40,0x01,
+0x01,0x80,0x00,0x20,0x02,0x00,0x01,0x40,0x01,0x80,0x40,0x21,0x01,0x00,0xc0,0x01,
+0x01,0x80,0x00,0x06,0x02,0x00,0x40,0x01,0x02,0x80,0x80,0x01,0x01,0x80,0x81,0x20,
+0x01,0x80,0x00,0x06,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x02,0x01,0x00,0xbf,
+0x02,0x80,0x40,0x01,0x01,0x80,0x81,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x07,0x73,0x65,0x6c,0x65,0x63,0x74,0x21,0x00,0x00,0x0a,
+0x77,0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x0c,0x61,0x73,0x73,
+0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x3c,0x00,0x04,
+0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x01,
+0x02,0xc0,0x00,0x03,0x02,0x00,0x00,0xa0,0x02,0xc0,0x01,0x83,0x02,0x00,0x40,0xb2,
+0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x5b,0x5d,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xb7,0x00,0x03,0x00,0x0a,0x00,0x01,
+0x00,0x00,0x00,0x1f,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,
+0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x04,0x40,0x02,0x83,0x00,0x80,0xc1,0xbf,
+0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x02,0x00,0x01,0x40,0x01,0x80,0x40,0x21,
+0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,
+0x03,0x40,0x02,0x03,0x03,0xc0,0x02,0x83,0x02,0x01,0x01,0x3f,0x02,0x80,0x80,0x01,
+0x01,0x80,0x81,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,
+0x03,0x40,0x01,0x03,0x03,0xc0,0x01,0x83,0x04,0x40,0x02,0x03,0x04,0xc0,0x02,0x83,
+0x02,0x01,0x01,0xbf,0x02,0x80,0x40,0x01,0x01,0x80,0x81,0x20,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x06,0x72,0x65,0x6a,0x65,0x63,0x74,
+0x00,0x00,0x0a,0x77,0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,
+0x3c,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,0x02,
+0x00,0x40,0x01,0x02,0xc0,0x00,0x03,0x02,0x00,0x00,0xa0,0x02,0xc0,0x01,0x83,0x02,
+0x00,0x40,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xa0,0x00,0x03,0x00,
+0x09,0x00,0x01,0x00,0x00,0x00,0x19,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,
+0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x04,0x40,0x02,0x83,0x00,
+0x80,0xc1,0xbf,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x02,0x00,0x01,0x40,0x01,
+0x80,0x40,0x21,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x00,0x40,0x01,0x02,
+0x80,0x80,0x01,0x01,0x80,0x81,0x20,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,
+0xc0,0x00,0x83,0x03,0x40,0x02,0x03,0x03,0xc0,0x02,0x83,0x02,0x01,0x01,0x3f,0x02,
+0x80,0x40,0x01,0x01,0x80,0x81,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x07,0x72,0x65,0x6a,0x65,0x63,0x74,0x21,0x00,0x00,0x0a,0x77,
+0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x00,0x3c,0x00,0x04,0x00,
+0x07,0x00,0x00,0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,
+0xc0,0x00,0x03,0x02,0x00,0x00,0xa0,0x02,0xc0,0x01,0x83,0x02,0x00,0x40,0xb2,0x02,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x5b,0x5d,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x7c,0x00,0x04,0x00,0x0a,0x00,0x01,0x00,
+0x00,0x00,0x14,0x02,0x40,0x00,0x03,0x02,0xc0,0x02,0x03,0x00,0x81,0x00,0x41,0x02,
+0x00,0x40,0x01,0x02,0x00,0x00,0x20,0x01,0x01,0x00,0x01,0x01,0x81,0x00,0x37,0x02,
+0x00,0x80,0x01,0x02,0x80,0x01,0x40,0x02,0x00,0x00,0x21,0x02,0x00,0x00,0x06,0x02,
+0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x04,0x40,0x01,0x83,0x04,
+0xc0,0x02,0x03,0x02,0x81,0x42,0xb7,0x03,0x00,0xc0,0x01,0x02,0x00,0x41,0x20,0x02,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x65,0x61,0x63,
+0x68,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,
+0x00,0x00,0x26,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,
+0x00,0x00,0x00,0x74,0x00,0x02,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0b,0x01,0x40,
+0x00,0x03,0x01,0xc0,0x00,0x83,0x00,0x80,0x81,0x37,0x01,0x00,0x00,0x06,0x01,0x80,
+0x01,0x11,0x01,0x80,0x00,0x93,0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,0x02,0x01,
+0x00,0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x05,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x04,0x4c,0x61,0x7a,0x79,0x00,0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,
+0x61,0x62,0x6c,0x65,0x00,0x00,0x04,0x6c,0x61,0x7a,0x79,0x00,0x00,0x05,0x63,0x6c,
+0x61,0x73,0x73,0x00,0x00,0x00,0x01,0xfb,0x00,0x02,0x00,0x07,0x00,0x05,0x00,0x00,
+0x00,0x64,0x01,0x00,0x00,0x11,0x01,0x00,0x40,0x20,0x00,0x80,0x80,0x01,0x01,0x00,
+0x80,0x47,0x01,0x80,0x00,0xc0,0x01,0x00,0x80,0x46,0x01,0x00,0x40,0x01,0x01,0x00,
+0x80,0x47,0x01,0x80,0x02,0xc0,0x01,0x00,0xc0,0x46,0x01,0x00,0x40,0x01,0x01,0x80,
+0xc0,0x37,0x01,0x00,0xc0,0xa0,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,
+0x00,0x83,0x01,0x80,0xc1,0x37,0x02,0x00,0x40,0x01,0x02,0x00,0x80,0x20,0x02,0x01,
+0x40,0x20,0x02,0xc0,0x00,0x83,0x02,0x01,0x80,0xa0,0x02,0x01,0xc0,0x20,0x01,0x01,
+0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x04,0x83,0x02,0x40,0x09,0x83,0x01,0x80,
+0xc1,0x37,0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,0x01,0x01,0x01,0x20,0x01,0x00,
+0x40,0x01,0x01,0x80,0xc0,0x37,0x01,0x00,0xc0,0xa0,0x01,0x00,0x00,0x06,0x01,0xc0,
+0x00,0x83,0x02,0x40,0x01,0x83,0x01,0x80,0xc1,0x37,0x02,0x00,0x40,0x01,0x02,0x00,
+0x80,0x20,0x02,0x01,0x40,0x20,0x02,0x80,0x05,0x40,0x02,0x02,0x00,0x21,0x02,0xc0,
+0x00,0x83,0x02,0x01,0x80,0xa0,0x02,0x01,0xc0,0x20,0x01,0x01,0x01,0x20,0x01,0x00,
+0x00,0x06,0x01,0xc0,0x04,0x83,0x02,0x40,0x09,0x83,0x02,0xc0,0x0e,0x83,0x03,0x40,
+0x13,0x83,0x01,0x80,0xc2,0x37,0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,0x01,0x01,
+0x01,0x20,0x01,0x00,0x40,0x01,0x01,0x80,0xc0,0x37,0x01,0x00,0xc0,0xa0,0x01,0x00,
+0x00,0x06,0x01,0xc0,0x00,0x03,0x01,0x80,0xc0,0xb7,0x02,0x00,0x40,0x01,0x02,0x00,
+0x80,0x20,0x02,0x01,0x40,0x20,0x02,0x80,0x07,0x40,0x02,0x02,0x40,0x21,0x02,0xc0,
+0x00,0x03,0x02,0x01,0x80,0xa0,0x02,0x01,0xc0,0x20,0x01,0x01,0x01,0x20,0x01,0x00,
+0x00,0x06,0x01,0xc0,0x04,0x83,0x01,0x80,0xc0,0xb7,0x02,0x00,0x40,0x01,0x02,0x00,
+0xc0,0x20,0x01,0x01,0x01,0x20,0x01,0x00,0x40,0x01,0x01,0x80,0xc0,0x37,0x01,0x00,
+0xc0,0xa0,0x01,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x01,0x80,0xc0,0xb7,0x02,0x00,
+0x40,0x01,0x02,0x00,0x80,0x20,0x02,0x01,0x40,0x20,0x02,0x80,0x09,0x40,0x02,0x02,
+0x40,0x21,0x02,0xc0,0x01,0x83,0x02,0x01,0x80,0xa0,0x02,0x01,0xc0,0x20,0x01,0x01,
+0x01,0x20,0x01,0x00,0x00,0x06,0x01,0xc0,0x04,0x83,0x02,0x40,0x09,0x83,0x01,0x80,
+0xc1,0x37,0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,0x01,0x01,0x01,0x20,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x06,0x4f,0x62,0x6a,0x65,
+0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,
+0x00,0x01,0x62,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,
+0x61,0x6c,0x00,0x00,0x04,0x6c,0x61,0x7a,0x79,0x00,0x00,0x04,0x74,0x61,0x6b,0x65,
+0x00,0x00,0x05,0x66,0x6f,0x72,0x63,0x65,0x00,0x00,0x06,0x73,0x65,0x6c,0x65,0x63,
+0x74,0x00,0x00,0x0a,0x74,0x61,0x6b,0x65,0x5f,0x77,0x68,0x69,0x6c,0x65,0x00,0x00,
+0x00,0x00,0xfa,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x2d,0x00,0x00,0x00,
+0x26,0x01,0x00,0x00,0x06,0x01,0x00,0x00,0x20,0x01,0x40,0x00,0x99,0x00,0x40,0x02,
+0x17,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x04,0x01,0x00,0x40,0xa0,0x01,0x00,0x00,
+0x29,0x01,0x00,0x00,0x06,0x01,0x00,0xc0,0x20,0x01,0xc0,0x04,0x83,0x01,0x01,0x00,
+0xa0,0x01,0x00,0x00,0x2b,0x01,0xc0,0x00,0x03,0x01,0x01,0x40,0xa0,0x01,0x00,0x00,
+0x06,0x01,0x00,0xc0,0x20,0x01,0xc0,0x09,0x83,0x01,0x01,0x00,0xa0,0x01,0x00,0x00,
+0x2b,0x01,0xc0,0x00,0x83,0x01,0x01,0x40,0xa0,0x01,0x00,0x00,0x06,0x01,0x00,0xc0,
+0x20,0x01,0xc0,0x0e,0x83,0x01,0x01,0x00,0xa0,0x01,0x00,0x00,0x2b,0x01,0xc0,0x01,
+0x03,0x01,0x01,0x40,0xa0,0x01,0x00,0x00,0x06,0x01,0x00,0xc0,0x20,0x01,0xc0,0x13,
+0x83,0x01,0x01,0x00,0xa0,0x01,0x00,0x00,0x2b,0x01,0xc0,0x01,0x83,0x01,0x01,0x40,
+0xa0,0x01,0x00,0x00,0x06,0x01,0x00,0xc0,0x20,0x01,0xc0,0x18,0x83,0x01,0x01,0x00,
+0xa0,0x01,0x00,0x00,0x2b,0x01,0xc0,0x02,0x03,0x01,0x01,0x40,0xa0,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x0c,0x62,0x6c,0x6f,0x63,0x6b,
+0x5f,0x67,0x69,0x76,0x65,0x6e,0x3f,0x00,0x00,0x07,0x74,0x6f,0x5f,0x65,0x6e,0x75,
+0x6d,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x01,0x62,0x00,0x00,0x02,0x3c,
+0x3c,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x3b,0x00,0x03,0x00,
+0x04,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x10,0x00,0x26,0x00,0x40,0x00,0x97,0x00,
+0x40,0x00,0x97,0x00,0x80,0x00,0x05,0x00,0xc0,0x00,0x99,0x00,0x80,0x00,0x0e,0x01,
+0x80,0x00,0x0d,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x02,0x40,0x62,0x00,0x00,0x00,0x00,0x3b,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,
+0x00,0x07,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,
+0x00,0xa0,0x02,0x3f,0xff,0x83,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x25,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x2e,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,
+0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x00,0xb3,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x3c,0x00,0x00,0x00,0x00,
+0x2e,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,
+0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x00,0xb3,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x3c,0x00,0x00,0x00,0x00,0xc2,0x00,
+0x03,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x1e,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,
+0x83,0x02,0xc0,0x01,0x03,0x01,0x80,0xc1,0xb7,0x01,0x80,0x00,0x20,0x00,0x80,0xc0,
+0x01,0x01,0x80,0x00,0x84,0x02,0x00,0x01,0x04,0x01,0x80,0xc1,0x37,0x01,0x80,0x00,
+0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x03,0x02,0x80,0x00,
+0x84,0x02,0x01,0x01,0x37,0x02,0xc0,0x00,0x83,0x03,0x00,0x01,0x04,0x02,0x81,0x41,
+0x37,0x03,0x40,0x01,0x03,0x03,0x80,0x00,0x84,0x03,0x01,0x81,0x37,0x02,0x01,0x01,
+0xb7,0x02,0x80,0x40,0x01,0x02,0x81,0x00,0x20,0x03,0x00,0x80,0x01,0x02,0x81,0x40,
+0xa0,0x03,0x40,0x01,0x03,0x02,0x81,0x80,0xa0,0x01,0x80,0xc1,0x20,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x05,0x63,0x79,0x63,0x6c,0x65,
+0x00,0x00,0x01,0x61,0x00,0x00,0x01,0x62,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,
+0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x6c,0x61,0x7a,0x79,0x00,0x00,
+0x03,0x7a,0x69,0x70,0x00,0x00,0x05,0x66,0x69,0x72,0x73,0x74,0x00,0x00,0x00,0x01,
+0x3d,0x00,0x01,0x00,0x05,0x00,0x02,0x00,0x00,0x00,0x22,0x00,0x80,0x00,0x05,0x00,
+0x80,0x00,0x44,0x00,0x80,0x00,0x45,0x00,0x80,0x00,0x05,0x00,0x80,0x40,0x44,0x00,
+0x80,0x00,0xc5,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x00,0x11,0x00,
+0x80,0x81,0x20,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x06,0x01,0x01,0x00,0x20,0x01,
+0x01,0x40,0x20,0x01,0x80,0x00,0x11,0x01,0x01,0x80,0xa0,0x00,0x80,0xc0,0xa0,0x00,
+0x80,0x00,0x06,0x01,0x00,0x00,0x06,0x01,0x01,0x00,0x20,0x01,0x01,0x40,0x20,0x01,
+0x80,0x00,0x91,0x01,0x01,0x80,0xa0,0x00,0x80,0xc0,0xa0,0x00,0x80,0x00,0x06,0x01,
+0x00,0x04,0x04,0x01,0x80,0x00,0x06,0x01,0x82,0x40,0x20,0x00,0x81,0xc1,0x20,0x00,
+0x80,0x00,0x06,0x01,0x00,0x05,0x04,0x01,0x80,0x05,0x91,0x00,0x81,0xc1,0x20,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x13,0x54,0x6f,0x70,
+0x6c,0x65,0x76,0x65,0x6c,0x54,0x65,0x73,0x74,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x31,
+0x00,0x00,0x13,0x54,0x6f,0x70,0x6c,0x65,0x76,0x65,0x6c,0x54,0x65,0x73,0x74,0x4d,
+0x6f,0x64,0x75,0x6c,0x65,0x32,0x00,0x00,0x07,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,
+0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x10,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+0x64,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x73,0x00,0x00,0x08,0x69,0x6e,0x63,0x6c,
+0x75,0x64,0x65,0x3f,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,
+0x75,0x61,0x6c,0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x0a,0x6d,0x65,0x74,0x68,
+0x6f,0x64,0x5f,0x66,0x6f,0x6f,0x00,0x00,0x04,0x62,0x61,0x72,0x32,0x00,0x00,0x09,
+0x43,0x4f,0x4e,0x53,0x54,0x5f,0x42,0x41,0x52,0x00,0x00,0x00,0x00,0x4d,0x00,0x01,
+0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x48,0x01,0x00,0x00,0xc0,
+0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x84,0x00,0x80,0x01,0x12,0x00,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0a,0x6d,0x65,0x74,0x68,0x6f,0x64,
+0x5f,0x66,0x6f,0x6f,0x00,0x00,0x03,0x62,0x61,0x72,0x00,0x00,0x09,0x43,0x4f,0x4e,
+0x53,0x54,0x5f,0x42,0x41,0x52,0x00,0x00,0x00,0x00,0x28,0x00,0x02,0x00,0x03,0x00,
+0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x04,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,
+0x00,0x00,0x35,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x00,
+0x04,0x00,0x80,0x00,0x92,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x04,0x62,0x61,0x72,0x32,0x00,0x00,0x09,0x43,0x4f,0x4e,0x53,0x54,0x5f,
+0x42,0x41,0x52,0x00,0x00,0x00,0x00,0x58,0x00,0x01,0x00,0x04,0x00,0x02,0x00,0x00,
+0x00,0x09,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x01,0x40,0x00,0x80,
+0x00,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x01,0x80,0x03,0x40,0x00,0x80,
+0x00,0xa1,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0c,0x52,
+0x75,0x6e,0x74,0x69,0x6d,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x29,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x00,0x06,0x00,0x80,
+0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,
+0x66,0x61,0x69,0x6c,0x00,0x00,0x00,0x00,0x32,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x00,
+0x00,0x04,0x66,0x61,0x69,0x6c,0x00,0x00,0x00,0x00,0xc5,0x00,0x02,0x00,0x06,0x00,
+0x03,0x00,0x00,0x00,0x21,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x84,0x02,0x00,0x01,
+0x11,0x02,0x80,0x01,0x40,0x02,0x00,0xc0,0x21,0x02,0x00,0xc0,0x20,0x02,0x00,0x40,
+0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x84,0x02,0x00,0x01,
+0x11,0x02,0x80,0x03,0x40,0x02,0x00,0xc0,0x21,0x02,0x00,0xc0,0x20,0x02,0x00,0x40,
+0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x01,0x11,0x01,0x80,0x05,0x40,0x01,0x00,0xc0,
+0x21,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x06,0x01,0x80,0x02,0x04,0x02,0x00,0x40,
+0x01,0x02,0x00,0xc0,0x20,0x02,0x01,0x00,0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,
+0x06,0x01,0x80,0x02,0x84,0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,0x02,0x01,0x40,
+0x20,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x06,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,
+0x00,0x01,0x6d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x03,0x6e,0x65,
+0x77,0x00,0x00,0x02,0x6d,0x31,0x00,0x00,0x02,0x6d,0x32,0x00,0x00,0x00,0x00,0x2e,
+0x00,0x01,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,
+0x00,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x04,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x6d,0x00,0x00,0x00,0x00,0x33,0x00,0x02,
+0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x06,
+0x01,0x00,0x00,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x0a,0x5f,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x3e,0x00,0x01,0x00,0x04,0x00,0x01,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x06,0x01,
+0x00,0x00,0x84,0x01,0x80,0x01,0x40,0x00,0x80,0x00,0xa1,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0d,0x64,0x65,0x66,0x69,0x6e,0x65,0x5f,
+0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x01,0x6d,0x00,0x00,0x00,0x00,0x2f,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x00,0x06,0x00,0x80,0x00,
+0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0a,0x5f,
+0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x5f,0x5f,0x00,0x00,0x00,0x00,0x3f,0x00,0x01,
+0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x04,0x01,0x00,0x00,0x84,
+0x00,0x80,0x41,0x37,0x01,0x00,0x01,0x40,0x00,0x80,0x80,0x21,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x02,0x6d,0x31,0x00,0x00,0x02,0x6d,
+0x32,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,
+0x06,0x00,0x01,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x06,0x02,
+0x00,0x40,0x01,0x02,0x80,0x01,0x40,0x01,0x80,0x00,0xa1,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0d,0x64,0x65,0x66,0x69,0x6e,0x65,0x5f,
+0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x00,0x00,0x2f,0x00,0x01,0x00,0x03,0x00,
+0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0a,0x5f,0x5f,0x6d,0x65,0x74,
+0x68,0x6f,0x64,0x5f,0x5f,0x00,0x44,0x42,0x47,0x00,0x00,0x00,0x7f,0x64,0x00,0x15,
+0x00,0x32,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,
+0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x6b,0x65,0x72,0x6e,0x65,
+0x6c,0x2d,0x65,0x78,0x74,0x2f,0x74,0x65,0x73,0x74,0x2f,0x6b,0x65,0x72,0x6e,0x65,
+0x6c,0x2e,0x72,0x62,0x00,0x30,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,
+0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x73,
+0x70,0x72,0x69,0x6e,0x74,0x66,0x2f,0x74,0x65,0x73,0x74,0x2f,0x73,0x70,0x72,0x69,
+0x6e,0x74,0x66,0x2e,0x72,0x62,0x00,0x2a,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,
+0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,
+0x2d,0x6d,0x61,0x74,0x68,0x2f,0x74,0x65,0x73,0x74,0x2f,0x6d,0x61,0x74,0x68,0x2e,
+0x72,0x62,0x00,0x2a,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,
+0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x74,0x69,0x6d,
+0x65,0x2f,0x74,0x65,0x73,0x74,0x2f,0x74,0x69,0x6d,0x65,0x2e,0x72,0x62,0x00,0x2e,
+0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,
+0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x73,0x74,0x72,0x75,0x63,0x74,0x2f,
+0x74,0x65,0x73,0x74,0x2f,0x73,0x74,0x72,0x75,0x63,0x74,0x2e,0x72,0x62,0x00,0x2e,
+0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,
+0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x65,0x6e,0x75,0x6d,0x2d,0x65,0x78,
+0x74,0x2f,0x74,0x65,0x73,0x74,0x2f,0x65,0x6e,0x75,0x6d,0x2e,0x72,0x62,0x00,0x32,
+0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,
+0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x73,0x74,0x72,0x69,0x6e,0x67,0x2d,
+0x65,0x78,0x74,0x2f,0x74,0x65,0x73,0x74,0x2f,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,
+0x72,0x62,0x00,0x34,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,
+0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x6e,0x75,0x6d,
+0x65,0x72,0x69,0x63,0x2d,0x65,0x78,0x74,0x2f,0x74,0x65,0x73,0x74,0x2f,0x6e,0x75,
+0x6d,0x65,0x72,0x69,0x63,0x2e,0x72,0x62,0x00,0x2e,0x2f,0x72,0x6f,0x6f,0x74,0x2f,
+0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,
+0x62,0x79,0x2d,0x62,0x69,0x67,0x6e,0x75,0x6d,0x2f,0x74,0x65,0x73,0x74,0x2f,0x62,
+0x69,0x67,0x6e,0x75,0x6d,0x2e,0x72,0x62,0x00,0x30,0x2f,0x72,0x6f,0x6f,0x74,0x2f,
+0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,
+0x62,0x79,0x2d,0x61,0x72,0x72,0x61,0x79,0x2d,0x65,0x78,0x74,0x2f,0x74,0x65,0x73,
+0x74,0x2f,0x61,0x72,0x72,0x61,0x79,0x2e,0x72,0x62,0x00,0x2e,0x2f,0x72,0x6f,0x6f,
+0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,
+0x72,0x75,0x62,0x79,0x2d,0x68,0x61,0x73,0x68,0x2d,0x65,0x78,0x74,0x2f,0x74,0x65,
+0x73,0x74,0x2f,0x68,0x61,0x73,0x68,0x2e,0x72,0x62,0x00,0x30,0x2f,0x72,0x6f,0x6f,
+0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,
+0x72,0x75,0x62,0x79,0x2d,0x72,0x61,0x6e,0x67,0x65,0x2d,0x65,0x78,0x74,0x2f,0x74,
+0x65,0x73,0x74,0x2f,0x72,0x61,0x6e,0x67,0x65,0x2e,0x72,0x62,0x00,0x32,0x2f,0x72,
+0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,
+0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x2d,0x65,0x78,
+0x74,0x2f,0x74,0x65,0x73,0x74,0x2f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x2e,0x72,0x62,
+0x00,0x2e,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,
+0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x72,0x61,0x6e,0x64,0x6f,
+0x6d,0x2f,0x74,0x65,0x73,0x74,0x2f,0x72,0x61,0x6e,0x64,0x6f,0x6d,0x2e,0x72,0x62,
+0x00,0x32,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,
+0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x6f,0x62,0x6a,0x65,0x63,
+0x74,0x2d,0x65,0x78,0x74,0x2f,0x74,0x65,0x73,0x74,0x2f,0x6f,0x62,0x6a,0x65,0x63,
+0x74,0x2e,0x72,0x62,0x00,0x2f,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,
+0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x6f,
+0x62,0x6a,0x65,0x63,0x74,0x2d,0x65,0x78,0x74,0x2f,0x74,0x65,0x73,0x74,0x2f,0x6e,
+0x69,0x6c,0x2e,0x72,0x62,0x00,0x30,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,
+0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,
+0x77,0x65,0x61,0x6b,0x72,0x65,0x66,0x2f,0x74,0x65,0x73,0x74,0x2f,0x77,0x65,0x61,
+0x6b,0x72,0x65,0x66,0x2e,0x72,0x62,0x00,0x2c,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,
+0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,
+0x79,0x2d,0x66,0x69,0x62,0x65,0x72,0x2f,0x74,0x65,0x73,0x74,0x2f,0x66,0x69,0x62,
+0x65,0x72,0x2e,0x72,0x62,0x00,0x36,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,
+0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,
+0x65,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x2f,0x74,0x65,0x73,0x74,0x2f,
+0x65,0x6e,0x75,0x6d,0x65,0x72,0x61,0x74,0x6f,0x72,0x2e,0x72,0x62,0x00,0x2f,0x2f,
+0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,
+0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x65,0x6e,0x75,0x6d,0x2d,0x6c,0x61,0x7a,
+0x79,0x2f,0x74,0x65,0x73,0x74,0x2f,0x6c,0x61,0x7a,0x79,0x2e,0x72,0x62,0x00,0x36,
+0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,
+0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x74,0x6f,0x70,0x6c,0x65,0x76,0x65,
+0x6c,0x2d,0x65,0x78,0x74,0x2f,0x74,0x65,0x73,0x74,0x2f,0x74,0x6f,0x70,0x6c,0x65,
+0x76,0x65,0x6c,0x2e,0x72,0x62,0x00,0x00,0x0a,0x48,0x00,0x16,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x05,0x00,0x00,0x00,0x01,0x00,0x01,0x00,
+0x00,0x00,0x0f,0x00,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x11,0x00,0x11,0x00,0x11,
+0x00,0x11,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x29,0x00,0x29,0x00,0x29,
+0x00,0x29,0x00,0x00,0x00,0x10,0x00,0x02,0x00,0x00,0x00,0x5f,0x00,0x00,0x10,0x00,
+0x10,0x00,0x10,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x16,0x00,0x16,0x00,
+0x16,0x00,0x16,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x2c,0x00,0x2c,0x00,
+0x2c,0x00,0x2c,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x34,0x00,0x34,0x00,
+0x34,0x00,0x34,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x3c,0x00,0x3c,0x00,
+0x3c,0x00,0x3c,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x44,0x00,0x44,0x00,
+0x44,0x00,0x44,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x4c,0x00,0x4c,0x00,
+0x4c,0x00,0x4c,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x54,0x00,0x54,0x00,
+0x54,0x00,0x54,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x5c,0x00,0x5c,0x00,
+0x5c,0x00,0x5c,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x70,0x00,0x70,0x00,
+0x70,0x00,0x70,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x7a,0x00,0x7a,0x00,
+0x7a,0x00,0x7a,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x00,0x82,0x00,0x82,0x00,
+0x82,0x00,0x82,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x00,0x00,0x6f,0x00,
+0x03,0x00,0x00,0x00,0xce,0x00,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,
+0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x14,
+0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,
+0x00,0x18,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x20,0x00,0x20,
+0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,
+0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x2f,0x00,0x2f,0x00,0x2f,
+0x00,0x2f,0x00,0x2f,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x41,
+0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,
+0x00,0x45,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x4d,0x00,0x4d,
+0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x51,
+0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x5d,0x00,0x5d,0x00,0x5d,
+0x00,0x5d,0x00,0x5d,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x68,
+0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,
+0x00,0x6f,0x00,0x76,0x00,0x76,0x00,0x76,0x00,0x76,0x00,0x76,0x00,0x7b,0x00,0x7b,
+0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,
+0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x8b,0x00,0x8b,0x00,0x8b,
+0x00,0x8b,0x00,0x8b,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x93,
+0x00,0x93,0x00,0x93,0x00,0x93,0x00,0x93,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,
+0x00,0x97,0x00,0x9b,0x00,0x9b,0x00,0x9b,0x00,0x9b,0x00,0x9b,0x00,0x9f,0x00,0x9f,
+0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0xa3,0x00,0xa3,0x00,0xa3,0x00,0xa3,0x00,0xa3,
+0x00,0xa7,0x00,0xa7,0x00,0xa7,0x00,0xa7,0x00,0xa7,0x00,0xae,0x00,0xae,0x00,0xae,
+0x00,0xae,0x00,0xae,0x00,0xb2,0x00,0xb2,0x00,0xb2,0x00,0xb2,0x00,0xb2,0x00,0xb6,
+0x00,0xb6,0x00,0xb6,0x00,0xb6,0x00,0xb6,0x00,0xba,0x00,0xba,0x00,0xba,0x00,0xba,
+0x00,0xba,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc4,0x00,0xc4,0x00,0xc4,
+0x00,0xc4,0x00,0xc8,0x00,0xc8,0x00,0xc8,0x00,0xc8,0x00,0xd3,0x00,0xd3,0x00,0xd3,
+0x00,0xd3,0x00,0x00,0x01,0x3d,0x00,0x04,0x00,0x00,0x00,0x53,0x00,0x00,0x04,0x00,
+0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,
+0x08,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x13,0x00,0x13,0x00,
+0x13,0x00,0x13,0x00,0x13,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,
+0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x25,0x00,0x25,0x00,0x25,0x00,
+0x25,0x00,0x25,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x36,0x00,
+0x36,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,
+0x40,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x4c,0x00,0x4c,0x00,
+0x4c,0x00,0x4c,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x68,0x00,0x68,0x00,
+0x68,0x00,0x68,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x74,0x00,0x74,0x00,
+0x74,0x00,0x74,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x7f,0x00,0x7f,0x00,
+0x7f,0x00,0x7f,0x00,0x00,0x01,0x90,0x00,0x05,0x00,0x00,0x00,0x58,0x00,0x00,0x04,
+0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x10,
+0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x1a,
+0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x26,
+0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x31,
+0x00,0x31,0x00,0x31,0x00,0x31,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x4a,
+0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x54,
+0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x5e,
+0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x6a,
+0x00,0x6a,0x00,0x6a,0x00,0x6a,0x00,0x72,0x00,0x72,0x00,0x72,0x00,0x72,0x00,0x77,
+0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x00,0x85,
+0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x00,
+0x01,0xe8,0x00,0x06,0x00,0x00,0x00,0x48,0x00,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
+0x04,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x16,0x00,0x16,0x00,0x16,0x00,
+0x16,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,
+0x2d,0x00,0x39,0x00,0x39,0x00,0x39,0x00,0x39,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,
+0x3f,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,
+0x4b,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x57,0x00,0x57,0x00,0x57,0x00,
+0x57,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,
+0x6c,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,
+0x7a,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,
+0x8e,0x00,0x99,0x00,0x99,0x00,0x99,0x00,0x99,0x00,0x00,0x02,0x30,0x00,0x07,0x00,
+0x00,0x00,0x0c,0x00,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x11,0x00,0x11,
+0x00,0x11,0x00,0x11,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x00,0x02,0x3c,
+0x00,0x08,0x00,0x00,0x00,0x37,0x00,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
+0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,
+0x28,0x00,0x28,0x00,0x28,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x43,0x00,
+0x43,0x00,0x43,0x00,0x43,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x56,0x00,
+0x56,0x00,0x56,0x00,0x56,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x6d,0x00,
+0x6d,0x00,0x6d,0x00,0x6d,0x00,0x78,0x00,0x78,0x00,0x78,0x00,0x78,0x00,0x84,0x00,
+0x84,0x00,0x84,0x00,0x84,0x00,0x93,0x00,0x93,0x00,0x93,0x00,0x93,0x00,0xa0,0x00,
+0xa0,0x00,0xa0,0x00,0xa0,0x00,0x00,0x02,0x73,0x00,0x09,0x00,0x00,0x00,0x68,0x00,
+0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,
+0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,
+0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,
+0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,
+0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x56,
+0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,
+0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x72,0x00,0x72,0x00,0x72,0x00,0x72,
+0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x9b,0x00,0x9b,0x00,0x9b,0x00,0x9b,
+0x00,0xaa,0x00,0xaa,0x00,0xaa,0x00,0xaa,0x00,0xb4,0x00,0xb4,0x00,0xb4,0x00,0xb4,
+0x00,0xbe,0x00,0xbe,0x00,0xbe,0x00,0xbe,0x00,0xcc,0x00,0xcc,0x00,0xcc,0x00,0xcc,
+0x00,0xda,0x00,0xda,0x00,0xda,0x00,0xda,0x00,0xe3,0x00,0xe3,0x00,0xe3,0x00,0xe3,
+0x00,0xf3,0x00,0xf3,0x00,0xf3,0x00,0xf3,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x01,0x0e,0x01,0x0e,0x01,0x0e,0x01,0x0e,0x01,0x1c,0x01,0x1c,0x01,0x1c,0x01,0x1c,
+0x00,0x00,0x02,0xdb,0x00,0x0a,0x00,0x00,0x00,0x20,0x00,0x00,0x04,0x00,0x04,0x00,
+0x04,0x00,0x04,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x23,0x00,0x23,0x00,
+0x23,0x00,0x23,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x51,0x00,0x51,0x00,
+0x51,0x00,0x51,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x67,0x00,0x67,0x00,
+0x67,0x00,0x67,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x00,0x02,0xfb,0x00,
+0x0b,0x00,0x00,0x00,0x0c,0x00,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x0a,
+0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x00,
+0x03,0x07,0x00,0x0c,0x00,0x00,0x00,0x20,0x00,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
+0x04,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,
+0x0e,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x18,0x00,0x18,0x00,0x18,0x00,
+0x18,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
+0x20,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x00,0x03,0x27,0x00,0x0d,0x00,
+0x00,0x00,0x24,0x00,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x0a,0x00,0x0a,
+0x00,0x0a,0x00,0x0a,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x1a,0x00,0x1a,
+0x00,0x1a,0x00,0x1a,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x22,0x00,0x22,
+0x00,0x22,0x00,0x22,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x30,0x00,0x30,
+0x00,0x30,0x00,0x30,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x00,0x03,0x4b,
+0x00,0x0e,0x00,0x00,0x00,0x08,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x00,0x03,0x53,0x00,0x0f,0x00,0x00,0x00,
+0x0c,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x05,0x00,0x05,0x00,0x05,
+0x00,0x05,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x00,0x03,0x5f,0x00,0x10,
+0x00,0x00,0x00,0x16,0x00,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x16,0x00,0x16,0x00,
+0x16,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
+0x23,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x33,0x00,0x33,0x00,0x33,0x00,
+0x33,0x00,0x00,0x03,0x75,0x00,0x11,0x00,0x00,0x00,0x54,0x00,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x0b,0x00,0x0b,
+0x00,0x0b,0x00,0x0b,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x29,0x00,0x29,
+0x00,0x29,0x00,0x29,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x3b,0x00,0x3b,
+0x00,0x3b,0x00,0x3b,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x4e,0x00,0x4e,
+0x00,0x4e,0x00,0x4e,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x5b,0x00,0x5b,
+0x00,0x5b,0x00,0x5b,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x6c,0x00,0x6c,
+0x00,0x6c,0x00,0x6c,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x87,0x00,0x87,
+0x00,0x87,0x00,0x87,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x98,0x00,0x98,
+0x00,0x98,0x00,0x98,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0xab,0x00,0xab,
+0x00,0xab,0x00,0xab,0x00,0xc3,0x00,0xc3,0x00,0xc3,0x00,0xc3,0x00,0xd2,0x00,0xd2,
+0x00,0xd2,0x00,0xd2,0x00,0x00,0x03,0xc9,0x00,0x12,0x00,0x00,0x00,0xc6,0x00,0x00,
+0x01,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x09,0x00,0x09,0x00,
+0x0b,0x00,0x0b,0x00,0x0d,0x00,0x0d,0x00,0x0f,0x00,0x0f,0x00,0x11,0x00,0x11,0x00,
+0x25,0x00,0x25,0x00,0x27,0x00,0x27,0x00,0x30,0x00,0x30,0x00,0x32,0x00,0x32,0x00,
+0x35,0x00,0x35,0x00,0x37,0x00,0x37,0x00,0x3b,0x00,0x3b,0x00,0x3d,0x00,0x3d,0x00,
+0x3f,0x00,0x3f,0x00,0x41,0x00,0x41,0x00,0x49,0x00,0x49,0x00,0x4b,0x00,0x4b,0x00,
+0x58,0x00,0x58,0x00,0x5a,0x00,0x5a,0x00,0x61,0x00,0x61,0x00,0x63,0x00,0x63,0x00,
+0x6d,0x00,0x6d,0x00,0x6f,0x00,0x6f,0x00,0x82,0x00,0x82,0x00,0x84,0x00,0x84,0x00,
+0x8a,0x00,0x8a,0x00,0x8c,0x00,0x8c,0x00,0x9b,0x00,0x9b,0x00,0x9d,0x00,0x9d,0x00,
+0xa5,0x00,0xa5,0x00,0xa7,0x00,0xa7,0x00,0xb0,0x00,0xb0,0x00,0xb2,0x00,0xb2,0x00,
+0xd5,0x00,0xd5,0x00,0xd7,0x00,0xd7,0x00,0xe0,0x00,0xe0,0x00,0xe2,0x00,0xe2,0x00,
+0xf3,0x00,0xf3,0x00,0xf5,0x00,0xf5,0x01,0x05,0x01,0x05,0x01,0x07,0x01,0x07,0x01,
+0x12,0x01,0x12,0x01,0x14,0x01,0x14,0x01,0x21,0x01,0x21,0x01,0x23,0x01,0x23,0x01,
+0x2a,0x01,0x2a,0x01,0x2c,0x01,0x2c,0x01,0x35,0x01,0x35,0x01,0x37,0x01,0x37,0x01,
+0x48,0x01,0x48,0x01,0x4a,0x01,0x4a,0x01,0x5b,0x01,0x5b,0x01,0x5d,0x01,0x5d,0x01,
+0x67,0x01,0x67,0x01,0x69,0x01,0x69,0x01,0x6e,0x01,0x6e,0x01,0x70,0x01,0x70,0x01,
+0x7e,0x01,0x7e,0x01,0x80,0x01,0x80,0x01,0x8a,0x01,0x8a,0x01,0x8c,0x01,0x8c,0x01,
+0x94,0x01,0x94,0x01,0x96,0x01,0x96,0x01,0x9f,0x01,0x9f,0x01,0xa1,0x01,0xa1,0x01,
+0xa4,0x01,0xa4,0x01,0xa6,0x01,0xa6,0x01,0xaf,0x01,0xaf,0x01,0xb1,0x01,0xb1,0x01,
+0xbb,0x01,0xbb,0x01,0xbd,0x01,0xbd,0x01,0xbf,0x01,0xbf,0x01,0xc1,0x01,0xc1,0x01,
+0xc9,0x01,0xc9,0x01,0xcb,0x01,0xcb,0x01,0xcd,0x01,0xcd,0x01,0xcf,0x01,0xcf,0x01,
+0xd8,0x01,0xd8,0x01,0xda,0x01,0xda,0x01,0xe1,0x01,0xe1,0x01,0xe3,0x01,0xe3,0x01,
+0xeb,0x01,0xeb,0x01,0xed,0x01,0xed,0x01,0xef,0x01,0xef,0x01,0xf1,0x01,0xf1,0x01,
+0xf3,0x01,0xf3,0x01,0xf5,0x01,0xf5,0x01,0xfa,0x01,0xfa,0x01,0xfc,0x01,0xfc,0x02,
+0x01,0x02,0x01,0x02,0x03,0x02,0x03,0x02,0x08,0x02,0x08,0x02,0x0a,0x02,0x0a,0x02,
+0x0f,0x02,0x0f,0x02,0x11,0x02,0x11,0x02,0x19,0x02,0x19,0x00,0x00,0x04,0x8f,0x00,
+0x13,0x00,0x00,0x00,0x0c,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x06,
+0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x00,
+0x04,0x9b,0x00,0x14,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
+0x04,0x00,0x00,0x04,0x9f,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x01,0x00,0x01,
+0x00,0x01,0x00,0x01,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,
+0x00,0x99,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x44,0x00,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x07,0x00,
+0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x08,0x00,0x08,0x00,
+0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x09,0x00,0x09,0x00,0x09,0x00,
+0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,
+0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,
+0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,
+0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x00,0x00,0x35,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x00,0x00,0x12,0x00,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,
+0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x13,0x00,0x13,
+0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x00,0x00,0xe7,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6b,0x00,0x00,0x17,0x00,
+0x17,0x00,0x17,0x00,0x17,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x19,0x00,
+0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x1a,0x00,0x1a,0x00,
+0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1b,0x00,0x1b,0x00,
+0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,
+0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,
+0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,
+0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x20,0x00,
+0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
+0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
+0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
+0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
+0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
+0x26,0x00,0x26,0x00,0x00,0x00,0x8b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x00,0x00,0x3d,0x00,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,
+0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,
+0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2c,0x00,0x2c,0x00,0x2c,
+0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2d,
+0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,
+0x00,0x2d,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,
+0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x30,
+0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x00,
+0x00,0x43,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x19,0x00,0x00,
+0x10,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x0a,0x00,
+0x0a,0x00,0x0a,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0e,0x00,
+0x0e,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+0x07,0x00,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,
+0x00,0x00,0x00,0x25,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x00,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,
+0x17,0x00,0x17,0x00,0x17,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x1b,0x00,0x1c,0x00,0x1c,0x00,0x1d,0x00,0x1d,
+0x00,0x1d,0x00,0x29,0x00,0x00,0x00,0xc7,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x00,0x00,0x5b,0x00,0x00,0x1d,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,
+0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+0x1f,0x00,0x1f,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
+0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,
+0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,
+0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
+0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,
+0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,
+0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,
+0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x27,0x00,
+0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,
+0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x00,0x00,0x1f,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x2d,0x00,0x2d,
+0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x00,0x00,0x1f,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x31,0x00,0x31,0x00,
+0x31,0x00,0x31,0x00,0x31,0x00,0x31,0x00,0x31,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x35,0x00,0x35,0x00,0x35,
+0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x39,0x00,0x39,0x00,0x39,0x00,
+0x39,0x00,0x39,0x00,0x39,0x00,0x39,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,
+0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x00,0x00,0x08,0x00,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,
+0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x00,0x00,0x25,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x00,0x00,0x0a,0x00,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,
+0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x00,0x00,0x1f,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x49,0x00,
+0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x00,0x00,0x1f,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x4d,0x00,0x4d,
+0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x00,0x00,0x1f,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x51,0x00,0x51,0x00,
+0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x55,0x00,0x55,0x00,0x55,
+0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x09,0x00,0x00,0x59,0x00,0x59,0x00,0x59,0x00,
+0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x00,0x00,0x33,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x5d,0x00,0x5d,
+0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,
+0x00,0x5e,0x00,0x5e,0x00,0x5f,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x63,0x00,0x00,
+0x00,0x2b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0d,0x00,0x00,
+0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,
+0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x00,0x00,0x33,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x11,0x00,0x00,0x67,0x00,0x67,0x00,0x67,
+0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,
+0x00,0x68,0x00,0x69,0x00,0x6a,0x00,0x6a,0x00,0x6a,0x00,0x6d,0x00,0x00,0x00,0x2b,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0d,0x00,0x00,0x6a,0x00,
+0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,
+0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x00,0x00,0x08,0x00,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x71,
+0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0e,0x00,0x00,0x75,0x00,0x76,0x00,0x76,0x00,
+0x76,0x00,0x76,0x00,0x76,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x77,0x00,
+0x77,0x00,0x77,0x00,0x77,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,
+0x00,0x7b,0x00,0x7b,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x00,0x00,0x07,0x00,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,
+0x7f,0x00,0x7f,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x00,0x00,0x07,0x00,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,
+0x00,0x83,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,
+0x00,0x07,0x00,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,
+0x87,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+0x06,0x00,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x00,
+0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x00,
+0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x00,0x0d,0x00,0x0d,0x00,0x0d,
+0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x00,0x00,0x04,0x00,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x00,0x00,
+0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x00,0x15,
+0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x00,0x00,0x1d,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x00,0x19,0x00,0x19,0x00,
+0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,
+0x00,0x1d,0x00,0x1d,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x00,0x00,0x06,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
+0x21,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+0x06,0x00,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x00,
+0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0x00,
+0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x2a,0x00,0x2a,0x00,0x2c,0x00,0x2c,0x00,
+0x2c,0x00,0x2c,0x00,0x2c,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x00,0x00,0x0b,0x00,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x31,
+0x00,0x31,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x00,0x00,0x59,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x24,0x00,0x00,0x37,0x00,
+0x37,0x00,0x37,0x00,0x37,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x39,0x00,
+0x39,0x00,0x39,0x00,0x39,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,
+0x3b,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3d,0x00,
+0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,
+0x3e,0x00,0x3e,0x00,0x3e,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x00,0x00,0x08,0x00,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,
+0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x03,0x00,0x00,0x00,0x08,0x00,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,
+0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x4a,
+0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x00,0x00,0x23,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x00,0x4e,0x00,0x4e,0x00,
+0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x00,0x00,
+0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x08,0x00,0x00,0x52,
+0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x00,
+0x00,0x39,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x14,0x00,0x00,
+0x56,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,
+0x58,0x00,0x58,0x00,0x58,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,
+0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x00,0x00,0x08,0x00,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,
+0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
+0x62,0x00,0x62,0x00,0x62,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x00,0x00,0x05,0x00,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,
+0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0b,
+0x00,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,
+0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x00,0x00,0x08,0x00,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x77,
+0x00,0x78,0x00,0x78,0x00,0x78,0x00,0x78,0x00,0x00,0x00,0x2f,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0f,0x00,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,
+0x7c,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7f,0x00,0x7f,0x00,0x80,0x00,
+0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,
+0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x00,0x00,0x27,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0x00,0x88,0x00,0x88,0x00,
+0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,
+0x88,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+0x09,0x00,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,
+0x00,0x8c,0x00,0x8c,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x00,0x00,0x09,0x00,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,
+0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x00,0x00,0x0c,0x00,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,
+0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,
+0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x07,
+0x00,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,
+0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x07,0x00,
+0x00,0x9c,0x00,0x9c,0x00,0x9c,0x00,0x9c,0x00,0x9c,0x00,0x9c,0x00,0x9c,0x00,0x00,
+0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x07,0x00,0x00,
+0xa0,0x00,0xa0,0x00,0xa0,0x00,0xa0,0x00,0xa0,0x00,0xa0,0x00,0xa0,0x00,0x00,0x00,
+0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x00,0xa4,
+0x00,0xa4,0x00,0xa4,0x00,0xa4,0x00,0xa4,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x00,0xa8,0x00,0xa8,0x00,0xa8,0x00,
+0xa8,0x00,0xa8,0x00,0xa8,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x00,0x00,0x09,0x00,0x00,0xaf,0x00,0xaf,0x00,0xaf,0x00,0xaf,0x00,0xaf,
+0x00,0xaf,0x00,0xaf,0x00,0xaf,0x00,0xaf,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x00,0xb3,0x00,0xb3,0x00,0xb3,0x00,
+0xb3,0x00,0xb3,0x00,0xb3,0x00,0xb3,0x00,0xb3,0x00,0xb3,0x00,0x00,0x00,0x23,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x00,0xb7,0x00,0xb7,
+0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,0x00,
+0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x08,0x00,0x00,
+0xbb,0x00,0xbb,0x00,0xbb,0x00,0xbb,0x00,0xbb,0x00,0xbb,0x00,0xbb,0x00,0xbb,0x00,
+0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x08,0x00,
+0x00,0xc1,0x00,0xc1,0x00,0xc1,0x00,0xc1,0x00,0xc1,0x00,0xc1,0x00,0xc1,0x00,0xc1,
+0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x08,
+0x00,0x00,0xc5,0x00,0xc5,0x00,0xc5,0x00,0xc5,0x00,0xc5,0x00,0xc5,0x00,0xc5,0x00,
+0xc5,0x00,0x00,0x00,0x57,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+0x23,0x00,0x00,0xc9,0x00,0xc9,0x00,0xc9,0x00,0xc9,0x00,0xc9,0x00,0xc9,0x00,0xca,
+0x00,0xca,0x00,0xca,0x00,0xca,0x00,0xcb,0x00,0xcb,0x00,0xcb,0x00,0xcb,0x00,0xcc,
+0x00,0xcc,0x00,0xcc,0x00,0xcc,0x00,0xcd,0x00,0xcd,0x00,0xcd,0x00,0xcd,0x00,0xce,
+0x00,0xce,0x00,0xce,0x00,0xce,0x00,0xcf,0x00,0xcf,0x00,0xcf,0x00,0xcf,0x00,0xd0,
+0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd0,0x00,0x00,0x00,0x7b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x35,0x00,0x00,0xd4,0x00,0xd5,0x00,0xd5,0x00,
+0xd5,0x00,0xd6,0x00,0xd6,0x00,0xd6,0x00,0xd6,0x00,0xd6,0x00,0xd7,0x00,0xd7,0x00,
+0xd7,0x00,0xd7,0x00,0xd8,0x00,0xd8,0x00,0xd8,0x00,0xd8,0x00,0xd8,0x00,0xd9,0x00,
+0xd9,0x00,0xda,0x00,0xda,0x00,0xda,0x00,0xda,0x00,0xda,0x00,0xda,0x00,0xdb,0x00,
+0xdb,0x00,0xdb,0x00,0xdc,0x00,0xdc,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xe1,0x00,
+0xe1,0x00,0xe1,0x00,0xe1,0x00,0xe1,0x00,0xe2,0x00,0xe2,0x00,0xe2,0x00,0xe2,0x00,
+0xe2,0x00,0xe2,0x00,0xe2,0x00,0xe2,0x00,0xe2,0x00,0xe2,0x00,0xe2,0x00,0xe2,0x00,
+0xe2,0x00,0xe2,0x00,0x00,0x00,0x25,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x00,0x00,0x0a,0x00,0x00,0xd5,0x00,0xd5,0x00,0xd5,0x00,0xd5,0x00,0xd5,0x00,0xd5,
+0x00,0xd5,0x00,0xd5,0x00,0xd5,0x00,0xd5,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x00,0xdb,0x00,0xdb,0x00,0xdb,0x00,
+0xdb,0x00,0xdb,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x00,0x00,0x0e,0x00,0x00,0xdd,0x00,0xde,0x00,0xde,0x00,0xde,0x00,0xde,0x00,0xde,
+0x00,0xde,0x00,0xde,0x00,0xdf,0x00,0xdf,0x00,0xdf,0x00,0xdf,0x00,0xdf,0x00,0xdf,
+0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x05,
+0x00,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x00,0x00,0x1b,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x09,0x00,0x09,
+0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x00,0x00,0x31,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x00,0x00,0x10,0x00,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,
+0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x00,0x00,0x0c,0x00,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x15,
+0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,
+0x00,0x00,0x00,0x35,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x12,
+0x00,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x1a,0x00,0x1a,0x00,
+0x1a,0x00,0x1a,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1c,0x00,
+0x1c,0x00,0x1c,0x00,0x1c,0x00,0x00,0x00,0x39,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x04,0x00,0x00,0x00,0x14,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,
+0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,
+0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x00,
+0x00,0x39,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x14,0x00,0x00,
+0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x27,0x00,
+0x27,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x29,0x00,0x29,0x00,
+0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x00,0x00,0x43,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x00,0x00,0x19,0x00,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,
+0x00,0x2d,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2f,0x00,0x30,0x00,0x30,
+0x00,0x30,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,
+0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x00,0x00,0x1b,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x30,0x00,0x31,0x00,
+0x31,0x00,0x31,0x00,0x31,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x04,0x00,0x00,0x00,0x1d,0x00,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,
+0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x39,0x00,0x3a,0x00,0x3a,0x00,0x3a,
+0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,
+0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,
+0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x07,
+0x00,0x00,0x3a,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,
+0x00,0x00,0x2f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x0f,0x00,
+0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x42,0x00,0x42,0x00,0x42,
+0x00,0x42,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x00,
+0x00,0x2f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x0f,0x00,0x00,
+0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x48,0x00,0x48,0x00,0x48,0x00,
+0x48,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x00,0x00,
+0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x07,0x00,0x00,0x49,
+0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x00,0x00,0xd9,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x64,0x00,0x00,0x4d,0x00,
+0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,
+0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4e,0x00,
+0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,
+0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4f,0x00,0x4f,0x00,
+0x4f,0x00,0x4f,0x00,0x4f,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,
+0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x52,0x00,0x52,0x00,0x52,0x00,
+0x52,0x00,0x52,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x54,0x00,
+0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,
+0x55,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x57,0x00,0x57,0x00,
+0x57,0x00,0x57,0x00,0x57,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,
+0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,
+0x5b,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5e,0x00,0x5e,0x00,
+0x5e,0x00,0x5e,0x00,0x5e,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x04,0x00,0x00,0x00,0x03,0x00,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x00,0x00,0x23,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x09,0x00,0x00,0x62,0x00,
+0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x65,0x00,0x65,0x00,0x65,0x00,
+0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x07,0x00,
+0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x00,
+0x00,0x45,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x1a,0x00,0x00,
+0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,
+0x6a,0x00,0x6a,0x00,0x6a,0x00,0x6a,0x00,0x6a,0x00,0x6a,0x00,0x6a,0x00,0x6b,0x00,
+0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,
+0x6b,0x00,0x6b,0x00,0x00,0x00,0x37,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+0x00,0x00,0x13,0x00,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,
+0x00,0x6f,0x00,0x6f,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x71,
+0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x00,0x00,0x3f,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x17,0x00,0x00,0x75,0x00,0x75,0x00,
+0x75,0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x76,0x00,0x76,0x00,
+0x76,0x00,0x76,0x00,0x76,0x00,0x76,0x00,0x76,0x00,0x77,0x00,0x77,0x00,0x77,0x00,
+0x77,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x00,0x00,0x3b,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x15,0x00,0x00,0x7b,0x00,0x7b,0x00,0x7b,
+0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7c,
+0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7c,
+0x00,0x7c,0x00,0x7c,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x00,0x00,0x03,0x00,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x00,0x00,0x4b,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x1d,0x00,0x00,0x80,0x00,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x82,0x00,0x82,0x00,0x82,
+0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x83,0x00,0x83,
+0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,
+0x00,0x00,0x3f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x17,0x00,
+0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x07,
+0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,
+0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x00,
+0x00,0x35,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x12,0x00,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,
+0x00,0x00,0x05,0x00,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,
+0x00,0x33,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x11,0x00,0x00,
+0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x12,0x00,
+0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,
+0x12,0x00,0x00,0x00,0x31,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+0x10,0x00,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,
+0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,
+0x00,0x17,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x05,0x00,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x00,0x00,
+0x41,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x18,0x00,0x00,0x1b,
+0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1d,0x00,0x1d,
+0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,
+0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x00,
+0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x05,0x00,0x00,
+0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x00,0x00,0x45,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x1a,0x00,0x00,0x21,0x00,0x22,0x00,0x22,
+0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,
+0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,
+0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x00,
+0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x05,0x00,0x00,
+0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x00,0x00,0x4f,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x1f,0x00,0x00,0x27,0x00,0x27,0x00,0x27,
+0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,
+0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,
+0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,
+0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x05,0x00,0x00,0x27,0x00,0x27,0x00,0x27,0x00,
+0x27,0x00,0x27,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,
+0x00,0x00,0x0d,0x00,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,
+0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x00,
+0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x04,0x00,0x00,
+0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x00,0x00,0x6b,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x05,0x00,0x00,0x00,0x2d,0x00,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x33,
+0x00,0x33,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x39,0x00,0x39,0x00,0x39,
+0x00,0x39,0x00,0x39,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,
+0x00,0x3a,0x00,0x3a,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3b,
+0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3d,0x00,0x3d,
+0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,
+0x00,0x40,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x0b,0x00,0x00,0x38,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x36,0x00,0x36,0x00,
+0x36,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x00,0x00,0x17,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x03,0x00,0x00,0x3f,0x00,0x3f,0x00,0x3f,
+0x00,0x00,0x00,0x3f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x17,
+0x00,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x45,0x00,0x45,0x00,
+0x45,0x00,0x45,0x00,0x45,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,
+0x46,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,
+0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x07,0x00,
+0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x00,
+0x00,0x77,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x33,0x00,0x00,
+0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,
+0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4c,0x00,0x4c,0x00,
+0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,
+0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,
+0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,
+0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,
+0x4d,0x00,0x4d,0x00,0x4d,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x05,0x00,0x00,0x00,0x02,0x00,0x00,0x4b,0x00,0x4b,0x00,0x00,0x00,0x1d,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x4c,0x00,0x4c,0x00,
+0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,
+0x00,0x4d,0x00,0x4d,0x00,0x00,0x00,0x25,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x0a,0x00,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,
+0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x00,0x00,0x19,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x04,0x00,0x00,0x51,0x00,0x51,0x00,0x51,
+0x00,0x51,0x00,0x00,0x00,0x25,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x0a,0x00,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,
+0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x05,0x00,0x00,0x00,0x04,0x00,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,
+0x00,0x00,0x00,0x39,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x14,
+0x00,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,
+0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,
+0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x07,0x00,0x00,0x5b,0x00,0x5b,0x00,0x5b,
+0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x0c,0x00,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,
+0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,
+0x5f,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+0x04,0x00,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x00,0x00,0x53,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x21,0x00,0x00,0x63,0x00,0x63,0x00,
+0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,
+0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,
+0x65,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,
+0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x00,0x00,
+0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x63,
+0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x00,0x00,0x1d,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x64,0x00,0x64,0x00,
+0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x00,0x00,0x5f,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x05,0x00,0x00,0x00,0x27,0x00,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,
+0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x6c,
+0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x6d,0x00,0x6d,0x00,0x6d,0x00,0x6d,
+0x00,0x6d,0x00,0x6d,0x00,0x6d,0x00,0x6d,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6e,
+0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,
+0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,
+0x6b,0x00,0x6b,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,
+0x00,0x00,0x06,0x00,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x6c,
+0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x06,
+0x00,0x00,0x6d,0x00,0x6d,0x00,0x6d,0x00,0x6d,0x00,0x6d,0x00,0x6d,0x00,0x00,0x00,
+0x41,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x18,0x00,0x00,0x73,
+0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,
+0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,
+0x00,0x73,0x00,0x73,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x00,
+0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x07,0x00,0x00,
+0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x00,0x00,
+0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x74,
+0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x00,0x00,0x1f,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x07,0x00,0x00,0x74,0x00,0x74,0x00,
+0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x00,0x00,0x39,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x14,0x00,0x00,0x78,0x00,0x78,0x00,0x78,
+0x00,0x79,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x7a,
+0x00,0x7a,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,
+0x00,0x7b,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x05,0x00,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x00,0x00,
+0x3f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x17,0x00,0x00,0x7f,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x00,0x00,0x1b,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x05,0x00,0x00,0x80,0x00,
+0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x05,0x00,0x00,0x00,0x08,0x00,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,
+0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x05,0x00,0x00,0x82,0x00,0x82,0x00,0x82,0x00,
+0x82,0x00,0x82,0x00,0x00,0x00,0x41,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,
+0x00,0x00,0x18,0x00,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,
+0x00,0x86,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,
+0x00,0x87,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,
+0x00,0x88,0x00,0x88,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x0d,0x00,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,
+0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,
+0x00,0x00,0x2b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x0d,0x00,
+0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,
+0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x00,0x00,0xbb,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x55,0x00,0x00,0x8c,0x00,0x8c,0x00,
+0x8c,0x00,0x8c,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8e,0x00,0x8e,0x00,
+0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,
+0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,
+0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,
+0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,
+0x8f,0x00,0x8f,0x00,0x8f,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,
+0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,
+0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,
+0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,
+0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,
+0x91,0x00,0x91,0x00,0x91,0x00,0x00,0x00,0x67,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x06,0x00,0x00,0x00,0x2b,0x00,0x00,0x05,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,
+0x00,0x06,0x00,0x06,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,
+0x00,0x07,0x00,0x07,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,
+0x00,0x08,0x00,0x08,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,
+0x00,0x09,0x00,0x09,0x00,0x0b,0x00,0x0c,0x00,0x0c,0x00,0x0d,0x00,0x0d,0x00,0x0d,
+0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,0x2d,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,
+0x11,0x00,0x11,0x00,0x11,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,
+0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x00,0x00,0x61,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x28,0x00,0x00,0x17,0x00,0x18,0x00,0x18,
+0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,
+0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x1a,0x00,0x1a,0x00,0x1a,
+0x00,0x1a,0x00,0x1a,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1c,
+0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,
+0x00,0x1d,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x00,0x00,0x65,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x2a,0x00,0x00,0x22,0x00,0x23,0x00,
+0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
+0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,
+0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x27,0x00,
+0x27,0x00,0x27,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x29,0x00,
+0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,
+0x00,0x00,0x65,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x2a,0x00,
+0x00,0x2e,0x00,0x2f,0x00,0x2f,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,
+0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x31,0x00,0x31,0x00,0x31,
+0x00,0x31,0x00,0x31,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x33,
+0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,
+0x00,0x34,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x36,0x00,0x36,
+0x00,0x36,0x00,0x36,0x00,0x00,0x00,0x31,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,
+0x00,0x00,0x00,0x10,0x00,0x00,0x3a,0x00,0x3b,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,
+0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,
+0x3c,0x00,0x3c,0x00,0x3c,0x00,0x00,0x00,0x31,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x06,0x00,0x00,0x00,0x10,0x00,0x00,0x40,0x00,0x41,0x00,0x42,0x00,0x42,0x00,0x42,
+0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,
+0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x00,0x00,0x31,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x06,0x00,0x00,0x00,0x10,0x00,0x00,0x46,0x00,0x47,0x00,0x48,0x00,0x48,0x00,
+0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,
+0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x06,0x00,0x00,0x00,0x0b,0x00,0x00,0x4c,0x00,0x4c,0x00,0x4c,0x00,0x4c,
+0x00,0x4c,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x00,
+0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x0b,0x00,0x00,
+0x51,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x53,0x00,0x54,0x00,0x54,0x00,0x54,0x00,
+0x54,0x00,0x54,0x00,0x54,0x00,0x00,0x00,0x33,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x06,0x00,0x00,0x00,0x11,0x00,0x00,0x58,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x5a,
+0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5d,
+0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x00,0x00,0x5b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x25,0x00,0x00,0x61,0x00,0x61,0x00,0x61,0x00,
+0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
+0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,
+0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,
+0x66,0x00,0x66,0x00,0x66,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,
+0x69,0x00,0x69,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,0x00,
+0x00,0x00,0x03,0x00,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x00,0x00,0x43,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x19,0x00,0x00,0x6d,0x00,0x6d,0x00,
+0x6d,0x00,0x6d,0x00,0x6d,0x00,0x6d,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,
+0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,
+0x6f,0x00,0x6f,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x00,0x00,
+0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x70,
+0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x00,0x00,0x43,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x06,0x00,0x00,0x00,0x19,0x00,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,
+0x74,0x00,0x74,0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x75,0x00,
+0x75,0x00,0x76,0x00,0x76,0x00,0x76,0x00,0x76,0x00,0x76,0x00,0x76,0x00,0x76,0x00,
+0x77,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x00,0x00,0x19,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x77,0x00,0x77,0x00,0x77,
+0x00,0x77,0x00,0x00,0x00,0x91,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,
+0x00,0x40,0x00,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,
+0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,
+0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,
+0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x00,
+0x7e,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x00,0x7f,0x00,0x7f,0x00,
+0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x80,0x00,
+0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x00,0x00,0x91,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,0x00,
+0x00,0x00,0x40,0x00,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,
+0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,
+0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,
+0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x88,0x00,0x88,0x00,0x88,
+0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x89,0x00,0x89,
+0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x8a,
+0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,
+0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,
+0x00,0x8b,0x00,0x8b,0x00,0x00,0x00,0x63,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,
+0x00,0x00,0x00,0x29,0x00,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,
+0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x91,0x00,0x91,0x00,0x91,0x00,
+0x91,0x00,0x91,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x93,0x00,
+0x93,0x00,0x93,0x00,0x93,0x00,0x93,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,
+0x94,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x96,0x00,0x96,0x00,
+0x96,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x00,0x00,0x6d,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x06,0x00,0x00,0x00,0x2e,0x00,0x00,0x9a,0x00,0x9a,0x00,0x9a,0x00,0x9a,
+0x00,0x9a,0x00,0x9b,0x00,0x9b,0x00,0x9b,0x00,0x9b,0x00,0x9b,0x00,0x9c,0x00,0x9c,
+0x00,0x9c,0x00,0x9c,0x00,0x9c,0x00,0x9d,0x00,0x9d,0x00,0x9d,0x00,0x9d,0x00,0x9d,
+0x00,0x9e,0x00,0x9e,0x00,0x9e,0x00,0x9e,0x00,0x9e,0x00,0x9f,0x00,0x9f,0x00,0x9f,
+0x00,0x9f,0x00,0x9f,0x00,0xa0,0x00,0xa0,0x00,0xa0,0x00,0xa0,0x00,0xa0,0x00,0xa1,
+0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa2,0x00,0xa2,0x00,0xa2,0x00,0xa2,
+0x00,0xa2,0x00,0xa2,0x00,0x00,0x00,0x43,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x07,
+0x00,0x00,0x00,0x19,0x00,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x08,0x00,0x08,0x00,0x08,0x00,
+0x08,0x00,0x08,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x07,0x00,0x00,0x00,0x03,0x00,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x00,
+0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x03,0x00,0x00,
+0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,
+0x00,0x12,0x00,0x12,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x07,
+0x00,0x00,0x00,0x07,0x00,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,
+0x16,0x00,0x16,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,
+0x00,0x00,0x0b,0x00,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x06,
+0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0xad,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x4e,0x00,0x00,0x0a,0x00,0x0b,0x00,
+0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,
+0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,
+0x0e,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,
+0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,
+0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,
+0x11,0x00,0x11,0x00,0x13,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x15,0x00,0x15,0x00,
+0x15,0x00,0x15,0x00,0x15,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x17,0x00,0x17,0x00,
+0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x00,0x00,0x75,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x08,0x00,0x00,0x00,0x32,0x00,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,
+0x00,0x1b,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1d,0x00,0x1d,
+0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1e,0x00,0x1e,0x00,0x1e,
+0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,
+0x00,0x1f,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,
+0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,
+0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x00,0x00,0x19,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x04,0x00,0x00,0x22,0x00,
+0x22,0x00,0x22,0x00,0x22,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x08,0x00,0x00,0x00,0x03,0x00,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x00,0x00,0x4f,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x1f,0x00,0x00,0x2b,0x00,
+0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x3e,0x00,0x34,0x00,0x34,0x00,0x34,0x00,
+0x34,0x00,0x34,0x00,0x34,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x3f,0x00,
+0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,
+0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x1b,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x05,0x00,0x00,0x2b,0x00,0x2c,
+0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x00,0x00,0x33,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x08,0x00,0x00,0x00,0x11,0x00,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,
+0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,
+0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x17,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x03,0x00,0x00,0x2f,0x00,0x2f,0x00,0x2f,
+0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x03,
+0x00,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x08,0x00,0x00,0x00,0x03,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x00,
+0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x06,0x00,0x00,
+0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x00,0x00,0x1b,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x05,0x00,0x00,0x37,0x00,0x38,
+0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x08,0x00,0x00,0x00,0x0d,0x00,0x00,0x39,0x00,0x39,0x00,0x39,0x00,0x39,0x00,
+0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,
+0x3b,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+0x04,0x00,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x00,0x00,0x71,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x30,0x00,0x00,0x44,0x00,0x44,0x00,
+0x44,0x00,0x44,0x00,0x44,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,
+0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,
+0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x47,0x00,0x47,0x00,0x47,0x00,
+0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,
+0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,
+0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x00,0x00,0x83,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x39,0x00,0x00,0x4c,0x00,0x4c,
+0x00,0x4c,0x00,0x4c,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4e,
+0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4f,0x00,0x4f,0x00,0x4f,
+0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,
+0x00,0x50,0x00,0x50,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x51,
+0x00,0x51,0x00,0x51,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,
+0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,
+0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x00,
+0x00,0x5b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x25,0x00,0x00,
+0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,
+0x58,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,
+0x59,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,
+0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,
+0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x00,0x00,0xe9,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x6c,0x00,0x00,0x5f,0x00,0x5f,0x00,0x5f,
+0x00,0x5f,0x00,0x5f,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,
+0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,
+0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,
+0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,
+0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,
+0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,
+0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,
+0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,
+0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,
+0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x66,
+0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x67,
+0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,
+0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6a,0x00,0x6a,0x00,0x6a,0x00,0x6a,
+0x00,0x6a,0x00,0x00,0x00,0xa1,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,
+0x00,0x48,0x00,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,
+0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,
+0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x70,0x00,
+0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,
+0x71,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x72,0x00,
+0x72,0x00,0x72,0x00,0x72,0x00,0x72,0x00,0x72,0x00,0x72,0x00,0x72,0x00,0x72,0x00,
+0x72,0x00,0x72,0x00,0x72,0x00,0x72,0x00,0x72,0x00,0x73,0x00,0x73,0x00,0x73,0x00,
+0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,
+0x74,0x00,0x74,0x00,0x74,0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x75,0x00,
+0x75,0x00,0x75,0x00,0x00,0x00,0x8d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,
+0x00,0x00,0x3e,0x00,0x00,0x79,0x00,0x79,0x00,0x79,0x00,0x79,0x00,0x7a,0x00,0x7a,
+0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,
+0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7c,0x00,0x7c,
+0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7d,0x00,0x7d,0x00,0x7d,
+0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7e,0x00,0x7e,0x00,0x7e,
+0x00,0x7e,0x00,0x7e,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x00,0x00,0xd1,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x60,
+0x00,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x86,0x00,
+0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x87,0x00,0x87,0x00,0x87,0x00,
+0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,
+0x88,0x00,0x88,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,
+0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8b,0x00,
+0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8c,0x00,
+0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,
+0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,
+0x8d,0x00,0x8d,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,
+0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,
+0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,
+0x8f,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,
+0x90,0x00,0x00,0x00,0x91,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,
+0x40,0x00,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x95,0x00,0x95,0x00,0x95,
+0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,
+0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,
+0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,
+0x00,0x99,0x00,0x99,0x00,0x99,0x00,0x99,0x00,0x99,0x00,0x9a,0x00,0x9a,0x00,0x9a,
+0x00,0x9a,0x00,0x9a,0x00,0x9a,0x00,0x9b,0x00,0x9b,0x00,0x9b,0x00,0x9b,0x00,0x9b,
+0x00,0x9b,0x00,0x9c,0x00,0x9c,0x00,0x9c,0x00,0x9c,0x00,0x9c,0x00,0x9d,0x00,0x9d,
+0x00,0x9d,0x00,0x9d,0x00,0x9d,0x00,0x9d,0x00,0x9d,0x00,0x9d,0x00,0x9d,0x00,0x9d,
+0x00,0x9d,0x00,0x00,0x00,0x55,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,
+0x00,0x22,0x00,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,
+0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa2,0x00,
+0xa2,0x00,0xa2,0x00,0xa2,0x00,0xa2,0x00,0xa2,0x00,0xa2,0x00,0xa2,0x00,0xa2,0x00,
+0xa2,0x00,0xa2,0x00,0xa3,0x00,0xa3,0x00,0xa3,0x00,0xa3,0x00,0xa3,0x00,0xa3,0x00,
+0xa3,0x00,0xa3,0x00,0xa3,0x00,0xa3,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x09,0x00,0x00,0x00,0x0e,0x00,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,
+0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x4f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,
+0x00,0x00,0x00,0x1f,0x00,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,
+0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0c,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,
+0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,
+0x10,0x00,0x10,0x00,0x00,0x00,0x37,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,
+0x00,0x00,0x13,0x00,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,
+0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x16,0x00,0x16,
+0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x00,0x00,0x47,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x1b,0x00,0x00,0x1a,0x00,0x1a,0x00,
+0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,
+0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,
+0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,
+0x1d,0x00,0x00,0x00,0x83,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+0x39,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,
+0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x25,
+0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x28,
+0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,
+0x00,0x28,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,
+0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x2b,0x00,0x2b,0x00,0x2b,
+0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,
+0x00,0x2c,0x00,0x2c,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,
+0x00,0x00,0x00,0x04,0x00,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x00,0x00,
+0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x04,0x00,0x00,0x2c,
+0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x00,0x00,0x69,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x09,0x00,0x00,0x00,0x2c,0x00,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+0x30,0x00,0x31,0x00,0x31,0x00,0x31,0x00,0x31,0x00,0x31,0x00,0x31,0x00,0x31,0x00,
+0x31,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,
+0x32,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,
+0x34,0x00,0x34,0x00,0x34,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,
+0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,
+0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x04,0x00,
+0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x1d,0x00,0x00,0x39,0x00,0x39,0x00,0x39,0x00,
+0x39,0x00,0x39,0x00,0x3a,0x00,0x3a,0x00,0x3b,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,
+0x3d,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,
+0x3e,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,
+0x3f,0x00,0x3f,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,
+0x00,0x00,0x04,0x00,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x3d,0x00,0x00,0x00,0x51,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x20,0x00,0x00,0x43,0x00,
+0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x45,0x00,
+0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,
+0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x49,0x00,0x49,0x00,
+0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x00,0x00,
+0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x04,0x00,0x00,0x47,
+0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x09,0x00,0x00,0x00,0x1d,0x00,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,
+0x4d,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4f,0x00,0x51,0x00,0x51,0x00,0x51,0x00,
+0x51,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,
+0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,
+0x53,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+0x04,0x00,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x00,0x01,0xb5,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0xd2,0x00,0x00,0x57,0x00,0x57,0x00,
+0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,
+0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,
+0x57,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,
+0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x00,
+0x58,0x00,0x58,0x00,0x58,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,
+0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,
+0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x5a,0x00,0x5a,0x00,
+0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,
+0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,
+0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,0x5a,0x00,
+0x5a,0x00,0x5a,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,
+0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,
+0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,
+0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,
+0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,
+0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,
+0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5d,0x00,
+0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,
+0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,
+0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,
+0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,
+0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,
+0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,
+0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,
+0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,
+0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,
+0x00,0x00,0x39,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x14,0x00,
+0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,
+0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,
+0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x1d,0x00,0x00,0x67,0x00,0x67,0x00,0x67,0x00,
+0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x68,0x00,
+0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,
+0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,
+0x69,0x00,0x69,0x00,0x00,0x00,0x37,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,
+0x00,0x00,0x13,0x00,0x00,0x6d,0x00,0x6d,0x00,0x6d,0x00,0x6d,0x00,0x6d,0x00,0x6d,
+0x00,0x6d,0x00,0x6d,0x00,0x6e,0x00,0x6e,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,
+0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x00,0x00,0x5d,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x26,0x00,0x00,0x73,0x00,0x73,0x00,
+0x73,0x00,0x73,0x00,0x73,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,
+0x74,0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x76,0x00,
+0x76,0x00,0x76,0x00,0x76,0x00,0x76,0x00,0x76,0x00,0x76,0x00,0x77,0x00,0x78,0x00,
+0x78,0x00,0x78,0x00,0x78,0x00,0x79,0x00,0x79,0x00,0x79,0x00,0x79,0x00,0x7a,0x00,
+0x7a,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x09,0x00,0x00,0x00,0x03,0x00,0x00,0x78,0x00,0x78,0x00,0x78,0x00,0x00,
+0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x04,0x00,0x00,
+0x7a,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x00,0x03,0x51,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x09,0x00,0x00,0x01,0xa0,0x00,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x00,0x7e,
+0x00,0x7e,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,
+0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,
+0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,
+0x00,0x81,0x00,0x81,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,
+0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x83,
+0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,
+0x00,0x83,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,
+0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,
+0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,
+0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,
+0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x87,0x00,0x87,0x00,0x87,
+0x00,0x87,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,
+0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,
+0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x8a,0x00,0x8a,0x00,0x8a,
+0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,
+0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,0x00,0x8a,
+0x00,0x8a,0x00,0x8a,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,
+0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,
+0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8b,0x00,0x8c,
+0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,
+0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,
+0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8c,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,
+0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,
+0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8d,
+0x00,0x8d,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,
+0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,
+0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8f,0x00,0x8f,
+0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,
+0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x8f,
+0x00,0x8f,0x00,0x8f,0x00,0x8f,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,
+0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,
+0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,
+0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,
+0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,
+0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x92,0x00,0x92,0x00,0x92,
+0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x92,
+0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x92,
+0x00,0x92,0x00,0x92,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,
+0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,
+0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x95,
+0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,
+0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,
+0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,
+0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,
+0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,
+0x00,0x96,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,
+0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,
+0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x98,0x00,0x98,
+0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,
+0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,
+0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x05,0x00,0x00,0x83,0x00,0x83,0x00,0x83,0x00,
+0x83,0x00,0x83,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,
+0x00,0x00,0x07,0x00,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,
+0x00,0x84,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,
+0x00,0x04,0x00,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x00,0x00,0x19,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x04,0x00,0x00,0x86,0x00,0x86,
+0x00,0x86,0x00,0x86,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,
+0x00,0x00,0x00,0x03,0x00,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x00,0x00,0x19,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x04,0x00,0x00,0x8f,0x00,0x8f,
+0x00,0x8f,0x00,0x8f,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,
+0x00,0x00,0x00,0x04,0x00,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x00,0x00,
+0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x04,0x00,0x00,0x91,
+0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x09,0x00,0x00,0x00,0x04,0x00,0x00,0x92,0x00,0x92,0x00,0x92,0x00,0x92,0x00,
+0x00,0x00,0x55,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x22,0x00,
+0x00,0x9c,0x00,0x9c,0x00,0x9c,0x00,0x9c,0x00,0x9c,0x00,0x9d,0x00,0x9e,0x00,0x9e,
+0x00,0x9e,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa1,
+0x00,0xa1,0x00,0xa3,0x00,0xa3,0x00,0xa3,0x00,0xa3,0x00,0xa4,0x00,0xa4,0x00,0xa4,
+0x00,0xa4,0x00,0xa4,0x00,0xa4,0x00,0xa4,0x00,0xa4,0x00,0xa4,0x00,0xa4,0x00,0xa4,
+0x00,0xa6,0x00,0xa6,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,
+0x00,0x00,0x00,0x05,0x00,0x00,0x9e,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,
+0x00,0x00,0x85,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x3a,0x00,
+0x00,0xab,0x00,0xab,0x00,0xab,0x00,0xab,0x00,0xab,0x00,0xac,0x00,0xac,0x00,0xac,
+0x00,0xac,0x00,0xac,0x00,0xac,0x00,0xac,0x00,0xac,0x00,0xac,0x00,0xad,0x00,0xad,
+0x00,0xad,0x00,0xad,0x00,0xad,0x00,0xad,0x00,0xad,0x00,0xad,0x00,0xae,0x00,0xae,
+0x00,0xae,0x00,0xae,0x00,0xae,0x00,0xae,0x00,0xae,0x00,0xae,0x00,0xae,0x00,0xae,
+0x00,0xaf,0x00,0xaf,0x00,0xaf,0x00,0xaf,0x00,0xaf,0x00,0xaf,0x00,0xaf,0x00,0xaf,
+0x00,0xaf,0x00,0xaf,0x00,0xb0,0x00,0xb0,0x00,0xb0,0x00,0xb0,0x00,0xb0,0x00,0xb0,
+0x00,0xb0,0x00,0xb0,0x00,0xb0,0x00,0xb0,0x00,0xb1,0x00,0xb1,0x00,0xb1,0x00,0xb1,
+0x00,0xb1,0x00,0xb1,0x00,0x00,0x00,0x85,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,
+0x00,0x00,0x00,0x3a,0x00,0x00,0xb5,0x00,0xb5,0x00,0xb5,0x00,0xb5,0x00,0xb5,0x00,
+0xb6,0x00,0xb6,0x00,0xb6,0x00,0xb6,0x00,0xb6,0x00,0xb6,0x00,0xb6,0x00,0xb6,0x00,
+0xb6,0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,
+0xb7,0x00,0xb8,0x00,0xb8,0x00,0xb8,0x00,0xb8,0x00,0xb8,0x00,0xb8,0x00,0xb8,0x00,
+0xb8,0x00,0xb8,0x00,0xb8,0x00,0xb9,0x00,0xb9,0x00,0xb9,0x00,0xb9,0x00,0xb9,0x00,
+0xb9,0x00,0xb9,0x00,0xb9,0x00,0xb9,0x00,0xb9,0x00,0xba,0x00,0xba,0x00,0xba,0x00,
+0xba,0x00,0xba,0x00,0xba,0x00,0xba,0x00,0xba,0x00,0xba,0x00,0xba,0x00,0xbb,0x00,
+0xbb,0x00,0xbb,0x00,0xbb,0x00,0xbb,0x00,0xbb,0x00,0x00,0x00,0x93,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x41,0x00,0x00,0xbf,0x00,0xbf,0x00,0xbf,
+0x00,0xbf,0x00,0xbf,0x00,0xbf,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc1,0x00,0xc1,
+0x00,0xc1,0x00,0xc1,0x00,0xc1,0x00,0xc1,0x00,0xc1,0x00,0xc1,0x00,0xc1,0x00,0xc3,
+0x00,0xc3,0x00,0xc3,0x00,0xc3,0x00,0xc3,0x00,0xc3,0x00,0xc4,0x00,0xc4,0x00,0xc4,
+0x00,0xc4,0x00,0xc4,0x00,0xc4,0x00,0xc5,0x00,0xc5,0x00,0xc5,0x00,0xc5,0x00,0xc7,
+0x00,0xc7,0x00,0xc7,0x00,0xc7,0x00,0xc7,0x00,0xc7,0x00,0xc8,0x00,0xc8,0x00,0xc8,
+0x00,0xc8,0x00,0xc8,0x00,0xc8,0x00,0xc8,0x00,0xc8,0x00,0xc8,0x00,0xc9,0x00,0xc9,
+0x00,0xc9,0x00,0xc9,0x00,0xc9,0x00,0xc9,0x00,0xc9,0x00,0xc9,0x00,0x00,0x00,0x15,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x02,0x00,0x00,0xc0,0x00,
+0xc0,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+0x02,0x00,0x00,0xc4,0x00,0xc4,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x09,0x00,0x00,0x00,0x05,0x00,0x00,0xc8,0x00,0xc8,0x00,0xc8,0x00,0xc8,0x00,
+0xc8,0x00,0x00,0x00,0x87,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+0x3b,0x00,0x00,0xcd,0x00,0xcd,0x00,0xcd,0x00,0xcd,0x00,0xcd,0x00,0xcd,0x00,0xce,
+0x00,0xce,0x00,0xce,0x00,0xce,0x00,0xce,0x00,0xcf,0x00,0xcf,0x00,0xcf,0x00,0xcf,
+0x00,0xcf,0x00,0xcf,0x00,0xcf,0x00,0xcf,0x00,0xcf,0x00,0xd1,0x00,0xd1,0x00,0xd1,
+0x00,0xd1,0x00,0xd1,0x00,0xd1,0x00,0xd2,0x00,0xd2,0x00,0xd2,0x00,0xd2,0x00,0xd2,
+0x00,0xd2,0x00,0xd3,0x00,0xd3,0x00,0xd3,0x00,0xd3,0x00,0xd5,0x00,0xd5,0x00,0xd5,
+0x00,0xd5,0x00,0xd5,0x00,0xd5,0x00,0xd6,0x00,0xd6,0x00,0xd6,0x00,0xd6,0x00,0xd6,
+0x00,0xd6,0x00,0xd6,0x00,0xd6,0x00,0xd6,0x00,0xd7,0x00,0xd7,0x00,0xd7,0x00,0xd7,
+0x00,0xd7,0x00,0xd7,0x00,0xd7,0x00,0xd7,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x02,0x00,0x00,0xce,0x00,0xce,0x00,0x00,0x00,
+0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x02,0x00,0x00,0xd2,
+0x00,0xd2,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,
+0x00,0x05,0x00,0x00,0xd6,0x00,0xd6,0x00,0xd6,0x00,0xd6,0x00,0xd6,0x00,0x00,0x00,
+0x7d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x36,0x00,0x00,0xdb,
+0x00,0xdb,0x00,0xdb,0x00,0xdb,0x00,0xdb,0x00,0xdc,0x00,0xdc,0x00,0xdc,0x00,0xdc,
+0x00,0xdc,0x00,0xdc,0x00,0xdc,0x00,0xdc,0x00,0xdc,0x00,0xdc,0x00,0xdc,0x00,0xdc,
+0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xdd,
+0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xdd,
+0x00,0xdd,0x00,0xdf,0x00,0xdf,0x00,0xdf,0x00,0xdf,0x00,0xdf,0x00,0xe0,0x00,0xe0,
+0x00,0xe0,0x00,0xe0,0x00,0xe0,0x00,0xe0,0x00,0xe0,0x00,0xe0,0x00,0xe0,0x00,0xe0,
+0x00,0xe0,0x00,0xe0,0x00,0xe0,0x00,0xe0,0x00,0xe0,0x00,0x00,0x00,0x8f,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x3f,0x00,0x00,0xe5,0x00,0xe5,0x00,
+0xe5,0x00,0xe5,0x00,0xe5,0x00,0xe5,0x00,0xe6,0x00,0xe6,0x00,0xe6,0x00,0xe6,0x00,
+0xe6,0x00,0xe6,0x00,0xe6,0x00,0xe6,0x00,0xe7,0x00,0xe7,0x00,0xe7,0x00,0xe7,0x00,
+0xe7,0x00,0xe7,0x00,0xe8,0x00,0xe8,0x00,0xe8,0x00,0xe8,0x00,0xe8,0x00,0xe8,0x00,
+0xe9,0x00,0xe9,0x00,0xe9,0x00,0xe9,0x00,0xe9,0x00,0xec,0x00,0xec,0x00,0xec,0x00,
+0xec,0x00,0xec,0x00,0xec,0x00,0xed,0x00,0xed,0x00,0xed,0x00,0xed,0x00,0xed,0x00,
+0xed,0x00,0xed,0x00,0xed,0x00,0xee,0x00,0xee,0x00,0xee,0x00,0xee,0x00,0xee,0x00,
+0xef,0x00,0xef,0x00,0xef,0x00,0xef,0x00,0xef,0x00,0xef,0x00,0xf0,0x00,0xf0,0x00,
+0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x05,0x00,0x00,0xe6,0x00,0xe6,0x00,0xe6,
+0x00,0xe6,0x00,0xe6,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,
+0x00,0x00,0x00,0x05,0x00,0x00,0xe7,0x00,0xe7,0x00,0xe7,0x00,0xe7,0x00,0xe7,0x00,
+0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x05,0x00,
+0x00,0xe8,0x00,0xe8,0x00,0xe8,0x00,0xe8,0x00,0xe8,0x00,0x00,0x00,0x1b,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x05,0x00,0x00,0xe9,0x00,0xe9,0x00,
+0xe9,0x00,0xe9,0x00,0xe9,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x09,0x00,0x00,0x00,0x08,0x00,0x00,0xed,0x00,0xed,0x00,0xed,0x00,0xed,0x00,0xed,
+0x00,0xed,0x00,0xed,0x00,0xed,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x09,0x00,0x00,0x00,0x08,0x00,0x00,0xee,0x00,0xee,0x00,0xee,0x00,0xee,0x00,
+0xee,0x00,0xee,0x00,0xee,0x00,0xee,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x09,0x00,0x00,0x00,0x03,0x00,0x00,0xef,0x00,0xef,0x00,0xef,0x00,0x00,
+0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x03,0x00,0x00,
+0xf0,0x00,0xf0,0x00,0xf0,0x00,0x00,0x00,0x85,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x09,0x00,0x00,0x00,0x3a,0x00,0x00,0xf4,0x00,0xf4,0x00,0xf4,0x00,0xf4,0x00,0xf4,
+0x00,0xf4,0x00,0xf5,0x00,0xf5,0x00,0xf5,0x00,0xf5,0x00,0xf5,0x00,0xf5,0x00,0xf5,
+0x00,0xf5,0x00,0xf5,0x00,0xf5,0x00,0xf5,0x00,0xf6,0x00,0xf6,0x00,0xf6,0x00,0xf6,
+0x00,0xf6,0x00,0xf6,0x00,0xf6,0x00,0xf6,0x00,0xf6,0x00,0xf8,0x00,0xf8,0x00,0xf8,
+0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x00,0xf9,0x00,0xf9,0x00,0xf9,0x00,0xf9,
+0x00,0xf9,0x00,0xfa,0x00,0xfa,0x00,0xfa,0x00,0xfa,0x00,0xfc,0x00,0xfc,0x00,0xfc,
+0x00,0xfc,0x00,0xfc,0x00,0xfc,0x00,0xfd,0x00,0xfd,0x00,0xfd,0x00,0xfd,0x00,0xfd,
+0x00,0xfd,0x00,0xfd,0x00,0xfd,0x00,0xfd,0x00,0xfd,0x00,0x00,0x00,0x15,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x02,0x00,0x00,0xf5,0x00,0xf5,0x00,
+0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x02,0x00,
+0x00,0xf9,0x00,0xf9,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,
+0x00,0x00,0x00,0x05,0x00,0x00,0xfd,0x00,0xfd,0x00,0xfd,0x00,0xfd,0x00,0xfd,0x00,
+0x00,0x00,0x8f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x3f,0x00,
+0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x02,0x01,0x02,
+0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,
+0x01,0x02,0x01,0x03,0x01,0x03,0x01,0x03,0x01,0x03,0x01,0x03,0x01,0x03,0x01,0x03,
+0x01,0x03,0x01,0x03,0x01,0x05,0x01,0x05,0x01,0x05,0x01,0x05,0x01,0x05,0x01,0x05,
+0x01,0x06,0x01,0x06,0x01,0x06,0x01,0x06,0x01,0x06,0x01,0x06,0x01,0x07,0x01,0x07,
+0x01,0x07,0x01,0x07,0x01,0x09,0x01,0x09,0x01,0x09,0x01,0x09,0x01,0x09,0x01,0x09,
+0x01,0x0a,0x01,0x0a,0x01,0x0a,0x01,0x0a,0x01,0x0a,0x01,0x0a,0x01,0x0a,0x01,0x0a,
+0x01,0x0b,0x01,0x0b,0x01,0x0b,0x01,0x0b,0x01,0x0b,0x01,0x0b,0x01,0x0b,0x00,0x00,
+0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x02,0x00,0x01,
+0x02,0x01,0x02,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,
+0x00,0x00,0x02,0x00,0x01,0x06,0x01,0x06,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x05,0x00,0x01,0x0a,0x01,0x0a,0x01,0x0a,0x01,
+0x0a,0x01,0x0a,0x00,0x00,0x00,0x83,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,
+0x00,0x00,0x39,0x00,0x01,0x0f,0x01,0x0f,0x01,0x0f,0x01,0x0f,0x01,0x0f,0x01,0x0f,
+0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x11,0x01,0x11,0x01,0x11,
+0x01,0x11,0x01,0x11,0x01,0x11,0x01,0x11,0x01,0x11,0x01,0x11,0x01,0x13,0x01,0x13,
+0x01,0x13,0x01,0x13,0x01,0x13,0x01,0x13,0x01,0x14,0x01,0x14,0x01,0x14,0x01,0x14,
+0x01,0x14,0x01,0x14,0x01,0x15,0x01,0x15,0x01,0x15,0x01,0x15,0x01,0x17,0x01,0x17,
+0x01,0x17,0x01,0x17,0x01,0x17,0x01,0x17,0x01,0x18,0x01,0x18,0x01,0x18,0x01,0x18,
+0x01,0x18,0x01,0x18,0x01,0x18,0x01,0x18,0x01,0x19,0x01,0x19,0x01,0x19,0x01,0x19,
+0x01,0x19,0x01,0x19,0x01,0x19,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x09,0x00,0x00,0x00,0x02,0x00,0x01,0x10,0x01,0x10,0x00,0x00,0x00,0x15,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x02,0x00,0x01,0x14,0x01,0x14,
+0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x05,
+0x00,0x01,0x18,0x01,0x18,0x01,0x18,0x01,0x18,0x01,0x18,0x00,0x00,0x00,0x93,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x41,0x00,0x01,0x1d,0x01,0x1d,
+0x01,0x1d,0x01,0x1d,0x01,0x1d,0x01,0x1d,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,
+0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x20,
+0x01,0x20,0x01,0x20,0x01,0x20,0x01,0x20,0x01,0x20,0x01,0x20,0x01,0x20,0x01,0x20,
+0x01,0x20,0x01,0x20,0x01,0x20,0x01,0x20,0x01,0x21,0x01,0x21,0x01,0x21,0x01,0x21,
+0x01,0x21,0x01,0x21,0x01,0x21,0x01,0x21,0x01,0x21,0x01,0x21,0x01,0x21,0x01,0x21,
+0x01,0x21,0x01,0x22,0x01,0x22,0x01,0x22,0x01,0x22,0x01,0x22,0x01,0x22,0x01,0x22,
+0x01,0x22,0x01,0x22,0x01,0x22,0x01,0x22,0x01,0x22,0x01,0x22,0x01,0x22,0x01,0x22,
+0x01,0x22,0x01,0x22,0x01,0x23,0x01,0x23,0x01,0x23,0x01,0x23,0x01,0x23,0x00,0x00,
+0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x04,0x00,0x01,
+0x23,0x01,0x23,0x01,0x23,0x01,0x23,0x00,0x00,0x00,0x73,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x0a,0x00,0x00,0x00,0x31,0x00,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+0x00,0x05,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x08,0x00,0x08,
+0x00,0x08,0x00,0x08,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0b,
+0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x10,0x00,0x0f,0x00,0x0f,0x00,0x0f,
+0x00,0x0f,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x12,0x00,0x11,
+0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,
+0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x00,0x00,0x15,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x02,0x00,0x00,0x0b,0x00,0x0c,0x00,
+0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x06,0x00,
+0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x00,0x00,0x57,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x23,0x00,0x00,0x1a,0x00,
+0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1b,0x00,0x1b,0x00,
+0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1d,0x00,
+0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+0x1f,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
+0x20,0x00,0x20,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,
+0x00,0x00,0x07,0x00,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1e,
+0x00,0x1e,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,
+0x00,0x07,0x00,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+0x1f,0x00,0x00,0x00,0x6f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+0x2f,0x00,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,
+0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,
+0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x27,
+0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x2c,0x00,0x29,0x00,0x29,0x00,0x29,
+0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,
+0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,
+0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x02,
+0x00,0x00,0x27,0x00,0x27,0x00,0x00,0x00,0xc7,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x0a,0x00,0x00,0x00,0x5b,0x00,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,
+0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x31,0x00,0x31,0x00,0x31,0x00,0x31,
+0x00,0x31,0x00,0x31,0x00,0x31,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,
+0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x36,0x00,0x36,
+0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,
+0x00,0x37,0x00,0x37,0x00,0x39,0x00,0x39,0x00,0x39,0x00,0x3a,0x00,0x3a,0x00,0x3a,
+0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3b,0x00,0x3d,
+0x00,0x3d,0x00,0x3d,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,
+0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x42,
+0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x43,0x00,0x43,0x00,0x43,
+0x00,0x43,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x46,0x00,0x47,0x00,0x47,0x00,0x47,
+0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x00,0x00,0x15,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x02,0x00,0x00,0x36,0x00,
+0x36,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+0x02,0x00,0x00,0x37,0x00,0x37,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x0a,0x00,0x00,0x00,0x05,0x00,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,
+0x3a,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+0x05,0x00,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x00,0x00,0x15,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x02,0x00,0x00,0x42,0x00,
+0x42,0x00,0x00,0x00,0x3f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+0x17,0x00,0x00,0x47,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x49,0x00,0x49,0x00,0x49,
+0x00,0x49,0x00,0x49,0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x4a,
+0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x4a,0x00,0x4b,0x00,0x4b,0x00,0x4c,0x00,0x4c,
+0x00,0x00,0x00,0xcf,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x5f,
+0x00,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,
+0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x53,0x00,0x53,0x00,0x53,0x00,
+0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,
+0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x54,0x00,0x54,0x00,0x54,0x00,
+0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,
+0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,
+0x54,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,
+0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,
+0x55,0x00,0x55,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x56,0x00,
+0x56,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x56,0x00,
+0x56,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,
+0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,
+0x00,0x00,0x89,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x3c,0x00,
+0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5c,0x00,0x5c,
+0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5d,0x00,0x5d,0x00,0x5d,
+0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,
+0x00,0x5e,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x61,
+0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,
+0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,
+0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,
+0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x00,0x00,0x5b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x25,0x00,0x00,0x68,0x00,0x68,0x00,0x68,0x00,
+0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,
+0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6a,0x00,0x6a,0x00,
+0x6a,0x00,0x6a,0x00,0x6a,0x00,0x6a,0x00,0x6a,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,
+0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,0x6b,0x00,
+0x6b,0x00,0x6b,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,
+0x00,0x00,0x07,0x00,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,
+0x00,0x69,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x00,
+0x00,0x02,0x00,0x00,0x6b,0x00,0x6b,0x00,0x00,0x00,0x65,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x0a,0x00,0x00,0x00,0x2a,0x00,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,
+0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,0x6f,
+0x00,0x6f,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x71,
+0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x72,0x00,0x72,0x00,0x72,
+0x00,0x72,0x00,0x72,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x74,
+0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x00,0x00,0x3f,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x17,0x00,0x00,0x05,0x00,
+0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x06,0x00,0x06,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x07,0x00,0x07,0x00,
+0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x37,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x13,0x00,0x00,0x0b,0x00,0x0b,
+0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x00,0x00,0x5b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x00,
+0x00,0x25,0x00,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,
+0x10,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,
+0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,
+0x12,0x00,0x12,0x00,0x12,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,
+0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x00,0x00,
+0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x08,0x00,0x00,0x05,
+0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x00,
+0x00,0x33,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x11,0x00,0x00,
+0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x0a,0x00,0x0a,0x00,
+0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,
+0x0b,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,
+0x06,0x00,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x00,
+0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x0b,0x00,0x00,
+0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x10,0x00,0x10,0x00,0x10,0x00,
+0x10,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x0c,0x00,0x00,0x00,0x0b,0x00,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,
+0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x00,0x00,0x1d,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x06,0x00,0x00,0x19,0x00,
+0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x06,0x00,0x00,0x1d,0x00,0x1d,0x00,0x1d,
+0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x00,0x00,0x41,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x0c,0x00,0x00,0x00,0x18,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
+0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
+0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,
+0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x0c,0x00,0x00,0x00,0x05,0x00,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,
+0x00,0x28,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,
+0x00,0x0e,0x00,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x06,0x00,0x06,0x00,
+0x06,0x00,0x06,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,
+0x00,0x00,0x31,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x10,0x00,
+0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0d,0x00,0x0d,
+0x00,0x0d,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,
+0x00,0x00,0x00,0x31,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x10,
+0x00,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x15,0x00,
+0x15,0x00,0x15,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x17,0x00,0x17,0x00,0x17,0x00,
+0x17,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+0x07,0x00,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,
+0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x06,
+0x00,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x00,0x00,
+0x59,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x24,0x00,0x00,0x23,
+0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,
+0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x26,0x00,0x26,0x00,0x26,
+0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,
+0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,
+0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x0d,0x00,0x00,0x00,0x05,0x00,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,
+0x26,0x00,0x00,0x00,0x4f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,
+0x1f,0x00,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,
+0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2b,0x00,0x2b,0x00,0x2d,0x00,0x2d,
+0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,
+0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,
+0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x05,
+0x00,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x00,0x00,0x75,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x32,0x00,0x00,0x31,0x00,0x31,
+0x00,0x31,0x00,0x31,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,
+0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x38,0x00,0x38,0x00,0x38,
+0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x39,0x00,0x39,0x00,0x39,0x00,0x39,0x00,0x39,
+0x00,0x39,0x00,0x39,0x00,0x39,0x00,0x39,0x00,0x39,0x00,0x39,0x00,0x3a,0x00,0x3a,
+0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,
+0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,
+0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x06,
+0x00,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x00,0x00,
+0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x05,0x00,0x00,0x3c,
+0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x00,0x00,0x85,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x3a,0x00,0x00,0x40,0x00,0x40,0x00,0x40,0x00,
+0x40,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,
+0x46,0x00,0x46,0x00,0x46,0x00,0x46,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,
+0x47,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,
+0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,
+0x49,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,
+0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,
+0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x00,0x00,
+0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x06,0x00,0x00,0x42,
+0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x00,0x00,0x1b,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x05,0x00,0x00,0x4b,0x00,0x4b,0x00,
+0x4b,0x00,0x4b,0x00,0x4b,0x00,0x00,0x00,0x2f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x0e,0x00,0x00,0x00,0x0f,0x00,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x07,
+0x00,0x07,0x00,0x07,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,
+0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0e,
+0x00,0x00,0x00,0x05,0x00,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,
+0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x04,0x00,
+0x00,0x05,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x05,0x00,0x00,0x08,0x00,0x08,0x00,0x08,0x00,
+0x08,0x00,0x08,0x00,0x00,0x00,0x55,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,
+0x00,0x00,0x22,0x00,0x00,0x0c,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,
+0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,
+0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x14,0x00,0x10,0x00,0x11,0x00,0x12,0x00,0x13,
+0x00,0x13,0x00,0x14,0x00,0x14,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,
+0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x08,0x00,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,0x21,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x08,0x00,0x00,0x0d,0x00,0x0d,0x00,0x0d,
+0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,0x1f,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x07,0x00,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,0x21,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x08,0x00,0x00,0x0d,0x00,0x0d,0x00,0x0d,
+0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,0x1b,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x05,0x00,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x0e,0x00,0x00,0x00,0x08,0x00,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,
+0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x0e,0x00,0x00,0x00,0x05,0x00,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,
+0x15,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+0x05,0x00,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x00,0x00,0x15,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x02,0x00,0x00,0x15,0x00,
+0x15,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,
+0x06,0x00,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,
+0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x06,0x00,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x1d,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x06,0x00,0x00,0x0a,0x00,0x0a,
+0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x07,0x00,0x00,0x06,0x00,0x05,0x00,0x05,0x00,
+0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x00,0x00,0x4f,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x10,0x00,0x00,0x00,0x1f,0x00,0x00,0x16,0x00,0x16,0x00,0x09,0x00,0x09,
+0x00,0x09,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0b,0x00,0x0b,0x00,0x0b,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0e,0x00,0x12,0x00,0x11,0x00,0x11,
+0x00,0x11,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,
+0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x10,0x00,0x00,0x00,0x05,0x00,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,
+0x15,0x00,0x00,0x00,0x67,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+0x2b,0x00,0x00,0x19,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1b,0x00,0x1b,
+0x00,0x1b,0x00,0x1b,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,
+0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1e,0x00,0x1e,0x00,0x1e,
+0x00,0x1e,0x00,0x1e,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,
+0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x20,0x00,0x20,0x00,0x20,
+0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x4f,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x1f,0x00,0x00,0x24,0x00,0x25,0x00,0x25,0x00,
+0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x28,0x00,
+0x28,0x00,0x28,0x00,0x28,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,
+0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,
+0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x10,0x00,0x00,0x00,0x03,0x00,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x00,
+0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x03,0x00,0x00,
+0x2a,0x00,0x2a,0x00,0x2a,0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x10,0x00,0x00,0x00,0x0d,0x00,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,
+0x00,0x2f,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,
+0x00,0x00,0x00,0x2b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x0d,
+0x00,0x00,0x34,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x35,0x00,0x36,0x00,
+0x36,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x00,0x00,0x21,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x08,0x00,0x00,0x02,0x00,0x02,
+0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x15,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x02,0x00,0x00,0x02,0x00,
+0x02,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+0x07,0x00,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x08,0x00,0x08,0x00,0x08,
+0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x05,
+0x00,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x61,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x28,0x00,0x00,0x0c,0x00,0x0d,
+0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x16,
+0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,
+0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x19,0x00,0x19,0x00,0x19,
+0x00,0x19,0x00,0x1a,0x00,0x1a,0x00,0x1b,0x00,0x1b,0x00,0x1c,0x00,0x1c,0x00,0x1c,
+0x00,0x1c,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x00,0x00,0x1f,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x07,0x00,0x00,0x0d,0x00,
+0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x00,0x00,0x25,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0a,0x00,0x00,0x12,0x00,0x12,
+0x00,0x12,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,
+0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,
+0x00,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x11,0x00,0x00,0x00,0x03,0x00,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x00,
+0x00,0x3b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x15,0x00,0x00,
+0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
+0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x26,0x00,
+0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x00,0x00,0x17,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,0x00,0x00,0x21,0x00,0x21,0x00,0x21,
+0x00,0x00,0x00,0x55,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x22,
+0x00,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,
+0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,
+0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x31,0x00,
+0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x32,0x00,0x33,0x00,0x33,0x00,0x33,0x00,
+0x33,0x00,0x33,0x00,0x33,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x11,0x00,0x00,0x00,0x07,0x00,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,
+0x00,0x2f,0x00,0x2f,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,
+0x00,0x00,0x00,0x07,0x00,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x38,0x00,
+0x38,0x00,0x38,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,
+0x00,0x00,0x07,0x00,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,0x00,0x37,
+0x00,0x37,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,
+0x00,0x06,0x00,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,0x3c,0x00,
+0x00,0x00,0x3d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x16,0x00,
+0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,
+0x00,0x46,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,
+0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,0x00,0x00,0x1f,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x07,0x00,0x00,0x41,0x00,
+0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x00,0x00,0x1b,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x05,0x00,0x00,0x41,0x00,0x41,
+0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x11,0x00,0x00,0x00,0x07,0x00,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,
+0x44,0x00,0x44,0x00,0x44,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x11,0x00,0x00,0x00,0x05,0x00,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x44,
+0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x09,
+0x00,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x49,0x00,0x49,0x00,0x49,0x00,
+0x49,0x00,0x49,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,
+0x00,0x00,0x09,0x00,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,
+0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x11,0x00,0x00,0x00,0x02,0x00,0x00,0x4f,0x00,0x4f,0x00,0x00,0x00,0x1b,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x05,0x00,0x00,0x53,0x00,0x53,
+0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x11,0x00,0x00,0x00,0x0c,0x00,0x00,0x54,0x00,0x54,0x00,0x54,0x00,0x54,0x00,
+0x55,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x57,0x00,0x57,0x00,0x57,0x00,
+0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x02,0x00,
+0x00,0x54,0x00,0x54,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,
+0x00,0x00,0x00,0x05,0x00,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,
+0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,0x00,
+0x00,0x5c,0x00,0x5c,0x00,0x5c,0x00,0x00,0x00,0x41,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x11,0x00,0x00,0x00,0x18,0x00,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,
+0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,
+0x66,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x69,0x00,
+0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x11,0x00,0x00,0x00,0x02,0x00,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x25,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0a,0x00,0x00,0x62,0x00,
+0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,
+0x64,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+0x03,0x00,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x00,0x00,0x59,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x24,0x00,0x00,0x6d,0x00,0x6d,0x00,0x6d,0x00,
+0x6d,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6f,0x00,0x6f,0x00,0x6f,0x00,
+0x6f,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x76,0x00,0x76,0x00,0x76,0x00,
+0x76,0x00,0x76,0x00,0x77,0x00,0x77,0x00,0x78,0x00,0x78,0x00,0x78,0x00,0x78,0x00,
+0x79,0x00,0x79,0x00,0x79,0x00,0x79,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,0x7a,0x00,
+0x7a,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+0x05,0x00,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x6e,0x00,0x00,0x00,0x17,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,0x00,0x00,0x6e,0x00,
+0x6e,0x00,0x6e,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,
+0x00,0x00,0x06,0x00,0x00,0x70,0x00,0x70,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x71,
+0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,
+0x00,0x00,0x74,0x00,0x74,0x00,0x74,0x00,0x00,0x00,0x33,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x11,0x00,0x00,0x00,0x11,0x00,0x00,0x7e,0x00,0x7e,0x00,0x7e,0x00,0x7f,
+0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x83,
+0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x00,0x00,0x17,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,0x00,0x00,0x7f,0x00,0x7f,0x00,
+0x7f,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+0x05,0x00,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x00,0x00,0x17,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,0x00,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,
+0x00,0x00,0x05,0x00,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x00,
+0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,0x00,0x00,
+0x88,0x00,0x88,0x00,0x88,0x00,0x00,0x00,0x43,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x11,0x00,0x00,0x00,0x19,0x00,0x00,0x8d,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,
+0x00,0x8f,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x92,
+0x00,0x93,0x00,0x93,0x00,0x93,0x00,0x93,0x00,0x94,0x00,0x95,0x00,0x95,0x00,0x95,
+0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x09,0x00,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,
+0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x00,0x00,0x23,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x09,0x00,0x00,0x93,0x00,0x93,
+0x00,0x93,0x00,0x93,0x00,0x93,0x00,0x93,0x00,0x93,0x00,0x93,0x00,0x93,0x00,0x00,
+0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x06,0x00,0x00,
+0x99,0x00,0x99,0x00,0x99,0x00,0x99,0x00,0x9c,0x00,0x9c,0x00,0x00,0x00,0x1b,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x05,0x00,0x00,0x9a,0x00,0x9a,
+0x00,0x9a,0x00,0x9a,0x00,0x9a,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x11,0x00,0x00,0x00,0x03,0x00,0x00,0x9a,0x00,0x9a,0x00,0x9a,0x00,0x00,0x00,
+0x35,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x12,0x00,0x00,0xa0,
+0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa2,0x00,0xa2,0x00,0xa2,0x00,0xa2,0x00,0xa6,
+0x00,0xa7,0x00,0xa7,0x00,0xa7,0x00,0xa7,0x00,0xa8,0x00,0xa8,0x00,0xa8,0x00,0xa8,
+0x00,0xa8,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,
+0x00,0x05,0x00,0x00,0xa3,0x00,0xa3,0x00,0xa4,0x00,0xa4,0x00,0xa4,0x00,0x00,0x00,
+0x73,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x31,0x00,0x00,0xac,
+0x00,0xac,0x00,0xac,0x00,0xae,0x00,0xaf,0x00,0xb0,0x00,0xb0,0x00,0xb0,0x00,0xb0,
+0x00,0xb4,0x00,0xb4,0x00,0xb4,0x00,0xb4,0x00,0xb9,0x00,0xb9,0x00,0xb9,0x00,0xb9,
+0x00,0xb9,0x00,0xba,0x00,0xba,0x00,0xba,0x00,0xba,0x00,0xbb,0x00,0xbb,0x00,0xbb,
+0x00,0xbb,0x00,0xbb,0x00,0xbc,0x00,0xbc,0x00,0xbc,0x00,0xbc,0x00,0xbd,0x00,0xbd,
+0x00,0xbd,0x00,0xbd,0x00,0xbe,0x00,0xbe,0x00,0xbe,0x00,0xbe,0x00,0xbe,0x00,0xbf,
+0x00,0xbf,0x00,0xbf,0x00,0xbf,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x07,
+0x00,0x00,0xb1,0x00,0xb1,0x00,0xb1,0x00,0xb1,0x00,0xb2,0x00,0xb2,0x00,0xb2,0x00,
+0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x08,0x00,
+0x00,0xb5,0x00,0xb5,0x00,0xb6,0x00,0xb6,0x00,0xb6,0x00,0xb7,0x00,0xb7,0x00,0xb7,
+0x00,0x00,0x00,0x3b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x15,
+0x00,0x00,0xc4,0x00,0xc5,0x00,0xc6,0x00,0xc6,0x00,0xc6,0x00,0xc6,0x00,0xca,0x00,
+0xca,0x00,0xca,0x00,0xca,0x00,0xce,0x00,0xce,0x00,0xce,0x00,0xce,0x00,0xce,0x00,
+0xcf,0x00,0xcf,0x00,0xcf,0x00,0xcf,0x00,0xcf,0x00,0xcf,0x00,0x00,0x00,0x1f,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x07,0x00,0x00,0xc7,0x00,0xc7,
+0x00,0xc7,0x00,0xc7,0x00,0xc7,0x00,0xc8,0x00,0xc8,0x00,0x00,0x00,0x1f,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x07,0x00,0x00,0xcb,0x00,0xcb,0x00,
+0xcb,0x00,0xcb,0x00,0xcb,0x00,0xcc,0x00,0xcc,0x00,0x00,0x00,0x3f,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x17,0x00,0x00,0xd9,0x00,0xd9,0x00,0xd9,
+0x00,0xda,0x00,0xda,0x00,0xda,0x00,0xda,0x00,0xdb,0x00,0xdb,0x00,0xdc,0x00,0xdc,
+0x00,0xdc,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xde,0x00,0xde,0x00,0xdf,0x00,0xdf,
+0x00,0xdf,0x00,0xdf,0x00,0xdf,0x00,0xdf,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0c,0x00,0x00,0xd9,0x00,0xd4,0x00,0xd5,0x00,
+0xd5,0x00,0xd6,0x00,0xd6,0x00,0xd6,0x00,0xd7,0x00,0xd7,0x00,0xd7,0x00,0xd7,0x00,
+0xd8,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,
+0x03,0x00,0x00,0xd5,0x00,0xd5,0x00,0xd5,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,0x00,0x00,0xda,0x00,0xda,0x00,0xda,0x00,
+0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x03,0x00,
+0x00,0xdc,0x00,0xdc,0x00,0xdc,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x11,0x00,0x00,0x00,0x04,0x00,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,0xdd,0x00,
+0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x08,0x00,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,
+0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x05,
+0x00,0x00,0x06,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x00,0x00,0x1b,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x05,0x00,0x00,0x05,0x00,0x05,
+0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x12,0x00,0x00,0x00,0x06,0x00,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,
+0x0a,0x00,0x0a,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,
+0x00,0x00,0x06,0x00,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,
+0x00,0x00,0x00,0xf3,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x71,
+0x00,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,
+0x12,0x00,0x12,0x00,0x12,0x00,0x12,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,
+0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,
+0x13,0x00,0x13,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,
+0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,
+0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,
+0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,
+0x15,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,
+0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x17,0x00,
+0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,
+0x17,0x00,0x17,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x19,0x00,0x19,0x00,
+0x19,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,
+0x1d,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
+0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
+0x24,0x00,0x24,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,
+0x00,0x00,0x02,0x00,0x00,0x12,0x00,0x12,0x00,0x00,0x00,0x15,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x02,0x00,0x00,0x13,0x00,0x13,0x00,0x00,0x00,
+0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x02,0x00,0x00,0x14,
+0x00,0x14,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,
+0x00,0x06,0x00,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,
+0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x06,0x00,
+0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x00,0x00,0x17,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x03,0x00,0x00,0x18,0x00,
+0x18,0x00,0x18,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,
+0x00,0x00,0x04,0x00,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x00,0x00,0x15,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x02,0x00,0x00,0x1a,0x00,
+0x1a,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+0x08,0x00,0x00,0x1d,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x22,0x00,0x1f,0x00,0x1f,
+0x00,0x1f,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,
+0x00,0x0b,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
+0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x63,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x29,0x00,0x00,0x28,0x00,0x28,0x00,0x28,
+0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,
+0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,
+0x00,0x29,0x00,0x29,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2b,0x00,0x2b,0x00,0x2b,
+0x00,0x2b,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2e,0x00,0x2e,
+0x00,0x2e,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x00,0x00,0x1d,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x06,0x00,0x00,0x2a,0x00,
+0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x00,0x00,0x17,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x03,0x00,0x00,0x2b,0x00,0x2b,0x00,0x2b,
+0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x06,
+0x00,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x00,0x00,
+0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x06,0x00,0x00,0x2d,
+0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x00,0x00,0x1d,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x06,0x00,0x00,0x2e,0x00,0x2e,0x00,
+0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x12,0x00,0x00,0x00,0x03,0x00,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x00,
+0x00,0x65,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x2a,0x00,0x00,
+0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,
+0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,
+0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,
+0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,
+0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,
+0x34,0x00,0x34,0x00,0x00,0x00,0x49,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,
+0x00,0x00,0x1c,0x00,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x39,0x00,0x39,0x00,0x39,
+0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,
+0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,
+0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x3a,0x00,0x00,0x00,0x17,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x03,0x00,0x00,0x39,0x00,
+0x39,0x00,0x39,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,
+0x00,0x00,0x05,0x00,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x00,
+0x00,0x25,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0a,0x00,0x00,
+0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,0x3e,0x00,
+0x3e,0x00,0x3e,0x00,0x00,0x00,0x3f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,
+0x00,0x00,0x17,0x00,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x43,0x00,0x43,0x00,0x43,
+0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x47,0x00,0x47,0x00,0x47,
+0x00,0x47,0x00,0x47,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,
+0x00,0x48,0x00,0x00,0x00,0x39,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,
+0x00,0x14,0x00,0x00,0x43,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,
+0x44,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,
+0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x00,0x00,0x37,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x13,0x00,0x00,0x4c,0x00,0x4c,
+0x00,0x4c,0x00,0x4c,0x00,0x52,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x53,0x00,0x54,
+0x00,0x54,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,0x00,0x57,
+0x00,0x57,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,
+0x00,0x05,0x00,0x00,0x4c,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,0x00,0x00,
+0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x05,0x00,0x00,0x4d,
+0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0b,0x00,0x00,0x54,0x00,0x55,0x00,0x55,0x00,
+0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,0x55,0x00,
+0x00,0x00,0x57,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x23,0x00,
+0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5b,0x00,0x5c,0x00,0x5c,0x00,0x5c,
+0x00,0x5c,0x00,0x5c,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,0x00,0x5d,
+0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5e,0x00,0x5f,0x00,0x5f,0x00,0x5f,
+0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x5f,0x00,0x60,0x00,0x60,0x00,0x60,
+0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x37,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x12,0x00,0x00,0x00,0x13,0x00,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,
+0x65,0x00,0x65,0x00,0x69,0x00,0x6a,0x00,0x6a,0x00,0x6a,0x00,0x6a,0x00,0x6a,0x00,
+0x6b,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x00,0x00,
+0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x07,0x00,0x00,0x68,
+0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x00,0x00,0x8f,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x3f,0x00,0x00,0x70,0x00,
+0x70,0x00,0x70,0x00,0x72,0x00,0x72,0x00,0x72,0x00,0x79,0x00,0x79,0x00,0x79,0x00,
+0x79,0x00,0x79,0x00,0x79,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,
+0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7b,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,0x7c,0x00,
+0x7c,0x00,0x7c,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,0x7d,0x00,
+0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,
+0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x7f,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
+0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x81,0x00,0x81,0x00,0x81,0x00,
+0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0x00,0x00,0x2f,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0f,0x00,0x00,0x77,0x00,0x77,
+0x00,0x77,0x00,0x72,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x74,0x00,0x74,0x00,0x74,
+0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x76,0x00,0x76,0x00,0x00,0x00,0x15,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x02,0x00,0x00,0x7d,0x00,0x7d,0x00,
+0x00,0x00,0x15,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x02,0x00,
+0x00,0x81,0x00,0x81,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,
+0x00,0x00,0x00,0x0b,0x00,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x86,0x00,0x86,0x00,
+0x86,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x00,0x00,0x1f,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x07,0x00,0x00,0x86,0x00,0x87,
+0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0x00,0x00,0x17,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x03,0x00,0x00,0x89,0x00,0x89,0x00,
+0x89,0x00,0x00,0x00,0x71,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+0x30,0x00,0x00,0x8d,0x00,0x8d,0x00,0x8d,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x93,
+0x00,0x93,0x00,0x93,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x94,0x00,0x95,
+0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x95,0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x96,
+0x00,0x96,0x00,0x96,0x00,0x96,0x00,0x97,0x00,0x97,0x00,0x97,0x00,0x98,0x00,0x98,
+0x00,0x98,0x00,0x98,0x00,0x98,0x00,0x99,0x00,0x99,0x00,0x99,0x00,0x99,0x00,0x99,
+0x00,0x99,0x00,0x9a,0x00,0x9a,0x00,0x9a,0x00,0x9a,0x00,0x9a,0x00,0x9a,0x00,0x9a,
+0x00,0x9a,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,
+0x00,0x0b,0x00,0x00,0x92,0x00,0x8f,0x00,0x8f,0x00,0x90,0x00,0x90,0x00,0x90,0x00,
+0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x91,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x1d,0x00,0x00,0x9e,0x00,0x9e,0x00,0x9f,
+0x00,0x9f,0x00,0x9f,0x00,0xa0,0x00,0xa0,0x00,0xa0,0x00,0xa0,0x00,0xa0,0x00,0xa1,
+0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa1,0x00,0xa2,0x00,0xa2,0x00,0xa2,0x00,0xa2,
+0x00,0xa2,0x00,0xa3,0x00,0xa3,0x00,0xa3,0x00,0xa3,0x00,0xa4,0x00,0xa4,0x00,0xa4,
+0x00,0xa4,0x00,0xa4,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,
+0x00,0x00,0x00,0x03,0x00,0x00,0xa3,0x00,0xa3,0x00,0xa3,0x00,0x00,0x00,0x17,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x03,0x00,0x00,0xa4,0x00,0xa4,
+0x00,0xa4,0x00,0x00,0x00,0x3b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,
+0x00,0x15,0x00,0x00,0xa8,0x00,0xa8,0x00,0xa8,0x00,0xa9,0x00,0xa9,0x00,0xa9,0x00,
+0xac,0x00,0xac,0x00,0xac,0x00,0xad,0x00,0xad,0x00,0xae,0x00,0xae,0x00,0xaf,0x00,
+0xaf,0x00,0xaf,0x00,0xaf,0x00,0xaf,0x00,0xaf,0x00,0xaf,0x00,0xaf,0x00,0x00,0x00,
+0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x06,0x00,0x00,0xab,
+0x00,0xaa,0x00,0xaa,0x00,0xaa,0x00,0xaa,0x00,0xaa,0x00,0x00,0x01,0x4f,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x9f,0x00,0x00,0xb3,0x00,0xb3,0x00,
+0xb3,0x00,0xb4,0x00,0xb4,0x00,0xb4,0x00,0xb9,0x00,0xb9,0x00,0xb9,0x00,0xba,0x00,
+0xba,0x00,0xba,0x00,0xba,0x00,0xba,0x00,0xbb,0x00,0xbb,0x00,0xbb,0x00,0xbb,0x00,
+0xbb,0x00,0xbc,0x00,0xbc,0x00,0xbc,0x00,0xbc,0x00,0xbc,0x00,0xbd,0x00,0xbd,0x00,
+0xbd,0x00,0xbd,0x00,0xbd,0x00,0xbe,0x00,0xbe,0x00,0xbe,0x00,0xbe,0x00,0xbe,0x00,
+0xbe,0x00,0xbe,0x00,0xbf,0x00,0xbf,0x00,0xbf,0x00,0xbf,0x00,0xbf,0x00,0xbf,0x00,
+0xbf,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc1,0x00,0xc1,0x00,0xc1,0x00,0xc1,0x00,
+0xc1,0x00,0xc2,0x00,0xc2,0x00,0xc2,0x00,0xc2,0x00,0xc2,0x00,0xc3,0x00,0xc3,0x00,
+0xc3,0x00,0xc3,0x00,0xc3,0x00,0xc3,0x00,0xc4,0x00,0xc4,0x00,0xc4,0x00,0xc4,0x00,
+0xc4,0x00,0xc4,0x00,0xc5,0x00,0xc5,0x00,0xc5,0x00,0xc5,0x00,0xc5,0x00,0xc5,0x00,
+0xc5,0x00,0xc6,0x00,0xc6,0x00,0xc6,0x00,0xc6,0x00,0xc6,0x00,0xc6,0x00,0xc6,0x00,
+0xc7,0x00,0xc7,0x00,0xc7,0x00,0xc8,0x00,0xc8,0x00,0xc8,0x00,0xc8,0x00,0xc8,0x00,
+0xc9,0x00,0xc9,0x00,0xc9,0x00,0xc9,0x00,0xc9,0x00,0xca,0x00,0xca,0x00,0xca,0x00,
+0xca,0x00,0xca,0x00,0xca,0x00,0xcb,0x00,0xcb,0x00,0xcb,0x00,0xcb,0x00,0xcb,0x00,
+0xcc,0x00,0xcc,0x00,0xcc,0x00,0xcc,0x00,0xcc,0x00,0xcc,0x00,0xcc,0x00,0xcd,0x00,
+0xcd,0x00,0xcd,0x00,0xcd,0x00,0xcd,0x00,0xcd,0x00,0xcd,0x00,0xce,0x00,0xce,0x00,
+0xce,0x00,0xcf,0x00,0xcf,0x00,0xcf,0x00,0xcf,0x00,0xcf,0x00,0xd0,0x00,0xd0,0x00,
+0xd0,0x00,0xd0,0x00,0xd0,0x00,0xd1,0x00,0xd1,0x00,0xd1,0x00,0xd1,0x00,0xd1,0x00,
+0xd2,0x00,0xd2,0x00,0xd2,0x00,0xd2,0x00,0xd2,0x00,0xd2,0x00,0xd3,0x00,0xd3,0x00,
+0xd3,0x00,0xd3,0x00,0xd3,0x00,0xd3,0x00,0xd3,0x00,0xd4,0x00,0xd4,0x00,0xd4,0x00,
+0xd4,0x00,0xd4,0x00,0xd4,0x00,0xd4,0x00,0xd4,0x00,0x00,0x00,0x27,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0b,0x00,0x00,0xb8,0x00,0xb5,0x00,0xb5,
+0x00,0xb6,0x00,0xb6,0x00,0xb6,0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,0xb7,0x00,0xb7,
+0x00,0x00,0x00,0x3b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x15,
+0x00,0x00,0xd8,0x00,0xd8,0x00,0xd8,0x00,0xd9,0x00,0xd9,0x00,0xd9,0x00,0xdc,0x00,
+0xdc,0x00,0xdc,0x00,0xdd,0x00,0xdd,0x00,0xde,0x00,0xde,0x00,0xdf,0x00,0xdf,0x00,
+0xdf,0x00,0xdf,0x00,0xdf,0x00,0xdf,0x00,0xdf,0x00,0xdf,0x00,0x00,0x00,0x1d,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x06,0x00,0x00,0xdb,0x00,0xda,
+0x00,0xda,0x00,0xda,0x00,0xda,0x00,0xda,0x00,0x00,0x00,0x5d,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x26,0x00,0x00,0xe3,0x00,0xe3,0x00,0xe3,0x00,
+0xe4,0x00,0xe4,0x00,0xe4,0x00,0xe9,0x00,0xea,0x00,0xea,0x00,0xea,0x00,0xea,0x00,
+0xea,0x00,0xeb,0x00,0xec,0x00,0xec,0x00,0xec,0x00,0xed,0x00,0xed,0x00,0xee,0x00,
+0xee,0x00,0xee,0x00,0xef,0x00,0xef,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf1,0x00,
+0xf1,0x00,0xf1,0x00,0xf1,0x00,0xf2,0x00,0xf2,0x00,0xf2,0x00,0xf2,0x00,0xf2,0x00,
+0xf2,0x00,0xf2,0x00,0xf2,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x12,0x00,0x00,0x00,0x0e,0x00,0x00,0xe8,0x00,0xe5,0x00,0xe5,0x00,0xe5,0x00,0xe5,
+0x00,0xe6,0x00,0xe6,0x00,0xe6,0x00,0xe6,0x00,0xe7,0x00,0xe7,0x00,0xe7,0x00,0xe7,
+0x00,0xe7,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,
+0x00,0x03,0x00,0x00,0xf1,0x00,0xf1,0x00,0xf1,0x00,0x00,0x00,0x57,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x23,0x00,0x00,0xf6,0x00,0xf6,0x00,0xf6,
+0x00,0xf7,0x00,0xf7,0x00,0xf7,0x00,0xfc,0x00,0xfd,0x00,0xfd,0x00,0xfd,0x00,0xfd,
+0x00,0xfd,0x00,0xfe,0x00,0xff,0x00,0xff,0x00,0xff,0x01,0x00,0x01,0x00,0x01,0x01,
+0x01,0x01,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x03,0x01,0x03,0x01,0x03,0x01,0x03,
+0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x04,
+0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0e,
+0x00,0x00,0xfb,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x00,0xf9,0x00,
+0xf9,0x00,0xf9,0x00,0xfa,0x00,0xfa,0x00,0xfa,0x00,0xfa,0x00,0xfa,0x00,0x00,0x00,
+0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x03,0x00,0x01,0x03,
+0x01,0x03,0x01,0x03,0x00,0x00,0x00,0x37,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,
+0x00,0x00,0x00,0x13,0x00,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x09,0x01,0x09,0x01,
+0x09,0x01,0x0e,0x01,0x0f,0x01,0x0f,0x01,0x0f,0x01,0x0f,0x01,0x0f,0x01,0x10,0x01,
+0x10,0x01,0x11,0x01,0x11,0x01,0x11,0x01,0x11,0x01,0x11,0x00,0x00,0x00,0x2d,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0e,0x00,0x01,0x0d,0x01,0x0a,
+0x01,0x0a,0x01,0x0a,0x01,0x0a,0x01,0x0b,0x01,0x0b,0x01,0x0b,0x01,0x0b,0x01,0x0c,
+0x01,0x0c,0x01,0x0c,0x01,0x0c,0x01,0x0c,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x00,0x01,0x11,0x01,0x11,0x01,0x11,0x01,
+0x11,0x00,0x00,0x00,0x41,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+0x18,0x00,0x01,0x15,0x01,0x15,0x01,0x15,0x01,0x16,0x01,0x16,0x01,0x16,0x01,0x1b,
+0x01,0x1c,0x01,0x1c,0x01,0x1c,0x01,0x1c,0x01,0x1c,0x01,0x1d,0x01,0x1d,0x01,0x1e,
+0x01,0x1e,0x01,0x1f,0x01,0x1f,0x01,0x20,0x01,0x20,0x01,0x20,0x01,0x20,0x01,0x20,
+0x01,0x20,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,
+0x00,0x0e,0x00,0x01,0x1a,0x01,0x17,0x01,0x17,0x01,0x17,0x01,0x17,0x01,0x18,0x01,
+0x18,0x01,0x18,0x01,0x18,0x01,0x19,0x01,0x19,0x01,0x19,0x01,0x19,0x01,0x19,0x00,
+0x00,0x00,0x35,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x12,0x00,
+0x01,0x24,0x01,0x25,0x01,0x25,0x01,0x25,0x01,0x25,0x01,0x26,0x01,0x27,0x01,0x27,
+0x01,0x27,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x29,0x01,0x29,0x01,0x29,
+0x01,0x29,0x01,0x29,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,
+0x00,0x00,0x00,0x06,0x00,0x01,0x25,0x01,0x25,0x01,0x25,0x01,0x25,0x01,0x25,0x01,
+0x25,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+0x03,0x00,0x01,0x28,0x01,0x28,0x01,0x28,0x00,0x00,0x00,0x5f,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x27,0x00,0x01,0x2d,0x01,0x2d,0x01,0x2d,0x01,
+0x2d,0x01,0x2d,0x01,0x2d,0x01,0x2d,0x01,0x2e,0x01,0x2e,0x01,0x2e,0x01,0x2e,0x01,
+0x2e,0x01,0x2f,0x01,0x2f,0x01,0x2f,0x01,0x2f,0x01,0x2f,0x01,0x30,0x01,0x30,0x01,
+0x31,0x01,0x31,0x01,0x31,0x01,0x31,0x01,0x31,0x01,0x32,0x01,0x32,0x01,0x32,0x01,
+0x32,0x01,0x32,0x01,0x33,0x01,0x33,0x01,0x33,0x01,0x33,0x01,0x33,0x01,0x34,0x01,
+0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x12,0x00,0x00,0x00,0x03,0x00,0x01,0x34,0x01,0x34,0x01,0x34,0x00,0x00,
+0x00,0x55,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x22,0x00,0x01,
+0x38,0x01,0x38,0x01,0x38,0x01,0x39,0x01,0x39,0x01,0x39,0x01,0x3e,0x01,0x3f,0x01,
+0x3f,0x01,0x3f,0x01,0x3f,0x01,0x3f,0x01,0x40,0x01,0x41,0x01,0x41,0x01,0x41,0x01,
+0x42,0x01,0x42,0x01,0x43,0x01,0x43,0x01,0x43,0x01,0x44,0x01,0x44,0x01,0x45,0x01,
+0x45,0x01,0x46,0x01,0x46,0x01,0x47,0x01,0x47,0x01,0x47,0x01,0x47,0x01,0x47,0x01,
+0x47,0x01,0x47,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,
+0x00,0x00,0x0e,0x00,0x01,0x3d,0x01,0x3a,0x01,0x3a,0x01,0x3a,0x01,0x3a,0x01,0x3b,
+0x01,0x3b,0x01,0x3b,0x01,0x3b,0x01,0x3c,0x01,0x3c,0x01,0x3c,0x01,0x3c,0x01,0x3c,
+0x00,0x00,0x00,0x55,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x22,
+0x00,0x01,0x4b,0x01,0x4b,0x01,0x4b,0x01,0x4c,0x01,0x4c,0x01,0x4c,0x01,0x51,0x01,
+0x52,0x01,0x52,0x01,0x52,0x01,0x52,0x01,0x52,0x01,0x53,0x01,0x54,0x01,0x54,0x01,
+0x54,0x01,0x55,0x01,0x55,0x01,0x56,0x01,0x56,0x01,0x56,0x01,0x57,0x01,0x57,0x01,
+0x58,0x01,0x58,0x01,0x59,0x01,0x59,0x01,0x5a,0x01,0x5a,0x01,0x5a,0x01,0x5a,0x01,
+0x5a,0x01,0x5a,0x01,0x5a,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x12,0x00,0x00,0x00,0x0e,0x00,0x01,0x50,0x01,0x4d,0x01,0x4d,0x01,0x4d,0x01,0x4d,
+0x01,0x4e,0x01,0x4e,0x01,0x4e,0x01,0x4e,0x01,0x4f,0x01,0x4f,0x01,0x4f,0x01,0x4f,
+0x01,0x4f,0x00,0x00,0x00,0x59,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,
+0x00,0x24,0x00,0x01,0x5f,0x01,0x5f,0x01,0x5f,0x01,0x5f,0x01,0x5f,0x01,0x60,0x01,
+0x60,0x01,0x61,0x01,0x62,0x01,0x62,0x01,0x62,0x01,0x62,0x01,0x62,0x01,0x62,0x01,
+0x63,0x01,0x63,0x01,0x63,0x01,0x63,0x01,0x63,0x01,0x63,0x01,0x63,0x01,0x64,0x01,
+0x65,0x01,0x65,0x01,0x65,0x01,0x65,0x01,0x65,0x01,0x65,0x01,0x66,0x01,0x66,0x01,
+0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x00,0x00,0x00,0x25,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0a,0x00,0x01,0x5f,0x01,0x5f,
+0x01,0x5f,0x01,0x5f,0x01,0x5f,0x01,0x5f,0x01,0x5f,0x01,0x5f,0x01,0x5f,0x01,0x5f,
+0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x05,
+0x00,0x01,0x62,0x01,0x62,0x01,0x62,0x01,0x62,0x01,0x62,0x00,0x00,0x00,0x1b,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x05,0x00,0x01,0x65,0x01,0x65,
+0x01,0x65,0x01,0x65,0x01,0x65,0x00,0x00,0x00,0x3b,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x12,0x00,0x00,0x00,0x15,0x00,0x01,0x6a,0x01,0x6a,0x01,0x6a,0x01,0x6a,0x01,
+0x6a,0x01,0x6b,0x01,0x6c,0x01,0x6c,0x01,0x6c,0x01,0x6c,0x01,0x6c,0x01,0x6c,0x01,
+0x6c,0x01,0x6d,0x01,0x6d,0x01,0x6d,0x01,0x6d,0x01,0x6d,0x01,0x6d,0x01,0x6d,0x01,
+0x6d,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+0x09,0x00,0x01,0x6a,0x01,0x6a,0x01,0x6a,0x01,0x6a,0x01,0x6a,0x01,0x6a,0x01,0x6a,
+0x01,0x6a,0x01,0x6a,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,
+0x00,0x00,0x00,0x05,0x00,0x01,0x6c,0x01,0x6c,0x01,0x6c,0x01,0x6c,0x01,0x6c,0x00,
+0x00,0x00,0x85,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x3a,0x00,
+0x01,0x72,0x01,0x73,0x01,0x73,0x01,0x73,0x01,0x73,0x01,0x73,0x01,0x74,0x01,0x74,
+0x01,0x74,0x01,0x74,0x01,0x74,0x01,0x74,0x01,0x74,0x01,0x74,0x01,0x74,0x01,0x74,
+0x01,0x75,0x01,0x75,0x01,0x75,0x01,0x75,0x01,0x75,0x01,0x75,0x01,0x75,0x01,0x77,
+0x01,0x78,0x01,0x78,0x01,0x78,0x01,0x78,0x01,0x78,0x01,0x79,0x01,0x79,0x01,0x79,
+0x01,0x79,0x01,0x79,0x01,0x79,0x01,0x79,0x01,0x7a,0x01,0x7a,0x01,0x7a,0x01,0x7a,
+0x01,0x7a,0x01,0x7a,0x01,0x7a,0x01,0x7a,0x01,0x7b,0x01,0x7b,0x01,0x7b,0x01,0x7b,
+0x01,0x7b,0x01,0x7b,0x01,0x7b,0x01,0x7b,0x01,0x7b,0x01,0x7d,0x01,0x7d,0x01,0x7d,
+0x01,0x7d,0x01,0x7d,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,
+0x00,0x00,0x00,0x05,0x00,0x01,0x73,0x01,0x73,0x01,0x73,0x01,0x73,0x01,0x73,0x00,
+0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x05,0x00,
+0x01,0x78,0x01,0x78,0x01,0x78,0x01,0x78,0x01,0x78,0x00,0x00,0x00,0x19,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x04,0x00,0x01,0x7d,0x01,0x7d,0x01,
+0x7d,0x01,0x7d,0x00,0x00,0x00,0x55,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,
+0x00,0x00,0x22,0x00,0x01,0x81,0x01,0x81,0x01,0x82,0x01,0x82,0x01,0x82,0x01,0x83,
+0x01,0x83,0x01,0x83,0x01,0x83,0x01,0x83,0x01,0x84,0x01,0x84,0x01,0x84,0x01,0x84,
+0x01,0x85,0x01,0x85,0x01,0x85,0x01,0x85,0x01,0x86,0x01,0x86,0x01,0x87,0x01,0x87,
+0x01,0x87,0x01,0x87,0x01,0x87,0x01,0x88,0x01,0x88,0x01,0x88,0x01,0x88,0x01,0x89,
+0x01,0x89,0x01,0x89,0x01,0x89,0x01,0x89,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x03,0x00,0x01,0x84,0x01,0x84,0x01,0x84,0x00,
+0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x03,0x00,
+0x01,0x85,0x01,0x85,0x01,0x85,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x12,0x00,0x00,0x00,0x03,0x00,0x01,0x88,0x01,0x88,0x01,0x88,0x00,0x00,0x00,
+0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x03,0x00,0x01,0x89,
+0x01,0x89,0x01,0x89,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,
+0x00,0x00,0x00,0x04,0x00,0x01,0x93,0x01,0x8d,0x01,0x8d,0x01,0x8d,0x00,0x00,0x00,
+0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x06,0x00,0x01,0x8e,
+0x01,0x8e,0x01,0x8e,0x01,0x92,0x01,0x92,0x01,0x92,0x00,0x00,0x00,0x23,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x09,0x00,0x01,0x8f,0x01,0x8f,0x01,
+0x8f,0x01,0x8f,0x01,0x8f,0x01,0x8f,0x01,0x90,0x01,0x90,0x01,0x90,0x00,0x00,0x00,
+0x41,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x00,0x01,0x97,
+0x01,0x97,0x01,0x97,0x01,0x97,0x01,0x97,0x01,0x97,0x01,0x9b,0x01,0x9b,0x01,0x9b,
+0x01,0x9c,0x01,0x9c,0x01,0x9c,0x01,0x9c,0x01,0x9c,0x01,0x9d,0x01,0x9d,0x01,0x9d,
+0x01,0x9d,0x01,0x9d,0x01,0x9e,0x01,0x9e,0x01,0x9e,0x01,0x9e,0x01,0x9e,0x00,0x00,
+0x00,0x29,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0c,0x00,0x01,
+0x9a,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x99,0x01,0x99,0x01,0x99,0x01,0x99,0x01,
+0x99,0x01,0x99,0x01,0x99,0x01,0x99,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x12,0x00,0x00,0x00,0x03,0x00,0x01,0x9e,0x01,0x9e,0x01,0x9e,0x00,0x00,
+0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0b,0x00,0x01,
+0xa2,0x01,0xa2,0x01,0xa2,0x01,0xa2,0x01,0xa2,0x01,0xa2,0x01,0xa3,0x01,0xa3,0x01,
+0xa3,0x01,0xa3,0x01,0xa3,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x12,0x00,0x00,0x00,0x03,0x00,0x01,0xa3,0x01,0xa3,0x01,0xa3,0x00,0x00,0x00,0x35,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x12,0x00,0x01,0xa7,0x01,
+0xa7,0x01,0xa7,0x01,0xa7,0x01,0xa7,0x01,0xa7,0x01,0xa8,0x01,0xa8,0x01,0xa8,0x01,
+0xa9,0x01,0xad,0x01,0xaa,0x01,0xaa,0x01,0xaa,0x01,0xae,0x01,0xae,0x01,0xae,0x01,
+0xae,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,
+0x09,0x00,0x01,0xab,0x01,0xab,0x01,0xab,0x01,0xab,0x01,0xab,0x01,0xac,0x01,0xac,
+0x01,0xac,0x01,0xac,0x00,0x00,0x00,0x45,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,
+0x00,0x00,0x00,0x1a,0x00,0x01,0xb2,0x01,0xb3,0x01,0xb3,0x01,0xb3,0x01,0xb4,0x01,
+0xb5,0x01,0xb5,0x01,0xb5,0x01,0xb5,0x01,0xb8,0x01,0xb8,0x01,0xb8,0x01,0xb8,0x01,
+0xb9,0x01,0xb9,0x01,0xb9,0x01,0xb9,0x01,0xb9,0x01,0xba,0x01,0xba,0x01,0xba,0x01,
+0xba,0x01,0xba,0x01,0xba,0x01,0xba,0x01,0xba,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x05,0x00,0x01,0xb5,0x01,0xb6,0x01,0xb6,
+0x01,0xb6,0x01,0xb6,0x00,0x00,0x00,0x37,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,
+0x00,0x00,0x00,0x13,0x00,0x01,0xbe,0x01,0xbe,0x01,0xbe,0x01,0xbe,0x01,0xbe,0x01,
+0xbe,0x01,0xbe,0x01,0xbe,0x01,0xbe,0x01,0xbe,0x01,0xbe,0x01,0xbe,0x01,0xbe,0x01,
+0xbe,0x01,0xbe,0x01,0xbe,0x01,0xbe,0x01,0xbe,0x01,0xbe,0x00,0x00,0x00,0x4f,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x1f,0x00,0x01,0xc2,0x01,0xc2,
+0x01,0xc2,0x01,0xc2,0x01,0xc3,0x01,0xc3,0x01,0xc3,0x01,0xc4,0x01,0xc4,0x01,0xc4,
+0x01,0xc7,0x01,0xc7,0x01,0xc7,0x01,0xc7,0x01,0xc7,0x01,0xc7,0x01,0xc7,0x01,0xc8,
+0x01,0xc8,0x01,0xc8,0x01,0xc8,0x01,0xc8,0x01,0xc8,0x01,0xc8,0x01,0xc8,0x01,0xc8,
+0x01,0xc8,0x01,0xc8,0x01,0xc8,0x01,0xc8,0x01,0xc8,0x00,0x00,0x00,0x23,0x00,0x01,
+0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x09,0x00,0x01,0xc4,0x01,0xc5,0x01,
+0xc5,0x01,0xc5,0x01,0xc5,0x01,0xc5,0x01,0xc5,0x01,0xc5,0x01,0xc5,0x00,0x00,0x00,
+0x39,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x14,0x00,0x01,0xcc,
+0x01,0xcc,0x01,0xcc,0x01,0xcc,0x01,0xcc,0x01,0xcc,0x01,0xcc,0x01,0xcc,0x01,0xcc,
+0x01,0xcc,0x01,0xcc,0x01,0xcc,0x01,0xcc,0x01,0xcc,0x01,0xcc,0x01,0xcc,0x01,0xcc,
+0x01,0xcc,0x01,0xcc,0x01,0xcc,0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x12,0x00,0x00,0x00,0x07,0x00,0x01,0xcc,0x01,0xcc,0x01,0xcc,0x01,0xcc,0x01,
+0xcc,0x01,0xcc,0x01,0xcc,0x00,0x00,0x00,0x51,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x12,0x00,0x00,0x00,0x20,0x00,0x01,0xd0,0x01,0xd0,0x01,0xd0,0x01,0xd0,0x01,0xd1,
+0x01,0xd1,0x01,0xd1,0x01,0xd2,0x01,0xd3,0x01,0xd3,0x01,0xd3,0x01,0xd6,0x01,0xd6,
+0x01,0xd6,0x01,0xd6,0x01,0xd6,0x01,0xd6,0x01,0xd6,0x01,0xd7,0x01,0xd7,0x01,0xd7,
+0x01,0xd7,0x01,0xd7,0x01,0xd7,0x01,0xd7,0x01,0xd7,0x01,0xd7,0x01,0xd7,0x01,0xd7,
+0x01,0xd7,0x01,0xd7,0x01,0xd7,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x12,0x00,0x00,0x00,0x09,0x00,0x01,0xd3,0x01,0xd4,0x01,0xd4,0x01,0xd4,0x01,
+0xd4,0x01,0xd4,0x01,0xd4,0x01,0xd4,0x01,0xd4,0x00,0x00,0x00,0x3f,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x17,0x00,0x01,0xdb,0x01,0xdb,0x01,0xdb,
+0x01,0xdb,0x01,0xdc,0x01,0xdc,0x01,0xdc,0x01,0xdd,0x01,0xdd,0x01,0xe0,0x01,0xe0,
+0x01,0xe0,0x01,0xe0,0x01,0xe0,0x01,0xe0,0x01,0xe0,0x01,0xe0,0x01,0xe0,0x01,0xe0,
+0x01,0xe0,0x01,0xe0,0x01,0xe0,0x01,0xe0,0x00,0x00,0x00,0x23,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x09,0x00,0x01,0xdd,0x01,0xde,0x01,0xde,0x01,
+0xde,0x01,0xde,0x01,0xde,0x01,0xde,0x01,0xde,0x01,0xde,0x00,0x00,0x00,0x41,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x18,0x00,0x01,0xe4,0x01,0xe4,
+0x01,0xe4,0x01,0xe4,0x01,0xe4,0x01,0xe5,0x01,0xe5,0x01,0xe5,0x01,0xe6,0x01,0xe7,
+0x01,0xe7,0x01,0xe7,0x01,0xea,0x01,0xea,0x01,0xea,0x01,0xea,0x01,0xea,0x01,0xea,
+0x01,0xea,0x01,0xea,0x01,0xea,0x01,0xea,0x01,0xea,0x01,0xea,0x00,0x00,0x00,0x1f,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x07,0x00,0x01,0xe7,0x01,
+0xe8,0x01,0xe8,0x01,0xe8,0x01,0xe8,0x01,0xe8,0x01,0xe8,0x00,0x00,0x00,0x2d,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0e,0x00,0x01,0xee,0x01,0xee,
+0x01,0xee,0x01,0xee,0x01,0xee,0x01,0xee,0x01,0xee,0x01,0xee,0x01,0xee,0x01,0xee,
+0x01,0xee,0x01,0xee,0x01,0xee,0x01,0xee,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x0e,0x00,0x01,0xf2,0x01,0xf2,0x01,0xf2,0x01,
+0xf2,0x01,0xf2,0x01,0xf2,0x01,0xf2,0x01,0xf2,0x01,0xf2,0x01,0xf2,0x01,0xf2,0x01,
+0xf2,0x01,0xf2,0x01,0xf2,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x12,0x00,0x00,0x00,0x1d,0x00,0x01,0xf6,0x01,0xf6,0x01,0xf6,0x01,0xf6,0x01,0xf6,
+0x01,0xf6,0x01,0xf6,0x01,0xf7,0x01,0xf7,0x01,0xf7,0x01,0xf7,0x01,0xf7,0x01,0xf8,
+0x01,0xf8,0x01,0xf8,0x01,0xf8,0x01,0xf8,0x01,0xf8,0x01,0xf9,0x01,0xf9,0x01,0xf9,
+0x01,0xf9,0x01,0xf9,0x01,0xf9,0x01,0xf9,0x01,0xf9,0x01,0xf9,0x01,0xf9,0x01,0xf9,
+0x00,0x00,0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x07,
+0x00,0x01,0xf7,0x01,0xf7,0x01,0xf7,0x01,0xf7,0x01,0xf7,0x01,0xf7,0x01,0xf7,0x00,
+0x00,0x00,0x3f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x17,0x00,
+0x01,0xfd,0x01,0xfd,0x01,0xfd,0x01,0xfd,0x01,0xfd,0x01,0xfd,0x01,0xfd,0x01,0xfe,
+0x01,0xfe,0x01,0xfe,0x01,0xfe,0x01,0xfe,0x01,0xff,0x01,0xff,0x01,0xff,0x01,0xff,
+0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,0x00,
+0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x07,0x00,0x01,
+0xfe,0x01,0xfe,0x01,0xfe,0x01,0xfe,0x01,0xfe,0x01,0xfe,0x01,0xfe,0x00,0x00,0x00,
+0x4f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x1f,0x00,0x02,0x04,
+0x02,0x04,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0x04,0x02,0x05,0x02,0x05,
+0x02,0x05,0x02,0x05,0x02,0x05,0x02,0x06,0x02,0x06,0x02,0x06,0x02,0x06,0x02,0x06,
+0x02,0x06,0x02,0x06,0x02,0x06,0x02,0x07,0x02,0x07,0x02,0x07,0x02,0x07,0x02,0x07,
+0x02,0x07,0x02,0x07,0x02,0x07,0x02,0x07,0x02,0x07,0x02,0x07,0x00,0x00,0x00,0x1f,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x07,0x00,0x02,0x05,0x02,
+0x05,0x02,0x05,0x02,0x05,0x02,0x05,0x02,0x05,0x02,0x05,0x00,0x00,0x00,0x43,0x00,
+0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x19,0x00,0x02,0x0b,0x02,0x0b,
+0x02,0x0b,0x02,0x0b,0x02,0x0b,0x02,0x0b,0x02,0x0b,0x02,0x0c,0x02,0x0c,0x02,0x0c,
+0x02,0x0c,0x02,0x0c,0x02,0x0d,0x02,0x0d,0x02,0x0d,0x02,0x0d,0x02,0x0e,0x02,0x0e,
+0x02,0x0e,0x02,0x0e,0x02,0x0e,0x02,0x0e,0x02,0x0e,0x02,0x0e,0x02,0x0e,0x00,0x00,
+0x00,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x07,0x00,0x02,
+0x0c,0x02,0x0c,0x02,0x0c,0x02,0x0c,0x02,0x0c,0x02,0x0c,0x02,0x0c,0x00,0x00,0x00,
+0x39,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x14,0x00,0x02,0x12,
+0x02,0x12,0x02,0x12,0x02,0x13,0x02,0x13,0x02,0x13,0x02,0x14,0x02,0x15,0x02,0x15,
+0x02,0x15,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,
+0x02,0x18,0x02,0x18,0x02,0x18,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x12,0x00,0x00,0x00,0x05,0x00,0x02,0x15,0x02,0x16,0x02,0x16,0x02,0x16,0x02,
+0x16,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
+0x0b,0x00,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0xd9,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x64,0x00,0x00,0x07,0x00,0x07,0x00,0x07,0x00,
+0x08,0x00,0x08,0x00,0x08,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x1a,0x00,
+0x1a,0x00,0x1a,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,
+0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,
+0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x1f,0x00,
+0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
+0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
+0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
+0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
+0x24,0x00,0x24,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x27,0x00,
+0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,
+0x27,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,
+0x28,0x00,0x00,0x00,0x6b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,
+0x2d,0x00,0x00,0x14,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,
+0x00,0x09,0x00,0x09,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0b,0x00,0x0b,
+0x00,0x0b,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0d,0x00,0x0d,0x00,0x0d,
+0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x10,
+0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x12,0x00,0x12,
+0x00,0x12,0x00,0x12,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x00,0x00,0x21,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x08,0x00,0x00,0x18,0x00,
+0x18,0x00,0x18,0x00,0x15,0x00,0x16,0x00,0x16,0x00,0x17,0x00,0x17,0x00,0x00,0x00,
+0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x07,0x00,0x00,0x1f,
+0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x00,0x00,0x1b,
+0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x05,0x00,0x00,0x23,0x00,
+0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x13,0x00,0x00,0x00,0x05,0x00,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,
+0x00,0x27,0x00,0x00,0x00,0x4d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x13,0x00,0x00,
+0x00,0x1e,0x00,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,
+0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,
+0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,
+0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,0x2e,0x00,
+0x00,0x00,0x55,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x22,0x00,
+0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x11,0x00,0x11,
+0x00,0x11,0x00,0x11,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,
+0x00,0x13,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,0x00,0x14,
+0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x15,0x00,0x16,0x00,0x16,0x00,0x16,
+0x00,0x16,0x00,0x16,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x14,
+0x00,0x00,0x00,0x06,0x00,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x0a,0x00,0x0a,0x00,
+0x0a,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,
+0x03,0x00,0x00,0x08,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,
+0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x03,0x00,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,
+0x00,0x00,0x23,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,
+0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x03,0x00,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x17,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x03,0x00,0x03,
+0x00,0x00,0x00,0x53,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,
+0x00,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,
+0x07,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,
+0x08,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x10,0x00,0x10,0x00,0x10,0x00,
+0x10,0x00,0x10,0x00,0x10,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x11,0x00,
+0x11,0x00,0x11,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x05,0x00,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x00,
+0x00,0x19,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,
+0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x1b,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,
+0x00,0x08,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x03,0x00,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x0a,0x00,0x0a,0x00,0x0a,
+0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x00,0x00,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x0a,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,
+0x0b,0x00,0x0b,0x00,0x00,0x00,0x17,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x45,0x4e,0x44,0x00,0x00,0x00,
+0x00,0x08,
+};
+
+void no_mrb_open_mrbgem_test(mrb_state *mrb) {
+  mrb_load_irep(mrb, no_mrb_open_gem_test_irep);
+}
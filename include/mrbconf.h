@@ -26,12 +26,19 @@
 /* represent mrb_value as a word (natural unit of data for the processor) */
 // #define MRB_WORD_BOXING
 
+/* with MRB_WORD_BOXING on 64bit, box every Float in the heap instead of using flonum */
+//#define MRB_WITHOUT_FLONUM
+
 /* argv max size in mrb_funcall */
 //#define MRB_FUNCALL_ARGC_MAX 16
 
-/* number of object per heap page */
+/* number of object per heap page; with MRB_GC_SIDE_BITMAP the default
+   is as many as fill MRB_HEAP_PAGE_ALIGN */
 //#define MRB_HEAP_PAGE_SIZE 1024
 
+/* number of entries in initialize method cache for Class#new; must be power of 2 */
+//#define MRB_INIT_CACHE_SIZE 32
+
 /* use segmented list for IV table */
 //#define MRB_USE_IV_SEGLIST
 
@@ -56,9 +63,51 @@
 /* arena size */
 //#define MRB_GC_ARENA_SIZE 100
 
+/* number of heap slot widths; slots of class n are 2**n RVALUEs wide
+   and let arrays embed their elements (1 keeps all slots one RVALUE) */
+//#define MRB_GC_SLOT_CLASSES 4
+
 /* fixed size GC arena */
 //#define MRB_GC_FIXED_ARENA
 
+/* keep GC colors in per-page side tables instead of object headers, so
+   marking does not dirty copy-on-write pages shared with forked children */
+//#define MRB_GC_SIDE_BITMAP
+
+/* alignment of heap pages with MRB_GC_SIDE_BITMAP; must hold a whole page.
+   Every page takes MRB_HEAP_PAGE_ALIGN bytes, so a smaller
+   MRB_HEAP_PAGE_SIZE leaves the rest unused */
+//#define MRB_HEAP_PAGE_ALIGN (1 << 16)
+
+/* pages allocated at once with MRB_GC_SIDE_BITMAP; each such chunk
+   carries up to MRB_HEAP_PAGE_ALIGN bytes of padding to align its pages,
+   and is returned only once all of its pages are free */
+//#define MRB_HEAP_CHUNK_PAGES 16
+
+/* mark full GCs with a pool of POSIX threads; link with -lpthread */
+//#define MRB_GC_PARALLEL_MARK
+
+/* default number of threads marking a full GC with MRB_GC_PARALLEL_MARK */
+//#define MRB_GC_MARK_THREADS 4
+
+/* free payloads of swept objects on a POSIX thread; allocf must be
+   thread safe; link with -lpthread */
+//#define MRB_GC_BACKGROUND_FREE
+
+/* bytes allocated by mrb_malloc/mrb_realloc that trigger a GC cycle */
+//#define MRB_GC_MALLOC_LIMIT (16 * 1024 * 1024)
+
+/* percentage of its pages the heap grows by when it runs out of slots;
+   0 adds one page at a time */
+//#define MRB_GC_HEAP_GROWTH_RATIO 0
+
+/* most pages added to the heap at once */
+//#define MRB_HEAP_GROWTH_MAX_PAGES 1024
+
+/* allocate heap pages in 2MB aligned chunks and ask the kernel to back
+   them with transparent huge pages (Linux) */
+//#define MRB_GC_HUGE_PAGES
+
 /* -DDISABLE_XXXX to drop following features */
 //#define DISABLE_STDIO		/* use of stdio */
 
@@ -52,6 +52,10 @@ typedef void* (*mrb_allocf) (struct mrb_state *mrb, void*, size_t, void *ud);
 #define MRB_GC_ARENA_SIZE 100
 #endif
 
+#ifndef MRB_GC_SLOT_CLASSES
+#define MRB_GC_SLOT_CLASSES 4
+#endif
+
 typedef struct {
   mrb_sym mid;
   struct RProc *proc;
@@ -65,6 +69,7 @@ typedef struct {
   int argc;
   int acc;
   struct RClass *target_class;
+  mrb_bool keep_self;           /* return self instead of the result (Class#new) */
 } mrb_callinfo;
 
 enum mrb_fiber_state {
@@ -102,6 +107,96 @@ enum gc_state {
 
 struct mrb_jmpbuf;
 
+#ifndef MRB_INIT_CACHE_SIZE
+#define MRB_INIT_CACHE_SIZE 32
+#endif
+
+struct mrb_init_cache {
+  struct RClass *c;                       /* receiver of Class#new */
+  struct RClass *owner;                   /* class that defines initialize */
+  struct RProc *m;                        /* initialize method */
+};
+
+#define MRB_GC_PAUSE_BUCKETS 160
+
+/* histogram of GC pauses in microseconds; buckets are 1/8 octave wide */
+struct mrb_gc_pause {
+  uint32_t hist[MRB_GC_PAUSE_BUCKETS];
+  size_t count;
+  uint64_t total_us;
+  uint32_t max_us;
+};
+
+/* collector counters; see mrb_gc_stat() for a snapshot with heap occupancy */
+struct mrb_gc_stat {
+  size_t count;                 /* completed GC cycles */
+  size_t minor_count;           /* cycles started as minor GC */
+  size_t major_count;           /* cycles started as major (or non-generational) GC */
+  size_t root_scan_count;       /* phase steps executed */
+  size_t mark_count;
+  size_t final_mark_count;
+  size_t sweep_count;
+  size_t promoted;              /* objects that survived a minor GC and became old */
+  size_t compact_count;         /* compactions run */
+  size_t moved;                 /* objects moved by compaction */
+  size_t region_count;          /* regions ended */
+  size_t region_freed;          /* objects reclaimed when their region ended */
+  size_t card_scans;            /* dirty cards of old containers scanned by minor GCs */
+  size_t heap_pages;
+  size_t payload_bytes;         /* bytes live objects own outside their slots, as of their last sweep */
+  /* filled by mrb_gc_stat() */
+  size_t live;
+  size_t free_slots;
+  size_t majorgc_old_threshold;
+  size_t malloc_increase;
+  size_t oldmalloc_increase;
+  struct mrb_gc_pause pause;
+};
+
+/* kinds of the memory accounted per state; see mrb_memory_stat() */
+enum mrb_memory_kind {
+  MRB_MEMORY_PAYLOAD,           /* what objects own outside their slots, and the rest */
+  MRB_MEMORY_HEAP,              /* heap pages */
+  MRB_MEMORY_COMPILER,          /* parser and code generator pools */
+  MRB_MEMORY_KINDS
+};
+
+/* bytes requested through mrb_malloc() and friends, and the limits on them */
+struct mrb_memory_stat {
+  size_t bytes;
+  size_t peak;
+  size_t kind_bytes[MRB_MEMORY_KINDS];
+  size_t kind_peak[MRB_MEMORY_KINDS];
+  size_t soft_limit;            /* crossing it runs a full GC; 0 for none */
+  size_t hard_limit;            /* allocations beyond it raise NoMemoryError; 0 for none */
+};
+
+enum mrb_gc_event {
+  MRB_GC_EVENT_START,           /* before the root scan of a cycle */
+  MRB_GC_EVENT_END              /* after the last page of a cycle was swept */
+};
+
+#ifdef MRB_GC_SIDE_BITMAP
+/* mark stack used instead of the gcnext chain, so marking does not write headers */
+struct mrb_gray_stack {
+  struct RBasic **ptr;
+  size_t len;
+  size_t capa;
+};
+#endif
+
+/* must not allocate or touch mruby objects */
+typedef void (mrb_gc_event_func)(struct mrb_state *mrb, enum mrb_gc_event ev, void *ud);
+
+enum mrb_obj_event {
+  MRB_OBJ_EVENT_NEW,            /* a sampled object was allocated (only tt and c are set) */
+  MRB_OBJ_EVENT_FREE,           /* a sampled object is about to be freed */
+  MRB_OBJ_EVENT_MOVE            /* a sampled object was moved from orig by mrb_gc_compact() */
+};
+
+/* must not allocate mruby objects; orig is NULL but for MRB_OBJ_EVENT_MOVE */
+typedef void (mrb_obj_event_func)(struct mrb_state *mrb, enum mrb_obj_event ev, struct RBasic *obj, struct RBasic *orig, void *ud);
+
 typedef struct mrb_state {
   struct mrb_jmpbuf *jmp;
 
@@ -124,6 +219,7 @@ typedef struct mrb_state {
 
   struct RClass *float_class;
   struct RClass *fixnum_class;
+  struct RClass *bignum_class;            /* set by mruby-bignum */
   struct RClass *true_class;
   struct RClass *false_class;
   struct RClass *nil_class;
@@ -132,8 +228,10 @@ typedef struct mrb_state {
 
   struct heap_page *heaps;                /* heaps for GC */
   struct heap_page *sweeps;
-  struct heap_page *free_heaps;
+  struct heap_page *free_heaps[MRB_GC_SLOT_CLASSES]; /* pages with free slots, per slot width */
+  size_t heap_class_pages[MRB_GC_SLOT_CLASSES]; /* heap pages of each slot width */
   size_t live; /* count of live objects */
+  size_t live_types[MRB_TT_MAXDEFINE]; /* live objects of each type */
 #ifdef MRB_GC_FIXED_ARENA
   struct RBasic *arena[MRB_GC_ARENA_SIZE]; /* GC protection array */
 #else
@@ -144,21 +242,92 @@ typedef struct mrb_state {
 
   enum gc_state gc_state; /* state of gc */
   int current_white_part; /* make white object by white_part */
+#ifdef MRB_GC_BACKGROUND_FREE
+  struct mrb_gc_freer *gc_freer; /* thread freeing payloads of swept objects */
+#endif
+#ifdef MRB_GC_PARALLEL_MARK
+  struct mrb_gc_marker *gc_marker; /* marker thread pool, created on first use */
+  int gc_mark_threads;      /* threads (including the caller) marking a full GC */
+#endif
+#ifdef MRB_GC_SIDE_BITMAP
+  struct mrb_gray_stack gray_stack; /* gray objects to be traversed incrementally */
+  struct mrb_gray_stack atomic_gray_stack; /* objects to be traversed atomically */
+#else
   struct RBasic *gray_list; /* list of gray objects to be traversed incrementally */
   struct RBasic *atomic_gray_list; /* list of objects to be traversed atomically */
+#endif
   size_t gc_live_after_mark;
   size_t gc_threshold;
   int gc_interval_ratio;
   int gc_step_ratio;
   mrb_bool gc_disabled:1;
   mrb_bool gc_full:1;
+  mrb_bool gc_lazy_sweep:1; /* leave sweeping to the allocation path */
+#ifdef MRB_GC_BACKGROUND_FREE
+  mrb_bool gc_deferring:1;  /* sweeping; mrb_free() queues to gc_freer */
+#endif
+#ifdef MRB_GC_PARALLEL_MARK
+  mrb_bool gc_parallel:1;   /* inside mrb_full_gc(); marking may use helper threads */
+#endif
+#ifdef MRB_GC_SIDE_BITMAP
+  mrb_bool gray_overflow:1; /* a gray stack could not grow; rescan the heap */
+#endif
   mrb_bool is_generational_gc_mode:1;
-  mrb_bool out_of_memory:1;
+  mrb_bool memory_gc_pending:1; /* a memory limit or failed allocation asks the next object allocation to collect */
+  mrb_bool gc_compact_pending:1;
+  mrb_bool gc_compacting:1;
+  mrb_bool region_overflow:1;    /* the remembered set could not grow */
+  int region_depth;              /* nesting of mrb_region_begin() */
+  void (*gc_visit)(struct mrb_state *mrb, struct RBasic *obj, void *ud); /* called by mrb_gc_mark() instead of marking */
+  void *gc_visit_ud;
+  struct heap_page *region_pages; /* pages the open region allocates from */
+  struct heap_page *region_idle; /* emptied region pages kept for the next region */
+  struct RBasic **region_remember; /* outside objects written region objects into */
+  size_t region_remember_len;
+  size_t region_remember_capa;
+  struct RBasic *region_gray;    /* region objects reached but not scanned yet */
+  struct mrb_gc_card *gc_cards;  /* dirty cards of large old containers, open addressed */
+  size_t gc_cards_len;
+  size_t gc_cards_capa;
+  int gc_compact_threshold;  /* percentage of free slots that requests a compaction; 0 to disable */
+  size_t gc_compact_pages;   /* heap pages left by the last compaction */
+  int gc_heap_growth_ratio;  /* percentage of its pages the heap grows by; 0 for one page */
+  size_t gc_heap_min_pages;  /* pages set aside by mrb_gc_reserve() */
+  struct heap_page *heap_idle; /* freed pages whose chunk is still in use */
   size_t majorgc_old_threshold;
+  size_t malloc_increase;    /* bytes allocated by mrb_malloc since the last GC cycle */
+  size_t oldmalloc_increase; /* bytes allocated by mrb_malloc since the last major GC */
+  size_t malloc_limit;       /* malloc_increase that triggers a GC cycle */
+  struct mrb_memory_stat memory; /* accounting of mrb_malloc(); see mrb_memory_limit_set() */
+  size_t memory_soft_next;   /* bytes that set memory_gc_pending under the soft limit */
+  size_t memory_hard_next;   /* bytes that set memory_gc_pending ahead of the hard limit */
+  size_t memory_hard_cap;    /* highest hard limit Ruby code may set; 0 for any */
+  struct RObject *nomem_err; /* NoMemoryError raised when an allocation fails */
+  uint32_t gc_step_budget_us; /* wall clock budget of an incremental step; 0 to use gc_step_ratio */
+  struct mrb_gc_pause gc_pause;
+  struct mrb_gc_stat gc_stat;
+  mrb_gc_event_func *gc_event_func;
+  void *gc_event_ud;
+  struct mrb_gc_weak *gc_weak; /* weak reference tables; see mrb_gc_weak_register() */
+  mrb_obj_event_func *obj_event_func;
+  void *obj_event_ud;
+  uint32_t obj_event_interval;  /* report every nth allocation; 0 reports frees and moves only */
+  uint32_t obj_event_countdown; /* allocations left until the next sample */
   struct alloca_header *mems;
 
   mrb_sym symidx;
   struct kh_n2s *name2sym;      /* symbol table */
+  struct symbol_name *symtbl;   /* names indexed by symbol */
+  struct RString **symstr;      /* strings of mrb_sym2str() indexed by symbol; NULL until asked for */
+  size_t symcapa;
+
+  mrb_sym sym_initialize;
+  struct mrb_init_cache init_cache[MRB_INIT_CACHE_SIZE]; /* initialize lookup for Class#new */
+
+  /* called when Fixnum arithmetic overflows; NULL promotes to Float */
+  mrb_value (*int_overflow)(struct mrb_state *mrb, int op, mrb_int x, mrb_int y);
+  /* reads an Integer too large for a Fixnum (see mrb_int_read_big()); NULL reads a Float */
+  mrb_value (*int_read)(struct mrb_state *mrb, const char *p, const char *end, int base, mrb_bool neg);
 
 #ifdef ENABLE_DEBUG
   void (*code_fetch_hook)(struct mrb_state* mrb, struct mrb_irep *irep, mrb_code *pc, mrb_value *regs);
@@ -267,12 +436,14 @@ const char *mrb_sym2name(mrb_state*,mrb_sym);
 const char *mrb_sym2name_len(mrb_state*,mrb_sym,mrb_int*);
 mrb_value mrb_sym2str(mrb_state*,mrb_sym);
 
-void *mrb_malloc(mrb_state*, size_t);         /* raise RuntimeError if no mem */
+void *mrb_malloc(mrb_state*, size_t);         /* raise NoMemoryError if no mem */
 void *mrb_calloc(mrb_state*, size_t, size_t); /* ditto */
 void *mrb_realloc(mrb_state*, void*, size_t); /* ditto */
 void *mrb_realloc_simple(mrb_state*, void*, size_t); /* return NULL if no memory available */
 void *mrb_malloc_simple(mrb_state*, size_t);  /* return NULL if no memory available */
+void *mrb_malloc_kind(mrb_state*, size_t, enum mrb_memory_kind); /* ditto; accounted as kind */
 struct RBasic *mrb_obj_alloc(mrb_state*, enum mrb_vtype, struct RClass*);
+struct RBasic *mrb_obj_alloc_size(mrb_state*, enum mrb_vtype, struct RClass*, size_t*);
 void mrb_free(mrb_state*, void*);
 
 mrb_value mrb_str_new(mrb_state *mrb, const char *p, size_t len);
@@ -304,17 +475,31 @@ mrb_bool mrb_eql(mrb_state *mrb, mrb_value obj1, mrb_value obj2);
 void mrb_garbage_collect(mrb_state*);
 void mrb_full_gc(mrb_state*);
 void mrb_incremental_gc(mrb_state *);
+void mrb_gc_step_budget_set(mrb_state *mrb, uint32_t usec);
+void mrb_gc_reserve(mrb_state *mrb, size_t n);
+uint32_t mrb_gc_pause_percentile(mrb_state *mrb, double pct);
+void mrb_gc_stat(mrb_state *mrb, struct mrb_gc_stat *stat);
+void mrb_gc_set_event_func(mrb_state *mrb, mrb_gc_event_func *func, void *ud);
+void mrb_memory_limit_set(mrb_state *mrb, size_t soft, size_t hard);
+void mrb_memory_stat(mrb_state *mrb, struct mrb_memory_stat *stat);
+void mrb_gc_set_obj_event_func(mrb_state *mrb, mrb_obj_event_func *func, void *ud, uint32_t interval);
 int mrb_gc_arena_save(mrb_state*);
 void mrb_gc_arena_restore(mrb_state*,int);
 void mrb_gc_mark(mrb_state*,struct RBasic*);
 #define mrb_gc_mark_value(mrb,val) do {\
-  if (MRB_TT_HAS_BASIC_P(mrb_type(val))) mrb_gc_mark((mrb), mrb_basic_ptr(val)); \
+  if (mrb_basic_p(val)) mrb_gc_mark((mrb), mrb_basic_ptr(val)); \
 } while (0)
 void mrb_field_write_barrier(mrb_state *, struct RBasic*, struct RBasic*);
 #define mrb_field_write_barrier_value(mrb, obj, val) do{\
-  if (MRB_TT_HAS_BASIC_P(val.tt)) mrb_field_write_barrier((mrb), (obj), mrb_basic_ptr(val)); \
+  if (mrb_basic_p(val)) mrb_field_write_barrier((mrb), (obj), mrb_basic_ptr(val)); \
 } while (0)
 void mrb_write_barrier(mrb_state *, struct RBasic*);
+void mrb_field_write_barrier_slot(mrb_state *, struct RBasic*, size_t slot, size_t nslots, struct RBasic*);
+#define mrb_field_write_barrier_slot_value(mrb, obj, slot, nslots, val) do{\
+  if (mrb_basic_p(val)) mrb_field_write_barrier_slot((mrb), (obj), (slot), (nslots), mrb_basic_ptr(val)); \
+} while (0)
+void mrb_write_barrier_range(mrb_state *, struct RBasic*, size_t beg, size_t len, size_t nslots);
+void mrb_write_barrier_moved(mrb_state *, struct RBasic*);
 
 mrb_value mrb_check_convert_type(mrb_state *mrb, mrb_value val, enum mrb_vtype type, const char *tname, const char *method);
 mrb_value mrb_any_to_s(mrb_state *mrb, mrb_value obj);
@@ -374,6 +559,7 @@ void mrb_print_error(mrb_state *mrb);
 #define E_FLOATDOMAIN_ERROR         (mrb_class_get(mrb, "FloatDomainError"))
 
 #define E_KEY_ERROR                 (mrb_class_get(mrb, "KeyError"))
+#define E_NOMEMORY_ERROR            (mrb_class_get(mrb, "NoMemoryError"))
 
 mrb_value mrb_yield(mrb_state *mrb, mrb_value b, mrb_value arg);
 mrb_value mrb_yield_argv(mrb_state *mrb, mrb_value b, mrb_int argc, const mrb_value *argv);
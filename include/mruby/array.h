@@ -35,6 +35,11 @@ struct RArray {
 #define RARRAY_PTR(a) (RARRAY(a)->ptr)
 #define MRB_ARY_SHARED      256
 
+/* small arrays keep their elements in the heap slot, right after the
+   struct (see mrb_obj_alloc_size); aux.capa is then what the slot holds */
+#define MRB_ARY_EMBED_PTR(a) ((mrb_value*)((struct RArray*)(a) + 1))
+#define MRB_ARY_EMBED_P(a) ((a)->ptr == MRB_ARY_EMBED_PTR(a))
+
 void mrb_ary_modify(mrb_state*, struct RArray*);
 void mrb_ary_decref(mrb_state*, mrb_shared_array*);
 mrb_value mrb_ary_new_capa(mrb_state*, mrb_int);
@@ -63,11 +63,15 @@ void mrb_alias_method(mrb_state *mrb, struct RClass *c, mrb_sym a, mrb_sym b);
 struct RClass *mrb_class_outer_module(mrb_state*, struct RClass *);
 struct RProc *mrb_method_search_vm(mrb_state*, struct RClass**, mrb_sym);
 struct RProc *mrb_method_search(mrb_state*, struct RClass*, mrb_sym);
+struct RProc *mrb_init_method_search(mrb_state*, struct RClass**);
+void mrb_clear_init_cache(mrb_state*);
+mrb_value mrb_instance_alloc(mrb_state*, mrb_value);
 
 struct RClass* mrb_class_real(struct RClass* cl);
 
 void mrb_gc_mark_mt(mrb_state*, struct RClass*);
 size_t mrb_gc_mark_mt_size(mrb_state*, struct RClass*);
+size_t mrb_gc_mt_memsize(mrb_state*, struct RClass*);
 void mrb_gc_free_mt(mrb_state*, struct RClass*);
 
 #if defined(__cplusplus)
@@ -14,6 +14,7 @@ extern "C" {
 typedef struct mrb_data_type {
   const char *struct_name;
   void (*dfree)(mrb_state *mrb, void*);
+  size_t (*dsize)(mrb_state *mrb, const void*); /* bytes owned by the data; may be NULL */
 } mrb_data_type;
 
 struct RData {
@@ -25,6 +26,20 @@ struct RData {
 
 struct RData *mrb_data_object_alloc(mrb_state *mrb, struct RClass* klass, void *datap, const mrb_data_type *type);
 
+/*
+ * The payload was allocated along with the object by
+ * mrb_data_object_alloc_inline(). It lives in the heap slot right
+ * after the RData when a slot class is wide enough, or in a block of
+ * its own otherwise. Either way the collector frees it with the object
+ * and doesn't call dfree, so such a payload must not own other memory,
+ * and DATA_PTR() must not be replaced.
+ */
+#define MRB_DATA_INLINE 1
+#define MRB_DATA_INLINE_P(d) ((d)->flags & MRB_DATA_INLINE)
+#define MRB_DATA_INLINE_PTR(d) ((void*)((struct RData*)(d) + 1))
+
+struct RData *mrb_data_object_alloc_inline(mrb_state *mrb, struct RClass* klass, size_t size, const mrb_data_type *type);
+
 #define Data_Wrap_Struct(mrb,klass,type,ptr)\
   mrb_data_object_alloc(mrb,klass,ptr,type)
 
@@ -34,12 +49,29 @@ struct RData *mrb_data_object_alloc(mrb_state *mrb, struct RClass* klass, void *
   data = Data_Wrap_Struct(mrb,klass,type,sval);\
 } while (0)
 
+/* Data_Make_Struct() with the zeroed struct in the object's slot */
+#define Data_Make_Inline(mrb,klass,strct,type,sval,data) do { \
+  data = mrb_data_object_alloc_inline(mrb,klass,sizeof(strct),type);\
+  sval = (strct*)data->data;\
+} while (0)
+
 #define RDATA(obj)         ((struct RData *)(mrb_ptr(obj)))
 #define DATA_PTR(d)        (RDATA(d)->data)
 #define DATA_TYPE(d)       (RDATA(d)->type)
 void mrb_data_check_type(mrb_state *mrb, mrb_value, const mrb_data_type*);
 void *mrb_data_get_ptr(mrb_state *mrb, mrb_value, const mrb_data_type*);
 #define DATA_GET_PTR(mrb,obj,dtype,type) (type*)mrb_data_get_ptr(mrb,obj,dtype)
+
+/* mrb_data_get_ptr() with the check inlined; only a mismatch makes a call, to raise */
+static inline void*
+mrb_data_get_typed(mrb_state *mrb, mrb_value obj, const mrb_data_type *type)
+{
+  if (mrb_type(obj) == MRB_TT_DATA && DATA_TYPE(obj) == type) {
+    return DATA_PTR(obj);
+  }
+  return mrb_data_get_ptr(mrb, obj, type);
+}
+#define DATA_GET_TYPED(mrb,obj,dtype,type) ((type*)mrb_data_get_typed(mrb,obj,dtype))
 void *mrb_data_check_get_ptr(mrb_state *mrb, mrb_value, const mrb_data_type*);
 #define DATA_CHECK_GET_PTR(mrb,obj,dtype,type) (type*)mrb_data_check_get_ptr(mrb,obj,dtype)
 
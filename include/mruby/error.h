@@ -20,6 +20,7 @@ void mrb_exc_print(mrb_state *mrb, struct RObject *exc);
 void mrb_print_backtrace(mrb_state *mrb);
 mrb_value mrb_exc_backtrace(mrb_state *mrb, mrb_value exc);
 mrb_value mrb_get_backtrace(mrb_state *mrb);
+mrb_noreturn void mrb_raise_nomemory(mrb_state *mrb);
 
 /* declaration for fail method */
 mrb_value mrb_f_raise(mrb_state*, mrb_value);
@@ -13,8 +13,53 @@ extern "C" {
 
 typedef void (mrb_each_object_callback)(mrb_state *mrb, struct RBasic *obj, void *data);
 void mrb_objspace_each_objects(mrb_state *mrb, mrb_each_object_callback *callback, void *data);
+typedef void (mrb_each_reference_callback)(mrb_state *mrb, const char *root, struct RBasic *obj, void *data);
+void mrb_objspace_each_reference(mrb_state *mrb, struct RBasic *obj, mrb_each_reference_callback *callback, void *data);
+void mrb_objspace_each_root(mrb_state *mrb, mrb_each_reference_callback *callback, void *data);
+size_t mrb_objspace_memsize_of(mrb_state *mrb, mrb_value obj);
+size_t mrb_objspace_memsize_of_all(mrb_state *mrb);
 void mrb_free_context(mrb_state *mrb, struct mrb_context *c);
 
+size_t mrb_gc_compact(mrb_state *mrb);
+void mrb_gc_safe_point(mrb_state *mrb);
+void mrb_gc_pin(mrb_state *mrb, mrb_value obj);
+void mrb_gc_unpin(mrb_state *mrb, mrb_value obj);
+mrb_value mrb_gc_location(mrb_state *mrb, mrb_value obj);
+
+/*
+ * Allocate objects into dedicated pages until the matching
+ * mrb_region_end(), which reclaims in bulk every object of the region
+ * that is unreachable from the roots (globals, VM stacks, the GC arena)
+ * and from outside objects the write barriers saw it stored into.
+ * Regions nest; only the outermost end reclaims.
+ */
+void mrb_region_begin(mrb_state *mrb);
+void mrb_region_end(mrb_state *mrb);
+
+/*
+ * A table of weak references, embedded in the C data of its owner.
+ * Once a GC cycle has marked everything, and again after a compaction,
+ * update() is called for every registered table; it must pass each
+ * reference through mrb_gc_weak_update() and drop the entries that come
+ * back undef.  It must not allocate or call into Ruby.  Read references
+ * through mrb_gc_weak_get().
+ */
+struct mrb_gc_weak;
+typedef void (mrb_gc_weak_func)(mrb_state *mrb, struct mrb_gc_weak *weak);
+struct mrb_gc_weak {
+  struct mrb_gc_weak *prev, *next;
+  mrb_gc_weak_func *update;
+};
+void mrb_gc_weak_register(mrb_state *mrb, struct mrb_gc_weak *weak, mrb_gc_weak_func *update);
+void mrb_gc_weak_unregister(mrb_state *mrb, struct mrb_gc_weak *weak);
+mrb_value mrb_gc_weak_update(mrb_state *mrb, mrb_value obj);
+mrb_value mrb_gc_weak_get(mrb_state *mrb, mrb_value obj);
+mrb_bool mrb_gc_alloc_site(mrb_state *mrb, struct mrb_irep **irep, mrb_code **pc);
+#ifdef MRB_GC_PARALLEL_MARK
+int mrb_gc_mark_threads(mrb_state *mrb);
+void mrb_gc_set_mark_threads(mrb_state *mrb, int n);
+#endif
+
 #if defined(__cplusplus)
 }  /* extern "C" { */
 #endif
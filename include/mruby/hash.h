@@ -44,7 +44,10 @@ struct kh_ht * mrb_hash_tbl(mrb_state *mrb, mrb_value hash);
 
 /* GC functions */
 void mrb_gc_mark_hash(mrb_state*, struct RHash*);
+void mrb_gc_mark_hash_slots(mrb_state*, struct RHash*, size_t beg, size_t end);
+void mrb_gc_update_hash(mrb_state*, struct RHash*);
 size_t mrb_gc_mark_hash_size(mrb_state*, struct RHash*);
+size_t mrb_gc_hash_memsize(mrb_state*, struct RHash*);
 void mrb_gc_free_hash(mrb_state*, struct RHash*);
 
 #if defined(__cplusplus)
@@ -148,21 +148,21 @@ kh_fill_flags(uint8_t *p, uint8_t c, size_t len)
       new_n_buckets = KHASH_MIN_SIZE;                                   \
     khash_power2(new_n_buckets);                                        \
     {                                                                   \
-      uint8_t *old_ed_flags = h->ed_flags;                              \
-      khkey_t *old_keys = h->keys;                                      \
-      khval_t *old_vals = h->vals;                                      \
-      khint_t old_n_buckets = h->n_buckets;                             \
+      /* h stays whole until the new table is filled, should an        \
+         allocation or a hash function raise */                         \
+      kh_##name##_t nh;                                                 \
       khint_t i;                                                        \
-      h->n_buckets = new_n_buckets;                                     \
-      kh_alloc_##name(mrb, h);                                          \
+      nh.n_buckets = new_n_buckets;                                     \
+      kh_alloc_##name(mrb, &nh);                                        \
       /* relocate */                                                    \
-      for (i=0 ; i<old_n_buckets ; i++) {                               \
-        if (!__ac_iseither(old_ed_flags, i)) {                          \
-          khint_t k = kh_put_##name(mrb, h, old_keys[i], NULL);         \
-          if (kh_is_map) kh_value(h,k) = old_vals[i];                   \
+      for (i=0 ; i<h->n_buckets ; i++) {                                \
+        if (!__ac_iseither(h->ed_flags, i)) {                           \
+          khint_t k = kh_put_##name(mrb, &nh, h->keys[i], NULL);        \
+          if (kh_is_map) kh_value(&nh,k) = h->vals[i];                  \
         }                                                               \
       }                                                                 \
-      mrb_free(mrb, old_keys);                                          \
+      mrb_free(mrb, h->keys);                                           \
+      *h = nh;                                                          \
     }                                                                   \
   }                                                                     \
   khint_t kh_put_##name(mrb_state *mrb, kh_##name##_t *h, khkey_t key, int *ret) \
@@ -247,6 +247,9 @@ kh_fill_flags(uint8_t *p, uint8_t c, size_t len)
 #define kh_end(h) ((h)->n_buckets)
 #define kh_size(h) ((h)->size)
 #define kh_n_buckets(h) ((h)->n_buckets)
+/* bytes allocated for the table h (which may be NULL) */
+#define kh_memsize(h) ((h) ? sizeof(*(h)) + (size_t)(h)->n_buckets/4 +\
+  (size_t)(h)->n_buckets*(sizeof(*(h)->keys) + ((h)->vals ? sizeof(*(h)->vals) : 0)) : 0)
 
 #define kh_int_hash_func(mrb,key) (khint_t)((key)^((key)<<2)^((key)>>2))
 #define kh_int_hash_equal(mrb,a, b) (a == b)
@@ -24,6 +24,26 @@ mrb_value mrb_fixnum_minus(mrb_state *mrb, mrb_value x, mrb_value y);
 mrb_value mrb_fixnum_mul(mrb_state *mrb, mrb_value x, mrb_value y);
 mrb_value mrb_num_div(mrb_state *mrb, mrb_value x, mrb_value y);
 mrb_float mrb_to_flo(mrb_state *mrb, mrb_value x);
+mrb_value mrb_int_overflow(mrb_state *mrb, int op, mrb_int x, mrb_int y);
+mrb_value mrb_int_read_big(mrb_state *mrb, const char *p, const char *end, int base, mrb_bool neg);
+
+/* formatting routines (fmt_fp.c) */
+#define MRB_FLO_SHORTEST_MAX 24
+int mrb_flo_shortest(mrb_float f, char *buf, int *decpt);
+int mrb_flo_format(char *buf, size_t size, mrb_float f, char fmt, int prec, mrb_bool alt);
+char *mrb_uint_to_dec(char *end, uint64_t v);
+
+/* parsing routines (readnum.c) */
+double mrb_float_read(mrb_state *mrb, const char *str, char **endp, mrb_bool uscore);
+const char *mrb_uint_read(const char *p, const char *end, int base, mrb_bool uscore, uint64_t *val, mrb_bool *overflow);
+
+#ifdef MRB_WORD_BOXING
+# define MRB_FIXNUM_MAX (MRB_INT_MAX >> MRB_FIXNUM_SHIFT)
+# define MRB_FIXNUM_MIN (MRB_INT_MIN >> MRB_FIXNUM_SHIFT)
+#else
+# define MRB_FIXNUM_MAX MRB_INT_MAX
+# define MRB_FIXNUM_MIN MRB_INT_MIN
+#endif
 
 #define MRB_UINT_MAKE2(n) uint ## n ## _t
 #define MRB_UINT_MAKE(n) MRB_UINT_MAKE2(n)
@@ -55,6 +75,30 @@ mrb_int_sub_overflow(mrb_int minuend, mrb_int subtrahend, mrb_int *difference)
   return !!(((x ^ z) & (~y ^ z)) & MRB_INT_OVERFLOW_MASK);
 }
 
+static inline mrb_bool
+mrb_int_mul_overflow(mrb_int multiplier, mrb_int multiplicand, mrb_int *product)
+{
+  mrb_int x = multiplier;
+  mrb_int y = multiplicand;
+
+  if (x > 0) {
+    if (y > 0) {
+      if (x > MRB_FIXNUM_MAX / y) return TRUE;
+    }
+    else {
+      if (y < MRB_FIXNUM_MIN / x) return TRUE;
+    }
+  }
+  else if (y > 0) {
+    if (x < MRB_FIXNUM_MIN / y) return TRUE;
+  }
+  else if (x != 0 && y < MRB_FIXNUM_MAX / x) {
+    return TRUE;
+  }
+  *product = x * y;
+  return FALSE;
+}
+
 #undef MRB_INT_OVERFLOW_MASK
 #undef mrb_uint
 #undef MRB_UINT_MAKE
@@ -20,7 +20,9 @@ struct REnv {
   ptrdiff_t cioff;
 };
 
-#define MRB_ENV_STACK_LEN(e) ((e)->flags)
+/* the upper flag bits are left to the collector (MRB_FLAG_GC_*) */
+#define MRB_ENV_STACK_LEN(e) ((e)->flags & 0x1ffff)
+#define MRB_ENV_SET_STACK_LEN(e,len) ((e)->flags = ((e)->flags & ~0x1ffff) | ((unsigned int)(len) & 0x1ffff))
 #define MRB_ENV_UNSHARE_STACK(e) ((e)->cioff = -1)
 #define MRB_ENV_STACK_SHARED_P(e) ((e)->cioff >= 0)
 
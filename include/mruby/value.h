@@ -227,6 +227,36 @@ enum mrb_vtype {
 #include <limits.h>
 #define MRB_TT_HAS_BASIC  MRB_TT_FLOAT
 
+/* flonum: store doubles inline in 64bit words when the exponent allows */
+#if !defined(MRB_USE_FLOAT) && !defined(MRB_WITHOUT_FLONUM) && UINTPTR_MAX == UINT64_MAX
+# define MRB_FLONUM
+#endif
+
+#ifdef MRB_FLONUM
+/* value representation by word-boxing with flonum:
+ *   nil   : 0000 0000 0000 0000 ... 0000 0000
+ *   false : 0000 0000 0000 0000 ... 0000 0100
+ *   true  : 0000 0000 0000 0000 ... 0000 1100
+ *   undef : 0000 0000 0000 0000 ... 0001 0100
+ *   fixnum: xxxx xxxx IIII IIII ... IIII III1
+ *   flonum: FFFF FFFF FFFF FFFF ... FFFF FF10
+ *   symbol: xxxx xxxx SSSS SSSS ... 0001 1100
+ *   object: PPPP PPPP PPPP PPPP ... PPPP P000
+ */
+enum mrb_special_consts {
+  MRB_Qnil    = 0,
+  MRB_Qfalse  = 4,
+  MRB_Qtrue   = 12,
+  MRB_Qundef  = 20,
+};
+
+#define MRB_FIXNUM_FLAG   0x01
+#define MRB_FIXNUM_SHIFT  1
+#define MRB_FLONUM_MASK   0x03
+#define MRB_FLONUM_FLAG   0x02
+#define MRB_SYMBOL_FLAG   0x1c
+#define MRB_SPECIAL_SHIFT 8
+#else
 enum mrb_special_consts {
   MRB_Qnil    = 0,
   MRB_Qfalse  = 2,
@@ -238,6 +268,7 @@ enum mrb_special_consts {
 #define MRB_FIXNUM_SHIFT  1
 #define MRB_SYMBOL_FLAG   0x0e
 #define MRB_SPECIAL_SHIFT 8
+#endif
 
 typedef union mrb_value {
   union {
@@ -254,11 +285,17 @@ typedef union mrb_value {
     struct RFloat *fp;
     struct RCptr *vp;
   } value;
-  unsigned long w;
+  uintptr_t w;
 } mrb_value;
 
 #define mrb_ptr(o)      (o).value.p
+#ifdef MRB_FLONUM
+#define mrb_flonum_p(o) (((o).w & MRB_FLONUM_MASK) == MRB_FLONUM_FLAG)
+#define mrb_float(o)    (mrb_flonum_p(o) ? mrb_flonum(o) : (o).value.fp->f)
+#else
+#define mrb_flonum_p(o) FALSE
 #define mrb_float(o)    (o).value.fp->f
+#endif
 
 #define MRB_SET_VALUE(o, ttt, attr, v) do {\
   (o).w = 0;\
@@ -358,6 +395,7 @@ mrb_bool mrb_regexp_p(struct mrb_state*, mrb_value);
 #define MRB_GC_WHITES (MRB_GC_WHITE_A | MRB_GC_WHITE_B)
 #define MRB_GC_COLOR_MASK 7
 
+#ifndef MRB_GC_SIDE_BITMAP
 #define paint_gray(o) ((o)->color = MRB_GC_GRAY)
 #define paint_black(o) ((o)->color = MRB_GC_BLACK)
 #define paint_white(o) ((o)->color = MRB_GC_WHITES)
@@ -366,12 +404,30 @@ mrb_bool mrb_regexp_p(struct mrb_state*, mrb_value);
 #define is_white(o) ((o)->color & MRB_GC_WHITES)
 #define is_black(o) ((o)->color & MRB_GC_BLACK)
 #define is_dead(s, o) (((o)->color & other_white_part(s) & MRB_GC_WHITES) || (o)->tt == MRB_TT_FREE)
+#else
+/* colors of heap objects live in the side table of their page (see gc.c) */
+#define is_dead(s, o) mrb_object_dead_p(s, o)
+#endif
 #define flip_white_part(s) ((s)->current_white_part = other_white_part(s))
 #define other_white_part(s) ((s)->current_white_part ^ MRB_GC_WHITES)
 
+/* the allocation was sampled; its free and moves are reported to mrb->obj_event_func */
+#define MRB_FLAG_GC_TRACED (1 << 17)
+/* the object was allocated in an open region; see mrb_region_begin() */
+#define MRB_FLAG_GC_REGION (1 << 18)
+/* a region object reached by mrb_region_end(), or an outside object it has to scan */
+#define MRB_FLAG_GC_REGION_SEEN (1 << 19)
+/* the object is never moved by mrb_gc_compact() */
+#define MRB_FLAG_GC_PINNED (1 << 20)
+/* flag bits owned by the collector; keep them when copying flags between objects */
+#define MRB_FLAG_GC_MASK (MRB_FLAG_GC_TRACED | MRB_FLAG_GC_REGION | MRB_FLAG_GC_REGION_SEEN | MRB_FLAG_GC_PINNED)
+
 struct RBasic {
   MRB_OBJECT_HEADER;
 };
+#ifdef MRB_GC_SIDE_BITMAP
+mrb_bool mrb_object_dead_p(struct mrb_state *mrb, struct RBasic *obj);
+#endif
 #define mrb_basic_ptr(v) ((struct RBasic*)(mrb_ptr(v)))
 /* obsolete macro mrb_basic; will be removed soon */
 #define mrb_basic(v)     mrb_basic_ptr(v)
@@ -385,6 +441,12 @@ struct RObject {
 #define mrb_object(o) mrb_obj_ptr(o)
 #define mrb_immediate_p(x) (mrb_type(x) <= MRB_TT_CPTR)
 #define mrb_special_const_p(x) mrb_immediate_p(x)
+#ifdef MRB_WORD_BOXING
+/* true if the value points to a heap object (including boxed Float/CPTR) */
+#define mrb_basic_p(x) (MRB_TT_HAS_BASIC_P(mrb_type(x)) && !mrb_flonum_p(x))
+#else
+#define mrb_basic_p(x) MRB_TT_HAS_BASIC_P(mrb_type(x))
+#endif
 
 struct RFiber {
   MRB_OBJECT_HEADER;
@@ -417,11 +479,56 @@ mrb_type(mrb_value o)
   if (o.value.i_flag == MRB_FIXNUM_FLAG) {
     return MRB_TT_FIXNUM;
   }
+  if (mrb_flonum_p(o)) {
+    return MRB_TT_FLOAT;
+  }
   if (o.value.sym_flag == MRB_SYMBOL_FLAG) {
     return MRB_TT_SYMBOL;
   }
   return o.value.bp->tt;
 }
+
+#ifdef MRB_FLONUM
+#define MRB_FLONUM_ZERO ((uintptr_t)0x8000000000000002)
+
+/*
+ * A double whose exponent bits b62..b60 are 011 or 100 (roughly 1e-77 to
+ * 1e+77 in magnitude) is rotated left by 3 so that the sign bit drops into
+ * bit 2 and the two exponent bits that can be rebuilt from b63 are replaced
+ * by the flonum tag.  +0.0 has its own encoding.  Everything else is
+ * boxed in an RFloat by mrb_float_value().
+ */
+static inline mrb_bool
+mrb_flonum_encode(mrb_float f, mrb_value *v)
+{
+  union { mrb_float f; uint64_t u; } t;
+  int bits;
+
+  t.f = f;
+  bits = (int)((t.u >> 60) & 0x7);
+  if (t.u != 0x3000000000000000 && !((bits-3) & ~0x01)) {
+    v->w = (uintptr_t)((((t.u << 3) | (t.u >> 61)) & ~(uint64_t)0x01) | MRB_FLONUM_FLAG);
+    return TRUE;
+  }
+  if (t.u == 0) {
+    v->w = MRB_FLONUM_ZERO;
+    return TRUE;
+  }
+  return FALSE;
+}
+
+static inline mrb_float
+mrb_flonum(mrb_value v)
+{
+  union { mrb_float f; uint64_t u; } t;
+  uint64_t b;
+
+  if (v.w == MRB_FLONUM_ZERO) return 0.0;
+  b = (2 - ((uint64_t)v.w >> 63)) | ((uint64_t)v.w & ~(uint64_t)0x03);
+  t.u = (b >> 3) | (b << 61);
+  return t.f;
+}
+#endif
 #endif  /* MRB_WORD_BOXING */
 
 static inline mrb_value
@@ -70,7 +70,11 @@ void mrb_gc_mark_gv(mrb_state*);
 void mrb_gc_free_gv(mrb_state*);
 void mrb_gc_mark_iv(mrb_state*, struct RObject*);
 size_t mrb_gc_mark_iv_size(mrb_state*, struct RObject*);
+size_t mrb_gc_iv_memsize(mrb_state*, struct RObject*);
 void mrb_gc_free_iv(mrb_state*, struct RObject*);
+void mrb_gc_update_gv(mrb_state*);
+void mrb_gc_update_iv(mrb_state*, struct RObject*);
+void mrb_gc_pin_iv(mrb_state*, struct RObject*);
 
 #if defined(__cplusplus)
 }  /* extern "C" { */
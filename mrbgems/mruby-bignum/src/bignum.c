@@ -0,0 +1,1601 @@
+/*
+** bignum.c - Bignum class
+**
+** See Copyright Notice in mruby.h
+*/
+
+#include <ctype.h>
+#include <math.h>
+#include <string.h>
+
+#include "mruby.h"
+#include "mruby/array.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "mruby/numeric.h"
+#include "mruby/string.h"
+
+/*
+ * A Bignum is an immutable magnitude of 32bit digits (least significant
+ * first, no leading zero digits) plus a sign.  Results that fit in a
+ * Fixnum are always demoted, so a Bignum never equals a Fixnum.
+ */
+
+typedef uint32_t bn_digit;
+typedef uint64_t bn_ddigit;
+#define BN_DIGIT_BIT 32
+
+/* operand length (in digits) at which multiplication switches to Karatsuba */
+#ifndef BN_KARATSUBA_CUTOFF
+#define BN_KARATSUBA_CUTOFF 40
+#endif
+
+/* operand length (in digits) at which to_s switches to divide-and-conquer */
+#ifndef BN_TOSTR_CUTOFF
+#define BN_TOSTR_CUTOFF 30
+#endif
+
+/* results larger than this (in bits) are refused */
+#ifndef BN_MAX_BITS
+#define BN_MAX_BITS (32 * 1024 * 1024)
+#endif
+
+struct bignum {
+  size_t len;
+  mrb_bool neg;
+  bn_digit d[];
+};
+
+static size_t
+bn_memsize(mrb_state *mrb, const void *p)
+{
+  return sizeof(struct bignum) + sizeof(bn_digit) * ((const struct bignum*)p)->len;
+}
+
+static const struct mrb_data_type bignum_type = {
+  "Bignum", mrb_free, bn_memsize,
+};
+
+/* read-only view of an Integer (either Fixnum or Bignum) */
+struct bn_view {
+  const bn_digit *d;
+  size_t len;
+  mrb_bool neg;
+  bn_digit buf[2];
+};
+
+#define bn_p(v) (mrb_type(v) == MRB_TT_DATA && DATA_TYPE(v) == &bignum_type)
+
+static size_t
+mag_trim(const bn_digit *d, size_t len)
+{
+  while (len > 0 && d[len-1] == 0) len--;
+  return len;
+}
+
+static int
+mag_cmp(const bn_digit *a, size_t an, const bn_digit *b, size_t bn)
+{
+  an = mag_trim(a, an);
+  bn = mag_trim(b, bn);
+  if (an != bn) return an < bn ? -1 : 1;
+  while (an--) {
+    if (a[an] != b[an]) return a[an] < b[an] ? -1 : 1;
+  }
+  return 0;
+}
+
+/* r[0..max(an,bn)] = a + b */
+static void
+mag_add(bn_digit *r, const bn_digit *a, size_t an, const bn_digit *b, size_t bn)
+{
+  bn_ddigit carry = 0;
+  size_t i;
+
+  if (an < bn) {
+    const bn_digit *t = a; size_t tn = an;
+    a = b; an = bn; b = t; bn = tn;
+  }
+  for (i = 0; i < bn; i++) {
+    carry += (bn_ddigit)a[i] + b[i];
+    r[i] = (bn_digit)carry;
+    carry >>= BN_DIGIT_BIT;
+  }
+  for (; i < an; i++) {
+    carry += a[i];
+    r[i] = (bn_digit)carry;
+    carry >>= BN_DIGIT_BIT;
+  }
+  r[i] = (bn_digit)carry;
+}
+
+/* r[0..an) = a - b; requires a >= b */
+static void
+mag_sub(bn_digit *r, const bn_digit *a, size_t an, const bn_digit *b, size_t bn)
+{
+  bn_digit borrow = 0;
+  size_t i;
+
+  for (i = 0; i < bn; i++) {
+    bn_ddigit t = (bn_ddigit)a[i] - b[i] - borrow;
+    r[i] = (bn_digit)t;
+    borrow = (bn_digit)(t >> BN_DIGIT_BIT) & 1;
+  }
+  for (; i < an; i++) {
+    bn_ddigit t = (bn_ddigit)a[i] - borrow;
+    r[i] = (bn_digit)t;
+    borrow = (bn_digit)(t >> BN_DIGIT_BIT) & 1;
+  }
+}
+
+/* r[0..rn) += a[0..an); the sum must fit in rn digits */
+static void
+mag_add_to(bn_digit *r, size_t rn, const bn_digit *a, size_t an)
+{
+  bn_ddigit carry = 0;
+  size_t i;
+
+  for (i = 0; i < an; i++) {
+    carry += (bn_ddigit)r[i] + a[i];
+    r[i] = (bn_digit)carry;
+    carry >>= BN_DIGIT_BIT;
+  }
+  for (; carry && i < rn; i++) {
+    carry += r[i];
+    r[i] = (bn_digit)carry;
+    carry >>= BN_DIGIT_BIT;
+  }
+}
+
+/* r[0..rn) -= a[0..an); the difference must not be negative */
+static void
+mag_sub_from(bn_digit *r, size_t rn, const bn_digit *a, size_t an)
+{
+  bn_digit borrow = 0;
+  size_t i;
+
+  for (i = 0; i < an; i++) {
+    bn_ddigit t = (bn_ddigit)r[i] - a[i] - borrow;
+    r[i] = (bn_digit)t;
+    borrow = (bn_digit)(t >> BN_DIGIT_BIT) & 1;
+  }
+  for (; borrow && i < rn; i++) {
+    bn_ddigit t = (bn_ddigit)r[i] - borrow;
+    r[i] = (bn_digit)t;
+    borrow = (bn_digit)(t >> BN_DIGIT_BIT) & 1;
+  }
+}
+
+static void
+mag_mul_school(bn_digit *r, const bn_digit *a, size_t an, const bn_digit *b, size_t bn)
+{
+  size_t i, j;
+
+  for (i = 0; i < bn; i++) {
+    bn_ddigit carry = 0;
+    bn_digit m = b[i];
+
+    if (m == 0) continue;
+    for (j = 0; j < an; j++) {
+      carry += (bn_ddigit)a[j] * m + r[i+j];
+      r[i+j] = (bn_digit)carry;
+      carry >>= BN_DIGIT_BIT;
+    }
+    r[i+an] = (bn_digit)carry;
+  }
+}
+
+/* r[0..an+bn) = a * b; r must be zero cleared */
+static void
+mag_mul(mrb_state *mrb, bn_digit *r, const bn_digit *a, size_t an, const bn_digit *b, size_t bn)
+{
+  size_t h;
+
+  an = mag_trim(a, an);
+  bn = mag_trim(b, bn);
+  if (an < bn) {
+    const bn_digit *t = a; size_t tn = an;
+    a = b; an = bn; b = t; bn = tn;
+  }
+  if (bn == 0) return;
+  if (bn < BN_KARATSUBA_CUTOFF) {
+    mag_mul_school(r, a, an, b, bn);
+    return;
+  }
+
+  h = (an + 1) / 2;
+  if (bn <= h) {
+    /* unbalanced: multiply b by bn-sized slices of a */
+    bn_digit *t = (bn_digit *)mrb_malloc(mrb, sizeof(bn_digit) * 2 * bn);
+    size_t off;
+
+    for (off = 0; off < an; off += bn) {
+      size_t len = an - off < bn ? an - off : bn;
+
+      memset(t, 0, sizeof(bn_digit) * (len + bn));
+      mag_mul(mrb, t, a + off, len, b, bn);
+      mag_add_to(r + off, an + bn - off, t, len + bn);
+    }
+    mrb_free(mrb, t);
+  }
+  else {
+    /* Karatsuba: a = a1*B^h + a0, b = b1*B^h + b0 */
+    size_t a1n = an - h, b1n = bn - h;
+    bn_digit *t = (bn_digit *)mrb_calloc(mrb, 4 * (h + 1), sizeof(bn_digit));
+    bn_digit *sa = t, *sb = t + h + 1, *z1 = t + 2 * (h + 1);
+
+    mag_mul(mrb, r, a, h, b, h);                      /* z0 = a0*b0 */
+    mag_mul(mrb, r + 2 * h, a + h, a1n, b + h, b1n);  /* z2 = a1*b1 */
+    mag_add(sa, a, h, a + h, a1n);
+    mag_add(sb, b, h, b + h, b1n);
+    mag_mul(mrb, z1, sa, h + 1, sb, h + 1);
+    mag_sub_from(z1, 2 * (h + 1), r, 2 * h);
+    mag_sub_from(z1, 2 * (h + 1), r + 2 * h, an + bn - 2 * h);
+    mag_add_to(r + h, an + bn - h, z1, mag_trim(z1, 2 * (h + 1)));
+    mrb_free(mrb, t);
+  }
+}
+
+/* q[0..an) = a / d; returns a % d (q may be a) */
+static bn_digit
+mag_divmod_1(bn_digit *q, const bn_digit *a, size_t an, bn_digit d)
+{
+  bn_ddigit rem = 0;
+
+  while (an--) {
+    rem = (rem << BN_DIGIT_BIT) | a[an];
+    q[an] = (bn_digit)(rem / d);
+    rem %= d;
+  }
+  return (bn_digit)rem;
+}
+
+static int
+nlz(bn_digit x)
+{
+  int n = 0;
+
+  if (x == 0) return BN_DIGIT_BIT;
+  while (!(x & 0x80000000)) {
+    x <<= 1;
+    n++;
+  }
+  return n;
+}
+
+/*
+ * q[0..an-bn] = a / b, r[0..bn) = a % b (Knuth, TAOCP vol.2 4.3.1 D).
+ * Requires an >= bn >= 2 and b[bn-1] != 0.
+ */
+static void
+mag_divmod_knuth(mrb_state *mrb, bn_digit *q, bn_digit *r, const bn_digit *a, size_t an, const bn_digit *b, size_t bn)
+{
+  int s = nlz(b[bn-1]);
+  bn_digit *un = (bn_digit *)mrb_malloc(mrb, sizeof(bn_digit) * (an + 1 + bn));
+  bn_digit *vn = un + an + 1;
+  size_t i, j;
+
+  for (i = bn - 1; i > 0; i--) {
+    vn[i] = (b[i] << s) | (s ? b[i-1] >> (BN_DIGIT_BIT - s) : 0);
+  }
+  vn[0] = b[0] << s;
+  un[an] = s ? a[an-1] >> (BN_DIGIT_BIT - s) : 0;
+  for (i = an - 1; i > 0; i--) {
+    un[i] = (a[i] << s) | (s ? a[i-1] >> (BN_DIGIT_BIT - s) : 0);
+  }
+  un[0] = a[0] << s;
+
+  j = an - bn + 1;
+  while (j-- > 0) {
+    bn_ddigit num = ((bn_ddigit)un[j+bn] << BN_DIGIT_BIT) | un[j+bn-1];
+    bn_ddigit qhat = num / vn[bn-1];
+    bn_ddigit rhat = num % vn[bn-1];
+    int64_t k, t;
+
+    while (qhat >> BN_DIGIT_BIT ||
+           qhat * vn[bn-2] > ((rhat << BN_DIGIT_BIT) | un[j+bn-2])) {
+      qhat--;
+      rhat += vn[bn-1];
+      if (rhat >> BN_DIGIT_BIT) break;
+    }
+
+    /* multiply and subtract */
+    k = 0;
+    for (i = 0; i < bn; i++) {
+      bn_ddigit p = qhat * vn[i];
+      t = (int64_t)un[i+j] - k - (int64_t)(p & 0xffffffff);
+      un[i+j] = (bn_digit)t;
+      k = (int64_t)(p >> BN_DIGIT_BIT) - (t >> BN_DIGIT_BIT);
+    }
+    t = (int64_t)un[j+bn] - k;
+    un[j+bn] = (bn_digit)t;
+
+    q[j] = (bn_digit)qhat;
+    if (t < 0) {
+      /* add back */
+      bn_ddigit c = 0;
+
+      q[j]--;
+      for (i = 0; i < bn; i++) {
+        c += (bn_ddigit)un[i+j] + vn[i];
+        un[i+j] = (bn_digit)c;
+        c >>= BN_DIGIT_BIT;
+      }
+      un[j+bn] += (bn_digit)c;
+    }
+  }
+
+  for (i = 0; i < bn; i++) {
+    r[i] = (un[i] >> s) | (s ? un[i+1] << (BN_DIGIT_BIT - s) : 0);
+  }
+  mrb_free(mrb, un);
+}
+
+/*
+ * q[0..an-bn] = a / b, r[0..bn) = a % b for trimmed a, b with an >= bn >= 1.
+ */
+static void
+mag_divmod(mrb_state *mrb, bn_digit *q, bn_digit *r, const bn_digit *a, size_t an, const bn_digit *b, size_t bn)
+{
+  if (bn == 1) {
+    r[0] = mag_divmod_1(q, a, an, b[0]);
+  }
+  else {
+    mag_divmod_knuth(mrb, q, r, a, an, b, bn);
+  }
+}
+
+static size_t
+mag_bit_length(const bn_digit *d, size_t len)
+{
+  len = mag_trim(d, len);
+  if (len == 0) return 0;
+  return len * BN_DIGIT_BIT - nlz(d[len-1]);
+}
+
+/* ------------------------------------------------------------------------*/
+
+static void
+view_fixnum(struct bn_view *x, mrb_int i)
+{
+  uint64_t v;
+
+  x->neg = i < 0;
+  v = x->neg ? (uint64_t)(-(i + 1)) + 1 : (uint64_t)i;
+  x->buf[0] = (bn_digit)v;
+  x->buf[1] = (bn_digit)(v >> BN_DIGIT_BIT);
+  x->d = x->buf;
+  x->len = mag_trim(x->buf, 2);
+}
+
+static mrb_bool
+int_view(mrb_value v, struct bn_view *x)
+{
+  if (mrb_fixnum_p(v)) {
+    view_fixnum(x, mrb_fixnum(v));
+    return TRUE;
+  }
+  if (bn_p(v)) {
+    struct bignum *b = (struct bignum *)DATA_PTR(v);
+
+    x->d = b->d;
+    x->len = b->len;
+    x->neg = b->neg;
+    return TRUE;
+  }
+  return FALSE;
+}
+
+static void
+get_view(mrb_state *mrb, mrb_value v, struct bn_view *x)
+{
+  if (!int_view(v, x)) {
+    mrb_raise(mrb, E_TYPE_ERROR, "expected Integer");
+  }
+}
+
+/* allocates a zero cleared Bignum of len digits */
+static struct bignum *
+bn_alloc(mrb_state *mrb, size_t len, mrb_value *obj)
+{
+  struct RData *data;
+  struct bignum *b;
+
+  if (len > BN_MAX_BITS / BN_DIGIT_BIT) {
+    mrb_raise(mrb, E_RANGE_ERROR, "bignum too big");
+  }
+  data = Data_Wrap_Struct(mrb, mrb->bignum_class, &bignum_type, NULL);
+  *obj = mrb_obj_value(data);
+  b = (struct bignum *)mrb_malloc(mrb, sizeof(struct bignum) + sizeof(bn_digit) * (len ? len : 1));
+  memset(b->d, 0, sizeof(bn_digit) * len);
+  b->len = len;
+  b->neg = FALSE;
+  data->data = b;
+  return b;
+}
+
+/* normalizes the Bignum in obj, demoting it to a Fixnum if possible */
+static mrb_value
+bn_norm(mrb_value obj)
+{
+  struct bignum *b = (struct bignum *)DATA_PTR(obj);
+  uint64_t v;
+
+  b->len = mag_trim(b->d, b->len);
+  if (b->len > 2) return obj;
+  v = b->len == 0 ? 0 : b->d[0];
+  if (b->len == 2) v |= (bn_ddigit)b->d[1] << BN_DIGIT_BIT;
+  if (b->neg) {
+    if (v - 1 <= (uint64_t)(-(MRB_FIXNUM_MIN + 1)) || v == 0) {
+      return mrb_fixnum_value(v == 0 ? 0 : -(mrb_int)(v - 1) - 1);
+    }
+  }
+  else if (v <= (uint64_t)MRB_FIXNUM_MAX) {
+    return mrb_fixnum_value((mrb_int)v);
+  }
+  return obj;
+}
+
+static mrb_value
+bn_from_mag(mrb_state *mrb, const bn_digit *d, size_t len, mrb_bool neg)
+{
+  mrb_value obj;
+  struct bignum *b = bn_alloc(mrb, len, &obj);
+
+  memcpy(b->d, d, sizeof(bn_digit) * len);
+  b->neg = neg;
+  return bn_norm(obj);
+}
+
+static mrb_float
+bn_to_flo(const struct bn_view *x)
+{
+  mrb_float f = 0.0;
+  size_t i = x->len;
+
+  while (i--) {
+    f = f * 4294967296.0 + x->d[i];
+  }
+  return x->neg ? -f : f;
+}
+
+static mrb_value
+bn_from_flo(mrb_state *mrb, mrb_float f)
+{
+  mrb_value obj;
+  struct bignum *b;
+  mrb_bool neg = f < 0;
+  int e;
+  size_t len, i;
+
+  if (isinf(f)) {
+    mrb_raise(mrb, E_FLOATDOMAIN_ERROR, f < 0 ? "-Infinity" : "Infinity");
+  }
+  if (isnan(f)) {
+    mrb_raise(mrb, E_FLOATDOMAIN_ERROR, "NaN");
+  }
+  f = trunc(fabs(f));
+  frexp(f, &e);
+  len = e <= 0 ? 0 : (size_t)e / BN_DIGIT_BIT + 1;
+  b = bn_alloc(mrb, len, &obj);
+  b->neg = neg;
+  for (i = len; i-- > 0;) {
+    mrb_float unit = ldexp(1.0, (int)i * BN_DIGIT_BIT);
+    mrb_float digit = floor(f / unit);
+
+    b->d[i] = (bn_digit)digit;
+    f -= digit * unit;
+  }
+  return bn_norm(obj);
+}
+
+static mrb_value
+bn_add(mrb_state *mrb, const struct bn_view *x, const struct bn_view *y, mrb_bool sub)
+{
+  mrb_value obj;
+  struct bignum *r;
+  mrb_bool yneg = y->neg ^ sub;
+
+  if (x->neg == yneg) {
+    r = bn_alloc(mrb, (x->len > y->len ? x->len : y->len) + 1, &obj);
+    mag_add(r->d, x->d, x->len, y->d, y->len);
+    r->neg = x->neg;
+  }
+  else if (mag_cmp(x->d, x->len, y->d, y->len) >= 0) {
+    r = bn_alloc(mrb, x->len, &obj);
+    mag_sub(r->d, x->d, x->len, y->d, y->len);
+    r->neg = x->neg;
+  }
+  else {
+    r = bn_alloc(mrb, y->len, &obj);
+    mag_sub(r->d, y->d, y->len, x->d, x->len);
+    r->neg = yneg;
+  }
+  return bn_norm(obj);
+}
+
+static mrb_value
+bn_mul(mrb_state *mrb, const struct bn_view *x, const struct bn_view *y)
+{
+  mrb_value obj;
+  struct bignum *r = bn_alloc(mrb, x->len + y->len, &obj);
+
+  mag_mul(mrb, r->d, x->d, x->len, y->d, y->len);
+  r->neg = x->neg != y->neg;
+  return bn_norm(obj);
+}
+
+/* floored division; y must not be zero */
+static void
+bn_divmod(mrb_state *mrb, const struct bn_view *x, const struct bn_view *y, mrb_value *divp, mrb_value *modp)
+{
+  mrb_value qobj, robj;
+  struct bignum *q, *r;
+
+  /* one extra quotient digit for the rounding below */
+  r = bn_alloc(mrb, y->len, &robj);
+  if (x->len < y->len) {
+    q = bn_alloc(mrb, 1, &qobj);
+    memcpy(r->d, x->d, sizeof(bn_digit) * x->len);
+  }
+  else {
+    q = bn_alloc(mrb, x->len - y->len + 2, &qobj);
+    mag_divmod(mrb, q->d, r->d, x->d, x->len, y->d, y->len);
+  }
+  q->neg = x->neg != y->neg;
+  r->neg = y->neg;
+  if (q->neg && mag_trim(r->d, r->len) > 0) {
+    /* round the quotient towards negative infinity */
+    static const bn_digit one = 1;
+    bn_digit *t = (bn_digit *)mrb_malloc(mrb, sizeof(bn_digit) * y->len);
+
+    mag_add_to(q->d, q->len, &one, 1);
+    mag_sub(t, y->d, y->len, r->d, r->len);
+    memcpy(r->d, t, sizeof(bn_digit) * y->len);
+    mrb_free(mrb, t);
+  }
+  if (divp) *divp = bn_norm(qobj);
+  if (modp) *modp = bn_norm(robj);
+}
+
+static mrb_bool
+view_zero_p(const struct bn_view *x)
+{
+  return x->len == 0;
+}
+
+/* x ** e for e >= 0 */
+static mrb_value
+bn_pow(mrb_state *mrb, const struct bn_view *x, mrb_int e)
+{
+  size_t bits, cap, rlen;
+  bn_digit *r, *t, *tmp;
+  mrb_value obj;
+  struct bignum *b;
+  mrb_bool started = FALSE;
+  int i;
+
+  if (e == 0) return mrb_fixnum_value(1);
+  if (x->len == 0) return mrb_fixnum_value(0);
+  if (x->len == 1 && x->d[0] == 1) {
+    return mrb_fixnum_value(x->neg && (e & 1) ? -1 : 1);
+  }
+  bits = mag_bit_length(x->d, x->len);
+  if ((mrb_float)bits * e > BN_MAX_BITS) {
+    /* too big to represent; follows Float semantics */
+    return mrb_float_value(mrb, pow(bn_to_flo(x), (mrb_float)e));
+  }
+  cap = (bits * e) / BN_DIGIT_BIT + 2;
+  r = (bn_digit *)mrb_malloc(mrb, sizeof(bn_digit) * cap * 2);
+  t = r + cap;
+  rlen = 0;
+  for (i = MRB_INT_BIT - 1; i >= 0; i--) {
+    if (!started) {
+      if ((e >> i) & 1) {
+        memcpy(r, x->d, sizeof(bn_digit) * x->len);
+        rlen = x->len;
+        started = TRUE;
+      }
+      continue;
+    }
+    memset(t, 0, sizeof(bn_digit) * rlen * 2);
+    mag_mul(mrb, t, r, rlen, r, rlen);
+    rlen = mag_trim(t, rlen * 2);
+    tmp = r; r = t; t = tmp;
+    if ((e >> i) & 1) {
+      memset(t, 0, sizeof(bn_digit) * (rlen + x->len));
+      mag_mul(mrb, t, r, rlen, x->d, x->len);
+      rlen = mag_trim(t, rlen + x->len);
+      tmp = r; r = t; t = tmp;
+    }
+  }
+  b = bn_alloc(mrb, rlen, &obj);
+  memcpy(b->d, r, sizeof(bn_digit) * rlen);
+  b->neg = x->neg && (e & 1);
+  mrb_free(mrb, r < t ? r : t);
+  return bn_norm(obj);
+}
+
+/* (x ** e) % m for e >= 0, m != 0 */
+static mrb_value
+bn_modpow(mrb_state *mrb, const struct bn_view *x, const struct bn_view *e, const struct bn_view *m)
+{
+  size_t mlen = m->len, rlen, i;
+  bn_digit *base, *r, *prod, *q;
+  mrb_value obj;
+  struct bignum *b;
+  mrb_bool started = FALSE;
+
+  base = (bn_digit *)mrb_calloc(mrb, mlen * 5 + 1, sizeof(bn_digit));
+  r = base + mlen;
+  prod = r + mlen;
+  q = prod + 2 * mlen;
+
+  /* base = |x| % |m| */
+  if (mag_cmp(x->d, x->len, m->d, mlen) < 0) {
+    memcpy(base, x->d, sizeof(bn_digit) * x->len);
+  }
+  else {
+    bn_digit *xq = (bn_digit *)mrb_malloc(mrb, sizeof(bn_digit) * (x->len - mlen + 1));
+    mag_divmod(mrb, xq, base, x->d, x->len, m->d, mlen);
+    mrb_free(mrb, xq);
+  }
+
+  /* r = 1 % |m| */
+  r[0] = (mlen == 1 && m->d[0] == 1) ? 0 : 1;
+  for (i = e->len; i-- > 0;) {
+    int bit;
+
+    for (bit = BN_DIGIT_BIT - 1; bit >= 0; bit--) {
+      int set = (e->d[i] >> bit) & 1;
+
+      if (started) {
+        memset(prod, 0, sizeof(bn_digit) * 2 * mlen);
+        mag_mul(mrb, prod, r, mlen, r, mlen);
+        rlen = mag_trim(prod, 2 * mlen);
+        if (rlen >= mlen) mag_divmod(mrb, q, r, prod, rlen, m->d, mlen);
+        else { memset(r, 0, sizeof(bn_digit) * mlen); memcpy(r, prod, sizeof(bn_digit) * rlen); }
+      }
+      if (set) {
+        memset(prod, 0, sizeof(bn_digit) * 2 * mlen);
+        mag_mul(mrb, prod, r, mlen, base, mlen);
+        rlen = mag_trim(prod, 2 * mlen);
+        if (rlen >= mlen) mag_divmod(mrb, q, r, prod, rlen, m->d, mlen);
+        else { memset(r, 0, sizeof(bn_digit) * mlen); memcpy(r, prod, sizeof(bn_digit) * rlen); }
+        started = TRUE;
+      }
+    }
+  }
+
+  b = bn_alloc(mrb, mlen, &obj);
+  rlen = mag_trim(r, mlen);
+  if (rlen > 0 && x->neg && e->len > 0 && (e->d[0] & 1)) {
+    /* x ** e is negative */
+    mag_sub(b->d, m->d, mlen, r, rlen);
+  }
+  else {
+    memcpy(b->d, r, sizeof(bn_digit) * mlen);
+  }
+  if (m->neg && mag_trim(b->d, mlen) > 0) {
+    memcpy(r, b->d, sizeof(bn_digit) * mlen);
+    mag_sub(b->d, m->d, mlen, r, mlen);
+    b->neg = TRUE;
+  }
+  mrb_free(mrb, base);
+  return bn_norm(obj);
+}
+
+/* ------------------------------------------------------------------------*/
+/* bitwise operations use two's complement representation */
+
+static void
+twos_negate(bn_digit *d, size_t n)
+{
+  bn_ddigit carry = 1;
+  size_t i;
+
+  for (i = 0; i < n; i++) {
+    carry += (bn_digit)~d[i];
+    d[i] = (bn_digit)carry;
+    carry >>= BN_DIGIT_BIT;
+  }
+}
+
+static void
+to_twos(bn_digit *dst, const struct bn_view *x, size_t n)
+{
+  memcpy(dst, x->d, sizeof(bn_digit) * x->len);
+  memset(dst + x->len, 0, sizeof(bn_digit) * (n - x->len));
+  if (x->neg) twos_negate(dst, n);
+}
+
+static mrb_value
+bn_bitop(mrb_state *mrb, const struct bn_view *x, const struct bn_view *y, char op)
+{
+  size_t n = (x->len > y->len ? x->len : y->len) + 1, i;
+  bn_digit *tx = (bn_digit *)mrb_malloc(mrb, sizeof(bn_digit) * n * 2);
+  bn_digit *ty = tx + n;
+  mrb_value obj;
+  struct bignum *r = bn_alloc(mrb, n, &obj);
+
+  to_twos(tx, x, n);
+  to_twos(ty, y, n);
+  for (i = 0; i < n; i++) {
+    switch (op) {
+    case '&': r->d[i] = tx[i] & ty[i]; break;
+    case '|': r->d[i] = tx[i] | ty[i]; break;
+    default:  r->d[i] = tx[i] ^ ty[i]; break;
+    }
+  }
+  mrb_free(mrb, tx);
+  if (r->d[n-1] >> (BN_DIGIT_BIT - 1)) {
+    twos_negate(r->d, n);
+    r->neg = TRUE;
+  }
+  return bn_norm(obj);
+}
+
+static mrb_value
+bn_lshift(mrb_state *mrb, const struct bn_view *x, mrb_int width)
+{
+  size_t words, bits, i;
+  mrb_value obj;
+  struct bignum *r;
+
+  if (x->len == 0) return mrb_fixnum_value(0);
+  if (width > BN_MAX_BITS) {
+    mrb_raise(mrb, E_RANGE_ERROR, "shift width too big");
+  }
+  words = (size_t)width / BN_DIGIT_BIT;
+  bits = (size_t)width % BN_DIGIT_BIT;
+  r = bn_alloc(mrb, x->len + words + 1, &obj);
+  for (i = 0; i < x->len; i++) {
+    r->d[i+words] |= x->d[i] << bits;
+    if (bits) r->d[i+words+1] = x->d[i] >> (BN_DIGIT_BIT - bits);
+  }
+  r->neg = x->neg;
+  return bn_norm(obj);
+}
+
+/* floored (arithmetic) right shift */
+static mrb_value
+bn_rshift(mrb_state *mrb, const struct bn_view *x, mrb_int width)
+{
+  size_t words, bits, i;
+  mrb_value obj;
+  struct bignum *r;
+  mrb_bool lost = FALSE;
+
+  if ((mrb_float)width >= (mrb_float)x->len * BN_DIGIT_BIT) {
+    return mrb_fixnum_value(x->neg ? -1 : 0);
+  }
+  words = (size_t)width / BN_DIGIT_BIT;
+  bits = (size_t)width % BN_DIGIT_BIT;
+  for (i = 0; i < words; i++) {
+    if (x->d[i]) lost = TRUE;
+  }
+  if (bits && (x->d[words] << (BN_DIGIT_BIT - bits))) lost = TRUE;
+  r = bn_alloc(mrb, x->len - words + 1, &obj);
+  for (i = words; i < x->len; i++) {
+    r->d[i-words] = x->d[i] >> bits;
+    if (bits && i + 1 < x->len) r->d[i-words] |= x->d[i+1] << (BN_DIGIT_BIT - bits);
+  }
+  r->neg = x->neg;
+  if (x->neg && lost) {
+    static const bn_digit one = 1;
+    mag_add_to(r->d, r->len, &one, 1);
+  }
+  return bn_norm(obj);
+}
+
+/* ------------------------------------------------------------------------*/
+/* radix conversion */
+
+struct bn_power {
+  bn_digit *d;
+  size_t len;
+};
+
+struct bn_tostr {
+  mrb_state *mrb;
+  struct bn_power *powers;
+  bn_digit chunk;        /* base ** digits */
+  int digits;            /* characters per chunk */
+  int base;
+};
+
+/*
+ * Writes x (destroyed) in radix backwards ending at end, zero padded to
+ * pad characters.  Returns the start of the written characters.
+ */
+static char*
+tostr_rec(struct bn_tostr *c, bn_digit *x, size_t xlen, int level, char *end, size_t pad)
+{
+  char *p = end;
+
+  xlen = mag_trim(x, xlen);
+  while (level >= 0 && c->powers[level].len > (xlen + 1) / 2) level--;
+  if (level < 0 || xlen < BN_TOSTR_CUTOFF) {
+    while (xlen > 0) {
+      bn_digit rem = mag_divmod_1(x, x, xlen, c->chunk);
+      int i;
+
+      for (i = 0; i < c->digits; i++) {
+        *--p = mrb_digitmap[rem % c->base];
+        rem /= c->base;
+      }
+      xlen = mag_trim(x, xlen);
+    }
+  }
+  else {
+    struct bn_power *pw = &c->powers[level];
+    size_t lo = (size_t)c->digits << level;
+    bn_digit *q = (bn_digit *)mrb_calloc(c->mrb, xlen + 1, sizeof(bn_digit));
+    bn_digit *r = q + (xlen - pw->len + 1);
+
+    mag_divmod(c->mrb, q, r, x, xlen, pw->d, pw->len);
+    p = tostr_rec(c, r, pw->len, level - 1, p, lo);
+    p = tostr_rec(c, q, xlen - pw->len + 1, level - 1, p, pad > lo ? pad - lo : 0);
+    mrb_free(c->mrb, q);
+  }
+  while ((size_t)(end - p) < pad) *--p = '0';
+  return p;
+}
+
+static mrb_value
+bn_to_s(mrb_state *mrb, const struct bn_view *x, int base)
+{
+  size_t bits = mag_bit_length(x->d, x->len);
+  int shift = 0;
+  size_t cap;
+  char *buf, *end, *p;
+  mrb_value str;
+
+  if (base < 2 || 36 < base) {
+    mrb_raisef(mrb, E_ARGUMENT_ERROR, "invalid radix %S", mrb_fixnum_value(base));
+  }
+  while ((1 << (shift + 1)) <= base) shift++;
+  /* chunks are written zero padded, so leave room for one extra chunk */
+  cap = bits / shift + BN_DIGIT_BIT + 2;
+  buf = (char *)mrb_malloc(mrb, cap + 1);
+  end = buf + cap + 1;
+
+  if ((1 << shift) == base) {
+    /* power of two: extract bits directly */
+    size_t pos;
+
+    p = end;
+    for (pos = 0; pos < bits; pos += shift) {
+      size_t w = pos / BN_DIGIT_BIT, b = pos % BN_DIGIT_BIT;
+      bn_ddigit v = x->d[w] >> b;
+
+      if (b + shift > BN_DIGIT_BIT && w + 1 < x->len) {
+        v |= (bn_ddigit)x->d[w+1] << (BN_DIGIT_BIT - b);
+      }
+      *--p = mrb_digitmap[v & (base - 1)];
+    }
+  }
+  else {
+    struct bn_tostr c;
+    bn_digit *t;
+    int levels = 0, i;
+
+    c.mrb = mrb;
+    c.base = base;
+    c.chunk = base;
+    c.digits = 1;
+    while ((bn_ddigit)c.chunk * base <= 0xffffffff) {
+      c.chunk *= base;
+      c.digits++;
+    }
+
+    /* powers[i] = chunk ** (2 ** i) */
+    c.powers = (struct bn_power *)mrb_malloc(mrb, sizeof(struct bn_power) * BN_DIGIT_BIT * 2);
+    c.powers[0].d = (bn_digit *)mrb_malloc(mrb, sizeof(bn_digit));
+    c.powers[0].d[0] = c.chunk;
+    c.powers[0].len = 1;
+    levels = 1;
+    if (x->len >= BN_TOSTR_CUTOFF) {
+      while (c.powers[levels-1].len * 2 <= x->len + 1) {
+        struct bn_power *prev = &c.powers[levels-1];
+        size_t n = prev->len * 2;
+
+        c.powers[levels].d = (bn_digit *)mrb_calloc(mrb, n, sizeof(bn_digit));
+        mag_mul(mrb, c.powers[levels].d, prev->d, prev->len, prev->d, prev->len);
+        c.powers[levels].len = mag_trim(c.powers[levels].d, n);
+        levels++;
+      }
+    }
+
+    t = (bn_digit *)mrb_malloc(mrb, sizeof(bn_digit) * (x->len ? x->len : 1));
+    memcpy(t, x->d, sizeof(bn_digit) * x->len);
+    p = tostr_rec(&c, t, x->len, levels - 1, end, 0);
+    mrb_free(mrb, t);
+    for (i = 0; i < levels; i++) {
+      mrb_free(mrb, c.powers[i].d);
+    }
+    mrb_free(mrb, c.powers);
+  }
+
+  while (p < end - 1 && *p == '0') p++;
+  if (p == end) *--p = '0';
+  if (x->neg) *--p = '-';
+  str = mrb_str_new(mrb, p, end - p);
+  mrb_free(mrb, buf);
+  return str;
+}
+
+/* ------------------------------------------------------------------------*/
+
+static mrb_value
+bn_int_overflow(mrb_state *mrb, int op, mrb_int a, mrb_int b)
+{
+  struct bn_view x, y;
+
+  view_fixnum(&x, a);
+  view_fixnum(&y, b);
+  switch (op) {
+  case '+':
+    return bn_add(mrb, &x, &y, FALSE);
+  case '-':
+    return bn_add(mrb, &x, &y, TRUE);
+  default:
+    return bn_mul(mrb, &x, &y);
+  }
+}
+
+/* mrb->int_read: digits go in a digit-sized chunk at a time */
+static mrb_value
+bn_int_read(mrb_state *mrb, const char *p, const char *end, int base, mrb_bool neg)
+{
+  mrb_value obj;
+  struct bignum *b;
+  size_t len = 0, i;
+
+  if (base == 0) {
+    /* little endian magnitude bytes from the pool (see codegen.c) */
+    b = bn_alloc(mrb, (end - p + sizeof(bn_digit) - 1) / sizeof(bn_digit), &obj);
+    for (i = 0; p + i < end; i++) {
+      b->d[i / sizeof(bn_digit)] |= (bn_digit)(unsigned char)p[i] << (i % sizeof(bn_digit) * 8);
+    }
+    b->neg = neg;
+    return bn_norm(obj);
+  }
+  /* a digit adds at most 6 bits */
+  b = bn_alloc(mrb, (end - p) * 6 / BN_DIGIT_BIT + 1, &obj);
+  while (p < end) {
+    bn_ddigit chunk = 0, scale = 1;
+
+    for (; p < end && scale <= (bn_digit)-1 / base; p++) {
+      int c;
+
+      if (*p == '_') continue;
+      c = ISDIGIT(*p) ? *p - '0' : ISALPHA(*p) ? TOLOWER(*p) - 'a' + 10 : 36;
+      if (c >= base) {
+        end = p;
+        break;
+      }
+      chunk = chunk * base + c;
+      scale *= base;
+    }
+    for (i = 0; i < len; i++) {
+      chunk += b->d[i] * scale;
+      b->d[i] = (bn_digit)chunk;
+      chunk >>= BN_DIGIT_BIT;
+    }
+    if (chunk) b->d[len++] = (bn_digit)chunk;
+  }
+  b->neg = neg;
+  return bn_norm(obj);
+}
+
+static int
+bn_cmp(const struct bn_view *x, const struct bn_view *y)
+{
+  int c;
+
+  if (x->neg != y->neg) return x->neg ? -1 : 1;
+  c = mag_cmp(x->d, x->len, y->d, y->len);
+  return x->neg ? -c : c;
+}
+
+static mrb_value
+int_plus(mrb_state *mrb, mrb_value self)
+{
+  mrb_value other;
+  struct bn_view x, y;
+
+  mrb_get_args(mrb, "o", &other);
+  if (mrb_fixnum_p(self) && !bn_p(other)) {
+    return mrb_fixnum_plus(mrb, self, other);
+  }
+  get_view(mrb, self, &x);
+  if (!int_view(other, &y)) {
+    return mrb_float_value(mrb, bn_to_flo(&x) + mrb_to_flo(mrb, other));
+  }
+  return bn_add(mrb, &x, &y, FALSE);
+}
+
+static mrb_value
+int_minus(mrb_state *mrb, mrb_value self)
+{
+  mrb_value other;
+  struct bn_view x, y;
+
+  mrb_get_args(mrb, "o", &other);
+  if (mrb_fixnum_p(self) && !bn_p(other)) {
+    return mrb_fixnum_minus(mrb, self, other);
+  }
+  get_view(mrb, self, &x);
+  if (!int_view(other, &y)) {
+    return mrb_float_value(mrb, bn_to_flo(&x) - mrb_to_flo(mrb, other));
+  }
+  return bn_add(mrb, &x, &y, TRUE);
+}
+
+static mrb_value
+int_mul(mrb_state *mrb, mrb_value self)
+{
+  mrb_value other;
+  struct bn_view x, y;
+
+  mrb_get_args(mrb, "o", &other);
+  if (mrb_fixnum_p(self) && !bn_p(other)) {
+    return mrb_fixnum_mul(mrb, self, other);
+  }
+  get_view(mrb, self, &x);
+  if (!int_view(other, &y)) {
+    return mrb_float_value(mrb, bn_to_flo(&x) * mrb_to_flo(mrb, other));
+  }
+  return bn_mul(mrb, &x, &y);
+}
+
+/*
+ *  call-seq:
+ *     big / numeric  ->  float
+ *
+ *  Performs division.  As with Fixnum, the result is a Float;
+ *  use <code>div</code> for integer division.
+ */
+static mrb_value
+big_div(mrb_state *mrb, mrb_value self)
+{
+  mrb_value other;
+  struct bn_view x;
+
+  mrb_get_args(mrb, "o", &other);
+  get_view(mrb, self, &x);
+  return mrb_float_value(mrb, bn_to_flo(&x) / mrb_to_flo(mrb, other));
+}
+
+/* floored division of Fixnums; FALSE if the quotient overflows */
+static mrb_bool
+fix_divmod(mrb_int x, mrb_int y, mrb_int *divp, mrb_int *modp)
+{
+  mrb_int div, mod;
+
+  if (y == -1 && x == MRB_FIXNUM_MIN) return FALSE;
+  div = x / y;
+  mod = x % y;
+  if (mod != 0 && ((mod < 0) != (y < 0))) {
+    mod += y;
+    div -= 1;
+  }
+  *divp = div;
+  *modp = mod;
+  return TRUE;
+}
+
+/* returns FALSE if the operands can't be divided as integers */
+static mrb_bool
+int_divmod_args(mrb_state *mrb, mrb_value self, mrb_value other, struct bn_view *x, struct bn_view *y)
+{
+  get_view(mrb, self, x);
+  if (!int_view(other, y)) return FALSE;
+  return !view_zero_p(y);
+}
+
+/*
+ *  call-seq:
+ *     int.div(integer)  ->  integer
+ *
+ *  Integer division rounded towards negative infinity.
+ */
+static mrb_value
+int_idiv(mrb_state *mrb, mrb_value self)
+{
+  mrb_value other, div;
+  struct bn_view x, y;
+
+  mrb_int d, m;
+
+  mrb_get_args(mrb, "o", &other);
+  if (mrb_fixnum_p(self) && mrb_fixnum_p(other) && mrb_fixnum(other) != 0 &&
+      fix_divmod(mrb_fixnum(self), mrb_fixnum(other), &d, &m)) {
+    return mrb_fixnum_value(d);
+  }
+  if (!int_divmod_args(mrb, self, other, &x, &y)) {
+    return mrb_funcall(mrb, mrb_float_value(mrb, bn_to_flo(&x) / mrb_to_flo(mrb, other)), "floor", 0);
+  }
+  bn_divmod(mrb, &x, &y, &div, NULL);
+  return div;
+}
+
+static mrb_value
+int_mod(mrb_state *mrb, mrb_value self)
+{
+  mrb_value other, mod;
+  struct bn_view x, y;
+  mrb_int d, m;
+
+  mrb_get_args(mrb, "o", &other);
+  if (mrb_fixnum_p(self) && mrb_fixnum_p(other) && mrb_fixnum(other) != 0 &&
+      fix_divmod(mrb_fixnum(self), mrb_fixnum(other), &d, &m)) {
+    return mrb_fixnum_value(m);
+  }
+  if (!int_divmod_args(mrb, self, other, &x, &y)) {
+    return mrb_funcall(mrb, mrb_float_value(mrb, bn_to_flo(&x)), "%", 1, other);
+  }
+  bn_divmod(mrb, &x, &y, NULL, &mod);
+  return mod;
+}
+
+static mrb_value
+int_divmod(mrb_state *mrb, mrb_value self)
+{
+  mrb_value other, div, mod;
+  struct bn_view x, y;
+  mrb_int d, m;
+
+  mrb_get_args(mrb, "o", &other);
+  if (mrb_fixnum_p(self) && mrb_fixnum_p(other) && mrb_fixnum(other) != 0 &&
+      fix_divmod(mrb_fixnum(self), mrb_fixnum(other), &d, &m)) {
+    return mrb_assoc_new(mrb, mrb_fixnum_value(d), mrb_fixnum_value(m));
+  }
+  if (!int_divmod_args(mrb, self, other, &x, &y)) {
+    if (mrb_fixnum_p(other) || bn_p(other)) {
+      return mrb_assoc_new(mrb, mrb_float_value(mrb, INFINITY), mrb_float_value(mrb, NAN));
+    }
+    return mrb_funcall(mrb, mrb_float_value(mrb, bn_to_flo(&x)), "divmod", 1, other);
+  }
+  bn_divmod(mrb, &x, &y, &div, &mod);
+  return mrb_assoc_new(mrb, div, mod);
+}
+
+/*
+ *  call-seq:
+ *     int ** numeric       ->  numeric
+ *     int.pow(numeric)     ->  numeric
+ *     int.pow(int, mod)    ->  integer
+ *
+ *  Raises <i>int</i> to the power of <i>numeric</i>.  With a modulus,
+ *  returns <code>(int ** numeric) % mod</code> computed without
+ *  building the full power.
+ */
+static mrb_value
+int_pow(mrb_state *mrb, mrb_value self)
+{
+  mrb_value e, m;
+  struct bn_view x, ev, mv;
+  int argc;
+
+  argc = mrb_get_args(mrb, "o|o", &e, &m);
+  get_view(mrb, self, &x);
+  if (argc == 2) {
+    if (!int_view(e, &ev) || !int_view(m, &mv)) {
+      mrb_raise(mrb, E_TYPE_ERROR, "Integer#pow() with modulus requires Integer arguments");
+    }
+    if (ev.neg) {
+      mrb_raise(mrb, E_RANGE_ERROR, "Integer#pow() 1st argument cannot be negative when 2nd argument specified");
+    }
+    if (view_zero_p(&mv)) {
+      mrb_raise(mrb, E_ARGUMENT_ERROR, "divided by 0");
+    }
+    return bn_modpow(mrb, &x, &ev, &mv);
+  }
+  if (mrb_fixnum_p(e) && mrb_fixnum(e) >= 0) {
+    if (mrb_fixnum_p(self)) {
+      /* try without leaving Fixnum range first */
+      mrb_int base = mrb_fixnum(self), n = mrb_fixnum(e), r = 1;
+
+      for (;;) {
+        if ((n & 1) && mrb_int_mul_overflow(r, base, &r)) break;
+        n >>= 1;
+        if (n == 0) return mrb_fixnum_value(r);
+        if (mrb_int_mul_overflow(base, base, &base)) break;
+      }
+    }
+    return bn_pow(mrb, &x, mrb_fixnum(e));
+  }
+  if (bn_p(e) && !((struct bignum *)DATA_PTR(e))->neg) {
+    /* only trivial bases stay representable */
+    if (x.len == 0 || (x.len == 1 && x.d[0] == 1)) {
+      if (x.neg && (((struct bignum *)DATA_PTR(e))->d[0] & 1)) return mrb_fixnum_value(-1);
+      return mrb_fixnum_value(x.len);
+    }
+  }
+  return mrb_float_value(mrb, pow(bn_to_flo(&x), mrb_to_flo(mrb, e)));
+}
+
+static mrb_value
+int_bitop(mrb_state *mrb, mrb_value self, char op)
+{
+  mrb_value other;
+  struct bn_view x, y;
+
+  mrb_get_args(mrb, "o", &other);
+  if (mrb_fixnum_p(self) && mrb_fixnum_p(other)) {
+    mrb_int a = mrb_fixnum(self), b = mrb_fixnum(other);
+
+    switch (op) {
+    case '&': return mrb_fixnum_value(a & b);
+    case '|': return mrb_fixnum_value(a | b);
+    default:  return mrb_fixnum_value(a ^ b);
+    }
+  }
+  if (mrb_float_p(other)) {
+    mrb_raise(mrb, E_TYPE_ERROR, "can't convert Float into Integer");
+  }
+  get_view(mrb, self, &x);
+  get_view(mrb, other, &y);
+  return bn_bitop(mrb, &x, &y, op);
+}
+
+static mrb_value
+int_and(mrb_state *mrb, mrb_value self)
+{
+  return int_bitop(mrb, self, '&');
+}
+
+static mrb_value
+int_or(mrb_state *mrb, mrb_value self)
+{
+  return int_bitop(mrb, self, '|');
+}
+
+static mrb_value
+int_xor(mrb_state *mrb, mrb_value self)
+{
+  return int_bitop(mrb, self, '^');
+}
+
+static mrb_value
+int_shift(mrb_state *mrb, mrb_value self, mrb_bool left)
+{
+  mrb_value other;
+  struct bn_view x, w;
+  mrb_int width;
+
+  mrb_get_args(mrb, "o", &other);
+  if (mrb_float_p(other)) {
+    mrb_raise(mrb, E_TYPE_ERROR, "can't convert Float into Integer");
+  }
+  get_view(mrb, self, &x);
+  get_view(mrb, other, &w);
+  if (bn_p(other)) {
+    if (w.neg == left) {
+      /* shifting right by a huge amount */
+      return mrb_fixnum_value(x.neg ? -1 : 0);
+    }
+    mrb_raise(mrb, E_RANGE_ERROR, "shift width too big");
+  }
+  width = mrb_fixnum(other);
+  if (width == MRB_INT_MIN) {
+    if (left) return mrb_fixnum_value(x.neg ? -1 : 0);
+    mrb_raise(mrb, E_RANGE_ERROR, "shift width too big");
+  }
+  if (!left) width = -width;
+  if (width < 0) {
+    if (mrb_fixnum_p(self)) {
+      mrb_int v = mrb_fixnum(self);
+
+      if (width <= -(MRB_INT_BIT - 1)) return mrb_fixnum_value(v < 0 ? -1 : 0);
+      return mrb_fixnum_value(v >> -width);
+    }
+    return bn_rshift(mrb, &x, -width);
+  }
+  if (mrb_fixnum_p(self) && width < MRB_INT_BIT - 1) {
+    mrb_int v = mrb_fixnum(self);
+
+    if (v >= (MRB_FIXNUM_MIN >> width) && v <= (MRB_FIXNUM_MAX >> width)) {
+      return mrb_fixnum_value(v * ((mrb_int)1 << width));
+    }
+  }
+  return bn_lshift(mrb, &x, width);
+}
+
+static mrb_value
+int_lshift(mrb_state *mrb, mrb_value self)
+{
+  return int_shift(mrb, self, TRUE);
+}
+
+static mrb_value
+int_rshift(mrb_state *mrb, mrb_value self)
+{
+  return int_shift(mrb, self, FALSE);
+}
+
+static mrb_value
+big_uminus(mrb_state *mrb, mrb_value self)
+{
+  struct bignum *b = (struct bignum *)DATA_PTR(self);
+
+  return bn_from_mag(mrb, b->d, b->len, !b->neg);
+}
+
+static mrb_value
+big_abs(mrb_state *mrb, mrb_value self)
+{
+  struct bignum *b = (struct bignum *)DATA_PTR(self);
+
+  if (!b->neg) return self;
+  return bn_from_mag(mrb, b->d, b->len, FALSE);
+}
+
+static mrb_value
+big_rev(mrb_state *mrb, mrb_value self)
+{
+  struct bn_view x, one;
+
+  /* ~x == -x - 1 */
+  get_view(mrb, self, &x);
+  x.neg = !x.neg;
+  view_fixnum(&one, 1);
+  return bn_add(mrb, &x, &one, TRUE);
+}
+
+static mrb_value
+big_equal(mrb_state *mrb, mrb_value self)
+{
+  mrb_value other;
+  struct bn_view x, y;
+
+  mrb_get_args(mrb, "o", &other);
+  get_view(mrb, self, &x);
+  if (int_view(other, &y)) {
+    return mrb_bool_value(bn_cmp(&x, &y) == 0);
+  }
+  if (mrb_float_p(other)) {
+    return mrb_bool_value(bn_to_flo(&x) == mrb_float(other));
+  }
+  return mrb_false_value();
+}
+
+static mrb_value
+big_cmp(mrb_state *mrb, mrb_value self)
+{
+  mrb_value other;
+  struct bn_view x, y;
+
+  mrb_get_args(mrb, "o", &other);
+  get_view(mrb, self, &x);
+  if (int_view(other, &y)) {
+    return mrb_fixnum_value(bn_cmp(&x, &y));
+  }
+  if (mrb_float_p(other)) {
+    mrb_float a = bn_to_flo(&x), b = mrb_float(other);
+
+    if (isnan(b)) return mrb_nil_value();
+    return mrb_fixnum_value(a < b ? -1 : a > b ? 1 : 0);
+  }
+  return mrb_nil_value();
+}
+
+static mrb_value
+big_eql(mrb_state *mrb, mrb_value self)
+{
+  mrb_value other;
+  struct bn_view x, y;
+
+  mrb_get_args(mrb, "o", &other);
+  if (!bn_p(other)) return mrb_false_value();
+  get_view(mrb, self, &x);
+  get_view(mrb, other, &y);
+  return mrb_bool_value(bn_cmp(&x, &y) == 0);
+}
+
+static mrb_value
+big_hash(mrb_state *mrb, mrb_value self)
+{
+  struct bignum *b = (struct bignum *)DATA_PTR(self);
+  uint32_t h = b->neg ? 0x9e3779b9 : 0;
+  size_t i;
+
+  for (i = 0; i < b->len; i++) {
+    h = (h ^ b->d[i]) * 16777619;
+  }
+  return mrb_fixnum_value((mrb_int)(h & MRB_FIXNUM_MAX));
+}
+
+/*
+ *  call-seq:
+ *     big.to_s(base=10)  ->  string
+ *
+ *  Returns a string containing the representation of <i>big</i> radix
+ *  <i>base</i> (between 2 and 36).
+ */
+static mrb_value
+big_to_s(mrb_state *mrb, mrb_value self)
+{
+  mrb_int base = 10;
+  struct bn_view x;
+
+  mrb_get_args(mrb, "|i", &base);
+  get_view(mrb, self, &x);
+  return bn_to_s(mrb, &x, base);
+}
+
+static mrb_value
+big_to_f(mrb_state *mrb, mrb_value self)
+{
+  struct bn_view x;
+
+  get_view(mrb, self, &x);
+  return mrb_float_value(mrb, bn_to_flo(&x));
+}
+
+static mrb_value
+big_zero_p(mrb_state *mrb, mrb_value self)
+{
+  return mrb_false_value();
+}
+
+static mrb_value
+big_even_p(mrb_state *mrb, mrb_value self)
+{
+  struct bignum *b = (struct bignum *)DATA_PTR(self);
+
+  return mrb_bool_value((b->d[0] & 1) == 0);
+}
+
+static mrb_value
+big_odd_p(mrb_state *mrb, mrb_value self)
+{
+  struct bignum *b = (struct bignum *)DATA_PTR(self);
+
+  return mrb_bool_value((b->d[0] & 1) == 1);
+}
+
+static mrb_value
+big_size(mrb_state *mrb, mrb_value self)
+{
+  struct bignum *b = (struct bignum *)DATA_PTR(self);
+
+  return mrb_fixnum_value((mrb_int)(b->len * sizeof(bn_digit)));
+}
+
+static mrb_value
+big_bit_length(mrb_state *mrb, mrb_value self)
+{
+  struct bignum *b = (struct bignum *)DATA_PTR(self);
+  size_t bits;
+
+  if (!b->neg) {
+    bits = mag_bit_length(b->d, b->len);
+  }
+  else {
+    /* bit length of ~x == |x| - 1 */
+    bn_digit *t = (bn_digit *)mrb_malloc(mrb, sizeof(bn_digit) * b->len);
+    static const bn_digit one = 1;
+
+    mag_sub(t, b->d, b->len, &one, 1);
+    bits = mag_bit_length(t, b->len);
+    mrb_free(mrb, t);
+  }
+  return mrb_fixnum_value((mrb_int)bits);
+}
+
+static mrb_value
+big_coerce(mrb_state *mrb, mrb_value self)
+{
+  mrb_value other;
+  struct bn_view x, y;
+
+  mrb_get_args(mrb, "o", &other);
+  if (int_view(other, &y)) {
+    return mrb_assoc_new(mrb, other, self);
+  }
+  get_view(mrb, self, &x);
+  return mrb_assoc_new(mrb, mrb_float_value(mrb, mrb_to_flo(mrb, other)),
+                       mrb_float_value(mrb, bn_to_flo(&x)));
+}
+
+static mrb_value
+flo_to_i(mrb_state *mrb, mrb_value self)
+{
+  mrb_float f = mrb_float(self);
+
+  if (f >= (mrb_float)MRB_FIXNUM_MIN && f < -(mrb_float)MRB_FIXNUM_MIN) {
+    return mrb_fixnum_value((mrb_int)f);
+  }
+  return bn_from_flo(mrb, f);
+}
+
+static mrb_value
+flo_floor(mrb_state *mrb, mrb_value self)
+{
+  return flo_to_i(mrb, mrb_float_value(mrb, floor(mrb_float(self))));
+}
+
+static mrb_value
+flo_ceil(mrb_state *mrb, mrb_value self)
+{
+  return flo_to_i(mrb, mrb_float_value(mrb, ceil(mrb_float(self))));
+}
+
+void
+mrb_mruby_bignum_gem_init(mrb_state *mrb)
+{
+  struct RClass *integer = mrb_class_get(mrb, "Integer");
+  struct RClass *fixnum = mrb->fixnum_class;
+  struct RClass *big;
+
+  big = mrb_define_class(mrb, "Bignum", integer);
+  MRB_SET_INSTANCE_TT(big, MRB_TT_DATA);
+  mrb->bignum_class = big;
+  mrb->int_overflow = bn_int_overflow;
+  mrb->int_read = bn_int_read;
+
+  mrb_define_method(mrb, big, "+",          int_plus,       MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "-",          int_minus,      MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "*",          int_mul,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "/",          big_div,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "div",        int_idiv,       MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "%",          int_mod,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "modulo",     int_mod,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "divmod",     int_divmod,     MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "**",         int_pow,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "pow",        int_pow,        MRB_ARGS_ARG(1,1));
+  mrb_define_method(mrb, big, "-@",         big_uminus,     MRB_ARGS_NONE());
+  mrb_define_method(mrb, big, "abs",        big_abs,        MRB_ARGS_NONE());
+  mrb_define_method(mrb, big, "~",          big_rev,        MRB_ARGS_NONE());
+  mrb_define_method(mrb, big, "&",          int_and,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "|",          int_or,         MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "^",          int_xor,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "<<",         int_lshift,     MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, ">>",         int_rshift,     MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "==",         big_equal,      MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "<=>",        big_cmp,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "eql?",       big_eql,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, big, "hash",       big_hash,       MRB_ARGS_NONE());
+  mrb_define_method(mrb, big, "to_s",       big_to_s,       MRB_ARGS_OPT(1));
+  mrb_define_method(mrb, big, "inspect",    big_to_s,       MRB_ARGS_NONE());
+  mrb_define_method(mrb, big, "to_f",       big_to_f,       MRB_ARGS_NONE());
+  mrb_define_method(mrb, big, "zero?",      big_zero_p,     MRB_ARGS_NONE());
+  mrb_define_method(mrb, big, "even?",      big_even_p,     MRB_ARGS_NONE());
+  mrb_define_method(mrb, big, "odd?",       big_odd_p,      MRB_ARGS_NONE());
+  mrb_define_method(mrb, big, "size",       big_size,       MRB_ARGS_NONE());
+  mrb_define_method(mrb, big, "bit_length", big_bit_length, MRB_ARGS_NONE());
+  mrb_define_method(mrb, big, "coerce",     big_coerce,     MRB_ARGS_REQ(1));
+
+  /* Fixnum operations that may produce or take a Bignum */
+  mrb_define_method(mrb, fixnum, "+",       int_plus,       MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, fixnum, "-",       int_minus,      MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, fixnum, "*",       int_mul,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, fixnum, "div",     int_idiv,       MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, fixnum, "%",       int_mod,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, fixnum, "modulo",  int_mod,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, fixnum, "divmod",  int_divmod,     MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, fixnum, "**",      int_pow,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, fixnum, "pow",     int_pow,        MRB_ARGS_ARG(1,1));
+  mrb_define_method(mrb, fixnum, "&",       int_and,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, fixnum, "|",       int_or,         MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, fixnum, "^",       int_xor,        MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, fixnum, "<<",      int_lshift,     MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, fixnum, ">>",      int_rshift,     MRB_ARGS_REQ(1));
+
+  mrb_define_method(mrb, mrb->float_class, "to_i",     flo_to_i,   MRB_ARGS_NONE());
+  mrb_define_method(mrb, mrb->float_class, "to_int",   flo_to_i,   MRB_ARGS_NONE());
+  mrb_define_method(mrb, mrb->float_class, "truncate", flo_to_i,   MRB_ARGS_NONE());
+  mrb_define_method(mrb, mrb->float_class, "floor",    flo_floor,  MRB_ARGS_NONE());
+  mrb_define_method(mrb, mrb->float_class, "ceil",     flo_ceil,   MRB_ARGS_NONE());
+}
+
+void
+mrb_mruby_bignum_gem_final(mrb_state *mrb)
+{
+  mrb->int_overflow = NULL;
+  mrb->int_read = NULL;
+  mrb->bignum_class = NULL;
+}
@@ -0,0 +1,164 @@
+##
+# Bignum Test
+
+assert('Bignum') do
+  assert_equal Class, Bignum.class
+  assert_equal Integer, Bignum.superclass
+end
+
+assert('Fixnum overflow promotes to Bignum') do
+  max = 1
+  max = max * 2 + 1 while (max * 2 + 1).class == Fixnum
+  assert_equal Bignum, (max + 1).class
+  assert_equal Bignum, (-max - 2).class
+  assert_equal Bignum, (max * max).class
+  assert_equal Fixnum, (max + 1 - 1).class
+  assert_equal max, (max * max).div(max)
+  assert_equal (max + 1).to_s, (max.to_f + 1).to_i.to_s
+
+  x = max
+  x += 1
+  assert_equal Bignum, x.class
+  x -= 1
+  assert_equal Fixnum, x.class
+end
+
+assert('Integer literals beyond Fixnum are Bignums') do
+  assert_equal Bignum, 12345678901234567890.class
+  assert_equal "12345678901234567890", 12345678901234567890.to_s
+  assert_equal 2**64 - 1, 0xffff_ffff_ffff_ffff
+  assert_equal 2**70, 0b1_0000000000_0000000000_0000000000_0000000000_0000000000_0000000000_0000000000
+  assert_equal 8**30, 0o1_000000000000000000000000000000
+  assert_equal(-(2**64), -18446744073709551616)
+  l = []
+  3.times { l << 100000000000000000000 }
+  assert_equal [10**20] * 3, l
+end
+
+def bignum_literal
+  -123456789012345678901234567890
+end
+
+assert('Integer literals beyond Fixnum ignore redefined arithmetic') do
+  [Fixnum, Bignum].each do |c|
+    c.class_eval do
+      alias_method :__mul__, :*
+      alias_method :__plus__, :+
+      define_method(:*) { |o| 0 }
+      define_method(:+) { |o| 0 }
+    end
+  end
+  begin
+    l = (1..3).map { bignum_literal }
+    s = "123456789012345678901234567890".to_i
+  ensure
+    [Fixnum, Bignum].each do |c|
+      c.class_eval do
+        alias_method :*, :__mul__
+        alias_method :+, :__plus__
+        remove_method :__mul__, :__plus__
+      end
+    end
+  end
+  assert_equal ["-123456789012345678901234567890"] * 3, l.map { |x| x.to_s }
+  assert_equal "123456789012345678901234567890", s.to_s
+end
+
+assert('String#to_i beyond Fixnum returns Bignum') do
+  assert_equal 12345678901234567890, "12345678901234567890".to_i
+  assert_equal(-(16**20), "-1_0000_0000_0000_0000_0000".to_i(16))
+  assert_equal 2**64 - 1, "0xffffffffffffffff".to_i(0)
+  assert_equal 36**20 - 1, ("z" * 20).to_i(36)
+  assert_equal 10**30, "1#{"0" * 30} apples".to_i
+end
+
+assert('Bignum#+, #-, #*') do
+  a = 2**100
+  assert_equal "1267650600228229401496703205376", a.to_s
+  assert_equal "1267650600228229401496703205377", (a + 1).to_s
+  assert_equal "1267650600228229401496703205377", (1 + a).to_s
+  assert_equal 0, a - a
+  assert_equal 2**200, a * a
+  assert_equal(-(2**200), a * -a)
+  assert_equal 2**100 + 0.5, a + 0.5
+end
+
+assert('Bignum multiplication of large operands') do
+  a = 3**4000
+  b = 7**3000 + 1
+  assert_equal a * b, b * a
+  assert_equal a * (b + 1), a * b + a
+  assert_equal 0, (a * b) % a
+end
+
+assert('Bignum#div, #%, #divmod') do
+  a = 2**100 + 5
+  assert_equal 2**90, a.div(2**10)
+  assert_equal 5, a % 2**10
+  assert_equal [2**90, 5], a.divmod(2**10)
+  assert_equal [-(2**90) - 1, 2**10 - 5], (-a).divmod(2**10)
+  assert_equal [-(2**90) - 1, 5 - 2**10], a.divmod(-(2**10))
+  assert_equal 0, 7.div(2**100)
+  assert_equal(-1, -7.div(2**100))
+  b = 3**500
+  q, r = (b * b + 17).divmod(b)
+  assert_equal b, q
+  assert_equal 17, r
+end
+
+assert('Bignum#**, #pow') do
+  assert_equal "1" + "0" * 50, (10**50).to_s
+  assert_equal 2**128, (2**64)**2
+  assert_equal(-(2**99), (-2)**99)
+  assert_equal 56888193, 3.pow(1000, 1000000007)
+  assert_equal "170533657658746503973490917376", (2**200).pow(3**50, 10**30).to_s
+  assert_equal 7, (-7).pow(3, 10)
+  assert_equal(-7, 7.pow(3, -10))
+  assert_equal 1024, 2**10
+end
+
+assert('Bignum#to_s') do
+  a = 2**100
+  assert_equal "10000000000000000000000000", a.to_s(16)
+  assert_equal "1" + "0" * 100, a.to_s(2)
+  assert_equal "-10000000000000000000000000", (-a).to_s(16)
+  assert_equal "8by6c7vf6q29mamdgeiho512a9k9", (3**90).to_s(36)
+  s = (3**20000).to_s
+  assert_equal 9543, s.size
+  assert_equal "0001", s[-4, 4]
+  assert_equal "0", (10**1000).to_s[-1]
+end
+
+assert('Bignum bit operations') do
+  a = 2**100 + 0xffff
+  assert_equal 0xffff, a & 0xffff
+  assert_equal 1, (-a) & 0xffff
+  assert_equal(-1, a | -1)
+  assert_equal 0, a ^ a
+  assert_equal(-a - 1, ~a)
+  assert_equal 2**100, 1 << 100
+  assert_equal(-(2**100), -1 << 100)
+  assert_equal 2**40, (2**100) >> 60
+  assert_equal(-1, -(2**100) >> 200)
+  assert_equal(-(2**40) - 1, -(2**100 + 1) >> 60)
+  assert_equal 101, (2**100).bit_length
+end
+
+assert('Bignum comparison') do
+  a = 2**64
+  assert_true a == 2**64
+  assert_true a.eql?(2**64)
+  assert_false a == 2**64 + 1
+  assert_true a > 1
+  assert_true 1 < a
+  assert_true(-a < 1)
+  assert_equal 1, a <=> 1.0
+  assert_true 1.0 < a
+  assert_equal 1, {2**64 => 1}[a]
+end
+
+assert('Float#to_i returns Bignum') do
+  assert_equal 3 * 2**66, (3.0 * 2.0**66).to_i
+  assert_equal(-(2**70), (-(2.0**70)).to_i)
+  assert_equal 2**80, (2.0**80).floor
+end
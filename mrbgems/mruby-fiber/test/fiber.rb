@@ -206,3 +206,19 @@ assert('CRuby Fiber#transfer test.') do
   assert_equal :ok, f1.transfer
   assert_equal [:baz], ary
 end
+
+assert('Fiber returning inside GC.region keeps its captured locals') do
+  def fiber_region_capture
+    v = nil
+    pr = -> { v }
+    Fiber.yield pr
+    v = "s" * 3
+    pr
+  end
+  f = Fiber.new { fiber_region_capture }
+  pr = f.resume
+  GC.region { f.resume }
+  100.times { "x" * 10 }
+  GC.start
+  assert_equal "sss", pr.call
+end
@@ -0,0 +1,34 @@
+/*
+** mruby/objectspace.h - ObjectSpace heap dump
+**
+** See Copyright Notice in mruby.h
+*/
+
+#ifndef MRUBY_OBJECTSPACE_H
+#define MRUBY_OBJECTSPACE_H
+
+#include <stdio.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*
+ * Run a full GC and write every live object of mrb to fp, one record
+ * per line, as the heap is walked; nothing is buffered.  Addresses are
+ * hexadecimal, 0 standing for none:
+ *
+ *   # mruby heap dump 1
+ *   ROOT <kind> <address>                  (globals, arena, vm or stack)
+ *   <address> <type> <class> <bytes> <referenced address>...
+ *   NAME <address> <outer class> <name>    (after a named class or module)
+ *
+ * Returns 0, or -1 if writing failed.
+ */
+int mrb_objspace_dump_all(mrb_state *mrb, FILE *fp);
+
+#if defined(__cplusplus)
+}  /* extern "C" { */
+#endif
+
+#endif  /* MRUBY_OBJECTSPACE_H */
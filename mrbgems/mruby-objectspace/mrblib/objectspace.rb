@@ -0,0 +1,24 @@
+##
+# ObjectSpace
+#
+module ObjectSpace
+  ##
+  # call-seq:
+  #    ObjectSpace.trace_allocations(interval = 1) { ... }  -> obj
+  #
+  # Samples the allocations made by the block; returns what the block
+  # returns.  The counts are read with ObjectSpace.allocation_sites.
+  #
+  #    ObjectSpace.trace_allocations { build_report }
+  #    ObjectSpace.allocation_sites.first(3)
+
+  def self.trace_allocations(interval = 1, &block)
+    raise ArgumentError, "Expected block in ObjectSpace.trace_allocations." unless block
+    trace_allocations_start(interval)
+    begin
+      block.call
+    ensure
+      trace_allocations_stop
+    end
+  end
+end
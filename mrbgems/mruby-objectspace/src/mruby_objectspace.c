@@ -1,27 +1,49 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <inttypes.h>
 #include "mruby.h"
 #include "mruby/gc.h"
 #include "mruby/hash.h"
 #include "mruby/class.h"
+#include "mruby/array.h"
+#include "mruby/data.h"
+#include "mruby/irep.h"
+#include "mruby/debug.h"
+#include "mruby/khash.h"
+#include "mruby/variable.h"
+#include "mruby/objectspace.h"
 
-struct os_count_struct {
-  mrb_int total;
-  mrb_int freed;
-  mrb_int counts[MRB_TT_MAXDEFINE+1];
-};
-
-static void
-os_count_object_type(mrb_state *mrb, struct RBasic *obj, void *data)
+static const char*
+os_type_name(enum mrb_vtype tt)
 {
-  struct os_count_struct *obj_count;
-  obj_count = (struct os_count_struct*)data;
-
-  obj_count->total++;
-
-  if (is_dead(mrb, obj)) {
-    obj_count->freed++;
-  }
-  else {
-    obj_count->counts[obj->tt]++;
+  switch (tt) {
+#define TYPE_NAME(t) case (MRB_T ## t): return #t;
+    TYPE_NAME(T_FALSE);
+    TYPE_NAME(T_FREE);
+    TYPE_NAME(T_TRUE);
+    TYPE_NAME(T_FIXNUM);
+    TYPE_NAME(T_SYMBOL);
+    TYPE_NAME(T_UNDEF);
+    TYPE_NAME(T_FLOAT);
+    TYPE_NAME(T_CPTR);
+    TYPE_NAME(T_OBJECT);
+    TYPE_NAME(T_CLASS);
+    TYPE_NAME(T_MODULE);
+    TYPE_NAME(T_ICLASS);
+    TYPE_NAME(T_SCLASS);
+    TYPE_NAME(T_PROC);
+    TYPE_NAME(T_ARRAY);
+    TYPE_NAME(T_HASH);
+    TYPE_NAME(T_STRING);
+    TYPE_NAME(T_RANGE);
+    TYPE_NAME(T_EXCEPTION);
+    TYPE_NAME(T_FILE);
+    TYPE_NAME(T_ENV);
+    TYPE_NAME(T_DATA);
+    TYPE_NAME(T_FIBER);
+#undef TYPE_NAME
+  default:
+    return NULL;
   }
 }
 
@@ -43,12 +65,15 @@ os_count_object_type(mrb_state *mrb, struct RBasic *obj, void *data)
  *  If the optional argument +result_hash+ is given,
  *  it is overwritten and returned. This is intended to avoid probe effect.
  *
+ *  The counts are kept by the collector, so this does not walk the
+ *  heap. Objects that died but were not swept yet still count as live.
+ *
  */
 
 static mrb_value
 os_count_objects(mrb_state *mrb, mrb_value self)
 {
-  struct os_count_struct obj_count = { 0 };
+  struct mrb_gc_stat st;
   enum mrb_vtype i;
   mrb_value hash;
 
@@ -60,44 +85,16 @@ os_count_objects(mrb_state *mrb, mrb_value self)
     mrb_hash_clear(mrb, hash);
   }
 
-  mrb_objspace_each_objects(mrb, os_count_object_type, &obj_count);
-
-  mrb_hash_set(mrb, hash, mrb_symbol_value(mrb_intern_lit(mrb, "TOTAL")), mrb_fixnum_value(obj_count.total));
-  mrb_hash_set(mrb, hash, mrb_symbol_value(mrb_intern_lit(mrb, "FREE")), mrb_fixnum_value(obj_count.freed));
+  mrb_gc_stat(mrb, &st);
+  mrb_hash_set(mrb, hash, mrb_symbol_value(mrb_intern_lit(mrb, "TOTAL")), mrb_fixnum_value(st.live + st.free_slots));
+  mrb_hash_set(mrb, hash, mrb_symbol_value(mrb_intern_lit(mrb, "FREE")), mrb_fixnum_value(st.free_slots));
 
   for (i = MRB_TT_FALSE; i < MRB_TT_MAXDEFINE; i++) {
-    mrb_value type;
-    switch (i) {
-#define COUNT_TYPE(t) case (MRB_T ## t): type = mrb_symbol_value(mrb_intern_lit(mrb, #t)); break;
-      COUNT_TYPE(T_FALSE);
-      COUNT_TYPE(T_FREE);
-      COUNT_TYPE(T_TRUE);
-      COUNT_TYPE(T_FIXNUM);
-      COUNT_TYPE(T_SYMBOL);
-      COUNT_TYPE(T_UNDEF);
-      COUNT_TYPE(T_FLOAT);
-      COUNT_TYPE(T_CPTR);
-      COUNT_TYPE(T_OBJECT);
-      COUNT_TYPE(T_CLASS);
-      COUNT_TYPE(T_MODULE);
-      COUNT_TYPE(T_ICLASS);
-      COUNT_TYPE(T_SCLASS);
-      COUNT_TYPE(T_PROC);
-      COUNT_TYPE(T_ARRAY);
-      COUNT_TYPE(T_HASH);
-      COUNT_TYPE(T_STRING);
-      COUNT_TYPE(T_RANGE);
-      COUNT_TYPE(T_EXCEPTION);
-      COUNT_TYPE(T_FILE);
-      COUNT_TYPE(T_ENV);
-      COUNT_TYPE(T_DATA);
-      COUNT_TYPE(T_FIBER);
-#undef COUNT_TYPE
-    default:
-      type = mrb_fixnum_value(i); break;
-    }
-    if (obj_count.counts[i])
-      mrb_hash_set(mrb, hash, type, mrb_fixnum_value(obj_count.counts[i]));
+    const char *name = os_type_name(i);
+    mrb_value type = name ? mrb_symbol_value(mrb_intern_cstr(mrb, name)) : mrb_fixnum_value(i);
+
+    if (mrb->live_types[i])
+      mrb_hash_set(mrb, hash, type, mrb_fixnum_value(mrb->live_types[i]));
   }
 
   return hash;
@@ -159,15 +156,770 @@ os_each_object(mrb_state *mrb, mrb_value self)
   return mrb_fixnum_value(d.count);
 }
 
+/*
+ *  call-seq:
+ *     ObjectSpace.memsize_of(obj)  -> integer
+ *
+ *  Returns the bytes <i>obj</i> occupies: its heap slot and what it owns
+ *  outside it (string and array buffers, hash and instance variable
+ *  tables, ...).  Data objects count their payload when their type
+ *  provides a <code>dsize</code> function.  Immediate values take 0.
+ */
+static mrb_value
+os_memsize_of(mrb_state *mrb, mrb_value self)
+{
+  mrb_value obj;
+
+  mrb_get_args(mrb, "o", &obj);
+  return mrb_fixnum_value((mrb_int)mrb_objspace_memsize_of(mrb, obj));
+}
+
+/*
+ *  call-seq:
+ *     ObjectSpace.memsize_of_all  -> integer
+ *
+ *  Returns the bytes taken by all live objects, with their payload as
+ *  of the last sweep.  This is a counter; it does not walk the heap.
+ */
+static mrb_value
+os_memsize_of_all(mrb_state *mrb, mrb_value self)
+{
+  return mrb_fixnum_value((mrb_int)mrb_objspace_memsize_of_all(mrb));
+}
+
+/* heap dump; the format is described in mruby/objectspace.h */
+
+struct os_dump {
+  FILE *fp;
+  mrb_sym classid, outer;
+};
+
+static void
+os_dump_root(mrb_state *mrb, const char *root, struct RBasic *obj, void *ud)
+{
+  struct os_dump *d = (struct os_dump*)ud;
+
+  fprintf(d->fp, "ROOT %s %" PRIxPTR "\n", root, (uintptr_t)obj);
+}
+
+static void
+os_dump_ref(mrb_state *mrb, const char *root, struct RBasic *obj, void *ud)
+{
+  struct os_dump *d = (struct os_dump*)ud;
+
+  fprintf(d->fp, " %" PRIxPTR, (uintptr_t)obj);
+}
+
+static void
+os_dump_name(mrb_state *mrb, struct os_dump *d, struct RBasic *obj)
+{
+  mrb_value name, outer;
+  const char *s;
+  mrb_int len;
+
+  name = mrb_obj_iv_get(mrb, (struct RObject*)obj, d->classid);
+  if (!mrb_symbol_p(name)) return;
+  outer = mrb_obj_iv_get(mrb, (struct RObject*)obj, d->outer);
+  s = mrb_sym2name_len(mrb, mrb_symbol(name), &len);
+  fprintf(d->fp, "NAME %" PRIxPTR " %" PRIxPTR " %.*s\n", (uintptr_t)obj,
+          mrb_basic_p(outer) ? (uintptr_t)mrb_basic_ptr(outer) : (uintptr_t)0, (int)len, s);
+}
+
+static void
+os_dump_object(mrb_state *mrb, struct RBasic *obj, void *ud)
+{
+  struct os_dump *d = (struct os_dump*)ud;
+  const char *type;
+
+  if (is_dead(mrb, obj)) return;
+  type = os_type_name(obj->tt);
+  if (type) {
+    fprintf(d->fp, "%" PRIxPTR " %s", (uintptr_t)obj, type);
+  }
+  else {
+    fprintf(d->fp, "%" PRIxPTR " %d", (uintptr_t)obj, (int)obj->tt);
+  }
+  fprintf(d->fp, " %" PRIxPTR " %lu", (uintptr_t)obj->c,
+          (unsigned long)mrb_objspace_memsize_of(mrb, mrb_obj_value(obj)));
+  mrb_objspace_each_reference(mrb, obj, os_dump_ref, d);
+  fputc('\n', d->fp);
+  if (obj->tt == MRB_TT_CLASS || obj->tt == MRB_TT_MODULE) {
+    os_dump_name(mrb, d, obj);
+  }
+}
+
+int
+mrb_objspace_dump_all(mrb_state *mrb, FILE *fp)
+{
+  struct os_dump d;
+
+  d.fp = fp;
+  d.classid = mrb_intern_lit(mrb, "__classid__");
+  d.outer = mrb_intern_lit(mrb, "__outer__");
+  mrb_full_gc(mrb);
+  fputs("# mruby heap dump 1\n", fp);
+  mrb_objspace_each_root(mrb, os_dump_root, &d);
+  mrb_objspace_each_objects(mrb, os_dump_object, &d);
+  return (fflush(fp) != 0 || ferror(fp)) ? -1 : 0;
+}
+
+/*
+ *  call-seq:
+ *     ObjectSpace.dump_all(path)  -> path
+ *
+ *  Writes every live object, with what it refers to, and the GC roots
+ *  to the file at <i>path</i>; see mruby/objectspace.h for the format.
+ *  The objects are written as the heap is walked, so the dump takes
+ *  no memory in proportion to the heap.
+ */
+static mrb_value
+os_dump_all(mrb_state *mrb, mrb_value self)
+{
+  char *path;
+  FILE *fp;
+  int ret;
+
+  mrb_get_args(mrb, "z", &path);
+  fp = fopen(path, "w");
+  if (!fp) {
+    mrb_raisef(mrb, E_RUNTIME_ERROR, "can't open %S for the heap dump", mrb_str_new_cstr(mrb, path));
+  }
+  ret = mrb_objspace_dump_all(mrb, fp);
+  if (fclose(fp) != 0 || ret != 0) {
+    mrb_raisef(mrb, E_RUNTIME_ERROR, "can't write the heap dump to %S", mrb_str_new_cstr(mrb, path));
+  }
+  return mrb_str_new_cstr(mrb, path);
+}
+
+/* ObjectSpace::WeakMap: an identity map that holds its keys and values weakly */
+
+static inline khint_t
+wmap_hash_func(mrb_state *mrb, mrb_value key)
+{
+  /* hash objects by address; mrb_obj_id() would pin them in place */
+  if (mrb_basic_p(key) && mrb_type(key) != MRB_TT_FLOAT) {
+    return kh_int64_hash_func(mrb, (uint64_t)(intptr_t)mrb_basic_ptr(key));
+  }
+  return kh_int_hash_func(mrb, (khint_t)mrb_obj_id(key));
+}
+
+#define wmap_hash_equal(mrb,a,b) mrb_obj_eq(mrb,a,b)
+
+KHASH_DECLARE(wmap, mrb_value, mrb_value, TRUE)
+KHASH_DEFINE(wmap, mrb_value, mrb_value, TRUE, wmap_hash_func, wmap_hash_equal)
+
+struct os_wmap {
+  struct mrb_gc_weak weak;
+  khash_t(wmap) *h;
+  mrb_bool moved;               /* a compaction moved keys; rehash before use */
+};
+
+static void
+os_wmap_free(mrb_state *mrb, void *ptr)
+{
+  struct os_wmap *w = (struct os_wmap*)ptr;
+
+  mrb_gc_weak_unregister(mrb, &w->weak);
+  kh_destroy(wmap, mrb, w->h);
+  mrb_free(mrb, w);
+}
+
+static const struct mrb_data_type os_wmap_type = {
+  "ObjectSpace::WeakMap", os_wmap_free,
+};
+
+/* drop the entries whose key or value died; called by the GC */
+static void
+os_wmap_update(mrb_state *mrb, struct mrb_gc_weak *weak)
+{
+  struct os_wmap *w = (struct os_wmap*)weak;
+  khash_t(wmap) *h = w->h;
+  khiter_t k;
+
+  if (!h) return;
+  for (k = kh_begin(h); k != kh_end(h); k++) {
+    mrb_value key, val;
+
+    if (!kh_exist(h, k)) continue;
+    key = mrb_gc_weak_update(mrb, kh_key(h, k));
+    val = mrb_gc_weak_update(mrb, kh_value(h, k));
+    if (mrb_undef_p(key) || mrb_undef_p(val)) {
+      kh_del(wmap, mrb, h, k);
+      continue;
+    }
+    if (!mrb_obj_eq(mrb, key, kh_key(h, k))) {
+      w->moved = TRUE;
+    }
+    kh_key(h, k) = key;
+    kh_value(h, k) = val;
+  }
+}
+
+static struct os_wmap*
+os_wmap_get(mrb_state *mrb, mrb_value self)
+{
+  struct os_wmap *w = DATA_GET_PTR(mrb, self, &os_wmap_type, struct os_wmap);
+
+  if (w->moved) {
+    khash_t(wmap) *h = w->h;
+
+    w->h = kh_copy(wmap, mrb, h);
+    w->moved = FALSE;
+    kh_destroy(wmap, mrb, h);
+  }
+  return w;
+}
+
+static mrb_value
+os_wmap_initialize(mrb_state *mrb, mrb_value self)
+{
+  struct os_wmap *w = (struct os_wmap*)DATA_PTR(self);
+
+  if (w) {
+    kh_clear(wmap, mrb, w->h);
+    return self;
+  }
+  w = (struct os_wmap*)mrb_malloc(mrb, sizeof(struct os_wmap));
+  w->h = NULL;
+  w->moved = FALSE;
+  mrb_gc_weak_register(mrb, &w->weak, os_wmap_update);
+  DATA_TYPE(self) = &os_wmap_type;
+  DATA_PTR(self) = w;
+  w->h = kh_init(wmap, mrb);
+  return self;
+}
+
+/*
+ *  call-seq:
+ *     wmap[key] = value -> value
+ *
+ *  Associates +value+ with +key+ without keeping either alive; the
+ *  entry disappears once the GC collects the key or the value.
+ */
+
+static mrb_value
+os_wmap_aset(mrb_state *mrb, mrb_value self)
+{
+  struct os_wmap *w = os_wmap_get(mrb, self);
+  mrb_value key, val;
+  khiter_t k;
+
+  mrb_get_args(mrb, "oo", &key, &val);
+  k = kh_put(wmap, mrb, w->h, key);
+  kh_key(w->h, k) = key;
+  kh_value(w->h, k) = val;
+  return val;
+}
+
+/*
+ *  call-seq:
+ *     wmap[key] -> value or nil
+ *
+ *  Returns the value associated with +key+ (compared by identity).
+ */
+
+static mrb_value
+os_wmap_aref(mrb_state *mrb, mrb_value self)
+{
+  struct os_wmap *w = os_wmap_get(mrb, self);
+  mrb_value key;
+  khiter_t k;
+
+  mrb_get_args(mrb, "o", &key);
+  k = kh_get(wmap, mrb, w->h, key);
+  if (k == kh_end(w->h)) return mrb_nil_value();
+  return mrb_gc_weak_get(mrb, kh_value(w->h, k));
+}
+
+static mrb_value
+os_wmap_key_p(mrb_state *mrb, mrb_value self)
+{
+  struct os_wmap *w = os_wmap_get(mrb, self);
+  mrb_value key;
+
+  mrb_get_args(mrb, "o", &key);
+  return mrb_bool_value(kh_get(wmap, mrb, w->h, key) != kh_end(w->h));
+}
+
+static mrb_value
+os_wmap_delete(mrb_state *mrb, mrb_value self)
+{
+  struct os_wmap *w = os_wmap_get(mrb, self);
+  mrb_value key, val;
+  khiter_t k;
+
+  mrb_get_args(mrb, "o", &key);
+  k = kh_get(wmap, mrb, w->h, key);
+  if (k == kh_end(w->h)) return mrb_nil_value();
+  val = mrb_gc_weak_get(mrb, kh_value(w->h, k));
+  kh_del(wmap, mrb, w->h, k);
+  return val;
+}
+
+static mrb_value
+os_wmap_size(mrb_state *mrb, mrb_value self)
+{
+  struct os_wmap *w = os_wmap_get(mrb, self);
+
+  return mrb_fixnum_value(kh_size(w->h));
+}
+
+/* the live entries as [key, value, ...]; the array keeps them alive while it is used */
+static mrb_value
+os_wmap_entries(mrb_state *mrb, mrb_value self, mrb_bool keys, mrb_bool vals)
+{
+  struct os_wmap *w = os_wmap_get(mrb, self);
+  khash_t(wmap) *h = w->h;
+  mrb_value ary = mrb_ary_new_capa(mrb, kh_size(h) * ((keys && vals) ? 2 : 1));
+  khiter_t k;
+
+  for (k = kh_begin(h); k != kh_end(h); k++) {
+    if (!kh_exist(h, k)) continue;
+    if (keys) mrb_ary_push(mrb, ary, mrb_gc_weak_get(mrb, kh_key(h, k)));
+    if (vals) mrb_ary_push(mrb, ary, mrb_gc_weak_get(mrb, kh_value(h, k)));
+  }
+  return ary;
+}
+
+static mrb_value
+os_wmap_keys(mrb_state *mrb, mrb_value self)
+{
+  return os_wmap_entries(mrb, self, TRUE, FALSE);
+}
+
+static mrb_value
+os_wmap_values(mrb_state *mrb, mrb_value self)
+{
+  return os_wmap_entries(mrb, self, FALSE, TRUE);
+}
+
+/*
+ *  call-seq:
+ *     wmap.each {|key, value| ... } -> wmap
+ *
+ *  Yields the entries alive when the iteration starts.
+ */
+
+static mrb_value
+os_wmap_each(mrb_state *mrb, mrb_value self)
+{
+  mrb_value blk, ary;
+  mrb_int i;
+  int ai;
+
+  mrb_get_args(mrb, "&", &blk);
+  if (mrb_nil_p(blk)) {
+    mrb_raise(mrb, E_ARGUMENT_ERROR, "no block given");
+  }
+  ary = os_wmap_entries(mrb, self, TRUE, TRUE);
+  ai = mrb_gc_arena_save(mrb);
+  for (i = 0; i + 1 < RARRAY_LEN(ary); i += 2) {
+    mrb_yield(mrb, blk, mrb_assoc_new(mrb, RARRAY_PTR(ary)[i], RARRAY_PTR(ary)[i+1]));
+    mrb_gc_arena_restore(mrb, ai);
+  }
+  return self;
+}
+
+/*
+  Allocation tracing: the GC reports every nth allocation, which is
+  counted against its site (the instruction that made it and the class
+  and type of the object), and remembers the site of the sampled objects
+  until they are freed for the retained view.
+*/
+
+struct os_alloc_site {
+  mrb_irep *irep;               /* NULL when allocated outside Ruby code */
+  uint32_t pc;
+  struct RClass *c;
+  enum mrb_vtype tt;
+};
+
+static inline khint_t
+os_alloc_site_hash(mrb_state *mrb, struct os_alloc_site site)
+{
+  return kh_int64_hash_func(mrb, (uint64_t)(intptr_t)site.irep ^ (uint64_t)(intptr_t)site.c) ^
+    (khint_t)(site.pc << 5) ^ (khint_t)site.tt;
+}
+
+#define os_alloc_site_equal(mrb,a,b) \
+  ((a).irep == (b).irep && (a).pc == (b).pc && (a).c == (b).c && (a).tt == (b).tt)
+
+KHASH_DECLARE(ossite, struct os_alloc_site, uint32_t, TRUE)
+KHASH_DEFINE(ossite, struct os_alloc_site, uint32_t, TRUE, os_alloc_site_hash, os_alloc_site_equal)
+
+#define os_live_hash(mrb,obj) kh_int64_hash_func(mrb, (uint64_t)(intptr_t)(obj))
+#define os_live_equal(mrb,a,b) ((a) == (b))
+
+KHASH_DECLARE(oslive, struct RBasic*, uint32_t, TRUE)
+KHASH_DEFINE(oslive, struct RBasic*, uint32_t, TRUE, os_live_hash, os_live_equal)
+
+struct os_trace {
+  khash_t(ossite) *index;       /* site -> position in sites */
+  struct os_alloc_site *sites;
+  uint32_t *allocated;          /* sampled allocations per site */
+  uint32_t len, capa;
+  khash_t(oslive) *live;        /* sampled object -> position in sites */
+};
+
+static void
+os_trace_new(mrb_state *mrb, struct os_trace *t, struct RBasic *obj)
+{
+  struct os_alloc_site site;
+  mrb_code *pc;
+  khiter_t k;
+  uint32_t i;
+  int ret;
+
+  if (mrb_gc_alloc_site(mrb, &site.irep, &pc)) {
+    site.pc = pc ? (uint32_t)(pc - site.irep->iseq) : 0;
+  }
+  else {
+    site.irep = NULL;
+    site.pc = 0;
+  }
+  site.c = obj->c;
+  site.tt = obj->tt;
+
+  k = kh_put2(ossite, mrb, t->index, site, &ret);
+  if (ret == 0) {
+    i = kh_value(t->index, k);
+  }
+  else {
+    if (t->len == t->capa) {
+      t->capa = t->capa ? t->capa * 2 : 64;
+      t->sites = (struct os_alloc_site*)mrb_realloc(mrb, t->sites, sizeof(struct os_alloc_site) * t->capa);
+      t->allocated = (uint32_t*)mrb_realloc(mrb, t->allocated, sizeof(uint32_t) * t->capa);
+    }
+    i = t->len++;
+    if (site.irep) mrb_irep_incref(mrb, site.irep);
+    t->sites[i] = site;
+    t->allocated[i] = 0;
+    kh_value(t->index, k) = i;
+  }
+  t->allocated[i]++;
+
+  /* a stale entry if the slot was reused without a free being reported */
+  k = kh_put(oslive, mrb, t->live, obj);
+  kh_value(t->live, k) = i;
+}
+
+static void
+os_trace_event(mrb_state *mrb, enum mrb_obj_event ev, struct RBasic *obj, struct RBasic *orig, void *ud)
+{
+  struct os_trace *t = (struct os_trace*)ud;
+  khiter_t k;
+
+  switch (ev) {
+  case MRB_OBJ_EVENT_NEW:
+    os_trace_new(mrb, t, obj);
+    break;
+  case MRB_OBJ_EVENT_FREE:
+    k = kh_get(oslive, mrb, t->live, obj);
+    if (k != kh_end(t->live)) {
+      kh_del(oslive, mrb, t->live, k);
+    }
+    break;
+  case MRB_OBJ_EVENT_MOVE:
+    k = kh_get(oslive, mrb, t->live, orig);
+    if (k != kh_end(t->live)) {
+      uint32_t i = kh_value(t->live, k);
+
+      kh_del(oslive, mrb, t->live, k);
+      k = kh_put(oslive, mrb, t->live, obj);
+      kh_value(t->live, k) = i;
+    }
+    break;
+  }
+}
+
+static struct os_trace*
+os_trace_get(mrb_state *mrb)
+{
+  if (mrb->obj_event_func != os_trace_event) return NULL;
+  return (struct os_trace*)mrb->obj_event_ud;
+}
+
+static void
+os_trace_free(mrb_state *mrb, struct os_trace *t)
+{
+  uint32_t i;
+
+  mrb_gc_set_obj_event_func(mrb, NULL, NULL, 0);
+  for (i = 0; i < t->len; i++) {
+    if (t->sites[i].irep) mrb_irep_decref(mrb, t->sites[i].irep);
+  }
+  kh_destroy(ossite, mrb, t->index);
+  kh_destroy(oslive, mrb, t->live);
+  mrb_free(mrb, t->sites);
+  mrb_free(mrb, t->allocated);
+  mrb_free(mrb, t);
+}
+
+/*
+ *  call-seq:
+ *     ObjectSpace.trace_allocations_start(interval = 1)  -> nil
+ *
+ *  Starts counting every <i>interval</i>th object allocation against
+ *  the line that made it; see ObjectSpace.allocation_sites.
+ */
+static mrb_value
+os_trace_allocations_start(mrb_state *mrb, mrb_value self)
+{
+  mrb_int interval = 1;
+  struct os_trace *t;
+
+  mrb_get_args(mrb, "|i", &interval);
+  if (interval < 1 || (uint64_t)interval > UINT32_MAX) {
+    mrb_raise(mrb, E_ARGUMENT_ERROR, "sampling interval out of range");
+  }
+  t = os_trace_get(mrb);
+  if (!t) {
+    if (mrb->obj_event_func) {
+      mrb_raise(mrb, E_RUNTIME_ERROR, "allocations are traced by someone else");
+    }
+    t = (struct os_trace*)mrb_malloc(mrb, sizeof(struct os_trace));
+    t->sites = NULL;
+    t->allocated = NULL;
+    t->len = t->capa = 0;
+    t->index = kh_init(ossite, mrb);
+    t->live = kh_init(oslive, mrb);
+  }
+  mrb_gc_set_obj_event_func(mrb, os_trace_event, t, (uint32_t)interval);
+  return mrb_nil_value();
+}
+
+/*
+ *  call-seq:
+ *     ObjectSpace.trace_allocations_stop  -> nil
+ *
+ *  Stops sampling allocations.  The counts are kept, and the sampled
+ *  objects are still followed for the retained view.
+ */
+static mrb_value
+os_trace_allocations_stop(mrb_state *mrb, mrb_value self)
+{
+  struct os_trace *t = os_trace_get(mrb);
+
+  if (t) {
+    mrb_gc_set_obj_event_func(mrb, os_trace_event, t, 0);
+  }
+  return mrb_nil_value();
+}
+
+/*
+ *  call-seq:
+ *     ObjectSpace.trace_allocations_clear  -> nil
+ *
+ *  Stops tracing and forgets everything recorded.
+ */
+static mrb_value
+os_trace_allocations_clear(mrb_state *mrb, mrb_value self)
+{
+  struct os_trace *t = os_trace_get(mrb);
+
+  if (t) {
+    os_trace_free(mrb, t);
+  }
+  return mrb_nil_value();
+}
+
+struct os_site_count {
+  mrb_sym file;                 /* 0 when unknown */
+  int32_t line;
+  struct RClass *c;
+  enum mrb_vtype tt;
+  mrb_int count;
+};
+
+static int
+os_site_count_key_cmp(const void *a, const void *b)
+{
+  const struct os_site_count *x = (const struct os_site_count*)a;
+  const struct os_site_count *y = (const struct os_site_count*)b;
+
+  if (x->file != y->file) return x->file < y->file ? -1 : 1;
+  if (x->line != y->line) return x->line < y->line ? -1 : 1;
+  if (x->c != y->c) return (uintptr_t)x->c < (uintptr_t)y->c ? -1 : 1;
+  if (x->tt != y->tt) return x->tt < y->tt ? -1 : 1;
+  return 0;
+}
+
+static int
+os_site_count_cmp(const void *a, const void *b)
+{
+  const struct os_site_count *x = (const struct os_site_count*)a;
+  const struct os_site_count *y = (const struct os_site_count*)b;
+
+  if (x->count != y->count) return x->count > y->count ? -1 : 1;
+  return os_site_count_key_cmp(a, b);
+}
+
+/* classes recorded by the sites that are still alive */
+static void
+os_site_class_cb(mrb_state *mrb, struct RBasic *obj, void *data)
+{
+  khash_t(oslive) *classes = (khash_t(oslive)*)data;
+  khiter_t k;
+
+  switch (obj->tt) {
+  case MRB_TT_CLASS:
+  case MRB_TT_MODULE:
+  case MRB_TT_SCLASS:
+    if (is_dead(mrb, obj)) return;
+    k = kh_get(oslive, mrb, classes, obj);
+    if (k != kh_end(classes)) {
+      kh_value(classes, k) = 1;
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+/*
+ *  call-seq:
+ *     ObjectSpace.allocation_sites(retained = false)  -> array
+ *
+ *  Returns the sampled allocations as <code>[file, line, class,
+ *  count]</code> entries, most frequent first.  The class is nil for
+ *  objects that have none and for classes that were freed since.  With
+ *  <i>retained</i>, runs a full GC and counts only the sampled objects
+ *  that are still alive.
+ *
+ *     ObjectSpace.trace_allocations { 3.times { "x" } }
+ *     ObjectSpace.allocation_sites  #=> [["foo.rb", 1, String, 3], ...]
+ */
+static mrb_value
+os_allocation_sites(mrb_state *mrb, mrb_value self)
+{
+  mrb_bool retained = FALSE;
+  struct os_trace *t = os_trace_get(mrb);
+  struct os_site_count *counts;
+  khash_t(oslive) *classes;
+  mrb_value ary;
+  uint32_t i, n;
+  khiter_t k;
+  int ai;
+
+  mrb_get_args(mrb, "|b", &retained);
+  if (!t || t->len == 0) return mrb_ary_new(mrb);
+
+  if (retained) {
+    mrb_full_gc(mrb);
+  }
+  counts = (struct os_site_count*)mrb_malloc(mrb, sizeof(struct os_site_count) * t->len);
+  for (i = 0; i < t->len; i++) {
+    struct os_alloc_site *site = &t->sites[i];
+    const char *file = NULL;
+
+    counts[i].line = -1;
+    if (site->irep) {
+      file = mrb_debug_get_filename(site->irep, site->pc);
+      counts[i].line = mrb_debug_get_line(site->irep, site->pc);
+    }
+    counts[i].file = file ? mrb_intern_cstr(mrb, file) : 0;
+    counts[i].c = site->c;
+    counts[i].tt = site->tt;
+    counts[i].count = retained ? 0 : t->allocated[i];
+  }
+  if (retained) {
+    /* a lazy sweep may not have freed every dead object yet */
+    for (k = kh_begin(t->live); k != kh_end(t->live); k++) {
+      if (kh_exist(t->live, k) && !is_dead(mrb, kh_key(t->live, k))) {
+        counts[kh_value(t->live, k)].count++;
+      }
+    }
+  }
+
+  /* forget the classes that were freed */
+  classes = kh_init(oslive, mrb);
+  for (i = 0; i < t->len; i++) {
+    if (counts[i].c) {
+      k = kh_put(oslive, mrb, classes, (struct RBasic*)counts[i].c);
+      kh_value(classes, k) = 0;
+    }
+  }
+  mrb_objspace_each_objects(mrb, os_site_class_cb, classes);
+  for (i = 0; i < t->len; i++) {
+    if (counts[i].c) {
+      k = kh_get(oslive, mrb, classes, (struct RBasic*)counts[i].c);
+      if (kh_value(classes, k) == 0) counts[i].c = NULL;
+    }
+  }
+  kh_destroy(oslive, mrb, classes);
+
+  /* sum up the sites on the same line */
+  qsort(counts, t->len, sizeof(struct os_site_count), os_site_count_key_cmp);
+  for (i = 0, n = 0; i < t->len; i++) {
+    if (n > 0 && os_site_count_key_cmp(&counts[n-1], &counts[i]) == 0) {
+      counts[n-1].count += counts[i].count;
+    }
+    else {
+      counts[n++] = counts[i];
+    }
+  }
+  qsort(counts, n, sizeof(struct os_site_count), os_site_count_cmp);
+
+  ary = mrb_ary_new_capa(mrb, n);
+  ai = mrb_gc_arena_save(mrb);
+  for (i = 0; i < n; i++) {
+    mrb_value entry[4];
+    const char *file;
+    mrb_int len;
+
+    if (counts[i].count == 0) continue;
+    file = counts[i].file ? mrb_sym2name_len(mrb, counts[i].file, &len) : NULL;
+    entry[0] = file ? mrb_str_new(mrb, file, len) : mrb_nil_value();
+    entry[1] = counts[i].line < 0 ? mrb_nil_value() : mrb_fixnum_value(counts[i].line);
+    entry[2] = counts[i].c ? mrb_obj_value(counts[i].c) : mrb_nil_value();
+    entry[3] = mrb_fixnum_value(counts[i].count);
+    mrb_ary_push(mrb, ary, mrb_ary_new_from_values(mrb, 4, entry));
+    mrb_gc_arena_restore(mrb, ai);
+  }
+  mrb_free(mrb, counts);
+  return ary;
+}
+
 void
 mrb_mruby_objectspace_gem_init(mrb_state *mrb)
 {
   struct RClass *os = mrb_define_module(mrb, "ObjectSpace");
+  struct RClass *wmap;
+
   mrb_define_class_method(mrb, os, "count_objects", os_count_objects, MRB_ARGS_OPT(1));
   mrb_define_class_method(mrb, os, "each_object", os_each_object, MRB_ARGS_OPT(1));
+  mrb_define_class_method(mrb, os, "memsize_of", os_memsize_of, MRB_ARGS_REQ(1));
+  mrb_define_class_method(mrb, os, "memsize_of_all", os_memsize_of_all, MRB_ARGS_NONE());
+  mrb_define_class_method(mrb, os, "dump_all", os_dump_all, MRB_ARGS_REQ(1));
+  mrb_define_class_method(mrb, os, "trace_allocations_start", os_trace_allocations_start, MRB_ARGS_OPT(1));
+  mrb_define_class_method(mrb, os, "trace_allocations_stop", os_trace_allocations_stop, MRB_ARGS_NONE());
+  mrb_define_class_method(mrb, os, "trace_allocations_clear", os_trace_allocations_clear, MRB_ARGS_NONE());
+  mrb_define_class_method(mrb, os, "allocation_sites", os_allocation_sites, MRB_ARGS_OPT(1));
+
+  wmap = mrb_define_class_under(mrb, os, "WeakMap", mrb->object_class);
+  MRB_SET_INSTANCE_TT(wmap, MRB_TT_DATA);
+  mrb_include_module(mrb, wmap, mrb_module_get(mrb, "Enumerable"));
+  mrb_define_method(mrb, wmap, "initialize", os_wmap_initialize, MRB_ARGS_NONE());
+  mrb_define_method(mrb, wmap, "[]=", os_wmap_aset, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, wmap, "[]", os_wmap_aref, MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, wmap, "key?", os_wmap_key_p, MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, wmap, "include?", os_wmap_key_p, MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, wmap, "member?", os_wmap_key_p, MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, wmap, "delete", os_wmap_delete, MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, wmap, "size", os_wmap_size, MRB_ARGS_NONE());
+  mrb_define_method(mrb, wmap, "length", os_wmap_size, MRB_ARGS_NONE());
+  mrb_define_method(mrb, wmap, "keys", os_wmap_keys, MRB_ARGS_NONE());
+  mrb_define_method(mrb, wmap, "values", os_wmap_values, MRB_ARGS_NONE());
+  mrb_define_method(mrb, wmap, "each", os_wmap_each, MRB_ARGS_NONE());
+  mrb_define_method(mrb, wmap, "each_pair", os_wmap_each, MRB_ARGS_NONE());
 }
 
 void
 mrb_mruby_objectspace_gem_final(mrb_state *mrb)
 {
+  struct os_trace *t = os_trace_get(mrb);
+
+  if (t) {
+    os_trace_free(mrb, t);
+  }
 }
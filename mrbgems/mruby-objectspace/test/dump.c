@@ -0,0 +1,37 @@
+#include <stdio.h>
+#include "mruby.h"
+#include "mruby/string.h"
+#include "mruby/objectspace.h"
+
+/* the heap dump of mrb_objspace_dump_all() as a string */
+static mrb_value
+os_test_dump(mrb_state *mrb, mrb_value self)
+{
+  FILE *fp = tmpfile();
+  mrb_value str;
+  char buf[4096];
+  size_t n;
+
+  if (!fp) {
+    mrb_raise(mrb, E_RUNTIME_ERROR, "tmpfile() failed");
+  }
+  if (mrb_objspace_dump_all(mrb, fp) != 0) {
+    fclose(fp);
+    mrb_raise(mrb, E_RUNTIME_ERROR, "mrb_objspace_dump_all() failed");
+  }
+  rewind(fp);
+  str = mrb_str_buf_new(mrb, sizeof(buf));
+  while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+    mrb_str_cat(mrb, str, buf, n);
+  }
+  fclose(fp);
+  return str;
+}
+
+void
+mrb_mruby_objectspace_gem_test(mrb_state *mrb)
+{
+  struct RClass *m = mrb_define_module(mrb, "ObjectSpaceTest");
+
+  mrb_define_module_function(mrb, m, "dump", os_test_dump, MRB_ARGS_NONE());
+}
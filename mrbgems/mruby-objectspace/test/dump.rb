@@ -0,0 +1,55 @@
+assert('ObjectSpace.dump_all') do
+  assert_raise(RuntimeError) { ObjectSpace.dump_all("/nonexistent/dir/heap.dump") }
+end
+
+assert('mrb_objspace_dump_all') do
+  $dump_test = ["dump-me", "x" * 500]
+  lines = ObjectSpaceTest.dump.split("\n")
+  assert_equal "# mruby heap dump 1", lines[0]
+
+  roots = {}
+  root_refs = []
+  objects = {}
+  names = {}
+  lines[1..-1].each do |l|
+    f = l.split(" ")
+    if f[0] == "ROOT"
+      roots[f[1]] = true
+      root_refs << f[2]
+    elsif f[0] == "NAME"
+      names[f[3]] = f[1]
+    else
+      objects[f[0]] = f
+    end
+  end
+  assert_true roots["globals"]
+  assert_true roots["vm"]
+  assert_true roots["stack"]
+
+  # every reference points at a dumped object
+  root_refs.each { |r| assert_true objects.key?(r) }
+  objects.values.each do |f|
+    i = 4
+    while i < f.size
+      assert_true objects.key?(f[i])
+      i += 1
+    end
+  end
+
+  # the global array is reachable from the roots and refers to its strings
+  string = names["String"]
+  big = nil
+  objects.values.each do |f|
+    next unless f[1] == "T_ARRAY"
+    i = 4
+    while i < f.size
+      s = objects[f[i]]
+      big = s if s[1] == "T_STRING" && s[2] == string && s[3].to_i > 500
+      i += 1
+    end
+  end
+  assert_false big.nil?
+  assert_equal "T_CLASS", objects[names["Array"]][1]
+  $dump_test = nil
+  true
+end
@@ -54,3 +54,36 @@ assert('ObjectSpace.each_object') do
   assert_equal arys.length, arys_count
   assert_true arys.length < objs.length
 end
+
+assert('ObjectSpace.count_objects agrees with a heap walk') do
+  GC.start
+  arrays = ObjectSpace.each_object(Array) { }
+  h = ObjectSpace.count_objects
+  assert_equal arrays, h[:T_ARRAY]
+end
+
+assert('ObjectSpace.memsize_of') do
+  assert_equal 0, ObjectSpace.memsize_of(1)
+  assert_equal 0, ObjectSpace.memsize_of(:sym)
+  empty = ObjectSpace.memsize_of([])
+  assert_true empty > 0
+  assert_true ObjectSpace.memsize_of(Array.new(1000, 0)) >= empty + 1000 * 4
+  assert_true ObjectSpace.memsize_of("x" * 10000) > 10000
+  h = {}
+  1000.times { |i| h[i] = i }
+  assert_true ObjectSpace.memsize_of(h) > ObjectSpace.memsize_of({})
+  o = Object.new
+  small = ObjectSpace.memsize_of(o)
+  100.times { |i| o.instance_variable_set("@v#{i}", i) }
+  assert_true ObjectSpace.memsize_of(o) > small
+end
+
+assert('ObjectSpace.memsize_of_all') do
+  GC.start
+  before = ObjectSpace.memsize_of_all
+  a = []
+  200.times { a << "y" * 1000 }
+  GC.start
+  assert_true ObjectSpace.memsize_of_all >= before + 200 * 1000
+  assert_true GC.stat[:payload_bytes] >= 200 * 1000
+end
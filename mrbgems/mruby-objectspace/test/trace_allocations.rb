@@ -0,0 +1,69 @@
+assert('ObjectSpace.trace_allocations') do
+  ObjectSpace.trace_allocations_clear
+  line = nil
+  kept = ObjectSpace.trace_allocations do
+    a = []
+    line = __LINE__; 50.times { a << "x" }
+    a
+  end
+  sites = ObjectSpace.allocation_sites
+  ObjectSpace.trace_allocations_clear
+
+  site = nil
+  sites.each { |s| site = s if s[1] == line && s[2] == String }
+  assert_false site.nil?
+  assert_equal 50, site[3]
+  assert_equal String, site[0].class
+  assert_not_equal '"', site[0][0]
+  assert_equal 50, kept.size
+  assert_equal [], ObjectSpace.allocation_sites
+end
+
+assert('ObjectSpace.trace_allocations attributes C methods to their caller') do
+  ObjectSpace.trace_allocations_clear
+  line = nil
+  ObjectSpace.trace_allocations do
+    line = __LINE__; 10.times { Object.new }
+  end
+  sites = ObjectSpace.allocation_sites
+  ObjectSpace.trace_allocations_clear
+
+  found = sites.select { |s| s[1] == line && s[2] == Object }
+  assert_equal 1, found.size
+  assert_equal 10, found[0][3]
+end
+
+assert('ObjectSpace.trace_allocations samples 1 in interval') do
+  ObjectSpace.trace_allocations_clear
+  line = nil
+  ObjectSpace.trace_allocations(10) do
+    line = __LINE__; 1000.times { "x" }
+  end
+  sites = ObjectSpace.allocation_sites
+  ObjectSpace.trace_allocations_clear
+
+  count = 0
+  sites.each { |s| count += s[3] if s[1] == line && s[2] == String }
+  assert_equal 100, count
+  assert_raise(ArgumentError) { ObjectSpace.trace_allocations_start(0) }
+end
+
+assert('ObjectSpace.allocation_sites(true) counts the retained objects') do
+  ObjectSpace.trace_allocations_clear
+  line = nil
+  kept = []
+  ObjectSpace.trace_allocations do
+    line = __LINE__; 200.times { |i| s = "x#{i}"; kept << s if i % 4 == 0 }
+  end
+  all = ObjectSpace.allocation_sites
+  retained = ObjectSpace.allocation_sites(true)
+  ObjectSpace.trace_allocations_clear
+
+  allocated = 0
+  all.each { |s| allocated += s[3] if s[1] == line && s[2] == String }
+  live = 0
+  retained.each { |s| live += s[3] if s[1] == line && s[2] == String }
+  assert_true allocated >= 200
+  assert_equal 50, live
+  assert_equal 50, kept.size
+end
@@ -0,0 +1,51 @@
+def weakmap_add_garbage(m, n)
+  n.times { |i| m["k#{i}"] = "v#{i}" }
+end
+
+assert('ObjectSpace::WeakMap') do
+  m = ObjectSpace::WeakMap.new
+  k = "key"
+  v = "value"
+  assert_equal v, (m[k] = v)
+  assert_true m[k].equal?(v)
+  assert_nil m["key"]
+  assert_true m.key?(k)
+  assert_false m.include?("key")
+  m[1] = :one
+  assert_equal :one, m[1]
+  assert_equal 2, m.size
+  assert_equal [[k, v], [1, :one]].sort_by { |e| e.to_s }, m.to_a.sort_by { |e| e.to_s }
+  assert_equal v, m.delete(k)
+  assert_nil m.delete(k)
+  assert_equal [1], m.keys
+  assert_equal [:one], m.values
+end
+
+assert('ObjectSpace::WeakMap drops collected entries') do
+  m = ObjectSpace::WeakMap.new
+  k = "k"
+  v = "v"
+  m[k] = v
+  m[k.dup] = v
+  m[k] = v.dup
+  weakmap_add_garbage(m, 100)
+  assert_equal 102, m.size
+  GC.start
+  assert_equal 0, m.size
+  m[k] = v
+  m[1] = v
+  weakmap_add_garbage(m, 100)
+  GC.start
+  assert_equal 2, m.size
+  assert_true m[k].equal?(v)
+end
+
+assert('ObjectSpace::WeakMap after GC.compact') do
+  m = ObjectSpace::WeakMap.new
+  keys = []
+  30_000.times { |i| s = "key#{i}"; keys << s if i % 100 == 0 }
+  keys.each_with_index { |k, i| m[k] = i }
+  GC.compact
+  assert_equal 300, m.size
+  assert_true keys.all? { |k| m[k] == keys.index(k) }
+end
@@ -0,0 +1,167 @@
+#!/usr/bin/env ruby
+#
+# heap_analyze.rb - retained sizes of an ObjectSpace.dump_all heap dump
+#
+#   ruby heap_analyze.rb [-n COUNT] heap.dump
+#
+# Builds the object graph of the dump, computes the dominator tree
+# from a virtual root connected to every ROOT record (Cooper, Harvey
+# and Kennedy, "A Simple, Fast Dominance Algorithm"), and prints the
+# objects and classes retaining the most memory.  An object's retained
+# size is the total size of the objects that would be freed with it.
+
+count = 20
+if ARGV[0] == "-n"
+  ARGV.shift
+  count = Integer(ARGV.shift)
+end
+if ARGV.size != 1
+  $stderr.puts "usage: #{$0} [-n COUNT] heap.dump"
+  exit 1
+end
+
+index = {}        # address => node; node 0 is the virtual root
+addrs = [nil]
+types = [nil]
+klass = [nil]
+sizes = [0]
+edges = [[]]
+names = {}
+outer = {}
+
+node = lambda do |addr|
+  index[addr] ||= begin
+    addrs << addr
+    types << nil
+    klass << nil
+    sizes << 0
+    edges << []
+    addrs.size - 1
+  end
+end
+
+File.open(ARGV[0]) do |f|
+  header = f.gets
+  unless header && header.start_with?("# mruby heap dump ")
+    abort "#{ARGV[0]}: not an mruby heap dump"
+  end
+  f.each_line do |line|
+    rec = line.split
+    case rec[0]
+    when "ROOT"
+      edges[0] << node.(rec[2])
+    when "NAME"
+      names[rec[1]] = rec[3]
+      outer[rec[1]] = rec[2]
+    else
+      n = node.(rec[0])
+      types[n] = rec[1]
+      klass[n] = rec[2]
+      sizes[n] = rec[3].to_i
+      edges[n] = rec[4..-1].map { |r| node.(r) }
+    end
+  end
+end
+
+class_name = lambda do |addr|
+  n = index[addr]
+  next "(singleton class)" if n && types[n] == "T_SCLASS"
+  parts = []
+  while addr && addr != "0" && names[addr]
+    parts.unshift(names[addr])
+    addr = outer[addr]
+  end
+  parts.empty? ? "(anonymous #{addr})" : parts.join("::")
+end
+
+# reverse postorder from the virtual root, iteratively
+nodes = addrs.size
+order = []
+visited = Array.new(nodes, false)
+stack = [[0, 0]]
+visited[0] = true
+until stack.empty?
+  top = stack.last
+  succ = edges[top[0]]
+  if top[1] < succ.size
+    s = succ[top[1]]
+    top[1] += 1
+    unless visited[s]
+      visited[s] = true
+      stack << [s, 0]
+    end
+  else
+    order << top[0]
+    stack.pop
+  end
+end
+order.reverse!
+rpo = Array.new(nodes)
+order.each_with_index { |n, i| rpo[n] = i }
+
+preds = Array.new(nodes) { [] }
+order.each { |n| edges[n].each { |s| preds[s] << n } }
+
+idom = Array.new(nodes)
+idom[0] = 0
+changed = true
+while changed
+  changed = false
+  order.each do |n|
+    next if n == 0
+    dom = nil
+    preds[n].each do |p|
+      next unless idom[p]
+      if dom.nil?
+        dom = p
+        next
+      end
+      a = p
+      while a != dom
+        a = idom[a] while rpo[a] > rpo[dom]
+        dom = idom[dom] while rpo[dom] > rpo[a]
+      end
+    end
+    if idom[n] != dom
+      idom[n] = dom
+      changed = true
+    end
+  end
+end
+
+# retained size: own size plus that of every object dominated,
+# accumulated bottom-up in reverse of the reverse postorder
+retained = sizes.dup
+order.reverse_each do |n|
+  retained[idom[n]] += retained[n] if n != 0
+end
+
+reachable = order.size - 1
+puts "#{reachable} reachable objects, #{retained[0]} bytes"
+puts
+
+puts "largest retainers:"
+puts "%12s %12s  %-10s %s" % ["retained", "self", "type", "object"]
+(order - [0]).sort_by { |n| -retained[n] }.first(count).each do |n|
+  desc = names[addrs[n]] ? class_name.(addrs[n]) : class_name.(klass[n])
+  puts "%12d %12d  %-10s %s %s" % [retained[n], sizes[n], types[n], addrs[n], desc]
+end
+puts
+
+# per class: objects, their own bytes and what they retain as the
+# topmost instance of the class on their dominator chain
+by_class = Hash.new { |h, k| h[k] = [0, 0, 0] }
+order.each do |n|
+  next if n == 0
+  c = by_class[klass[n]]
+  c[0] += 1
+  c[1] += sizes[n]
+  d = idom[n]
+  d = idom[d] while d != 0 && klass[d] != klass[n]
+  c[2] += retained[n] if d == 0
+end
+puts "by class:"
+puts "%12s %12s %8s  %s" % ["retained", "self", "count", "class"]
+by_class.sort_by { |_, c| -c[2] }.first(count).each do |k, c|
+  puts "%12d %12d %8d  %s" % [c[2], c[1], c[0], class_name.(k)]
+end
@@ -0,0 +1,64 @@
+/*
+** mruby/slab.h - size class slab allocator
+**
+** See Copyright Notice in mruby.h
+*/
+
+#ifndef MRUBY_SLAB_H
+#define MRUBY_SLAB_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*
+ * An mrb_allocf that serves blocks of up to MRB_SLAB_MAX_SMALL bytes
+ * from per size class slabs of MRB_SLAB_SIZE bytes and passes larger
+ * ones to realloc().  A block keeps its size class while it is resized
+ * within it, so buffers growing a little at a time mostly stay in
+ * place.  Empty slabs are given back to the system except for one per
+ * size class.  Blocks are 8-byte aligned.  A slab allocator serves one
+ * mrb_state; it takes a lock only with MRB_GC_BACKGROUND_FREE, whose
+ * freer thread calls it as well.
+ *
+ *   mrb_state *mrb = mrb_slab_open();
+ *   ...
+ *   mrb_slab_close(mrb);
+ *
+ * or, with a slab of its own:
+ *
+ *   mrb_slab *slab = mrb_slab_new();
+ *   mrb_state *mrb = mrb_open_allocf(mrb_slab_allocf, slab);
+ *   ...
+ *   mrb_close(mrb);
+ *   mrb_slab_delete(slab);
+ */
+typedef struct mrb_slab mrb_slab;
+
+struct mrb_slab_stats {
+  size_t slabs;                 /* slabs held */
+  size_t slab_bytes;            /* bytes of the slabs held */
+  size_t small_blocks;          /* blocks handed out from slabs */
+  size_t small_bytes;           /* size class bytes of those blocks */
+  size_t large_blocks;          /* blocks handed out by realloc() */
+  size_t large_bytes;           /* requested bytes of those blocks */
+  size_t allocs;                /* blocks allocated */
+  size_t frees;                 /* blocks freed */
+  size_t reallocs;              /* blocks resized */
+  size_t in_place;              /* resizes that kept the block */
+};
+
+mrb_slab *mrb_slab_new(void);
+void mrb_slab_delete(mrb_slab *slab);
+void *mrb_slab_allocf(struct mrb_state *mrb, void *p, size_t size, void *ud);
+void mrb_slab_stats(mrb_slab *slab, struct mrb_slab_stats *stats);
+
+/* mrb_open() on a slab allocator of its own; mrb_slab_close() frees both */
+struct mrb_state *mrb_slab_open(void);
+void mrb_slab_close(struct mrb_state *mrb);
+
+#if defined(__cplusplus)
+}  /* extern "C" { */
+#endif
+
+#endif  /* MRUBY_SLAB_H */
@@ -0,0 +1,383 @@
+/*
+** slab.c - size class slab allocator
+**
+** See Copyright Notice in mruby.h
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#ifdef MRB_GC_BACKGROUND_FREE
+#include <pthread.h>
+#endif
+#include "mruby.h"
+#include "mruby/hash.h"
+#include "mruby/slab.h"
+
+#ifndef MRB_SLAB_SIZE
+#define MRB_SLAB_SIZE (64 * 1024)
+#endif
+#define MRB_SLAB_MAX_SMALL 2048
+
+/* usable bytes of the blocks of each size class, four per power of two */
+static const uint16_t slab_class_size[] = {
+  8, 16, 24, 32, 48, 64, 80, 96, 112, 128,
+  160, 192, 224, 256, 320, 384, 448, 512,
+  640, 768, 896, 1024, 1280, 1536, 1792, 2048,
+};
+
+#define SLAB_CLASSES (sizeof(slab_class_size) / sizeof(slab_class_size[0]))
+
+/*
+  Every block is preceded by a header word: the slab it was carved from,
+  or (size << 1) | 1 for a block from realloc(). A freed block is linked
+  into the freelist of its slab through its first word.
+*/
+typedef uintptr_t slab_header;
+
+#define LARGE_P(h) ((h) & 1)
+#define LARGE_SIZE(h) ((size_t)((h) >> 1))
+#define BLOCK_STRIDE(cls) (sizeof(slab_header) + slab_class_size[cls])
+#define FIRST_BLOCK ((sizeof(struct slab_page) + 7) & ~(size_t)7)
+
+struct slab_page {
+  struct slab_page *prev;       /* slabs of the class with free blocks */
+  struct slab_page *next;
+  struct slab_page *all_prev;   /* every slab held */
+  struct slab_page *all_next;
+  char *freelist;               /* headers of freed blocks */
+  size_t bump;                  /* offset of the blocks never handed out */
+  size_t used;                  /* blocks handed out */
+  unsigned int cls;
+};
+
+struct mrb_slab {
+  struct slab_page *partial[SLAB_CLASSES];
+  struct slab_page *all;
+  struct mrb_slab_stats stats;
+#ifdef MRB_GC_BACKGROUND_FREE
+  pthread_mutex_t lock;         /* the freer thread frees payloads too */
+#endif
+};
+
+#ifdef MRB_GC_BACKGROUND_FREE
+#define SLAB_LOCK(s) pthread_mutex_lock(&(s)->lock)
+#define SLAB_UNLOCK(s) pthread_mutex_unlock(&(s)->lock)
+#else
+#define SLAB_LOCK(s)
+#define SLAB_UNLOCK(s)
+#endif
+
+static unsigned int
+slab_class_of(size_t size)
+{
+  unsigned int lo = 0, hi = SLAB_CLASSES - 1;
+
+  while (lo < hi) {
+    unsigned int mid = (lo + hi) / 2;
+
+    if (slab_class_size[mid] < size) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+static mrb_bool
+slab_full_p(struct slab_page *page)
+{
+  return page->freelist == NULL && page->bump + BLOCK_STRIDE(page->cls) > MRB_SLAB_SIZE;
+}
+
+static void
+slab_link(mrb_slab *s, struct slab_page *page)
+{
+  page->prev = NULL;
+  page->next = s->partial[page->cls];
+  if (page->next) page->next->prev = page;
+  s->partial[page->cls] = page;
+}
+
+static void
+slab_unlink(mrb_slab *s, struct slab_page *page)
+{
+  if (page->prev) page->prev->next = page->next;
+  else s->partial[page->cls] = page->next;
+  if (page->next) page->next->prev = page->prev;
+  page->prev = page->next = NULL;
+}
+
+static struct slab_page*
+slab_page_new(mrb_slab *s, unsigned int cls)
+{
+  struct slab_page *page = (struct slab_page*)malloc(MRB_SLAB_SIZE);
+
+  if (page == NULL) return NULL;
+  page->freelist = NULL;
+  page->bump = FIRST_BLOCK;
+  page->used = 0;
+  page->cls = cls;
+  page->all_prev = NULL;
+  page->all_next = s->all;
+  if (s->all) s->all->all_prev = page;
+  s->all = page;
+  slab_link(s, page);
+  s->stats.slabs++;
+  s->stats.slab_bytes += MRB_SLAB_SIZE;
+  return page;
+}
+
+static void
+slab_page_free(mrb_slab *s, struct slab_page *page)
+{
+  slab_unlink(s, page);
+  if (page->all_prev) page->all_prev->all_next = page->all_next;
+  else s->all = page->all_next;
+  if (page->all_next) page->all_next->all_prev = page->all_prev;
+  s->stats.slabs--;
+  s->stats.slab_bytes -= MRB_SLAB_SIZE;
+  free(page);
+}
+
+static void*
+slab_alloc(mrb_slab *s, size_t size)
+{
+  struct slab_page *page;
+  unsigned int cls;
+  char *h;
+
+  if (size > MRB_SLAB_MAX_SMALL) {
+    slab_header *lh;
+
+    if (size > SIZE_MAX / 2 - sizeof(slab_header)) return NULL;
+    lh = (slab_header*)malloc(sizeof(slab_header) + size);
+    if (lh == NULL) return NULL;
+    *lh = ((slab_header)size << 1) | 1;
+    s->stats.large_blocks++;
+    s->stats.large_bytes += size;
+    return lh + 1;
+  }
+
+  cls = slab_class_of(size);
+  page = s->partial[cls];
+  if (page == NULL) {
+    page = slab_page_new(s, cls);
+    if (page == NULL) return NULL;
+  }
+  if (page->freelist) {
+    h = page->freelist;
+    page->freelist = *(char**)(h + sizeof(slab_header));
+  }
+  else {
+    h = (char*)page + page->bump;
+    page->bump += BLOCK_STRIDE(cls);
+  }
+  page->used++;
+  if (slab_full_p(page)) {
+    slab_unlink(s, page);
+  }
+  *(slab_header*)h = (slab_header)page;
+  s->stats.small_blocks++;
+  s->stats.small_bytes += slab_class_size[cls];
+  return h + sizeof(slab_header);
+}
+
+static void
+slab_free(mrb_slab *s, void *p)
+{
+  slab_header *h = (slab_header*)p - 1;
+  struct slab_page *page;
+
+  if (LARGE_P(*h)) {
+    s->stats.large_blocks--;
+    s->stats.large_bytes -= LARGE_SIZE(*h);
+    free(h);
+    return;
+  }
+
+  page = (struct slab_page*)*h;
+  if (slab_full_p(page)) {
+    slab_link(s, page);
+  }
+  *(char**)p = page->freelist;
+  page->freelist = (char*)h;
+  page->used--;
+  s->stats.small_blocks--;
+  s->stats.small_bytes -= slab_class_size[page->cls];
+  if (page->used == 0) {
+    if (page->prev || page->next) {
+      slab_page_free(s, page);
+    }
+    else {
+      /* the last slab of its class stays, handing out blocks in order again */
+      page->freelist = NULL;
+      page->bump = FIRST_BLOCK;
+    }
+  }
+}
+
+static void*
+slab_allocf(mrb_slab *s, void *p, size_t size)
+{
+  slab_header h;
+  size_t old;
+  void *q;
+
+  if (size == 0) {
+    if (p) {
+      s->stats.frees++;
+      slab_free(s, p);
+    }
+    return NULL;
+  }
+  if (p == NULL) {
+    q = slab_alloc(s, size);
+    if (q) s->stats.allocs++;
+    return q;
+  }
+
+  s->stats.reallocs++;
+  h = ((slab_header*)p)[-1];
+  if (LARGE_P(h)) {
+    old = LARGE_SIZE(h);
+    if (size > MRB_SLAB_MAX_SMALL) {
+      slab_header *lh;
+
+      if (size > SIZE_MAX / 2 - sizeof(slab_header)) return NULL;
+      lh = (slab_header*)realloc((slab_header*)p - 1, sizeof(slab_header) + size);
+      if (lh == NULL) return NULL;
+      *lh = ((slab_header)size << 1) | 1;
+      s->stats.large_bytes += size - old;
+      return lh + 1;
+    }
+  }
+  else {
+    old = slab_class_size[((struct slab_page*)h)->cls];
+    /* keep the block unless it would be less than half used */
+    if (size <= old && size > old / 2) {
+      s->stats.in_place++;
+      return p;
+    }
+  }
+  q = slab_alloc(s, size);
+  if (q == NULL) return NULL;
+  memcpy(q, p, old < size ? old : size);
+  slab_free(s, p);
+  return q;
+}
+
+void*
+mrb_slab_allocf(mrb_state *mrb, void *p, size_t size, void *ud)
+{
+  mrb_slab *s = (mrb_slab*)ud;
+  void *q;
+
+  SLAB_LOCK(s);
+  q = slab_allocf(s, p, size);
+  SLAB_UNLOCK(s);
+  return q;
+}
+
+mrb_slab*
+mrb_slab_new(void)
+{
+  mrb_slab *s = (mrb_slab*)malloc(sizeof(mrb_slab));
+
+  if (s) {
+    memset(s, 0, sizeof(mrb_slab));
+#ifdef MRB_GC_BACKGROUND_FREE
+    pthread_mutex_init(&s->lock, NULL);
+#endif
+  }
+  return s;
+}
+
+/* blocks still handed out from slabs go with them */
+void
+mrb_slab_delete(mrb_slab *s)
+{
+  while (s->all) {
+    struct slab_page *page = s->all;
+
+    s->all = page->all_next;
+    free(page);
+  }
+#ifdef MRB_GC_BACKGROUND_FREE
+  pthread_mutex_destroy(&s->lock);
+#endif
+  free(s);
+}
+
+void
+mrb_slab_stats(mrb_slab *s, struct mrb_slab_stats *stats)
+{
+  SLAB_LOCK(s);
+  *stats = s->stats;
+  SLAB_UNLOCK(s);
+}
+
+mrb_state*
+mrb_slab_open(void)
+{
+  mrb_slab *s = mrb_slab_new();
+  mrb_state *mrb;
+
+  if (s == NULL) return NULL;
+  mrb = mrb_open_allocf(mrb_slab_allocf, s);
+  if (mrb == NULL) {
+    mrb_slab_delete(s);
+  }
+  return mrb;
+}
+
+void
+mrb_slab_close(mrb_state *mrb)
+{
+  mrb_slab *s = (mrb_slab*)mrb->ud;
+
+  mrb_close(mrb);
+  mrb_slab_delete(s);
+}
+
+/*
+ *  call-seq:
+ *     SlabAllocator.stats -> hash or nil
+ *
+ *  Returns the statistics of the slab allocator the interpreter runs
+ *  on, or nil if it allocates through another allocf.
+ */
+static mrb_value
+slab_stats(mrb_state *mrb, mrb_value self)
+{
+  struct mrb_slab_stats st;
+  mrb_value hash;
+
+  if (mrb->allocf != mrb_slab_allocf) return mrb_nil_value();
+  mrb_slab_stats((mrb_slab*)mrb->ud, &st);
+  hash = mrb_hash_new(mrb);
+#define SLAB_STAT_SET(name, v) \
+  mrb_hash_set(mrb, hash, mrb_symbol_value(mrb_intern_lit(mrb, name)), mrb_fixnum_value((mrb_int)(v)))
+  SLAB_STAT_SET("slabs", st.slabs);
+  SLAB_STAT_SET("slab_bytes", st.slab_bytes);
+  SLAB_STAT_SET("small_blocks", st.small_blocks);
+  SLAB_STAT_SET("small_bytes", st.small_bytes);
+  SLAB_STAT_SET("large_blocks", st.large_blocks);
+  SLAB_STAT_SET("large_bytes", st.large_bytes);
+  SLAB_STAT_SET("allocs", st.allocs);
+  SLAB_STAT_SET("frees", st.frees);
+  SLAB_STAT_SET("reallocs", st.reallocs);
+  SLAB_STAT_SET("in_place", st.in_place);
+#undef SLAB_STAT_SET
+  return hash;
+}
+
+void
+mrb_mruby_slab_gem_init(mrb_state *mrb)
+{
+  struct RClass *m = mrb_define_module(mrb, "SlabAllocator");
+
+  mrb_define_module_function(mrb, m, "stats", slab_stats, MRB_ARGS_NONE());
+}
+
+void
+mrb_mruby_slab_gem_final(mrb_state *mrb)
+{
+}
@@ -0,0 +1,56 @@
+#include "mruby.h"
+#include "mruby/compile.h"
+#include "mruby/hash.h"
+#include "mruby/string.h"
+#include "mruby/slab.h"
+
+#define SET(h, name, v) \
+  mrb_hash_set(mrb, h, mrb_symbol_value(mrb_intern_lit(mrb, name)), mrb_fixnum_value((mrb_int)(v)))
+
+/* run code in an interpreter of its own on a slab allocator */
+static mrb_value
+slab_test_run(mrb_state *mrb, mrb_value self)
+{
+  char *code;
+  mrb_slab *slab;
+  mrb_state *mrb2;
+  mrb_value v, hash, result;
+  struct mrb_slab_stats live, closed;
+
+  mrb_get_args(mrb, "z", &code);
+  slab = mrb_slab_new();
+  mrb2 = mrb_open_allocf(mrb_slab_allocf, slab);
+  if (mrb2 == NULL) {
+    mrb_slab_delete(slab);
+    mrb_raise(mrb, E_RUNTIME_ERROR, "mrb_open_allocf() failed");
+  }
+  v = mrb_load_string(mrb2, code);
+  if (mrb2->exc) {
+    v = mrb_obj_value(mrb2->exc);
+  }
+  v = mrb_inspect(mrb2, v);
+  result = mrb_str_new(mrb, RSTRING_PTR(v), RSTRING_LEN(v));
+  mrb_slab_stats(slab, &live);
+  mrb_close(mrb2);
+  mrb_slab_stats(slab, &closed);
+  mrb_slab_delete(slab);
+
+  hash = mrb_hash_new(mrb);
+  mrb_hash_set(mrb, hash, mrb_symbol_value(mrb_intern_lit(mrb, "result")), result);
+  SET(hash, "in_place", live.in_place);
+  SET(hash, "blocks", live.small_blocks + live.large_blocks);
+  SET(hash, "closed_blocks", closed.small_blocks + closed.large_blocks);
+  SET(hash, "closed_bytes", closed.small_bytes + closed.large_bytes);
+  SET(hash, "closed_slabs", closed.slabs);
+  SET(hash, "allocs", closed.allocs);
+  SET(hash, "frees", closed.frees);
+  return hash;
+}
+
+void
+mrb_mruby_slab_gem_test(mrb_state *mrb)
+{
+  struct RClass *m = mrb_define_module(mrb, "SlabTest");
+
+  mrb_define_module_function(mrb, m, "run", slab_test_run, MRB_ARGS_REQ(1));
+}
@@ -0,0 +1,32 @@
+assert('SlabAllocator.stats') do
+  # mrbtest runs on the default allocator
+  assert_nil SlabAllocator.stats
+end
+
+assert('mrb_slab_allocf') do
+  r = SlabTest.run(<<'CODE')
+    s = ""
+    1000.times { |i| s << i.to_s }
+    a = []
+    20_000.times { |i| a << [i, "v#{i}"] }
+    h = {}
+    5000.times { |i| h[i] = i.to_s * 3 }
+    a = nil
+    GC.start
+    st = SlabAllocator.stats
+    [s.size, h.size, h[4999], st[:small_blocks] > 0, st[:slabs] > 0]
+CODE
+  assert_equal '[2890, 5000, "499949994999", true, true]', r[:result]
+  assert_true r[:blocks] > 0
+  assert_true r[:in_place] > 0
+  assert_equal r[:allocs], r[:frees]
+  assert_equal 0, r[:closed_blocks]
+  assert_equal 0, r[:closed_bytes]
+  assert_true r[:closed_slabs] <= 26
+end
+
+assert('mrb_slab_allocf reports exceptions') do
+  r = SlabTest.run('raise ArgumentError, "boom"')
+  assert_equal "ArgumentError: boom", r[:result]
+  assert_equal 0, r[:closed_blocks]
+end
@@ -68,46 +68,6 @@ sign_bits(int base, const char *p)
   return c;
 }
 
-static mrb_value
-mrb_fix2binstr(mrb_state *mrb, mrb_value x, int base)
-{
-  char buf[64], *b = buf + sizeof buf;
-  mrb_int num = mrb_fixnum(x);
-  unsigned long val = (unsigned long)num;
-  char d;
-
-  if (base != 2) {
-    mrb_raisef(mrb, E_ARGUMENT_ERROR, "invalid radix %S", mrb_fixnum_value(base));
-  }
-
-  if (val >= (1 << 10))
-    val &= 0x3ff;
-
-  if (val == 0) {
-    return mrb_str_new_lit(mrb, "0");
-  }
-  *--b = '\0';
-  do {
-    *--b = mrb_digitmap[(int)(val % base)];
-  } while (val /= base);
-
-  if (num < 0) {
-    b = remove_sign_bits(b, base);
-    switch (base) {
-    case 16: d = 'f'; break;
-    case 8:  d = '7'; break;
-    case 2:  d = '1'; break;
-    default: d = 0;   break;
-    }
-
-    if (d && *b != d) {
-      *--b = d;
-    }
-  }
-
-  return mrb_str_new_cstr(mrb, b);
-}
-
 #define FNONE  0
 #define FSHARP 1
 #define FMINUS 2
@@ -763,11 +723,11 @@ retry:
       case 'B':
       case 'u': {
         mrb_value val = GETARG();
-        char fbuf[32], nbuf[64], *s;
+        char fbuf[32], nbuf[72], *s;
         const char *prefix = NULL;
         int sign = 0, dots = 0;
         char sc = 0;
-        mrb_int v = 0, org_v = 0;
+        mrb_int v = 0;
         int base;
         mrb_int len;
 
@@ -804,6 +764,10 @@ retry:
               val = mrb_fixnum_value((mrb_int)mrb_float(val));
               goto bin_retry;
             }
+            if (mrb->bignum_class) {
+              val = mrb_funcall(mrb, val, "to_i", 0);
+              goto bin_retry;
+            }
             val = mrb_flo_to_fixnum(mrb, val);
             if (mrb_fixnum_p(val)) goto bin_retry;
             break;
@@ -814,6 +778,9 @@ retry:
             v = mrb_fixnum(val);
             break;
           default:
+            if (mrb->bignum_class && mrb_obj_is_kind_of(mrb, val, mrb->bignum_class)) {
+              break;
+            }
             val = mrb_Integer(mrb, val);
             goto bin_retry;
         }
@@ -834,26 +801,54 @@ retry:
             base = 10; break;
         }
 
-        if (base == 2) {
-          org_v = v;
-          if ( v < 0 && !sign ) {
-            val = mrb_fix2binstr(mrb, mrb_fixnum_value(v), base);
-            dots = 1;
+        if (!mrb_fixnum_p(val)) {
+          /* a Bignum: the digits come from its to_s(base) */
+          mrb_value str = mrb_funcall(mrb, val, "to_s", 1, mrb_fixnum_value(base));
+
+          s = RSTRING_PTR(str);
+          if (*s != '-') {
+            if (flags & FPLUS) {
+              sc = '+';
+              width--;
+            }
+            else if (flags & FSPACE) {
+              sc = ' ';
+              width--;
+            }
+          }
+          else if (sign) {
+            sc = '-';
+            width--;
+            s++;
           }
           else {
-            val = mrb_fixnum_to_str(mrb, mrb_fixnum_value(v), base);
+            /* two's complement in one digit more than the magnitude has */
+            mrb_value m = mrb_funcall(mrb, mrb_fixnum_value(base), "**", 1, mrb_fixnum_value(RSTRING_LEN(str)));
+
+            str = mrb_funcall(mrb, mrb_funcall(mrb, val, "+", 1, m), "to_s", 1, mrb_fixnum_value(base));
+            s = remove_sign_bits(RSTRING_PTR(str), base);
+            *--s = sign_bits(base, p);
+            dots = 1;
           }
-          v = mrb_fixnum(mrb_str_to_inum(mrb, val, 10, FALSE));
         }
-        if (sign) {
-          char c = *p;
-          if (c == 'i') c = 'd'; /* %d and %i are identical */
-          if (base == 2) c = 'd';
-          if (v < 0) {
-            v = -v;
+        else if (base == 2) {
+          /* the bits of the magnitude, or of the two's complement */
+          uint64_t u = (v < 0 && sign) ? -(uint64_t)v : (uint64_t)v;
+
+          s = nbuf + sizeof(nbuf);
+          *--s = '\0';
+          do {
+            *--s = '0' + (int)(u & 1);
+          } while (u >>= 1);
+          if (v < 0 && sign) {
             sc = '-';
             width--;
           }
+          else if (v < 0) {
+            s = remove_sign_bits(s, base);
+            *--s = '1';
+            dots = 1;
+          }
           else if (flags & FPLUS) {
             sc = '+';
             width--;
@@ -862,33 +857,50 @@ retry:
             sc = ' ';
             width--;
           }
-          snprintf(fbuf, sizeof(fbuf), "%%l%c", c);
-          snprintf(nbuf, sizeof(nbuf), fbuf, v);
-          s = nbuf;
         }
         else {
-          char c = *p;
-          if (c == 'X') c = 'x';
-          if (base == 2) c = 'd';
-          s = nbuf;
-          if (v < 0) {
-            dots = 1;
+          if (sign) {
+            char c = *p;
+            if (c == 'i') c = 'd'; /* %d and %i are identical */
+            if (v < 0) {
+              v = -v;
+              sc = '-';
+              width--;
+            }
+            else if (flags & FPLUS) {
+              sc = '+';
+              width--;
+            }
+            else if (flags & FSPACE) {
+              sc = ' ';
+              width--;
+            }
+            snprintf(fbuf, sizeof(fbuf), "%%l%c", c);
+            snprintf(nbuf, sizeof(nbuf), fbuf, v);
+            s = nbuf;
           }
-          snprintf(fbuf, sizeof(fbuf), "%%l%c", c);
-          snprintf(++s, sizeof(nbuf) - 1, fbuf, v);
-          if (v < 0) {
-            char d;
-
-            s = remove_sign_bits(s, base);
-            switch (base) {
-              case 16: d = 'f'; break;
-              case 8:  d = '7'; break;
-              case 2:  d = '1'; break;
-              default: d = 0; break;
+          else {
+            char c = *p;
+            if (c == 'X') c = 'x';
+            s = nbuf;
+            if (v < 0) {
+              dots = 1;
             }
+            snprintf(fbuf, sizeof(fbuf), "%%l%c", c);
+            snprintf(++s, sizeof(nbuf) - 1, fbuf, v);
+            if (v < 0) {
+              char d;
+
+              s = remove_sign_bits(s, base);
+              switch (base) {
+                case 16: d = 'f'; break;
+                case 8:  d = '7'; break;
+                default: d = 0; break;
+              }
 
-            if (d && *s != d) {
-              *--s = d;
+              if (d && *s != d) {
+                *--s = d;
+              }
             }
           }
         }
@@ -965,7 +977,7 @@ retry:
         CHECK(prec - len);
         if (dots) PUSH("..", 2);
 
-        if (v < 0 || (base == 2 && org_v < 0)) {
+        if (dots) {
           char c = sign_bits(base, p);
           while (len < prec--) {
             buf[blen++] = c;
@@ -1039,6 +1051,39 @@ retry:
           break;
         }
 
+        if (*p != 'a' && *p != 'A' && (!(flags&FPREC) || prec <= 64)) {
+          char nbuf[96];
+          char sc = '\0';
+          int nlen;
+
+          /* exact fast path; snprintf below handles what it declines */
+          nlen = mrb_flo_format(nbuf, sizeof(nbuf), (mrb_float)fval, *p,
+                                (flags&FPREC) ? (int)prec : 6, flags&FSHARP);
+          if (nlen >= 0) {
+            mrb_int pad = 0;
+
+            if (signbit(fval))
+              sc = '-';
+            else if (flags & FPLUS)
+              sc = '+';
+            else if (flags & FSPACE)
+              sc = ' ';
+            need = nlen + (sc ? 1 : 0);
+            if ((flags&FWIDTH) && need < width)
+              pad = width - need;
+            if (!(flags & (FMINUS|FZERO)))
+              FILL(' ', pad);
+            if (sc)
+              PUSH(&sc, 1);
+            if ((flags & FZERO) && !(flags & FMINUS))
+              FILL('0', pad);
+            PUSH(nbuf, nlen);
+            if (flags & FMINUS)
+              FILL(' ', pad);
+            break;
+          }
+        }
+
         fmt_setup(fbuf, sizeof(fbuf), *p, flags, width, prec);
         need = 0;
         if (*p != 'e' && *p != 'E') {
@@ -1,3 +1,49 @@
 ##
 # Kernel#sprintf Kernel#format Test
 
+
+assert('Kernel#sprintf float conversions') do
+  assert_equal "3.141590", sprintf("%f", 3.14159)
+  assert_equal "-1.235e+04", sprintf("%.3e", -12345.678)
+  assert_equal "0.0001", sprintf("%g", 0.0001)
+  assert_equal "1E-10", sprintf("%G", 1e-10)
+  assert_equal "      2.50|-2.50     ", sprintf("%10.2f|%-10.2f", 2.5, -2.5)
+  assert_equal "+00001.500", sprintf("%+010.3f", 1.5)
+  assert_equal " 100000", sprintf("% g", 100000.0)
+  assert_equal "2.|1.50000", sprintf("%#.0f|%#g", 2.0, 1.5)
+  assert_equal "0.12|0.2|2", sprintf("%.2f|%.1f|%.0f", 0.125, 0.25, 2.5)
+end
+
+assert('Kernel#sprintf float conversions of doubles') do
+  skip "Float is single precision" unless 1.0 + 1.0e-15 > 1.0
+  assert_equal "1.00000000000000005250e+300", sprintf("%.20e", 1e300)
+end
+
+assert('Kernel#sprintf integer conversions of Bignum') do
+  if Object.const_defined?(:Bignum)
+    b = 2**70
+    assert_equal "1180591620717411303424", sprintf("%d", b)
+    assert_equal "-1180591620717411303424", sprintf("%i", -b)
+    assert_equal "200000000000000000000000", sprintf("%o", b)
+    assert_equal "..7600000000000000000000000", sprintf("%o", -b)
+    assert_equal "0x400000000000000000", sprintf("%#x", b)
+    assert_equal "..FC00000000000000000", sprintf("%X", -b)
+    assert_equal "1" + "0" * 70, sprintf("%b", b)
+    assert_equal "+1180591620717411303424", sprintf("%+d", b)
+    assert_equal "        1180591620717411303424|", sprintf("%30d|", b)
+    assert_equal "-0001180591620717411303424", sprintf("%.25d", -b)
+    assert_equal "     ..fffffc00000000000000000", sprintf("%30.25x", -b)
+    assert_equal "221360928884514619392", sprintf("%d", 3.0 * 2.0**66)
+  end
+  true
+end
+
+assert('Kernel#sprintf binary conversions') do
+  assert_equal "100000000000000000000", sprintf("%b", 2**20)
+  assert_equal "..100000000000000000000", sprintf("%b", -(2**20))
+  assert_equal "-100000000000000000000", sprintf("%+b", -(2**20))
+  assert_equal "1111111111111111111111111111111", sprintf("%b", 2**31 - 1)
+  assert_equal "-00000101", sprintf("%+.8b", -5)
+  assert_equal "..111011", sprintf("%.8b", -5)
+  assert_equal "0b00000101", sprintf("%#.8b", 5)
+end
@@ -201,7 +201,9 @@ mrb_struct_set(mrb_state *mrb, mrb_value obj, mrb_value val)
   for (i=0; i<len; i++) {
     slot = ptr_members[i];
     if (mrb_symbol(slot) == mid) {
-      return ptr[i] = val;
+      ptr[i] = val;
+      mrb_field_write_barrier_value(mrb, mrb_basic_ptr(obj), val);
+      return val;
     }
   }
   mrb_raisef(mrb, E_INDEX_ERROR, "`%S' is not a struct member", mrb_sym2str(mrb, mid));
@@ -622,6 +624,7 @@ mrb_struct_aset_sym(mrb_state *mrb, mrb_value s, mrb_sym id, mrb_value val)
   for (i=0; i<len; i++) {
     if (mrb_symbol(ptr_members[i]) == id) {
       ptr[i] = val;
+      mrb_field_write_barrier_value(mrb, mrb_basic_ptr(s), val);
       return val;
     }
   }
@@ -676,7 +679,9 @@ mrb_struct_aset(mrb_state *mrb, mrb_value s)
                "offset %S too large for struct(size:%S)",
                mrb_fixnum_value(i), mrb_fixnum_value(RSTRUCT_LEN(s)));
   }
-  return RSTRUCT_PTR(s)[i] = val;
+  RSTRUCT_PTR(s)[i] = val;
+  mrb_field_write_barrier_value(mrb, mrb_basic_ptr(s), val);
+  return val;
 }
 
 /* 15.2.18.4.1  */
@@ -9,6 +9,7 @@
 #include "mruby.h"
 #include "mruby/class.h"
 #include "mruby/data.h"
+#include "mruby/numeric.h"
 
 #if defined(__MINGW64__) || defined(__MINGW32__)
 # include <sys/time.h>
@@ -186,20 +187,23 @@ mrb_time_update_datetime(struct mrb_time *self)
   return self;
 }
 
+/* Makes a Time object holding a copy of tm in its heap slot. */
 static mrb_value
-mrb_time_wrap(mrb_state *mrb, struct RClass *tc, struct mrb_time *tm)
+mrb_time_wrap(mrb_state *mrb, struct RClass *tc, const struct mrb_time *tm)
 {
-  return mrb_obj_value(Data_Wrap_Struct(mrb, tc, &mrb_time_type, tm));
+  struct RData *data;
+  struct mrb_time *tm2;
+
+  Data_Make_Inline(mrb, tc, struct mrb_time, &mrb_time_type, tm2, data);
+  *tm2 = *tm;
+  return mrb_obj_value(data);
 }
 
 
-/* Allocates a mrb_time object and initializes it. */
+/* Initializes a mrb_time. */
 static struct mrb_time*
-time_alloc(mrb_state *mrb, double sec, double usec, enum mrb_timezone timezone)
+time_set(struct mrb_time *tm, double sec, double usec, enum mrb_timezone timezone)
 {
-  struct mrb_time *tm;
-
-  tm = (struct mrb_time *)mrb_malloc(mrb, sizeof(struct mrb_time));
   tm->sec  = (time_t)sec;
   tm->usec = (time_t)((sec - tm->sec) * 1.0e6 + usec);
   while (tm->usec < 0) {
@@ -219,15 +223,14 @@ time_alloc(mrb_state *mrb, double sec, double usec, enum mrb_timezone timezone)
 static mrb_value
 mrb_time_make(mrb_state *mrb, struct RClass *c, double sec, double usec, enum mrb_timezone timezone)
 {
-  return mrb_time_wrap(mrb, c, time_alloc(mrb, sec, usec, timezone));
+  struct mrb_time tm;
+
+  return mrb_time_wrap(mrb, c, time_set(&tm, sec, usec, timezone));
 }
 
 static struct mrb_time*
-current_mrb_time(mrb_state *mrb)
+current_mrb_time(struct mrb_time *tm)
 {
-  struct mrb_time *tm;
-
-  tm = (struct mrb_time *)mrb_malloc(mrb, sizeof(*tm));
 #ifdef NO_GETTIMEOFDAY
   {
     static time_t last_sec = 0, last_usec = 0;
@@ -262,7 +265,9 @@ current_mrb_time(mrb_state *mrb)
 static mrb_value
 mrb_time_now(mrb_state *mrb, mrb_value self)
 {
-  return mrb_time_wrap(mrb, mrb_class_ptr(self), current_mrb_time(mrb));
+  struct mrb_time tm;
+
+  return mrb_time_wrap(mrb, mrb_class_ptr(self), current_mrb_time(&tm));
 }
 
 /* 15.2.19.6.1 */
@@ -279,7 +284,7 @@ mrb_time_at(mrb_state *mrb, mrb_value self)
 static struct mrb_time*
 time_mktime(mrb_state *mrb, mrb_int ayear, mrb_int amonth, mrb_int aday,
   mrb_int ahour, mrb_int amin, mrb_int asec, mrb_int ausec,
-  enum mrb_timezone timezone)
+  enum mrb_timezone timezone, struct mrb_time *tm)
 {
   time_t nowsecs;
   struct tm nowtime = { 0 };
@@ -301,7 +306,7 @@ time_mktime(mrb_state *mrb, mrb_int ayear, mrb_int amonth, mrb_int aday,
     mrb_raise(mrb, E_ARGUMENT_ERROR, "Not a valid time.");
   }
 
-  return time_alloc(mrb, (double)nowsecs, ausec, timezone);
+  return time_set(tm, (double)nowsecs, ausec, timezone);
 }
 
 /* 15.2.19.6.2 */
@@ -310,11 +315,12 @@ static mrb_value
 mrb_time_gm(mrb_state *mrb, mrb_value self)
 {
   mrb_int ayear = 0, amonth = 1, aday = 1, ahour = 0, amin = 0, asec = 0, ausec = 0;
+  struct mrb_time tm;
 
   mrb_get_args(mrb, "i|iiiiii",
                 &ayear, &amonth, &aday, &ahour, &amin, &asec, &ausec);
   return mrb_time_wrap(mrb, mrb_class_ptr(self),
-          time_mktime(mrb, ayear, amonth, aday, ahour, amin, asec, ausec, MRB_TIMEZONE_UTC));
+          time_mktime(mrb, ayear, amonth, aday, ahour, amin, asec, ausec, MRB_TIMEZONE_UTC, &tm));
 }
 
 
@@ -324,11 +330,12 @@ static mrb_value
 mrb_time_local(mrb_state *mrb, mrb_value self)
 {
   mrb_int ayear = 0, amonth = 1, aday = 1, ahour = 0, amin = 0, asec = 0, ausec = 0;
+  struct mrb_time tm;
 
   mrb_get_args(mrb, "i|iiiiii",
                 &ayear, &amonth, &aday, &ahour, &amin, &asec, &ausec);
   return mrb_time_wrap(mrb, mrb_class_ptr(self),
-          time_mktime(mrb, ayear, amonth, aday, ahour, amin, asec, ausec, MRB_TIMEZONE_LOCAL));
+          time_mktime(mrb, ayear, amonth, aday, ahour, amin, asec, ausec, MRB_TIMEZONE_LOCAL, &tm));
 }
 
 
@@ -380,7 +387,7 @@ mrb_time_plus(mrb_state *mrb, mrb_value self)
   struct mrb_time *tm;
 
   mrb_get_args(mrb, "f", &f);
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   return mrb_time_make(mrb, mrb_obj_class(mrb, self), (double)tm->sec+f, (double)tm->usec, tm->timezone);
 }
 
@@ -392,7 +399,7 @@ mrb_time_minus(mrb_state *mrb, mrb_value self)
   struct mrb_time *tm, *tm2;
 
   mrb_get_args(mrb, "o", &other);
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
 
   tm2 = DATA_CHECK_GET_PTR(mrb, other, &mrb_time_type, struct mrb_time);
   if (tm2) {
@@ -413,7 +420,7 @@ mrb_time_wday(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   return mrb_fixnum_value(tm->datetime.tm_wday);
 }
 
@@ -424,7 +431,7 @@ mrb_time_yday(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   return mrb_fixnum_value(tm->datetime.tm_yday + 1);
 }
 
@@ -435,7 +442,7 @@ mrb_time_year(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   return mrb_fixnum_value(tm->datetime.tm_year + 1900);
 }
 
@@ -446,7 +453,7 @@ mrb_time_zone(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   if (tm->timezone <= MRB_TIMEZONE_NONE) return mrb_nil_value();
   if (tm->timezone >= MRB_TIMEZONE_LAST) return mrb_nil_value();
   return mrb_str_new_static(mrb,
@@ -464,7 +471,7 @@ mrb_time_asctime(mrb_state *mrb, mrb_value self)
   char buf[256];
   int len;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   d = &tm->datetime;
   len = snprintf(buf, sizeof(buf), "%s %s %02d %02d:%02d:%02d %s%d",
     wday_names[d->tm_wday], mon_names[d->tm_mon], d->tm_mday,
@@ -481,7 +488,7 @@ mrb_time_day(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   if (!tm) return mrb_nil_value();
   return mrb_fixnum_value(tm->datetime.tm_mday);
 }
@@ -494,7 +501,7 @@ mrb_time_dst_p(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   return mrb_bool_value(tm->datetime.tm_isdst);
 }
 
@@ -504,14 +511,13 @@ mrb_time_dst_p(mrb_state *mrb, mrb_value self)
 static mrb_value
 mrb_time_getutc(mrb_state *mrb, mrb_value self)
 {
-  struct mrb_time *tm, *tm2;
+  struct mrb_time *tm, tm2;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
-  tm2 = (struct mrb_time *)mrb_malloc(mrb, sizeof(*tm));
-  *tm2 = *tm;
-  tm2->timezone = MRB_TIMEZONE_UTC;
-  mrb_time_update_datetime(tm2);
-  return mrb_time_wrap(mrb, mrb_obj_class(mrb, self), tm2);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
+  tm2 = *tm;
+  tm2.timezone = MRB_TIMEZONE_UTC;
+  mrb_time_update_datetime(&tm2);
+  return mrb_time_wrap(mrb, mrb_obj_class(mrb, self), &tm2);
 }
 
 /* 15.2.19.7.9 */
@@ -519,14 +525,13 @@ mrb_time_getutc(mrb_state *mrb, mrb_value self)
 static mrb_value
 mrb_time_getlocal(mrb_state *mrb, mrb_value self)
 {
-  struct mrb_time *tm, *tm2;
+  struct mrb_time *tm, tm2;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
-  tm2 = (struct mrb_time *)mrb_malloc(mrb, sizeof(*tm));
-  *tm2 = *tm;
-  tm2->timezone = MRB_TIMEZONE_LOCAL;
-  mrb_time_update_datetime(tm2);
-  return mrb_time_wrap(mrb, mrb_obj_class(mrb, self), tm2);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
+  tm2 = *tm;
+  tm2.timezone = MRB_TIMEZONE_LOCAL;
+  mrb_time_update_datetime(&tm2);
+  return mrb_time_wrap(mrb, mrb_obj_class(mrb, self), &tm2);
 }
 
 /* 15.2.19.7.15 */
@@ -536,7 +541,7 @@ mrb_time_hour(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   return mrb_fixnum_value(tm->datetime.tm_hour);
 }
 
@@ -548,24 +553,24 @@ mrb_time_initialize(mrb_state *mrb, mrb_value self)
   mrb_int ayear = 0, amonth = 1, aday = 1, ahour = 0,
   amin = 0, asec = 0, ausec = 0;
   int n;
-  struct mrb_time *tm;
-
-  tm = (struct mrb_time*)DATA_PTR(self);
-  if (tm) {
-    mrb_free(mrb, tm);
-  }
-  DATA_TYPE(self) = &mrb_time_type;
-  DATA_PTR(self) = NULL;
+  struct mrb_time *tm, t;
 
   n = mrb_get_args(mrb, "|iiiiiii",
        &ayear, &amonth, &aday, &ahour, &amin, &asec, &ausec);
   if (n == 0) {
-    tm = current_mrb_time(mrb);
+    current_mrb_time(&t);
   }
   else {
-    tm = time_mktime(mrb, ayear, amonth, aday, ahour, amin, asec, ausec, MRB_TIMEZONE_LOCAL);
+    time_mktime(mrb, ayear, amonth, aday, ahour, amin, asec, ausec, MRB_TIMEZONE_LOCAL, &t);
+  }
+  /* initialized again, an object keeps its payload (which may be inline) */
+  tm = (struct mrb_time*)DATA_PTR(self);
+  if (!tm) {
+    tm = (struct mrb_time *)mrb_malloc(mrb, sizeof(struct mrb_time));
+    DATA_TYPE(self) = &mrb_time_type;
+    DATA_PTR(self) = tm;
   }
-  DATA_PTR(self) = tm;
+  *tm = t;
   return self;
 }
 
@@ -596,7 +601,7 @@ mrb_time_localtime(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   tm->timezone = MRB_TIMEZONE_LOCAL;
   mrb_time_update_datetime(tm);
   return self;
@@ -609,7 +614,7 @@ mrb_time_mday(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   return mrb_fixnum_value(tm->datetime.tm_mday);
 }
 
@@ -620,7 +625,7 @@ mrb_time_min(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   return mrb_fixnum_value(tm->datetime.tm_min);
 }
 
@@ -631,7 +636,7 @@ mrb_time_mon(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   return mrb_fixnum_value(tm->datetime.tm_mon + 1);
 }
 
@@ -642,7 +647,7 @@ mrb_time_sec(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   return mrb_fixnum_value(tm->datetime.tm_sec);
 }
 
@@ -654,18 +659,24 @@ mrb_time_to_f(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   return mrb_float_value(mrb, (mrb_float)tm->sec + (mrb_float)tm->usec/1.0e6);
 }
 
 /* 15.2.19.7.25 */
-/* Returns a Fixnum with the time since the epoch in seconds. */
+/* Returns an Integer with the time since the epoch in seconds. */
 static mrb_value
 mrb_time_to_i(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
+  if (tm->sec > MRB_FIXNUM_MAX || tm->sec < MRB_FIXNUM_MIN) {
+    mrb_value f = mrb_float_value(mrb, (mrb_float)tm->sec);
+
+    /* a Float unless there is a Bignum to hold it */
+    return mrb->bignum_class ? mrb_funcall(mrb, f, "to_i", 0) : f;
+  }
   return mrb_fixnum_value((mrb_int)tm->sec);
 }
 
@@ -676,7 +687,7 @@ mrb_time_usec(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   return mrb_fixnum_value((mrb_int)tm->usec);
 }
 
@@ -687,7 +698,7 @@ mrb_time_utc(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   tm->timezone = MRB_TIMEZONE_UTC;
   mrb_time_update_datetime(tm);
   return self;
@@ -700,7 +711,7 @@ mrb_time_utc_p(mrb_state *mrb, mrb_value self)
 {
   struct mrb_time *tm;
 
-  tm = DATA_GET_PTR(mrb, self, &mrb_time_type, struct mrb_time);
+  tm = DATA_GET_TYPED(mrb, self, &mrb_time_type, struct mrb_time);
   return mrb_bool_value(tm->timezone == MRB_TIMEZONE_UTC);
 }
 
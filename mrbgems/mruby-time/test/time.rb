@@ -207,3 +207,21 @@ assert('day of week methods') do
   assert_false t.friday?
   assert_false t.saturday?
 end
+
+assert('Time objects survive GC and compaction') do
+  times = []
+  500.times { |i| times << Time.at(1000 + i).utc }
+  copy = times[7].dup
+  t = Time.at(0)
+  t.send(:initialize, 2001, 2, 3)
+  GC.start
+  GC.compact if GC.respond_to?(:compact)
+  20_000.times { |i| Time.at(i) }
+  GC.start
+  times.each_with_index do |tm, i|
+    assert_equal 1000 + i, tm.to_i
+    assert_equal "UTC", tm.zone
+  end
+  assert_equal 1007, copy.to_i
+  assert_equal [2001, 2, 3], [t.year, t.month, t.day]
+end
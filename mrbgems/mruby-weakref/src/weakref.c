@@ -0,0 +1,143 @@
+/*
+** weakref.c - WeakRef class
+**
+** See Copyright Notice in mruby.h
+*/
+
+#include "mruby.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "mruby/gc.h"
+
+struct weakref {
+  struct mrb_gc_weak weak;
+  mrb_value obj;                /* undef once the referent was collected */
+};
+
+static void
+weakref_free(mrb_state *mrb, void *ptr)
+{
+  struct weakref *w = (struct weakref*)ptr;
+
+  mrb_gc_weak_unregister(mrb, &w->weak);
+  mrb_free(mrb, w);
+}
+
+static const struct mrb_data_type weakref_type = {
+  "WeakRef", weakref_free,
+};
+
+static void
+weakref_update(mrb_state *mrb, struct mrb_gc_weak *weak)
+{
+  struct weakref *w = (struct weakref*)weak;
+
+  w->obj = mrb_gc_weak_update(mrb, w->obj);
+}
+
+static void
+weakref_set(mrb_state *mrb, mrb_value self, mrb_value obj)
+{
+  struct weakref *w = (struct weakref*)DATA_PTR(self);
+
+  if (!w) {
+    w = (struct weakref*)mrb_malloc(mrb, sizeof(struct weakref));
+    w->obj = mrb_undef_value();
+    mrb_gc_weak_register(mrb, &w->weak, weakref_update);
+    DATA_TYPE(self) = &weakref_type;
+    DATA_PTR(self) = w;
+  }
+  w->obj = obj;
+}
+
+/*
+ *  call-seq:
+ *     WeakRef.new(obj) -> weakref
+ *
+ *  Creates a reference to +obj+ that does not keep it from being
+ *  collected.  Methods the weakref does not define go to +obj+.
+ */
+
+static mrb_value
+weakref_initialize(mrb_state *mrb, mrb_value self)
+{
+  mrb_value obj;
+
+  mrb_get_args(mrb, "o", &obj);
+  weakref_set(mrb, self, obj);
+  return self;
+}
+
+static mrb_value
+weakref_initialize_copy(mrb_state *mrb, mrb_value copy)
+{
+  mrb_value src;
+  struct weakref *w;
+
+  mrb_get_args(mrb, "o", &src);
+  if (mrb_obj_equal(mrb, copy, src)) return copy;
+  if (!mrb_obj_is_instance_of(mrb, src, mrb_obj_class(mrb, copy))) {
+    mrb_raise(mrb, E_TYPE_ERROR, "wrong argument class");
+  }
+  w = DATA_GET_PTR(mrb, src, &weakref_type, struct weakref);
+  weakref_set(mrb, copy, w->obj);
+  return copy;
+}
+
+/*
+ *  call-seq:
+ *     weakref.__getobj__ -> obj
+ *
+ *  Returns the referent; raises WeakRef::RefError if it was collected.
+ */
+
+static mrb_value
+weakref_getobj(mrb_state *mrb, mrb_value self)
+{
+  struct weakref *w = DATA_GET_PTR(mrb, self, &weakref_type, struct weakref);
+
+  if (mrb_undef_p(w->obj)) {
+    mrb_raise(mrb, mrb_class_get_under(mrb, mrb_class_get(mrb, "WeakRef"), "RefError"),
+              "Invalid Reference - probably recycled");
+  }
+  return mrb_gc_weak_get(mrb, w->obj);
+}
+
+static mrb_value
+weakref_alive_p(mrb_state *mrb, mrb_value self)
+{
+  struct weakref *w = DATA_GET_PTR(mrb, self, &weakref_type, struct weakref);
+
+  return mrb_bool_value(!mrb_undef_p(w->obj));
+}
+
+static mrb_value
+weakref_method_missing(mrb_state *mrb, mrb_value self)
+{
+  mrb_sym name;
+  mrb_value *argv, blk;
+  int argc;
+
+  mrb_get_args(mrb, "n*&", &name, &argv, &argc, &blk);
+  return mrb_funcall_with_block(mrb, weakref_getobj(mrb, self), name, argc, argv, blk);
+}
+
+void
+mrb_mruby_weakref_gem_init(mrb_state *mrb)
+{
+  struct RClass *weakref;
+
+  weakref = mrb_define_class(mrb, "WeakRef", mrb->object_class);
+  MRB_SET_INSTANCE_TT(weakref, MRB_TT_DATA);
+  mrb_define_class_under(mrb, weakref, "RefError", mrb->eStandardError_class);
+  mrb_define_method(mrb, weakref, "initialize", weakref_initialize, MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, weakref, "initialize_copy", weakref_initialize_copy, MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, weakref, "__getobj__", weakref_getobj, MRB_ARGS_NONE());
+  mrb_define_method(mrb, weakref, "weakref_alive?", weakref_alive_p, MRB_ARGS_NONE());
+  mrb_define_method(mrb, weakref, "method_missing", weakref_method_missing, MRB_ARGS_ANY());
+}
+
+void
+mrb_mruby_weakref_gem_final(mrb_state *mrb)
+{
+}
@@ -0,0 +1,55 @@
+##
+# WeakRef Test
+
+def weakref_to_garbage
+  WeakRef.new("garbage" * 2)
+end
+
+def weakref_collect(mode)
+  origin = GC.generational_mode
+  GC.generational_mode = mode
+  r = weakref_to_garbage
+  count = GC.stat(:count)
+  # let incremental (or minor) cycles run from the allocation path
+  i = 0
+  while GC.stat(:count) < count + 2
+    "x#{i}"
+    i += 1
+  end
+  r
+ensure
+  GC.generational_mode = origin
+end
+
+assert('WeakRef') do
+  s = "alive"
+  r = WeakRef.new(s)
+  assert_true r.weakref_alive?
+  assert_true r.__getobj__.equal?(s)
+  assert_equal 5, r.size
+  assert_equal "ALIVE", r.upcase
+  assert_equal [1, 2], WeakRef.new([2, 1]).sort
+  assert_true WeakRef.new(1).weakref_alive?
+end
+
+assert('WeakRef is cleared by GC.start') do
+  s = "kept"
+  kept = WeakRef.new(s)
+  r = weakref_to_garbage
+  GC.start
+  assert_false r.weakref_alive?
+  assert_raise(WeakRef::RefError) { r.__getobj__ }
+  assert_raise(WeakRef::RefError) { r.size }
+  assert_true kept.__getobj__.equal?(s)
+end
+
+assert('WeakRef is cleared by incremental and generational GC') do
+  assert_false weakref_collect(false).weakref_alive?
+  assert_false weakref_collect(true).weakref_alive?
+end
+
+assert('WeakRef#dup') do
+  s = "dup"
+  r = WeakRef.new(s).dup
+  assert_true r.__getobj__.equal?(s)
+end
@@ -18,6 +18,7 @@
 #define ARY_SHARED_P(a) ((a)->flags & MRB_ARY_SHARED)
 #define ARY_SET_SHARED_FLAG(a) ((a)->flags |= MRB_ARY_SHARED)
 #define ARY_UNSET_SHARED_FLAG(a) ((a)->flags &= ~MRB_ARY_SHARED)
+#define ARY_EMBED_P(a) MRB_ARY_EMBED_P(a)
 
 static inline mrb_value
 ary_elt(mrb_value ary, mrb_int offset)
@@ -34,6 +35,7 @@ ary_new_capa(mrb_state *mrb, mrb_int capa)
 {
   struct RArray *a;
   mrb_int blen;
+  size_t size, embed;
 
   if (capa > ARY_MAX_SIZE) {
     mrb_raise(mrb, E_ARGUMENT_ERROR, "array size too big");
@@ -43,9 +45,18 @@ ary_new_capa(mrb_state *mrb, mrb_int capa)
     mrb_raise(mrb, E_ARGUMENT_ERROR, "array size too big");
   }
 
-  a = (struct RArray*)mrb_obj_alloc(mrb, MRB_TT_ARRAY, mrb->array_class);
-  a->ptr = (mrb_value *)mrb_malloc(mrb, blen);
-  a->aux.capa = capa;
+  /* an empty array asks for room to push into */
+  size = sizeof(struct RArray) + (capa > 0 ? (size_t)blen : sizeof(mrb_value));
+  a = (struct RArray*)mrb_obj_alloc_size(mrb, MRB_TT_ARRAY, mrb->array_class, &size);
+  embed = (size - sizeof(struct RArray)) / sizeof(mrb_value);
+  if (embed > 0 && embed >= (size_t)capa) {
+    a->ptr = MRB_ARY_EMBED_PTR(a);
+    a->aux.capa = embed;
+  }
+  else {
+    a->ptr = (mrb_value *)mrb_malloc(mrb, blen);
+    a->aux.capa = capa;
+  }
   a->len = 0;
 
   return a;
@@ -167,7 +178,13 @@ ary_make_shared(mrb_state *mrb, struct RArray *a)
     mrb_shared_array *shared = (mrb_shared_array *)mrb_malloc(mrb, sizeof(mrb_shared_array));
 
     shared->refcnt = 1;
-    if (a->aux.capa > a->len) {
+    if (ARY_EMBED_P(a)) {
+      /* the shared elements must not live in the slot of a */
+      shared->ptr = (mrb_value *)mrb_malloc(mrb, sizeof(mrb_value)*a->len+1);
+      array_copy(shared->ptr, a->ptr, a->len);
+      a->ptr = shared->ptr;
+    }
+    else if (a->aux.capa > a->len) {
       a->ptr = shared->ptr = (mrb_value *)mrb_realloc(mrb, a->ptr, sizeof(mrb_value)*a->len+1);
     }
     else {
@@ -198,7 +215,15 @@ ary_expand_capa(mrb_state *mrb, struct RArray *a, mrb_int len)
   if (capa > ARY_MAX_SIZE) capa = ARY_MAX_SIZE; /* len <= capa <= ARY_MAX_SIZE */
 
   if (capa > a->aux.capa) {
-    mrb_value *expanded_ptr = (mrb_value *)mrb_realloc(mrb, a->ptr, sizeof(mrb_value)*capa);
+    mrb_value *expanded_ptr;
+
+    if (ARY_EMBED_P(a)) {
+      expanded_ptr = (mrb_value *)mrb_malloc(mrb, sizeof(mrb_value)*capa);
+      array_copy(expanded_ptr, a->ptr, a->len);
+    }
+    else {
+      expanded_ptr = (mrb_value *)mrb_realloc(mrb, a->ptr, sizeof(mrb_value)*capa);
+    }
 
     if (!expanded_ptr) {
       mrb_raise(mrb, E_RUNTIME_ERROR, "out of memory");
@@ -214,6 +239,7 @@ ary_shrink_capa(mrb_state *mrb, struct RArray *a)
 {
   mrb_int capa = a->aux.capa;
 
+  if (ARY_EMBED_P(a)) return;
   if (capa < ARY_DEFAULT_LEN * 2) return;
   if (capa <= a->len * ARY_SHRINK_RATIO) return;
 
@@ -250,7 +276,7 @@ ary_concat(mrb_state *mrb, struct RArray *a, mrb_value *ptr, mrb_int blen)
   ary_modify(mrb, a);
   if (a->aux.capa < len) ary_expand_capa(mrb, a, len);
   array_copy(a->ptr+a->len, ptr, blen);
-  mrb_write_barrier(mrb, (struct RBasic*)a);
+  mrb_write_barrier_range(mrb, (struct RBasic*)a, a->len, blen, len);
   a->len = len;
 }
 
@@ -299,7 +325,7 @@ ary_replace(mrb_state *mrb, struct RArray *a, mrb_value *argv, mrb_int len)
   if (a->aux.capa < len)
     ary_expand_capa(mrb, a, len);
   array_copy(a->ptr, argv, len);
-  mrb_write_barrier(mrb, (struct RBasic*)a);
+  mrb_write_barrier_range(mrb, (struct RBasic*)a, 0, len, len);
   a->len = len;
 }
 
@@ -366,6 +392,7 @@ mrb_ary_reverse_bang(mrb_state *mrb, mrb_value self)
       *p1++ = *p2;
       *p2-- = tmp;
     }
+    mrb_write_barrier_moved(mrb, (struct RBasic*)a);
   }
   return self;
 }
@@ -401,7 +428,7 @@ mrb_ary_push(mrb_state *mrb, mrb_value ary, mrb_value elem)
   if (a->len == a->aux.capa)
     ary_expand_capa(mrb, a, a->len + 1);
   a->ptr[a->len++] = elem;
-  mrb_field_write_barrier_value(mrb, (struct RBasic*)a, elem);
+  mrb_field_write_barrier_slot_value(mrb, (struct RBasic*)a, a->len - 1, a->len, elem);
 }
 
 static mrb_value
@@ -441,6 +468,7 @@ mrb_ary_shift(mrb_state *mrb, mrb_value self)
     val = a->ptr[0];
     a->ptr++;
     a->len--;
+    mrb_write_barrier_moved(mrb, (struct RBasic*)a);
     return val;
   }
   if (a->len > ARY_SHIFT_SHARED_MIN) {
@@ -457,6 +485,7 @@ mrb_ary_shift(mrb_state *mrb, mrb_value self)
       ++ptr;
     }
     --a->len;
+    mrb_write_barrier_moved(mrb, (struct RBasic*)a);
   }
   return val;
 }
@@ -484,6 +513,7 @@ mrb_ary_unshift(mrb_state *mrb, mrb_value self, mrb_value item)
     a->ptr[0] = item;
   }
   a->len++;
+  mrb_write_barrier_moved(mrb, (struct RBasic*)a);
   mrb_field_write_barrier_value(mrb, (struct RBasic*)a, item);
 
   return self;
@@ -511,6 +541,7 @@ mrb_ary_unshift_m(mrb_state *mrb, mrb_value self)
   }
   array_copy(a->ptr, vals, len);
   a->len += len;
+  mrb_write_barrier_moved(mrb, (struct RBasic*)a);
   while (len--) {
     mrb_field_write_barrier_value(mrb, (struct RBasic*)a, vals[len]);
   }
@@ -551,7 +582,7 @@ mrb_ary_set(mrb_state *mrb, mrb_value ary, mrb_int n, mrb_value val)
   }
 
   a->ptr[n] = val;
-  mrb_field_write_barrier_value(mrb, (struct RBasic*)a, val);
+  mrb_field_write_barrier_slot_value(mrb, (struct RBasic*)a, n, a->len, val);
 }
 
 mrb_value
@@ -599,11 +630,12 @@ mrb_ary_splice(mrb_state *mrb, mrb_value ary, mrb_int head, mrb_int len, mrb_val
   }
   else if (head < a->len) {
     value_move(a->ptr + head + argc, a->ptr + tail, a->len - tail);
+    if (argc != len) mrb_write_barrier_moved(mrb, (struct RBasic*)a);
   }
 
   for (i = 0; i < argc; i++) {
     *(a->ptr + head + i) = *(argv + i);
-    mrb_field_write_barrier_value(mrb, (struct RBasic*)a, argv[i]);
+    mrb_field_write_barrier_slot_value(mrb, (struct RBasic*)a, head + i, size, argv[i]);
   }
 
   a->len = size;
@@ -800,6 +832,7 @@ mrb_ary_delete_at(mrb_state *mrb, mrb_value self)
     ++ptr;
   }
   --a->len;
+  mrb_write_barrier_moved(mrb, (struct RBasic*)a);
 
   ary_shrink_capa(mrb, a);
 
@@ -904,9 +937,11 @@ mrb_ary_clear(mrb_state *mrb, mrb_value self)
 
   ary_modify(mrb, a);
   a->len = 0;
-  a->aux.capa = 0;
-  mrb_free(mrb, a->ptr);
-  a->ptr = 0;
+  if (!ARY_EMBED_P(a)) {
+    a->aux.capa = 0;
+    mrb_free(mrb, a->ptr);
+    a->ptr = 0;
+  }
 
   return self;
 }
@@ -87,9 +87,12 @@ output_backtrace(mrb_state *mrb, mrb_int ciidx, mrb_code *pc0, output_stream_fun
       else if (i+1 <= ciidx) {
         pc = mrb->c->cibase[i+1].pc - 1;
       }
-      else {
+      else if (pc0) {
         pc = pc0;
       }
+      else {
+        continue;
+      }
       filename = mrb_debug_get_filename(irep, (uint32_t)(pc - irep->iseq));
       lineno = mrb_debug_get_line(irep, (uint32_t)(pc - irep->iseq));
     }
@@ -44,6 +44,12 @@ mrb_gc_mark_mt_size(mrb_state *mrb, struct RClass *c)
   return kh_size(h);
 }
 
+size_t
+mrb_gc_mt_memsize(mrb_state *mrb, struct RClass *c)
+{
+  return kh_memsize(c->mt);
+}
+
 void
 mrb_gc_free_mt(mrb_state *mrb, struct RClass *c)
 {
@@ -315,6 +321,7 @@ mrb_define_method_raw(mrb_state *mrb, struct RClass *c, mrb_sym mid, struct RPro
   if (!h) h = c->mt = kh_init(mt, mrb);
   k = kh_put(mt, mrb, h, mid);
   kh_value(h, k) = p;
+  mrb_clear_init_cache(mrb);
   if (p) {
     mrb_field_write_barrier(mrb, (struct RBasic *)c, (struct RBasic *)p);
   }
@@ -349,6 +356,7 @@ mrb_define_method_vm(mrb_state *mrb, struct RClass *c, mrb_sym name, mrb_value b
   k = kh_put(mt, mrb, h, name);
   p = mrb_proc_ptr(body);
   kh_value(h, k) = p;
+  mrb_clear_init_cache(mrb);
   if (p) {
     mrb_field_write_barrier(mrb, (struct RBasic *)c, (struct RBasic *)p);
   }
@@ -771,6 +779,7 @@ mrb_include_module(mrb_state *mrb, struct RClass *c, struct RClass *m)
   skip:
     m = m->super;
   }
+  mrb_clear_init_cache(mrb);
 }
 
 static mrb_value
@@ -1050,7 +1059,48 @@ mrb_method_search(mrb_state *mrb, struct RClass* c, mrb_sym mid)
   return m;
 }
 
-static mrb_value
+/*
+ * Initialize method cache
+ *   Maps a class to the initialize method its instances respond to, so
+ *   that the VM can construct objects for Class#new without a method
+ *   search.  Entries are dropped whenever any method table or ancestor
+ *   chain changes, or when a class is freed.
+ */
+
+#define INIT_CACHE_HASH(c) ((((uintptr_t)(c))>>4) & (MRB_INIT_CACHE_SIZE-1))
+
+void
+mrb_clear_init_cache(mrb_state *mrb)
+{
+  static const struct mrb_init_cache init_cache_zero = { 0 };
+  int i;
+
+  for (i=0; i<MRB_INIT_CACHE_SIZE; i++) {
+    mrb->init_cache[i] = init_cache_zero;
+  }
+}
+
+struct RProc*
+mrb_init_method_search(mrb_state *mrb, struct RClass **cp)
+{
+  struct RClass *c = *cp;
+  struct mrb_init_cache *e = &mrb->init_cache[INIT_CACHE_HASH(c)];
+  struct RProc *m;
+
+  if (e->c == c) {
+    *cp = e->owner;
+    return e->m;
+  }
+  m = mrb_method_search_vm(mrb, cp, mrb->sym_initialize);
+  if (m) {
+    e->c = c;
+    e->owner = *cp;
+    e->m = m;
+  }
+  return m;
+}
+
+mrb_value
 mrb_instance_alloc(mrb_state *mrb, mrb_value cv)
 {
   struct RClass *c = mrb_class_ptr(cv);
@@ -1086,7 +1136,7 @@ mrb_instance_new(mrb_state *mrb, mrb_value cv)
 
   obj = mrb_instance_alloc(mrb, cv);
   mrb_get_args(mrb, "*&", &argv, &argc, &blk);
-  mrb_funcall_with_block(mrb, obj, mrb_intern_lit(mrb, "initialize"), argc, argv, blk);
+  mrb_funcall_with_block(mrb, obj, mrb->sym_initialize, argc, argv, blk);
 
   return obj;
 }
@@ -1097,7 +1147,7 @@ mrb_obj_new(mrb_state *mrb, struct RClass *c, mrb_int argc, const mrb_value *arg
   mrb_value obj;
 
   obj = mrb_instance_alloc(mrb, mrb_obj_value(c));
-  mrb_funcall_argv(mrb, obj, mrb_intern_lit(mrb, "initialize"), argc, argv);
+  mrb_funcall_argv(mrb, obj, mrb->sym_initialize, argc, argv);
 
   return obj;
 }
@@ -1770,6 +1820,7 @@ remove_method(mrb_state *mrb, mrb_value mod, mrb_sym mid)
     k = kh_get(mt, mrb, h, mid);
     if (k != kh_end(h)) {
       kh_del(mt, mrb, h, k);
+      mrb_clear_init_cache(mrb);
       return;
     }
   }
@@ -1923,6 +1974,8 @@ mrb_init_class(mrb_state *mrb)
   struct RClass *mod;           /* Module */
   struct RClass *cls;           /* Class */
 
+  mrb->sym_initialize = mrb_intern_lit(mrb, "initialize");
+
   /* boot class hierarchy */
   bob = boot_defclass(mrb, 0);
   obj = boot_defclass(mrb, bob); mrb->object_class = obj;
@@ -1059,72 +1059,69 @@ raise_error(codegen_scope *s, const char *msg)
   genop(s, MKOP_ABx(OP_ERR, 1, idx));
 }
 
-static double
-readint_float(codegen_scope *s, const char *p, int base)
+static mrb_int
+readint_mrb_int(codegen_scope *s, const char *p, int base, mrb_bool neg, mrb_bool *overflow)
 {
   const char *e = p + strlen(p);
-  double f = 0;
-  int n;
+  uint64_t n;
 
   if (*p == '+') p++;
-  while (p < e) {
-    char c = *p;
-    c = tolower((unsigned char)c);
-    for (n=0; n<base; n++) {
-      if (mrb_digitmap[n] == c) {
-        f *= base;
-        f += n;
-        break;
-      }
-    }
-    if (n == base) {
-      codegen_error(s, "malformed readint input");
-    }
-    p++;
+  if (mrb_uint_read(p, e, base, FALSE, &n, overflow) != e) {
+    codegen_error(s, "malformed readint input");
+  }
+  if (*overflow || n > (uint64_t)MRB_FIXNUM_MAX + neg) {
+    *overflow = TRUE;
+    return 0;
+  }
+  if (neg) {
+    return n == 0 ? 0 : -(mrb_int)(n - 1) - 1;
   }
-  return f;
+  return (mrb_int)n;
 }
 
-static mrb_int
-readint_mrb_int(codegen_scope *s, const char *p, int base, mrb_bool neg, mrb_bool *overflow)
+/*
+  An Integer literal too large for a Fixnum goes in the pool as a string
+  of a zero byte, its sign and its magnitude in little endian bytes, so
+  that OP_LOADL makes the Integer from it (see mrb_int_read_big()) without
+  parsing digits each time it runs.
+*/
+static int
+new_bigint_lit(codegen_scope *s, const char *p, int base, mrb_bool neg)
 {
-  const char *e = p + strlen(p);
-  mrb_int result = 0;
-  int n;
+  mrb_value str;
+  unsigned char *mag;
+  size_t len = 0, i;
 
   if (*p == '+') p++;
-  while (p < e) {
-    char c = *p;
-    c = tolower((unsigned char)c);
-    for (n=0; n<base; n++) {
-      if (mrb_digitmap[n] == c) {
-        break;
-      }
-    }
-    if (n == base) {
-      codegen_error(s, "malformed readint input");
-    }
+  /* a digit adds at most 6 bits */
+  str = mrb_str_new(s->mrb, NULL, 2 + strlen(p) * 6 / 8 + 1);
+  mag = (unsigned char*)RSTRING_PTR(str) + 2;
+  for (; *p; p++) {
+    unsigned int carry = ISDIGIT(*p) ? *p - '0' : TOLOWER(*p) - 'a' + 10;
 
-    if (neg) {
-      if ((MRB_INT_MIN + n)/base > result) {
-        *overflow = TRUE;
-        return 0;
-      }
-      result *= base;
-      result -= n;
+    for (i = 0; i < len; i++) {
+      carry += mag[i] * (unsigned int)base;
+      mag[i] = (unsigned char)carry;
+      carry >>= 8;
     }
-    else {
-      if ((MRB_INT_MAX - n)/base < result) {
-        *overflow = TRUE;
-        return 0;
-      }
-      result *= base;
-      result += n;
+    for (; carry; carry >>= 8) {
+      mag[len++] = (unsigned char)carry;
     }
-    p++;
   }
-  *overflow = FALSE;
-  return result;
+  RSTRING_PTR(str)[0] = 0;
+  RSTRING_PTR(str)[1] = neg ? '-' : '+';
+  mrb_str_resize(s->mrb, str, 2 + len);
+  return new_lit(s, str);
+}
+
+static mrb_float
+readflo(codegen_scope *s, const char *p)
+{
+#ifdef MRB_USE_FLOAT
+  return str_to_mrb_float(p);
+#else
+  return mrb_float_read(s->mrb, p, NULL, FALSE);
+#endif
 }
 
 static void
@@ -1954,8 +1951,7 @@ codegen(codegen_scope *s, node *tree, int val)
 
       i = readint_mrb_int(s, p, base, FALSE, &overflow);
       if (overflow) {
-        double f = readint_float(s, p, base);
-        int off = new_lit(s, mrb_float_value(s->mrb, f));
+        int off = new_bigint_lit(s, p, base, FALSE);
 
         genop(s, MKOP_ABx(OP_LOADL, cursp(), off));
       }
@@ -1976,7 +1972,7 @@ codegen(codegen_scope *s, node *tree, int val)
   case NODE_FLOAT:
     if (val) {
       char *p = (char*)tree;
-      mrb_float f = str_to_mrb_float(p);
+      mrb_float f = readflo(s, p);
       int off = new_lit(s, mrb_float_value(s->mrb, f));
 
       genop(s, MKOP_ABx(OP_LOADL, cursp(), off));
@@ -1992,7 +1988,7 @@ codegen(codegen_scope *s, node *tree, int val)
       case NODE_FLOAT:
         {
           char *p = (char*)tree;
-          mrb_float f = str_to_mrb_float(p);
+          mrb_float f = readflo(s, p);
           int off = new_lit(s, mrb_float_value(s->mrb, -f));
 
           genop(s, MKOP_ABx(OP_LOADL, cursp(), off));
@@ -2010,8 +2006,7 @@ codegen(codegen_scope *s, node *tree, int val)
 
           i = readint_mrb_int(s, p, base, TRUE, &overflow);
           if (overflow) {
-            double f = readint_float(s, p, base);
-            int off = new_lit(s, mrb_float_value(s->mrb, -f));
+            int off = new_bigint_lit(s, p, base, TRUE);
 
             genop(s, MKOP_ABx(OP_LOADL, cursp(), off));
           }
@@ -243,6 +243,24 @@ mrb_raise(mrb_state *mrb, struct RClass *c, const char *msg)
   mrb_exc_raise(mrb, mrb_exc_new_str(mrb, c, mesg));
 }
 
+/*
+  Raises mrb->nomem_err, made by mrb_init_gc() so that running out of
+  memory doesn't need any. Only its ciidx is updated, which doesn't
+  allocate either once the instance variable exists.
+*/
+mrb_noreturn void
+mrb_raise_nomemory(mrb_state *mrb)
+{
+  struct RObject *exc = mrb->nomem_err;
+
+  if (!exc || !mrb->jmp) {
+    abort();
+  }
+  mrb_obj_iv_set(mrb, exc, mrb_intern_lit(mrb, "ciidx"), mrb_fixnum_value((mrb_int)(mrb->c->ci - mrb->c->cibase)));
+  mrb->exc = exc;
+  MRB_THROW(mrb->jmp);
+}
+
 mrb_value
 mrb_vformat(mrb_state *mrb, const char *format, va_list ap)
 {
@@ -461,4 +479,5 @@ mrb_init_exception(mrb_state *mrb)
   mrb_define_class(mrb, "RuntimeError", mrb->eStandardError_class);                                    /* 15.2.28 */
   e = mrb_define_class(mrb, "ScriptError", mrb->eException_class);                                     /* 15.2.37 */
   mrb_define_class(mrb, "SyntaxError", e);                                                             /* 15.2.38 */
+  mrb_define_class(mrb, "NoMemoryError", mrb->eException_class);
 }
@@ -141,6 +141,8 @@ mrb_obj_id(mrb_value obj)
   case  MRB_TT_FILE:
   case  MRB_TT_DATA:
   default:
+    /* the id is the address, so the object must stay where it is */
+    if (mrb_basic_p(obj)) mrb_basic_ptr(obj)->flags |= MRB_FLAG_GC_PINNED;
     return MakeID(mrb_ptr(obj));
   }
 }
@@ -151,6 +153,9 @@ mrb_float_value(mrb_state *mrb, mrb_float f)
 {
   mrb_value v;
 
+#ifdef MRB_FLONUM
+  if (mrb_flonum_encode(f, &v)) return v;
+#endif
   v.value.p = mrb_obj_alloc(mrb, MRB_TT_FLOAT, mrb->float_class);
   v.value.fp->f = f;
   return v;
@@ -159,9 +164,16 @@ mrb_float_value(mrb_state *mrb, mrb_float f)
 mrb_value
 mrb_float_pool(mrb_state *mrb, mrb_float f)
 {
-  struct RFloat *nf = (struct RFloat *)mrb_malloc(mrb, sizeof(struct RFloat));
+  struct RFloat *nf;
+#ifdef MRB_FLONUM
+  mrb_value v;
+
+  if (mrb_flonum_encode(f, &v)) return v;
+#endif
+  nf = (struct RFloat *)mrb_malloc(mrb, sizeof(struct RFloat));
   nf->tt = MRB_TT_FLOAT;
   nf->c = mrb->float_class;
+  nf->color = MRB_GC_GRAY;       /* outside the heap; never marked */
   nf->f = f;
   return mrb_obj_value(nf);
 }
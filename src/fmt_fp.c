@@ -0,0 +1,697 @@
+/*
+** fmt_fp.c - Float and Integer formatting
+**
+** See Copyright Notice in mruby.h
+*/
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mruby.h"
+#include "mruby/numeric.h"
+
+/*
+ * Shortest round-trip conversion uses Grisu3 (Florian Loitsch, "Printing
+ * Floating-Point Numbers Quickly and Accurately with Integers", PLDI 2010).
+ * The few values it cannot decide (about 0.5%) are converted through
+ * snprintf/strtod instead, so the result is always the shortest, closest
+ * representation.
+ */
+
+typedef struct {
+  uint64_t f;
+  int e;
+} diy_fp;
+
+/* 10**k for k = -348, -340, ..., 340 */
+static const diy_fp cached_powers[] = {
+  { UINT64_C(0xfa8fd5a0081c0288), -1220 },  /* 1e-348 */
+  { UINT64_C(0xbaaee17fa23ebf76), -1193 },  /* 1e-340 */
+  { UINT64_C(0x8b16fb203055ac76), -1166 },  /* 1e-332 */
+  { UINT64_C(0xcf42894a5dce35ea), -1140 },  /* 1e-324 */
+  { UINT64_C(0x9a6bb0aa55653b2d), -1113 },  /* 1e-316 */
+  { UINT64_C(0xe61acf033d1a45df), -1087 },  /* 1e-308 */
+  { UINT64_C(0xab70fe17c79ac6ca), -1060 },  /* 1e-300 */
+  { UINT64_C(0xff77b1fcbebcdc4f), -1034 },  /* 1e-292 */
+  { UINT64_C(0xbe5691ef416bd60c), -1007 },  /* 1e-284 */
+  { UINT64_C(0x8dd01fad907ffc3c),  -980 },  /* 1e-276 */
+  { UINT64_C(0xd3515c2831559a83),  -954 },  /* 1e-268 */
+  { UINT64_C(0x9d71ac8fada6c9b5),  -927 },  /* 1e-260 */
+  { UINT64_C(0xea9c227723ee8bcb),  -901 },  /* 1e-252 */
+  { UINT64_C(0xaecc49914078536d),  -874 },  /* 1e-244 */
+  { UINT64_C(0x823c12795db6ce57),  -847 },  /* 1e-236 */
+  { UINT64_C(0xc21094364dfb5637),  -821 },  /* 1e-228 */
+  { UINT64_C(0x9096ea6f3848984f),  -794 },  /* 1e-220 */
+  { UINT64_C(0xd77485cb25823ac7),  -768 },  /* 1e-212 */
+  { UINT64_C(0xa086cfcd97bf97f4),  -741 },  /* 1e-204 */
+  { UINT64_C(0xef340a98172aace5),  -715 },  /* 1e-196 */
+  { UINT64_C(0xb23867fb2a35b28e),  -688 },  /* 1e-188 */
+  { UINT64_C(0x84c8d4dfd2c63f3b),  -661 },  /* 1e-180 */
+  { UINT64_C(0xc5dd44271ad3cdba),  -635 },  /* 1e-172 */
+  { UINT64_C(0x936b9fcebb25c996),  -608 },  /* 1e-164 */
+  { UINT64_C(0xdbac6c247d62a584),  -582 },  /* 1e-156 */
+  { UINT64_C(0xa3ab66580d5fdaf6),  -555 },  /* 1e-148 */
+  { UINT64_C(0xf3e2f893dec3f126),  -529 },  /* 1e-140 */
+  { UINT64_C(0xb5b5ada8aaff80b8),  -502 },  /* 1e-132 */
+  { UINT64_C(0x87625f056c7c4a8b),  -475 },  /* 1e-124 */
+  { UINT64_C(0xc9bcff6034c13053),  -449 },  /* 1e-116 */
+  { UINT64_C(0x964e858c91ba2655),  -422 },  /* 1e-108 */
+  { UINT64_C(0xdff9772470297ebd),  -396 },  /* 1e-100 */
+  { UINT64_C(0xa6dfbd9fb8e5b88f),  -369 },  /* 1e-92 */
+  { UINT64_C(0xf8a95fcf88747d94),  -343 },  /* 1e-84 */
+  { UINT64_C(0xb94470938fa89bcf),  -316 },  /* 1e-76 */
+  { UINT64_C(0x8a08f0f8bf0f156b),  -289 },  /* 1e-68 */
+  { UINT64_C(0xcdb02555653131b6),  -263 },  /* 1e-60 */
+  { UINT64_C(0x993fe2c6d07b7fac),  -236 },  /* 1e-52 */
+  { UINT64_C(0xe45c10c42a2b3b06),  -210 },  /* 1e-44 */
+  { UINT64_C(0xaa242499697392d3),  -183 },  /* 1e-36 */
+  { UINT64_C(0xfd87b5f28300ca0e),  -157 },  /* 1e-28 */
+  { UINT64_C(0xbce5086492111aeb),  -130 },  /* 1e-20 */
+  { UINT64_C(0x8cbccc096f5088cc),  -103 },  /* 1e-12 */
+  { UINT64_C(0xd1b71758e219652c),   -77 },  /* 1e-4 */
+  { UINT64_C(0x9c40000000000000),   -50 },  /* 1e4 */
+  { UINT64_C(0xe8d4a51000000000),   -24 },  /* 1e12 */
+  { UINT64_C(0xad78ebc5ac620000),     3 },  /* 1e20 */
+  { UINT64_C(0x813f3978f8940984),    30 },  /* 1e28 */
+  { UINT64_C(0xc097ce7bc90715b3),    56 },  /* 1e36 */
+  { UINT64_C(0x8f7e32ce7bea5c70),    83 },  /* 1e44 */
+  { UINT64_C(0xd5d238a4abe98068),   109 },  /* 1e52 */
+  { UINT64_C(0x9f4f2726179a2245),   136 },  /* 1e60 */
+  { UINT64_C(0xed63a231d4c4fb27),   162 },  /* 1e68 */
+  { UINT64_C(0xb0de65388cc8ada8),   189 },  /* 1e76 */
+  { UINT64_C(0x83c7088e1aab65db),   216 },  /* 1e84 */
+  { UINT64_C(0xc45d1df942711d9a),   242 },  /* 1e92 */
+  { UINT64_C(0x924d692ca61be758),   269 },  /* 1e100 */
+  { UINT64_C(0xda01ee641a708dea),   295 },  /* 1e108 */
+  { UINT64_C(0xa26da3999aef774a),   322 },  /* 1e116 */
+  { UINT64_C(0xf209787bb47d6b85),   348 },  /* 1e124 */
+  { UINT64_C(0xb454e4a179dd1877),   375 },  /* 1e132 */
+  { UINT64_C(0x865b86925b9bc5c2),   402 },  /* 1e140 */
+  { UINT64_C(0xc83553c5c8965d3d),   428 },  /* 1e148 */
+  { UINT64_C(0x952ab45cfa97a0b3),   455 },  /* 1e156 */
+  { UINT64_C(0xde469fbd99a05fe3),   481 },  /* 1e164 */
+  { UINT64_C(0xa59bc234db398c25),   508 },  /* 1e172 */
+  { UINT64_C(0xf6c69a72a3989f5c),   534 },  /* 1e180 */
+  { UINT64_C(0xb7dcbf5354e9bece),   561 },  /* 1e188 */
+  { UINT64_C(0x88fcf317f22241e2),   588 },  /* 1e196 */
+  { UINT64_C(0xcc20ce9bd35c78a5),   614 },  /* 1e204 */
+  { UINT64_C(0x98165af37b2153df),   641 },  /* 1e212 */
+  { UINT64_C(0xe2a0b5dc971f303a),   667 },  /* 1e220 */
+  { UINT64_C(0xa8d9d1535ce3b396),   694 },  /* 1e228 */
+  { UINT64_C(0xfb9b7cd9a4a7443c),   720 },  /* 1e236 */
+  { UINT64_C(0xbb764c4ca7a44410),   747 },  /* 1e244 */
+  { UINT64_C(0x8bab8eefb6409c1a),   774 },  /* 1e252 */
+  { UINT64_C(0xd01fef10a657842c),   800 },  /* 1e260 */
+  { UINT64_C(0x9b10a4e5e9913129),   827 },  /* 1e268 */
+  { UINT64_C(0xe7109bfba19c0c9d),   853 },  /* 1e276 */
+  { UINT64_C(0xac2820d9623bf429),   880 },  /* 1e284 */
+  { UINT64_C(0x80444b5e7aa7cf85),   907 },  /* 1e292 */
+  { UINT64_C(0xbf21e44003acdd2d),   933 },  /* 1e300 */
+  { UINT64_C(0x8e679c2f5e44ff8f),   960 },  /* 1e308 */
+  { UINT64_C(0xd433179d9c8cb841),   986 },  /* 1e316 */
+  { UINT64_C(0x9e19db92b4e31ba9),  1013 },  /* 1e324 */
+  { UINT64_C(0xeb96bf6ebadf77d9),  1039 },  /* 1e332 */
+  { UINT64_C(0xaf87023b9bf0ee6b),  1066 },  /* 1e340 */
+};
+
+static diy_fp
+diy_fp_mul(diy_fp x, diy_fp y)
+{
+  const uint64_t m32 = 0xffffffff;
+  uint64_t a = x.f >> 32, b = x.f & m32;
+  uint64_t c = y.f >> 32, d = y.f & m32;
+  uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+  uint64_t t = (bd >> 32) + (ad & m32) + (bc & m32);
+  diy_fp r;
+
+  t += (uint64_t)1 << 31;   /* round */
+  r.f = ac + (ad >> 32) + (bc >> 32) + (t >> 32);
+  r.e = x.e + y.e + 64;
+  return r;
+}
+
+static diy_fp
+diy_fp_normalize(diy_fp x)
+{
+  while (!(x.f & UINT64_C(0xffc0000000000000))) {
+    x.f <<= 10;
+    x.e -= 10;
+  }
+  while (!(x.f & UINT64_C(0x8000000000000000))) {
+    x.f <<= 1;
+    x.e--;
+  }
+  return x;
+}
+
+/* splits |v| into f * 2**e; lower is set if the gap below v is halved */
+static diy_fp
+flo_decompose(mrb_float v, mrb_bool *lower)
+{
+  diy_fp r;
+#ifdef MRB_USE_FLOAT
+  uint32_t bits;
+  uint32_t frac;
+  int biased;
+
+  memcpy(&bits, &v, sizeof(bits));
+  frac = bits & 0x7fffff;
+  biased = (int)((bits >> 23) & 0xff);
+  if (biased) {
+    r.f = frac + 0x800000;
+    r.e = biased - 150;
+  }
+  else {
+    r.f = frac;
+    r.e = 1 - 150;
+  }
+#else
+  uint64_t bits;
+  uint64_t frac;
+  int biased;
+
+  memcpy(&bits, &v, sizeof(bits));
+  frac = bits & UINT64_C(0xfffffffffffff);
+  biased = (int)((bits >> 52) & 0x7ff);
+  if (biased) {
+    r.f = frac + UINT64_C(0x10000000000000);
+    r.e = biased - 1075;
+  }
+  else {
+    r.f = frac;
+    r.e = 1 - 1075;
+  }
+#endif
+  if (lower) *lower = frac == 0 && biased > 1;
+  return r;
+}
+
+static const uint64_t pow10_tbl[] = {
+  UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000),
+  UINT64_C(100000), UINT64_C(1000000), UINT64_C(10000000),
+  UINT64_C(100000000), UINT64_C(1000000000), UINT64_C(10000000000),
+  UINT64_C(100000000000), UINT64_C(1000000000000),
+  UINT64_C(10000000000000), UINT64_C(100000000000000),
+  UINT64_C(1000000000000000), UINT64_C(10000000000000000),
+  UINT64_C(100000000000000000), UINT64_C(1000000000000000000),
+  UINT64_C(10000000000000000000),
+};
+
+/*
+ * Moves the last digit towards w and checks that the result is the
+ * closest shortest representation despite the imprecision of the scaled
+ * boundaries (unit).  Returns FALSE when that cannot be proven.
+ */
+static mrb_bool
+round_weed(char *buf, int len, uint64_t dist_high_w, uint64_t unsafe, uint64_t rest, uint64_t ten_kappa, uint64_t unit)
+{
+  uint64_t small = dist_high_w - unit;
+  uint64_t big = dist_high_w + unit;
+
+  while (rest < small && unsafe - rest >= ten_kappa &&
+         (rest + ten_kappa < small || small - rest >= rest + ten_kappa - small)) {
+    buf[len-1]--;
+    rest += ten_kappa;
+  }
+  if (rest < big && unsafe - rest >= ten_kappa &&
+      (rest + ten_kappa < big || big - rest > rest + ten_kappa - big)) {
+    return FALSE;
+  }
+  return 2 * unit <= rest && rest <= unsafe - 4 * unit;
+}
+
+/* returns the digit count, or -1 if Grisu3 cannot decide */
+static int
+digit_gen(diy_fp w, diy_fp low, diy_fp high, char *buf, int *K)
+{
+  const int shift = -w.e;
+  const uint64_t one = (uint64_t)1 << shift;
+  uint64_t unit = 1;
+  uint64_t too_high = high.f + unit;
+  uint64_t unsafe = too_high - (low.f - unit);
+  uint32_t p1 = (uint32_t)(too_high >> shift);
+  uint64_t p2 = too_high & (one - 1);
+  int kappa = 1, len = 0;
+
+  while (kappa < 10 && p1 >= pow10_tbl[kappa]) kappa++;
+  while (kappa > 0) {
+    uint32_t d = (uint32_t)(p1 / pow10_tbl[kappa-1]);
+    uint64_t rest;
+
+    p1 %= (uint32_t)pow10_tbl[kappa-1];
+    buf[len++] = (char)('0' + d);
+    kappa--;
+    rest = ((uint64_t)p1 << shift) + p2;
+    if (rest < unsafe) {
+      *K += kappa;
+      if (!round_weed(buf, len, too_high - w.f, unsafe, rest, pow10_tbl[kappa] << shift, unit))
+        return -1;
+      return len;
+    }
+  }
+  for (;;) {
+    p2 *= 10;
+    unit *= 10;
+    unsafe *= 10;
+    buf[len++] = (char)('0' + (p2 >> shift));
+    p2 &= one - 1;
+    kappa--;
+    if (p2 < unsafe) {
+      *K += kappa;
+      if (!round_weed(buf, len, (too_high - w.f) * unit, unsafe, p2, one, unit))
+        return -1;
+      return len;
+    }
+  }
+}
+
+#ifdef MRB_USE_FLOAT
+#define FLO_ROUNDTRIP_DIG 9
+#define flo_strtod(s) strtof(s, NULL)
+#else
+#define FLO_ROUNDTRIP_DIG 17
+#define flo_strtod(s) strtod(s, NULL)
+#endif
+
+/* exact but slow path for the rare values Grisu3 rejects */
+static int
+flo_shortest_exact(mrb_float f, char *buf, int *decpt)
+{
+  char tmp[FLO_ROUNDTRIP_DIG + 16];
+  char *e;
+  int prec, len;
+
+  f = fabs(f);
+  for (prec = 1; prec < FLO_ROUNDTRIP_DIG; prec++) {
+    snprintf(tmp, sizeof(tmp), "%.*e", prec - 1, (double)f);
+    if (flo_strtod(tmp) == f) break;
+  }
+  if (prec == FLO_ROUNDTRIP_DIG) {
+    snprintf(tmp, sizeof(tmp), "%.*e", prec - 1, (double)f);
+  }
+  e = strchr(tmp, 'e');
+  buf[0] = tmp[0];
+  len = 1;
+  if (prec > 1) {
+    memcpy(buf + 1, tmp + 2, prec - 1);
+    len = prec;
+  }
+  while (len > 1 && buf[len-1] == '0') len--;
+  *decpt = atoi(e + 1) + 1;
+  return len;
+}
+
+/*
+ * Writes the shortest digits that read back as |f| (finite, non-zero) to
+ * buf, which must hold MRB_FLO_SHORTEST_MAX bytes, and returns their count.
+ * *decpt is set so that |f| == 0.DIGITS * 10**(*decpt).
+ */
+int
+mrb_flo_shortest(mrb_float f, char *buf, int *decpt)
+{
+  mrb_bool lower;
+  diy_fp v = flo_decompose(f, &lower);
+  diy_fp mp, mm, c, w, wp, wm;
+  double dk;
+  int k, K, len;
+
+  mp.f = (v.f << 1) + 1;
+  mp.e = v.e - 1;
+  mp = diy_fp_normalize(mp);
+  if (lower) {
+    mm.f = (v.f << 2) - 1;
+    mm.e = v.e - 2;
+  }
+  else {
+    mm.f = (v.f << 1) - 1;
+    mm.e = v.e - 1;
+  }
+  mm.f <<= mm.e - mp.e;
+  mm.e = mp.e;
+  v = diy_fp_normalize(v);
+
+  /* pick 10**-K so that the scaled exponent falls in [-59, -32] */
+  dk = (-61 - mp.e) * 0.30102999566398114 + 347;
+  k = (int)dk;
+  if (dk - k > 0.0) k++;
+  c = cached_powers[(k >> 3) + 1];
+  K = -(-348 + ((k >> 3) + 1) * 8);
+
+  w = diy_fp_mul(v, c);
+  wp = diy_fp_mul(mp, c);
+  wm = diy_fp_mul(mm, c);
+  len = digit_gen(w, wm, wp, buf, &K);
+  if (len < 0) {
+    return flo_shortest_exact(f, buf, decpt);
+  }
+  while (len > 1 && buf[len-1] == '0') {
+    len--;
+    K++;
+  }
+  *decpt = len + K;
+  return len;
+}
+
+static const char digit_pairs[] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+/*
+ * Writes the decimal digits of v backwards so that they end just before
+ * end, and returns a pointer to the first digit.
+ */
+char*
+mrb_uint_to_dec(char *end, uint64_t v)
+{
+  while (v >= 100) {
+    unsigned i = (unsigned)(v % 100) * 2;
+
+    v /= 100;
+    *--end = digit_pairs[i+1];
+    *--end = digit_pairs[i];
+  }
+  if (v >= 10) {
+    unsigned i = (unsigned)v * 2;
+
+    *--end = digit_pairs[i+1];
+    *--end = digit_pairs[i];
+  }
+  else {
+    *--end = (char)('0' + v);
+  }
+  return end;
+}
+
+/* ------------------------------------------------------------------------*/
+/* fixed precision formatting */
+
+typedef struct {
+  uint64_t hi, lo;
+} u128;
+
+static u128
+mul_64x64(uint64_t x, uint64_t y)
+{
+  const uint64_t m32 = 0xffffffff;
+  uint64_t a = x >> 32, b = x & m32, c = y >> 32, d = y & m32;
+  uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+  uint64_t mid = (bd >> 32) + (ad & m32) + (bc & m32);
+  u128 r;
+
+  r.lo = (mid << 32) | (bd & m32);
+  r.hi = ac + (ad >> 32) + (bc >> 32) + (mid >> 32);
+  return r;
+}
+
+/* largest n for which 5**n fits in 64 bits */
+#define SCALE_MAX 27
+
+/* n / d for n.hi < d */
+static uint64_t
+div_128_64(u128 n, uint64_t d, uint64_t *rem)
+{
+  uint64_t r = n.hi, q = 0;
+  int i;
+
+  for (i = 63; i >= 0; i--) {
+    uint64_t carry = r >> 63;
+
+    r = (r << 1) | ((n.lo >> i) & 1);
+    q <<= 1;
+    if (carry || r >= d) {
+      r -= d;
+      q |= 1;
+    }
+  }
+  *rem = r;
+  return q;
+}
+
+/* rounds q + rem/d (rem < d) to nearest, ties to even */
+static mrb_bool
+round_half_even(uint64_t q, uint64_t rem, uint64_t d, uint64_t *out)
+{
+  uint64_t half = d - rem;   /* rem > d/2  <=>  rem > half */
+
+  if (rem > half || (rem == half && (q & 1))) {
+    if (q == UINT64_MAX) return FALSE;
+    q++;
+  }
+  *out = q;
+  return TRUE;
+}
+
+/*
+ * Computes round(|f| * 10**n) exactly for -SCALE_MAX <= n <= SCALE_MAX,
+ * rounding ties to even as printf does.  Returns FALSE if the result
+ * doesn't fit in 64 bits.
+ */
+static mrb_bool
+flo_scale(mrb_float f, int n, uint64_t *out)
+{
+  diy_fp v = flo_decompose(f, NULL);
+  uint64_t p5 = 1, q, rem;
+  u128 p;
+  int s, i;
+
+  for (i = 0; i < (n < 0 ? -n : n); i++) p5 *= 5;
+  if (n < 0) {
+    /* |f| / 10**-n == v.f * 2**(v.e + n) / 5**-n */
+    s = v.e + n;
+    if (s >= 0) {
+      if (s >= 64) {
+        if (s >= 128 - 53) return FALSE;
+        p.hi = v.f << (s - 64);
+        p.lo = 0;
+      }
+      else {
+        p.hi = s == 0 ? 0 : v.f >> (64 - s);
+        p.lo = v.f << s;
+      }
+      if (p.hi >= p5) return FALSE;
+      q = div_128_64(p, p5, &rem);
+      return round_half_even(q, rem, p5, out);
+    }
+    s = -s;
+    if (s >= 64 || (p5 >> (64 - s)) != 0) {
+      /* divisor > 2**64 > 2 * v.f */
+      *out = 0;
+      return TRUE;
+    }
+    p5 <<= s;
+    return round_half_even(v.f / p5, v.f % p5, p5, out);
+  }
+
+  p = mul_64x64(v.f, p5);
+  s = v.e + n;
+  if (s >= 0) {
+    if (p.hi != 0 || s >= 64 || (s > 0 && (p.lo >> (64 - s)) != 0)) return FALSE;
+    *out = p.lo << s;
+    return TRUE;
+  }
+  s = -s;
+  if (s >= 128) {
+    /* p < 2**117, so the result rounds to zero */
+    *out = 0;
+    return TRUE;
+  }
+  else {
+    u128 rm, half;
+
+    if (s >= 64) {
+      q = s == 64 ? p.hi : p.hi >> (s - 64);
+      rm.hi = s == 64 ? 0 : p.hi & (((uint64_t)1 << (s - 64)) - 1);
+      rm.lo = p.lo;
+    }
+    else {
+      if (p.hi >> s) return FALSE;
+      q = (p.lo >> s) | (p.hi << (64 - s));
+      rm.hi = 0;
+      rm.lo = p.lo & (((uint64_t)1 << s) - 1);
+    }
+    if (s - 1 >= 64) {
+      half.hi = (uint64_t)1 << (s - 65);
+      half.lo = 0;
+    }
+    else {
+      half.hi = 0;
+      half.lo = (uint64_t)1 << (s - 1);
+    }
+    if (rm.hi > half.hi || (rm.hi == half.hi && rm.lo > half.lo) ||
+        (rm.hi == half.hi && rm.lo == half.lo && (q & 1))) {
+      if (q == UINT64_MAX) return FALSE;
+      q++;
+    }
+    *out = q;
+    return TRUE;
+  }
+}
+
+static int
+dec_len(uint64_t v)
+{
+  int n = 1;
+
+  while (n < 20 && v >= pow10_tbl[n]) n++;
+  return n;
+}
+
+/*
+ * Rounds |f| to prec + 1 significant digits.  Stores them in digits and
+ * the decimal exponent of the first one in *exp10.
+ */
+static mrb_bool
+flo_sig_digits(mrb_float f, int prec, char *digits, int *exp10)
+{
+  int x, tries;
+  uint64_t n;
+
+  if (f == 0.0) {
+    memset(digits, '0', prec + 1);
+    *exp10 = 0;
+    return TRUE;
+  }
+  x = (int)floor(log10(f));
+  for (tries = 0; tries < 3; tries++) {
+    int d;
+
+    if (prec - x < -SCALE_MAX || prec - x > SCALE_MAX) return FALSE;
+    if (!flo_scale(f, prec - x, &n)) return FALSE;
+    d = dec_len(n);
+    if (d == prec + 1) {
+      mrb_uint_to_dec(digits + prec + 1, n);
+      *exp10 = x;
+      return TRUE;
+    }
+    if (d == prec + 2 && n == pow10_tbl[prec + 1]) {
+      /* rounded up to the next power of ten */
+      digits[0] = '1';
+      memset(digits + 1, '0', prec);
+      *exp10 = x + 1;
+      return TRUE;
+    }
+    x += d > prec + 1 ? 1 : -1;
+  }
+  return FALSE;
+}
+
+static char*
+put_exp(char *p, int x, char e)
+{
+  char buf[8], *b;
+
+  *p++ = e;
+  if (x < 0) {
+    *p++ = '-';
+    x = -x;
+  }
+  else {
+    *p++ = '+';
+  }
+  if (x < 10) *p++ = '0';
+  b = mrb_uint_to_dec(buf + sizeof(buf), (uint64_t)x);
+  while (b < buf + sizeof(buf)) *p++ = *b++;
+  return p;
+}
+
+/*
+ * Formats |f| like printf's %f, %e or %g conversion (fmt, upper case
+ * allowed) with precision prec and the '#' flag alt, but without sign or
+ * padding.  Returns the length written to buf, or -1 if f can't be
+ * formatted exactly here (too large, too precise, or buffer too small);
+ * callers should fall back to snprintf then.
+ */
+int
+mrb_flo_format(char *buf, size_t size, mrb_float f, char fmt, int prec, mrb_bool alt)
+{
+  char digits[24];
+  char *p = buf;
+  char e = isupper((unsigned char)fmt) ? 'E' : 'e';
+  int x, i;
+
+  if (!isfinite(f) || prec < 0) return -1;
+  if (f < 0) f = -f;
+  switch (tolower((unsigned char)fmt)) {
+  case 'f':
+    {
+      uint64_t n;
+      char *d;
+      int len;
+
+      if (prec > SCALE_MAX || !flo_scale(f, prec, &n)) return -1;
+      d = mrb_uint_to_dec(digits + sizeof(digits), n);
+      len = (int)(digits + sizeof(digits) - d);
+      if ((size_t)(len + prec + 3) > size) return -1;
+      if (len <= prec) {
+        *p++ = '0';
+      }
+      else {
+        memcpy(p, d, len - prec);
+        p += len - prec;
+      }
+      if (prec > 0 || alt) *p++ = '.';
+      for (i = len; i < prec; i++) *p++ = '0';
+      if (len > prec) {
+        memcpy(p, d + len - prec, prec);
+      }
+      else {
+        memcpy(p, d, len);
+      }
+      p += len < prec ? len : prec;
+    }
+    break;
+
+  case 'e':
+    if (prec > 19 || (size_t)prec + 10 > size) return -1;
+    if (!flo_sig_digits(f, prec, digits, &x)) return -1;
+    *p++ = digits[0];
+    if (prec > 0 || alt) *p++ = '.';
+    memcpy(p, digits + 1, prec);
+    p += prec;
+    p = put_exp(p, x, e);
+    break;
+
+  case 'g':
+    {
+      int sig = prec == 0 ? 1 : prec;
+      int len;
+
+      if (sig > 20 || (size_t)sig + 10 > size) return -1;
+      if (!flo_sig_digits(f, sig - 1, digits, &x)) return -1;
+      len = sig;
+      if (!alt) {
+        while (len > 1 && digits[len-1] == '0') len--;
+      }
+      if (x < -4 || x >= sig) {
+        *p++ = digits[0];
+        if (len > 1 || alt) *p++ = '.';
+        memcpy(p, digits + 1, len - 1);
+        p += len - 1;
+        p = put_exp(p, x, e);
+      }
+      else if (x < 0) {
+        if ((size_t)(len - x + 2) > size) return -1;
+        *p++ = '0';
+        *p++ = '.';
+        for (i = x; i < -1; i++) *p++ = '0';
+        memcpy(p, digits, len);
+        p += len;
+      }
+      else {
+        /* x + 1 integer digits out of len significant ones */
+        for (i = 0; i <= x; i++) *p++ = i < len ? digits[i] : '0';
+        if (len > x + 1 || alt) *p++ = '.';
+        for (; i < len; i++) *p++ = digits[i];
+      }
+    }
+    break;
+
+  default:
+    return -1;
+  }
+  return (int)(p - buf);
+}
@@ -6,16 +6,36 @@
 
 #include <string.h>
 #include <stdlib.h>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#if defined(MRB_GC_PARALLEL_MARK) || defined(MRB_GC_BACKGROUND_FREE)
+#include <pthread.h>
+#endif
+#ifdef MRB_GC_PARALLEL_MARK
+#include <sched.h>
+#endif
+#if defined(MRB_GC_HUGE_PAGES) && !defined(_WIN32)
+#include <sys/mman.h>
+#endif
 #include "mruby.h"
 #include "mruby/array.h"
 #include "mruby/class.h"
 #include "mruby/data.h"
+#include "mruby/error.h"
 #include "mruby/hash.h"
 #include "mruby/proc.h"
 #include "mruby/range.h"
 #include "mruby/string.h"
 #include "mruby/variable.h"
 #include "mruby/gc.h"
+#include "mrb_throw.h"
+
+void mrb_gc_mark_symtbl(mrb_state *mrb);
+void mrb_gc_update_symtbl(mrb_state *mrb);
 
 /*
   = Tri-color Incremental Garbage Collection
@@ -60,6 +80,46 @@
 
   For details, see the comments for each function.
 
+  Instead of a number of objects, each incremental step can be given a
+  wall clock budget (gc_step_budget_set); the clock is then read every
+  GC_BUDGET_CHECK_INTERVAL marked objects or one swept page. With a budget,
+  malloc pressure runs a step on every allocation rather than a whole
+  cycle at once. Minor GCs stay atomic. Either way every pause is recorded
+  in mrb->gc_pause (see gc_pause_stats).
+
+  Object counts don't tell how much memory dead objects hold, so the bytes
+  requested through mrb_malloc/mrb_realloc are counted as well. When more
+  than malloc_limit bytes were allocated since the last cycle, the next
+  object allocation runs a whole GC cycle; in generational mode the bytes
+  since the last major GC decide, like live objects, when to go major.
+  See gc_malloc_limit_set.
+
+  Every block from mrb_malloc() and friends starts with a word holding
+  its size and kind, so mrb->memory knows the bytes held by heap pages,
+  payloads and compiler pools, and their peaks. The collector's own
+  bookkeeping (gray stacks, card tables, the freer's batches) goes to
+  allocf directly and isn't counted. See mrb_memory_limit_set for the
+  soft and hard limits on those bytes.
+
+  == Allocation
+
+  A new heap page is not threaded into a freelist. Its slots are handed
+  out in address order by bumping page->bump, and only slots freed by the
+  sweeper go on page->freelist; slots at and above page->bump have never
+  been used and are neither swept nor visited. A page whose objects all
+  died is reset to an empty bump page rather than being refilled through
+  a freelist of 1024 entries, so short-lived objects are allocated from
+  contiguous memory again after each cycle.
+
+  Slots come in MRB_GC_SLOT_CLASSES widths: a page of class n holds
+  slots of 2**n RVALUEs, so it has fewer of them, and every loop over a
+  page steps by page->width. mrb_obj_alloc_size() hands out the
+  narrowest slot that holds the requested bytes; objects use the space
+  past their struct for a small payload (see MRB_ARY_EMBED_P), saving a
+  malloc and a pointer chase. Each class has its own list of pages with
+  free slots. Wide slots are never taken inside a region and wide pages
+  are left out of compaction, so embedded payloads do not move.
+
   == Write Barrier
 
   mruby implementer and C extension library writer must write a write
@@ -160,22 +220,341 @@ gettimeofday_time(void)
 #endif
 
 #define GC_STEP_SIZE 1024
+#define GC_BUDGET_CHECK_INTERVAL 256
 
+static uint64_t
+gc_clock_us(void)
+{
+#if defined(_WIN32)
+  static LARGE_INTEGER freq;
+  LARGE_INTEGER now;
+
+  if (freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&now);
+  return (uint64_t)(now.QuadPart / freq.QuadPart * 1000000 +
+                    now.QuadPart % freq.QuadPart * 1000000 / freq.QuadPart);
+#elif defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+  return (uint64_t)clock() * 1000000 / CLOCKS_PER_SEC;
+#endif
+}
 
-void*
-mrb_realloc_simple(mrb_state *mrb, void *p,  size_t len)
+/* bucket index: exact below 8us, then 8 buckets per power of two */
+static int
+gc_pause_bucket(uint32_t us)
 {
-  void *p2;
+  int e = 0, i;
+
+  if (us < 8) return (int)us;
+  while ((us >> e) >= 16) e++;
+  i = (e + 1) * 8 + (int)((us >> e) & 7);
+  return i < MRB_GC_PAUSE_BUCKETS ? i : MRB_GC_PAUSE_BUCKETS - 1;
+}
 
-  p2 = (mrb->allocf)(mrb, p, len, mrb->ud);
-  if (!p2 && len > 0 && mrb->heaps) {
-    mrb_full_gc(mrb);
-    p2 = (mrb->allocf)(mrb, p, len, mrb->ud);
+/* largest pause that falls into bucket i */
+static uint32_t
+gc_pause_bucket_max(int i)
+{
+  int e;
+
+  if (i < 8) return (uint32_t)i;
+  e = i / 8 - 1;
+  return (((uint32_t)(8 + i % 8) + 1) << e) - 1;
+}
+
+static void
+gc_pause_record(mrb_state *mrb, uint64_t start)
+{
+  uint64_t d = gc_clock_us() - start;
+  uint32_t us = d > UINT32_MAX ? UINT32_MAX : (uint32_t)d;
+
+  mrb->gc_pause.hist[gc_pause_bucket(us)]++;
+  mrb->gc_pause.count++;
+  mrb->gc_pause.total_us += us;
+  if (us > mrb->gc_pause.max_us) mrb->gc_pause.max_us = us;
+}
+
+/*
+ * Returns the pause length (usec) below which pct percent of the GC pauses
+ * so far fell, rounded up to the histogram resolution (1/8 octave).
+ */
+uint32_t
+mrb_gc_pause_percentile(mrb_state *mrb, double pct)
+{
+  size_t rank, seen = 0;
+  int i;
+
+  if (mrb->gc_pause.count == 0) return 0;
+  if (pct >= 100) return mrb->gc_pause.max_us;
+  rank = (size_t)(mrb->gc_pause.count * (pct < 0 ? 0 : pct) / 100);
+  for (i = 0; i < MRB_GC_PAUSE_BUCKETS; i++) {
+    seen += mrb->gc_pause.hist[i];
+    if (seen > rank) {
+      uint32_t us = gc_pause_bucket_max(i);
+      return us < mrb->gc_pause.max_us ? us : mrb->gc_pause.max_us;
+    }
   }
+  return mrb->gc_pause.max_us;
+}
 
-  return p2;
+
+#ifdef MRB_GC_BACKGROUND_FREE
+/*
+  == Background Freeing
+
+  While sweeping, mrb_free() does not return the payloads of dead
+  objects (string buffers, array storage, hash tables, ...) to the
+  allocator itself. It collects them into batches that a background
+  thread hands to allocf, so the allocator work is moved off the
+  mutator. allocf must therefore be safe to call from another thread.
+  When the queue is too long the sweeper frees the batch itself.
+*/
+#define GC_FREE_BATCH 1022
+#define GC_FREE_QUEUE_MAX 64
+
+struct gc_free_batch {
+  struct gc_free_batch *next;
+  size_t len;
+  void *ptr[GC_FREE_BATCH];
+};
+
+struct mrb_gc_freer {
+  mrb_state *mrb;
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t wake;          /* batches queued or shutdown requested */
+  pthread_cond_t idle;          /* the queue has been drained */
+  struct gc_free_batch *head;
+  struct gc_free_batch *tail;
+  size_t queued;
+  mrb_bool busy;
+  mrb_bool shutdown;
+  struct gc_free_batch *cur;    /* filled by the sweeper */
+};
+
+static void
+gc_free_batch_run(mrb_state *mrb, struct gc_free_batch *b)
+{
+  size_t i;
+
+  for (i = 0; i < b->len; i++) {
+    (mrb->allocf)(mrb, b->ptr[i], 0, mrb->ud);
+  }
+  (mrb->allocf)(mrb, b, 0, mrb->ud);
+}
+
+static void*
+gc_freer_main(void *arg)
+{
+  struct mrb_gc_freer *f = (struct mrb_gc_freer*)arg;
+
+  pthread_mutex_lock(&f->lock);
+  for (;;) {
+    struct gc_free_batch *b;
+
+    while (f->head == NULL && !f->shutdown) {
+      f->busy = FALSE;
+      pthread_cond_broadcast(&f->idle);
+      pthread_cond_wait(&f->wake, &f->lock);
+    }
+    if (f->head == NULL) break;
+    b = f->head;
+    f->head = f->tail = NULL;
+    f->queued = 0;
+    f->busy = TRUE;
+    pthread_mutex_unlock(&f->lock);
+    while (b) {
+      struct gc_free_batch *next = b->next;
+
+      gc_free_batch_run(f->mrb, b);
+      b = next;
+    }
+    pthread_mutex_lock(&f->lock);
+  }
+  f->busy = FALSE;
+  pthread_cond_broadcast(&f->idle);
+  pthread_mutex_unlock(&f->lock);
+  return NULL;
+}
+
+/* the freer of mrb, started on first use; NULL if no thread could be started */
+static struct mrb_gc_freer*
+gc_freer_get(mrb_state *mrb)
+{
+  struct mrb_gc_freer *f = mrb->gc_freer;
+
+  if (f) return f;
+  /* called while sweeping; a failing mrb_malloc() must not start a GC */
+  f = (struct mrb_gc_freer*)(mrb->allocf)(mrb, NULL, sizeof(struct mrb_gc_freer), mrb->ud);
+  if (f == NULL) return NULL;
+  memset(f, 0, sizeof(*f));
+  f->mrb = mrb;
+  pthread_mutex_init(&f->lock, NULL);
+  pthread_cond_init(&f->wake, NULL);
+  pthread_cond_init(&f->idle, NULL);
+  if (pthread_create(&f->thread, NULL, gc_freer_main, f) != 0) {
+    pthread_cond_destroy(&f->idle);
+    pthread_cond_destroy(&f->wake);
+    pthread_mutex_destroy(&f->lock);
+    (mrb->allocf)(mrb, f, 0, mrb->ud);
+    return NULL;
+  }
+  mrb->gc_freer = f;
+  return f;
+}
+
+/* hand the batch being filled to the thread */
+static void
+gc_freer_submit(mrb_state *mrb)
+{
+  struct mrb_gc_freer *f = mrb->gc_freer;
+  struct gc_free_batch *b;
+
+  if (f == NULL || f->cur == NULL || f->cur->len == 0) return;
+  b = f->cur;
+  f->cur = NULL;
+  pthread_mutex_lock(&f->lock);
+  if (f->queued >= GC_FREE_QUEUE_MAX) {
+    /* the thread is falling behind; don't let the backlog grow */
+    pthread_mutex_unlock(&f->lock);
+    gc_free_batch_run(mrb, b);
+    return;
+  }
+  if (f->tail) f->tail->next = b;
+  else f->head = b;
+  f->tail = b;
+  f->queued++;
+  pthread_cond_signal(&f->wake);
+  pthread_mutex_unlock(&f->lock);
+}
+
+static void
+gc_defer_free(mrb_state *mrb, void *p)
+{
+  struct mrb_gc_freer *f = mrb->gc_freer;
+
+  if (f->cur == NULL) {
+    f->cur = (struct gc_free_batch*)(mrb->allocf)(mrb, NULL, sizeof(struct gc_free_batch), mrb->ud);
+    if (f->cur == NULL) {
+      (mrb->allocf)(mrb, p, 0, mrb->ud);
+      return;
+    }
+    f->cur->next = NULL;
+    f->cur->len = 0;
+  }
+  f->cur->ptr[f->cur->len++] = p;
+  if (f->cur->len == GC_FREE_BATCH) {
+    gc_freer_submit(mrb);
+  }
+}
+
+/* wait until everything deferred so far has been freed */
+static void
+gc_freer_drain(mrb_state *mrb)
+{
+  struct mrb_gc_freer *f = mrb->gc_freer;
+
+  if (f == NULL) return;
+  gc_freer_submit(mrb);
+  pthread_mutex_lock(&f->lock);
+  while (f->head || f->busy) {
+    pthread_cond_wait(&f->idle, &f->lock);
+  }
+  pthread_mutex_unlock(&f->lock);
+}
+
+static void
+gc_freer_free(mrb_state *mrb)
+{
+  struct mrb_gc_freer *f = mrb->gc_freer;
+
+  if (f == NULL) return;
+  gc_freer_submit(mrb);
+  pthread_mutex_lock(&f->lock);
+  f->shutdown = TRUE;
+  pthread_cond_signal(&f->wake);
+  pthread_mutex_unlock(&f->lock);
+  pthread_join(f->thread, NULL);
+  pthread_cond_destroy(&f->idle);
+  pthread_cond_destroy(&f->wake);
+  pthread_mutex_destroy(&f->lock);
+  (mrb->allocf)(mrb, f, 0, mrb->ud);
+  mrb->gc_freer = NULL;
+}
+#endif
+
+static void gc_finish_sweep(mrb_state *mrb);
+static void gc_cards_free(mrb_state *mrb);
+
+/* each block from mrb_malloc() and friends starts with its size and kind */
+union memory_header {
+  size_t word;                  /* (size << 2) | kind */
+  double align;
+};
+
+#define MEMORY_HEADER_SIZE sizeof(union memory_header)
+#define MEMORY_SIZE_MAX ((SIZE_MAX >> 2) - MEMORY_HEADER_SIZE)
+
+static mrb_bool
+memory_over_hard_limit_p(mrb_state *mrb, size_t old, size_t len)
+{
+  return mrb->memory.hard_limit > 0 && len > old &&
+    mrb->memory.bytes - old + len > mrb->memory.hard_limit;
+}
+
+static void*
+memory_realloc(mrb_state *mrb, void *p, size_t len, enum mrb_memory_kind kind)
+{
+  struct mrb_memory_stat *m = &mrb->memory;
+  union memory_header *h = NULL;
+  size_t old = 0;
+
+  if (p) {
+    h = (union memory_header*)p - 1;
+    old = h->word >> 2;
+    kind = (enum mrb_memory_kind)(h->word & 3);
+  }
+  if (len > MEMORY_SIZE_MAX) return NULL;
+  /* no GC here: the caller may be halfway through updating an object,
+     so a failure only makes the next object allocation collect */
+  if (memory_over_hard_limit_p(mrb, old, len)) {
+    mrb->memory_gc_pending = TRUE;
+    return NULL;
+  }
+  h = (union memory_header*)(mrb->allocf)(mrb, h, MEMORY_HEADER_SIZE + len, mrb->ud);
+  if (!h) {
+    mrb->memory_gc_pending = TRUE;
+    return NULL;
+  }
+
+  h->word = (len << 2) | kind;
+  m->bytes += len - old;
+  m->kind_bytes[kind] += len - old;
+  if (m->bytes > m->peak) m->peak = m->bytes;
+  if (m->kind_bytes[kind] > m->kind_peak[kind]) m->kind_peak[kind] = m->kind_bytes[kind];
+  if ((m->soft_limit > 0 && m->bytes > mrb->memory_soft_next) ||
+      (m->hard_limit > 0 && m->bytes > mrb->memory_hard_next)) {
+    mrb->memory_gc_pending = TRUE;
+  }
+  /* malloc pressure; a realloc counts as a new block */
+  mrb->malloc_increase += len;
+  mrb->oldmalloc_increase += len;
+  return h + 1;
 }
 
+void*
+mrb_realloc_simple(mrb_state *mrb, void *p,  size_t len)
+{
+  if (len == 0) {
+    mrb_free(mrb, p);
+    return NULL;
+  }
+  return memory_realloc(mrb, p, len, MRB_MEMORY_PAYLOAD);
+}
 
 void*
 mrb_realloc(mrb_state *mrb, void *p, size_t len)
@@ -184,18 +563,8 @@ mrb_realloc(mrb_state *mrb, void *p, size_t len)
 
   p2 = mrb_realloc_simple(mrb, p, len);
   if (!p2 && len) {
-    if (mrb->out_of_memory) {
-      /* mrb_panic(mrb); */
-    }
-    else {
-      mrb->out_of_memory = TRUE;
-      mrb_raise(mrb, E_RUNTIME_ERROR, "Out of memory");
-    }
+    mrb_raise_nomemory(mrb);
   }
-  else {
-    mrb->out_of_memory = FALSE;
-  }
-
   return p2;
 }
 
@@ -211,6 +580,13 @@ mrb_malloc_simple(mrb_state *mrb, size_t len)
   return mrb_realloc_simple(mrb, 0, len);
 }
 
+void*
+mrb_malloc_kind(mrb_state *mrb, size_t len, enum mrb_memory_kind kind)
+{
+  if (len == 0) return NULL;
+  return memory_realloc(mrb, NULL, len, kind);
+}
+
 void*
 mrb_calloc(mrb_state *mrb, size_t nelem, size_t len)
 {
@@ -236,23 +612,186 @@ mrb_calloc(mrb_state *mrb, size_t nelem, size_t len)
 void
 mrb_free(mrb_state *mrb, void *p)
 {
-  (mrb->allocf)(mrb, p, 0, mrb->ud);
+  union memory_header *h;
+  size_t len;
+
+  if (p == NULL) return;
+  h = (union memory_header*)p - 1;
+  len = h->word >> 2;
+  mrb->memory.bytes -= len;
+  mrb->memory.kind_bytes[h->word & 3] -= len;
+#ifdef MRB_GC_BACKGROUND_FREE
+  if (mrb->gc_deferring) {
+    gc_defer_free(mrb, h);
+    return;
+  }
+#endif
+  (mrb->allocf)(mrb, h, 0, mrb->ud);
+}
+
+/* half way from the bytes held now to the hard limit */
+static void
+memory_hard_next_set(mrb_state *mrb)
+{
+  struct mrb_memory_stat *m = &mrb->memory;
+
+  mrb->memory_hard_next = m->bytes < m->hard_limit ?
+    m->bytes + (m->hard_limit - m->bytes) / 2 : m->hard_limit;
+}
+
+/*
+ * Limits on the bytes mrb_malloc() and friends hold. Beyond soft, the
+ * next object allocation runs a full GC; after that the trigger rises
+ * to a quarter of soft above what survived, so that a state living
+ * above its soft limit doesn't collect all the time. An allocation that
+ * would go beyond hard fails; mrb_malloc() then raises NoMemoryError.
+ * Collecting inside mrb_malloc() isn't safe, as its caller may hold an
+ * object half updated, so the full GC that makes room under hard runs
+ * on the next object allocation: after such a failure, and whenever
+ * the bytes get half way from what survived the last one to hard.
+ * 0 disables a limit. The hard limit given here also caps what
+ * GC.memory_limit= may set.
+ */
+void
+mrb_memory_limit_set(mrb_state *mrb, size_t soft, size_t hard)
+{
+  mrb->memory.soft_limit = soft;
+  mrb->memory.hard_limit = hard;
+  mrb->memory_hard_cap = hard;
+  mrb->memory_soft_next = soft;
+  memory_hard_next_set(mrb);
+  mrb->memory_gc_pending = FALSE;
+}
+
+void
+mrb_memory_stat(mrb_state *mrb, struct mrb_memory_stat *stat)
+{
+  *stat = mrb->memory;
+}
+
+/* the full GC asked for by a memory limit or a failed allocation */
+static void
+memory_collect(mrb_state *mrb)
+{
+  size_t next;
+
+  mrb->memory_gc_pending = FALSE;
+  mrb_full_gc(mrb);
+  gc_finish_sweep(mrb);
+#ifdef MRB_GC_BACKGROUND_FREE
+  gc_freer_drain(mrb);
+#endif
+  next = mrb->memory.bytes + mrb->memory.soft_limit / 4;
+  mrb->memory_soft_next = next > mrb->memory.soft_limit ? next : mrb->memory.soft_limit;
+  memory_hard_next_set(mrb);
 }
 
+#ifdef MRB_GC_SIDE_BITMAP
+#ifndef MRB_HEAP_PAGE_ALIGN
+#define MRB_HEAP_PAGE_ALIGN (1 << 16)
+#endif
+#ifndef MRB_HEAP_CHUNK_PAGES
+#define MRB_HEAP_CHUNK_PAGES 16
+#endif
+#ifndef MRB_HEAP_PAGE_SIZE
+/* as many slots (with their color bytes) as fill the alignment, less 128 bytes of header */
+#define MRB_HEAP_PAGE_SIZE \
+  ((MRB_HEAP_PAGE_ALIGN - 128) / (sizeof(RVALUE) + 1) & ~(((size_t)1 << (MRB_GC_SLOT_CLASSES - 1)) - 1))
+#endif
+#endif
 #ifndef MRB_HEAP_PAGE_SIZE
 #define MRB_HEAP_PAGE_SIZE 1024
 #endif
+#ifndef MRB_GC_HEAP_GROWTH_RATIO
+#define MRB_GC_HEAP_GROWTH_RATIO 0
+#endif
+#ifndef MRB_HEAP_GROWTH_MAX_PAGES
+#define MRB_HEAP_GROWTH_MAX_PAGES 1024
+#endif
+#if defined(MRB_GC_PARALLEL_MARK) && !defined(MRB_GC_MARK_THREADS)
+#define MRB_GC_MARK_THREADS 4
+#endif
 
 struct heap_page {
   struct RBasic *freelist;
+  size_t bump;                  /* slots below this have been handed out */
+  size_t width;                 /* RVALUEs per slot */
   struct heap_page *prev;
   struct heap_page *next;
   struct heap_page *free_next;
   struct heap_page *free_prev;
   mrb_bool old:1;
+  mrb_bool region:1;            /* allocated from by the open region */
+  mrb_bool fresh:1;             /* added by a growth step and not yet allocated from */
+  struct heap_page *region_next;
+  size_t payload;               /* payload bytes of the survivors of the last sweep */
+  struct heap_chunk *chunk;     /* block the page was carved from, or NULL */
+#ifdef MRB_GC_SIDE_BITMAP
+  uint8_t color[MRB_HEAP_PAGE_SIZE]; /* colors of objects, one byte per slot */
+#endif
   RVALUE objects[MRB_HEAP_PAGE_SIZE];
 };
 
+#ifdef MRB_GC_SIDE_BITMAP
+/*
+  With MRB_GC_SIDE_BITMAP the collector keeps object colors out of the
+  object headers: heap objects carry MRB_GC_SIDE_COLOR in their color
+  field and the real color lives in the color table of their page, which
+  is found by masking the object address with the page alignment. Gray
+  objects are queued on mark stacks instead of being chained through
+  gcnext. A mark therefore writes only to page tables and stacks, and the
+  pages of objects that merely survive stay shared after fork().
+*/
+typedef char mrb_heap_page_fits_align[sizeof(struct heap_page) <= MRB_HEAP_PAGE_ALIGN ? 1 : -1];
+
+#define MRB_GC_SIDE_COLOR MRB_GC_COLOR_MASK
+#define gc_page_of(o) \
+  ((struct heap_page*)((uintptr_t)(o) & ~(uintptr_t)(MRB_HEAP_PAGE_ALIGN - 1)))
+#define gc_side_color(o) (gc_page_of(o)->color[(RVALUE*)(o) - gc_page_of(o)->objects])
+
+/* objects outside the heap (pooled strings and floats) keep header colors */
+static inline uint32_t
+gc_color(struct RBasic *o)
+{
+  return o->color == MRB_GC_SIDE_COLOR ? gc_side_color(o) : o->color;
+}
+
+static inline void
+gc_set_color(struct RBasic *o, uint32_t color)
+{
+  if (o->color == MRB_GC_SIDE_COLOR) gc_side_color(o) = color;
+  else o->color = color;
+}
+
+#define paint_gray(o) gc_set_color((o), MRB_GC_GRAY)
+#define paint_black(o) gc_set_color((o), MRB_GC_BLACK)
+#define paint_white(o) gc_set_color((o), MRB_GC_WHITES)
+#define paint_partial_white(s, o) gc_set_color((o), (s)->current_white_part)
+#define is_gray(o) (gc_color(o) == MRB_GC_GRAY)
+#define is_white(o) (gc_color(o) & MRB_GC_WHITES)
+#define is_black(o) (gc_color(o) & MRB_GC_BLACK)
+#undef is_dead
+#define is_dead(s, o) ((o)->tt == MRB_TT_FREE || (gc_color(o) & other_white_part(s) & MRB_GC_WHITES))
+
+mrb_bool
+mrb_object_dead_p(mrb_state *mrb, struct RBasic *obj)
+{
+  return is_dead(mrb, obj);
+}
+#else
+#define gc_color(o) ((o)->color)
+#define gc_set_color(o, c) ((o)->color = (c))
+#endif
+
+static size_t
+gc_slot_class(size_t width)
+{
+  size_t c = 0;
+
+  while (((size_t)1 << c) < width) c++;
+  return c;
+}
+
 static void
 link_heap_page(mrb_state *mrb, struct heap_page *page)
 {
@@ -260,6 +799,8 @@ link_heap_page(mrb_state *mrb, struct heap_page *page)
   if (mrb->heaps)
     mrb->heaps->prev = page;
   mrb->heaps = page;
+  mrb->gc_stat.heap_pages++;
+  mrb->heap_class_pages[gc_slot_class(page->width)]++;
 }
 
 static void
@@ -273,16 +814,24 @@ unlink_heap_page(mrb_state *mrb, struct heap_page *page)
     mrb->heaps = page->next;
   page->prev = NULL;
   page->next = NULL;
+  mrb->gc_stat.heap_pages--;
+  mrb->heap_class_pages[gc_slot_class(page->width)]--;
+  mrb->gc_stat.payload_bytes -= page->payload;
+  page->payload = 0;
 }
 
+#define free_heaps_of(mrb, page) (&(mrb)->free_heaps[gc_slot_class((page)->width)])
+
 static void
 link_free_heap_page(mrb_state *mrb, struct heap_page *page)
 {
-  page->free_next = mrb->free_heaps;
-  if (mrb->free_heaps) {
-    mrb->free_heaps->free_prev = page;
+  struct heap_page **list = free_heaps_of(mrb, page);
+
+  page->free_next = *list;
+  if (*list) {
+    (*list)->free_prev = page;
   }
-  mrb->free_heaps = page;
+  *list = page;
 }
 
 static void
@@ -292,45 +841,246 @@ unlink_free_heap_page(mrb_state *mrb, struct heap_page *page)
     page->free_prev->free_next = page->free_next;
   if (page->free_next)
     page->free_next->free_prev = page->free_prev;
-  if (mrb->free_heaps == page)
-    mrb->free_heaps = page->free_next;
+  if (*free_heaps_of(mrb, page) == page)
+    *free_heaps_of(mrb, page) = page->free_next;
   page->free_prev = NULL;
   page->free_next = NULL;
 }
 
+/*
+  Heap chunks. When the heap grows by more than one page (see
+  gc_heap_growth_ratio and mrb_gc_reserve()), or with MRB_GC_HUGE_PAGES,
+  the pages are carved out of a single block obtained through allocf.
+  A freed page of a chunk waits on heap_idle for reuse; the block goes
+  back to allocf once all of its pages are idle. With MRB_GC_SIDE_BITMAP
+  every page comes from a chunk of at least MRB_HEAP_CHUNK_PAGES pages,
+  so the padding that aligns them is paid once per chunk rather than
+  once per page. With MRB_GC_HUGE_PAGES
+  chunks are 2MB aligned multiples of 2MB, so that a custom allocf can
+  hand out huge pages for them, and on Linux they are marked for
+  transparent huge pages.
+*/
+struct heap_chunk {
+  size_t pages;
+  size_t idle;                  /* pages on heap_idle */
+};
+
+#ifdef MRB_GC_SIDE_BITMAP
+#define GC_PAGE_STRIDE ((size_t)MRB_HEAP_PAGE_ALIGN)
+#else
+#define GC_PAGE_STRIDE ((sizeof(struct heap_page) + 15) & ~(size_t)15)
+#endif
+#ifdef MRB_GC_HUGE_PAGES
+#define GC_HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+#define GC_CHUNK_ALIGN GC_HUGE_PAGE_SIZE
+#elif defined(MRB_GC_SIDE_BITMAP)
+#define GC_CHUNK_ALIGN ((size_t)MRB_HEAP_PAGE_ALIGN)
+#else
+#define GC_CHUNK_ALIGN ((size_t)16)
+#endif
+
+/* heap pages are accounted apart from payloads */
+static void*
+heap_malloc(mrb_state *mrb, size_t len)
+{
+  void *p = mrb_malloc_kind(mrb, len, MRB_MEMORY_HEAP);
+
+  if (p == NULL) {
+    mrb_raise_nomemory(mrb);
+  }
+  return p;
+}
+
 static void
-add_heap(mrb_state *mrb)
+heap_idle_unlink(mrb_state *mrb, struct heap_page *page)
 {
-  struct heap_page *page = (struct heap_page *)mrb_calloc(mrb, 1, sizeof(struct heap_page));
-  RVALUE *p, *e;
-  struct RBasic *prev = NULL;
+  if (page->free_prev)
+    page->free_prev->free_next = page->free_next;
+  if (page->free_next)
+    page->free_next->free_prev = page->free_prev;
+  if (mrb->heap_idle == page)
+    mrb->heap_idle = page->free_next;
+  page->free_prev = NULL;
+  page->free_next = NULL;
+}
+
+/* carve n pages (more with huge pages) out of one block onto heap_idle */
+static void
+alloc_heap_chunk(mrb_state *mrb, size_t n)
+{
+  struct heap_chunk *chunk;
+  uintptr_t base;
+  size_t i;
 
-  for (p = page->objects, e=p+MRB_HEAP_PAGE_SIZE; p<e; p++) {
-    p->as.free.tt = MRB_TT_FREE;
-    p->as.free.next = prev;
-    prev = &p->as.basic;
+#ifdef MRB_GC_HUGE_PAGES
+  n = (n * GC_PAGE_STRIDE + GC_HUGE_PAGE_SIZE - 1) / GC_HUGE_PAGE_SIZE * GC_HUGE_PAGE_SIZE / GC_PAGE_STRIDE;
+#elif defined(MRB_GC_SIDE_BITMAP)
+  if (n < MRB_HEAP_CHUNK_PAGES) n = MRB_HEAP_CHUNK_PAGES;
+#endif
+  chunk = (struct heap_chunk *)heap_malloc(mrb, sizeof(struct heap_chunk) + n * GC_PAGE_STRIDE + GC_CHUNK_ALIGN - 1);
+  chunk->pages = chunk->idle = n;
+  base = ((uintptr_t)(chunk + 1) + GC_CHUNK_ALIGN - 1) & ~(uintptr_t)(GC_CHUNK_ALIGN - 1);
+#if defined(MRB_GC_HUGE_PAGES) && defined(MADV_HUGEPAGE)
+  madvise((void *)base, n * GC_PAGE_STRIDE, MADV_HUGEPAGE);
+#endif
+  for (i = n; i > 0; i--) {
+    struct heap_page *page = (struct heap_page *)(base + (i - 1) * GC_PAGE_STRIDE);
+
+    page->chunk = chunk;
+    page->free_prev = NULL;
+    page->free_next = mrb->heap_idle;
+    if (mrb->heap_idle)
+      mrb->heap_idle->free_prev = page;
+    mrb->heap_idle = page;
   }
-  page->freelist = prev;
+}
 
-  link_heap_page(mrb, page);
-  link_free_heap_page(mrb, page);
+static void
+free_heap_page(mrb_state *mrb, struct heap_page *page)
+{
+  struct heap_chunk *chunk = page->chunk;
+
+  if (chunk) {
+    page->free_prev = NULL;
+    page->free_next = mrb->heap_idle;
+    if (mrb->heap_idle)
+      mrb->heap_idle->free_prev = page;
+    mrb->heap_idle = page;
+    if (++chunk->idle == chunk->pages) {
+      struct heap_page *p = mrb->heap_idle, *next;
+
+      while (p) {
+        next = p->free_next;
+        if (p->chunk == chunk)
+          heap_idle_unlink(mrb, p);
+        p = next;
+      }
+      mrb_free(mrb, chunk);
+    }
+    return;
+  }
+  mrb_free(mrb, page);
+}
+
+static struct heap_page*
+alloc_heap_page(mrb_state *mrb)
+{
+  struct heap_page *page;
+
+#if defined(MRB_GC_HUGE_PAGES) || defined(MRB_GC_SIDE_BITMAP)
+  if (mrb->heap_idle == NULL) {
+    alloc_heap_chunk(mrb, 1);
+  }
+#endif
+  page = mrb->heap_idle;
+  if (page) {
+    heap_idle_unlink(mrb, page);
+    page->chunk->idle--;
+  }
+  else {
+    page = (struct heap_page *)heap_malloc(mrb, sizeof(struct heap_page));
+    page->chunk = NULL;
+  }
+
+  /* only the header is initialized; objects are written when handed out */
+  page->freelist = NULL;
+  page->bump = 0;
+  page->width = 1;
+  page->prev = page->next = NULL;
+  page->free_prev = page->free_next = NULL;
+  page->old = FALSE;
+  page->region = FALSE;
+  page->fresh = FALSE;
+  page->region_next = NULL;
+  page->payload = 0;
+  return page;
+}
+
+/* add n pages of slot class cls to the heap; pages beyond the idle ones come in one chunk */
+static void
+add_heap(mrb_state *mrb, size_t n, size_t cls)
+{
+  struct heap_page *page;
+  size_t idle = 0;
+
+  for (page = mrb->heap_idle; page && idle < n; page = page->free_next) {
+    idle++;
+  }
+  if (n - idle > 1) {
+    alloc_heap_chunk(mrb, n - idle);
+  }
+  while (n-- > 0) {
+    page = alloc_heap_page(mrb);
+    page->width = (size_t)1 << cls;
+    link_heap_page(mrb, page);
+    link_free_heap_page(mrb, page);
+  }
+}
+
+/* pages to add when the heap runs out of slots of class cls */
+static size_t
+heap_growth_pages(mrb_state *mrb, size_t cls)
+{
+  size_t n = mrb->heap_class_pages[cls] * mrb->gc_heap_growth_ratio / 100;
+
+  if (n < 1) return 1;
+  if (n > MRB_HEAP_GROWTH_MAX_PAGES) return MRB_HEAP_GROWTH_MAX_PAGES;
+  return n;
+}
+
+/*
+  Adds pages of class cls once its slots run out. After growing by more
+  than a page no cycle starts until the slots just added are used up,
+  so that a growing heap is not also collected each time it grows, and
+  sweeping keeps the new pages until they have been allocated from.
+*/
+static void
+heap_grow(mrb_state *mrb, size_t cls)
+{
+  size_t n = heap_growth_pages(mrb, cls);
+  size_t threshold = mrb->live + n * (MRB_HEAP_PAGE_SIZE >> cls);
+  struct heap_page *page;
+  size_t i;
+
+  add_heap(mrb, n, cls);
+  if (n == 1) return;
+  for (page = mrb->heaps, i = 0; i < n; page = page->next, i++) {
+    page->fresh = TRUE;
+  }
+  if (mrb->gc_threshold < threshold) {
+    mrb->gc_threshold = threshold;
+  }
 }
 
 #define DEFAULT_GC_INTERVAL_RATIO 200
 #define DEFAULT_GC_STEP_RATIO 200
 #define DEFAULT_MAJOR_GC_INC_RATIO 200
+#ifndef MRB_GC_MALLOC_LIMIT
+#define MRB_GC_MALLOC_LIMIT (16 * 1024 * 1024)
+#endif
 #define is_generational(mrb) ((mrb)->is_generational_gc_mode)
 #define is_major_gc(mrb) (is_generational(mrb) && (mrb)->gc_full)
 #define is_minor_gc(mrb) (is_generational(mrb) && !(mrb)->gc_full)
+#define malloc_pressure_p(mrb) ((mrb)->malloc_increase > (mrb)->malloc_limit)
+/* with lazy sweeping a collection hands the sweep over to the allocator */
+#define gc_cycle_stop(mrb) ((mrb)->gc_lazy_sweep ? GC_STATE_SWEEP : GC_STATE_NONE)
+#define oldmalloc_pressure_p(mrb) \
+  ((mrb)->oldmalloc_increase / DEFAULT_MAJOR_GC_INC_RATIO > (mrb)->malloc_limit / 100)
 
 void
 mrb_init_heap(mrb_state *mrb)
 {
   mrb->heaps = NULL;
-  mrb->free_heaps = NULL;
-  add_heap(mrb);
+  memset(mrb->free_heaps, 0, sizeof(mrb->free_heaps));
+  mrb->heap_idle = NULL;
+  add_heap(mrb, 1, 0);
   mrb->gc_interval_ratio = DEFAULT_GC_INTERVAL_RATIO;
+  mrb->gc_heap_growth_ratio = MRB_GC_HEAP_GROWTH_RATIO;
   mrb->gc_step_ratio = DEFAULT_GC_STEP_RATIO;
+  mrb->malloc_limit = MRB_GC_MALLOC_LIMIT;
+#ifdef MRB_GC_PARALLEL_MARK
+  mrb->gc_mark_threads = MRB_GC_MARK_THREADS;
+#endif
 #ifndef MRB_GC_TURN_OFF_GENERATIONAL
   mrb->is_generational_gc_mode = TRUE;
   mrb->gc_full = TRUE;
@@ -342,6 +1092,13 @@ mrb_init_heap(mrb_state *mrb)
 }
 
 static void obj_free(mrb_state *mrb, struct RBasic *obj);
+static void gc_lazy_sweep(mrb_state *mrb);
+#ifdef MRB_GC_PARALLEL_MARK
+static void gc_marker_free(mrb_state *mrb);
+#endif
+static void gc_compact_check(mrb_state *mrb);
+static struct RBasic *region_take_slot(mrb_state *mrb);
+static void region_remember(mrb_state *mrb, struct RBasic *obj);
 
 void
 mrb_free_heap(mrb_state *mrb)
@@ -350,15 +1107,32 @@ mrb_free_heap(mrb_state *mrb)
   struct heap_page *tmp;
   RVALUE *p, *e;
 
+#ifdef MRB_GC_BACKGROUND_FREE
+  gc_freer_free(mrb);
+#endif
   while (page) {
     tmp = page;
     page = page->next;
-    for (p = tmp->objects, e=p+MRB_HEAP_PAGE_SIZE; p<e; p++) {
+    for (p = tmp->objects, e=p+tmp->bump; p<e; p+=tmp->width) {
       if (p->as.free.tt != MRB_TT_FREE)
         obj_free(mrb, &p->as.basic);
     }
-    mrb_free(mrb, tmp);
+    free_heap_page(mrb, tmp);
+  }
+  while (mrb->region_idle) {
+    tmp = mrb->region_idle;
+    mrb->region_idle = tmp->region_next;
+    free_heap_page(mrb, tmp);
   }
+  (mrb->allocf)(mrb, mrb->region_remember, 0, mrb->ud);
+  gc_cards_free(mrb);
+#ifdef MRB_GC_PARALLEL_MARK
+  gc_marker_free(mrb);
+#endif
+#ifdef MRB_GC_SIDE_BITMAP
+  (mrb->allocf)(mrb, mrb->gray_stack.ptr, 0, mrb->ud);
+  (mrb->allocf)(mrb, mrb->atomic_gray_stack.ptr, 0, mrb->ud);
+#endif
 }
 
 static void
@@ -387,37 +1161,207 @@ mrb_gc_protect(mrb_state *mrb, mrb_value obj)
   gc_protect(mrb, mrb_basic_ptr(obj));
 }
 
-struct RBasic*
-mrb_obj_alloc(mrb_state *mrb, enum mrb_vtype ttype, struct RClass *cls)
+static struct RBasic*
+obj_alloc(mrb_state *mrb, enum mrb_vtype ttype, struct RClass *cls, size_t slot_class)
 {
   struct RBasic *p;
+  struct heap_page *page;
   static const RVALUE RVALUE_zero = { { { MRB_TT_FALSE } } };
 
 #ifdef MRB_GC_STRESS
   mrb_full_gc(mrb);
 #endif
-  if (mrb->gc_threshold < mrb->live) {
+  if (mrb->memory_gc_pending) {
+    memory_collect(mrb);
+  }
+  else if (mrb->gc_lazy_sweep && mrb->gc_state == GC_STATE_SWEEP) {
+    gc_lazy_sweep(mrb);
+  }
+  else if (mrb->gc_threshold < mrb->live || malloc_pressure_p(mrb)) {
     mrb_incremental_gc(mrb);
   }
-  if (mrb->free_heaps == NULL) {
-    add_heap(mrb);
+  if (mrb->region_depth > 0) {
+    p = region_take_slot(mrb);
   }
+  else {
+    if (mrb->free_heaps[slot_class] == NULL) {
+      heap_grow(mrb, slot_class);
+    }
 
-  p = mrb->free_heaps->freelist;
-  mrb->free_heaps->freelist = ((struct free_obj*)p)->next;
-  if (mrb->free_heaps->freelist == NULL) {
-    unlink_free_heap_page(mrb, mrb->free_heaps);
-  }
+    page = mrb->free_heaps[slot_class];
+    p = page->freelist;
+    if (p) {
+      page->freelist = ((struct free_obj*)p)->next;
+    }
+    else {
+      p = &page->objects[page->bump].as.basic;
+      page->bump += page->width;
+    }
+    if (page->freelist == NULL && page->bump == MRB_HEAP_PAGE_SIZE) {
+      unlink_free_heap_page(mrb, page);
+    }
+  }
 
   mrb->live++;
+  mrb->live_types[ttype]++;
   gc_protect(mrb, p);
   *(RVALUE *)p = RVALUE_zero;
   p->tt = ttype;
   p->c = cls;
+#ifdef MRB_GC_SIDE_BITMAP
+  p->color = MRB_GC_SIDE_COLOR;
+#endif
   paint_partial_white(mrb, p);
+  if (mrb->region_depth > 0) {
+    p->flags = MRB_FLAG_GC_REGION;
+  }
+  if (mrb->obj_event_interval > 0 && --mrb->obj_event_countdown == 0) {
+    mrb->obj_event_countdown = mrb->obj_event_interval;
+    p->flags |= MRB_FLAG_GC_TRACED;
+    mrb->obj_event_func(mrb, MRB_OBJ_EVENT_NEW, p, NULL, mrb->obj_event_ud);
+  }
   return p;
 }
 
+struct RBasic*
+mrb_obj_alloc(mrb_state *mrb, enum mrb_vtype ttype, struct RClass *cls)
+{
+  return obj_alloc(mrb, ttype, cls, 0);
+}
+
+/*
+ * Allocates an object in the narrowest slot of at least *size bytes and
+ * stores the size of the slot it got in *size. That is a plain RVALUE
+ * when no slot class is wide enough or a region is open; only the first
+ * RVALUE is cleared.
+ */
+struct RBasic*
+mrb_obj_alloc_size(mrb_state *mrb, enum mrb_vtype ttype, struct RClass *cls, size_t *size)
+{
+  size_t c = 0;
+
+  if (mrb->region_depth == 0) {
+    while (c < MRB_GC_SLOT_CLASSES && (sizeof(RVALUE) << c) < *size) c++;
+    if (c == MRB_GC_SLOT_CLASSES) c = 0;
+  }
+  *size = sizeof(RVALUE) << c;
+  return obj_alloc(mrb, ttype, cls, c);
+}
+
+/*
+ * A data object with a zeroed payload of size bytes; see MRB_DATA_INLINE.
+ * The payload goes in the slot only if that is a wide one, since those
+ * are never moved by compaction and C may hold on to DATA_PTR().
+ */
+struct RData*
+mrb_data_object_alloc_inline(mrb_state *mrb, struct RClass *klass, size_t size, const mrb_data_type *type)
+{
+  struct RData *d;
+  size_t slot = sizeof(struct RData) + size;
+
+  if (slot <= sizeof(RVALUE)) slot = sizeof(RVALUE) + 1;
+  d = (struct RData*)mrb_obj_alloc_size(mrb, MRB_TT_DATA, klass, &slot);
+  d->type = type;
+  d->flags |= MRB_DATA_INLINE;
+  if (slot > sizeof(RVALUE) && slot >= sizeof(struct RData) + size) {
+    d->data = MRB_DATA_INLINE_PTR(d);
+    memset(d->data, 0, size);
+  }
+  else {
+    d->data = mrb_calloc(mrb, 1, size > 0 ? size : 1);
+  }
+  return d;
+}
+
+#ifdef MRB_GC_SIDE_BITMAP
+static void
+gray_stack_push(mrb_state *mrb, struct mrb_gray_stack *st, struct RBasic *obj)
+{
+  if (st->len == st->capa) {
+    size_t capa = st->capa ? st->capa * 2 : 1024;
+    /* bypass mrb_realloc(); failing here must not start another GC */
+    struct RBasic **ptr = (struct RBasic**)(mrb->allocf)(mrb, st->ptr, sizeof(struct RBasic*) * capa, mrb->ud);
+
+    if (ptr == NULL) {
+      /* obj stays gray; gray_list_pending() finds it by scanning the heap */
+      mrb->gray_overflow = TRUE;
+      return;
+    }
+    st->ptr = ptr;
+    st->capa = capa;
+  }
+  st->ptr[st->len++] = obj;
+}
+
+static mrb_bool
+gray_list_pending(mrb_state *mrb)
+{
+  struct heap_page *page;
+  RVALUE *p, *e;
+
+  if (mrb->gray_stack.len > 0) return TRUE;
+  if (!mrb->gray_overflow) return FALSE;
+  mrb->gray_overflow = FALSE;
+  for (page = mrb->heaps; page; page = page->next) {
+    for (p = page->objects, e = p + page->bump; p < e; p += page->width) {
+      if (p->as.basic.tt != MRB_TT_FREE && is_gray(&p->as.basic)) {
+        gray_stack_push(mrb, &mrb->gray_stack, &p->as.basic);
+      }
+    }
+  }
+  return mrb->gray_stack.len > 0;
+}
+
+#define gray_list_push(mrb, obj) gray_stack_push(mrb, &(mrb)->gray_stack, obj)
+#define atomic_gray_list_push(mrb, obj) gray_stack_push(mrb, &(mrb)->atomic_gray_stack, obj)
+#define gray_list_top(mrb) ((mrb)->gray_stack.ptr[(mrb)->gray_stack.len - 1])
+#define gray_list_pop(mrb) ((mrb)->gray_stack.len--)
+#define gray_list_clear(mrb) \
+  ((mrb)->gray_stack.len = (mrb)->atomic_gray_stack.len = 0, (mrb)->gray_overflow = FALSE)
+
+static void
+gray_list_take_atomic(mrb_state *mrb)
+{
+  struct mrb_gray_stack tmp = mrb->gray_stack;
+
+  mrb->gray_stack = mrb->atomic_gray_stack;
+  mrb->atomic_gray_stack = tmp;
+  mrb->atomic_gray_stack.len = 0;
+}
+#else
+#define gray_list_push(mrb, obj) ((obj)->gcnext = (mrb)->gray_list, (mrb)->gray_list = (obj))
+#define atomic_gray_list_push(mrb, obj) \
+  ((obj)->gcnext = (mrb)->atomic_gray_list, (mrb)->atomic_gray_list = (obj))
+#define gray_list_pending(mrb) ((mrb)->gray_list != NULL)
+#define gray_list_top(mrb) ((mrb)->gray_list)
+#define gray_list_pop(mrb) ((mrb)->gray_list = (mrb)->gray_list->gcnext)
+#define gray_list_clear(mrb) ((mrb)->gray_list = (mrb)->atomic_gray_list = NULL)
+#define gray_list_take_atomic(mrb) \
+  ((mrb)->gray_list = (mrb)->atomic_gray_list, (mrb)->atomic_gray_list = NULL)
+#endif
+
+#ifdef MRB_GC_PARALLEL_MARK
+struct gc_mark_worker;
+static __thread struct gc_mark_worker *gc_current_worker;
+static void gc_paint_black_atomic(struct RBasic *obj);
+
+/* other markers may be claiming obj; read its type without tearing the header word */
+static inline mrb_bool
+gc_free_p(struct RBasic *obj)
+{
+  if (gc_current_worker) {
+    struct RBasic b;
+    uint32_t w = __atomic_load_n((uint32_t*)obj, __ATOMIC_RELAXED);
+
+    memcpy(&b, &w, sizeof(w));
+    return b.tt == MRB_TT_FREE;
+  }
+  return obj->tt == MRB_TT_FREE;
+}
+#else
+#define gc_free_p(obj) ((obj)->tt == MRB_TT_FREE)
+#endif
+
 static inline void
 add_gray_list(mrb_state *mrb, struct RBasic *obj)
 {
@@ -427,8 +1371,7 @@ add_gray_list(mrb_state *mrb, struct RBasic *obj)
   }
 #endif
   paint_gray(obj);
-  obj->gcnext = mrb->gray_list;
-  mrb->gray_list = obj;
+  gray_list_push(mrb, obj);
 }
 
 static void
@@ -443,8 +1386,8 @@ mark_context_stack(mrb_state *mrb, struct mrb_context *c)
   for (i=0; i<e; i++) {
     mrb_value v = c->stbase[i];
 
-    if (!mrb_immediate_p(v)) {
-      if (mrb_basic_ptr(v)->tt == MRB_TT_FREE) {
+    if (mrb_basic_p(v)) {
+      if (gc_free_p(mrb_basic_ptr(v))) {
         c->stbase[i] = mrb_nil_value();
       }
       else {
@@ -488,8 +1431,11 @@ static void
 gc_mark_children(mrb_state *mrb, struct RBasic *obj)
 {
   mrb_assert(is_gray(obj));
+#ifdef MRB_GC_PARALLEL_MARK
+  if (gc_current_worker) gc_paint_black_atomic(obj);
+  else
+#endif
   paint_black(obj);
-  mrb->gray_list = obj->gcnext;
   mrb_gc_mark(mrb, (struct RBasic*)obj->c);
   switch (obj->tt) {
   case MRB_TT_ICLASS:
@@ -579,10 +1525,435 @@ gc_mark_children(mrb_state *mrb, struct RBasic *obj)
   }
 }
 
+/* pass the children of obj to mrb->gc_visit without changing its color */
+static void
+gc_visit_children(mrb_state *mrb, struct RBasic *obj)
+{
+  uint32_t color = gc_color(obj);
+
+  paint_gray(obj);
+  gc_mark_children(mrb, obj);
+  gc_set_color(obj, color);
+}
+
+static void
+gc_mark_gray_list_serial(mrb_state *mrb)
+{
+  while (gray_list_pending(mrb)) {
+    struct RBasic *obj = gray_list_top(mrb);
+
+    gray_list_pop(mrb);
+    if (is_gray(obj))
+      gc_mark_children(mrb, obj);
+  }
+}
+
+#ifdef MRB_GC_PARALLEL_MARK
+/*
+  == Parallel Marking
+
+  mrb_full_gc() stops the mutator for the whole cycle, so its marking
+  can be shared with helper threads. Each marker keeps a private stack
+  of gray objects and, while it has plenty of work, publishes a chunk of
+  it into a small stash that idle markers steal from. An object is
+  claimed by atomically turning its color from white to gray, so every
+  object is traversed by exactly one marker. The caller marks as well
+  and returns only after all helpers ran out of work, which is the
+  barrier before sweeping starts.
+
+  Incremental steps and minor GCs keep marking on the calling thread.
+*/
+#define GC_MARK_THREADS_MAX 64
+#define GC_MARK_STASH_SIZE 256
+/* smaller heaps are not worth waking the helpers for */
+#define GC_PARALLEL_MIN_LIVE (MRB_HEAP_PAGE_SIZE * 16)
+
+struct gc_mark_worker {
+  struct mrb_gc_marker *marker;
+  struct RBasic **stack;        /* private gray stack */
+  size_t len;
+  size_t capa;
+  pthread_mutex_t lock;         /* guards stash */
+  struct RBasic *stash[GC_MARK_STASH_SIZE];
+  size_t stash_len;
+  size_t marked;
+  unsigned long generation;
+  pthread_t thread;
+};
+
+struct mrb_gc_marker {
+  mrb_state *mrb;
+  int nworkers;
+  struct gc_mark_worker *workers; /* workers[0] is the thread calling mrb_full_gc() */
+  pthread_mutex_t lock;         /* guards the fields below and allocf */
+  pthread_cond_t start;
+  pthread_cond_t done;
+  unsigned long generation;
+  int running;                  /* helpers still working on this generation */
+  int active;                   /* markers holding work; updated atomically */
+  mrb_bool overflow;            /* a push was dropped; updated atomically */
+  mrb_bool shutdown;
+};
+
+#define gc_atomic_load(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define gc_atomic_store(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/* header word with only the color field set to `color` */
+static inline uint32_t
+gc_color_word(uint32_t color)
+{
+  struct RBasic b;
+  uint32_t w;
+
+  memset(&b, 0, sizeof(b));
+  b.color = color;
+  memcpy(&w, &b, sizeof(w));
+  return w;
+}
+
+/* atomically turn a white object gray; TRUE if this thread did it */
+static mrb_bool
+gc_try_gray(struct RBasic *obj)
+{
+  uint32_t *w, old, mask = gc_color_word(MRB_GC_COLOR_MASK);
+
+#ifdef MRB_GC_SIDE_BITMAP
+  if (obj->color == MRB_GC_SIDE_COLOR) {
+    uint8_t *c = &gc_side_color(obj);
+    uint8_t oc = __atomic_load_n(c, __ATOMIC_RELAXED);
+
+    do {
+      if (!(oc & MRB_GC_WHITES)) return FALSE;
+    } while (!__atomic_compare_exchange_n(c, &oc, MRB_GC_GRAY, TRUE, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+    return TRUE;
+  }
+#endif
+  /* tt, color and flags share the first word of the header */
+  w = (uint32_t*)obj;
+  old = __atomic_load_n(w, __ATOMIC_RELAXED);
+  do {
+    if (!(old & gc_color_word(MRB_GC_WHITES))) return FALSE;
+  } while (!__atomic_compare_exchange_n(w, &old, (old & ~mask) | gc_color_word(MRB_GC_GRAY),
+                                        TRUE, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+  return TRUE;
+}
+
+/* gray is all zero bits, so blackening a claimed object only sets bits */
+static void
+gc_paint_black_atomic(struct RBasic *obj)
+{
+#ifdef MRB_GC_SIDE_BITMAP
+  if (obj->color == MRB_GC_SIDE_COLOR) {
+    __atomic_store_n(&gc_side_color(obj), MRB_GC_BLACK, __ATOMIC_RELAXED);
+    return;
+  }
+#endif
+  __atomic_fetch_or((uint32_t*)obj, gc_color_word(MRB_GC_BLACK), __ATOMIC_RELAXED);
+}
+
+static void
+gc_worker_publish(struct gc_mark_worker *w)
+{
+  size_t n = w->len / 2;
+
+  if (n > GC_MARK_STASH_SIZE) n = GC_MARK_STASH_SIZE;
+  pthread_mutex_lock(&w->lock);
+  if (w->stash_len == 0) {
+    w->len -= n;
+    memcpy(w->stash, w->stack + w->len, sizeof(struct RBasic*) * n);
+    gc_atomic_store(&w->stash_len, n);
+  }
+  pthread_mutex_unlock(&w->lock);
+}
+
+/* make room for n more entries on the private stack */
+static mrb_bool
+gc_worker_reserve(struct gc_mark_worker *w, size_t n)
+{
+  struct mrb_gc_marker *m = w->marker;
+  mrb_state *mrb = m->mrb;
+  size_t capa = w->capa ? w->capa * 2 : 1024;
+  struct RBasic **stack;
+
+  if (w->capa - w->len >= n) return TRUE;
+  if (capa < w->len + n) capa = w->len + n;
+  pthread_mutex_lock(&m->lock);
+  stack = (struct RBasic**)(mrb->allocf)(mrb, w->stack, sizeof(struct RBasic*) * capa, mrb->ud);
+  pthread_mutex_unlock(&m->lock);
+  if (stack == NULL) {
+    /* the objects stay gray; gc_parallel_mark() picks them up from the heap */
+    gc_atomic_store(&m->overflow, TRUE);
+    return FALSE;
+  }
+  w->stack = stack;
+  w->capa = capa;
+  return TRUE;
+}
+
+static void
+gc_worker_push(struct gc_mark_worker *w, struct RBasic *obj)
+{
+  if (!gc_worker_reserve(w, 1)) return;
+  w->stack[w->len++] = obj;
+  if (w->len > GC_MARK_STASH_SIZE && gc_atomic_load(&w->stash_len) == 0) {
+    gc_worker_publish(w);
+  }
+}
+
+static mrb_bool
+gc_worker_take(struct gc_mark_worker *w, struct gc_mark_worker *victim)
+{
+  size_t n = 0;
+
+  if (gc_atomic_load(&victim->stash_len) == 0) return FALSE;
+  pthread_mutex_lock(&victim->lock);
+  if (victim->stash_len > 0) {
+    n = victim->stash_len;
+    memcpy(w->stack + w->len, victim->stash, sizeof(struct RBasic*) * n);
+    w->len += n;
+    gc_atomic_store(&victim->stash_len, 0);
+  }
+  pthread_mutex_unlock(&victim->lock);
+  return n > 0;
+}
+
+static mrb_bool
+gc_worker_steal(struct gc_mark_worker *w)
+{
+  struct mrb_gc_marker *m = w->marker;
+  int i, self = (int)(w - m->workers);
+
+  if (!gc_worker_reserve(w, GC_MARK_STASH_SIZE)) return FALSE;
+  for (i = 1; i <= m->nworkers; i++) {
+    if (gc_worker_take(w, &m->workers[(self + i) % m->nworkers])) return TRUE;
+  }
+  return FALSE;
+}
+
+static mrb_bool
+gc_marker_has_stash(struct mrb_gc_marker *m)
+{
+  int i;
+
+  for (i = 0; i < m->nworkers; i++) {
+    if (gc_atomic_load(&m->workers[i].stash_len) > 0) return TRUE;
+  }
+  return FALSE;
+}
+
+static void
+gc_worker_run(mrb_state *mrb, struct gc_mark_worker *w)
+{
+  struct mrb_gc_marker *m = w->marker;
+
+  gc_current_worker = w;
+  for (;;) {
+    while (w->len > 0) {
+      struct RBasic *obj = w->stack[--w->len];
+
+      gc_mark_children(mrb, obj);
+      w->marked++;
+    }
+    if (gc_worker_steal(w)) continue;
+
+    /* out of work: finish once every marker is idle and no stash is left */
+    __atomic_sub_fetch(&m->active, 1, __ATOMIC_ACQ_REL);
+    for (;;) {
+      if (gc_marker_has_stash(m)) {
+        __atomic_add_fetch(&m->active, 1, __ATOMIC_ACQ_REL);
+        if (gc_worker_steal(w)) break;
+        __atomic_sub_fetch(&m->active, 1, __ATOMIC_ACQ_REL);
+      }
+      if (gc_atomic_load(&m->active) == 0) {
+        gc_current_worker = NULL;
+        return;
+      }
+      sched_yield();
+    }
+  }
+}
+
+static void*
+gc_mark_helper(void *arg)
+{
+  struct gc_mark_worker *w = (struct gc_mark_worker*)arg;
+  struct mrb_gc_marker *m = w->marker;
+
+  pthread_mutex_lock(&m->lock);
+  for (;;) {
+    while (!m->shutdown && w->generation == m->generation) {
+      pthread_cond_wait(&m->start, &m->lock);
+    }
+    if (m->shutdown) break;
+    w->generation = m->generation;
+    pthread_mutex_unlock(&m->lock);
+    gc_worker_run(m->mrb, w);
+    pthread_mutex_lock(&m->lock);
+    if (--m->running == 0) {
+      pthread_cond_signal(&m->done);
+    }
+  }
+  pthread_mutex_unlock(&m->lock);
+  return NULL;
+}
+
+static void
+gc_marker_free(mrb_state *mrb)
+{
+  struct mrb_gc_marker *m = mrb->gc_marker;
+  int i;
+
+  if (!m) return;
+  pthread_mutex_lock(&m->lock);
+  m->shutdown = TRUE;
+  pthread_cond_broadcast(&m->start);
+  pthread_mutex_unlock(&m->lock);
+  for (i = 1; i < m->nworkers; i++) {
+    pthread_join(m->workers[i].thread, NULL);
+  }
+  for (i = 0; i < m->nworkers; i++) {
+    pthread_mutex_destroy(&m->workers[i].lock);
+    (mrb->allocf)(mrb, m->workers[i].stack, 0, mrb->ud);
+  }
+  pthread_cond_destroy(&m->done);
+  pthread_cond_destroy(&m->start);
+  pthread_mutex_destroy(&m->lock);
+  mrb_free(mrb, m->workers);
+  mrb_free(mrb, m);
+  mrb->gc_marker = NULL;
+}
+
+static struct mrb_gc_marker*
+gc_marker_get(mrb_state *mrb)
+{
+  struct mrb_gc_marker *m = mrb->gc_marker;
+  int i, n = mrb->gc_mark_threads;
+
+  if (m && m->nworkers == n) return m;
+  gc_marker_free(mrb);
+
+  m = (struct mrb_gc_marker*)mrb_calloc(mrb, 1, sizeof(struct mrb_gc_marker));
+  m->mrb = mrb;
+  m->workers = (struct gc_mark_worker*)mrb_calloc(mrb, n, sizeof(struct gc_mark_worker));
+  pthread_mutex_init(&m->lock, NULL);
+  pthread_cond_init(&m->start, NULL);
+  pthread_cond_init(&m->done, NULL);
+  for (i = 0; i < n; i++) {
+    m->workers[i].marker = m;
+    pthread_mutex_init(&m->workers[i].lock, NULL);
+  }
+  m->nworkers = 1;
+  mrb->gc_marker = m;
+  for (i = 1; i < n; i++) {
+    if (pthread_create(&m->workers[i].thread, NULL, gc_mark_helper, &m->workers[i]) != 0) {
+      break;
+    }
+    m->nworkers++;
+  }
+  if (m->nworkers < n) {
+    /* keep what we got; record it so that we don't retry every GC */
+    mrb->gc_mark_threads = m->nworkers;
+  }
+  return m;
+}
+
+#define gc_parallel_p(mrb) \
+  ((mrb)->gc_parallel && (mrb)->gc_mark_threads > 1 && (mrb)->live >= GC_PARALLEL_MIN_LIVE)
+
+/* drain the gray list with all markers; returns the number of objects traversed */
+static size_t
+gc_parallel_mark(mrb_state *mrb)
+{
+  struct mrb_gc_marker *m = gc_marker_get(mrb);
+  size_t marked = 0, round;
+  int i;
+
+  while (gray_list_pending(mrb)) {
+    /* deal the gray objects out to the markers */
+    for (i = 0; gray_list_pending(mrb); i = (i + 1) % m->nworkers) {
+      struct RBasic *obj = gray_list_top(mrb);
+
+      gray_list_pop(mrb);
+      if (is_gray(obj)) gc_worker_push(&m->workers[i], obj);
+    }
+
+    pthread_mutex_lock(&m->lock);
+    m->active = m->nworkers;
+    m->running = m->nworkers - 1;
+    m->generation++;
+    pthread_cond_broadcast(&m->start);
+    pthread_mutex_unlock(&m->lock);
+
+    gc_worker_run(mrb, &m->workers[0]);
+
+    pthread_mutex_lock(&m->lock);
+    while (m->running > 0) {
+      pthread_cond_wait(&m->done, &m->lock);
+    }
+    pthread_mutex_unlock(&m->lock);
+
+    for (round = 0, i = 0; i < m->nworkers; i++) {
+      round += m->workers[i].marked;
+      m->workers[i].marked = 0;
+    }
+    marked += round;
+    if (m->overflow) {
+      /* some pushes were dropped; requeue what is still gray */
+      struct heap_page *page;
+      RVALUE *p, *e;
+
+      m->overflow = FALSE;
+      for (i = 0; i < m->nworkers; i++) {
+        m->workers[i].stash_len = 0;
+      }
+      for (page = mrb->heaps; page; page = page->next) {
+        for (p = page->objects, e = p + page->bump; p < e; p += page->width) {
+          if (p->as.basic.tt != MRB_TT_FREE && is_gray(&p->as.basic)) {
+            gray_list_push(mrb, &p->as.basic);
+          }
+        }
+      }
+      if (round == 0) {
+        /* the markers cannot get memory; finish without them */
+        gc_mark_gray_list_serial(mrb);
+      }
+    }
+  }
+  return marked;
+}
+
+int
+mrb_gc_mark_threads(mrb_state *mrb)
+{
+  return mrb->gc_mark_threads;
+}
+
+void
+mrb_gc_set_mark_threads(mrb_state *mrb, int n)
+{
+  if (n < 1) n = 1;
+  if (n > GC_MARK_THREADS_MAX) n = GC_MARK_THREADS_MAX;
+  mrb->gc_mark_threads = n;
+}
+#endif
+
 void
 mrb_gc_mark(mrb_state *mrb, struct RBasic *obj)
 {
   if (obj == 0) return;
+  if (mrb->gc_visit) {
+    mrb->gc_visit(mrb, obj, mrb->gc_visit_ud);
+    return;
+  }
+#ifdef MRB_GC_PARALLEL_MARK
+  if (gc_current_worker) {
+    if (gc_try_gray(obj)) {
+      mrb_assert((obj)->tt != MRB_TT_FREE);
+      gc_worker_push(gc_current_worker, obj);
+    }
+    return;
+  }
+#endif
   if (!is_white(obj)) return;
   mrb_assert((obj)->tt != MRB_TT_FREE);
   add_gray_list(mrb, obj);
@@ -592,6 +1963,10 @@ static void
 obj_free(mrb_state *mrb, struct RBasic *obj)
 {
   DEBUG(printf("obj_free(%p,tt=%d)\n",obj,obj->tt));
+  mrb->live_types[obj->tt]--;
+  if ((obj->flags & MRB_FLAG_GC_TRACED) && mrb->obj_event_func) {
+    mrb->obj_event_func(mrb, MRB_OBJ_EVENT_FREE, obj, NULL, mrb->obj_event_ud);
+  }
   switch (obj->tt) {
     /* immediate - no mark */
   case MRB_TT_TRUE:
@@ -614,6 +1989,7 @@ obj_free(mrb_state *mrb, struct RBasic *obj)
   case MRB_TT_CLASS:
   case MRB_TT_MODULE:
   case MRB_TT_SCLASS:
+    mrb_clear_init_cache(mrb);
     mrb_gc_free_mt(mrb, (struct RClass*)obj);
     mrb_gc_free_iv(mrb, (struct RObject*)obj);
     break;
@@ -641,7 +2017,7 @@ obj_free(mrb_state *mrb, struct RBasic *obj)
   case MRB_TT_ARRAY:
     if (obj->flags & MRB_ARY_SHARED)
       mrb_ary_decref(mrb, ((struct RArray*)obj)->aux.shared);
-    else
+    else if (!MRB_ARY_EMBED_P((struct RArray*)obj))
       mrb_free(mrb, ((struct RArray*)obj)->ptr);
     break;
 
@@ -671,7 +2047,12 @@ obj_free(mrb_state *mrb, struct RBasic *obj)
   case MRB_TT_DATA:
     {
       struct RData *d = (struct RData*)obj;
-      if (d->type && d->type->dfree) {
+      if (MRB_DATA_INLINE_P(d)) {
+        if (d->data != MRB_DATA_INLINE_PTR(d)) {
+          mrb_free(mrb, d->data);
+        }
+      }
+      else if (d->type && d->type->dfree) {
         d->type->dfree(mrb, d->data);
       }
       mrb_gc_free_iv(mrb, (struct RObject*)obj);
@@ -684,67 +2065,170 @@ obj_free(mrb_state *mrb, struct RBasic *obj)
   obj->tt = MRB_TT_FREE;
 }
 
-static void
-root_scan_phase(mrb_state *mrb)
-{
-  size_t i, e;
-
-  if (!is_minor_gc(mrb)) {
-    mrb->gray_list = NULL;
-    mrb->atomic_gray_list = NULL;
-  }
-
-  mrb_gc_mark_gv(mrb);
-  /* mark arena */
-  for (i=0,e=mrb->arena_idx; i<e; i++) {
-    mrb_gc_mark(mrb, mrb->arena[i]);
-  }
-  /* mark class hierarchy */
-  mrb_gc_mark(mrb, (struct RBasic*)mrb->object_class);
-  /* mark top_self */
-  mrb_gc_mark(mrb, (struct RBasic*)mrb->top_self);
-  /* mark exception */
-  mrb_gc_mark(mrb, (struct RBasic*)mrb->exc);
-
-  mark_context(mrb, mrb->root_c);
-  if (mrb->root_c->fib) {
-    mrb_gc_mark(mrb, (struct RBasic*)mrb->root_c->fib);
-  }
-  if (mrb->root_c != mrb->c) {
-    mark_context(mrb, mrb->c);
-  }
-}
-
+/* bytes obj owns outside its slot */
 static size_t
-gc_gray_mark(mrb_state *mrb, struct RBasic *obj)
+gc_payload_size(mrb_state *mrb, struct RBasic *obj)
 {
-  size_t children = 0;
-
-  gc_mark_children(mrb, obj);
+  size_t size = 0;
 
   switch (obj->tt) {
-  case MRB_TT_ICLASS:
-    children++;
+  case MRB_TT_OBJECT:
+  case MRB_TT_EXCEPTION:
+    size += mrb_gc_iv_memsize(mrb, (struct RObject*)obj);
     break;
 
   case MRB_TT_CLASS:
-  case MRB_TT_SCLASS:
   case MRB_TT_MODULE:
+  case MRB_TT_SCLASS:
+    size += mrb_gc_iv_memsize(mrb, (struct RObject*)obj);
+    size += mrb_gc_mt_memsize(mrb, (struct RClass*)obj);
+    break;
+
+  case MRB_TT_ENV:
     {
-      struct RClass *c = (struct RClass*)obj;
+      struct REnv *e = (struct REnv*)obj;
 
-      children += mrb_gc_mark_iv_size(mrb, (struct RObject*)obj);
-      children += mrb_gc_mark_mt_size(mrb, c);
-      children++;
+      if (!MRB_ENV_STACK_SHARED_P(e) && e->stack) {
+        size += sizeof(mrb_value) * MRB_ENV_STACK_LEN(e);
+      }
     }
     break;
 
-  case MRB_TT_OBJECT:
-  case MRB_TT_DATA:
-    children += mrb_gc_mark_iv_size(mrb, (struct RObject*)obj);
-    break;
+  case MRB_TT_FIBER:
+    {
+      struct mrb_context *c = ((struct RFiber*)obj)->cxt;
 
-  case MRB_TT_ENV:
+      if (c && c != mrb->root_c) {
+        size += sizeof(struct mrb_context);
+        size += sizeof(mrb_value) * (c->stend - c->stbase);
+        size += sizeof(mrb_callinfo) * (c->ciend - c->cibase);
+        size += sizeof(mrb_code*) * c->rsize;
+        size += sizeof(struct RProc*) * c->esize;
+      }
+    }
+    break;
+
+  case MRB_TT_ARRAY:
+    /* embedded elements: the slot beyond the first RVALUE */
+    if (!(obj->flags & MRB_ARY_SHARED)) {
+      size += sizeof(mrb_value) * ((struct RArray*)obj)->aux.capa;
+    }
+    break;
+
+  case MRB_TT_HASH:
+    size += mrb_gc_iv_memsize(mrb, (struct RObject*)obj);
+    size += mrb_gc_hash_memsize(mrb, (struct RHash*)obj);
+    break;
+
+  case MRB_TT_STRING:
+    /* shared and static buffers are not owned by the string */
+    if (!(obj->flags & (MRB_STR_SHARED | MRB_STR_NOFREE | MRB_STR_EMBED))) {
+      size += ((struct RString*)obj)->as.heap.aux.capa + 1;
+    }
+    break;
+
+  case MRB_TT_RANGE:
+    if (((struct RRange*)obj)->edges) {
+      size += sizeof(mrb_range_edges);
+    }
+    break;
+
+  case MRB_TT_DATA:
+    {
+      struct RData *d = (struct RData*)obj;
+
+      size += mrb_gc_iv_memsize(mrb, (struct RObject*)obj);
+      if (d->type && d->type->dsize && d->data) {
+        size += d->type->dsize(mrb, d->data);
+      }
+    }
+    break;
+
+  default:
+    break;
+  }
+  return size;
+}
+
+size_t
+mrb_objspace_memsize_of(mrb_state *mrb, mrb_value obj)
+{
+  if (!mrb_basic_p(obj)) return 0;
+  return sizeof(RVALUE) + gc_payload_size(mrb, mrb_basic_ptr(obj));
+}
+
+/* the slots of the live objects and their payload as of the last sweep */
+size_t
+mrb_objspace_memsize_of_all(mrb_state *mrb)
+{
+  return sizeof(RVALUE) * mrb->live + mrb->gc_stat.payload_bytes;
+}
+
+static void gc_mark_cards(mrb_state *mrb);
+
+static void
+root_scan_phase(mrb_state *mrb)
+{
+  size_t i, e;
+
+  if (!is_minor_gc(mrb)) {
+    gray_list_clear(mrb);
+  }
+  gc_mark_cards(mrb);
+
+  mrb_gc_mark_gv(mrb);
+  mrb_gc_mark_symtbl(mrb);
+  /* mark arena */
+  for (i=0,e=mrb->arena_idx; i<e; i++) {
+    mrb_gc_mark(mrb, mrb->arena[i]);
+  }
+  /* mark class hierarchy */
+  mrb_gc_mark(mrb, (struct RBasic*)mrb->object_class);
+  /* mark top_self */
+  mrb_gc_mark(mrb, (struct RBasic*)mrb->top_self);
+  /* mark exception */
+  mrb_gc_mark(mrb, (struct RBasic*)mrb->exc);
+  mrb_gc_mark(mrb, (struct RBasic*)mrb->nomem_err);
+
+  mark_context(mrb, mrb->root_c);
+  if (mrb->root_c->fib) {
+    mrb_gc_mark(mrb, (struct RBasic*)mrb->root_c->fib);
+  }
+  if (mrb->root_c != mrb->c) {
+    mark_context(mrb, mrb->c);
+  }
+}
+
+static size_t
+gc_gray_mark(mrb_state *mrb, struct RBasic *obj)
+{
+  size_t children = 0;
+
+  gc_mark_children(mrb, obj);
+
+  switch (obj->tt) {
+  case MRB_TT_ICLASS:
+    children++;
+    break;
+
+  case MRB_TT_CLASS:
+  case MRB_TT_SCLASS:
+  case MRB_TT_MODULE:
+    {
+      struct RClass *c = (struct RClass*)obj;
+
+      children += mrb_gc_mark_iv_size(mrb, (struct RObject*)obj);
+      children += mrb_gc_mark_mt_size(mrb, c);
+      children++;
+    }
+    break;
+
+  case MRB_TT_OBJECT:
+  case MRB_TT_DATA:
+    children += mrb_gc_mark_iv_size(mrb, (struct RObject*)obj);
+    break;
+
+  case MRB_TT_ENV:
     children += (int)obj->flags;
     break;
 
@@ -799,12 +2283,13 @@ gc_gray_mark(mrb_state *mrb, struct RBasic *obj)
 
 static void
 gc_mark_gray_list(mrb_state *mrb) {
-  while (mrb->gray_list) {
-    if (is_gray(mrb->gray_list))
-      gc_mark_children(mrb, mrb->gray_list);
-    else
-      mrb->gray_list = mrb->gray_list->gcnext;
+#ifdef MRB_GC_PARALLEL_MARK
+  if (gc_parallel_p(mrb)) {
+    gc_parallel_mark(mrb);
+    return;
   }
+#endif
+  gc_mark_gray_list_serial(mrb);
 }
 
 
@@ -813,8 +2298,15 @@ incremental_marking_phase(mrb_state *mrb, size_t limit)
 {
   size_t tried_marks = 0;
 
-  while (mrb->gray_list && tried_marks < limit) {
-    tried_marks += gc_gray_mark(mrb, mrb->gray_list);
+#ifdef MRB_GC_PARALLEL_MARK
+  if (gc_parallel_p(mrb)) return gc_parallel_mark(mrb);
+#endif
+  while (gray_list_pending(mrb) && tried_marks < limit) {
+    struct RBasic *obj = gray_list_top(mrb);
+
+    gray_list_pop(mrb);
+    if (is_gray(obj))
+      tried_marks += gc_gray_mark(mrb, obj);
   }
 
   return tried_marks;
@@ -825,16 +2317,67 @@ final_marking_phase(mrb_state *mrb)
 {
   mark_context_stack(mrb, mrb->root_c);
   gc_mark_gray_list(mrb);
-  mrb_assert(mrb->gray_list == NULL);
-  mrb->gray_list = mrb->atomic_gray_list;
-  mrb->atomic_gray_list = NULL;
+  mrb_assert(!gray_list_pending(mrb));
+  gray_list_take_atomic(mrb);
   gc_mark_gray_list(mrb);
-  mrb_assert(mrb->gray_list == NULL);
+  mrb_assert(!gray_list_pending(mrb));
+}
+
+void
+mrb_gc_weak_register(mrb_state *mrb, struct mrb_gc_weak *weak, mrb_gc_weak_func *update)
+{
+  weak->update = update;
+  weak->prev = NULL;
+  weak->next = mrb->gc_weak;
+  if (mrb->gc_weak) mrb->gc_weak->prev = weak;
+  mrb->gc_weak = weak;
+}
+
+void
+mrb_gc_weak_unregister(mrb_state *mrb, struct mrb_gc_weak *weak)
+{
+  if (weak->prev) weak->prev->next = weak->next;
+  else if (mrb->gc_weak == weak) mrb->gc_weak = weak->next;
+  if (weak->next) weak->next->prev = weak->prev;
+  weak->prev = weak->next = NULL;
+}
+
+/* where a weak reference points after marking or compaction; undef if its referent died */
+mrb_value
+mrb_gc_weak_update(mrb_state *mrb, mrb_value obj)
+{
+  if (!mrb_basic_p(obj)) return obj;
+  if (mrb->gc_compacting) return mrb_gc_location(mrb, obj);
+  if (is_dead(mrb, mrb_basic_ptr(obj))) return mrb_undef_value();
+  return obj;
+}
+
+/* read a weak reference; a referent not yet reached by the marker is kept alive */
+mrb_value
+mrb_gc_weak_get(mrb_state *mrb, mrb_value obj)
+{
+  if (mrb->gc_state == GC_STATE_MARK && mrb_basic_p(obj)) {
+    mrb_gc_mark(mrb, mrb_basic_ptr(obj));
+  }
+  return obj;
+}
+
+static void
+gc_weak_update_all(mrb_state *mrb)
+{
+  struct mrb_gc_weak *weak, *next;
+
+  for (weak = mrb->gc_weak; weak; weak = next) {
+    next = weak->next;
+    weak->update(mrb, weak);
+  }
 }
 
 static void
 prepare_incremental_sweep(mrb_state *mrb)
 {
+  /* clear weak references to unmarked objects before their slots are reused */
+  gc_weak_update_all(mrb);
   mrb->gc_state = GC_STATE_SWEEP;
   mrb->sweeps = mrb->heaps;
   mrb->gc_live_after_mark = mrb->live;
@@ -846,17 +2389,21 @@ incremental_sweep_phase(mrb_state *mrb, size_t limit)
   struct heap_page *page = mrb->sweeps;
   size_t tried_sweep = 0;
 
+#ifdef MRB_GC_BACKGROUND_FREE
+  mrb->gc_deferring = gc_freer_get(mrb) != NULL;
+#endif
   while (page && (tried_sweep < limit)) {
     RVALUE *p = page->objects;
-    RVALUE *e = p + MRB_HEAP_PAGE_SIZE;
-    size_t freed = 0;
+    RVALUE *e = p + page->bump;
+    size_t freed = 0, survived = 0, payload = 0;
     mrb_bool dead_slot = TRUE;
-    int full = (page->freelist == NULL);
+    int full = (page->freelist == NULL && page->bump == MRB_HEAP_PAGE_SIZE);
 
     if (is_minor_gc(mrb) && page->old) {
       /* skip a slot which doesn't contain any young object */
       p = e;
       dead_slot = FALSE;
+      payload = page->payload;
     }
     while (p<e) {
       if (is_dead(mrb, &p->as.basic)) {
@@ -871,27 +2418,43 @@ incremental_sweep_phase(mrb_state *mrb, size_t limit)
         if (!is_generational(mrb))
           paint_partial_white(mrb, &p->as.basic); /* next gc target */
         dead_slot = 0;
+        survived++;
+        payload += gc_payload_size(mrb, &p->as.basic);
       }
-      p++;
+      p += page->width;
     }
 
-    /* free dead slot */
-    if (dead_slot && freed < MRB_HEAP_PAGE_SIZE) {
+    /* free dead slot; region pages stay with their region and pages of
+       a growth step until they have been allocated from */
+    if (dead_slot && !page->region && (page->bump == 0 ? !page->fresh : freed < page->bump) &&
+        mrb->gc_stat.heap_pages > mrb->gc_heap_min_pages) {
       struct heap_page *next = page->next;
 
       unlink_heap_page(mrb, page);
       unlink_free_heap_page(mrb, page);
-      mrb_free(mrb, page);
+      free_heap_page(mrb, page);
       page = next;
     }
     else {
-      if (full && freed > 0) {
+      mrb->gc_stat.payload_bytes += payload - page->payload;
+      page->payload = payload;
+      if (page->bump > 0) {
+        page->fresh = FALSE;
+      }
+      if (dead_slot) {
+        /* everything handed out died in this cycle; bump-allocate again */
+        page->freelist = NULL;
+        page->bump = 0;
+      }
+      if (full && freed > 0 && !page->region) {
         link_free_heap_page(mrb, page);
       }
-      if (page->freelist == NULL && is_minor_gc(mrb))
+      if (page->freelist == NULL && page->bump == MRB_HEAP_PAGE_SIZE && is_minor_gc(mrb))
         page->old = TRUE;
       else
         page->old = FALSE;
+      if (is_minor_gc(mrb))
+        mrb->gc_stat.promoted += survived;
       page = page->next;
     }
     tried_sweep += MRB_HEAP_PAGE_SIZE;
@@ -899,32 +2462,62 @@ incremental_sweep_phase(mrb_state *mrb, size_t limit)
     mrb->gc_live_after_mark -= freed;
   }
   mrb->sweeps = page;
+#ifdef MRB_GC_BACKGROUND_FREE
+  mrb->gc_deferring = FALSE;
+  gc_freer_submit(mrb);
+#endif
   return tried_sweep;
 }
 
+static void
+gc_event(mrb_state *mrb, enum mrb_gc_event ev)
+{
+  if (mrb->gc_event_func) {
+    mrb->gc_event_func(mrb, ev, mrb->gc_event_ud);
+  }
+}
+
+static void
+gc_sweep_done(mrb_state *mrb)
+{
+  mrb->gc_state = GC_STATE_NONE;
+  mrb->gc_stat.count++;
+  gc_event(mrb, MRB_GC_EVENT_END);
+}
+
 static size_t
 incremental_gc(mrb_state *mrb, size_t limit)
 {
   switch (mrb->gc_state) {
   case GC_STATE_NONE:
+    gc_event(mrb, MRB_GC_EVENT_START);
+    if (is_minor_gc(mrb))
+      mrb->gc_stat.minor_count++;
+    else
+      mrb->gc_stat.major_count++;
+    mrb->gc_stat.root_scan_count++;
     root_scan_phase(mrb);
     mrb->gc_state = GC_STATE_MARK;
     flip_white_part(mrb);
     return 0;
   case GC_STATE_MARK:
-    if (mrb->gray_list) {
+    if (gray_list_pending(mrb)) {
+      mrb->gc_stat.mark_count++;
       return incremental_marking_phase(mrb, limit);
     }
     else {
+      mrb->gc_stat.final_mark_count++;
       final_marking_phase(mrb);
       prepare_incremental_sweep(mrb);
       return 0;
     }
   case GC_STATE_SWEEP: {
      size_t tried_sweep = 0;
+     mrb->gc_stat.sweep_count++;
      tried_sweep = incremental_sweep_phase(mrb, limit);
-     if (tried_sweep == 0)
-       mrb->gc_state = GC_STATE_NONE;
+     if (tried_sweep == 0) {
+       gc_sweep_done(mrb);
+     }
      return tried_sweep;
   }
   default:
@@ -946,11 +2539,21 @@ static void
 incremental_gc_step(mrb_state *mrb)
 {
   size_t limit = 0, result = 0;
-  limit = (GC_STEP_SIZE/100) * mrb->gc_step_ratio;
-  while (result < limit) {
-    result += incremental_gc(mrb, limit);
-    if (mrb->gc_state == GC_STATE_NONE)
-      break;
+
+  if (mrb->gc_step_budget_us > 0) {
+    uint64_t deadline = gc_clock_us() + mrb->gc_step_budget_us;
+
+    do {
+      incremental_gc(mrb, GC_BUDGET_CHECK_INTERVAL);
+    } while (mrb->gc_state != gc_cycle_stop(mrb) && gc_clock_us() < deadline);
+  }
+  else {
+    limit = (GC_STEP_SIZE/100) * mrb->gc_step_ratio;
+    while (result < limit) {
+      result += incremental_gc(mrb, limit);
+      if (mrb->gc_state == gc_cycle_stop(mrb))
+        break;
+    }
   }
 
   mrb->gc_threshold = mrb->live + GC_STEP_SIZE;
@@ -971,47 +2574,108 @@ clear_all_old(mrb_state *mrb)
    * (including all the old objects, of course) to white. */
   mrb->is_generational_gc_mode = FALSE;
   prepare_incremental_sweep(mrb);
-  incremental_gc_until(mrb, GC_STATE_NONE);
+  mrb->gc_stat.sweep_count++;
+  incremental_sweep_phase(mrb, ~0);
+  mrb->gc_state = GC_STATE_NONE;
   mrb->is_generational_gc_mode = origin_mode;
 
   /* The gray objects has already been painted as white */
-  mrb->atomic_gray_list = mrb->gray_list = NULL;
+  gray_list_clear(mrb);
+}
+
+/* no cycle starts while the live objects fit in the reserved pages */
+static void
+gc_threshold_reserve(mrb_state *mrb)
+{
+  size_t reserved = mrb->gc_heap_min_pages * MRB_HEAP_PAGE_SIZE;
+
+  if (mrb->gc_threshold < reserved) {
+    mrb->gc_threshold = reserved;
+  }
+}
+
+/* bookkeeping after the last page of a cycle has been swept */
+static void
+gc_cycle_end(mrb_state *mrb)
+{
+  mrb_assert(mrb->live >= mrb->gc_live_after_mark);
+  mrb->gc_threshold = (mrb->gc_live_after_mark/100) * mrb->gc_interval_ratio;
+  if (mrb->gc_threshold < GC_STEP_SIZE) {
+    mrb->gc_threshold = GC_STEP_SIZE;
+  }
+  gc_threshold_reserve(mrb);
+  mrb->malloc_increase = 0;
+
+  if (is_major_gc(mrb)) {
+    mrb->majorgc_old_threshold = mrb->gc_live_after_mark/100 * DEFAULT_MAJOR_GC_INC_RATIO;
+    mrb->oldmalloc_increase = 0;
+    mrb->gc_full = FALSE;
+    gc_compact_check(mrb);
+  }
+  else if (is_minor_gc(mrb)) {
+    if (mrb->live > mrb->majorgc_old_threshold || oldmalloc_pressure_p(mrb)) {
+      clear_all_old(mrb);
+      mrb->gc_full = TRUE;
+    }
+  }
+  else {
+    mrb->oldmalloc_increase = 0;
+    gc_compact_check(mrb);
+  }
+}
+
+/* complete a cycle left in the sweep phase */
+static void
+gc_finish_sweep(mrb_state *mrb)
+{
+  if (mrb->gc_state != GC_STATE_SWEEP) return;
+  incremental_gc_until(mrb, GC_STATE_NONE);
+  gc_cycle_end(mrb);
+}
+
+/* sweep a page of a lazily swept cycle (more if no slot is free); called when allocating */
+static void
+gc_lazy_sweep(mrb_state *mrb)
+{
+  do {
+    mrb->gc_stat.sweep_count++;
+    incremental_sweep_phase(mrb, MRB_HEAP_PAGE_SIZE);
+    if (mrb->sweeps == NULL) {
+      gc_sweep_done(mrb);
+      gc_cycle_end(mrb);
+      return;
+    }
+  } while (mrb->free_heaps[0] == NULL);
 }
 
 void
 mrb_incremental_gc(mrb_state *mrb)
 {
+  uint64_t start;
+
   if (mrb->gc_disabled) return;
 
   GC_INVOKE_TIME_REPORT("mrb_incremental_gc()");
   GC_TIME_START;
+  start = gc_clock_us();
 
-  if (is_minor_gc(mrb)) {
-    incremental_gc_until(mrb, GC_STATE_NONE);
+  if (mrb->gc_lazy_sweep && mrb->gc_state == GC_STATE_SWEEP) {
+    /* the previous cycle is still being swept on the allocation path */
+    gc_finish_sweep(mrb);
+  }
+  else if (is_minor_gc(mrb) || (malloc_pressure_p(mrb) && mrb->gc_step_budget_us == 0)) {
+    /* dead objects may be holding a lot of malloc'ed memory; don't wait */
+    incremental_gc_until(mrb, gc_cycle_stop(mrb));
   }
   else {
     incremental_gc_step(mrb);
   }
 
   if (mrb->gc_state == GC_STATE_NONE) {
-    mrb_assert(mrb->live >= mrb->gc_live_after_mark);
-    mrb->gc_threshold = (mrb->gc_live_after_mark/100) * mrb->gc_interval_ratio;
-    if (mrb->gc_threshold < GC_STEP_SIZE) {
-      mrb->gc_threshold = GC_STEP_SIZE;
-    }
-
-    if (is_major_gc(mrb)) {
-      mrb->majorgc_old_threshold = mrb->gc_live_after_mark/100 * DEFAULT_MAJOR_GC_INC_RATIO;
-      mrb->gc_full = FALSE;
-    }
-    else if (is_minor_gc(mrb)) {
-      if (mrb->live > mrb->majorgc_old_threshold) {
-        clear_all_old(mrb);
-        mrb->gc_full = TRUE;
-      }
-    }
+    gc_cycle_end(mrb);
   }
 
+  gc_pause_record(mrb, start);
   GC_TIME_STOP_AND_REPORT;
 }
 
@@ -1019,9 +2683,15 @@ mrb_incremental_gc(mrb_state *mrb)
 void
 mrb_full_gc(mrb_state *mrb)
 {
+  uint64_t start;
+
   if (mrb->gc_disabled) return;
   GC_INVOKE_TIME_REPORT("mrb_full_gc()");
   GC_TIME_START;
+  start = gc_clock_us();
+#ifdef MRB_GC_PARALLEL_MARK
+  mrb->gc_parallel = TRUE;
+#endif
 
   if (is_generational(mrb)) {
     /* clear all the old objects back to young */
@@ -1033,14 +2703,23 @@ mrb_full_gc(mrb_state *mrb)
     incremental_gc_until(mrb, GC_STATE_NONE);
   }
 
-  incremental_gc_until(mrb, GC_STATE_NONE);
-  mrb->gc_threshold = (mrb->gc_live_after_mark/100) * mrb->gc_interval_ratio;
+  incremental_gc_until(mrb, gc_cycle_stop(mrb));
+  if (mrb->gc_state == GC_STATE_NONE) {
+    mrb->gc_threshold = (mrb->gc_live_after_mark/100) * mrb->gc_interval_ratio;
+    gc_threshold_reserve(mrb);
+    mrb->malloc_increase = 0;
+    mrb->oldmalloc_increase = 0;
 
-  if (is_generational(mrb)) {
-    mrb->majorgc_old_threshold = mrb->gc_live_after_mark/100 * DEFAULT_MAJOR_GC_INC_RATIO;
-    mrb->gc_full = FALSE;
+    if (is_generational(mrb)) {
+      mrb->majorgc_old_threshold = mrb->gc_live_after_mark/100 * DEFAULT_MAJOR_GC_INC_RATIO;
+      mrb->gc_full = FALSE;
+    }
   }
+#ifdef MRB_GC_PARALLEL_MARK
+  mrb->gc_parallel = FALSE;
+#endif
 
+  gc_pause_record(mrb, start);
   GC_TIME_STOP_AND_REPORT;
 }
 
@@ -1050,201 +2729,1651 @@ mrb_garbage_collect(mrb_state *mrb)
   mrb_full_gc(mrb);
 }
 
-int
-mrb_gc_arena_save(mrb_state *mrb)
+/*
+  == Compaction
+
+  mrb_gc_compact() runs a full GC, then moves objects out of the most
+  sparsely occupied pages into free slots of the fullest ones and
+  releases the pages that became empty. While compacting, obj->gcnext
+  (unused after a full GC) holds the forwarding address: NULL for an
+  object that stays, the object itself for a pinned one, and the new
+  slot for a moved one.
+
+  C code keeps raw object pointers, so only plain data objects (objects,
+  strings, arrays, hashes, ranges and boxed floats) ever move, and only
+  if they aren't referenced from a VM stack, the arena, top_self or the
+  ivars of a data object, and weren't pinned by mrb_gc_pin() or by
+  taking their object_id. Classes, procs, envs, fibers and data objects
+  never move. C functions may still hold pointers to objects they fetched
+  from other objects, so compaction only runs when no C function is
+  below the running Ruby code (gc_compact_safe_p); an automatic
+  compaction requested after a major GC waits for such a safe point in
+  the VM (mrb_gc_safe_point).
+*/
+
+#define is_forwarded(o) ((o)->gcnext != NULL && (o)->gcnext != (o))
+#define gc_pin_obj(o) ((o)->gcnext = (o))
+
+static void
+gc_pin_value(mrb_value v)
 {
-  return mrb->arena_idx;
+  if (mrb_basic_p(v)) {
+    gc_pin_obj(mrb_basic_ptr(v));
+  }
 }
 
-void
-mrb_gc_arena_restore(mrb_state *mrb, int idx)
+static mrb_bool
+gc_movable_p(struct RBasic *obj)
 {
-#ifndef MRB_GC_FIXED_ARENA
-  int capa = mrb->arena_capa;
-
-  if (idx < capa / 2) {
-    capa = (int)(capa * 0.66);
-    if (capa < MRB_GC_ARENA_SIZE) {
-      capa = MRB_GC_ARENA_SIZE;
-    }
-    if (capa != mrb->arena_capa) {
-      mrb->arena = (struct RBasic**)mrb_realloc(mrb, mrb->arena, sizeof(struct RBasic*)*capa);
-      mrb->arena_capa = capa;
-    }
+  if (obj->gcnext != NULL || (obj->flags & MRB_FLAG_GC_PINNED)) return FALSE;
+  switch (obj->tt) {
+  case MRB_TT_OBJECT:
+  case MRB_TT_STRING:
+  case MRB_TT_ARRAY:
+  case MRB_TT_HASH:
+  case MRB_TT_RANGE:
+  case MRB_TT_FLOAT:
+    return TRUE;
+  default:
+    return FALSE;
   }
-#endif
-  mrb->arena_idx = idx;
 }
 
-/*
- * Field write barrier
- *   Paint obj(Black) -> value(White) to obj(Black) -> value(Gray).
- */
-
-void
-mrb_field_write_barrier(mrb_state *mrb, struct RBasic *obj, struct RBasic *value)
+static void
+gc_pin_context(struct mrb_context *c)
 {
-  if (!is_black(obj)) return;
-  if (!is_white(value)) return;
-
-  mrb_assert(!is_dead(mrb, value) && !is_dead(mrb, obj));
-  mrb_assert(is_generational(mrb) || mrb->gc_state != GC_STATE_NONE);
+  mrb_value *p, *e;
 
-  if (is_generational(mrb) || mrb->gc_state == GC_STATE_MARK) {
-    add_gray_list(mrb, value);
-  }
-  else {
-    mrb_assert(mrb->gc_state == GC_STATE_SWEEP);
-    paint_partial_white(mrb, obj); /* for never write barriers */
+  if (!c->stbase) return;
+  e = c->stack;
+  if (c->ci) e += c->ci->nregs;
+  if (e > c->stend) e = c->stend;
+  for (p = c->stbase; p < e; p++) {
+    gc_pin_value(*p);
   }
 }
 
+static mrb_bool
+gc_compact_safe_p(mrb_state *mrb)
+{
+  struct mrb_context *c;
+  mrb_callinfo *ci;
+
+  for (c = mrb->c; c; c = c->prev) {
+    if (!c->cibase) continue;
+    for (ci = c->cibase + 1; ci <= c->ci; ci++) {
+      /* entered from C (mrb_funcall, mrb_yield, ensure clauses) */
+      if (ci->acc < 0) return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+mrb_value
+mrb_gc_location(mrb_state *mrb, mrb_value v)
+{
+  if (mrb->gc_compacting && mrb_basic_p(v) && is_forwarded(mrb_basic_ptr(v))) {
+    return mrb_obj_value(mrb_basic_ptr(v)->gcnext);
+  }
+  return v;
+}
+
+void
+mrb_gc_pin(mrb_state *mrb, mrb_value obj)
+{
+  if (mrb_basic_p(obj)) {
+    mrb_basic_ptr(obj)->flags |= MRB_FLAG_GC_PINNED;
+  }
+}
+
+void
+mrb_gc_unpin(mrb_state *mrb, mrb_value obj)
+{
+  if (mrb_basic_p(obj)) {
+    mrb_basic_ptr(obj)->flags &= ~MRB_FLAG_GC_PINNED;
+  }
+}
+
+static void
+gc_update_object(mrb_state *mrb, struct RBasic *obj)
+{
+  switch (obj->tt) {
+  case MRB_TT_CLASS:
+  case MRB_TT_MODULE:
+  case MRB_TT_SCLASS:
+  case MRB_TT_OBJECT:
+  case MRB_TT_DATA:
+  case MRB_TT_EXCEPTION:
+    mrb_gc_update_iv(mrb, (struct RObject*)obj);
+    break;
+
+  case MRB_TT_HASH:
+    mrb_gc_update_iv(mrb, (struct RObject*)obj);
+    mrb_gc_update_hash(mrb, (struct RHash*)obj);
+    break;
+
+  case MRB_TT_ENV:
+    {
+      struct REnv *e = (struct REnv*)obj;
+
+      if (!MRB_ENV_STACK_SHARED_P(e)) {
+        int i, len;
+
+        len = (int)MRB_ENV_STACK_LEN(e);
+        for (i=0; i<len; i++) {
+          e->stack[i] = mrb_gc_location(mrb, e->stack[i]);
+        }
+      }
+    }
+    break;
+
+  case MRB_TT_ARRAY:
+    {
+      struct RArray *a = (struct RArray*)obj;
+      mrb_int i;
+
+      for (i=0; i<a->len; i++) {
+        a->ptr[i] = mrb_gc_location(mrb, a->ptr[i]);
+      }
+    }
+    break;
+
+  case MRB_TT_RANGE:
+    {
+      struct RRange *r = (struct RRange*)obj;
+
+      if (r->edges) {
+        r->edges->beg = mrb_gc_location(mrb, r->edges->beg);
+        r->edges->end = mrb_gc_location(mrb, r->edges->end);
+      }
+    }
+    break;
+
+  default:
+    /* procs, fibers and iclasses only refer to objects that never move */
+    break;
+  }
+}
+
+static struct RBasic*
+gc_page_take_slot(struct heap_page *page)
+{
+  struct RBasic *p = page->freelist;
+
+  if (p) {
+    page->freelist = ((struct free_obj*)p)->next;
+  }
+  else if (page->bump < MRB_HEAP_PAGE_SIZE) {
+    p = &page->objects[page->bump].as.basic;
+    page->bump += page->width;
+  }
+  return p;
+}
+
+struct gc_page_live {
+  struct heap_page *page;
+  size_t live;
+};
+
+/* fullest pages first; pages of wide slots after all others */
+static int
+gc_page_live_cmp(const void *a, const void *b)
+{
+  const struct gc_page_live *pa = (const struct gc_page_live*)a;
+  const struct gc_page_live *pb = (const struct gc_page_live*)b;
+  size_t x = pa->live, y = pb->live;
+
+  if (pa->page->width != pb->page->width) return pa->page->width < pb->page->width ? -1 : 1;
+  return x < y ? 1 : x > y ? -1 : 0;
+}
+
+size_t
+mrb_gc_compact(mrb_state *mrb)
+{
+  struct gc_page_live *pages;
+  struct heap_page *page;
+  size_t npages, nnarrow = 0, i, d, s, moved = 0;
+  RVALUE *p, *e;
+  mrb_bool disabled;
+
+  if (mrb->gc_disabled || mrb->region_depth > 0) return 0;
+  mrb_full_gc(mrb);
+  gc_finish_sweep(mrb);
+  npages = mrb->gc_stat.heap_pages;
+  if (npages < 2) return 0;
+
+  /* clear forwarding addresses and count live objects per page */
+  pages = (struct gc_page_live*)mrb_malloc(mrb, sizeof(struct gc_page_live) * npages);
+  for (i = 0, page = mrb->heaps; page; page = page->next, i++) {
+    pages[i].page = page;
+    pages[i].live = 0;
+    if (page->width == 1) nnarrow++;
+    for (p = page->objects, e = p + page->bump; p < e; p += page->width) {
+      if (p->as.basic.tt != MRB_TT_FREE) {
+        p->as.basic.gcnext = NULL;
+        pages[i].live++;
+      }
+    }
+  }
+  mrb->gc_compacting = TRUE;
+
+  /* pin what C may be pointing to */
+  for (i = 0; i < (size_t)mrb->arena_idx; i++) {
+    gc_pin_obj(mrb->arena[i]);
+  }
+  if (mrb->top_self) gc_pin_obj((struct RBasic*)mrb->top_self);
+  gc_pin_context(mrb->root_c);
+  for (i = 0; i < npages; i++) {
+    for (p = pages[i].page->objects, e = p + pages[i].page->bump; p < e; p += pages[i].page->width) {
+      if (p->as.basic.tt == MRB_TT_FIBER && ((struct RFiber*)p)->cxt) {
+        gc_pin_context(((struct RFiber*)p)->cxt);
+      }
+      else if (p->as.basic.tt == MRB_TT_DATA) {
+        mrb_gc_pin_iv(mrb, (struct RObject*)p);
+      }
+    }
+  }
+
+  /* move objects from the emptiest pages into the fullest ones */
+  qsort(pages, npages, sizeof(struct gc_page_live), gc_page_live_cmp);
+  d = 0;
+  s = nnarrow > 0 ? nnarrow - 1 : 0;
+  while (d < s) {
+    struct heap_page *src = pages[s].page;
+
+    for (p = src->objects, e = p + src->bump; p < e && d < s; p++) {
+      struct RBasic *obj = &p->as.basic, *slot;
+
+      if (obj->tt == MRB_TT_FREE || !gc_movable_p(obj)) continue;
+      while ((slot = gc_page_take_slot(pages[d].page)) == NULL) {
+        if (++d == s) break;
+      }
+      if (slot == NULL) break;
+      *(RVALUE*)slot = *(RVALUE*)obj;
+#ifdef MRB_GC_SIDE_BITMAP
+      gc_side_color(slot) = gc_side_color(obj);
+#endif
+      obj->gcnext = slot;
+      moved++;
+    }
+    s--;
+  }
+
+  /* update references to the moved objects */
+  if (moved > 0) {
+    for (i = 0; i < npages; i++) {
+      for (p = pages[i].page->objects, e = p + pages[i].page->bump; p < e; p += pages[i].page->width) {
+        if (p->as.basic.tt != MRB_TT_FREE && !is_forwarded(&p->as.basic)) {
+          gc_update_object(mrb, &p->as.basic);
+        }
+      }
+    }
+    mrb_gc_update_gv(mrb);
+    mrb_gc_update_symtbl(mrb);
+    gc_weak_update_all(mrb);
+    if (mrb->exc) {
+      mrb->exc = (struct RObject*)mrb_ptr(mrb_gc_location(mrb, mrb_obj_value(mrb->exc)));
+    }
+    if (mrb->nomem_err) {
+      mrb->nomem_err = (struct RObject*)mrb_ptr(mrb_gc_location(mrb, mrb_obj_value(mrb->nomem_err)));
+    }
+  }
+  mrb->gc_compacting = FALSE;
+
+  /* free the old slots, release empty pages and rebuild the free list;
+     the heap cannot be collected until this is done */
+  disabled = mrb->gc_disabled;
+  mrb->gc_disabled = TRUE;
+  memset(mrb->free_heaps, 0, sizeof(mrb->free_heaps));
+  for (i = 0; i < npages; i++) {
+    size_t live = 0, payload = 0;
+
+    page = pages[i].page;
+    page->freelist = NULL;
+    for (p = page->objects, e = p + page->bump; p < e; p += page->width) {
+      if (p->as.basic.tt != MRB_TT_FREE && is_forwarded(&p->as.basic) &&
+          (p->as.basic.flags & MRB_FLAG_GC_TRACED) && mrb->obj_event_func) {
+        mrb->obj_event_func(mrb, MRB_OBJ_EVENT_MOVE, p->as.basic.gcnext, &p->as.basic, mrb->obj_event_ud);
+      }
+      if (p->as.basic.tt == MRB_TT_FREE || is_forwarded(&p->as.basic)) {
+        p->as.free.tt = MRB_TT_FREE;
+        p->as.free.next = page->freelist;
+        page->freelist = &p->as.basic;
+      }
+      else {
+        p->as.basic.gcnext = NULL;
+        live++;
+        payload += gc_payload_size(mrb, &p->as.basic);
+      }
+    }
+    mrb->gc_stat.payload_bytes += payload - page->payload;
+    page->payload = payload;
+    page->old = FALSE;
+    page->free_next = page->free_prev = NULL;
+    if (live == 0 && page->bump > 0 && mrb->gc_stat.heap_pages > mrb->gc_heap_min_pages) {
+      unlink_heap_page(mrb, page);
+      free_heap_page(mrb, page);
+    }
+    else if (page->freelist || page->bump < MRB_HEAP_PAGE_SIZE) {
+      link_free_heap_page(mrb, page);
+    }
+  }
+  mrb->gc_disabled = disabled;
+  mrb_free(mrb, pages);
+
+  mrb->gc_stat.compact_count++;
+  mrb->gc_stat.moved += moved;
+  mrb->gc_compact_pages = mrb->gc_stat.heap_pages;
+  return moved;
+}
+
+/* request a compaction once a major GC leaves the heap fragmented */
+static void
+gc_compact_check(mrb_state *mrb)
+{
+  size_t slots = mrb->gc_stat.heap_pages * MRB_HEAP_PAGE_SIZE;
+
+  if (mrb->gc_compact_threshold <= 0) return;
+  if (mrb->gc_stat.heap_pages <= mrb->gc_compact_pages) return;
+  if ((slots - mrb->live) / MRB_HEAP_PAGE_SIZE < 4) return;
+  if ((slots - mrb->live) * 100 > slots * (size_t)mrb->gc_compact_threshold) {
+    mrb->gc_compact_pending = TRUE;
+  }
+}
+
+/*
+  Regions. Between mrb_region_begin() and mrb_region_end() objects are
+  allocated from pages of their own and carry MRB_FLAG_GC_REGION. The
+  write barriers remember every outside object a region object may have
+  been stored into; MRB_FLAG_GC_REGION_SEEN keeps the remembered set free
+  of duplicates. When the region ends between GC cycles, the region
+  objects reachable from the roots, from the remembered objects and from
+  region objects a cycle has promoted meanwhile are traced through region
+  objects only, and the rest are freed; pages left empty are kept for the
+  next region. A region that ends while marking is in progress hands its
+  pages to the heap and leaves its objects to the collector.
+*/
+
+static struct heap_page*
+region_add_page(mrb_state *mrb)
+{
+  struct heap_page *page = mrb->region_idle;
+
+  if (page) {
+    mrb->region_idle = page->region_next;
+  }
+  else {
+    page = alloc_heap_page(mrb);
+  }
+  page->region = TRUE;
+  page->region_next = mrb->region_pages;
+  mrb->region_pages = page;
+  link_heap_page(mrb, page);
+  return page;
+}
+
+static struct RBasic*
+region_take_slot(mrb_state *mrb)
+{
+  struct RBasic *p = NULL;
+
+  if (mrb->region_pages) {
+    p = gc_page_take_slot(mrb->region_pages);
+  }
+  if (p == NULL) {
+    p = gc_page_take_slot(region_add_page(mrb));
+  }
+  return p;
+}
+
+static void
+region_remember(mrb_state *mrb, struct RBasic *obj)
+{
+  if (mrb->region_remember_len == mrb->region_remember_capa) {
+    size_t capa = mrb->region_remember_capa ? mrb->region_remember_capa * 2 : 64;
+    /* called from write barriers; failing here must not raise or collect */
+    struct RBasic **ptr = (struct RBasic**)(mrb->allocf)(mrb, mrb->region_remember, sizeof(struct RBasic*) * capa, mrb->ud);
+
+    if (ptr == NULL) {
+      /* the region can no longer tell what escaped; its end frees nothing */
+      mrb->region_overflow = TRUE;
+      return;
+    }
+    mrb->region_remember = ptr;
+    mrb->region_remember_capa = capa;
+  }
+  obj->flags |= MRB_FLAG_GC_REGION_SEEN;
+  mrb->region_remember[mrb->region_remember_len++] = obj;
+}
+
+/* mrb_gc_mark() while region_collect() scans */
+static void
+region_visit(mrb_state *mrb, struct RBasic *obj, void *ud)
+{
+  if ((obj->flags & (MRB_FLAG_GC_REGION | MRB_FLAG_GC_REGION_SEEN)) != MRB_FLAG_GC_REGION) return;
+  obj->flags |= MRB_FLAG_GC_REGION_SEEN;
+  /* other colors are scanned by region_collect() directly; their gcnext may be in use */
+  if (is_white(obj)) {
+    obj->gcnext = mrb->region_gray;
+    mrb->region_gray = obj;
+  }
+}
+
+static void
+region_collect(mrb_state *mrb)
+{
+  struct heap_page *page, *next;
+  struct mrb_context *c;
+  RVALUE *p, *e;
+  size_t i, dead = 0;
+
+  mrb->gc_visit = region_visit;
+  mrb->region_gray = NULL;
+  /* promoted or grayed by a cycle run inside the region; old objects may refer to them */
+  for (page = mrb->region_pages; page; page = page->region_next) {
+    for (p = page->objects, e = p + page->bump; p < e; p += page->width) {
+      struct RBasic *obj = &p->as.basic;
+
+      if (obj->tt != MRB_TT_FREE && (obj->flags & MRB_FLAG_GC_REGION) && !is_white(obj)) {
+        obj->flags |= MRB_FLAG_GC_REGION_SEEN;
+        gc_visit_children(mrb, obj);
+      }
+    }
+  }
+  mrb_gc_mark_gv(mrb);
+  for (i = 0; i < (size_t)mrb->arena_idx; i++) {
+    mrb_gc_mark(mrb, mrb->arena[i]);
+  }
+  mrb_gc_mark(mrb, (struct RBasic*)mrb->exc);
+  mark_context(mrb, mrb->root_c);
+  for (c = mrb->c; c && c != mrb->root_c; c = c->prev) {
+    mark_context(mrb, c);
+  }
+  for (i = 0; i < mrb->region_remember_len; i++) {
+    struct RBasic *obj = mrb->region_remember[i];
+
+    if (obj->tt != MRB_TT_FREE) {
+      gc_visit_children(mrb, obj);
+    }
+  }
+  while (mrb->region_gray) {
+    struct RBasic *obj = mrb->region_gray;
+
+    mrb->region_gray = obj->gcnext;
+    gc_visit_children(mrb, obj);
+  }
+  mrb->gc_visit = NULL;
+
+  /* survivors become ordinary objects; the others get the dead color for weak tables */
+  for (page = mrb->region_pages; page; page = page->region_next) {
+    for (p = page->objects, e = p + page->bump; p < e; p += page->width) {
+      struct RBasic *obj = &p->as.basic;
+
+      if (obj->tt == MRB_TT_FREE || !(obj->flags & MRB_FLAG_GC_REGION)) continue;
+      if (obj->flags & MRB_FLAG_GC_REGION_SEEN) {
+        obj->flags &= ~(MRB_FLAG_GC_REGION | MRB_FLAG_GC_REGION_SEEN);
+      }
+      else {
+        gc_set_color(obj, other_white_part(mrb));
+        dead++;
+      }
+    }
+  }
+  if (dead > 0) {
+    gc_weak_update_all(mrb);
+  }
+
+  for (page = mrb->region_pages; page; page = next) {
+    size_t live = 0;
+
+    next = page->region_next;
+    for (p = page->objects, e = p + page->bump; p < e; p += page->width) {
+      struct RBasic *obj = &p->as.basic;
+
+      if (obj->tt == MRB_TT_FREE) continue;
+      if (obj->flags & MRB_FLAG_GC_REGION) {
+        obj_free(mrb, obj);
+        p->as.free.next = page->freelist;
+        page->freelist = obj;
+      }
+      else {
+        live++;
+      }
+    }
+    page->region = FALSE;
+    page->old = FALSE;
+    if (live == 0) {
+      /* nothing escaped; keep the page for the next region */
+      unlink_heap_page(mrb, page);
+      page->freelist = NULL;
+      page->bump = 0;
+      page->region_next = mrb->region_idle;
+      mrb->region_idle = page;
+    }
+    else {
+      page->region_next = NULL;
+      if (page->freelist || page->bump < MRB_HEAP_PAGE_SIZE) {
+        link_free_heap_page(mrb, page);
+      }
+    }
+  }
+  mrb->region_pages = NULL;
+  mrb->live -= dead;
+  mrb->gc_stat.region_freed += dead;
+}
+
+/* give the region pages and their objects to the heap as they are */
+static void
+region_release(mrb_state *mrb)
+{
+  struct heap_page *page, *next;
+  RVALUE *p, *e;
+
+  for (page = mrb->region_pages; page; page = next) {
+    next = page->region_next;
+    for (p = page->objects, e = p + page->bump; p < e; p += page->width) {
+      p->as.basic.flags &= ~(MRB_FLAG_GC_REGION | MRB_FLAG_GC_REGION_SEEN);
+    }
+    page->region = FALSE;
+    page->region_next = NULL;
+    if (page->freelist || page->bump < MRB_HEAP_PAGE_SIZE) {
+      link_free_heap_page(mrb, page);
+    }
+  }
+  mrb->region_pages = NULL;
+}
+
+void
+mrb_region_begin(mrb_state *mrb)
+{
+  mrb->region_depth++;
+}
+
+void
+mrb_region_end(mrb_state *mrb)
+{
+  size_t i;
+
+  if (mrb->region_depth == 0 || --mrb->region_depth > 0) return;
+  if (mrb->gc_state == GC_STATE_SWEEP) {
+    gc_finish_sweep(mrb);
+  }
+  if (mrb->gc_state == GC_STATE_NONE && !mrb->gc_disabled && !mrb->region_overflow) {
+    region_collect(mrb);
+  }
+  else {
+    region_release(mrb);
+  }
+  for (i = 0; i < mrb->region_remember_len; i++) {
+    struct RBasic *obj = mrb->region_remember[i];
+
+    if (!(obj->flags & MRB_FLAG_GC_REGION)) {
+      obj->flags &= ~MRB_FLAG_GC_REGION_SEEN;
+    }
+  }
+  mrb->region_remember_len = 0;
+  mrb->region_overflow = FALSE;
+  mrb->gc_stat.region_count++;
+}
+
+void
+mrb_gc_safe_point(mrb_state *mrb)
+{
+  if (mrb->gc_compact_pending && gc_compact_safe_p(mrb)) {
+    mrb->gc_compact_pending = FALSE;
+    mrb_gc_compact(mrb);
+  }
+}
+
+int
+mrb_gc_arena_save(mrb_state *mrb)
+{
+  return mrb->arena_idx;
+}
+
+void
+mrb_gc_arena_restore(mrb_state *mrb, int idx)
+{
+#ifndef MRB_GC_FIXED_ARENA
+  int capa = mrb->arena_capa;
+
+  if (idx < capa / 2) {
+    capa = (int)(capa * 0.66);
+    if (capa < MRB_GC_ARENA_SIZE) {
+      capa = MRB_GC_ARENA_SIZE;
+    }
+    if (capa != mrb->arena_capa) {
+      mrb->arena = (struct RBasic**)mrb_realloc(mrb, mrb->arena, sizeof(struct RBasic*)*capa);
+      mrb->arena_capa = capa;
+    }
+  }
+#endif
+  mrb->arena_idx = idx;
+}
+
+/*
+ * Field write barrier
+ *   Paint obj(Black) -> value(White) to obj(Black) -> value(Gray).
+ */
+
+void
+mrb_field_write_barrier(mrb_state *mrb, struct RBasic *obj, struct RBasic *value)
+{
+  if (mrb->region_depth > 0 && (value->flags & MRB_FLAG_GC_REGION) &&
+      !(obj->flags & (MRB_FLAG_GC_REGION | MRB_FLAG_GC_REGION_SEEN))) {
+    region_remember(mrb, obj);
+  }
+  if (!is_black(obj)) return;
+  if (!is_white(value)) return;
+
+  mrb_assert(!is_dead(mrb, value) && !is_dead(mrb, obj));
+  mrb_assert(is_generational(mrb) || mrb->gc_state != GC_STATE_NONE);
+
+  if (is_generational(mrb) || mrb->gc_state == GC_STATE_MARK) {
+    add_gray_list(mrb, value);
+  }
+  else {
+    mrb_assert(mrb->gc_state == GC_STATE_SWEEP);
+    paint_partial_white(mrb, obj); /* for never write barriers */
+  }
+}
+
+/*
+ * Write barrier
+ *   Paint obj(Black) to obj(Gray).
+ *
+ *   The object that is painted gray will be traversed atomically in final
+ *   mark phase. So you use this write barrier if it's frequency written spot.
+ *   e.g. Set element on Array.
+ */
+
+void
+mrb_write_barrier(mrb_state *mrb, struct RBasic *obj)
+{
+  if (mrb->region_depth > 0 && !(obj->flags & (MRB_FLAG_GC_REGION | MRB_FLAG_GC_REGION_SEEN))) {
+    region_remember(mrb, obj);
+  }
+  if (!is_black(obj)) return;
+
+  mrb_assert(!is_dead(mrb, obj));
+  mrb_assert(is_generational(mrb) || mrb->gc_state != GC_STATE_NONE);
+  paint_gray(obj);
+  atomic_gray_list_push(mrb, obj);
+}
+
+/*
+  Card marking. In generational mode a store into an old container
+  normally grays the stored value right away, so everything stored
+  between two minor GCs survives the next one and gets promoted. Stores
+  into arrays and hashes of at least MRB_GC_CARD_MIN_SLOTS slots (array
+  elements, hash buckets) dirty the card holding the slot instead, one
+  byte per MRB_GC_CARD_SLOTS slots, and the next minor GC marks just
+  what the dirty cards hold by then. A major GC marks everything and
+  drops the cards. Operations that move slots around call
+  mrb_write_barrier_moved(), which has the container rescanned whole.
+  The card table is allocated straight from allocf, so a barrier never
+  runs the GC; if it cannot grow, the barriers fall back to graying.
+*/
+#ifndef MRB_GC_CARD_SLOTS
+#define MRB_GC_CARD_SLOTS 8
+#endif
+#ifndef MRB_GC_CARD_MIN_SLOTS
+#define MRB_GC_CARD_MIN_SLOTS 1024
+#endif
+
+struct mrb_gc_card {
+  struct RBasic *obj;           /* NULL for an empty entry */
+  size_t ncards;
+  uint8_t *dirty;
+};
+
+#define gc_card_hash(obj) ((size_t)((uintptr_t)(obj) >> 4) * 2654435761u)
+
+static mrb_bool
+gc_card_p(mrb_state *mrb, struct RBasic *obj, size_t nslots)
+{
+  return nslots >= MRB_GC_CARD_MIN_SLOTS && is_minor_gc(mrb) &&
+    mrb->gc_state == GC_STATE_NONE && mrb->region_depth == 0 && is_black(obj);
+}
+
+static struct mrb_gc_card*
+gc_card_lookup(mrb_state *mrb, struct RBasic *obj)
+{
+  size_t mask = mrb->gc_cards_capa - 1;
+  size_t i;
+
+  if (mrb->gc_cards_capa == 0) return NULL;
+  for (i = gc_card_hash(obj) & mask; mrb->gc_cards[i].obj; i = (i + 1) & mask) {
+    if (mrb->gc_cards[i].obj == obj) return &mrb->gc_cards[i];
+  }
+  return &mrb->gc_cards[i];
+}
+
+static mrb_bool
+gc_card_table_grow(mrb_state *mrb)
+{
+  struct mrb_gc_card *old = mrb->gc_cards;
+  size_t capa = mrb->gc_cards_capa, i;
+  size_t ncapa = capa ? capa * 2 : 16;
+  struct mrb_gc_card *tab;
+
+  tab = (struct mrb_gc_card*)(mrb->allocf)(mrb, NULL, sizeof(struct mrb_gc_card) * ncapa, mrb->ud);
+  if (tab == NULL) return FALSE;
+  memset(tab, 0, sizeof(struct mrb_gc_card) * ncapa);
+  mrb->gc_cards = tab;
+  mrb->gc_cards_capa = ncapa;
+  for (i = 0; i < capa; i++) {
+    if (old[i].obj) {
+      *gc_card_lookup(mrb, old[i].obj) = old[i];
+    }
+  }
+  (mrb->allocf)(mrb, old, 0, mrb->ud);
+  return TRUE;
+}
+
+/* dirty the cards of slots [beg, end) of obj; FALSE if the table could not grow */
+static mrb_bool
+gc_card_dirty(mrb_state *mrb, struct RBasic *obj, size_t beg, size_t end, size_t nslots)
+{
+  size_t ncards = (nslots + MRB_GC_CARD_SLOTS - 1) / MRB_GC_CARD_SLOTS;
+  struct mrb_gc_card *c = gc_card_lookup(mrb, obj);
+
+  if (c == NULL || c->obj == NULL) {
+    if ((mrb->gc_cards_len + 1) * 4 > mrb->gc_cards_capa * 3) {
+      if (!gc_card_table_grow(mrb)) return FALSE;
+      c = gc_card_lookup(mrb, obj);
+    }
+    c->obj = obj;
+    c->ncards = 0;
+    c->dirty = NULL;
+    mrb->gc_cards_len++;
+  }
+  if (c->ncards < ncards) {
+    uint8_t *dirty = (uint8_t*)(mrb->allocf)(mrb, c->dirty, ncards, mrb->ud);
+
+    if (dirty == NULL) return FALSE;
+    memset(dirty + c->ncards, 0, ncards - c->ncards);
+    c->dirty = dirty;
+    c->ncards = ncards;
+  }
+  beg /= MRB_GC_CARD_SLOTS;
+  end = (end - 1) / MRB_GC_CARD_SLOTS;
+  memset(c->dirty + beg, 1, end - beg + 1);
+  return TRUE;
+}
+
+static void
+gc_mark_card(mrb_state *mrb, struct RBasic *obj, size_t beg, size_t end)
+{
+  if (obj->tt == MRB_TT_ARRAY) {
+    struct RArray *a = (struct RArray*)obj;
+
+    if (end > (size_t)a->len) end = a->len;
+    for (; beg < end; beg++) {
+      mrb_gc_mark_value(mrb, a->ptr[beg]);
+    }
+  }
+  else if (obj->tt == MRB_TT_HASH) {
+    mrb_gc_mark_hash_slots(mrb, (struct RHash*)obj, beg, end);
+  }
+}
+
+/* minor GC: mark what the dirty cards hold; then drop all cards */
+static void
+gc_mark_cards(mrb_state *mrb)
+{
+  size_t i, j;
+
+  if (mrb->gc_cards_len == 0) return;
+  for (i = 0; i < mrb->gc_cards_capa; i++) {
+    struct mrb_gc_card *c = &mrb->gc_cards[i];
+
+    if (c->obj == NULL) continue;
+    if (is_minor_gc(mrb)) {
+      for (j = 0; j < c->ncards; j++) {
+        uint64_t word;
+
+        /* skip clean cards eight at a time */
+        if (j % 8 == 0 && j + 8 <= c->ncards) {
+          memcpy(&word, c->dirty + j, sizeof(word));
+          if (word == 0) {
+            j += 7;
+            continue;
+          }
+        }
+        if (c->dirty[j]) {
+          gc_mark_card(mrb, c->obj, j * MRB_GC_CARD_SLOTS, (j + 1) * MRB_GC_CARD_SLOTS);
+          mrb->gc_stat.card_scans++;
+        }
+      }
+    }
+    (mrb->allocf)(mrb, c->dirty, 0, mrb->ud);
+    c->obj = NULL;
+  }
+  mrb->gc_cards_len = 0;
+}
+
+static void
+gc_cards_free(mrb_state *mrb)
+{
+  size_t i;
+
+  for (i = 0; i < mrb->gc_cards_capa; i++) {
+    if (mrb->gc_cards[i].obj) {
+      (mrb->allocf)(mrb, mrb->gc_cards[i].dirty, 0, mrb->ud);
+    }
+  }
+  (mrb->allocf)(mrb, mrb->gc_cards, 0, mrb->ud);
+  mrb->gc_cards = NULL;
+  mrb->gc_cards_len = mrb->gc_cards_capa = 0;
+}
+
+/*
+ * Write barrier for a store of value into slot of the nslots slots of
+ * obj (array elements, hash buckets). Large containers remember the
+ * slot in a card rather than keeping value alive.
+ */
+void
+mrb_field_write_barrier_slot(mrb_state *mrb, struct RBasic *obj, size_t slot, size_t nslots, struct RBasic *value)
+{
+  if (gc_card_p(mrb, obj, nslots) && is_white(value) &&
+      gc_card_dirty(mrb, obj, slot, slot + 1, nslots)) {
+    return;
+  }
+  mrb_field_write_barrier(mrb, obj, value);
+}
+
+/*
+ * Write barrier for stores into slots [beg, beg+len) of the nslots
+ * slots of obj.
+ */
+void
+mrb_write_barrier_range(mrb_state *mrb, struct RBasic *obj, size_t beg, size_t len, size_t nslots)
+{
+  if (len == 0) return;
+  if (gc_card_p(mrb, obj, nslots) && gc_card_dirty(mrb, obj, beg, beg + len, nslots)) {
+    return;
+  }
+  mrb_write_barrier(mrb, obj);
+}
+
+/*
+ * The slots of obj were moved around, so its cards no longer tell
+ * where stored values are; have it scanned whole.
+ */
+void
+mrb_write_barrier_moved(mrb_state *mrb, struct RBasic *obj)
+{
+  struct mrb_gc_card *c;
+
+  if (mrb->gc_cards_len == 0) return;
+  c = gc_card_lookup(mrb, obj);
+  if (c && c->obj) {
+    mrb_write_barrier(mrb, obj);
+  }
+}
+
+/*
+ *  call-seq:
+ *     GC.start                     -> nil
+ *
+ *  Initiates full garbage collection.
+ *
+ */
+
+static mrb_value
+gc_start(mrb_state *mrb, mrb_value obj)
+{
+  mrb_full_gc(mrb);
+  return mrb_nil_value();
+}
+
+/*
+ *  call-seq:
+ *     GC.enable    -> true or false
+ *
+ *  Enables garbage collection, returning <code>true</code> if garbage
+ *  collection was previously disabled.
+ *
+ *     GC.disable   #=> false
+ *     GC.enable    #=> true
+ *     GC.enable    #=> false
+ *
+ */
+
+static mrb_value
+gc_enable(mrb_state *mrb, mrb_value obj)
+{
+  int old = mrb->gc_disabled;
+
+  mrb->gc_disabled = FALSE;
+
+  return mrb_bool_value(old);
+}
+
+/*
+ *  call-seq:
+ *     GC.disable    -> true or false
+ *
+ *  Disables garbage collection, returning <code>true</code> if garbage
+ *  collection was already disabled.
+ *
+ *     GC.disable   #=> false
+ *     GC.disable   #=> true
+ *
+ */
+
+static mrb_value
+gc_disable(mrb_state *mrb, mrb_value obj)
+{
+  int old = mrb->gc_disabled;
+
+  mrb->gc_disabled = TRUE;
+
+  return mrb_bool_value(old);
+}
+
+/*
+ *  call-seq:
+ *     GC.interval_ratio      -> fixnum
+ *
+ *  Returns ratio of GC interval. Default value is 200(%).
+ *
+ */
+
+static mrb_value
+gc_interval_ratio_get(mrb_state *mrb, mrb_value obj)
+{
+  return mrb_fixnum_value(mrb->gc_interval_ratio);
+}
+
+/*
+ *  call-seq:
+ *     GC.interval_ratio = fixnum    -> nil
+ *
+ *  Updates ratio of GC interval. Default value is 200(%).
+ *  GC start as soon as after end all step of GC if you set 100(%).
+ *
+ */
+
+static mrb_value
+gc_interval_ratio_set(mrb_state *mrb, mrb_value obj)
+{
+  mrb_int ratio;
+
+  mrb_get_args(mrb, "i", &ratio);
+  mrb->gc_interval_ratio = ratio;
+  return mrb_nil_value();
+}
+
+/*
+ *  call-seq:
+ *     GC.step_ratio    -> fixnum
+ *
+ *  Returns step span ratio of Incremental GC. Default value is 200(%).
+ *
+ */
+
+static mrb_value
+gc_step_ratio_get(mrb_state *mrb, mrb_value obj)
+{
+  return mrb_fixnum_value(mrb->gc_step_ratio);
+}
+
+/*
+ *  call-seq:
+ *     GC.step_ratio = fixnum   -> nil
+ *
+ *  Updates step span ratio of Incremental GC. Default value is 200(%).
+ *  1 step of incrementalGC becomes long if a rate is big.
+ *
+ */
+
+static mrb_value
+gc_step_ratio_set(mrb_state *mrb, mrb_value obj)
+{
+  mrb_int ratio;
+
+  mrb_get_args(mrb, "i", &ratio);
+  mrb->gc_step_ratio = ratio;
+  return mrb_nil_value();
+}
+
+/*
+ *  call-seq:
+ *     GC.malloc_limit    -> fixnum
+ *
+ *  Returns the number of bytes allocated for object payloads (string
+ *  buffers, array bodies, hash tables, ...) after which a GC cycle runs
+ *  regardless of the object count. Default value is 16MB.
+ *
+ */
+
+static mrb_value
+gc_malloc_limit_get(mrb_state *mrb, mrb_value obj)
+{
+  if (mrb->malloc_limit > MRB_INT_MAX) {
+    return mrb_float_value(mrb, (mrb_float)mrb->malloc_limit);
+  }
+  return mrb_fixnum_value((mrb_int)mrb->malloc_limit);
+}
+
+/*
+ *  call-seq:
+ *     GC.malloc_limit = fixnum    -> nil
+ *
+ *  Updates the malloc limit. A small limit keeps memory held by dead
+ *  objects low at the price of more frequent collections.
+ *
+ */
+
+static mrb_value
+gc_malloc_limit_set(mrb_state *mrb, mrb_value obj)
+{
+  mrb_int limit;
+
+  mrb_get_args(mrb, "i", &limit);
+  if (limit <= 0) {
+    mrb_raise(mrb, E_ARGUMENT_ERROR, "malloc limit must be positive");
+  }
+  mrb->malloc_limit = (size_t)limit;
+  return mrb_nil_value();
+}
+
+static mrb_value
+gc_memory_limit_value(mrb_state *mrb, size_t limit)
+{
+  if (limit == 0) return mrb_nil_value();
+  if (limit > MRB_INT_MAX) {
+    return mrb_float_value(mrb, (mrb_float)limit);
+  }
+  return mrb_fixnum_value((mrb_int)limit);
+}
+
+static size_t
+gc_memory_limit_arg(mrb_state *mrb)
+{
+  mrb_value v;
+  mrb_int limit;
+
+  mrb_get_args(mrb, "o", &v);
+  if (mrb_nil_p(v)) return 0;
+  limit = mrb_int(mrb, v);
+  if (limit <= 0) {
+    mrb_raise(mrb, E_ARGUMENT_ERROR, "memory limit must be positive");
+  }
+  return (size_t)limit;
+}
+
+/*
+ *  call-seq:
+ *     GC.memory_limit    -> fixnum or nil
+ *
+ *  Returns the hard limit on the bytes the interpreter allocates, or
+ *  nil if there is none.
+ */
+
+static mrb_value
+gc_memory_limit_get(mrb_state *mrb, mrb_value obj)
+{
+  return gc_memory_limit_value(mrb, mrb->memory.hard_limit);
+}
+
+/*
+ *  call-seq:
+ *     GC.memory_limit = fixnum or nil    -> nil
+ *
+ *  Sets the hard limit on the bytes the interpreter allocates. An
+ *  allocation that would exceed it raises NoMemoryError. Full GCs on
+ *  object allocation make room before the limit is reached, and after
+ *  such an error. It can't be lifted above the limit the host set with
+ *  mrb_memory_limit_set().
+ */
+
+static mrb_value
+gc_memory_limit_set(mrb_state *mrb, mrb_value obj)
+{
+  size_t limit = gc_memory_limit_arg(mrb);
+
+  if (mrb->memory_hard_cap > 0 && (limit == 0 || limit > mrb->memory_hard_cap)) {
+    mrb_raise(mrb, E_ARGUMENT_ERROR, "memory limit can't exceed the one set by the host");
+  }
+  mrb->memory.hard_limit = limit;
+  memory_hard_next_set(mrb);
+  return mrb_nil_value();
+}
+
 /*
- * Write barrier
- *   Paint obj(Black) to obj(Gray).
+ *  call-seq:
+ *     GC.memory_soft_limit    -> fixnum or nil
  *
- *   The object that is painted gray will be traversed atomically in final
- *   mark phase. So you use this write barrier if it's frequency written spot.
- *   e.g. Set element on Array.
+ *  Returns the soft limit on the bytes the interpreter allocates, or
+ *  nil if there is none.
+ */
+
+static mrb_value
+gc_memory_soft_limit_get(mrb_state *mrb, mrb_value obj)
+{
+  return gc_memory_limit_value(mrb, mrb->memory.soft_limit);
+}
+
+/*
+ *  call-seq:
+ *     GC.memory_soft_limit = fixnum or nil    -> nil
+ *
+ *  Sets the soft limit on the bytes the interpreter allocates. Once it
+ *  is crossed, the next object allocation runs a full GC.
  */
 
+static mrb_value
+gc_memory_soft_limit_set(mrb_state *mrb, mrb_value obj)
+{
+  size_t limit = gc_memory_limit_arg(mrb);
+
+  mrb->memory.soft_limit = limit;
+  mrb->memory_soft_next = limit;
+  if (limit > 0 && mrb->memory.bytes > limit) {
+    mrb->memory_gc_pending = TRUE;
+  }
+  return mrb_nil_value();
+}
+
 void
-mrb_write_barrier(mrb_state *mrb, struct RBasic *obj)
+mrb_gc_step_budget_set(mrb_state *mrb, uint32_t usec)
 {
-  if (!is_black(obj)) return;
+  mrb->gc_step_budget_us = usec;
+}
 
-  mrb_assert(!is_dead(mrb, obj));
-  mrb_assert(is_generational(mrb) || mrb->gc_state != GC_STATE_NONE);
-  paint_gray(obj);
-  obj->gcnext = mrb->atomic_gray_list;
-  mrb->atomic_gray_list = obj;
+/*
+ *  call-seq:
+ *     GC.step_budget_us    -> fixnum
+ *
+ *  Returns the wall clock budget of an incremental GC step in
+ *  microseconds. 0 (the default) means steps are sized by step_ratio.
+ *
+ */
+
+static mrb_value
+gc_step_budget_get(mrb_state *mrb, mrb_value obj)
+{
+  return mrb_fixnum_value((mrb_int)mrb->gc_step_budget_us);
 }
 
 /*
  *  call-seq:
- *     GC.start                     -> nil
+ *     GC.step_budget_us = fixnum   -> nil
  *
- *  Initiates full garbage collection.
+ *  Makes each incremental GC step run for about the given number of
+ *  microseconds instead of a number of objects. Root scanning and the
+ *  final marking are atomic and may still take longer. The final marking
+ *  drains the atomic gray list, which holds every object written to
+ *  between steps, and is not bounded by the budget; large containers
+ *  written to between steps can make it take far longer than a step.
+ *  0 switches back to step_ratio.
  *
  */
 
 static mrb_value
-gc_start(mrb_state *mrb, mrb_value obj)
+gc_step_budget_set(mrb_state *mrb, mrb_value obj)
 {
-  mrb_full_gc(mrb);
+  mrb_int usec;
+
+  mrb_get_args(mrb, "i", &usec);
+  if (usec < 0) {
+    mrb_raise(mrb, E_ARGUMENT_ERROR, "step budget must not be negative");
+  }
+  mrb_gc_step_budget_set(mrb, (uint32_t)usec);
   return mrb_nil_value();
 }
 
+/*
+  Make room for n more objects in one go: the heap grows to hold the
+  live objects plus n, keeps at least that many pages when sweeping,
+  and no GC cycle starts until the live objects outgrow them. A cycle
+  already in progress still runs. mrb_gc_reserve(mrb, 0) releases the
+  reservation. The pages hold one-RVALUE slots; objects taking wider
+  slots (small arrays) still add pages of their own.
+*/
+void
+mrb_gc_reserve(mrb_state *mrb, size_t n)
+{
+  size_t pages = (mrb->live + n + MRB_HEAP_PAGE_SIZE - 1) / MRB_HEAP_PAGE_SIZE;
+
+  if (n == 0) {
+    mrb->gc_heap_min_pages = 0;
+    return;
+  }
+  if (mrb->gc_stat.heap_pages < pages) {
+    add_heap(mrb, pages - mrb->gc_stat.heap_pages, 0);
+  }
+  mrb->gc_heap_min_pages = pages;
+  if (mrb->gc_state == GC_STATE_NONE) {
+    gc_threshold_reserve(mrb);
+  }
+}
+
 /*
  *  call-seq:
- *     GC.enable    -> true or false
+ *     GC.reserve(n)    -> nil
  *
- *  Enables garbage collection, returning <code>true</code> if garbage
- *  collection was previously disabled.
+ *  Preallocates heap pages for n more objects and holds off garbage
+ *  collection until they are used up, so that loading a large data set
+ *  does not run a cycle each time the heap doubles. The pages stay
+ *  reserved until GC.reserve(0).
  *
- *     GC.disable   #=> false
- *     GC.enable    #=> true
- *     GC.enable    #=> false
+ *     GC.reserve(1_000_000)
+ *     records = load_records
  *
  */
 
 static mrb_value
-gc_enable(mrb_state *mrb, mrb_value obj)
+gc_reserve(mrb_state *mrb, mrb_value obj)
 {
-  int old = mrb->gc_disabled;
+  mrb_int n;
 
-  mrb->gc_disabled = FALSE;
+  mrb_get_args(mrb, "i", &n);
+  if (n < 0) {
+    mrb_raise(mrb, E_ARGUMENT_ERROR, "negative object count");
+  }
+  mrb_gc_reserve(mrb, (size_t)n);
+  return mrb_nil_value();
+}
 
-  return mrb_bool_value(old);
+/*
+ *  call-seq:
+ *     GC.heap_growth_ratio    -> fixnum
+ *
+ *  Returns the percentage of its pages the heap grows by when it runs
+ *  out of object slots. Pages of each slot width grow on their own.
+ *  0 (the default) adds one page at a time.
+ *
+ */
+
+static mrb_value
+gc_heap_growth_ratio_get(mrb_state *mrb, mrb_value obj)
+{
+  return mrb_fixnum_value(mrb->gc_heap_growth_ratio);
 }
 
 /*
  *  call-seq:
- *     GC.disable    -> true or false
+ *     GC.heap_growth_ratio = fixnum    -> nil
  *
- *  Disables garbage collection, returning <code>true</code> if garbage
- *  collection was already disabled.
+ *  Sets the percentage of its pages the heap grows by. The pages added
+ *  at once are allocated as one block, and no collection starts until
+ *  they are filled.
  *
- *     GC.disable   #=> false
- *     GC.disable   #=> true
+ *     GC.heap_growth_ratio = 80
  *
  */
 
 static mrb_value
-gc_disable(mrb_state *mrb, mrb_value obj)
+gc_heap_growth_ratio_set(mrb_state *mrb, mrb_value obj)
 {
-  int old = mrb->gc_disabled;
+  mrb_int ratio;
 
-  mrb->gc_disabled = TRUE;
+  mrb_get_args(mrb, "i", &ratio);
+  if (ratio < 0 || ratio > 1000) {
+    mrb_raise(mrb, E_ARGUMENT_ERROR, "heap growth ratio must be between 0 and 1000");
+  }
+  mrb->gc_heap_growth_ratio = (int)ratio;
+  return mrb_nil_value();
+}
 
-  return mrb_bool_value(old);
+/*
+ *  call-seq:
+ *     GC.lazy_sweep    -> true or false
+ *
+ *  Returns whether dead objects are swept on the allocation path instead
+ *  of as part of a collection.
+ *
+ */
+
+static mrb_value
+gc_lazy_sweep_get(mrb_state *mrb, mrb_value obj)
+{
+  return mrb_bool_value(mrb->gc_lazy_sweep);
 }
 
 /*
  *  call-seq:
- *     GC.interval_ratio      -> fixnum
+ *     GC.lazy_sweep = true or false   -> true or false
  *
- *  Returns ratio of GC interval. Default value is 200(%).
+ *  With lazy sweeping a collection ends after marking; heap pages are
+ *  swept one at a time when objects are allocated.
  *
  */
 
 static mrb_value
-gc_interval_ratio_get(mrb_state *mrb, mrb_value obj)
+gc_lazy_sweep_set(mrb_state *mrb, mrb_value obj)
 {
-  return mrb_fixnum_value(mrb->gc_interval_ratio);
+  mrb_bool enable;
+
+  mrb_get_args(mrb, "b", &enable);
+  if (!enable) gc_finish_sweep(mrb);
+  mrb->gc_lazy_sweep = enable;
+  return mrb_bool_value(enable);
 }
 
 /*
  *  call-seq:
- *     GC.interval_ratio = fixnum    -> nil
+ *     GC.pause_stats    -> hash
  *
- *  Updates ratio of GC interval. Default value is 200(%).
- *  GC start as soon as after end all step of GC if you set 100(%).
+ *  Returns the number of GC pauses so far and their 50th, 90th, 99th and
+ *  99.9th percentiles and maximum in microseconds.
+ *
+ *     GC.pause_stats  #=> {:count=>52, :p50=>95, :p90=>207, :p99=>415, :p999=>415, :max=>402}
  *
  */
 
 static mrb_value
-gc_interval_ratio_set(mrb_state *mrb, mrb_value obj)
+gc_pause_stats(mrb_state *mrb, mrb_value obj)
 {
-  mrb_int ratio;
+  static const struct {
+    const char *name;
+    double pct;
+  } pcts[] = {
+    { "p50", 50 }, { "p90", 90 }, { "p99", 99 }, { "p999", 99.9 },
+  };
+  mrb_value h = mrb_hash_new(mrb);
+  size_t i;
 
-  mrb_get_args(mrb, "i", &ratio);
-  mrb->gc_interval_ratio = ratio;
-  return mrb_nil_value();
+  mrb_hash_set(mrb, h, mrb_symbol_value(mrb_intern_lit(mrb, "count")),
+               mrb_fixnum_value((mrb_int)mrb->gc_pause.count));
+  for (i = 0; i < sizeof(pcts)/sizeof(pcts[0]); i++) {
+    mrb_hash_set(mrb, h, mrb_symbol_value(mrb_intern_cstr(mrb, pcts[i].name)),
+                 mrb_fixnum_value((mrb_int)mrb_gc_pause_percentile(mrb, pcts[i].pct)));
+  }
+  mrb_hash_set(mrb, h, mrb_symbol_value(mrb_intern_lit(mrb, "max")),
+               mrb_fixnum_value((mrb_int)mrb->gc_pause.max_us));
+  return h;
+}
+
+void
+mrb_gc_stat(mrb_state *mrb, struct mrb_gc_stat *stat)
+{
+  *stat = mrb->gc_stat;
+  stat->live = mrb->live;
+  stat->free_slots = stat->heap_pages * MRB_HEAP_PAGE_SIZE - mrb->live;
+  stat->majorgc_old_threshold = mrb->majorgc_old_threshold;
+  stat->malloc_increase = mrb->malloc_increase;
+  stat->oldmalloc_increase = mrb->oldmalloc_increase;
+  stat->pause = mrb->gc_pause;
+}
+
+void
+mrb_gc_set_event_func(mrb_state *mrb, mrb_gc_event_func *func, void *ud)
+{
+  mrb->gc_event_func = func;
+  mrb->gc_event_ud = ud;
+}
+
+/*
+  Sampled allocations.  Every interval-th object mrb_obj_alloc() returns
+  is flagged MRB_FLAG_GC_TRACED and reported to func, which also hears
+  when a flagged object is freed or moved.  Clearing the interval stops
+  sampling but keeps reporting the objects sampled so far.
+*/
+void
+mrb_gc_set_obj_event_func(mrb_state *mrb, mrb_obj_event_func *func, void *ud, uint32_t interval)
+{
+  if (func == NULL) interval = 0;
+  mrb->obj_event_func = func;
+  mrb->obj_event_ud = ud;
+  mrb->obj_event_interval = interval;
+  mrb->obj_event_countdown = interval;
+}
+
+/*
+  The instruction an allocation is attributed to: the one running in the
+  innermost Ruby frame.  The VM records it in ci->err around the
+  instructions that allocate; a C function is attributed to the call
+  instruction of its caller.  *pc is NULL when the instruction is not
+  known (an allocation made by the VM outside those instructions).
+*/
+mrb_bool
+mrb_gc_alloc_site(mrb_state *mrb, struct mrb_irep **irep, mrb_code **pc)
+{
+  mrb_callinfo *ci = mrb->c->ci;
+  mrb_code *at = ci->err;
+
+  for (; ci >= mrb->c->cibase; ci--) {
+    if (ci->proc && !MRB_PROC_CFUNC_P(ci->proc)) {
+      struct mrb_irep *ir = ci->proc->body.irep;
+
+      *irep = ir;
+      *pc = (at && ir->iseq <= at && at < ir->iseq + ir->ilen) ? at : NULL;
+      return TRUE;
+    }
+    at = ci->pc ? ci->pc - 1 : NULL;
+  }
+  return FALSE;
+}
+
+static mrb_value
+gc_size_value(mrb_state *mrb, uint64_t n)
+{
+  if (n > MRB_INT_MAX) {
+    return mrb_float_value(mrb, (mrb_float)n);
+  }
+  return mrb_fixnum_value((mrb_int)n);
 }
 
 /*
  *  call-seq:
- *     GC.step_ratio    -> fixnum
+ *     GC.stat          -> hash
+ *     GC.stat(key)     -> fixnum or hash
  *
- *  Returns step span ratio of Incremental GC. Default value is 200(%).
+ *  Returns counters of the collector: completed cycles, minor and major
+ *  cycles, steps per phase, pause times in microseconds (with a
+ *  histogram of upper bound => pauses), heap occupancy in objects, the
+ *  bytes objects own outside their slots (as of the sweep that last
+ *  saw them), the bytes malloc'ed since the last (major) cycle, and the
+ *  bytes held through mrb_malloc() now and at their peak, per kind,
+ *  with the memory limits.
+ *
+ *     GC.stat[:count]   #=> 12
+ *     GC.stat(:live)    #=> 4822
  *
  */
 
 static mrb_value
-gc_step_ratio_get(mrb_state *mrb, mrb_value obj)
+gc_stat(mrb_state *mrb, mrb_value obj)
 {
-  return mrb_fixnum_value(mrb->gc_step_ratio);
+  struct mrb_gc_stat st;
+  struct mrb_memory_stat mst;
+  mrb_value h, hist, key = mrb_nil_value();
+  int i;
+
+  mrb_get_args(mrb, "|o", &key);
+  mrb_gc_stat(mrb, &st);
+  mrb_memory_stat(mrb, &mst);
+  h = mrb_hash_new_capa(mrb, 34);
+#define GC_STAT_SET(name, v) \
+  mrb_hash_set(mrb, h, mrb_symbol_value(mrb_intern_lit(mrb, name)), gc_size_value(mrb, (v)))
+  GC_STAT_SET("count", st.count);
+  GC_STAT_SET("minor_gc_count", st.minor_count);
+  GC_STAT_SET("major_gc_count", st.major_count);
+  GC_STAT_SET("root_scan_count", st.root_scan_count);
+  GC_STAT_SET("mark_count", st.mark_count);
+  GC_STAT_SET("final_mark_count", st.final_mark_count);
+  GC_STAT_SET("sweep_count", st.sweep_count);
+  GC_STAT_SET("pause_count", st.pause.count);
+  GC_STAT_SET("total_pause_us", st.pause.total_us);
+  GC_STAT_SET("max_pause_us", st.pause.max_us);
+  GC_STAT_SET("live", st.live);
+  GC_STAT_SET("heap_pages", st.heap_pages);
+  GC_STAT_SET("free_slots", st.free_slots);
+  GC_STAT_SET("payload_bytes", st.payload_bytes);
+  GC_STAT_SET("promoted", st.promoted);
+  GC_STAT_SET("compact_count", st.compact_count);
+  GC_STAT_SET("moved", st.moved);
+  GC_STAT_SET("region_count", st.region_count);
+  GC_STAT_SET("region_freed", st.region_freed);
+  GC_STAT_SET("card_scans", st.card_scans);
+  GC_STAT_SET("majorgc_old_threshold", st.majorgc_old_threshold);
+  GC_STAT_SET("malloc_increase", st.malloc_increase);
+  GC_STAT_SET("oldmalloc_increase", st.oldmalloc_increase);
+  GC_STAT_SET("memory_bytes", mst.bytes);
+  GC_STAT_SET("memory_peak", mst.peak);
+  GC_STAT_SET("memory_payload_bytes", mst.kind_bytes[MRB_MEMORY_PAYLOAD]);
+  GC_STAT_SET("memory_payload_peak", mst.kind_peak[MRB_MEMORY_PAYLOAD]);
+  GC_STAT_SET("memory_heap_bytes", mst.kind_bytes[MRB_MEMORY_HEAP]);
+  GC_STAT_SET("memory_heap_peak", mst.kind_peak[MRB_MEMORY_HEAP]);
+  GC_STAT_SET("memory_compiler_bytes", mst.kind_bytes[MRB_MEMORY_COMPILER]);
+  GC_STAT_SET("memory_compiler_peak", mst.kind_peak[MRB_MEMORY_COMPILER]);
+  GC_STAT_SET("memory_soft_limit", mst.soft_limit);
+  GC_STAT_SET("memory_limit", mst.hard_limit);
+#undef GC_STAT_SET
+  hist = mrb_hash_new(mrb);
+  for (i = 0; i < MRB_GC_PAUSE_BUCKETS; i++) {
+    if (st.pause.hist[i] > 0) {
+      mrb_hash_set(mrb, hist, gc_size_value(mrb, gc_pause_bucket_max(i)),
+                   gc_size_value(mrb, st.pause.hist[i]));
+    }
+  }
+  mrb_hash_set(mrb, h, mrb_symbol_value(mrb_intern_lit(mrb, "pause_histogram")), hist);
+
+  if (!mrb_nil_p(key)) {
+    return mrb_hash_fetch(mrb, h, key, mrb_nil_value());
+  }
+  return h;
 }
 
 /*
  *  call-seq:
- *     GC.step_ratio = fixnum   -> nil
+ *     GC.compact    -> fixnum or nil
  *
- *  Updates step span ratio of Incremental GC. Default value is 200(%).
- *  1 step of incrementalGC becomes long if a rate is big.
+ *  Runs a full GC and moves objects out of sparsely occupied heap pages
+ *  so that those pages can be released. Returns the number of objects
+ *  moved, or nil when called from a block run by a C function, where
+ *  moving objects isn't safe.
  *
  */
 
 static mrb_value
-gc_step_ratio_set(mrb_state *mrb, mrb_value obj)
+gc_compact(mrb_state *mrb, mrb_value obj)
 {
-  mrb_int ratio;
+  if (!gc_compact_safe_p(mrb)) return mrb_nil_value();
+  return gc_size_value(mrb, mrb_gc_compact(mrb));
+}
 
-  mrb_get_args(mrb, "i", &ratio);
-  mrb->gc_step_ratio = ratio;
+/*
+ *  call-seq:
+ *     GC.region { ... }    -> obj
+ *
+ *  Runs the block with objects allocated into a region (see
+ *  mrb_region_begin()). When the block returns or raises, the objects it
+ *  allocated that nothing outside refers to are freed at once. Returns
+ *  the value of the block.
+ *
+ */
+
+static mrb_value
+gc_region(mrb_state *mrb, mrb_value obj)
+{
+  struct mrb_jmpbuf *prev_jmp = mrb->jmp;
+  struct mrb_jmpbuf c_jmp;
+  mrb_value blk, result = mrb_nil_value();
+
+  mrb_get_args(mrb, "&", &blk);
+  if (mrb_nil_p(blk)) {
+    mrb_raise(mrb, E_ARGUMENT_ERROR, "no block given");
+  }
+  mrb_region_begin(mrb);
+  MRB_TRY(&c_jmp) {
+    mrb->jmp = &c_jmp;
+    result = mrb_yield_argv(mrb, blk, 0, NULL);
+    mrb->jmp = prev_jmp;
+  }
+  MRB_CATCH(&c_jmp) {
+    mrb->jmp = prev_jmp;
+    mrb_region_end(mrb);
+    MRB_THROW(mrb->jmp);
+  }
+  MRB_END_EXC(&c_jmp);
+  mrb_gc_protect(mrb, result);
+  mrb_region_end(mrb);
+  return result;
+}
+
+/*
+ *  call-seq:
+ *     GC.compact_threshold    -> fixnum
+ *
+ *  Returns the percentage of free object slots above which a major GC
+ *  requests a compaction. 0 (the default) disables automatic compaction.
+ *
+ */
+
+static mrb_value
+gc_compact_threshold_get(mrb_state *mrb, mrb_value obj)
+{
+  return mrb_fixnum_value(mrb->gc_compact_threshold);
+}
+
+/*
+ *  call-seq:
+ *     GC.compact_threshold = fixnum    -> nil
+ *
+ *  Sets the percentage of free object slots above which a major GC
+ *  requests a compaction. It then runs at the next point where no C
+ *  function is on the call stack.
+ *
+ *     GC.compact_threshold = 50
+ *
+ */
+
+static mrb_value
+gc_compact_threshold_set(mrb_state *mrb, mrb_value obj)
+{
+  mrb_int pct;
+
+  mrb_get_args(mrb, "i", &pct);
+  if (pct < 0 || pct >= 100) {
+    mrb_raise(mrb, E_ARGUMENT_ERROR, "compact threshold must be between 0 and 99");
+  }
+  mrb->gc_compact_threshold = (int)pct;
+  return mrb_nil_value();
+}
+
+#ifdef MRB_GC_PARALLEL_MARK
+/*
+ *  call-seq:
+ *     GC.mark_threads    -> fixnum
+ *
+ *  Returns the number of threads (including the calling one) that mark
+ *  a full GC.
+ */
+
+static mrb_value
+gc_mark_threads_get(mrb_state *mrb, mrb_value obj)
+{
+  return mrb_fixnum_value(mrb_gc_mark_threads(mrb));
+}
+
+/*
+ *  call-seq:
+ *     GC.mark_threads = fixnum   -> nil
+ *
+ *  Sets the number of threads marking a full GC; 1 marks on the calling
+ *  thread only.
+ */
+
+static mrb_value
+gc_mark_threads_set(mrb_state *mrb, mrb_value obj)
+{
+  mrb_int n;
+
+  mrb_get_args(mrb, "i", &n);
+  if (n < 1 || n > GC_MARK_THREADS_MAX) {
+    mrb_raisef(mrb, E_ARGUMENT_ERROR, "mark threads must be between 1 and %S",
+               mrb_fixnum_value(GC_MARK_THREADS_MAX));
+  }
+  mrb_gc_set_mark_threads(mrb, (int)n);
   return mrb_nil_value();
 }
+#endif
 
 static void
 change_gen_gc_mode(mrb_state *mrb, mrb_int enable)
@@ -1306,7 +4435,13 @@ mrb_objspace_each_objects(mrb_state *mrb, mrb_each_object_callback *callback, vo
 
     p = page->objects;
     pend = p + MRB_HEAP_PAGE_SIZE;
-    for (;p < pend; p++) {
+    /* present the never used slots as free objects */
+    for (; page->bump < MRB_HEAP_PAGE_SIZE; page->bump += page->width) {
+      p[page->bump].as.free.tt = MRB_TT_FREE;
+      p[page->bump].as.free.next = page->freelist;
+      page->freelist = &p[page->bump].as.basic;
+    }
+    for (;p < pend; p += page->width) {
       (*callback)(mrb, &p->as.basic, data);
     }
 
@@ -1314,6 +4449,77 @@ mrb_objspace_each_objects(mrb_state *mrb, mrb_each_object_callback *callback, vo
   }
 }
 
+struct gc_reference_visit {
+  mrb_each_reference_callback *callback;
+  const char *root;
+  void *data;
+};
+
+static void
+gc_reference_visit(mrb_state *mrb, struct RBasic *obj, void *ud)
+{
+  struct gc_reference_visit *v = (struct gc_reference_visit*)ud;
+
+  v->callback(mrb, v->root, obj, v->data);
+}
+
+/*
+  Pass each object obj refers to, as the collector traces it, to
+  callback (with a NULL root).  callback must not allocate objects.
+*/
+void
+mrb_objspace_each_reference(mrb_state *mrb, struct RBasic *obj, mrb_each_reference_callback *callback, void *data)
+{
+  struct gc_reference_visit v;
+
+  v.callback = callback;
+  v.root = NULL;
+  v.data = data;
+  mrb->gc_visit = gc_reference_visit;
+  mrb->gc_visit_ud = &v;
+  gc_visit_children(mrb, obj);
+  mrb->gc_visit = NULL;
+}
+
+/*
+  Pass each object the collector starts marking from to callback, with
+  the kind of root: "globals", "arena", "vm" (the class tree, top self
+  and the pending exception) or "stack" (the VM stacks of the running
+  fibers).  callback must not allocate objects.
+*/
+void
+mrb_objspace_each_root(mrb_state *mrb, mrb_each_reference_callback *callback, void *data)
+{
+  struct gc_reference_visit v;
+  struct mrb_context *c;
+  size_t i;
+
+  v.callback = callback;
+  v.data = data;
+  mrb->gc_visit = gc_reference_visit;
+  mrb->gc_visit_ud = &v;
+  v.root = "globals";
+  mrb_gc_mark_gv(mrb);
+  v.root = "symbols";
+  mrb_gc_mark_symtbl(mrb);
+  v.root = "arena";
+  for (i = 0; i < (size_t)mrb->arena_idx; i++) {
+    mrb_gc_mark(mrb, mrb->arena[i]);
+  }
+  v.root = "vm";
+  mrb_gc_mark(mrb, (struct RBasic*)mrb->object_class);
+  mrb_gc_mark(mrb, (struct RBasic*)mrb->top_self);
+  mrb_gc_mark(mrb, (struct RBasic*)mrb->exc);
+  mrb_gc_mark(mrb, (struct RBasic*)mrb->nomem_err);
+  v.root = "stack";
+  mark_context(mrb, mrb->root_c);
+  mrb_gc_mark(mrb, (struct RBasic*)mrb->root_c->fib);
+  for (c = mrb->c; c && c != mrb->root_c; c = c->prev) {
+    mark_context(mrb, c);
+  }
+  mrb->gc_visit = NULL;
+}
+
 #ifdef GC_TEST
 #ifdef GC_DEBUG
 static mrb_value gc_test(mrb_state *, mrb_value);
@@ -1325,6 +4531,11 @@ mrb_init_gc(mrb_state *mrb)
 {
   struct RClass *gc;
 
+  /* made up front: raising it must not allocate */
+  mrb->nomem_err = mrb_obj_ptr(mrb_exc_new_str_lit(mrb, E_NOMEMORY_ERROR, "failed to allocate memory"));
+  mrb_obj_iv_set(mrb, mrb->nomem_err, mrb_intern_lit(mrb, "ciidx"), mrb_fixnum_value(0));
+  mrb_obj_iv_set(mrb, mrb->nomem_err, mrb_intern_lit(mrb, "lastpc"), mrb_cptr_value(mrb, NULL));
+
   gc = mrb_define_module(mrb, "GC");
 
   mrb_define_class_method(mrb, gc, "start", gc_start, MRB_ARGS_NONE());
@@ -1334,7 +4545,30 @@ mrb_init_gc(mrb_state *mrb)
   mrb_define_class_method(mrb, gc, "interval_ratio=", gc_interval_ratio_set, MRB_ARGS_REQ(1));
   mrb_define_class_method(mrb, gc, "step_ratio", gc_step_ratio_get, MRB_ARGS_NONE());
   mrb_define_class_method(mrb, gc, "step_ratio=", gc_step_ratio_set, MRB_ARGS_REQ(1));
+  mrb_define_class_method(mrb, gc, "malloc_limit", gc_malloc_limit_get, MRB_ARGS_NONE());
+  mrb_define_class_method(mrb, gc, "malloc_limit=", gc_malloc_limit_set, MRB_ARGS_REQ(1));
+  mrb_define_class_method(mrb, gc, "memory_limit", gc_memory_limit_get, MRB_ARGS_NONE());
+  mrb_define_class_method(mrb, gc, "memory_limit=", gc_memory_limit_set, MRB_ARGS_REQ(1));
+  mrb_define_class_method(mrb, gc, "memory_soft_limit", gc_memory_soft_limit_get, MRB_ARGS_NONE());
+  mrb_define_class_method(mrb, gc, "memory_soft_limit=", gc_memory_soft_limit_set, MRB_ARGS_REQ(1));
+  mrb_define_class_method(mrb, gc, "step_budget_us", gc_step_budget_get, MRB_ARGS_NONE());
+  mrb_define_class_method(mrb, gc, "step_budget_us=", gc_step_budget_set, MRB_ARGS_REQ(1));
+  mrb_define_class_method(mrb, gc, "reserve", gc_reserve, MRB_ARGS_REQ(1));
+  mrb_define_class_method(mrb, gc, "heap_growth_ratio", gc_heap_growth_ratio_get, MRB_ARGS_NONE());
+  mrb_define_class_method(mrb, gc, "heap_growth_ratio=", gc_heap_growth_ratio_set, MRB_ARGS_REQ(1));
+  mrb_define_class_method(mrb, gc, "lazy_sweep", gc_lazy_sweep_get, MRB_ARGS_NONE());
+  mrb_define_class_method(mrb, gc, "lazy_sweep=", gc_lazy_sweep_set, MRB_ARGS_REQ(1));
+  mrb_define_class_method(mrb, gc, "pause_stats", gc_pause_stats, MRB_ARGS_NONE());
+  mrb_define_class_method(mrb, gc, "stat", gc_stat, MRB_ARGS_OPT(1));
+  mrb_define_class_method(mrb, gc, "compact", gc_compact, MRB_ARGS_NONE());
+  mrb_define_class_method(mrb, gc, "region", gc_region, MRB_ARGS_BLOCK());
+  mrb_define_class_method(mrb, gc, "compact_threshold", gc_compact_threshold_get, MRB_ARGS_NONE());
+  mrb_define_class_method(mrb, gc, "compact_threshold=", gc_compact_threshold_set, MRB_ARGS_REQ(1));
   mrb_define_class_method(mrb, gc, "generational_mode=", gc_generational_mode_set, MRB_ARGS_REQ(1));
+#ifdef MRB_GC_PARALLEL_MARK
+  mrb_define_class_method(mrb, gc, "mark_threads", gc_mark_threads_get, MRB_ARGS_NONE());
+  mrb_define_class_method(mrb, gc, "mark_threads=", gc_mark_threads_set, MRB_ARGS_REQ(1));
+#endif
   mrb_define_class_method(mrb, gc, "generational_mode", gc_generational_mode_get, MRB_ARGS_NONE());
 #ifdef GC_TEST
 #ifdef GC_DEBUG
@@ -1516,7 +4750,7 @@ test_incremental_gc(void)
   page = mrb->heaps;
   while (page) {
     RVALUE *p = page->objects;
-    RVALUE *e = p + MRB_HEAP_PAGE_SIZE;
+    RVALUE *e = p + page->bump;
     while (p<e) {
       if (is_black(&p->as.basic)) {
         live++;
@@ -1524,7 +4758,7 @@ test_incremental_gc(void)
       if (is_gray(&p->as.basic) && !is_dead(mrb, &p->as.basic)) {
         printf("%p\n", &p->as.basic);
       }
-      p++;
+      p += page->width;
     }
     page = page->next;
     total += MRB_HEAP_PAGE_SIZE;
@@ -1543,6 +4777,7 @@ test_incremental_gc(void)
    freed++;
    free = (RVALUE*)free->as.free.next;
   }
+  freed += MRB_HEAP_PAGE_SIZE - mrb->heaps->bump;
 
   mrb_assert(mrb->live == live);
   mrb_assert(mrb->live == total-freed);
@@ -1579,15 +4814,15 @@ test_incremental_sweep_phase(void)
 
   puts("test_incremental_sweep_phase");
 
-  add_heap(mrb);
+  add_heap(mrb, 1, 0);
   mrb->sweeps = mrb->heaps;
 
   mrb_assert(mrb->heaps->next->next == NULL);
-  mrb_assert(mrb->free_heaps->next->next == NULL);
+  mrb_assert(mrb->free_heaps[0]->next->next == NULL);
   incremental_sweep_phase(mrb, MRB_HEAP_PAGE_SIZE*3);
 
   mrb_assert(mrb->heaps->next == NULL);
-  mrb_assert(mrb->heaps == mrb->free_heaps);
+  mrb_assert(mrb->heaps == mrb->free_heaps[0]);
 
   mrb_close(mrb);
 }
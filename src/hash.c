@@ -7,6 +7,7 @@
 #include "mruby.h"
 #include "mruby/array.h"
 #include "mruby/class.h"
+#include "mruby/gc.h"
 #include "mruby/hash.h"
 #include "mruby/khash.h"
 #include "mruby/string.h"
@@ -130,6 +131,38 @@ mrb_gc_mark_hash(mrb_state *mrb, struct RHash *hash)
   }
 }
 
+/* mark the entries in buckets [beg, end) */
+void
+mrb_gc_mark_hash_slots(mrb_state *mrb, struct RHash *hash, size_t beg, size_t end)
+{
+  khash_t(ht) *h = hash->ht;
+
+  if (!h) return;
+  if (end > kh_end(h)) end = kh_end(h);
+  for (; beg < end; beg++) {
+    if (kh_exist(h, beg)) {
+      mrb_gc_mark_value(mrb, kh_key(h, beg));
+      mrb_gc_mark_value(mrb, kh_value(h, beg).v);
+    }
+  }
+}
+
+/* keys hashed by identity are pinned (see mrb_obj_id), so no rehash is needed */
+void
+mrb_gc_update_hash(mrb_state *mrb, struct RHash *hash)
+{
+  khiter_t k;
+  khash_t(ht) *h = hash->ht;
+
+  if (!h) return;
+  for (k = kh_begin(h); k != kh_end(h); k++) {
+    if (kh_exist(h, k)) {
+      kh_key(h, k) = mrb_gc_location(mrb, kh_key(h, k));
+      kh_value(h, k).v = mrb_gc_location(mrb, kh_value(h, k).v);
+    }
+  }
+}
+
 size_t
 mrb_gc_mark_hash_size(mrb_state *mrb, struct RHash *hash)
 {
@@ -137,6 +170,12 @@ mrb_gc_mark_hash_size(mrb_state *mrb, struct RHash *hash)
   return kh_size(hash->ht)*2;
 }
 
+size_t
+mrb_gc_hash_memsize(mrb_state *mrb, struct RHash *hash)
+{
+  return kh_memsize(hash->ht);
+}
+
 void
 mrb_gc_free_hash(mrb_state *mrb, struct RHash *hash)
 {
@@ -204,14 +243,20 @@ mrb_hash_set(mrb_state *mrb, mrb_value hash, mrb_value key, mrb_value val)
 {
   khash_t(ht) *h;
   khiter_t k;
+  khint_t n_buckets;
   int r;
 
   mrb_hash_modify(mrb, hash);
   h = RHASH_TBL(hash);
 
   if (!h) h = RHASH_TBL(hash) = kh_init(ht, mrb);
+  n_buckets = kh_n_buckets(h);
   k = kh_put2(ht, mrb, h, key, &r);
   kh_value(h, k).v = val;
+  if (kh_n_buckets(h) != n_buckets) {
+    /* rehashed; entries changed buckets */
+    mrb_write_barrier_moved(mrb, (struct RBasic*)RHASH(hash));
+  }
 
   if (r != 0) {
     /* expand */
@@ -219,9 +264,10 @@ mrb_hash_set(mrb_state *mrb, mrb_value hash, mrb_value key, mrb_value val)
     kh_key(h, k) = KEY(key);
     mrb_gc_arena_restore(mrb, ai);
     kh_value(h, k).n = kh_size(h)-1;
+    mrb_field_write_barrier_slot_value(mrb, (struct RBasic*)RHASH(hash), k, kh_n_buckets(h), kh_key(h, k));
   }
 
-  mrb_field_write_barrier_value(mrb, (struct RBasic*)RHASH(hash), val);
+  mrb_field_write_barrier_slot_value(mrb, (struct RBasic*)RHASH(hash), k, kh_n_buckets(h), val);
   return;
 }
 
@@ -8,6 +8,7 @@
 #include <limits.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "mruby.h"
 #include "mruby/array.h"
@@ -18,12 +19,8 @@
 #define floor(f) floorf(f)
 #define ceil(f) ceilf(f)
 #define fmod(x,y) fmodf(x,y)
-#define FLO_MAX_DIGITS 7
-#define FLO_MAX_SIGN_LENGTH 3
 #define FLO_EPSILON FLT_EPSILON
 #else
-#define FLO_MAX_DIGITS 14
-#define FLO_MAX_SIGN_LENGTH 10
 #define FLO_EPSILON DBL_EPSILON
 #endif
 
@@ -36,11 +33,75 @@ mrb_to_flo(mrb_state *mrb, mrb_value val)
   case MRB_TT_FLOAT:
     break;
   default:
+    if (mrb->bignum_class && mrb_obj_is_kind_of(mrb, val, mrb->bignum_class)) {
+      return mrb_float(mrb_funcall(mrb, val, "to_f", 0));
+    }
     mrb_raise(mrb, E_TYPE_ERROR, "non float value");
   }
   return mrb_float(val);
 }
 
+/*
+ * Called when Fixnum arithmetic (op is '+', '-' or '*') overflows.
+ * Returns a Float unless a handler (e.g. mruby-bignum) is installed.
+ */
+mrb_value
+mrb_int_overflow(mrb_state *mrb, int op, mrb_int x, mrb_int y)
+{
+  if (mrb->int_overflow) {
+    return mrb->int_overflow(mrb, op, x, y);
+  }
+  switch (op) {
+  case '+':
+    return mrb_float_value(mrb, (mrb_float)x + (mrb_float)y);
+  case '-':
+    return mrb_float_value(mrb, (mrb_float)x - (mrb_float)y);
+  default:
+    return mrb_float_value(mrb, (mrb_float)x * (mrb_float)y);
+  }
+}
+
+static int
+digit_value(char c)
+{
+  if ('0' <= c && c <= '9') return c - '0';
+  if ('a' <= c && c <= 'z') return c - 'a' + 10;
+  if ('A' <= c && c <= 'Z') return c - 'A' + 10;
+  return 36;
+}
+
+/*
+ * The Integer written with the digits from p to end in base, for one
+ * too large for a Fixnum; underscores are skipped. Base 0 reads the
+ * magnitude in little endian bytes instead, the form codegen.c puts in
+ * the pool. It is a Bignum when a reader is installed and a Float
+ * otherwise.
+ */
+mrb_value
+mrb_int_read_big(mrb_state *mrb, const char *p, const char *end, int base, mrb_bool neg)
+{
+  mrb_float f = 0;
+
+  if (mrb->int_read) {
+    return mrb->int_read(mrb, p, end, base, neg);
+  }
+  if (base == 0) {
+    while (end > p) {
+      f = f * 256 + (unsigned char)*--end;
+    }
+  }
+  else {
+    for (; p < end; p++) {
+      int c = digit_value(*p);
+
+      if (*p == '_') continue;
+      if (c >= base) break;
+      f = f * base + c;
+    }
+  }
+  return mrb_float_value(mrb, neg ? -f : f);
+}
+
 /*
  * call-seq:
  *
@@ -108,140 +169,94 @@ num_div(mrb_state *mrb, mrb_value x)
  *  representation.
  */
 
+#ifdef MRB_USE_FLOAT
+#define FLO_TO_STR_FIXED_MAX FLT_DIG
+#else
+#define FLO_TO_STR_FIXED_MAX DBL_DIG
+#endif
+
 static mrb_value
 mrb_flo_to_str(mrb_state *mrb, mrb_float flo)
 {
-  double n = (double)flo;
-  int max_digits = FLO_MAX_DIGITS;
+  char digits[MRB_FLO_SHORTEST_MAX];
+  char s[MRB_FLO_SHORTEST_MAX + 32];
+  char *c = s;
+  int len, decpt;
 
-  if (isnan(n)) {
+  if (isnan(flo)) {
     return mrb_str_new_lit(mrb, "NaN");
   }
-  else if (isinf(n)) {
-    if (n < 0) {
+  if (isinf(flo)) {
+    if (flo < 0) {
       return mrb_str_new_lit(mrb, "-inf");
     }
-    else {
-      return mrb_str_new_lit(mrb, "inf");
-    }
+    return mrb_str_new_lit(mrb, "inf");
+  }
+  if (signbit(flo)) {
+    *c++ = '-';
+  }
+  if (flo == 0.0) {
+    memcpy(c, "0.0", 3);
+    return mrb_str_new(mrb, s, c + 3 - s);
   }
-  else {
-    int digit;
-    int m = 0;
-    int exp;
-    mrb_bool e = FALSE;
-    char s[48];
-    char *c = &s[0];
-    int length = 0;
-
-    if (signbit(n)) {
-      n = -n;
-      *(c++) = '-';
-    }
 
-    if (n != 0.0) {
-      if (n > 1.0) {
-        exp = (int)floor(log10(n));
-      }
-      else {
-        exp = (int)-ceil(-log10(n));
-      }
+  /* shortest digits that read back as the same value */
+  len = mrb_flo_shortest(flo, digits, &decpt);
+  /* a fraction part allows one more integer digit before switching */
+  if (decpt < -3 || decpt > FLO_TO_STR_FIXED_MAX + (len > decpt)) {
+    /* exponent representation: d.ddde+XX */
+    int exp = decpt - 1;
+    char *e;
+
+    *c++ = digits[0];
+    *c++ = '.';
+    if (len > 1) {
+      memcpy(c, digits + 1, len - 1);
+      c += len - 1;
     }
     else {
-      exp = 0;
+      *c++ = '0';
     }
-
-    /* preserve significands */
+    *c++ = 'e';
     if (exp < 0) {
-      int i, beg = -1, end = 0;
-      double f = n;
-      double fd = 0;
-      for (i = 0; i < FLO_MAX_DIGITS; ++i) {
-        f = (f - fd) * 10.0;
-        fd = floor(f + FLO_EPSILON);
-        if (fd != 0) {
-          if (beg < 0) beg = i;
-          end = i + 1;
-        }
-      }
-      if (beg >= 0) length = end - beg;
-      if (length > FLO_MAX_SIGN_LENGTH) length = FLO_MAX_SIGN_LENGTH;
-    }
-
-    if (abs(exp) + length >= FLO_MAX_DIGITS) {
-      /* exponent representation */
-      e = TRUE;
-      n = n / pow(10.0, exp);
-      if (isinf(n)) {
-        if (s < c) {            /* s[0] == '-' */
-          return mrb_str_new_lit(mrb, "-0.0");
-        }
-        else {
-          return mrb_str_new_lit(mrb, "0.0");
-        }
-      }
+      *c++ = '-';
+      exp = -exp;
     }
     else {
-      /* un-exponent (normal) representation */
-      if (exp > 0) {
-        m = exp;
-      }
+      *c++ = '+';
     }
-
-    /* puts digits */
-    while (max_digits >= 0) {
-      double weight = pow(10.0, m);
-      double fdigit = n / weight;
-
-      if (fdigit < 0) fdigit = n = 0;
-      if (m < -1 && fdigit < FLO_EPSILON) {
-        if (e || exp > 0 || m <= -abs(exp)) {
-          break;
-        }
-      }
-      digit = (int)floor(fdigit + FLO_EPSILON);
-      if (m == 0 && digit > 9) {
-        n /= 10.0;
-        exp++;
-        continue;
-      }
-      *(c++) = '0' + digit;
-      n -= (digit * weight);
-      max_digits--;
-      if (m-- == 0) {
-        *(c++) = '.';
-      }
-    }
-    if (c[-1] == '0') {
-      while (&s[0] < c && c[-1] == '0') {
-        c--;
-      }
-      c++;
-    }
-
-    if (e) {
-      *(c++) = 'e';
-      if (exp > 0) {
-        *(c++) = '+';
-      }
-      else {
-        *(c++) = '-';
-        exp = -exp;
-      }
-
-      if (exp >= 100) {
-        *(c++) = '0' + exp / 100;
-        exp -= exp / 100 * 100;
-      }
-
-      *(c++) = '0' + exp / 10;
-      *(c++) = '0' + exp % 10;
-    }
-
-    *c = '\0';
-
-    return mrb_str_new(mrb, &s[0], c - &s[0]);
+    if (exp < 10) *c++ = '0';
+    e = mrb_uint_to_dec(s + sizeof(s), (uint64_t)exp);
+    memmove(c, e, s + sizeof(s) - e);
+    c += s + sizeof(s) - e;
+  }
+  else if (decpt <= 0) {
+    /* 0.000ddd */
+    *c++ = '0';
+    *c++ = '.';
+    memset(c, '0', -decpt);
+    c += -decpt;
+    memcpy(c, digits, len);
+    c += len;
+  }
+  else if (decpt >= len) {
+    /* ddd000.0 */
+    memcpy(c, digits, len);
+    c += len;
+    memset(c, '0', decpt - len);
+    c += decpt - len;
+    *c++ = '.';
+    *c++ = '0';
+  }
+  else {
+    /* ddd.ddd */
+    memcpy(c, digits, decpt);
+    c += decpt;
+    *c++ = '.';
+    memcpy(c, digits + decpt, len - decpt);
+    c += len - decpt;
   }
+  return mrb_str_new(mrb, s, c - s);
 }
 
 /* 15.2.9.3.16(x) */
@@ -704,9 +719,8 @@ mrb_fixnum_mul(mrb_state *mrb, mrb_value x, mrb_value y)
     b = mrb_fixnum(y);
     if (FIT_SQRT_INT(a) && FIT_SQRT_INT(b))
       return mrb_fixnum_value(a*b);
-    c = a * b;
-    if (a != 0 && c/a != b) {
-      return mrb_float_value(mrb, (mrb_float)a*(mrb_float)b);
+    if (mrb_int_mul_overflow(a, b, &c)) {
+      return mrb_int_overflow(mrb, '*', a, b);
     }
     return mrb_fixnum_value(c);
   }
@@ -1110,7 +1124,7 @@ mrb_fixnum_plus(mrb_state *mrb, mrb_value x, mrb_value y)
     if (a == 0) return y;
     b = mrb_fixnum(y);
     if (mrb_int_add_overflow(a, b, &c)) {
-      return mrb_float_value(mrb, (mrb_float)a + (mrb_float)b);
+      return mrb_int_overflow(mrb, '+', a, b);
     }
     return mrb_fixnum_value(c);
   }
@@ -1146,7 +1160,7 @@ mrb_fixnum_minus(mrb_state *mrb, mrb_value x, mrb_value y)
 
     b = mrb_fixnum(y);
     if (mrb_int_sub_overflow(a, b, &c)) {
-      return mrb_float_value(mrb, (mrb_float)a - (mrb_float)b);
+      return mrb_int_overflow(mrb, '-', a, b);
     }
     return mrb_fixnum_value(c);
   }
@@ -1184,7 +1198,17 @@ mrb_fixnum_to_str(mrb_state *mrb, mrb_value x, int base)
     mrb_raisef(mrb, E_ARGUMENT_ERROR, "invalid radix %S", mrb_fixnum_value(base));
   }
 
-  if (val == 0) {
+  if (base == 10) {
+    /* two digits at a time */
+    if (val < 0) {
+      b = mrb_uint_to_dec(b, (uint64_t)-(val + 1) + 1);
+      *--b = '-';
+    }
+    else {
+      b = mrb_uint_to_dec(b, (uint64_t)val);
+    }
+  }
+  else if (val == 0) {
     *--b = '0';
   }
   else if (val < 0) {
@@ -1255,6 +1279,12 @@ num_cmp(mrb_state *mrb, mrb_value self)
     y = mrb_float(other);
     break;
   default:
+    if (mrb->bignum_class && mrb_obj_is_kind_of(mrb, other, mrb->bignum_class)) {
+      mrb_value c = mrb_funcall(mrb, other, "<=>", 1, self);
+
+      if (!mrb_fixnum_p(c)) return c;
+      return mrb_fixnum_value(-mrb_fixnum(c));
+    }
     return mrb_nil_value();
   }
   if (x > y)
@@ -25,6 +25,7 @@
 #include "mruby/compile.h"
 #include "mruby/proc.h"
 #include "mruby/error.h"
+#include "mruby/numeric.h"
 #include "node.h"
 #include "mrb_throw.h"
 
@@ -4742,7 +4743,7 @@ parser_yylex(parser_state *p)
       char *endp;
 
       errno = 0;
-      d = strtod(tok(p), &endp);
+      d = mrb_float_read(p->mrb, tok(p), &endp, FALSE);
       if (d == 0 && endp == tok(p)) {
         yywarning_s(p, "corrupted float value %s", tok(p));
       }
@@ -38,6 +38,7 @@ struct mrb_pool {
 #ifdef TEST_POOL
 
 #define mrb_malloc_simple(m,s) malloc(s)
+#define mrb_malloc_kind(m,s,k) malloc(s)
 #define mrb_free(m,p) free(p)
 #endif
 
@@ -50,7 +51,7 @@ struct mrb_pool {
 mrb_pool*
 mrb_pool_open(mrb_state *mrb)
 {
-  mrb_pool *pool = (mrb_pool *)mrb_malloc_simple(mrb, sizeof(mrb_pool));
+  mrb_pool *pool = (mrb_pool *)mrb_malloc_kind(mrb, sizeof(mrb_pool), MRB_MEMORY_COMPILER);
 
   if (pool) {
     pool->mrb = mrb;
@@ -82,7 +83,7 @@ page_alloc(mrb_pool *pool, size_t len)
 
   if (len < POOL_PAGE_SIZE)
     len = POOL_PAGE_SIZE;
-  page = (struct mrb_pool_page *)mrb_malloc_simple(pool->mrb, sizeof(struct mrb_pool_page)+len);
+  page = (struct mrb_pool_page *)mrb_malloc_kind(pool->mrb, sizeof(struct mrb_pool_page)+len, MRB_MEMORY_COMPILER);
   if (page) {
     page->offset = 0;
     page->len = len;
@@ -41,7 +41,7 @@ closure_setup(mrb_state *mrb, struct RProc *p, int nlocals)
 
   if (!mrb->c->ci->env) {
     e = (struct REnv*)mrb_obj_alloc(mrb, MRB_TT_ENV, (struct RClass*)mrb->c->ci->proc->env);
-    MRB_ENV_STACK_LEN(e)= (unsigned int)nlocals;
+    MRB_ENV_SET_STACK_LEN(e, nlocals);
     e->mid = mrb->c->ci->mid;
     e->cioff = mrb->c->ci - mrb->c->cibase;
     e->stack = mrb->c->stack;
@@ -87,7 +87,7 @@ mrb_closure_new_cfunc(mrb_state *mrb, mrb_func_t func, int nlocals)
 void
 mrb_proc_copy(struct RProc *a, struct RProc *b)
 {
-  a->flags = b->flags;
+  a->flags = (a->flags & MRB_FLAG_GC_MASK) | (b->flags & ~MRB_FLAG_GC_MASK);
   a->body = b->body;
   if (!MRB_PROC_CFUNC_P(a)) {
     a->body.irep->refcnt++;
@@ -138,7 +138,7 @@ mrb_irep_free(mrb_state *mrb, mrb_irep *irep)
       mrb_free(mrb, mrb_obj_ptr(irep->pool[i]));
     }
 #ifdef MRB_WORD_BOXING
-    else if (mrb_type(irep->pool[i]) == MRB_TT_FLOAT) {
+    else if (mrb_type(irep->pool[i]) == MRB_TT_FLOAT && !mrb_flonum_p(irep->pool[i])) {
       mrb_free(mrb, mrb_obj_ptr(irep->pool[i]));
     }
 #endif
@@ -167,6 +167,7 @@ mrb_str_pool(mrb_state *mrb, mrb_value str)
   ns = (struct RString *)mrb_malloc(mrb, sizeof(struct RString));
   ns->tt = MRB_TT_STRING;
   ns->c = mrb->string_class;
+  ns->color = MRB_GC_GRAY;       /* outside the heap; never marked */
 
   if (s->flags & MRB_STR_NOFREE) {
     ns->flags = MRB_STR_NOFREE;
@@ -232,7 +233,8 @@ mrb_close(mrb_state *mrb)
 #ifndef MRB_GC_FIXED_ARENA
   mrb_free(mrb, mrb->arena);
 #endif
-  mrb_free(mrb, mrb);
+  /* allocated by mrb_open_allocf() without an accounting header */
+  (mrb->allocf)(mrb, mrb, 0, mrb->ud);
 }
 
 mrb_irep*
@@ -13,6 +13,7 @@
 #include "mruby.h"
 #include "mruby/array.h"
 #include "mruby/class.h"
+#include "mruby/numeric.h"
 #include "mruby/range.h"
 #include "mruby/string.h"
 #include "mruby/re.h"
@@ -320,7 +321,7 @@ mrb_str_new_static(mrb_state *mrb, const char *p, size_t len)
   s->as.heap.len = len;
   s->as.heap.aux.capa = 0;             /* nofree */
   s->as.heap.ptr = (char *)p;
-  s->flags = MRB_STR_NOFREE;
+  s->flags |= MRB_STR_NOFREE;
   return mrb_obj_value(s);
 }
 
@@ -1842,6 +1843,11 @@ mrb_str_split_m(mrb_state *mrb, mrb_value str)
 
   result = mrb_ary_new(mrb);
   beg = 0;
+  /* mrb_str_subseq() shrinks an unshared buffer when sharing it, which
+     would leave the scan pointers below dangling */
+  if (!STR_EMBED_P(mrb_str_ptr(str))) {
+    str_make_shared(mrb, mrb_str_ptr(str));
+  }
   if (split_type == awk) {
     char *ptr = RSTRING_PTR(str);
     char *eptr = RSTRING_END(str);
@@ -1926,23 +1932,13 @@ mrb_str_split_m(mrb_state *mrb, mrb_value str)
   return result;
 }
 
-mrb_value
-mrb_cstr_to_inum(mrb_state *mrb, const char *str, int base, int badcheck)
+static mrb_value
+str_to_inum(mrb_state *mrb, const char *str, const char *end, int base, int badcheck)
 {
   const char *p;
   char sign = 1;
-  int c, uscore;
-  unsigned long n = 0;
-  mrb_int val;
-
-#undef ISDIGIT
-#define ISDIGIT(c) ('0' <= (c) && (c) <= '9')
-#define conv_digit(c) \
-    (!ISASCII(c) ? -1 : \
-     isdigit(c) ? ((c) - '0') : \
-     islower(c) ? ((c) - 'a' + 10) : \
-     isupper(c) ? ((c) - 'A' + 10) : \
-     -1)
+  uint64_t n;
+  mrb_bool overflow;
 
   if (!str) {
     if (badcheck) goto bad;
@@ -2018,61 +2014,38 @@ mrb_cstr_to_inum(mrb_state *mrb, const char *str, int base, int badcheck)
       }
       break;
   } /* end of switch (base) { */
-  if (*str == '0') {    /* squeeze preceeding 0s */
-    uscore = 0;
-    while ((c = *++str) == '0' || c == '_') {
-      if (c == '_') {
-        if (++uscore >= 2)
-          break;
-      }
-      else
-        uscore = 0;
-    }
-    if (!(c = *str) || ISSPACE(c)) --str;
-  }
-  c = *str;
-  c = conv_digit(c);
-  if (c < 0 || c >= base) {
+
+  p = mrb_uint_read(str, end, base, TRUE, &n, &overflow);
+  if (p == str) {     /* no number */
     if (badcheck) goto bad;
     return mrb_fixnum_value(0);
   }
+  if (badcheck) {
+    const char *t = p;
 
-  uscore = 0;
-  for (p=str;*p;p++) {
-    if (*p == '_') {
-      if (uscore == 0) {
-        uscore++;
-        continue;
-      }
-      if (badcheck) goto bad;
-      break;
-    }
-    uscore = 0;
-    c = conv_digit(*p);
-    if (c < 0 || c >= base) {
-      if (badcheck) goto bad;
-      break;
-    }
-    n *= base;
-    n += c;
+    while (*t && ISSPACE(*t)) t++;
+    if (*t) goto bad;           /* trailing garbage */
   }
-  if (n > MRB_INT_MAX) {
+  if (overflow || n > (uint64_t)MRB_FIXNUM_MAX + !sign) {
+    if (mrb->int_read) {
+      return mrb_int_read_big(mrb, str, p, base, !sign);
+    }
     mrb_raisef(mrb, E_ARGUMENT_ERROR, "string (%S) too big for integer", mrb_str_new_cstr(mrb, str));
   }
-  val = n;
-  if (badcheck) {
-    if (p == str) goto bad; /* no number */
-    while (*p && ISSPACE(*p)) p++;
-    if (*p) goto bad;           /* trailing garbage */
-  }
 
-  return mrb_fixnum_value(sign ? val : -val);
+  return mrb_fixnum_value(sign ? (mrb_int)n : n == 0 ? 0 : -(mrb_int)(n - 1) - 1);
 bad:
   mrb_raisef(mrb, E_ARGUMENT_ERROR, "invalid string for number(%S)", mrb_str_new_cstr(mrb, str));
   /* not reached */
   return mrb_fixnum_value(0);
 }
 
+mrb_value
+mrb_cstr_to_inum(mrb_state *mrb, const char *str, int base, int badcheck)
+{
+  return str_to_inum(mrb, str, str ? str + strlen(str) : NULL, base, badcheck);
+}
+
 char *
 mrb_string_value_cstr(mrb_state *mrb, mrb_value *ptr)
 {
@@ -2100,14 +2073,15 @@ mrb_str_to_inum(mrb_state *mrb, mrb_value str, mrb_int base, mrb_bool badcheck)
   else {
     s = RSTRING_PTR(str);
   }
-  if (s) {
-    len = RSTRING_LEN(str);
-    if (s[len]) {    /* no sentinel somehow */
-      struct RString *temp_str = str_new(mrb, s, len);
-      s = STR_PTR(temp_str);
-    }
+  if (!s) {
+    return mrb_cstr_to_inum(mrb, s, base, badcheck);
+  }
+  len = RSTRING_LEN(str);
+  if (s[len]) {    /* no sentinel somehow */
+    struct RString *temp_str = str_new(mrb, s, len);
+    s = STR_PTR(temp_str);
   }
-  return mrb_cstr_to_inum(mrb, s, base, badcheck);
+  return str_to_inum(mrb, s, s + len, base, badcheck);
 }
 
 /* 15.2.10.5.38 */
@@ -2149,64 +2123,38 @@ mrb_cstr_to_dbl(mrb_state *mrb, const char * p, mrb_bool badcheck)
   char *end;
   double d;
 
-  enum {max_width = 20};
-#define OutOfRange() (((w = end - p) > max_width) ? \
-      (w = max_width, ellipsis = "...") : \
-      (w = (int)(end - p), ellipsis = ""))
-
   if (!p) return 0.0;
   while (ISSPACE(*p)) p++;
 
   if (!badcheck && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
     return 0.0;
   }
-  d = strtod(p, &end);
-  if (p == end) {
-    if (badcheck) {
-bad:
-      mrb_raisef(mrb, E_ARGUMENT_ERROR, "invalid string for float(%S)", mrb_str_new_cstr(mrb, p));
-      /* not reached */
+  d = mrb_float_read(mrb, p, &end, TRUE);
+  if (!badcheck && p != end && strchr(end, '_')) {
+    /* to_f drops every underscore once the number has started */
+    size_t len = strlen(p);
+    char *buf = (char *)mrb_malloc(mrb, len + 1);
+    char *b = buf;
+
+    for (; *p; p++) {
+      if (*p != '_') *b++ = *p;
     }
+    *b = '\0';
+    d = mrb_float_read(mrb, buf, NULL, FALSE);
+    mrb_free(mrb, buf);
     return d;
   }
-  if (*end) {
-    char buf[DBL_DIG * 4 + 10];
-    char *n = buf;
-    char *e = buf + sizeof(buf) - 1;
-    char prev = 0;
-
-    while (p < end && n < e) prev = *n++ = *p++;
-    while (*p) {
-      if (*p == '_') {
-        /* remove underscores between digits */
-        if (badcheck) {
-          if (n == buf || !ISDIGIT(prev)) goto bad;
-          ++p;
-          if (!ISDIGIT(*p)) goto bad;
-        }
-        else {
-          while (*++p == '_');
-          continue;
-        }
-      }
-      prev = *p++;
-      if (n < e) *n++ = prev;
-    }
-    *n = '\0';
-    p = buf;
-
-    if (!badcheck && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
-      return 0.0;
-    }
-
-    d = strtod(p, &end);
-    if (badcheck) {
-      if (!end || p == end) goto bad;
-      while (*end && ISSPACE(*end)) end++;
-      if (*end) goto bad;
-    }
+  if (badcheck) {
+    if (p == end) goto bad;
+    while (*end && ISSPACE(*end)) end++;
+    if (*end) goto bad;
   }
   return d;
+
+bad:
+  mrb_raisef(mrb, E_ARGUMENT_ERROR, "invalid string for float(%S)", mrb_str_new_cstr(mrb, p));
+  /* not reached */
+  return 0.0;
 }
 
 double
@@ -7,6 +7,7 @@
 #include <ctype.h>
 #include <string.h>
 #include "mruby.h"
+#include "mruby/gc.h"
 #include "mruby/khash.h"
 #include "mruby/string.h"
 
@@ -53,6 +54,17 @@ sym_intern(mrb_state *mrb, const char *name, size_t len, mrb_bool lit)
   if (k != kh_end(h))
     return kh_value(h, k);
 
+  if (mrb->symidx == INT16_MAX) {
+    mrb_raise(mrb, E_RUNTIME_ERROR, "too many symbols");
+  }
+  if ((size_t)mrb->symidx + 1 >= mrb->symcapa) {
+    size_t capa = mrb->symcapa ? mrb->symcapa * 2 : 256;
+
+    mrb->symtbl = (symbol_name*)mrb_realloc(mrb, mrb->symtbl, sizeof(symbol_name) * capa);
+    mrb->symstr = (struct RString**)mrb_realloc(mrb, mrb->symstr, sizeof(struct RString*) * capa);
+    memset(mrb->symstr + mrb->symcapa, 0, sizeof(struct RString*) * (capa - mrb->symcapa));
+    mrb->symcapa = capa;
+  }
   sym = ++mrb->symidx;
   if (lit) {
     sname.name = name;
@@ -63,6 +75,7 @@ sym_intern(mrb_state *mrb, const char *name, size_t len, mrb_bool lit)
     p[len] = 0;
     sname.name = (const char*)p;
   }
+  mrb->symtbl[sym] = sname;
   k = kh_put(n2s, mrb, h, sname);
   kh_value(h, k) = sym;
 
@@ -129,21 +142,12 @@ mrb_check_intern_str(mrb_state *mrb, mrb_value str)
 const char*
 mrb_sym2name_len(mrb_state *mrb, mrb_sym sym, mrb_int *lenp)
 {
-  khash_t(n2s) *h = mrb->name2sym;
-  khiter_t k;
-  symbol_name sname;
-
-  for (k = kh_begin(h); k != kh_end(h); k++) {
-    if (kh_exist(h, k)) {
-      if (kh_value(h, k) == sym) {
-        sname = kh_key(h, k);
-        if (lenp) *lenp = sname.len;
-        return sname.name;
-      }
-    }
+  if (sym <= 0 || sym > mrb->symidx) {
+    if (lenp) *lenp = 0;
+    return NULL;  /* missing */
   }
-  if (lenp) *lenp = 0;
-  return NULL;  /* missing */
+  if (lenp) *lenp = mrb->symtbl[sym].len;
+  return mrb->symtbl[sym].name;
 }
 
 void
@@ -161,6 +165,33 @@ mrb_free_symtbl(mrb_state *mrb)
       }
     }
   kh_destroy(n2s, mrb, mrb->name2sym);
+  mrb_free(mrb, mrb->symtbl);
+  mrb_free(mrb, mrb->symstr);
+}
+
+/* the strings of mrb_sym2str() live as long as the state */
+void
+mrb_gc_mark_symtbl(mrb_state *mrb)
+{
+  size_t i;
+
+  for (i = 1; i <= (size_t)mrb->symidx; i++) {
+    if (mrb->symstr[i]) {
+      mrb_gc_mark(mrb, (struct RBasic*)mrb->symstr[i]);
+    }
+  }
+}
+
+void
+mrb_gc_update_symtbl(mrb_state *mrb)
+{
+  size_t i;
+
+  for (i = 1; i <= (size_t)mrb->symidx; i++) {
+    if (mrb->symstr[i]) {
+      mrb->symstr[i] = mrb_str_ptr(mrb_gc_location(mrb, mrb_obj_value(mrb->symstr[i])));
+    }
+  }
 }
 
 void
@@ -411,14 +442,27 @@ sym_inspect(mrb_state *mrb, mrb_value sym)
   return str;
 }
 
+/*
+ * The string is made once per symbol and shared by every caller, so it
+ * must not be modified; mrb_str_dup() it for one that can be. One made
+ * while a region is open isn't kept, as the region would take it along.
+ */
 mrb_value
 mrb_sym2str(mrb_state *mrb, mrb_sym sym)
 {
   mrb_int len;
   const char *name = mrb_sym2name_len(mrb, sym, &len);
+  mrb_value str;
 
   if (!name) return mrb_undef_value(); /* can't happen */
-  return mrb_str_new_static(mrb, name, len);
+  if (mrb->symstr[sym]) {
+    return mrb_obj_value(mrb->symstr[sym]);
+  }
+  str = mrb_str_new_static(mrb, name, len);
+  if (mrb->region_depth == 0) {
+    mrb->symstr[sym] = mrb_str_ptr(str);
+  }
+  return str;
 }
 
 const char*
@@ -8,6 +8,7 @@
 #include "mruby.h"
 #include "mruby/array.h"
 #include "mruby/class.h"
+#include "mruby/gc.h"
 #include "mruby/proc.h"
 #include "mruby/string.h"
 
@@ -241,6 +242,20 @@ iv_size(mrb_state *mrb, iv_tbl *t)
   return 0;
 }
 
+static size_t
+iv_memsize(mrb_state *mrb, iv_tbl *t)
+{
+  segment *seg;
+  size_t size;
+
+  if (!t) return 0;
+  size = sizeof(iv_tbl);
+  for (seg = t->rootseg; seg; seg = seg->next) {
+    size += sizeof(segment);
+  }
+  return size;
+}
+
 static iv_tbl*
 iv_copy(mrb_state *mrb, iv_tbl *t)
 {
@@ -376,6 +391,16 @@ iv_size(mrb_state *mrb, iv_tbl *t)
   return 0;
 }
 
+static size_t
+iv_memsize(mrb_state *mrb, iv_tbl *t)
+{
+  khash_t(iv) *h;
+
+  if (!t) return 0;
+  h = &t->h;
+  return kh_memsize(h);
+}
+
 static iv_tbl*
 iv_copy(mrb_state *mrb, iv_tbl *t)
 {
@@ -430,6 +455,12 @@ mrb_gc_mark_iv_size(mrb_state *mrb, struct RObject *obj)
   return iv_size(mrb, obj->iv);
 }
 
+size_t
+mrb_gc_iv_memsize(mrb_state *mrb, struct RObject *obj)
+{
+  return iv_memsize(mrb, obj->iv);
+}
+
 void
 mrb_gc_free_iv(mrb_state *mrb, struct RObject *obj)
 {
@@ -438,6 +469,54 @@ mrb_gc_free_iv(mrb_state *mrb, struct RObject *obj)
   }
 }
 
+static int
+iv_update_i(mrb_state *mrb, mrb_sym sym, mrb_value v, void *p)
+{
+  mrb_value nv = mrb_gc_location(mrb, v);
+
+  /* overwriting an existing key doesn't restructure the table */
+  if (mrb_basic_p(v) && mrb_ptr(nv) != mrb_ptr(v)) {
+    iv_put(mrb, (iv_tbl*)p, sym, nv);
+  }
+  return 0;
+}
+
+static void
+update_tbl(mrb_state *mrb, iv_tbl *t)
+{
+  if (t) {
+    iv_foreach(mrb, t, iv_update_i, t);
+  }
+}
+
+void
+mrb_gc_update_gv(mrb_state *mrb)
+{
+  update_tbl(mrb, mrb->globals);
+}
+
+void
+mrb_gc_update_iv(mrb_state *mrb, struct RObject *obj)
+{
+  update_tbl(mrb, obj->iv);
+}
+
+static int
+iv_pin_i(mrb_state *mrb, mrb_sym sym, mrb_value v, void *p)
+{
+  mrb_gc_pin(mrb, v);
+  return 0;
+}
+
+/* C code may keep raw pointers to what a data object holds in its ivars */
+void
+mrb_gc_pin_iv(mrb_state *mrb, struct RObject *obj)
+{
+  if (obj->iv) {
+    iv_foreach(mrb, obj->iv, iv_pin_i, 0);
+  }
+}
+
 mrb_value
 mrb_vm_special_get(mrb_state *mrb, mrb_sym i)
 {
@@ -18,6 +18,7 @@
 #include "mruby/string.h"
 #include "mruby/variable.h"
 #include "mruby/error.h"
+#include "mruby/gc.h"
 #include "opcode.h"
 #include "value_array.h"
 #include "mrb_throw.h"
@@ -40,6 +41,11 @@ void abort(void);
 #define SET_OBJ_VALUE(r,v) MRB_SET_VALUE(r, (((struct RObject*)(v))->tt), value.p, (v))
 #ifdef MRB_NAN_BOXING
 #define SET_FLT_VALUE(mrb,r,v) r.f = (v)
+#elif defined(MRB_FLONUM)
+#define SET_FLT_VALUE(mrb,r,v) do {\
+  mrb_float f_ = (v);\
+  if (!mrb_flonum_encode(f_, &(r))) (r) = mrb_float_value(mrb, f_);\
+} while (0)
 #elif defined(MRB_WORD_BOXING)
 #define SET_FLT_VALUE(mrb,r,v) r = mrb_float_value(mrb, (v))
 #else
@@ -251,6 +257,7 @@ cipush(mrb_state *mrb)
   ci->pc = 0;
   ci->err = 0;
   ci->proc = 0;
+  ci->keep_self = FALSE;
 
   return ci;
 }
@@ -270,6 +277,7 @@ cipop(mrb_state *mrb)
       stack_copy(p, e->stack, len);
     }
     e->stack = p;
+    mrb_write_barrier(mrb, (struct RBasic*)e);
   }
 
   c->ci--;
@@ -719,7 +727,21 @@ RETRY_TRY_BLOCK:
 
     CASE(OP_LOADL) {
       /* A Bx   R(A) := Pool(Bx) */
-      regs[GETARG_A(i)] =  pool[GETARG_Bx(i)];
+      mrb_value v = pool[GETARG_Bx(i)];
+
+      if (mrb_type(v) == MRB_TT_STRING) {
+        /* an Integer literal too large for a Fixnum (see codegen.c) */
+        const char *p = RSTRING_PTR(v);
+
+        ERR_PC_SET(mrb, pc);
+        v = mrb_int_read_big(mrb, p + 2, RSTRING_END(v), p[0], p[1] == '-');
+        ERR_PC_CLR(mrb);
+        regs = mrb->c->stack;
+        regs[GETARG_A(i)] = v;
+        ARENA_RESTORE(mrb, ai);
+        NEXT;
+      }
+      regs[GETARG_A(i)] = v;
       NEXT;
     }
 
@@ -878,6 +900,9 @@ RETRY_TRY_BLOCK:
     CASE(OP_JMP) {
       /* sBx    pc+=sBx */
       pc += GETARG_sBx(i);
+      if (mrb->gc_compact_pending) {
+        mrb_gc_safe_point(mrb);
+      }
       JUMP;
     }
 
@@ -983,6 +1008,7 @@ RETRY_TRY_BLOCK:
       mrb_callinfo *ci;
       mrb_value recv, result;
       mrb_sym mid = syms[GETARG_B(i)];
+      mrb_bool keep_self = FALSE;
 
       recv = regs[a];
       if (GET_OPCODE(i) != OP_SENDB) {
@@ -1008,21 +1034,39 @@ RETRY_TRY_BLOCK:
           regs[a+1] = sym;
         }
       }
+      else if (MRB_PROC_CFUNC_P(m) && m->body.func == mrb_instance_new &&
+               mrb_type(recv) == MRB_TT_CLASS) {
+        /* Class#new: allocate here and call initialize in place of new */
+        struct RClass *ic = mrb_class_ptr(recv);
+        struct RProc *im = mrb_init_method_search(mrb, &ic);
+
+        if (im) {
+          recv = mrb_instance_alloc(mrb, recv);
+          regs[a] = recv;
+          mrb_gc_arena_restore(mrb, ai);
+          mid = mrb->sym_initialize;
+          m = im;
+          c = ic;
+          keep_self = TRUE;
+        }
+      }
 
       /* push callinfo */
       ci = cipush(mrb);
       ci->mid = mid;
       ci->proc = m;
       ci->stackent = mrb->c->stack;
-      if (c->tt == MRB_TT_ICLASS) {
+      if (c->tt == MRB_TT_ICLASS && !keep_self) {
         ci->target_class = c->c;
       }
       else {
+        /* initialize keeps the iclass so that super can follow it, as in mrb_funcall */
         ci->target_class = c;
       }
 
       ci->pc = pc + 1;
       ci->acc = a;
+      ci->keep_self = keep_self;
 
       /* prepare stack */
       mrb->c->stack += a;
@@ -1037,7 +1081,7 @@ RETRY_TRY_BLOCK:
           ci->nregs = n + 2;
         }
         result = m->body.func(mrb, recv);
-        mrb->c->stack[0] = result;
+        mrb->c->stack[0] = keep_self ? recv : result;
         mrb_gc_arena_restore(mrb, ai);
         if (mrb->exc) goto L_RAISE;
         /* pop stackpos */
@@ -1489,6 +1533,10 @@ RETRY_TRY_BLOCK:
         acc = ci->acc;
         pc = ci->pc;
         regs = mrb->c->stack = ci->stackent;
+        if (ci->keep_self && GETARG_B(i) != OP_R_BREAK) {
+          /* initialize called for Class#new; self is still in R(acc) */
+          v = regs[acc];
+        }
         if (acc == CI_ACC_SKIP) {
           mrb->jmp = prev_jmp;
           return v;
@@ -1593,8 +1641,6 @@ RETRY_TRY_BLOCK:
 #define attr_i value.i
 #ifdef MRB_NAN_BOXING
 #define attr_f f
-#elif defined(MRB_WORD_BOXING)
-#define attr_f value.fp->f
 #else
 #define attr_f value.f
 #endif
@@ -1618,7 +1664,8 @@ RETRY_TRY_BLOCK:
           x = mrb_fixnum(regs_a[0]);
           y = mrb_fixnum(regs_a[1]);
           if (mrb_int_add_overflow(x, y, &z)) {
-            SET_FLT_VALUE(mrb, regs_a[0], (mrb_float)x + (mrb_float)y);
+            regs_a[0] = mrb_int_overflow(mrb, '+', x, y);
+            mrb_gc_arena_restore(mrb, ai);
             break;
           }
           SET_INT_VALUE(regs[a], z);
@@ -1676,7 +1723,8 @@ RETRY_TRY_BLOCK:
           x = mrb_fixnum(regs[a]);
           y = mrb_fixnum(regs[a+1]);
           if (mrb_int_sub_overflow(x, y, &z)) {
-            SET_FLT_VALUE(mrb, regs[a], (mrb_float)x - (mrb_float)y);
+            regs[a] = mrb_int_overflow(mrb, '-', x, y);
+            mrb_gc_arena_restore(mrb, ai);
             break;
           }
           SET_INT_VALUE(regs[a], z);
@@ -1729,12 +1777,9 @@ RETRY_TRY_BLOCK:
 
           x = mrb_fixnum(regs[a]);
           y = mrb_fixnum(regs[a+1]);
-          z = x * y;
-#ifdef MRB_WORD_BOXING
-          z = (z << MRB_FIXNUM_SHIFT) / (1 << MRB_FIXNUM_SHIFT);
-#endif
-          if (x != 0 && z/x != y) {
-            SET_FLT_VALUE(mrb, regs[a], (mrb_float)x * (mrb_float)y);
+          if (mrb_int_mul_overflow(x, y, &z)) {
+            regs[a] = mrb_int_overflow(mrb, '*', x, y);
+            mrb_gc_arena_restore(mrb, ai);
           }
           else {
             SET_INT_VALUE(regs[a], z);
@@ -1842,7 +1887,8 @@ RETRY_TRY_BLOCK:
           mrb_int z;
 
           if (mrb_int_add_overflow(x, y, &z)) {
-            SET_FLT_VALUE(mrb, regs[a], (mrb_float)x + (mrb_float)y);
+            regs[a] = mrb_int_overflow(mrb, '+', x, y);
+            mrb_gc_arena_restore(mrb, ai);
             break;
           }
           regs[a].attr_i = z;
@@ -1880,7 +1926,8 @@ RETRY_TRY_BLOCK:
           mrb_int z;
 
           if (mrb_int_sub_overflow(x, y, &z)) {
-            SET_FLT_VALUE(mrb, regs_a[0], (mrb_float)x - (mrb_float)y);
+            regs_a[0] = mrb_int_overflow(mrb, '-', x, y);
+            mrb_gc_arena_restore(mrb, ai);
           }
           else {
             regs_a[0].attr_i = z;
@@ -1905,23 +1952,23 @@ RETRY_TRY_BLOCK:
       NEXT;
     }
 
-#define OP_CMP_BODY(op,v1,v2) (regs[a].v1 op regs[a+1].v2)
+#define OP_CMP_BODY(op,v1,v2) (v1(regs[a]) op v2(regs[a+1]))
 
 #define OP_CMP(op) do {\
   int result;\
   /* need to check if - is overridden */\
   switch (TYPES2(mrb_type(regs[a]),mrb_type(regs[a+1]))) {\
   case TYPES2(MRB_TT_FIXNUM,MRB_TT_FIXNUM):\
-    result = OP_CMP_BODY(op,attr_i,attr_i);\
+    result = OP_CMP_BODY(op,mrb_fixnum,mrb_fixnum);\
     break;\
   case TYPES2(MRB_TT_FIXNUM,MRB_TT_FLOAT):\
-    result = OP_CMP_BODY(op,attr_i,attr_f);\
+    result = OP_CMP_BODY(op,mrb_fixnum,mrb_float);\
     break;\
   case TYPES2(MRB_TT_FLOAT,MRB_TT_FIXNUM):\
-    result = OP_CMP_BODY(op,attr_f,attr_i);\
+    result = OP_CMP_BODY(op,mrb_float,mrb_fixnum);\
     break;\
   case TYPES2(MRB_TT_FLOAT,MRB_TT_FLOAT):\
-    result = OP_CMP_BODY(op,attr_f,attr_f);\
+    result = OP_CMP_BODY(op,mrb_float,mrb_float);\
     break;\
   default:\
     goto L_SEND;\
@@ -1976,15 +2023,19 @@ RETRY_TRY_BLOCK:
 
     CASE(OP_ARRAY) {
       /* A B C          R(A) := ary_new(R(B),R(B+1)..R(B+C)) */
+      ERR_PC_SET(mrb, pc);
       regs[GETARG_A(i)] = mrb_ary_new_from_values(mrb, GETARG_C(i), &regs[GETARG_B(i)]);
+      ERR_PC_CLR(mrb);
       ARENA_RESTORE(mrb, ai);
       NEXT;
     }
 
     CASE(OP_ARYCAT) {
       /* A B            mrb_ary_concat(R(A),R(B)) */
+      ERR_PC_SET(mrb, pc);
       mrb_ary_concat(mrb, regs[GETARG_A(i)],
                      mrb_ary_splat(mrb, regs[GETARG_B(i)]));
+      ERR_PC_CLR(mrb);
       ARENA_RESTORE(mrb, ai);
       NEXT;
     }
@@ -2028,6 +2079,7 @@ RETRY_TRY_BLOCK:
       int pre  = GETARG_B(i);
       int post = GETARG_C(i);
 
+      ERR_PC_SET(mrb, pc);
       if (!mrb_array_p(v)) {
         regs[a++] = mrb_ary_new_capa(mrb, 0);
         while (post--) {
@@ -2057,13 +2109,16 @@ RETRY_TRY_BLOCK:
           }
         }
       }
+      ERR_PC_CLR(mrb);
       ARENA_RESTORE(mrb, ai);
       NEXT;
     }
 
     CASE(OP_STRING) {
       /* A Bx           R(A) := str_new(Lit(Bx)) */
+      ERR_PC_SET(mrb, pc);
       regs[GETARG_A(i)] = mrb_str_dup(mrb, pool[GETARG_Bx(i)]);
+      ERR_PC_CLR(mrb);
       ARENA_RESTORE(mrb, ai);
       NEXT;
     }
@@ -2079,12 +2134,15 @@ RETRY_TRY_BLOCK:
       int b = GETARG_B(i);
       int c = GETARG_C(i);
       int lim = b+c*2;
-      mrb_value hash = mrb_hash_new_capa(mrb, c);
+      mrb_value hash;
 
+      ERR_PC_SET(mrb, pc);
+      hash = mrb_hash_new_capa(mrb, c);
       while (b < lim) {
         mrb_hash_set(mrb, hash, regs[b], regs[b+1]);
         b+=2;
       }
+      ERR_PC_CLR(mrb);
       regs[GETARG_A(i)] = hash;
       ARENA_RESTORE(mrb, ai);
       NEXT;
@@ -2095,12 +2153,14 @@ RETRY_TRY_BLOCK:
       struct RProc *p;
       int c = GETARG_c(i);
 
+      ERR_PC_SET(mrb, pc);
       if (c & OP_L_CAPTURE) {
         p = mrb_closure_new(mrb, irep->reps[GETARG_b(i)]);
       }
       else {
         p = mrb_proc_new(mrb, irep->reps[GETARG_b(i)]);
       }
+      ERR_PC_CLR(mrb);
       if (c & OP_L_STRICT) p->flags |= MRB_PROC_STRICT;
       regs[GETARG_A(i)] = mrb_obj_value(p);
       ARENA_RESTORE(mrb, ai);
@@ -2223,7 +2283,9 @@ RETRY_TRY_BLOCK:
     CASE(OP_RANGE) {
       /* A B C  R(A) := range_new(R(B),R(B+1),C) */
       int b = GETARG_B(i);
+      ERR_PC_SET(mrb, pc);
       regs[GETARG_A(i)] = mrb_range_new(mrb, regs[b], regs[b+1], GETARG_C(i));
+      ERR_PC_CLR(mrb);
       ARENA_RESTORE(mrb, ai);
       NEXT;
     }
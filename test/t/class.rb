@@ -64,6 +64,49 @@ assert('Class#new', '15.2.3.3.3') do
   # with block doesn't work yet
 end
 
+assert('Class#new calls initialize', '15.2.3.3.3') do
+  class NewInitTest
+    attr_reader :args
+    def initialize(*args, &b)
+      @args = args
+      @args << b.call if b
+      :ignored
+    end
+  end
+
+  assert_kind_of NewInitTest, NewInitTest.new
+  assert_equal [1, 2], NewInitTest.new(1, 2).args
+  assert_equal [1, 2, 3], NewInitTest.new(*[1, 2, 3]).args
+  assert_equal [1, :blk], NewInitTest.new(1) { :blk }.args
+  assert_equal :brk, NewInitTest.new { break :brk }
+
+  class NewInitTest
+    def initialize(x)
+      @args = [x * 2]
+    end
+  end
+  assert_equal [4], NewInitTest.new(2).args
+
+  module NewInitModule
+    def initialize
+      @args = :module
+    end
+  end
+  class NewInitSub
+    attr_reader :args
+  end
+  assert_nil NewInitSub.new.args
+  NewInitSub.__send__(:include, NewInitModule)
+  assert_equal :module, NewInitSub.new.args
+
+  class NewInitRaise
+    def initialize
+      raise ArgumentError
+    end
+  end
+  assert_raise(ArgumentError) { NewInitRaise.new }
+end
+
 assert('Class#superclass', '15.2.3.3.4') do
   class SubClass < String; end
   assert_equal(String, SubClass.superclass)
@@ -182,3 +182,46 @@ assert('Float#nan?') do
   assert_false (1.0/0.0).nan?
   assert_false (-1.0/0.0).nan?
 end
+
+assert('Float values survive arithmetic and GC') do
+  # covers both inline (flonum) and heap-boxed encodings under MRB_WORD_BOXING
+  double = 1.0 + 1.0e-15 > 1.0
+  values = [0.0, -0.0, 1.5, -2.5, 1.0e-30, -1.0e30, 1.0/0, -1.0/0]
+  if double
+    # beyond the exponents a flonum holds, and a float
+    values += [1.0e-300, -1.0e300, 1.0e77, 1.0e-77, 3.0e-78]
+  end
+  copies = values.map { |f| f * 1.0 }
+  GC.start
+  values.each_with_index do |f, i|
+    assert_true f == copies[i]
+    assert_kind_of Float, copies[i]
+  end
+  assert_true (-0.0 * 1.0).to_s == (-0.0).to_s
+  assert_equal 2.0e30, 1.0e30 + 1.0e30
+  assert_true 1.0e-30 < 1.0e-29
+  if double
+    assert_equal 2.0e300, 1.0e300 + 1.0e300
+    assert_true 1.0e-300 < 1.0e-299
+  end
+  assert_equal 3, {1.5 => 3}[1.5]
+end
+
+assert('Float#to_s shortest round-trip') do
+  assert_equal "0.1", 0.1.to_s
+  assert_equal "100.0", 100.0.to_s
+  assert_equal "1.0e+16", 1.0e16.to_s
+  assert_equal "1.5e+15", 1.5e15.to_s
+  assert_equal "0.0001", 0.0001.to_s
+  assert_equal "1.0e-05", 0.00001.to_s
+  assert_equal "0.0", 0.0.to_s
+  assert_equal "-0.0", (0.0 * -1.0).to_s
+end
+
+assert('Float#to_s shortest round-trip of doubles') do
+  skip "Float is single precision" unless 1.0 + 1.0e-15 > 1.0
+  assert_equal "0.30000000000000004", (0.1 + 0.2).to_s
+  assert_equal "123456789012345.6", 123456789012345.6.to_s
+  assert_equal "-2.5e-300", -2.5e-300.to_s
+  assert_equal "1.7976931348623157e+308", 1.7976931348623157e308.to_s
+end
@@ -43,3 +43,375 @@ assert('GC.generational_mode=') do
     GC.generational_mode = origin
   end
 end
+
+assert('GC.malloc_limit=') do
+  origin = GC.malloc_limit
+  begin
+    assert_equal 1024 * 1024, (GC.malloc_limit = 1024 * 1024)
+    assert_equal 1024 * 1024, GC.malloc_limit
+    assert_raise(ArgumentError) { GC.malloc_limit = 0 }
+    # too few objects for the object count to start a cycle
+    GC.start
+    count = GC.stat(:count)
+    200.times { "x" * 50_000 }
+    assert_true GC.stat(:count) > count
+    GC.malloc_limit = 1 << 29
+    GC.start
+    count = GC.stat(:count)
+    200.times { "x" * 50_000 }
+    assert_equal count, GC.stat(:count)
+  ensure
+    GC.malloc_limit = origin
+  end
+end
+
+assert('GC.step_budget_us=') do
+  origin = GC.step_budget_us
+  gen = GC.generational_mode
+  begin
+    assert_equal 200, (GC.step_budget_us = 200)
+    assert_equal 200, GC.step_budget_us
+    assert_raise(ArgumentError) { GC.step_budget_us = -1 }
+    GC.generational_mode = false
+    GC.step_budget_us = 1
+    GC.start
+    pauses = GC.stat(:pause_count)
+    cycles = GC.stat(:count)
+    keep = []
+    20_000.times { |i| keep << "s#{i}" }
+    i = 0
+    while GC.stat(:count) < cycles + 2 && i < 1_000_000
+      "s#{i}"
+      i += 1
+    end
+    # no 1us step gets through a cycle, so the cycles took several pauses
+    assert_true GC.stat(:count) >= cycles + 2
+    assert_true GC.stat(:pause_count) - pauses > GC.stat(:count) - cycles
+    assert_equal 0, (GC.step_budget_us = 0)
+  ensure
+    GC.step_budget_us = origin
+    GC.generational_mode = gen
+  end
+end
+
+assert('GC.pause_stats') do
+  GC.start
+  s = GC.pause_stats
+  assert_true s[:count] > 0
+  assert_true s[:p50] <= s[:p90]
+  assert_true s[:p90] <= s[:p99]
+  assert_true s[:p99] <= s[:p999]
+  assert_true s[:p999] <= s[:max]
+end
+
+assert('GC.stat') do
+  before = GC.stat
+  GC.start
+  s = GC.stat
+  assert_true s[:count] > before[:count]
+  assert_true s[:root_scan_count] > before[:root_scan_count]
+  assert_equal s[:count], GC.stat(:count)
+  assert_equal s[:minor_gc_count] + s[:major_gc_count], s[:root_scan_count]
+  assert_true s[:heap_pages] > 0
+  assert_true s[:live] > 0
+  assert_true s[:max_pause_us] <= s[:total_pause_us]
+  assert_equal s[:pause_count], s[:pause_histogram].values.inject(0) { |a, b| a + b }
+  assert_nil GC.stat(:no_such_key)
+end
+
+assert('GC reuses pages of dead objects') do
+  GC.start
+  pages = GC.stat(:heap_pages)
+  50_000.times { |i| [i, "#{i}"] }
+  GC.start
+  assert_true GC.stat(:heap_pages) <= pages + 2
+end
+
+assert('GC.reserve') do
+  GC.start
+  begin
+    assert_nil GC.reserve(100_000)
+    assert_true GC.stat(:free_slots) >= 100_000
+    pages = GC.stat(:heap_pages)
+    count = GC.stat(:count)
+    keep = []
+    40_000.times { |i| keep << "r#{i}" }
+    assert_equal count, GC.stat(:count)
+    assert_equal pages, GC.stat(:heap_pages)
+    keep = nil
+    GC.start
+    assert_equal pages, GC.stat(:heap_pages)
+  ensure
+    GC.reserve(0)
+  end
+  assert_raise(ArgumentError) { GC.reserve(-1) }
+end
+
+assert('GC.heap_growth_ratio=') do
+  origin = GC.heap_growth_ratio
+  burst = lambda do |ratio|
+    GC.heap_growth_ratio = ratio
+    GC.reserve(0)
+    GC.start
+    # keep 30,000 objects more than the free slots can hold
+    n = GC.stat(:free_slots) + 30_000
+    count = GC.stat(:count)
+    sizes = [GC.stat(:heap_pages)]
+    keep = []
+    n.times do |i|
+      keep << []
+      garbage = [i]
+      sizes << GC.stat(:heap_pages) if i % 500 == 0
+    end
+    sizes << GC.stat(:heap_pages)
+    [sizes, GC.stat(:count) - count]
+  end
+  # steps the heap grew by, and whether one added at least half its pages
+  steps = lambda do |sizes|
+    (1...sizes.size).count { |k| sizes[k] > sizes[k - 1] }
+  end
+  big_step = lambda do |sizes|
+    (1...sizes.size).any? do |k|
+      added = sizes[k] - sizes[k - 1]
+      added >= 8 && added >= sizes[k - 1] / 2
+    end
+  end
+  begin
+    assert_equal 100, (GC.heap_growth_ratio = 100)
+    assert_equal 100, GC.heap_growth_ratio
+    assert_raise(ArgumentError) { GC.heap_growth_ratio = -1 }
+    linear, linear_gcs = burst.call(0)
+    geometric, geometric_gcs = burst.call(100)
+    assert_true steps.call(geometric) * 2 < steps.call(linear)
+    assert_true big_step.call(geometric)
+    assert_false big_step.call(linear)
+    assert_true geometric_gcs <= linear_gcs
+  ensure
+    GC.heap_growth_ratio = origin
+  end
+end
+
+assert('GC.compact') do
+  o = Object.new
+  id = o.object_id
+  keep = []
+  h = { o => :obj }
+  20_000.times { |i| keep << ["s#{i}", { i => i.to_s }, i.to_f] if i % 8 == 0 }
+  keep = keep.select { |a| a[2] % 24 == 0 }
+  moved = GC.compact
+  assert_kind_of Fixnum, moved
+  assert_true GC.stat(:compact_count) > 0
+  assert_equal id, o.object_id
+  assert_equal :obj, h[o]
+  keep.each do |a|
+    i = a[2].to_i
+    assert_equal "s#{i}", a[0]
+    assert_equal i.to_s, a[1][i]
+  end
+  assert_nil Object.new.instance_eval { GC.compact }
+end
+
+assert('GC.region') do
+  freed = GC.stat(:region_freed)
+  kept = []
+  h = {}
+  local = nil
+  r = GC.region do
+    1000.times { |i| "tmp#{i}" }
+    kept << "kept"
+    h[:k] = [1, "v"]
+    $gc_region_test = "global"
+    local = "local"
+    "result"
+  end
+  assert_equal "result", r
+  assert_equal ["kept"], kept
+  assert_equal [1, "v"], h[:k]
+  assert_equal "global", $gc_region_test
+  assert_equal "local", local
+  assert_true GC.stat(:region_freed) >= freed + 1000
+
+  big = GC.region do
+    a = []
+    20_000.times { |i| a << "s#{i}" if i % 2 == 0; "t#{i}" }
+    GC.start
+    a
+  end
+  assert_equal 10_000, big.size
+  assert_equal "s19998", big.last
+
+  assert_raise(RuntimeError) { GC.region { raise "region" } }
+  assert_equal 7, GC.region { GC.region { 7 } }
+  assert_raise(ArgumentError) { GC.region }
+end
+
+assert('GC.compact_threshold=') do
+  origin = GC.compact_threshold
+  begin
+    assert_equal 30, (GC.compact_threshold = 30)
+    assert_equal 30, GC.compact_threshold
+    assert_raise(ArgumentError) { GC.compact_threshold = 100 }
+    assert_raise(ArgumentError) { GC.compact_threshold = -1 }
+  ensure
+    GC.compact_threshold = origin
+  end
+end
+
+if GC.respond_to?(:mark_threads)
+  assert('GC.mark_threads=') do
+    origin = GC.mark_threads
+    begin
+      GC.mark_threads = 4
+      assert_equal 4, GC.mark_threads
+      assert_raise(ArgumentError) { GC.mark_threads = 0 }
+      keep = []
+      50_000.times { |i| keep << [i, "v#{i}", { i => [i.to_f] }] }
+      keep = keep.select { |a| a[0] % 3 == 0 }
+      GC.start
+      50_000.times { |i| "garbage#{i}" }
+      GC.start
+      keep.each do |a|
+        assert_equal "v#{a[0]}", a[1]
+        assert_equal [a[0].to_f], a[2][a[0]]
+      end
+    ensure
+      GC.mark_threads = origin
+    end
+  end
+end
+
+assert('GC.lazy_sweep=') do
+  origin = GC.lazy_sweep
+  begin
+    assert_true(GC.lazy_sweep = true)
+    assert_true GC.lazy_sweep
+    keep = []
+    20_000.times { |i| s = "lazy#{i}"; keep << s if i % 10 == 0 }
+    GC.start
+    count = GC.stat(:count)
+    50_000.times { |i| [i] }
+    assert_true GC.stat(:count) > count
+    keep.each_with_index { |s, i| assert_equal "lazy#{i * 10}", s }
+
+    GC.start
+    count = GC.stat(:count)
+    GC.lazy_sweep = false
+    assert_equal count + 1, GC.stat(:count)
+  ensure
+    GC.lazy_sweep = origin
+  end
+end
+
+assert('GC card marking of large containers') do
+  origin = GC.generational_mode
+  ratio = GC.heap_growth_ratio
+  begin
+    GC.generational_mode = true
+    # the garbage below has to set off minor GCs, not heap growth
+    GC.heap_growth_ratio = 0
+    a = Array.new(4096) { |i| "a#{i}" }
+    h = {}
+    2048.times { |i| h[i] = "h#{i}" }
+    GC.start
+    scans = GC.stat(:card_scans)
+    i = 0
+    while i < 4096
+      a[i] = "b#{i}" if i % 7 == 0
+      h[i % 2048] = "g#{i}" if i % 5 == 0
+      20.times { |j| "garbage#{j}" }
+      i += 1
+    end
+    a.reverse!
+    a.reverse!
+    GC.start
+    assert_true GC.stat(:card_scans) > scans
+    i = 0
+    while i < 4096
+      assert_equal(i % 7 == 0 ? "b#{i}" : "a#{i}", a[i])
+      i += 1
+    end
+    assert_equal "g2045", h[2045]
+    assert_equal "h1", h[1]
+  ensure
+    GC.generational_mode = origin
+    GC.heap_growth_ratio = ratio
+  end
+end
+
+assert('GC embeds small arrays in wide slots') do
+  arys = []
+  30.times do |n|
+    a = Array.new(n) { |i| "e#{i}" }
+    arys << a
+  end
+  grown = [1, 2]
+  10.times { |i| grown << "g#{i}" }
+  cleared = ["x", "y"]
+  cleared.clear
+  cleared << "z"
+  src = [1, 2, 3]
+  sub = src[1, 2]
+  src[0] = 9
+  shifted = ["a", "b", "c"]
+  shifted.shift
+  GC.start
+  GC.compact if GC.respond_to?(:compact)
+  50_000.times { |i| [i, i] }
+  GC.start
+  arys.each_with_index do |a, n|
+    assert_equal n, a.size
+    assert_equal "e#{n - 1}", a.last if n > 0
+  end
+  assert_equal [1, 2, "g0", "g1", "g2", "g3", "g4", "g5", "g6", "g7", "g8", "g9"], grown
+  assert_equal ["z"], cleared
+  assert_equal [2, 3], sub
+  assert_equal [9, 2, 3], src
+  assert_equal ["b", "c"], shifted
+end
+
+assert('GC memory limits') do
+  st = GC.stat
+  assert_true st[:memory_bytes] > 0
+  assert_true st[:memory_peak] >= st[:memory_bytes]
+  assert_equal st[:memory_bytes],
+    st[:memory_payload_bytes] + st[:memory_heap_bytes] + st[:memory_compiler_bytes]
+  assert_true st[:memory_heap_bytes] > 0
+  assert_nil GC.memory_limit
+
+  begin
+    GC.memory_soft_limit = st[:memory_bytes] + 1_000_000
+    count = GC.stat[:count]
+    keep = []
+    200.times { |i| keep << "s" * 10_000 }
+    assert_true GC.stat[:count] > count
+    keep = nil
+
+    GC.memory_limit = GC.stat[:memory_bytes] + 1_000_000
+    assert_raise(NoMemoryError) { "x" * 5_000_000 }
+    e = nil
+    begin
+      "y" * 5_000_000
+    rescue NoMemoryError => e
+    end
+    assert_equal "failed to allocate memory", e.message
+    assert_false NoMemoryError.ancestors.include?(StandardError)
+    assert_equal "ok" * 3, "ok" * 3
+
+    # a Hash resizing its table into the limit stays whole
+    h = {}
+    GC.memory_limit = GC.stat[:memory_bytes] + 2_000_000
+    assert_raise(NoMemoryError) do
+      100_000.times { |i| h[i] = i.to_s }
+    end
+    GC.memory_limit = nil
+    GC.start
+    n = 0
+    h.size.times { |i| n += 1 if h[i] == i.to_s }
+    assert_equal h.size, n
+    assert_raise(ArgumentError) { GC.memory_limit = 0 }
+  ensure
+    GC.memory_limit = nil
+    GC.memory_soft_limit = nil
+  end
+  assert_equal 5_000_000, ("z" * 5_000_000).size
+end
@@ -114,9 +114,13 @@ assert('Integer#<<', '15.2.8.3.12') do
   # Left Shift by a negative is Right Shift
   assert_equal 23, 46 << -1
 
-  # Raise when shift is too large
-  assert_raise(RangeError) do
-    2 << 128
+  # Raise when shift is too large (promotes to Bignum if available)
+  if Object.const_defined?(:Bignum)
+    assert_equal 2**129, 2 << 128
+  else
+    assert_raise(RangeError) do
+      2 << 128
+    end
   end
 end
 
@@ -132,9 +136,13 @@ assert('Integer#>>', '15.2.8.3.13') do
   # Don't raise on large Right Shift
   assert_equal 0, 23 >> 128
 
-  # Raise when shift is too large
-  assert_raise(RangeError) do
-    2 >> -128
+  # Raise when shift is too large (promotes to Bignum if available)
+  if Object.const_defined?(:Bignum)
+    assert_equal 2**129, 2 >> -128
+  else
+    assert_raise(RangeError) do
+      2 >> -128
+    end
   end
 end
 
@@ -197,6 +205,9 @@ end
 assert('Integer#to_s', '15.2.8.3.25') do
   assert_equal '1', 1.to_s
   assert_equal("-1", -1.to_s)
+  assert_equal "123456789", 123456789.to_s
+  assert_equal "-1073741823", -1073741823.to_s
+  assert_equal "-ff", -255.to_s(16)
 end
 
 assert('Integer#truncate', '15.2.8.3.26') do
@@ -442,6 +442,33 @@ assert('String#to_i', '15.2.10.5.39') do
   assert_equal 1_000, e
 end
 
+assert('String#to_i with long digit runs') do
+  assert_equal 123456789, '000000000123456789'.to_i
+  assert_equal(-98765432, '-98_765_432 apples'.to_i)
+  assert_equal 1, '1__0'.to_i
+  assert_equal 0x7fff, '7fff'.to_i(16)
+  if Object.const_defined?(:Bignum)
+    assert_equal 123456789012345678901234567890, '123456789012345678901234567890'.to_i
+  else
+    assert_raise(ArgumentError) { '123456789012345678901234567890'.to_i }
+  end
+end
+
+assert('String#to_f exact rounding') do
+  assert_equal 0.1, '0.1'.to_f
+  assert_equal 9007199254740992.0, '9007199254740993'.to_f
+  assert_equal 2.2250738585072014e-308, '2.2250738585072014e-308'.to_f
+  assert_equal 1.7976931348623157e308, '1.7976931348623157e308'.to_f
+  assert_equal 1000.5, '1_000.5'.to_f
+  assert_equal 10.5, '1__0.5'.to_f
+  assert_equal 1.5, '1_.5'.to_f
+  assert_equal 1.0e10, '1e1__0'.to_f
+  assert_equal 0.5, '.5'.to_f
+  assert_equal 3.25, '  3.25xyz'.to_f
+  assert_equal 1.0e+23, '100000000000000000000000'.to_f
+  assert_equal 123.456, '123.456000000000000000000000001'.to_f
+end
+
 assert('String#to_s', '15.2.10.5.40') do
   assert_equal 'abc', 'abc'.to_s
 end
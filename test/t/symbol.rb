@@ -25,3 +25,12 @@ end
 assert('Symbol#to_sym', '15.2.11.3.4') do
   assert_equal :abc, :abc.to_sym
 end
+
+assert('Symbol names after many symbols') do
+  syms = (0...2000).map { |i| "sym_index_#{i}".to_sym }
+  GC.start
+  assert_equal "sym_index_0", syms[0].to_s
+  assert_equal "sym_index_1999", syms[1999].to_s
+  assert_equal :sym_index_1000, "sym_index_1000".to_sym
+  assert_equal ":sym_index_42", syms[42].inspect
+end